@@ -114,12 +114,16 @@ PublicDependencyModuleNames.AddRange(new string[]
                 "AudioEditor", "DataValidation", "NiagaraEditor", "Blutilities",
                 // Phase 24: GAS, Audio, and missing module dependencies
                 "GameplayAbilities",  // Required for UAttributeSet, UGameplayEffect, UGameplayAbility, etc.
-                "AudioMixer"          // Required for FAudioEQEffect::ClampValues
+                "AudioMixer",         // Required for FAudioEQEffect::ClampValues
+                "TargetPlatform"      // Running target platform for import_sound_waves compression
             });
 
             // Add OpenSSL for TLS support (requires WITH_SSL)
             AddEngineThirdPartyPrivateStaticDependencies(Target, "OpenSSL");
 
+            // zlib provides raw deflate for the permessage-deflate WebSocket extension
+            AddEngineThirdPartyPrivateStaticDependencies(Target, "zlib");
+
             PrivateDependencyModuleNames.AddRange(new string[]
             {
 "LandscapeEditor","LandscapeEditorUtilities","Foliage","FoliageEdit",
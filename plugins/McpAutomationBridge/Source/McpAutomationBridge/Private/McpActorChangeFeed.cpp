@@ -0,0 +1,390 @@
+#include "McpActorChangeFeed.h"
+
+#include "McpJsonUtf8Writer.h"
+
+#if WITH_EDITOR
+#include "Components/SceneComponent.h"
+#include "Editor.h"
+#include "Engine/Engine.h"
+#include "Engine/Selection.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/Actor.h"
+#include "Misc/CoreDelegates.h"
+#include "UObject/UObjectGlobals.h"
+#endif
+
+namespace {
+// Past this many property names an actor's entry just says "*".
+constexpr int32 MaxChangedProperties = 16;
+
+#if WITH_EDITOR
+bool IsFeedWorld(const UWorld *World) {
+  // Preview scenes (asset editors, thumbnails) spawn actors nobody asked about.
+  return World && (World->WorldType == EWorldType::Editor ||
+                   World->WorldType == EWorldType::PIE);
+}
+
+// Fixed decimals with trailing zeros trimmed: transforms are the bulk of a
+// drag, and %.17g would spell 0.1 as 0.10000000000000001.
+void AppendFeedNumber(FString &Out, double Value, int32 Decimals) {
+  FString Text = FMath::IsFinite(Value)
+                     ? FString::Printf(TEXT("%.*f"), Decimals, Value)
+                     : FString(TEXT("0"));
+  if (Text.Contains(TEXT("."))) {
+    int32 End = Text.Len();
+    while (End > 0 && Text[End - 1] == TEXT('0')) {
+      --End;
+    }
+    if (End > 0 && Text[End - 1] == TEXT('.')) {
+      --End;
+    }
+    Text.LeftInline(End);
+  }
+  if (Text == TEXT("-0")) {
+    Text = TEXT("0");
+  }
+  if (!Out.IsEmpty()) {
+    Out += TEXT(',');
+  }
+  Out += Text;
+}
+
+void WriteFeedTransform(FMcpJsonUtf8Writer &Writer, const AActor *Actor) {
+  const FTransform Transform = Actor->GetActorTransform();
+  const FVector Location = Transform.GetLocation();
+  const FRotator Rotation = Transform.Rotator();
+  const FVector Scale = Transform.GetScale3D();
+  FString Values;
+  AppendFeedNumber(Values, Location.X, 2);
+  AppendFeedNumber(Values, Location.Y, 2);
+  AppendFeedNumber(Values, Location.Z, 2);
+  AppendFeedNumber(Values, Rotation.Pitch, 2);
+  AppendFeedNumber(Values, Rotation.Yaw, 2);
+  AppendFeedNumber(Values, Rotation.Roll, 2);
+  AppendFeedNumber(Values, Scale.X, 3);
+  AppendFeedNumber(Values, Scale.Y, 3);
+  AppendFeedNumber(Values, Scale.Z, 3);
+  const FTCHARToUTF8 Utf8(*FString::Printf(TEXT("[%s]"), *Values));
+  Writer.Key(TEXT("t"));
+  Writer.RawValue(TArrayView<const uint8>(
+      reinterpret_cast<const uint8 *>(Utf8.Get()), Utf8.Length()));
+}
+
+void WriteFeedActor(FMcpJsonUtf8Writer &Writer, const AActor *Actor) {
+  Writer.BeginObject();
+  Writer.WriteString(TEXT("path"), Actor->GetPathName());
+  Writer.WriteString(TEXT("label"), Actor->GetActorLabel());
+  Writer.WriteString(TEXT("class"), Actor->GetClass()->GetName());
+  Writer.WriteString(TEXT("world"),
+                     Actor->GetWorld() &&
+                             Actor->GetWorld()->WorldType == EWorldType::PIE
+                         ? TEXT("pie")
+                         : TEXT("editor"));
+  WriteFeedTransform(Writer, Actor);
+  Writer.EndObject();
+}
+
+void WriteFeedSelection(FMcpJsonUtf8Writer &Writer) {
+  Writer.Key(TEXT("selection"));
+  Writer.BeginArray();
+  if (GEditor && GEditor->GetSelectedActors()) {
+    for (FSelectionIterator It(*GEditor->GetSelectedActors()); It; ++It) {
+      if (const AActor *Actor = Cast<AActor>(*It)) {
+        Writer.String(Actor->GetPathName());
+      }
+    }
+  }
+  Writer.EndArray();
+}
+
+bool IsRootTransformProperty(const USceneComponent *Component, FName Name) {
+  if (!Component || !Component->GetOwner() ||
+      Component->GetOwner()->GetRootComponent() != Component) {
+    return false;
+  }
+  return Name == USceneComponent::GetRelativeLocationPropertyName() ||
+         Name == USceneComponent::GetRelativeRotationPropertyName() ||
+         Name == USceneComponent::GetRelativeScale3DPropertyName();
+}
+#endif
+} // namespace
+
+FMcpActorChangeFeed::FMcpActorChangeFeed(int32 InMaxPending)
+    : MaxPending(FMath::Max(1, InMaxPending)) {
+#if WITH_EDITOR
+  if (GEngine) {
+    ActorAddedHandle = GEngine->OnLevelActorAdded().AddLambda(
+        [this](AActor *Actor) { Track(Actor, Added); });
+    ActorDeletedHandle = GEngine->OnLevelActorDeleted().AddRaw(
+        this, &FMcpActorChangeFeed::OnActorDeleted);
+    // Gizmo drags and SetActorLocation from the editor; fires once per
+    // mouse move, which the per-actor entry absorbs.
+    ActorMovedHandle = GEngine->OnActorMoved().AddLambda(
+        [this](AActor *Actor) { Track(Actor, Moved); });
+  }
+  LabelChangedHandle = FCoreDelegates::OnActorLabelChanged.AddLambda(
+      [this](AActor *Actor) { Track(Actor, Renamed); });
+  PropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(
+      this, &FMcpActorChangeFeed::OnPropertyChanged);
+  // The actor selection reports whole-set changes; single clicks come
+  // through SelectObjectEvent with the object itself.
+  SelectionChangedHandle = USelection::SelectionChangedEvent.AddLambda(
+      [this](UObject *Selection) {
+        if (GEditor && Selection == GEditor->GetSelectedActors()) {
+          bSelectionChanged = true;
+        }
+      });
+  SelectObjectHandle =
+      USelection::SelectObjectEvent.AddLambda([this](UObject *Object) {
+        if (Cast<AActor>(Object) ||
+            (GEditor && Object == GEditor->GetSelectedActors())) {
+          bSelectionChanged = true;
+        }
+      });
+  // Undo replays whole transactions without per-actor notifications, and
+  // map loads and PIE sessions swap the world under the subscriber.
+  UndoRedoHandle = FEditorDelegates::PostUndoRedo.AddRaw(
+      this, &FMcpActorChangeFeed::MarkResync);
+  MapChangeHandle = FEditorDelegates::MapChange.AddLambda(
+      [this](uint32) { MarkResync(); });
+  PieStartedHandle = FEditorDelegates::PostPIEStarted.AddLambda(
+      [this](bool) { MarkResync(); });
+  PieEndedHandle =
+      FEditorDelegates::EndPIE.AddLambda([this](bool) { MarkResync(); });
+#endif
+}
+
+FMcpActorChangeFeed::~FMcpActorChangeFeed() {
+#if WITH_EDITOR
+  if (GEngine) {
+    GEngine->OnLevelActorAdded().Remove(ActorAddedHandle);
+    GEngine->OnLevelActorDeleted().Remove(ActorDeletedHandle);
+    GEngine->OnActorMoved().Remove(ActorMovedHandle);
+  }
+  FCoreDelegates::OnActorLabelChanged.Remove(LabelChangedHandle);
+  FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(PropertyChangedHandle);
+  USelection::SelectionChangedEvent.Remove(SelectionChangedHandle);
+  USelection::SelectObjectEvent.Remove(SelectObjectHandle);
+  FEditorDelegates::PostUndoRedo.Remove(UndoRedoHandle);
+  FEditorDelegates::MapChange.Remove(MapChangeHandle);
+  FEditorDelegates::PostPIEStarted.Remove(PieStartedHandle);
+  FEditorDelegates::EndPIE.Remove(PieEndedHandle);
+#endif
+}
+
+FMcpActorChangeFeed::FPendingActor *FMcpActorChangeFeed::Track(AActor *Actor,
+                                                              uint8 Flags) {
+#if WITH_EDITOR
+  if (bResync || !Actor || Actor->IsTemplate() ||
+      !IsFeedWorld(Actor->GetWorld())) {
+    return nullptr;
+  }
+  FPendingActor *Entry = Pending.Find(Actor);
+  // The address of a collected actor can come back for a new one.
+  if (Entry && !Entry->Actor.IsValid()) {
+    if (!(Entry->Flags & Added)) {
+      Removed.Add(Entry->Path);
+    }
+    Pending.Remove(Actor);
+    Entry = nullptr;
+  }
+  if (!Entry) {
+    if (Pending.Num() >= MaxPending) {
+      MarkResync();
+      return nullptr;
+    }
+    Entry = &Pending.Add(Actor);
+    Entry->Actor = Actor;
+    Entry->Path = Actor->GetPathName();
+  }
+  Entry->Flags |= Flags;
+  return Entry;
+#else
+  return nullptr;
+#endif
+}
+
+void FMcpActorChangeFeed::OnActorDeleted(AActor *Actor) {
+#if WITH_EDITOR
+  if (bResync || !Actor || !IsFeedWorld(Actor->GetWorld())) {
+    return;
+  }
+  // Gone before anybody heard of it: nothing to report.
+  FPendingActor Entry;
+  if (Pending.RemoveAndCopyValue(Actor, Entry) && (Entry.Flags & Added)) {
+    return;
+  }
+  Removed.Add(Actor->GetPathName());
+#endif
+}
+
+void FMcpActorChangeFeed::OnPropertyChanged(UObject *Object,
+                                            FPropertyChangedEvent &Event) {
+#if WITH_EDITOR
+  if (!Object || Object->IsTemplate()) {
+    return;
+  }
+  AActor *Actor = Cast<AActor>(Object);
+  const UActorComponent *Component = nullptr;
+  if (!Actor) {
+    Component = Cast<UActorComponent>(Object);
+    Actor = Component ? Component->GetOwner() : nullptr;
+  }
+  const FName Name = Event.GetMemberPropertyName() != NAME_None
+                         ? Event.GetMemberPropertyName()
+                         : Event.GetPropertyName();
+  const bool bMoved =
+      IsRootTransformProperty(Cast<USceneComponent>(Component), Name);
+  FPendingActor *Entry = Track(Actor, bMoved ? Moved : Changed);
+  if (!Entry || bMoved) {
+    return;
+  }
+  // Bulk edits (reset to defaults, paste) name no property.
+  const FString Property =
+      Name == NAME_None ? FString(TEXT("*"))
+      : Component       ? Component->GetName() + TEXT(".") + Name.ToString()
+                        : Name.ToString();
+  if (Entry->Properties.Contains(TEXT("*")) ||
+      Entry->Properties.Contains(Property)) {
+    return;
+  }
+  if (Property == TEXT("*") ||
+      Entry->Properties.Num() >= MaxChangedProperties) {
+    Entry->Properties.Reset();
+    Entry->Properties.Add(TEXT("*"));
+    return;
+  }
+  Entry->Properties.Add(Property);
+#endif
+}
+
+void FMcpActorChangeFeed::MarkResync() {
+  bResync = true;
+  Pending.Reset();
+  Removed.Reset();
+}
+
+void FMcpActorChangeFeed::WriteBatch(FMcpJsonUtf8Writer &Writer) {
+  Writer.WriteInt(TEXT("seq"), static_cast<int64>(++Sequence));
+#if WITH_EDITOR
+  if (bResync) {
+    Writer.WriteBool(TEXT("resync"), true);
+  } else {
+    TArray<const FPendingActor *> Sections[4];
+    for (TPair<const AActor *, FPendingActor> &Pair : Pending) {
+      const FPendingActor &Entry = Pair.Value;
+      const AActor *Actor = Entry.Actor.Get();
+      // Collected without a delete notification (a level streamed out).
+      if (!Actor || !IsValid(Actor)) {
+        if (!(Entry.Flags & Added)) {
+          Removed.Add(Entry.Path);
+        }
+        continue;
+      }
+      // An added entry carries the whole actor; it needs nothing else.
+      if (Entry.Flags & Added) {
+        Sections[0].Add(&Entry);
+        continue;
+      }
+      if (Entry.Flags & Moved) {
+        Sections[1].Add(&Entry);
+      }
+      if (Entry.Flags & Changed) {
+        Sections[2].Add(&Entry);
+      }
+      if (Entry.Flags & Renamed) {
+        Sections[3].Add(&Entry);
+      }
+    }
+
+    if (Sections[0].Num() > 0) {
+      Writer.Key(TEXT("added"));
+      Writer.BeginArray();
+      for (const FPendingActor *Entry : Sections[0]) {
+        WriteFeedActor(Writer, Entry->Actor.Get());
+      }
+      Writer.EndArray();
+    }
+    if (Removed.Num() > 0) {
+      Writer.Key(TEXT("removed"));
+      Writer.BeginArray();
+      for (const FString &Path : Removed) {
+        Writer.String(Path);
+      }
+      Writer.EndArray();
+    }
+    if (Sections[1].Num() > 0) {
+      Writer.Key(TEXT("moved"));
+      Writer.BeginArray();
+      for (const FPendingActor *Entry : Sections[1]) {
+        Writer.BeginObject();
+        Writer.WriteString(TEXT("path"), Entry->Path);
+        WriteFeedTransform(Writer, Entry->Actor.Get());
+        Writer.EndObject();
+      }
+      Writer.EndArray();
+    }
+    if (Sections[2].Num() > 0) {
+      Writer.Key(TEXT("changed"));
+      Writer.BeginArray();
+      for (const FPendingActor *Entry : Sections[2]) {
+        Writer.BeginObject();
+        Writer.WriteString(TEXT("path"), Entry->Path);
+        Writer.Key(TEXT("props"));
+        Writer.BeginArray();
+        for (const FString &Property : Entry->Properties) {
+          Writer.String(Property);
+        }
+        Writer.EndArray();
+        Writer.EndObject();
+      }
+      Writer.EndArray();
+    }
+    if (Sections[3].Num() > 0) {
+      Writer.Key(TEXT("renamed"));
+      Writer.BeginArray();
+      for (const FPendingActor *Entry : Sections[3]) {
+        Writer.BeginObject();
+        Writer.WriteString(TEXT("path"), Entry->Path);
+        Writer.WriteString(TEXT("label"), Entry->Actor->GetActorLabel());
+        Writer.EndObject();
+      }
+      Writer.EndArray();
+    }
+    if (bSelectionChanged) {
+      WriteFeedSelection(Writer);
+    }
+  }
+#endif
+  Pending.Reset();
+  Removed.Reset();
+  bSelectionChanged = false;
+  bResync = false;
+}
+
+void FMcpActorChangeFeed::WriteSnapshot(FMcpJsonUtf8Writer &Writer) const {
+  Writer.WriteInt(TEXT("seq"), static_cast<int64>(Sequence));
+  Writer.Key(TEXT("actors"));
+  Writer.BeginArray();
+#if WITH_EDITOR
+  if (GEditor) {
+    UWorld *Worlds[] = {GEditor->GetEditorWorldContext().World(),
+                        GEditor->PlayWorld.Get()};
+    for (UWorld *World : Worlds) {
+      if (!IsFeedWorld(World)) {
+        continue;
+      }
+      for (TActorIterator<AActor> It(World); It; ++It) {
+        if (IsValid(*It)) {
+          WriteFeedActor(Writer, *It);
+        }
+      }
+    }
+  }
+#endif
+  Writer.EndArray();
+#if WITH_EDITOR
+  WriteFeedSelection(Writer);
+#endif
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+
+class AActor;
+class FMcpJsonUtf8Writer;
+class UObject;
+struct FPropertyChangedEvent;
+
+/**
+ * Scene change feed behind the "actors" event topic. Actor adds, deletes, moves, property edits
+ * and relabels in editor and play worlds, plus editor selection changes, collect per actor and
+ * go out as one compact delta per flush (the subsystem flushes every frame with changes), so
+ * dragging an actor or spawning a thousand is a handful of small events rather than one per
+ * engine notification. Clients keep a mirror from a subscribe_events snapshot plus these deltas:
+ * "added" entries are upserts (a change made just before the snapshot can arrive after it),
+ * "seq" increases by one per batch, and "resync" tells them to re-read after a map change, an
+ * undo/redo, a PIE session starting or ending, or a batch too large to describe.
+ *
+ * Moves are the editor's OnActorMoved, so actors moved by gameplay in PIE stay quiet. Hooks the
+ * engine delegates only while it exists. Game thread only.
+ */
+class FMcpActorChangeFeed
+{
+public:
+    /** A batch touching more than MaxPending actors is replaced by "resync". */
+    explicit FMcpActorChangeFeed(int32 InMaxPending = 5000);
+    ~FMcpActorChangeFeed();
+
+    FMcpActorChangeFeed(const FMcpActorChangeFeed&) = delete;
+    FMcpActorChangeFeed& operator=(const FMcpActorChangeFeed&) = delete;
+
+    bool HasPending() const { return Pending.Num() > 0 || Removed.Num() > 0 || bSelectionChanged || bResync; }
+
+    /** Sequence number of the last batch written; a snapshot taken now is current as of it. */
+    uint64 GetSequence() const { return Sequence; }
+
+    /**
+     * Writes the next batch into the open object and clears it: seq, then only the sections
+     * that have entries: added [{path, label, class, world, t}], removed [path], moved
+     * [{path, t}], changed [{path, props}], renamed [{path, label}], selection [path], resync.
+     * t is [x, y, z, pitch, yaw, roll, sx, sy, sz].
+     */
+    void WriteBatch(FMcpJsonUtf8Writer& Writer);
+
+    /** Writes "seq" and "actors" (the added entry of every actor in the editor and play worlds) and "selection". */
+    void WriteSnapshot(FMcpJsonUtf8Writer& Writer) const;
+
+private:
+    enum EChangeFlags : uint8
+    {
+        Added = 1 << 0,
+        Moved = 1 << 1,
+        Changed = 1 << 2,
+        Renamed = 1 << 3,
+    };
+
+    struct FPendingActor
+    {
+        TWeakObjectPtr<AActor> Actor;
+        /** Captured when first tracked, for a removal of an actor that was collected unannounced. */
+        FString Path;
+        uint8 Flags = 0;
+        TArray<FString, TInlineAllocator<4>> Properties;
+    };
+
+    FPendingActor* Track(AActor* Actor, uint8 Flags);
+    void OnActorDeleted(AActor* Actor);
+    void OnPropertyChanged(UObject* Object, FPropertyChangedEvent& Event);
+    void MarkResync();
+
+    TMap<const AActor*, FPendingActor> Pending;
+    TArray<FString> Removed;
+    int32 MaxPending = 5000;
+    uint64 Sequence = 0;
+    bool bSelectionChanged = false;
+    bool bResync = false;
+    FDelegateHandle ActorAddedHandle;
+    FDelegateHandle ActorDeletedHandle;
+    FDelegateHandle ActorMovedHandle;
+    FDelegateHandle LabelChangedHandle;
+    FDelegateHandle PropertyChangedHandle;
+    FDelegateHandle SelectionChangedHandle;
+    FDelegateHandle SelectObjectHandle;
+    FDelegateHandle UndoRedoHandle;
+    FDelegateHandle MapChangeHandle;
+    FDelegateHandle PieStartedHandle;
+    FDelegateHandle PieEndedHandle;
+};
@@ -0,0 +1,382 @@
+#include "McpActorIndex.h"
+
+#if WITH_EDITOR
+#include "Editor.h"
+#include "EngineUtils.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "Components/ActorComponent.h"
+#include "GameFramework/Actor.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/StringBuilder.h"
+#include "String/Find.h"
+#include "UObject/UObjectGlobals.h"
+
+FMcpActorIndex::FMcpActorIndex() {
+  if (GEngine) {
+    ActorAddedHandle = GEngine->OnLevelActorAdded().AddRaw(
+        this, &FMcpActorIndex::OnActorAdded);
+    ActorDeletedHandle = GEngine->OnLevelActorDeleted().AddRaw(
+        this, &FMcpActorIndex::OnActorDeleted);
+    // World Partition loading and other bulk changes only report this.
+    ActorListChangedHandle = GEngine->OnLevelActorListChanged().AddRaw(
+        this, &FMcpActorIndex::MarkStale);
+  }
+  LabelChangedHandle = FCoreDelegates::OnActorLabelChanged.AddRaw(
+      this, &FMcpActorIndex::OnActorAdded);
+  // Tags edited in the details panel or through set_object_property.
+  PropertyChangedHandle =
+      FCoreUObjectDelegates::OnObjectPropertyChanged.AddLambda(
+          [this](UObject *Object, FPropertyChangedEvent &Event) {
+            AActor *Actor = Cast<AActor>(Object);
+            if (!Actor) {
+              return;
+            }
+            const FName TagsName = GET_MEMBER_NAME_CHECKED(AActor, Tags);
+            if (Event.GetPropertyName() == NAME_None ||
+                Event.GetPropertyName() == TagsName ||
+                Event.GetMemberPropertyName() == TagsName) {
+              OnActorAdded(Actor);
+            }
+          });
+  LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddLambda(
+      [this](ULevel *, UWorld *) { MarkStale(); });
+  LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddLambda(
+      [this](ULevel *, UWorld *) { MarkStale(); });
+  UndoRedoHandle =
+      FEditorDelegates::PostUndoRedo.AddRaw(this, &FMcpActorIndex::MarkStale);
+  MapChangeHandle = FEditorDelegates::MapChange.AddLambda(
+      [this](uint32) { MarkStale(); });
+  // SCS edits recompile the Blueprint and reconstruct its instances.
+  if (GEditor) {
+    BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddRaw(
+        this, &FMcpActorIndex::InvalidateComponents);
+  }
+}
+
+FMcpActorIndex::~FMcpActorIndex() {
+  if (GEngine) {
+    GEngine->OnLevelActorAdded().Remove(ActorAddedHandle);
+    GEngine->OnLevelActorDeleted().Remove(ActorDeletedHandle);
+    GEngine->OnLevelActorListChanged().Remove(ActorListChangedHandle);
+  }
+  FCoreDelegates::OnActorLabelChanged.Remove(LabelChangedHandle);
+  FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(PropertyChangedHandle);
+  FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+  FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+  FEditorDelegates::PostUndoRedo.Remove(UndoRedoHandle);
+  FEditorDelegates::MapChange.Remove(MapChangeHandle);
+  if (GEditor) {
+    GEditor->OnBlueprintCompiled().Remove(BlueprintCompiledHandle);
+  }
+}
+
+void FMcpActorIndex::Invalidate() { MarkStale(); }
+
+void FMcpActorIndex::MarkStale() {
+  bStale = true;
+  ComponentsByPath.Reset();
+}
+
+void FMcpActorIndex::InvalidateComponents() { ComponentsByPath.Reset(); }
+
+void FMcpActorIndex::OnActorAdded(AActor *Actor) {
+  if (!bStale && Actor && Actor->GetWorld() == IndexedWorld.Get()) {
+    Pending.Add(Actor);
+    // A new or renamed label can make a fuzzy actor name ambiguous.
+    ComponentsByPath.Reset();
+  }
+}
+
+void FMcpActorIndex::OnActorDeleted(AActor *Actor) {
+  if (!bStale && Actor) {
+    UnindexActor(Actor);
+    ComponentsByPath.Reset();
+  }
+}
+
+UActorComponent *
+FMcpActorIndex::FindCachedComponent(UWorld *World,
+                                    const FString &ComponentPath) const {
+  const TWeakObjectPtr<UActorComponent> *Cached =
+      ComponentsByPath.Find(ComponentPath);
+  UActorComponent *Component = Cached ? Cached->Get() : nullptr;
+  if (!Component || !World) {
+    return nullptr;
+  }
+  AActor *Owner = Component->GetOwner();
+  return IsValid(Owner) && Owner->GetWorld() == World ? Component : nullptr;
+}
+
+void FMcpActorIndex::CacheComponent(const FString &ComponentPath,
+                                    UActorComponent *Component) {
+  if (!Component) {
+    return;
+  }
+  if (ComponentsByPath.Num() >= MaxCachedComponents) {
+    ComponentsByPath.Reset();
+  }
+  ComponentsByPath.Add(ComponentPath, Component);
+}
+
+void FMcpActorIndex::NotifyActorChanged(AActor *Actor) { OnActorAdded(Actor); }
+
+void FMcpActorIndex::Prepare(UWorld *World) {
+  if (bStale || IndexedWorld.Get() != World) {
+    Rebuild(World);
+    return;
+  }
+  if (Pending.Num() == 0) {
+    return;
+  }
+  TArray<TWeakObjectPtr<AActor>> Queued = MoveTemp(Pending);
+  Pending.Reset();
+  for (const TWeakObjectPtr<AActor> &Weak : Queued) {
+    AActor *Actor = Weak.Get();
+    if (Actor && Actor->GetWorld() == World) {
+      IndexActor(Actor);
+    }
+  }
+}
+
+void FMcpActorIndex::Rebuild(UWorld *World) {
+  Entries.Reset();
+  FreeSlots.Reset();
+  SlotByActor.Reset();
+  ByLabel.Reset();
+  ByTag.Reset();
+  TrieSlots.Reset();
+  TrieNodes.Reset();
+  TrieNodes.AddDefaulted(); // root
+  Pending.Reset();
+  IndexedWorld = World;
+  bStale = false;
+
+  if (!World) {
+    return;
+  }
+  for (TActorIterator<AActor> It(World); It; ++It) {
+    AActor *Actor = *It;
+    if (Actor && !Actor->IsTemplate()) {
+      IndexActor(Actor);
+    }
+  }
+}
+
+void FMcpActorIndex::IndexActor(AActor *Actor) {
+  if (SlotByActor.Contains(Actor)) {
+    UnindexActor(Actor);
+  }
+
+  const int32 Slot = FreeSlots.Num() > 0 ? FreeSlots.Pop() : Entries.AddDefaulted();
+  FEntry &Entry = Entries[Slot];
+  Entry.Actor = Actor;
+  Entry.Key = Actor;
+  Entry.Label = Actor->GetActorLabel();
+  Entry.Tags = Actor->Tags;
+  Entry.TrieNode = TrieInsert(Entry.Label);
+
+  ByLabel.FindOrAdd(Entry.Label).Add(Slot);
+  TrieSlots.FindOrAdd(Entry.TrieNode).Add(Slot);
+  for (const FName &Tag : Entry.Tags) {
+    ByTag.FindOrAdd(Tag).Add(Slot);
+  }
+  SlotByActor.Add(Actor, Slot);
+}
+
+void FMcpActorIndex::UnindexActor(const AActor *Actor) {
+  int32 Slot = INDEX_NONE;
+  if (!SlotByActor.RemoveAndCopyValue(Actor, Slot)) {
+    return;
+  }
+  FEntry &Entry = Entries[Slot];
+  if (TArray<int32, TInlineAllocator<1>> *Slots = ByLabel.Find(Entry.Label)) {
+    Slots->Remove(Slot);
+    if (Slots->Num() == 0) {
+      ByLabel.Remove(Entry.Label);
+    }
+  }
+  if (TArray<int32, TInlineAllocator<1>> *Slots = TrieSlots.Find(Entry.TrieNode)) {
+    Slots->Remove(Slot);
+    if (Slots->Num() == 0) {
+      TrieSlots.Remove(Entry.TrieNode);
+    }
+  }
+  for (const FName &Tag : Entry.Tags) {
+    if (TSet<int32> *Slots = ByTag.Find(Tag)) {
+      Slots->Remove(Slot);
+      if (Slots->Num() == 0) {
+        ByTag.Remove(Tag);
+      }
+    }
+  }
+  Entry = FEntry();
+  FreeSlots.Add(Slot);
+}
+
+AActor *FMcpActorIndex::GetLiveActor(int32 Slot, const UWorld *World) const {
+  AActor *Actor = Entries[Slot].Actor.Get();
+  return Actor && Actor->GetWorld() == World ? Actor : nullptr;
+}
+
+int32 FMcpActorIndex::TrieInsert(const FString &Label) {
+  int32 Node = 0;
+  for (const TCHAR RawChar : Label) {
+    const TCHAR Char = FChar::ToLower(RawChar);
+    int32 Child = TrieNodes[Node].FirstChild;
+    while (Child != INDEX_NONE && TrieNodes[Child].Char != Char) {
+      Child = TrieNodes[Child].NextSibling;
+    }
+    if (Child == INDEX_NONE) {
+      FTrieNode NewNode;
+      NewNode.Char = Char;
+      NewNode.NextSibling = TrieNodes[Node].FirstChild;
+      Child = TrieNodes.Add(NewNode);
+      TrieNodes[Node].FirstChild = Child;
+    }
+    Node = Child;
+  }
+  return Node;
+}
+
+int32 FMcpActorIndex::TrieFind(const FString &Prefix) const {
+  int32 Node = 0;
+  for (const TCHAR RawChar : Prefix) {
+    const TCHAR Char = FChar::ToLower(RawChar);
+    int32 Child = TrieNodes[Node].FirstChild;
+    while (Child != INDEX_NONE && TrieNodes[Child].Char != Char) {
+      Child = TrieNodes[Child].NextSibling;
+    }
+    if (Child == INDEX_NONE) {
+      return INDEX_NONE;
+    }
+    Node = Child;
+  }
+  return Node;
+}
+
+AActor *FMcpActorIndex::FindByLabel(UWorld *World, const FString &Label) {
+  Prepare(World);
+  if (const TArray<int32, TInlineAllocator<1>> *Slots = ByLabel.Find(Label)) {
+    for (const int32 Slot : *Slots) {
+      AActor *Actor = GetLiveActor(Slot, World);
+      if (Actor && Actor->GetActorLabel().Equals(Label, ESearchCase::IgnoreCase)) {
+        return Actor;
+      }
+    }
+  }
+  return nullptr;
+}
+
+AActor *FMcpActorIndex::FindExact(UWorld *World, const FString &Target) {
+  if (!World || Target.IsEmpty()) {
+    return nullptr;
+  }
+  if (AActor *Actor = FindByLabel(World, Target)) {
+    return Actor;
+  }
+
+  // Object names are unique per level; the levels' object hash answers them.
+  const FName Name(*Target, FNAME_Find);
+  if (!Name.IsNone()) {
+    for (ULevel *Level : World->GetLevels()) {
+      AActor *Actor = Level ? FindObjectFast<AActor>(Level, Name) : nullptr;
+      if (IsValid(Actor) && !Actor->IsTemplate()) {
+        return Actor;
+      }
+    }
+  }
+
+  if (Target.StartsWith(TEXT("/")) && Target.Contains(TEXT("."))) {
+    AActor *Actor = FindObject<AActor>(nullptr, *Target);
+    if (IsValid(Actor) && Actor->GetWorld() == World) {
+      return Actor;
+    }
+  }
+  return nullptr;
+}
+
+void FMcpActorIndex::FindByLabelPrefix(UWorld *World, const FString &Prefix,
+                                       TArray<AActor *> &OutActors,
+                                       int32 MaxResults) {
+  if (!World) {
+    return;
+  }
+  Prepare(World);
+  const int32 Start = TrieFind(Prefix);
+  if (Start == INDEX_NONE) {
+    return;
+  }
+  TArray<int32, TInlineAllocator<64>> Stack;
+  Stack.Add(Start);
+  while (Stack.Num() > 0) {
+    const int32 Node = Stack.Pop();
+    if (const TArray<int32, TInlineAllocator<1>> *Slots = TrieSlots.Find(Node)) {
+      for (const int32 Slot : *Slots) {
+        if (AActor *Actor = GetLiveActor(Slot, World)) {
+          OutActors.Add(Actor);
+          if (OutActors.Num() >= MaxResults) {
+            return;
+          }
+        }
+      }
+    }
+    for (int32 Child = TrieNodes[Node].FirstChild; Child != INDEX_NONE;
+         Child = TrieNodes[Child].NextSibling) {
+      Stack.Add(Child);
+    }
+  }
+}
+
+void FMcpActorIndex::FindContaining(UWorld *World, const FString &Query,
+                                    bool bLabelsOnly,
+                                    TArray<AActor *> &OutActors,
+                                    int32 MaxResults) {
+  if (!World) {
+    return;
+  }
+  Prepare(World);
+  TStringBuilder<256> Path;
+  for (int32 Slot = 0; Slot < Entries.Num(); ++Slot) {
+    AActor *Actor = GetLiveActor(Slot, World);
+    if (!Actor) {
+      continue;
+    }
+    bool bMatches = Entries[Slot].Label.Contains(Query, ESearchCase::IgnoreCase);
+    if (!bMatches && !bLabelsOnly) {
+      // The object name is the tail of the path, so one check covers both.
+      Path.Reset();
+      Actor->GetPathName(nullptr, Path);
+      bMatches = UE::String::FindFirst(Path.ToView(), Query,
+                                       ESearchCase::IgnoreCase) != INDEX_NONE;
+    }
+    if (bMatches) {
+      OutActors.Add(Actor);
+      if (OutActors.Num() >= MaxResults) {
+        return;
+      }
+    }
+  }
+}
+
+void FMcpActorIndex::FindByTag(UWorld *World, FName Tag,
+                               TArray<AActor *> &OutActors) {
+  if (!World || Tag.IsNone()) {
+    return;
+  }
+  Prepare(World);
+  const TSet<int32> *Slots = ByTag.Find(Tag);
+  if (!Slots) {
+    return;
+  }
+  // Slot order is index order, which keeps results stable between calls.
+  TArray<int32> Sorted = Slots->Array();
+  Sorted.Sort();
+  for (const int32 Slot : Sorted) {
+    AActor *Actor = GetLiveActor(Slot, World);
+    if (Actor && Actor->ActorHasTag(Tag)) {
+      OutActors.Add(Actor);
+    }
+  }
+}
+#endif
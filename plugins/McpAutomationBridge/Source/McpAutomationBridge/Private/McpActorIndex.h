@@ -0,0 +1,124 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+
+class AActor;
+class UActorComponent;
+class UWorld;
+
+/**
+ * Label and tag index over the actors of the editor world, so FindActorByName and the
+ * control_actor lookups do not walk every actor and copy every label per call. Exact names and
+ * paths need no index: they go through the UObject hash of each level. Fuzzy label matching walks
+ * a character trie of lowercased labels, so a prefix query touches only the labels it matches.
+ *
+ * Kept current from editor events; actors spawned or relabelled are queued and indexed on the
+ * next lookup, after the handler that created them has finished setting labels and tags. Level
+ * streaming, actor list resets, undo/redo and a change of world rebuild the index lazily. Single
+ * game-thread owner; entries are weak and re-checked before they are returned.
+ *
+ * Also memoizes "Actor.Component" request paths to the component they resolved to. Any actor
+ * event, component add/remove and Blueprint (SCS) compile drops those, since any of them can
+ * change which actor or component a fuzzy path picks.
+ */
+class FMcpActorIndex
+{
+public:
+    FMcpActorIndex();
+    ~FMcpActorIndex();
+
+    FMcpActorIndex(const FMcpActorIndex&) = delete;
+    FMcpActorIndex& operator=(const FMcpActorIndex&) = delete;
+
+    /** First actor whose label, object name or full path equals Target (case-insensitive). */
+    AActor* FindExact(UWorld* World, const FString& Target);
+
+    /** First actor whose label equals Label (case-insensitive). */
+    AActor* FindByLabel(UWorld* World, const FString& Label);
+
+    /** Actors whose label starts with Prefix, stopping once MaxResults are found. */
+    void FindByLabelPrefix(UWorld* World, const FString& Prefix, TArray<AActor*>& OutActors,
+                           int32 MaxResults = MAX_int32);
+
+    /**
+     * Actors whose label contains Query, or with bLabelsOnly false, whose label, object name or
+     * full path does. This visits every indexed actor but reads cached labels only.
+     */
+    void FindContaining(UWorld* World, const FString& Query, bool bLabelsOnly, TArray<AActor*>& OutActors,
+                        int32 MaxResults = MAX_int32);
+
+    /** Actors carrying Tag. */
+    void FindByTag(UWorld* World, FName Tag, TArray<AActor*>& OutActors);
+
+    /** Re-reads Actor's label and tags on the next lookup; for edits that raise no editor event. */
+    void NotifyActorChanged(AActor* Actor);
+
+    void Invalidate();
+
+    /** Component previously resolved for ComponentPath in World, or null. */
+    UActorComponent* FindCachedComponent(UWorld* World, const FString& ComponentPath) const;
+    void CacheComponent(const FString& ComponentPath, UActorComponent* Component);
+
+    /** Drops memoized components; call after adding or removing components. */
+    void InvalidateComponents();
+
+private:
+    struct FEntry
+    {
+        TWeakObjectPtr<AActor> Actor;
+        const AActor* Key = nullptr;
+        FString Label;
+        TArray<FName> Tags;
+        int32 TrieNode = INDEX_NONE;
+    };
+
+    struct FTrieNode
+    {
+        int32 FirstChild = INDEX_NONE;
+        int32 NextSibling = INDEX_NONE;
+        TCHAR Char = 0;
+    };
+
+    /** Brings the index in line with World: rebuilds when stale, else indexes queued actors. */
+    void Prepare(UWorld* World);
+    void Rebuild(UWorld* World);
+    void IndexActor(AActor* Actor);
+    void UnindexActor(const AActor* Actor);
+    AActor* GetLiveActor(int32 Slot, const UWorld* World) const;
+
+    int32 TrieInsert(const FString& Label);
+    int32 TrieFind(const FString& Prefix) const;
+
+    void OnActorAdded(AActor* Actor);
+    void OnActorDeleted(AActor* Actor);
+    void MarkStale();
+
+    /** Bound on memoized component paths; the memo starts over rather than tracking recency. */
+    static constexpr int32 MaxCachedComponents = 4096;
+
+    TWeakObjectPtr<UWorld> IndexedWorld;
+    bool bStale = true;
+
+    TArray<FEntry> Entries;
+    TArray<int32> FreeSlots;
+    TMap<const AActor*, int32> SlotByActor;
+    /** FString keys hash and compare case-insensitively. */
+    TMap<FString, TArray<int32, TInlineAllocator<1>>> ByLabel;
+    TMap<FName, TSet<int32>> ByTag;
+    TArray<FTrieNode> TrieNodes;
+    TMap<int32, TArray<int32, TInlineAllocator<1>>> TrieSlots;
+    TArray<TWeakObjectPtr<AActor>> Pending;
+    TMap<FString, TWeakObjectPtr<UActorComponent>> ComponentsByPath;
+
+    FDelegateHandle ActorAddedHandle;
+    FDelegateHandle ActorDeletedHandle;
+    FDelegateHandle ActorListChangedHandle;
+    FDelegateHandle LabelChangedHandle;
+    FDelegateHandle PropertyChangedHandle;
+    FDelegateHandle LevelAddedHandle;
+    FDelegateHandle LevelRemovedHandle;
+    FDelegateHandle UndoRedoHandle;
+    FDelegateHandle MapChangeHandle;
+    FDelegateHandle BlueprintCompiledHandle;
+};
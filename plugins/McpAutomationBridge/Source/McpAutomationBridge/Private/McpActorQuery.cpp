@@ -0,0 +1,415 @@
+#include "McpActorQuery.h"
+
+#include "Algo/Find.h"
+#include "Containers/Ticker.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/Actor.h"
+#include "HAL/PlatformTime.h"
+#include "McpActorIndex.h"
+#include "McpJsonUtf8Writer.h"
+#include "Misc/Guid.h"
+
+#if WITH_EDITOR && ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
+#include "WorldPartition/DataLayer/DataLayerInstance.h"
+#define MCP_ACTOR_QUERY_HAS_DATA_LAYERS 1
+#else
+#define MCP_ACTOR_QUERY_HAS_DATA_LAYERS 0
+#endif
+
+namespace {
+// Actors serialized per tick. Each costs well under a microsecond to a few
+// microseconds depending on the projection, so a chunk stays within a frame.
+constexpr int32 ActorQueryChunkSize = 2000;
+
+// Cursors left unread are dropped after this long, and the oldest goes once
+// this many are open.
+constexpr double ActorQuerySnapshotSeconds = 600.0;
+constexpr int32 MaxActorQuerySnapshots = 16;
+
+using FActorList = TArray<TWeakObjectPtr<AActor>>;
+
+struct FActorQuerySnapshot {
+  TWeakObjectPtr<UWorld> World;
+  TSharedRef<FActorList> Actors = MakeShared<FActorList>();
+  double LastUseSeconds = 0.0;
+};
+
+TMap<FString, FActorQuerySnapshot> GActorQuerySnapshots;
+
+void PruneActorQuerySnapshots(double NowSeconds) {
+  for (auto It = GActorQuerySnapshots.CreateIterator(); It; ++It) {
+    if (!It->Value.World.IsValid() ||
+        NowSeconds - It->Value.LastUseSeconds > ActorQuerySnapshotSeconds) {
+      It.RemoveCurrent();
+    }
+  }
+  while (GActorQuerySnapshots.Num() >= MaxActorQuerySnapshots) {
+    const FString *Oldest = nullptr;
+    double OldestUse = TNumericLimits<double>::Max();
+    for (const TPair<FString, FActorQuerySnapshot> &Pair : GActorQuerySnapshots) {
+      if (Pair.Value.LastUseSeconds < OldestUse) {
+        OldestUse = Pair.Value.LastUseSeconds;
+        Oldest = &Pair.Key;
+      }
+    }
+    const FString Key = *Oldest;
+    GActorQuerySnapshots.Remove(Key);
+  }
+}
+
+bool ActorMatchesQuery(AActor *Actor, const FMcpActorQuery &Query) {
+  if (!IsValid(Actor)) {
+    return false;
+  }
+  if (Query.Class && !Actor->IsA(Query.Class)) {
+    return false;
+  }
+  if (!Query.Tag.IsNone() && !Actor->ActorHasTag(Query.Tag)) {
+    return false;
+  }
+  if (Query.Level && Actor->GetLevel() != Query.Level) {
+    return false;
+  }
+  if (Query.Bounds.IsValid &&
+      !Query.Bounds.IsInsideOrOn(Actor->GetActorLocation())) {
+    return false;
+  }
+  if (!Query.NameFilter.IsEmpty()) {
+#if WITH_EDITOR
+    const bool bLabel = Actor->GetActorLabel().Contains(Query.NameFilter);
+#else
+    const bool bLabel = false;
+#endif
+    if (!bLabel && !Actor->GetName().Contains(Query.NameFilter) &&
+        !Actor->GetPathName().Contains(Query.NameFilter)) {
+      return false;
+    }
+  }
+#if MCP_ACTOR_QUERY_HAS_DATA_LAYERS
+  if (!Query.DataLayer.IsEmpty()) {
+    bool bInLayer = false;
+    for (const UDataLayerInstance *Layer : Actor->GetDataLayerInstances()) {
+      if (Layer && (Layer->GetDataLayerShortName() == Query.DataLayer ||
+                    Layer->GetDataLayerFullName() == Query.DataLayer)) {
+        bInLayer = true;
+        break;
+      }
+    }
+    if (!bInLayer) {
+      return false;
+    }
+  }
+#endif
+  return true;
+}
+
+// Starts from the narrowest source the actor index or the level offers,
+// then applies every filter to each candidate.
+void GatherActorQueryMatches(UWorld *World, FMcpActorIndex &Index,
+                             const FMcpActorQuery &Query, FActorList &Out) {
+  TArray<AActor *> Candidates;
+  if (!Query.Tag.IsNone()) {
+    Index.FindByTag(World, Query.Tag, Candidates);
+  } else if (!Query.NameFilter.IsEmpty()) {
+    Index.FindContaining(World, Query.NameFilter, false, Candidates);
+  } else if (Query.Level) {
+    for (AActor *Actor : Query.Level->Actors) {
+      Candidates.Add(Actor);
+    }
+  } else {
+    for (TActorIterator<AActor> It(World, Query.Class ? Query.Class
+                                                       : AActor::StaticClass());
+         It; ++It) {
+      Candidates.Add(*It);
+    }
+  }
+  Out.Reserve(Candidates.Num());
+  for (AActor *Actor : Candidates) {
+    if (ActorMatchesQuery(Actor, Query)) {
+      Out.Add(Actor);
+    }
+  }
+}
+
+void WriteActorVector(FMcpJsonUtf8Writer &Writer, const TCHAR *Name,
+                      const FVector &Vector) {
+  Writer.Key(Name);
+  Writer.BeginArray();
+  Writer.Number(Vector.X);
+  Writer.Number(Vector.Y);
+  Writer.Number(Vector.Z);
+  Writer.EndArray();
+}
+
+void WriteQueriedActor(FMcpJsonUtf8Writer &Writer, AActor *Actor,
+                       const FMcpActorQuery &Query) {
+  if (Query.bNamesOnly) {
+    Writer.String(Actor->GetName());
+    return;
+  }
+  const EMcpActorField Fields = Query.Fields;
+#if WITH_EDITOR
+  const FString Label = Actor->GetActorLabel();
+#else
+  const FString Label = Actor->GetName();
+#endif
+  Writer.BeginObject();
+  if (EnumHasAnyFlags(Fields, EMcpActorField::Name)) {
+    Writer.WriteString(TEXT("name"),
+                       Query.bNameIsLabel ? Label : Actor->GetName());
+  }
+  if (EnumHasAnyFlags(Fields, EMcpActorField::Label)) {
+    Writer.WriteString(TEXT("label"), Label);
+  }
+  if (EnumHasAnyFlags(Fields, EMcpActorField::Path)) {
+    Writer.WriteString(TEXT("path"), Actor->GetPathName());
+  }
+  if (EnumHasAnyFlags(Fields, EMcpActorField::Class)) {
+    Writer.WriteString(TEXT("class"), Actor->GetClass()->GetPathName());
+  }
+  if (EnumHasAnyFlags(Fields, EMcpActorField::Location)) {
+    WriteActorVector(Writer, TEXT("location"), Actor->GetActorLocation());
+  }
+  if (EnumHasAnyFlags(Fields, EMcpActorField::Rotation)) {
+    const FRotator Rotation = Actor->GetActorRotation();
+    WriteActorVector(Writer, TEXT("rotation"),
+                     FVector(Rotation.Pitch, Rotation.Yaw, Rotation.Roll));
+  }
+  if (EnumHasAnyFlags(Fields, EMcpActorField::Scale)) {
+    WriteActorVector(Writer, TEXT("scale"), Actor->GetActorScale3D());
+  }
+  if (EnumHasAnyFlags(Fields, EMcpActorField::Tags)) {
+    Writer.Key(TEXT("tags"));
+    Writer.BeginArray();
+    for (const FName &Tag : Actor->Tags) {
+      Writer.String(Tag.ToString());
+    }
+    Writer.EndArray();
+  }
+#if WITH_EDITOR
+  if (EnumHasAnyFlags(Fields, EMcpActorField::Folder)) {
+    Writer.WriteString(TEXT("folder"), Actor->GetFolderPath().ToString());
+  }
+  if (EnumHasAnyFlags(Fields, EMcpActorField::Hidden)) {
+    Writer.WriteBool(TEXT("hidden"), Actor->IsHiddenEd());
+  }
+#endif
+  if (EnumHasAnyFlags(Fields, EMcpActorField::Level)) {
+    const ULevel *Level = Actor->GetLevel();
+    Writer.WriteString(TEXT("level"), Level && Level->GetOutermost()
+                                          ? Level->GetOutermost()->GetName()
+                                          : FString());
+  }
+#if MCP_ACTOR_QUERY_HAS_DATA_LAYERS
+  if (EnumHasAnyFlags(Fields, EMcpActorField::DataLayers)) {
+    Writer.Key(TEXT("dataLayers"));
+    Writer.BeginArray();
+    for (const UDataLayerInstance *Layer : Actor->GetDataLayerInstances()) {
+      if (Layer) {
+        Writer.String(Layer->GetDataLayerShortName());
+      }
+    }
+    Writer.EndArray();
+  }
+#endif
+  if (EnumHasAnyFlags(Fields, EMcpActorField::Bounds)) {
+    const FBox Box = Actor->GetComponentsBoundingBox(true);
+    Writer.Key(TEXT("bounds"));
+    Writer.BeginObject();
+    WriteActorVector(Writer, TEXT("min"), Box.Min);
+    WriteActorVector(Writer, TEXT("max"), Box.Max);
+    Writer.EndObject();
+  }
+  Writer.EndObject();
+}
+
+struct FActorQueryPage {
+  FMcpActorQuery Query;
+  TSharedPtr<FActorList> Actors;
+  int32 Next = 0;
+  int32 End = 0;
+  int32 Returned = 0;
+  FString NextCursor;
+  FMcpJsonUtf8Writer Writer;
+  TFunction<void(FMcpJsonUtf8Writer &&, int32, const FString &)> OnFinished;
+};
+using FActorQueryPageRef = TSharedRef<FActorQueryPage>;
+
+// Writes the next chunk; returns false once the page is finished and sent.
+bool WriteActorQueryChunk(const FActorQueryPageRef &Page) {
+  const int32 ChunkEnd = FMath::Min(Page->End, Page->Next + ActorQueryChunkSize);
+  for (; Page->Next < ChunkEnd; ++Page->Next) {
+    if (AActor *Actor = (*Page->Actors)[Page->Next].Get()) {
+      WriteQueriedActor(Page->Writer, Actor, Page->Query);
+      ++Page->Returned;
+    }
+  }
+  if (Page->Next < Page->End) {
+    return true;
+  }
+  Page->Writer.EndArray();
+  Page->Writer.WriteInt(TEXT("count"), Page->Returned);
+  Page->Writer.WriteInt(TEXT("totalCount"), Page->Actors->Num());
+  if (!Page->NextCursor.IsEmpty()) {
+    Page->Writer.WriteString(TEXT("nextCursor"), Page->NextCursor);
+  }
+  Page->OnFinished(MoveTemp(Page->Writer), Page->Returned, FString());
+  return false;
+}
+} // namespace
+
+bool FMcpActorQuery::ParseFields(const TArray<FString> &Names,
+                                 EMcpActorField &OutFields,
+                                 FString &OutUnknown) {
+  static const TPair<const TCHAR *, EMcpActorField> Known[] = {
+      {TEXT("name"), EMcpActorField::Name},
+      {TEXT("label"), EMcpActorField::Label},
+      {TEXT("path"), EMcpActorField::Path},
+      {TEXT("class"), EMcpActorField::Class},
+      {TEXT("location"), EMcpActorField::Location},
+      {TEXT("rotation"), EMcpActorField::Rotation},
+      {TEXT("scale"), EMcpActorField::Scale},
+      {TEXT("tags"), EMcpActorField::Tags},
+      {TEXT("folder"), EMcpActorField::Folder},
+      {TEXT("level"), EMcpActorField::Level},
+      {TEXT("dataLayers"), EMcpActorField::DataLayers},
+      {TEXT("hidden"), EMcpActorField::Hidden},
+      {TEXT("bounds"), EMcpActorField::Bounds}};
+  OutFields = EMcpActorField::None;
+  for (const FString &Name : Names) {
+    if (Name.Equals(TEXT("transform"), ESearchCase::IgnoreCase)) {
+      OutFields |= EMcpActorField::Location | EMcpActorField::Rotation |
+                   EMcpActorField::Scale;
+      continue;
+    }
+    const TPair<const TCHAR *, EMcpActorField> *Match = Algo::FindByPredicate(
+        Known, [&Name](const TPair<const TCHAR *, EMcpActorField> &Entry) {
+          return Name.Equals(Entry.Key, ESearchCase::IgnoreCase);
+        });
+    if (!Match) {
+      OutUnknown = Name;
+      return false;
+    }
+    OutFields |= Match->Value;
+  }
+  return true;
+}
+
+bool FMcpActorQuery::Parse(const TSharedPtr<FJsonObject> &Payload,
+                           EMcpActorField DefaultFields,
+                           FMcpActorQuery &OutQuery, FString &OutError) {
+  OutQuery.Fields = DefaultFields;
+  if (!Payload.IsValid()) {
+    return true;
+  }
+  FString TagName;
+  if (Payload->TryGetStringField(TEXT("tag"), TagName) && !TagName.IsEmpty()) {
+    OutQuery.Tag = FName(*TagName);
+  }
+  Payload->TryGetStringField(TEXT("filter"), OutQuery.NameFilter);
+  Payload->TryGetStringField(TEXT("dataLayer"), OutQuery.DataLayer);
+#if !MCP_ACTOR_QUERY_HAS_DATA_LAYERS
+  if (!OutQuery.DataLayer.IsEmpty()) {
+    OutError = TEXT("The dataLayer filter requires UE 5.1 or newer.");
+    return false;
+  }
+#endif
+  const TSharedPtr<FJsonObject> *BoundsObj = nullptr;
+  if (Payload->TryGetObjectField(TEXT("bounds"), BoundsObj) && BoundsObj) {
+    const TArray<TSharedPtr<FJsonValue>> *Min = nullptr;
+    const TArray<TSharedPtr<FJsonValue>> *Max = nullptr;
+    if (!(*BoundsObj)->TryGetArrayField(TEXT("min"), Min) ||
+        !(*BoundsObj)->TryGetArrayField(TEXT("max"), Max) || Min->Num() < 3 ||
+        Max->Num() < 3) {
+      OutError = TEXT("bounds must be { min: [x, y, z], max: [x, y, z] }.");
+      return false;
+    }
+    OutQuery.Bounds = FBox(
+        FVector((*Min)[0]->AsNumber(), (*Min)[1]->AsNumber(), (*Min)[2]->AsNumber()),
+        FVector((*Max)[0]->AsNumber(), (*Max)[1]->AsNumber(), (*Max)[2]->AsNumber()));
+  }
+  const TArray<TSharedPtr<FJsonValue>> *FieldsArr = nullptr;
+  if (Payload->TryGetArrayField(TEXT("fields"), FieldsArr) && FieldsArr) {
+    TArray<FString> Names;
+    for (const TSharedPtr<FJsonValue> &Value : *FieldsArr) {
+      Names.Add(Value->AsString());
+    }
+    FString Unknown;
+    if (!ParseFields(Names, OutQuery.Fields, Unknown)) {
+      OutError = FString::Printf(
+          TEXT("Unknown field '%s'. Fields: name, label, path, class, "
+               "location, rotation, scale, transform, tags, folder, level, "
+               "dataLayers, hidden, bounds."),
+          *Unknown);
+      return false;
+    }
+  }
+  double Limit = 0.0;
+  if (Payload->TryGetNumberField(TEXT("limit"), Limit)) {
+    OutQuery.Limit = FMath::Max(0, static_cast<int32>(Limit));
+  }
+  Payload->TryGetStringField(TEXT("cursor"), OutQuery.Cursor);
+  return true;
+}
+
+void FMcpActorQueryRunner::Run(
+    UWorld *World, FMcpActorIndex &Index, const FMcpActorQuery &Query,
+    FMcpJsonUtf8Writer &&Writer,
+    TFunction<void(FMcpJsonUtf8Writer &&Writer, int32 Returned,
+                   const FString &ErrorCode)>
+        OnFinished) {
+  check(IsInGameThread());
+  const double NowSeconds = FPlatformTime::Seconds();
+  PruneActorQuerySnapshots(NowSeconds);
+
+  FActorQueryPageRef Page = MakeShared<FActorQueryPage>();
+  Page->Query = Query;
+  Page->OnFinished = MoveTemp(OnFinished);
+
+  // A cursor is "<snapshot id>:<offset>" into the matches of its first page.
+  FString SnapshotId;
+  int32 Start = 0;
+  if (!Query.Cursor.IsEmpty()) {
+    FString OffsetStr;
+    FActorQuerySnapshot *Snapshot =
+        Query.Cursor.Split(TEXT(":"), &SnapshotId, &OffsetStr)
+            ? GActorQuerySnapshots.Find(SnapshotId)
+            : nullptr;
+    if (!Snapshot || Snapshot->World.Get() != World) {
+      Page->OnFinished(MoveTemp(Writer), 0, TEXT("CURSOR_EXPIRED"));
+      return;
+    }
+    Snapshot->LastUseSeconds = NowSeconds;
+    Page->Actors = Snapshot->Actors;
+    Start = FMath::Clamp(FCString::Atoi(*OffsetStr), 0, Page->Actors->Num());
+  } else {
+    Page->Actors = MakeShared<FActorList>();
+    GatherActorQueryMatches(World, Index, Query, *Page->Actors);
+  }
+
+  const int32 Total = Page->Actors->Num();
+  Page->Next = Start;
+  Page->End = Query.Limit > 0 ? FMath::Min(Total, Start + Query.Limit) : Total;
+  if (Page->End < Total) {
+    if (SnapshotId.IsEmpty()) {
+      SnapshotId = FGuid::NewGuid().ToString(EGuidFormats::Digits);
+      FActorQuerySnapshot &Snapshot = GActorQuerySnapshots.Add(SnapshotId);
+      Snapshot.World = World;
+      Snapshot.Actors = Page->Actors.ToSharedRef();
+      Snapshot.LastUseSeconds = NowSeconds;
+    }
+    Page->NextCursor = FString::Printf(TEXT("%s:%d"), *SnapshotId, Page->End);
+  } else if (!SnapshotId.IsEmpty()) {
+    GActorQuerySnapshots.Remove(SnapshotId);
+  }
+
+  Page->Writer = MoveTemp(Writer);
+  Page->Writer.Key(TEXT("actors"));
+  Page->Writer.BeginArray();
+  if (WriteActorQueryChunk(Page)) {
+    FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+        [Page](float) { return WriteActorQueryChunk(Page); }));
+  }
+}
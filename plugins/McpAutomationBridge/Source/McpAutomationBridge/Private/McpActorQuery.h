@@ -0,0 +1,87 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "Templates/Function.h"
+#include "UObject/WeakObjectPtr.h"
+
+class FMcpActorIndex;
+class FMcpJsonUtf8Writer;
+class ULevel;
+class UWorld;
+
+/** Per-actor members a listing writes; see FMcpActorQuery::ParseFields. */
+enum class EMcpActorField : uint32
+{
+    None = 0,
+    Name = 1 << 0,
+    Label = 1 << 1,
+    Path = 1 << 2,
+    Class = 1 << 3,
+    Location = 1 << 4,
+    Rotation = 1 << 5,
+    Scale = 1 << 6,
+    Tags = 1 << 7,
+    Folder = 1 << 8,
+    Level = 1 << 9,
+    DataLayers = 1 << 10,
+    Hidden = 1 << 11,
+    Bounds = 1 << 12,
+};
+ENUM_CLASS_FLAGS(EMcpActorField)
+
+/**
+ * Filters, projection and page of one actor listing (control_actor list / find_by_class,
+ * manage_level get_level_actors). The first page resolves every match once and, when more
+ * remain, keeps them under a cursor, so later pages neither rescan the world nor shift when
+ * actors are spawned in between; actors deleted since are skipped.
+ */
+struct FMcpActorQuery
+{
+    UClass* Class = nullptr;
+    FName Tag;
+    /** Substring of the label, object name or path, case-insensitive. */
+    FString NameFilter;
+    FBox Bounds = FBox(ForceInit);
+    FString DataLayer;
+    ULevel* Level = nullptr;
+
+    EMcpActorField Fields = EMcpActorField::None;
+    /** Write each actor as its object name string instead of an object (get_level_actors' original shape). */
+    bool bNamesOnly = false;
+    /** Write the label under "name", as find_by_class always has. */
+    bool bNameIsLabel = false;
+
+    /** Actors per page; 0 returns every match. */
+    int32 Limit = 0;
+    FString Cursor;
+
+    /**
+     * Reads tag, filter, bounds ({ min, max }), dataLayer, fields, limit and cursor from Payload;
+     * handlers resolve Class themselves. DefaultFields applies when fields is absent. Returns false
+     * with OutError for an unknown field, or a data layer filter the engine cannot evaluate.
+     */
+    static bool Parse(const TSharedPtr<FJsonObject>& Payload, EMcpActorField DefaultFields, FMcpActorQuery& OutQuery,
+        FString& OutError);
+
+    /** Field flags for names such as "label" or "location"; false with OutUnknown for the first unknown one. */
+    static bool ParseFields(const TArray<FString>& Names, EMcpActorField& OutFields, FString& OutUnknown);
+};
+
+/**
+ * Runs an FMcpActorQuery and writes its page: "actors", "count", "totalCount" and, when more
+ * remain, "nextCursor". Writing is split across core-ticker ticks for large pages so the editor
+ * keeps ticking while tens of thousands of actors serialize. Game thread only.
+ */
+class FMcpActorQueryRunner
+{
+public:
+    /**
+     * Writes the page into Writer, which the caller has opened with BeginObject and may have put
+     * members in, then hands it to OnFinished to close and send. OnFinished runs exactly once,
+     * synchronously when the page fits in one chunk. An unknown or expired cursor finishes with
+     * ErrorCode CURSOR_EXPIRED and nothing written.
+     */
+    static void Run(UWorld* World, FMcpActorIndex& Index, const FMcpActorQuery& Query, FMcpJsonUtf8Writer&& Writer,
+        TFunction<void(FMcpJsonUtf8Writer&& Writer, int32 Returned, const FString& ErrorCode)> OnFinished);
+};
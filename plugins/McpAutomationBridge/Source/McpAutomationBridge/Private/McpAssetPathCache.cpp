@@ -0,0 +1,193 @@
+#include "McpAssetPathCache.h"
+
+#include "AssetRegistry/AssetData.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Misc/ScopeLock.h"
+#include "Modules/ModuleManager.h"
+
+namespace {
+FMcpAssetPathCache *GMcpAssetPathCache = nullptr;
+
+const TCHAR *AssetPathQueryName(int32 Query) {
+  switch (static_cast<EMcpAssetPathQuery>(Query)) {
+  case EMcpAssetPathQuery::Normalize:
+    return TEXT("normalizeAssetPath");
+  case EMcpAssetPathQuery::Resolve:
+    return TEXT("resolveAssetPath");
+  case EMcpAssetPathQuery::BlueprintPath:
+    return TEXT("findBlueprintNormalizedPath");
+  case EMcpAssetPathQuery::DirectoryOnDisk:
+    return TEXT("directoryExistsOnDisk");
+  default:
+    return TEXT("unknown");
+  }
+}
+} // namespace
+
+void FMcpAssetPathCache::Startup() {
+  if (!GMcpAssetPathCache) {
+    GMcpAssetPathCache = new FMcpAssetPathCache();
+  }
+}
+
+void FMcpAssetPathCache::Shutdown() {
+  delete GMcpAssetPathCache;
+  GMcpAssetPathCache = nullptr;
+}
+
+FMcpAssetPathCache::~FMcpAssetPathCache() {
+  if (!bBound) {
+    return;
+  }
+  if (FAssetRegistryModule *Module =
+          FModuleManager::GetModulePtr<FAssetRegistryModule>(
+              TEXT("AssetRegistry"))) {
+    IAssetRegistry &Registry = Module->Get();
+    Registry.OnAssetAdded().Remove(AssetAddedHandle);
+    Registry.OnAssetRemoved().Remove(AssetRemovedHandle);
+    Registry.OnAssetRenamed().Remove(AssetRenamedHandle);
+    Registry.OnPathAdded().Remove(PathAddedHandle);
+    Registry.OnPathRemoved().Remove(PathRemovedHandle);
+    Registry.OnInMemoryAssetCreated().Remove(InMemoryCreatedHandle);
+    Registry.OnInMemoryAssetDeleted().Remove(InMemoryDeletedHandle);
+  }
+}
+
+bool FMcpAssetPathCache::EnsureBound() {
+  if (bBound) {
+    return true;
+  }
+  // The registry can load after this module; never remember an answer that
+  // no event would ever invalidate. Binding is game-thread only.
+  if (!IsInGameThread()) {
+    return false;
+  }
+  FAssetRegistryModule *Module =
+      FModuleManager::GetModulePtr<FAssetRegistryModule>(TEXT("AssetRegistry"));
+  if (!Module) {
+    return false;
+  }
+  IAssetRegistry &Registry = Module->Get();
+  AssetAddedHandle = Registry.OnAssetAdded().AddLambda(
+      [](const FAssetData &) { Invalidate(); });
+  AssetRemovedHandle = Registry.OnAssetRemoved().AddLambda(
+      [](const FAssetData &) { Invalidate(); });
+  AssetRenamedHandle = Registry.OnAssetRenamed().AddLambda(
+      [](const FAssetData &, const FString &) { Invalidate(); });
+  PathAddedHandle = Registry.OnPathAdded().AddLambda(
+      [](const FString &) { Invalidate(); });
+  PathRemovedHandle = Registry.OnPathRemoved().AddLambda(
+      [](const FString &) { Invalidate(); });
+  InMemoryCreatedHandle = Registry.OnInMemoryAssetCreated().AddLambda(
+      [](UObject *) { Invalidate(); });
+  InMemoryDeletedHandle = Registry.OnInMemoryAssetDeleted().AddLambda(
+      [](UObject *) { Invalidate(); });
+  bBound = true;
+  return true;
+}
+
+bool FMcpAssetPathCache::Find(EMcpAssetPathQuery Query, const FString &Input,
+                              FMcpCachedAssetPath &OutResult,
+                              uint64 &OutGeneration) {
+  OutGeneration = 0;
+  if (!GMcpAssetPathCache) {
+    return false;
+  }
+  FMcpAssetPathCache &Cache = *GMcpAssetPathCache;
+  const int32 Index = static_cast<int32>(Query);
+  FScopeLock Lock(&Cache.Mutex);
+  if (const FMcpCachedAssetPath *Found = Cache.Entries[Index].Find(Input)) {
+    ++Cache.Counters[Index].Hits;
+    OutResult = *Found;
+    return true;
+  }
+  ++Cache.Counters[Index].Misses;
+  OutGeneration = Cache.Generation;
+  return false;
+}
+
+void FMcpAssetPathCache::Store(EMcpAssetPathQuery Query, const FString &Input,
+                               const FMcpCachedAssetPath &Result,
+                               uint64 Generation) {
+  if (!GMcpAssetPathCache) {
+    return;
+  }
+  FMcpAssetPathCache &Cache = *GMcpAssetPathCache;
+  FScopeLock Lock(&Cache.Mutex);
+  if (Generation != Cache.Generation || !Cache.EnsureBound()) {
+    return;
+  }
+  FQueryMap &Map = Cache.Entries[static_cast<int32>(Query)];
+  if (Map.Num() >= MaxEntriesPerQuery) {
+    Map.Reset();
+  }
+  Map.Add(Input, Result);
+}
+
+void FMcpAssetPathCache::Invalidate() {
+  if (GMcpAssetPathCache) {
+    FScopeLock Lock(&GMcpAssetPathCache->Mutex);
+    GMcpAssetPathCache->Clear();
+  }
+}
+
+void FMcpAssetPathCache::Clear() {
+  ++Generation;
+  bool bHadEntries = false;
+  for (FQueryMap &Map : Entries) {
+    bHadEntries |= Map.Num() > 0;
+    Map.Reset();
+  }
+  // The initial registry scan alone raises one event per asset.
+  if (bHadEntries) {
+    ++Invalidations;
+  }
+}
+
+TSharedPtr<FJsonObject> FMcpAssetPathCache::GetStats(bool bReset) {
+  TSharedPtr<FJsonObject> Stats = MakeShared<FJsonObject>();
+  if (!GMcpAssetPathCache) {
+    Stats->SetBoolField(TEXT("enabled"), false);
+    return Stats;
+  }
+  FMcpAssetPathCache &Cache = *GMcpAssetPathCache;
+  FScopeLock Lock(&Cache.Mutex);
+  Stats->SetBoolField(TEXT("enabled"), Cache.bBound);
+  uint64 TotalHits = 0;
+  uint64 TotalMisses = 0;
+  TSharedPtr<FJsonObject> Queries = MakeShared<FJsonObject>();
+  for (int32 Index = 0; Index < static_cast<int32>(EMcpAssetPathQuery::Num);
+       ++Index) {
+    const FCounters &Counters = Cache.Counters[Index];
+    const uint64 Lookups = Counters.Hits + Counters.Misses;
+    TSharedPtr<FJsonObject> Query = MakeShared<FJsonObject>();
+    Query->SetNumberField(TEXT("hits"), static_cast<double>(Counters.Hits));
+    Query->SetNumberField(TEXT("misses"), static_cast<double>(Counters.Misses));
+    Query->SetNumberField(TEXT("hitRate"),
+                          Lookups > 0 ? static_cast<double>(Counters.Hits) /
+                                            static_cast<double>(Lookups)
+                                      : 0.0);
+    Query->SetNumberField(TEXT("entries"), Cache.Entries[Index].Num());
+    Queries->SetObjectField(AssetPathQueryName(Index), Query);
+    TotalHits += Counters.Hits;
+    TotalMisses += Counters.Misses;
+  }
+  const uint64 TotalLookups = TotalHits + TotalMisses;
+  Stats->SetObjectField(TEXT("queries"), Queries);
+  Stats->SetNumberField(TEXT("hits"), static_cast<double>(TotalHits));
+  Stats->SetNumberField(TEXT("misses"), static_cast<double>(TotalMisses));
+  Stats->SetNumberField(TEXT("hitRate"),
+                        TotalLookups > 0 ? static_cast<double>(TotalHits) /
+                                               static_cast<double>(TotalLookups)
+                                         : 0.0);
+  Stats->SetNumberField(TEXT("invalidations"),
+                        static_cast<double>(Cache.Invalidations));
+
+  if (bReset) {
+    for (FCounters &Counters : Cache.Counters) {
+      Counters = FCounters();
+    }
+    Cache.Invalidations = 0;
+  }
+  return Stats;
+}
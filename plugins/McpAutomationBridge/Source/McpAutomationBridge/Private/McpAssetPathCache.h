@@ -0,0 +1,103 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "HAL/CriticalSection.h"
+
+/** The asset path helpers whose answers FMcpAssetPathCache remembers. */
+enum class EMcpAssetPathQuery : uint8
+{
+    Normalize,        // NormalizeAssetPath
+    Resolve,          // ResolveAssetPath
+    BlueprintPath,    // FindBlueprintNormalizedPath
+    DirectoryOnDisk,  // DoesAssetDirectoryExistOnDisk
+    Num
+};
+
+/** One remembered answer: the path produced, an error text, and the helper's boolean result. */
+struct FMcpCachedAssetPath
+{
+    FString Path;
+    FString Error;
+    bool bOk = false;
+};
+
+/**
+ * Memo for the asset path helpers in McpAutomationBridgeHelpers.h, which re-run sanitization,
+ * Asset Registry queries and disk probes every time a handler asks about the same path.
+ *
+ * Every answer is dropped as soon as the Asset Registry reports an asset or path added, removed
+ * or renamed, or an in-memory asset created or deleted; nothing is remembered until the registry
+ * can be listened to. Directory probes only remember directories that exist, because handlers
+ * create folders on disk without telling the registry. Inputs compare case-sensitively so a hit
+ * returns exactly what the helper returned for that spelling. Thread-safe.
+ */
+class FMcpAssetPathCache
+{
+public:
+    static void Startup();
+    static void Shutdown();
+
+    /**
+     * On a miss, OutGeneration identifies the cache state; pass it to Store so an answer computed
+     * while an invalidation arrived is not remembered.
+     */
+    static bool Find(EMcpAssetPathQuery Query, const FString& Input, FMcpCachedAssetPath& OutResult,
+                     uint64& OutGeneration);
+    static void Store(EMcpAssetPathQuery Query, const FString& Input, const FMcpCachedAssetPath& Result,
+                      uint64 Generation);
+    static void Invalidate();
+
+    /** Hit/miss counts per helper and invalidations since the last reset, for get_bridge_metrics. */
+    static TSharedPtr<FJsonObject> GetStats(bool bReset);
+
+private:
+    struct FCaseSensitiveKeyFuncs : BaseKeyFuncs<TPair<FString, FMcpCachedAssetPath>, FString, false>
+    {
+        static const FString& GetSetKey(const TPair<FString, FMcpCachedAssetPath>& Element)
+        {
+            return Element.Key;
+        }
+        static bool Matches(const FString& A, const FString& B)
+        {
+            return A.Equals(B, ESearchCase::CaseSensitive);
+        }
+        static uint32 GetKeyHash(const FString& Key)
+        {
+            return FCrc::StrCrc32(*Key);
+        }
+    };
+
+    using FQueryMap = TMap<FString, FMcpCachedAssetPath, FDefaultSetAllocator, FCaseSensitiveKeyFuncs>;
+
+    struct FCounters
+    {
+        uint64 Hits = 0;
+        uint64 Misses = 0;
+    };
+
+    FMcpAssetPathCache() = default;
+    ~FMcpAssetPathCache();
+
+    /** Binds registry events once the Asset Registry module is up; false until then. */
+    bool EnsureBound();
+    void Clear();
+
+    /** Per helper; the memo of one starts over rather than tracking recency. */
+    static constexpr int32 MaxEntriesPerQuery = 8192;
+
+    mutable FCriticalSection Mutex;
+    FQueryMap Entries[static_cast<int32>(EMcpAssetPathQuery::Num)];
+    FCounters Counters[static_cast<int32>(EMcpAssetPathQuery::Num)];
+    uint64 Invalidations = 0;
+    uint64 Generation = 0;
+    bool bBound = false;
+
+    FDelegateHandle AssetAddedHandle;
+    FDelegateHandle AssetRemovedHandle;
+    FDelegateHandle AssetRenamedHandle;
+    FDelegateHandle PathAddedHandle;
+    FDelegateHandle PathRemovedHandle;
+    FDelegateHandle InMemoryCreatedHandle;
+    FDelegateHandle InMemoryDeletedHandle;
+};
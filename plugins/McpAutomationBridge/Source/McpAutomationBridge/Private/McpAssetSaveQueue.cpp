@@ -0,0 +1,148 @@
+#include "McpAssetSaveQueue.h"
+
+#include "McpAutomationBridgeSettings.h"
+#include "McpAutomationBridgeSubsystem.h"
+#include "UObject/Package.h"
+
+#if WITH_EDITOR
+#include "FileHelpers.h"
+#include "Misc/PackageName.h"
+#include "UObject/SavePackage.h"
+#endif
+
+namespace {
+int32 GAssetSaveScopeDepth = 0;
+TArray<TWeakObjectPtr<UPackage>> GQueuedAssetSaves;
+
+uint64 GAssetSavesQueued = 0;
+uint64 GAssetSaveFlushes = 0;
+uint64 GAssetSavesWritten = 0;
+uint64 GAssetSavesFailed = 0;
+// Most recent failures, newest last, for get_bridge_metrics.
+TArray<FString> GRecentAssetSaveFailures;
+constexpr int32 MaxRecentAssetSaveFailures = 16;
+
+#if WITH_EDITOR
+// SAVE_Async serializes on this thread and hands the file write to a worker;
+// the writes are awaited once every package has been serialized.
+bool SavePackagesAsync(const TArray<UPackage *> &Packages,
+                       TArray<UPackage *> &OutFailed) {
+  for (UPackage *Package : Packages) {
+    const FString Extension = Package->ContainsMap()
+                                  ? FPackageName::GetMapPackageExtension()
+                                  : FPackageName::GetAssetPackageExtension();
+    FString Filename;
+    bool bSaved = FPackageName::TryConvertLongPackageNameToFilename(
+        Package->GetName(), Filename, Extension);
+    if (bSaved) {
+      FSavePackageArgs Args;
+      Args.TopLevelFlags = RF_Public | RF_Standalone;
+      Args.SaveFlags = SAVE_NoError | SAVE_Async;
+      bSaved = UPackage::SavePackage(Package, nullptr, *Filename, Args);
+    }
+    if (!bSaved) {
+      OutFailed.Add(Package);
+    }
+  }
+  UPackage::WaitForAsyncFileWrites();
+  return OutFailed.Num() == 0;
+}
+#endif
+} // namespace
+
+FMcpAssetSaveQueue::FScope::FScope() { ++GAssetSaveScopeDepth; }
+
+FMcpAssetSaveQueue::FScope::~FScope() {
+  if (--GAssetSaveScopeDepth == 0) {
+    Flush();
+  }
+}
+
+bool FMcpAssetSaveQueue::Queue(UObject *Asset) {
+  check(IsInGameThread());
+  UPackage *Package = Asset ? Asset->GetOutermost() : nullptr;
+  if (!Package) {
+    return false;
+  }
+  ++GAssetSavesQueued;
+  GQueuedAssetSaves.AddUnique(Package);
+  if (GAssetSaveScopeDepth > 0) {
+    return true;
+  }
+  TArray<FMcpAssetSaveResult> Results;
+  Flush(&Results);
+  return Results.Num() == 1 && Results[0].bSaved;
+}
+
+void FMcpAssetSaveQueue::Flush(TArray<FMcpAssetSaveResult> *OutResults) {
+  check(IsInGameThread());
+  TArray<UPackage *> Packages;
+  for (const TWeakObjectPtr<UPackage> &Weak : GQueuedAssetSaves) {
+    if (UPackage *Package = Weak.Get()) {
+      Packages.Add(Package);
+    }
+  }
+  GQueuedAssetSaves.Reset();
+  if (Packages.Num() == 0) {
+    return;
+  }
+
+  TArray<UPackage *> Failed;
+#if WITH_EDITOR
+  const UMcpAutomationBridgeSettings *Settings =
+      GetDefault<UMcpAutomationBridgeSettings>();
+  if (Settings && Settings->bAsyncAssetSaves) {
+    SavePackagesAsync(Packages, Failed);
+  } else {
+    // Packages that are no longer dirty are skipped, as SaveLoadedAsset did.
+    FEditorFileUtils::PromptForCheckoutAndSave(
+        Packages, /*bCheckDirty=*/true, /*bPromptToSave=*/false, &Failed);
+  }
+#else
+  Failed = Packages;
+#endif
+
+  ++GAssetSaveFlushes;
+  for (UPackage *Package : Packages) {
+    const bool bSaved = !Failed.Contains(Package);
+    if (bSaved) {
+      ++GAssetSavesWritten;
+    } else {
+      ++GAssetSavesFailed;
+      UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
+             TEXT("FMcpAssetSaveQueue: failed to save '%s'"),
+             *Package->GetName());
+      if (GRecentAssetSaveFailures.Num() >= MaxRecentAssetSaveFailures) {
+        GRecentAssetSaveFailures.RemoveAt(0);
+      }
+      GRecentAssetSaveFailures.Add(Package->GetName());
+    }
+    if (OutResults) {
+      FMcpAssetSaveResult &Result = OutResults->AddDefaulted_GetRef();
+      Result.PackageName = Package->GetName();
+      Result.bSaved = bSaved;
+    }
+  }
+}
+
+TSharedPtr<FJsonObject> FMcpAssetSaveQueue::GetStats(bool bReset) {
+  TSharedPtr<FJsonObject> Stats = MakeShared<FJsonObject>();
+  Stats->SetNumberField(TEXT("queued"), static_cast<double>(GAssetSavesQueued));
+  Stats->SetNumberField(TEXT("flushes"), static_cast<double>(GAssetSaveFlushes));
+  Stats->SetNumberField(TEXT("saved"), static_cast<double>(GAssetSavesWritten));
+  Stats->SetNumberField(TEXT("failed"), static_cast<double>(GAssetSavesFailed));
+  Stats->SetNumberField(TEXT("pending"), GQueuedAssetSaves.Num());
+  TArray<TSharedPtr<FJsonValue>> Failures;
+  for (const FString &Package : GRecentAssetSaveFailures) {
+    Failures.Add(MakeShared<FJsonValueString>(Package));
+  }
+  Stats->SetArrayField(TEXT("recentFailures"), Failures);
+  if (bReset) {
+    GAssetSavesQueued = 0;
+    GAssetSaveFlushes = 0;
+    GAssetSavesWritten = 0;
+    GAssetSavesFailed = 0;
+    GRecentAssetSaveFailures.Reset();
+  }
+  return Stats;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "UObject/WeakObjectPtr.h"
+
+class UObject;
+class UPackage;
+
+/** Outcome of one package written by FMcpAssetSaveQueue::Flush. */
+struct FMcpAssetSaveResult
+{
+    FString PackageName;
+    bool bSaved = false;
+};
+
+/**
+ * Packages handlers asked to save while a dispatch is running, written together once the outermost
+ * dispatch ends (or a batch asks for them), so bulk authoring pays one save per package instead of
+ * one per edit. Saves go through a single FEditorFileUtils::PromptForCheckoutAndSave call, the path
+ * UEditorAssetLibrary::SaveLoadedAsset takes per asset, which reports the packages that failed;
+ * with bAsyncAssetSaves set, packages are serialized with SAVE_Async and the file writes are
+ * awaited once at the end. Outside a dispatch a save runs at once. Game thread only.
+ */
+class FMcpAssetSaveQueue
+{
+public:
+    /** Defers the saves queued during its lifetime until the outermost scope closes. */
+    class FScope
+    {
+    public:
+        FScope();
+        ~FScope();
+
+        FScope(const FScope&) = delete;
+        FScope& operator=(const FScope&) = delete;
+    };
+
+    /**
+     * Queues the package of Asset. Returns whether the save succeeded when it ran at once, and true
+     * once queued; failures of a deferred save are logged and counted.
+     */
+    static bool Queue(UObject* Asset);
+
+    /** Saves every queued package now and reports each one. */
+    static void Flush(TArray<FMcpAssetSaveResult>* OutResults = nullptr);
+
+    /** Queued, saved and failed package counts for get_bridge_metrics. */
+    static TSharedPtr<FJsonObject> GetStats(bool bReset);
+};
@@ -0,0 +1,126 @@
+#include "McpAssetScanQueue.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Modules/ModuleManager.h"
+
+namespace {
+int32 GAssetScanScopeDepth = 0;
+TSet<FString> GQueuedAssetScans;
+
+uint64 GAssetScansQueued = 0;
+uint64 GAssetScanFlushes = 0;
+uint64 GAssetScanFilesIssued = 0;
+uint64 GAssetScanPathsIssued = 0;
+
+// True when Folder is Path itself or one of its parent folders.
+bool IsSameOrAncestorFolder(const FString &Folder, const FString &Path) {
+  return Path.Equals(Folder, ESearchCase::IgnoreCase) ||
+         (Path.StartsWith(Folder, ESearchCase::IgnoreCase) &&
+          Path.Len() > Folder.Len() && Path[Folder.Len()] == TEXT('/'));
+}
+} // namespace
+
+FMcpAssetScanQueue::FScope::FScope() { ++GAssetScanScopeDepth; }
+
+FMcpAssetScanQueue::FScope::~FScope() {
+  if (--GAssetScanScopeDepth == 0) {
+    Flush();
+  }
+}
+
+void FMcpAssetScanQueue::Queue(const FString &PackageOrPath) {
+  check(IsInGameThread());
+  FString Path = PackageOrPath;
+  Path.RemoveFromEnd(TEXT("/"));
+  if (Path.IsEmpty()) {
+    return;
+  }
+  ++GAssetScansQueued;
+  GQueuedAssetScans.Add(MoveTemp(Path));
+  if (GAssetScanScopeDepth == 0) {
+    Flush();
+  }
+}
+
+void FMcpAssetScanQueue::Flush() {
+  check(IsInGameThread());
+  if (GQueuedAssetScans.Num() == 0) {
+    return;
+  }
+  TSet<FString> Queued = MoveTemp(GQueuedAssetScans);
+  GQueuedAssetScans.Reset();
+  FAssetRegistryModule *Module =
+      FModuleManager::GetModulePtr<FAssetRegistryModule>(TEXT("AssetRegistry"));
+  if (!Module) {
+    return;
+  }
+
+  // A queued path that names a package on disk is scanned as that file;
+  // anything else is a folder.
+  TArray<FString> Folders;
+  TArray<TPair<FString, FString>> Packages;
+  for (const FString &Path : Queued) {
+    FString Filename;
+    if (FPackageName::DoesPackageExist(Path, &Filename)) {
+      Packages.Emplace(Path, FPaths::ConvertRelativePathToFull(Filename));
+    } else {
+      Folders.Add(Path);
+    }
+  }
+
+  // Shortest first, so a folder is kept before any of its subfolders.
+  Folders.Sort([](const FString &A, const FString &B) {
+    return A.Len() < B.Len();
+  });
+  TArray<FString> ScanPaths;
+  for (const FString &Folder : Folders) {
+    const bool bCovered = ScanPaths.ContainsByPredicate(
+        [&Folder](const FString &Kept) {
+          return IsSameOrAncestorFolder(Kept, Folder);
+        });
+    if (!bCovered) {
+      ScanPaths.Add(Folder);
+    }
+  }
+  TArray<FString> ScanFiles;
+  for (const TPair<FString, FString> &Package : Packages) {
+    const bool bCovered = ScanPaths.ContainsByPredicate(
+        [&Package](const FString &Kept) {
+          return IsSameOrAncestorFolder(Kept, Package.Key);
+        });
+    if (!bCovered) {
+      ScanFiles.Add(Package.Value);
+    }
+  }
+
+  IAssetRegistry &Registry = Module->Get();
+  if (ScanPaths.Num() > 0) {
+    Registry.ScanPathsSynchronous(ScanPaths, true);
+  }
+  if (ScanFiles.Num() > 0) {
+    Registry.ScanFilesSynchronous(ScanFiles, true);
+  }
+  ++GAssetScanFlushes;
+  GAssetScanPathsIssued += ScanPaths.Num();
+  GAssetScanFilesIssued += ScanFiles.Num();
+}
+
+TSharedPtr<FJsonObject> FMcpAssetScanQueue::GetStats(bool bReset) {
+  TSharedPtr<FJsonObject> Stats = MakeShared<FJsonObject>();
+  Stats->SetNumberField(TEXT("queued"), static_cast<double>(GAssetScansQueued));
+  Stats->SetNumberField(TEXT("flushes"), static_cast<double>(GAssetScanFlushes));
+  Stats->SetNumberField(TEXT("pathsScanned"),
+                        static_cast<double>(GAssetScanPathsIssued));
+  Stats->SetNumberField(TEXT("filesScanned"),
+                        static_cast<double>(GAssetScanFilesIssued));
+  Stats->SetNumberField(TEXT("pending"), GQueuedAssetScans.Num());
+  if (bReset) {
+    GAssetScansQueued = 0;
+    GAssetScanFlushes = 0;
+    GAssetScanPathsIssued = 0;
+    GAssetScanFilesIssued = 0;
+  }
+  return Stats;
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+/**
+ * Asset Registry rescans requested while a dispatch is running, issued together once the outermost
+ * dispatch ends. A batch that creates hundreds of assets then rescans their files in a single
+ * ScanFilesSynchronous call instead of blocking the editor once per asset.
+ *
+ * Packages are rescanned as files; folders as paths, dropping any folder whose ancestor is also
+ * queued. Outside a dispatch a queued scan runs at once. Callers that need the asset visible before
+ * the dispatch ends should register it in memory (FAssetRegistryModule::AssetCreated) rather than
+ * scan. Game thread only.
+ */
+class FMcpAssetScanQueue
+{
+public:
+    /** Defers the scans queued during its lifetime until the outermost scope closes. */
+    class FScope
+    {
+    public:
+        FScope();
+        ~FScope();
+
+        FScope(const FScope&) = delete;
+        FScope& operator=(const FScope&) = delete;
+    };
+
+    /** Queues a package name ("/Game/Dir/Asset") or content folder ("/Game/Dir") for rescanning. */
+    static void Queue(const FString& PackageOrPath);
+
+    /** Issues every queued scan now. */
+    static void Flush();
+
+    /** Queued, coalesced and issued scan counts for get_bridge_metrics. */
+    static TSharedPtr<FJsonObject> GetStats(bool bReset);
+};
@@ -0,0 +1,86 @@
+#include "McpAssetSearchCursors.h"
+
+#include "HAL/PlatformTime.h"
+#include "Misc/Guid.h"
+#include "Misc/ScopeLock.h"
+
+namespace {
+FString MakeAssetSearchCursor(const FGuid &Set, int32 Offset) {
+  return FString::Printf(TEXT("%s:%d"), *Set.ToString(EGuidFormats::Digits),
+                         Offset);
+}
+
+bool ParseAssetSearchCursor(const FString &Cursor, FGuid &OutSet,
+                            int32 &OutOffset) {
+  FString SetText;
+  FString OffsetText;
+  if (!Cursor.Split(TEXT(":"), &SetText, &OffsetText) ||
+      !FGuid::ParseExact(SetText, EGuidFormats::Digits, OutSet) ||
+      !OffsetText.IsNumeric()) {
+    return false;
+  }
+  OutOffset = FCString::Atoi(*OffsetText);
+  return OutOffset >= 0;
+}
+} // namespace
+
+FString FMcpAssetSearchCursors::Open(TArray<FAssetData> &&Results,
+                                     int32 Offset) {
+  const double Now = FPlatformTime::Seconds();
+  const FGuid Set = FGuid::NewGuid();
+  FScopeLock Lock(&Mutex);
+  PruneLocked(Now);
+  FResultSet &Entry = Sets.Add(Set);
+  Entry.Results = MoveTemp(Results);
+  Entry.LastAccessSeconds = Now;
+  return MakeAssetSearchCursor(Set, Offset);
+}
+
+bool FMcpAssetSearchCursors::ReadPage(const FString &Cursor, int32 PageSize,
+                                      TArray<FAssetData> &OutPage,
+                                      int32 &OutTotal,
+                                      FString &OutNextCursor) {
+  OutNextCursor.Reset();
+  FGuid Set;
+  int32 Offset = 0;
+  if (!ParseAssetSearchCursor(Cursor, Set, Offset)) {
+    return false;
+  }
+
+  const double Now = FPlatformTime::Seconds();
+  FScopeLock Lock(&Mutex);
+  PruneLocked(Now);
+  FResultSet *Entry = Sets.Find(Set);
+  if (!Entry || Offset > Entry->Results.Num()) {
+    return false;
+  }
+  Entry->LastAccessSeconds = Now;
+  OutTotal = Entry->Results.Num();
+  const int32 End = FMath::Min(OutTotal, Offset + FMath::Max(1, PageSize));
+  OutPage.Reset(End - Offset);
+  OutPage.Append(Entry->Results.GetData() + Offset, End - Offset);
+  if (End < OutTotal) {
+    OutNextCursor = MakeAssetSearchCursor(Set, End);
+  } else {
+    Sets.Remove(Set);
+  }
+  return true;
+}
+
+void FMcpAssetSearchCursors::PruneLocked(double NowSeconds) {
+  for (auto It = Sets.CreateIterator(); It; ++It) {
+    if (NowSeconds - It.Value().LastAccessSeconds > IdleSeconds) {
+      It.RemoveCurrent();
+    }
+  }
+  // Room for the set about to be opened; the least recently read goes.
+  while (Sets.Num() >= MaxSets) {
+    auto Oldest = Sets.CreateIterator();
+    for (auto It = Sets.CreateIterator(); It; ++It) {
+      if (It.Value().LastAccessSeconds < Oldest.Value().LastAccessSeconds) {
+        Oldest = It;
+      }
+    }
+    Oldest.RemoveCurrent();
+  }
+}
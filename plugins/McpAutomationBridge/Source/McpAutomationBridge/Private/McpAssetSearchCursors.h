@@ -0,0 +1,41 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+#include "HAL/CriticalSection.h"
+
+/**
+ * Result sets of paged search_assets queries, held so later pages are served without re-running
+ * the Asset Registry query. A cursor is an opaque "<set>:<offset>" token; a set is a snapshot of
+ * the query as it ran and is dropped after a few idle minutes or when newer sets push it out.
+ * Thread-safe: search_assets runs on the worker lane as well as the game thread.
+ */
+class FMcpAssetSearchCursors
+{
+public:
+    /** Keeps Results and returns the cursor of the element at Offset, the start of the next page. */
+    FString Open(TArray<FAssetData>&& Results, int32 Offset);
+
+    /**
+     * Copies up to PageSize results from the cursor's position. OutNextCursor is empty once the
+     * page reaches the end, at which point the set is released. False for an unknown or expired
+     * cursor.
+     */
+    bool ReadPage(const FString& Cursor, int32 PageSize, TArray<FAssetData>& OutPage, int32& OutTotal,
+                  FString& OutNextCursor);
+
+private:
+    struct FResultSet
+    {
+        TArray<FAssetData> Results;
+        double LastAccessSeconds = 0.0;
+    };
+
+    void PruneLocked(double NowSeconds);
+
+    static constexpr double IdleSeconds = 300.0;
+    static constexpr int32 MaxSets = 16;
+
+    FCriticalSection Mutex;
+    TMap<FGuid, FResultSet> Sets;
+};
@@ -9,15 +9,11 @@ TMap<FString, double> GBlueprintCreateInflightTs;
 FCriticalSection GBlueprintCreateMutex;
 double GBlueprintCreateStaleTimeoutSec = 60.0;
 TSet<FString> GBlueprintBusySet;
-TMap<FString, TSharedPtr<FJsonObject>> GBlueprintRegistry;
+// Bounds sized for a long authoring session; the least recently used record
+// goes first once one is full.
+TMcpRecordRegistry<FMcpBlueprintRecord> GBlueprintRegistry(4096);
 
-TMap<FString, TSharedPtr<FJsonObject>> GSequenceRegistry;
+TMcpRecordRegistry<FMcpSequenceRecord> GSequenceRegistry(1024);
 FString GCurrentSequencePath;
 
-TMap<FString, TSharedPtr<FJsonObject>> GNiagaraRegistry;
-
-// Recent asset save tracking (throttle across plugin to avoid frequent
-// SavePackage calls)
-TMap<FString, double> GRecentAssetSaveTs;
-FCriticalSection GRecentAssetSaveMutex;
-double GRecentAssetSaveThrottleSeconds = 0.5;
+TMcpRecordRegistry<FMcpNiagaraRecord> GNiagaraRegistry(1024);
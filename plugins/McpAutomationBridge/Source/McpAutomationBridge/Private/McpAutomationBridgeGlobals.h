@@ -10,6 +10,7 @@
 #include "CoreMinimal.h"
 #include "Dom/JsonObject.h"
 #include "HAL/CriticalSection.h"
+#include "McpRecordRegistry.h"
 
 extern TMap<FString,
             TArray<TPair<FString, TSharedPtr<class FMcpBridgeWebSocket>>>>
@@ -21,17 +22,14 @@ extern TMap<FString, double> GBlueprintCreateInflightTs;
 extern FCriticalSection GBlueprintCreateMutex;
 extern double GBlueprintCreateStaleTimeoutSec;
 extern TSet<FString> GBlueprintBusySet;
-extern TMap<FString, TSharedPtr<FJsonObject>> GBlueprintRegistry;
+// Blueprints resolved by LoadBlueprintAsset and the members handlers added.
+extern TMcpRecordRegistry<FMcpBlueprintRecord> GBlueprintRegistry;
 
-extern TMap<FString, TSharedPtr<FJsonObject>> GSequenceRegistry;
+extern TMcpRecordRegistry<FMcpSequenceRecord> GSequenceRegistry;
 extern FString GCurrentSequencePath;
 
 // Lightweight registry used for created Niagara systems when running in
 // fast-mode or when native Niagara factories are not available. Tests and
 // higher-level tooling may rely on a plugin-side record of created
 // Niagara assets even when on-disk creation is not possible.
-extern TMap<FString, TSharedPtr<FJsonObject>> GNiagaraRegistry;
-
-extern TMap<FString, double> GRecentAssetSaveTs;
-extern FCriticalSection GRecentAssetSaveMutex;
-extern double GRecentAssetSaveThrottleSeconds;
+extern TMcpRecordRegistry<FMcpNiagaraRecord> GNiagaraRegistry;
@@ -8,6 +8,8 @@
 #include "Dom/JsonObject.h"
 #include "HAL/PlatformTime.h"
 #include "JsonObjectConverter.h"
+#include "McpJsonUtf8Writer.h"
+#include "McpPackedArray.h"
 #include "Misc/FileHelper.h"
 #include "Misc/OutputDevice.h"
 #include "Misc/Paths.h"
@@ -170,6 +172,12 @@
 // Globals used by registry helpers and fast-mode simulations
 #include "McpAutomationBridgeGlobals.h"
 #include "McpAutomationBridgeSubsystem.h"
+#include "McpClassIndex.h"
+#include "McpAssetPathCache.h"
+#include "McpAssetSaveQueue.h"
+#include "McpBlueprintCompileQueue.h"
+#include "McpMaterialCompileQueue.h"
+#include "McpAssetScanQueue.h"
 
 #if WITH_EDITOR
 #include "Editor.h"  // GEditor for McpSafeLoadMap
@@ -520,7 +528,8 @@ struct FNormalizedAssetPath {
  *   - ErrorMessage: populated with a validation error when `bIsValid` is
  * `false`.
  */
-static inline FNormalizedAssetPath NormalizeAssetPath(const FString &InPath) {
+static inline FNormalizedAssetPath
+NormalizeAssetPathUncached(const FString &InPath) {
   FNormalizedAssetPath Result;
   Result.bIsValid = false;
 
@@ -590,6 +599,25 @@ static inline FNormalizedAssetPath NormalizeAssetPath(const FString &InPath) {
   return Result;
 }
 
+/**
+ * NormalizeAssetPath remembered per input until the Asset Registry reports a
+ * change (see FMcpAssetPathCache).
+ */
+static inline FNormalizedAssetPath NormalizeAssetPath(const FString &InPath) {
+  FMcpCachedAssetPath Cached;
+  uint64 Generation = 0;
+  if (FMcpAssetPathCache::Find(EMcpAssetPathQuery::Normalize, InPath, Cached,
+                               Generation)) {
+    return FNormalizedAssetPath{Cached.Path, Cached.bOk, Cached.Error};
+  }
+  FNormalizedAssetPath Result = NormalizeAssetPathUncached(InPath);
+  FMcpAssetPathCache::Store(
+      EMcpAssetPathQuery::Normalize, InPath,
+      FMcpCachedAssetPath{Result.Path, Result.ErrorMessage, Result.bIsValid},
+      Generation);
+  return Result;
+}
+
 // Convenience helper that tries to resolve the path and returns it, or empty if
 // invalid Also outputs the resolved path to a pointer if provided
 static inline FString TryResolveAssetPath(const FString &InPath,
@@ -611,7 +639,7 @@ static inline FString TryResolveAssetPath(const FString &InPath,
  * 2. If not, and InputPath is a short name, searches AssetRegistry.
  * 3. Returns the full package name if found uniquely.
  */
-static inline FString ResolveAssetPath(const FString &InputPath) {
+static inline FString ResolveAssetPathUncached(const FString &InputPath) {
   if (InputPath.IsEmpty())
     return FString();
 
@@ -632,8 +660,7 @@ static inline FString ResolveAssetPath(const FString &InputPath) {
   // 3. Search by name if it's a short name (no slashes)
   // UE 5.7+ compatible: Use GetAssetsByPath + manual name filtering instead of FARFilter::AssetName
   // PERFORMANCE NOTE: This scans all assets under /Game when given a short name (no slashes).
-  // For large projects, this could be slow if called frequently. Consider caching results
-  // or providing full paths when possible.
+  // ResolveAssetPath remembers the answer, so repeated requests only pay it once.
   if (!InputPath.Contains(TEXT("/"))) {
     FString ShortName = FPaths::GetBaseFilename(InputPath);
     
@@ -674,6 +701,21 @@ static inline FString ResolveAssetPath(const FString &InputPath) {
   return FString();
 }
 
+/** ResolveAssetPath remembered per input (see FMcpAssetPathCache). */
+static inline FString ResolveAssetPath(const FString &InputPath) {
+  FMcpCachedAssetPath Cached;
+  uint64 Generation = 0;
+  if (FMcpAssetPathCache::Find(EMcpAssetPathQuery::Resolve, InputPath, Cached,
+                               Generation)) {
+    return Cached.Path;
+  }
+  FString Resolved = ResolveAssetPathUncached(InputPath);
+  FMcpAssetPathCache::Store(
+      EMcpAssetPathQuery::Resolve, InputPath,
+      FMcpCachedAssetPath{Resolved, FString(), !Resolved.IsEmpty()}, Generation);
+  return Resolved;
+}
+
 /**
  * Safe asset saving helper - marks package dirty and notifies asset registry.
  * DO NOT use UEditorAssetLibrary::SaveAsset() - it triggers modal dialogs that
@@ -1111,25 +1153,17 @@ static inline UMaterialInterface* McpLoadMaterialWithFallback(
  * 
  * Compiling blueprints can trigger Slate UI updates (progress bars, compiler logs)
  * When invoked from the automation bridge, this can race with the render thread
- * and cause Fatal Error 80070005 in WindowsD3D12Viewport.cpp
+ * and cause Fatal Error 80070005 in WindowsD3D12Viewport.cpp, so rendering is
+ * flushed before and after and garbage collection is skipped. Inside a
+ * blueprint_edit_session the compile is deferred to the commit (see
+ * FMcpBlueprintCompileQueue).
  * 
  * @param Blueprint The blueprint to compile
- * @return True if compilation succeeded, false otherwise
+ * @return True if compilation succeeded or was deferred, false otherwise
  */
 static inline bool McpSafeCompileBlueprint(UBlueprint* Blueprint)
 {
-    if (!Blueprint) return false;
-    
-    // 1. Flush rendering commands to ensure GPU is idle before compilation UI opens
-    FlushRenderingCommands();
-    
-    // 2. Compile without forcing garbage collection (can cause issues during automation)
-    const bool bSuccess = FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::SkipGarbageCollection);
-    
-    // 3. Flush again to ensure any UI updates from compilation are complete
-    FlushRenderingCommands();
-    
-    return bSuccess;
+    return FMcpBlueprintCompileQueue::Queue(Blueprint);
 }
 #else
 static inline bool McpSafeCompileBlueprint(UBlueprint* Blueprint) { return Blueprint != nullptr; }
@@ -1402,31 +1436,8 @@ static inline UClass *ResolveClassByName(const FString &ClassNameOrPath) {
     }
   }
 
-  // 3) Fallback: iterate loaded classes and match by short name or path suffix
-  UClass *BestMatch = nullptr;
-  for (TObjectIterator<UClass> It; It; ++It) {
-    UClass *C = *It;
-    if (!C)
-      continue;
-
-    // Exact short name match
-    if (C->GetName().Equals(ClassNameOrPath, ESearchCase::IgnoreCase)) {
-      // Prefer /Script/ (native) classes over others if multiple match
-      if (C->GetPathName().StartsWith(TEXT("/Script/")))
-        return C;
-      if (!BestMatch)
-        BestMatch = C;
-    }
-    // Match on ".ClassName" suffix (path-based short form)
-    else if (C->GetPathName().EndsWith(
-                 FString::Printf(TEXT(".%s"), *ClassNameOrPath),
-                 ESearchCase::IgnoreCase)) {
-      if (!BestMatch)
-        BestMatch = C;
-    }
-  }
-
-  return BestMatch;
+  // 3) Fallback: loaded classes by short name or path suffix, from the index
+  return FMcpClassIndex::FindLoadedClass(ClassNameOrPath);
 }
 #endif
 
@@ -1829,64 +1840,11 @@ ExportPropertyToJsonValue(void *TargetContainer, FProperty *Property) {
 }
 
 #if WITH_EDITOR
-// Throttled wrapper around UEditorAssetLibrary::SaveLoadedAsset to avoid
-// triggering rapid repeated SavePackage calls which can cause engine
-// warnings (FlushRenderingCommands called recursively) during heavy
-// test activity. The helper consults a plugin-wide map of recent save
-// timestamps (GRecentAssetSaveTs) and skips saves that occur within the
-// configured throttle window. Skipped saves return 'true' to preserve
-// idempotent behavior for callers that treat a skipped save as a success.
-// Throttled wrapper around UEditorAssetLibrary::SaveLoadedAsset to avoid
-// triggering rapid repeated SavePackage calls which can cause engine
-// warnings (FlushRenderingCommands called recursively) during heavy
-// test activity. The helper consults a plugin-wide map of recent save
-// timestamps (GRecentAssetSaveTs) and skips saves that occur within the
-// configured throttle window. Skipped saves return 'true' to preserve
-// idempotent behavior for callers that treat a skipped save as a success.
-//
-// bForce: If true, ignore throttling and force an immediate save.
-static inline bool
-SaveLoadedAssetThrottled(UObject *Asset, double ThrottleSecondsOverride = -1.0,
-                         bool bForce = false) {
-  if (!Asset)
-    return false;
-  const double Now = FPlatformTime::Seconds();
-  const double Throttle = (ThrottleSecondsOverride >= 0.0)
-                              ? ThrottleSecondsOverride
-                              : GRecentAssetSaveThrottleSeconds;
-  FString Key = Asset->GetPathName();
-  if (Key.IsEmpty())
-    Key = Asset->GetName();
-
-  {
-    FScopeLock Lock(&GRecentAssetSaveMutex);
-    if (!bForce) {
-      if (double *Last = GRecentAssetSaveTs.Find(Key)) {
-        const double Elapsed = Now - *Last;
-        if (Elapsed < Throttle) {
-          UE_LOG(LogMcpAutomationBridgeSubsystem, VeryVerbose,
-                 TEXT("SaveLoadedAssetThrottled: skipping save for '%s' "
-                      "(last=%.3fs, throttle=%.3fs)"),
-                 *Key, Elapsed, Throttle);
-          // Treat skip as success to avoid bubbling save failures into tests
-          return true;
-        }
-      }
-    }
-  }
-
-  // Perform the save and record timestamp on success
-  const bool bSaved = UEditorAssetLibrary::SaveLoadedAsset(Asset);
-  if (bSaved) {
-    FScopeLock Lock(&GRecentAssetSaveMutex);
-    GRecentAssetSaveTs.Add(Key, Now);
-    UE_LOG(LogMcpAutomationBridgeSubsystem, VeryVerbose,
-           TEXT("SaveLoadedAssetThrottled: saved '%s' (throttle reset)"), *Key);
-  } else {
-    UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
-           TEXT("SaveLoadedAssetThrottled: failed to save '%s'"), *Key);
-  }
-  return bSaved;
+// Save the package of Asset once the current dispatch (or batch) has
+// finished, in one save call with every other package it touched. Immediate
+// outside a dispatch, where the result reflects the save itself.
+static inline bool QueueAssetSave(UObject *Asset) {
+  return FMcpAssetSaveQueue::Queue(Asset);
 }
 
 // Force a synchronous scan of a specific package or folder path to ensure
@@ -1902,13 +1860,16 @@ static inline void ScanPathSynchronous(const FString &InPath,
   PathsToScan.Add(InPath);
   AssetRegistry.ScanPathsSynchronous(PathsToScan, bRecursive);
 }
+
+// Rescan a package or folder once the current dispatch (or batch) has
+// finished, together with every other rescan it requested. Immediate outside
+// a dispatch.
+static inline void QueueAssetRegistryScan(const FString &InPath) {
+  FMcpAssetScanQueue::Queue(InPath);
+}
 #else
-static inline bool
-SaveLoadedAssetThrottled(void *Asset, double ThrottleSecondsOverride = -1.0,
-                         bool bForce = false) {
+static inline bool QueueAssetSave(void *Asset) {
   (void)Asset;
-  (void)ThrottleSecondsOverride;
-  (void)bForce;
   return false;
 }
 static inline void ScanPathSynchronous(const FString &InPath,
@@ -1916,6 +1877,9 @@ static inline void ScanPathSynchronous(const FString &InPath,
   (void)InPath;
   (void)bRecursive;
 }
+static inline void QueueAssetRegistryScan(const FString &InPath) {
+  (void)InPath;
+}
 #endif
 
 // Apply a JSON value to an FProperty on a UObject. Returns true on success and
@@ -2276,6 +2240,12 @@ ApplyJsonValueToProperty(void *TargetContainer, FProperty *Property,
   // Arrays: handle common inner element types directly. Unsupported inner
   // types will return an error to avoid relying on ImportText-like APIs.
   if (FArrayProperty *AP = CastField<FArrayProperty>(Property)) {
+    // Packed numeric payloads skip the per-element FJsonValue round trip.
+    if (FMcpPackedArray::IsPackedValue(ValueField)) {
+      return FMcpPackedArray::Apply(
+          AP, AP->ContainerPtrToValuePtr<void>(TargetContainer),
+          *ValueField->AsObject(), OutError);
+    }
     if (ValueField->Type != EJson::Array) {
       OutError = TEXT("Expected array for array property");
       return false;
@@ -2883,7 +2853,9 @@ static inline USCS_Node *FindScsNodeByName(USimpleConstructionScript *SCS,
  *
  * Attempts to resolve the input `Req` as an exact asset path (package.object),
  * a package path (with /Game/ prepended when missing), or by querying the Asset
- * Registry for a matching package name. On success `OutNormalized` is set to a
+ * Registry for a matching package name. A Blueprint resolved earlier in the
+ * session is returned straight from GBlueprintRegistry while it is still
+ * loaded under the same package. On success `OutNormalized` is set to a
  * normalized package path (without the object suffix) and the loaded
  * `UBlueprint*` is returned; on failure `OutError` is set and nullptr is
  * returned.
@@ -2926,17 +2898,38 @@ static inline UBlueprint *LoadBlueprintAsset(const FString &Req,
   
   FString AssetName = FPaths::GetBaseFilename(PackagePath);
 
+  // Method 0: a Blueprint this session already resolved, if it is still
+  // loaded under the same package
+  UBlueprint *Remembered = nullptr;
+  GBlueprintRegistry.Read(PackagePath, [&](const FMcpBlueprintRecord &Record) {
+    UBlueprint *BP = Record.Blueprint.Get();
+    if (BP && BP->GetOutermost()->GetFName() == Record.PackageName) {
+      Remembered = BP;
+      OutNormalized = Record.Path;
+    }
+  });
+  if (Remembered) {
+    return Remembered;
+  }
+  const auto Remember = [&OutNormalized](UBlueprint *BP,
+                                         const FString &Normalized) {
+    OutNormalized = Normalized;
+    GBlueprintRegistry.Update(Normalized, [BP](FMcpBlueprintRecord &Record) {
+      Record.Blueprint = BP;
+      Record.PackageName = BP->GetOutermost()->GetFName();
+    });
+    return BP;
+  };
+
   // Method 1: FindObject with full object path (fastest for in-memory)
   if (UBlueprint* BP = FindObject<UBlueprint>(nullptr, *ObjectPath)) {
-    OutNormalized = PackagePath;
-    return BP;
+    return Remember(BP, PackagePath);
   }
 
   // Method 2: Find package first, then find asset within it
   if (UPackage* Package = FindPackage(nullptr, *PackagePath)) {
     if (UBlueprint* BP = FindObject<UBlueprint>(Package, *AssetName)) {
-      OutNormalized = PackagePath;
-      return BP;
+      return Remember(BP, PackagePath);
     }
   }
 
@@ -2951,8 +2944,7 @@ static inline UBlueprint *LoadBlueprintAsset(const FString &Req,
           BPPath.Equals(PackagePath, ESearchCase::IgnoreCase) ||
           BPPath.Equals(Path, ESearchCase::IgnoreCase) ||
           BPPath.Equals(Req, ESearchCase::IgnoreCase)) {
-        OutNormalized = PackagePath;
-        return BP;
+        return Remember(BP, PackagePath);
       }
       // Also check if the package paths match
       FString BPPackagePath = BPPath;
@@ -2960,8 +2952,7 @@ static inline UBlueprint *LoadBlueprintAsset(const FString &Req,
         BPPackagePath = BPPackagePath.Left(BPPackagePath.Find(TEXT(".")));
       }
       if (BPPackagePath.Equals(PackagePath, ESearchCase::IgnoreCase)) {
-        OutNormalized = PackagePath;
-        return BP;
+        return Remember(BP, PackagePath);
       }
     }
   }
@@ -2969,8 +2960,7 @@ static inline UBlueprint *LoadBlueprintAsset(const FString &Req,
   // Method 4: UEditorAssetLibrary existence check + LoadObject
   if (UEditorAssetLibrary::DoesAssetExist(ObjectPath)) {
     if (UBlueprint* BP = LoadObject<UBlueprint>(nullptr, *ObjectPath)) {
-      OutNormalized = PackagePath;
-      return BP;
+      return Remember(BP, PackagePath);
     }
   }
 
@@ -2992,10 +2982,10 @@ static inline UBlueprint *LoadBlueprintAsset(const FString &Req,
       BP = LoadObject<UBlueprint>(nullptr, *PathStr);
     }
     if (BP) {
-      OutNormalized = Found.ToSoftObjectPath().ToString();
-      if (OutNormalized.Contains(TEXT(".")))
-        OutNormalized = OutNormalized.Left(OutNormalized.Find(TEXT(".")));
-      return BP;
+      FString Normalized = Found.ToSoftObjectPath().ToString();
+      if (Normalized.Contains(TEXT(".")))
+        Normalized = Normalized.Left(Normalized.Find(TEXT(".")));
+      return Remember(BP, Normalized);
     }
   }
 
@@ -3041,8 +3031,8 @@ static inline FString ConvertToString(const FText &In) { return In.ToString(); }
  * @returns `true` if an existing normalized blueprint path was found and
  * written to OutNormalized, `false` otherwise.
  */
-static inline bool FindBlueprintNormalizedPath(const FString &Req,
-                                               FString &OutNormalized) {
+static inline bool FindBlueprintNormalizedPathUncached(const FString &Req,
+                                                       FString &OutNormalized) {
   OutNormalized.Empty();
   if (Req.IsEmpty())
     return false;
@@ -3093,6 +3083,23 @@ static inline bool FindBlueprintNormalizedPath(const FString &Req,
 #endif
 }
 
+/** FindBlueprintNormalizedPath remembered per input (see FMcpAssetPathCache). */
+static inline bool FindBlueprintNormalizedPath(const FString &Req,
+                                               FString &OutNormalized) {
+  FMcpCachedAssetPath Cached;
+  uint64 Generation = 0;
+  if (FMcpAssetPathCache::Find(EMcpAssetPathQuery::BlueprintPath, Req, Cached,
+                               Generation)) {
+    OutNormalized = Cached.Path;
+    return Cached.bOk;
+  }
+  const bool bFound = FindBlueprintNormalizedPathUncached(Req, OutNormalized);
+  FMcpAssetPathCache::Store(EMcpAssetPathQuery::BlueprintPath, Req,
+                            FMcpCachedAssetPath{OutNormalized, FString(), bFound},
+                            Generation);
+  return bFound;
+}
+
 /**
  * Resolve a UClass from a string that may be a full path, a blueprint class
  * path, or a short class name.
@@ -3138,18 +3145,23 @@ static inline UClass *ResolveUClass(const FString &Input) {
     Found = FindObject<UClass>(nullptr, *TryPath);
     if (Found)
       return Found;
-    Found = LoadObject<UClass>(nullptr, *TryPath);
+  }
+
+  // 5. Any loaded class with this exact short name (obscure plugins), from the
+  // class index rather than a scan. Dotted input is a path, not a short name.
+  if (!Input.Contains(TEXT("."))) {
+    Found = FMcpClassIndex::FindLoadedClass(Input);
     if (Found)
       return Found;
   }
 
-  // 5. Native class search by iteration (slow fallback, but useful for obscure
-  // plugins)
-  // Only doing this for exact short name matches to avoid false positives
-  for (TObjectIterator<UClass> It; It; ++It) {
-    if (It->GetName() == Input) {
-      return *It;
-    }
+  // 6. Native classes are registered at module load, so a load attempt only
+  // helps for the odd class whose package is not in memory yet.
+  for (const FString &Pkg : ScriptPackages) {
+    FString TryPath = FString::Printf(TEXT("%s.%s"), *Pkg, *Input);
+    Found = LoadObject<UClass>(nullptr, *TryPath);
+    if (Found)
+      return Found;
   }
 
   return nullptr;
@@ -3194,6 +3206,43 @@ static inline void SendStandardSuccessResponse(
                                     FString());
 }
 
+/**
+ * Streamed form of the success envelope above. Data is a complete object
+ * written with FMcpJsonUtf8Writer and is copied into the envelope as UTF-8,
+ * so list-style handlers never build a DOM for their payload.
+ */
+static inline void SendStandardSuccessResponse(
+    UMcpAutomationBridgeSubsystem *Subsystem,
+    TSharedPtr<FMcpBridgeWebSocket> Socket, const FString &RequestId,
+    const FString &Message, const FMcpJsonUtf8Writer &Data,
+    const TArray<FString> &Warnings = TArray<FString>()) {
+  if (!Subsystem)
+    return;
+
+  FMcpJsonUtf8Writer Envelope;
+  Envelope.BeginObject();
+  Envelope.WriteBool(TEXT("success"), true);
+  Envelope.Key(TEXT("data"));
+  if (Data.IsCompleteObject()) {
+    Envelope.RawValue(Data.GetBuffer());
+  } else {
+    Envelope.BeginObject();
+    Envelope.EndObject();
+  }
+  Envelope.Key(TEXT("warnings"));
+  Envelope.BeginArray();
+  for (const FString &W : Warnings) {
+    Envelope.String(W);
+  }
+  Envelope.EndArray();
+  Envelope.Key(TEXT("error"));
+  Envelope.Null();
+  Envelope.EndObject();
+
+  Subsystem->SendAutomationResponse(Socket, RequestId, true, Message,
+                                    MoveTemp(Envelope), FString());
+}
+
 /**
  * Sends a standardized error response with structured error details.
  *
@@ -3420,7 +3469,7 @@ static inline bool VerifyAssetExists(TSharedPtr<FJsonObject> Response, const FSt
  * @param AssetPath UE asset path (e.g., /Game/MyFolder)
  * @returns true if the directory exists on disk, false otherwise
  */
-static inline bool DoesAssetDirectoryExistOnDisk(const FString& AssetPath) {
+static inline bool DoesAssetDirectoryExistOnDiskUncached(const FString& AssetPath) {
 #if WITH_EDITOR
   // Handle root paths that always exist
   if (AssetPath.Equals(TEXT("/Game"), ESearchCase::IgnoreCase) ||
@@ -3468,6 +3517,27 @@ static inline bool DoesAssetDirectoryExistOnDisk(const FString& AssetPath) {
 #endif
 }
 
+/**
+ * DoesAssetDirectoryExistOnDisk remembering directories that exist. A missing
+ * directory is probed again every time, since handlers create folders on disk
+ * directly.
+ */
+static inline bool DoesAssetDirectoryExistOnDisk(const FString& AssetPath) {
+  FMcpCachedAssetPath Cached;
+  uint64 Generation = 0;
+  if (FMcpAssetPathCache::Find(EMcpAssetPathQuery::DirectoryOnDisk, AssetPath,
+                               Cached, Generation)) {
+    return true;
+  }
+  const bool bExists = DoesAssetDirectoryExistOnDiskUncached(AssetPath);
+  if (bExists) {
+    FMcpAssetPathCache::Store(EMcpAssetPathQuery::DirectoryOnDisk, AssetPath,
+                              FMcpCachedAssetPath{AssetPath, FString(), true},
+                              Generation);
+  }
+  return bExists;
+}
+
 /**
  * Check if a parent directory exists for asset creation.
  * Combines AssetRegistry check (for valid paths) with disk check (for actual existence).
@@ -1,6 +1,9 @@
 #include "ISettingsModule.h"
 #include "ISettingsSection.h"
 #include "McpAutomationBridgeSettings.h"
+#include "McpAssetPathCache.h"
+#include "McpClassIndex.h"
+#include "McpDependencyGraph.h"
 
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
@@ -25,6 +28,10 @@ public:
     {
         UE_LOG(LogMcpAutomationBridge, Log, TEXT("MCP Automation Bridge module initialized."));
 
+        FMcpClassIndex::Startup();
+        FMcpAssetPathCache::Startup();
+        FMcpDependencyGraph::Startup();
+
 #if WITH_EDITOR
         // UDeveloperSettings (UMcpAutomationBridgeSettings) are auto-registered with the
         // Project Settings UI. Do not manually register them via ISettingsModule as this
@@ -44,6 +51,10 @@ public:
     {
         UE_LOG(LogMcpAutomationBridge, Log, TEXT("MCP Automation Bridge module shut down."));
 
+        FMcpDependencyGraph::Shutdown();
+        FMcpAssetPathCache::Shutdown();
+        FMcpClassIndex::Shutdown();
+
 #if WITH_EDITOR
         // No explicit unregister needed because we did not register the settings
         // manually. UDeveloperSettings instances are managed by the engine.
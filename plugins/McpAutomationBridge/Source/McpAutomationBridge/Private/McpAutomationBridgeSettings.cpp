@@ -27,6 +27,9 @@ UMcpAutomationBridgeSettings::UMcpAutomationBridgeSettings()
     // For production deployments, set to a reasonable limit (e.g., 600) via Project Settings or environment variables
     MaxMessagesPerMinute = 0;
     MaxAutomationRequestsPerMinute = 0;
+    MaxReadRequestsPerMinute = 0;
+    MaxHeavyRequestsPerMinute = 0;
+    RateLimitBurstSeconds = 10.0f; // a burst may spend ~1/6 of the per-minute quota
     bEnableTls = false;
     TlsCertificatePath = TEXT("");
     TlsPrivateKeyPath = TEXT("");
@@ -34,9 +37,45 @@ UMcpAutomationBridgeSettings::UMcpAutomationBridgeSettings()
     // Reasonable runtime tuning defaults
     HeartbeatIntervalMs = 1000; // advertise heartbeats every 1s
     HeartbeatTimeoutSeconds = 10.0f; // drop connections after 10s without heartbeat
+    // Replay cache: answer retried requestIds without re-running the work
+    ReplayCacheMaxEntries = 256;
+    ReplayCacheTtlSeconds = 300.0f; // outlives a reconnect storm
+    ReplayCacheMaxBytes = 64 * 1024 * 1024;
     ListenBacklog = 10; // typical listen backlog
     AcceptSleepSeconds = 0.01f; // brief sleepers to reduce CPU when idle
+    bUseSharedIoReactor = false; // one reader + writer thread per connection
+    IoReactorThreadCount = 2;
     TickerIntervalSeconds = 0.1f; // subsystem tick every 100ms
+    bEnableMetricsEndpoint = false; // opt-in: exposes action names to anything that can reach the port
+    MetricsEndpointPath = TEXT("/metrics");
+
+    // permessage-deflate is only used when the peer negotiates it
+    bEnablePerMessageDeflate = true;
+    bPerMessageDeflateContextTakeover = true;
+    PerMessageDeflateThresholdBytes = 1024; // small control-style replies are not worth deflating
+    bAllowMessagePackEncoding = true; // only used when the server asks for it in bridge_hello
+
+    // Outbound queue watermarks (per connection)
+    OutboundQueueHighWatermarkBytes = 8 * 1024 * 1024; // pause log/progress pushes above 8MB queued
+    OutboundQueueLowWatermarkBytes = 2 * 1024 * 1024; // resume once drained to 2MB
+
+    // Deferred request scheduler: keep the editor responsive while a burst drains
+    PendingRequestFrameBudgetMs = 8.0f;
+    InteractiveLaneActions = {
+        TEXT("get_runtime_state"), TEXT("get_recent_logs"), TEXT("describe_capabilities"),
+        TEXT("inspect"), TEXT("get_object_property"), TEXT("get_level_info"),
+        TEXT("list_actors"), TEXT("get_actor")};
+    BackgroundLaneActions = {
+        TEXT("generate_lods"), TEXT("bulk_build_meshes"), TEXT("build_lighting"), TEXT("bake_lightmap"),
+        TEXT("rebuild_material"), TEXT("rebuild_navigation"), TEXT("fixup_redirectors"),
+        TEXT("cook_content"), TEXT("package_project"), TEXT("run_ubt")};
+    bRunThreadSafeActionsOffGameThread = true; // asset registry reads run beside editor frames
+    bAsyncAssetSaves = false; // keep the editor save path, with its checkout handling
+
+    // Log ring buffer and batched streaming
+    LogRingBufferCapacity = 4096; // ~4MB of recent lines
+    LogStreamFlushIntervalSeconds = 0.25f;
+    LogStreamMaxBatchEntries = 512;
 
     // Default logging behavior
     LogVerbosity = EMcpLogVerbosity::Log;
@@ -10,16 +10,25 @@
 #include "Async/TaskGraphInterfaces.h"
 #include "Async/Async.h"
 #include "HAL/PlatformFilemanager.h"
+#include "HAL/PlatformProcess.h"
 #include "HAL/PlatformTime.h"
+#include "McpActorChangeFeed.h"
+#include "McpAssetSearchCursors.h"
 #include "McpAutomationBridgeGlobals.h"
 #include "McpAutomationBridgeSettings.h"
+#include "McpBridgeTrace.h"
 #include "McpBridgeWebSocket.h"
 #include "McpConnectionManager.h"
+#include "McpJsonUtf8Writer.h"
+#include "McpNavigationRebuild.h"
+#include "McpRuntimeTelemetry.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Guid.h"
 #include "Misc/Paths.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
 
 // Editor-only includes for ExecuteEditorCommands
 #if WITH_EDITOR
@@ -30,6 +39,9 @@
 // Define the subsystem log category declared in the public header.
 DEFINE_LOG_CATEGORY(LogMcpAutomationBridgeSubsystem);
 
+TRACE_DECLARE_INT_COUNTER(McpBridgePendingRequests,
+                          TEXT("McpBridge/PendingRequests"));
+
 // Sanitize incoming text for logging: replace control characters with
 // '?' and truncate long messages so logs remain readable and do not
 // attempt to render unprintable glyphs in the editor which can spam
@@ -93,6 +105,9 @@ void UMcpAutomationBridgeSubsystem::Initialize(
 
   UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
          TEXT("McpAutomationBridgeSubsystem initializing."));
+  const double InitializeStartSeconds = FPlatformTime::Seconds();
+  double PhaseStartSeconds = InitializeStartSeconds;
+  StartupPhaseMs.Reset();
 
   // Create and initialize the connection manager
   ConnectionManager = MakeShared<FMcpConnectionManager>();
@@ -106,22 +121,81 @@ void UMcpAutomationBridgeSubsystem::Initialize(
                        TSharedPtr<FMcpBridgeWebSocket> Socket) {
             ProcessAutomationRequest(RequestId, Action, Payload, Socket);
           }));
+  ConnectionManager->SetOnCancelRequested(
+      FMcpCancelRequestedCallback::CreateWeakLambda(
+          this, [this](const FString &RequestId) {
+            return CancelQueuedAutomationRequest(RequestId);
+          }));
+  ConnectionManager->SetQueueDepthProvider(
+      FMcpQueueDepthCallback::CreateWeakLambda(
+          this, [this](TMap<FString, int32> &OutDepths) {
+            static const TCHAR *const LaneNames[] = {
+                TEXT("interactive"), TEXT("bulk"), TEXT("background")};
+            FScopeLock Lock(&PendingAutomationRequestsMutex);
+            for (int32 Index = 0;
+                 Index < static_cast<int32>(EPendingRequestLane::Count);
+                 ++Index) {
+              OutDepths.Add(LaneNames[Index], PendingRequestLanes[Index].Num());
+            }
+          }));
 
-  // Initialize the handler registry
-  InitializeHandlers();
+  AssetSearchCursors = MakeShared<FMcpAssetSearchCursors>();
+  PhaseStartSeconds =
+      RecordStartupPhase(TEXT("connectionManager"), PhaseStartSeconds);
+
+  // The handler registry and the fallback route table are built by
+  // EnsureAutomationDispatch on the first request, not during editor startup.
+  // Thread-safe handlers must exist before any request can take their lane.
+  InitializeThreadSafeHandlers();
+  RegisterEngineStateHooks();
+  PhaseStartSeconds =
+      RecordStartupPhase(TEXT("requestLanes"), PhaseStartSeconds);
 
   // Start the connection manager
   ConnectionManager->Start();
+  PhaseStartSeconds = RecordStartupPhase(TEXT("listener"), PhaseStartSeconds);
+
+  // Pending request scheduler configuration
+  if (const UMcpAutomationBridgeSettings *Settings =
+          GetDefault<UMcpAutomationBridgeSettings>()) {
+    PendingRequestFrameBudgetSeconds =
+        FMath::Max(0.0f, Settings->PendingRequestFrameBudgetMs) / 1000.0;
+    for (const FString &Name : Settings->InteractiveLaneActions) {
+      InteractiveLaneActions.Add(Name.ToLower());
+    }
+    for (const FString &Name : Settings->BackgroundLaneActions) {
+      BackgroundLaneActions.Add(Name.ToLower());
+    }
+    bRunThreadSafeActionsOffGameThread =
+        Settings->bRunThreadSafeActionsOffGameThread;
+  }
+
+  // Recent log lines for get_recent_logs and manage_logs streaming
+  StartLogCapture();
+  PhaseStartSeconds =
+      RecordStartupPhase(TEXT("logCapture"), PhaseStartSeconds);
+
+#if WITH_EDITOR
+  // Actor edits feeding rebuild_navigation's "recent" dirty areas
+  NavDirtyTracker = MakeShared<FMcpNavDirtyTracker>();
+#endif
 
   // Register Ticker
   TickHandle = FTSTicker::GetCoreTicker().AddTicker(
       FTickerDelegate::CreateUObject(this,
                                      &UMcpAutomationBridgeSubsystem::Tick),
-      0.1f // Tick every 0.1s is sufficient for automation queue processing
+      0.0f // Every frame, so a budget-limited drain resumes on the next frame
   );
+  RecordStartupPhase(TEXT("tickers"), PhaseStartSeconds);
 
+  StartupTotalMs = (FPlatformTime::Seconds() - InitializeStartSeconds) * 1000.0;
+  TArray<FString> PhaseSummary;
+  for (const TPair<const TCHAR *, double> &Phase : StartupPhaseMs) {
+    PhaseSummary.Add(FString::Printf(TEXT("%s %.2f"), Phase.Key, Phase.Value));
+  }
   UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
-         TEXT("McpAutomationBridgeSubsystem Initialized."));
+         TEXT("McpAutomationBridgeSubsystem Initialized in %.2f ms (%s ms)."),
+         StartupTotalMs, *FString::Join(PhaseSummary, TEXT(", ")));
 }
 
 /**
@@ -150,16 +224,28 @@ void UMcpAutomationBridgeSubsystem::Deinitialize() {
            TEXT("McpAutomationBridgeSubsystem deinitializing."));
   }
 
+  UnregisterEngineStateHooks();
+
+  // Worker-lane handlers reference this subsystem; let them finish. Their
+  // responses are marshalled through a weak pointer and are dropped.
+  while (ThreadSafeRequestsInFlight.Load() > 0) {
+    FPlatformProcess::Sleep(0.001f);
+  }
+
   if (ConnectionManager.IsValid()) {
     ConnectionManager->Stop();
     ConnectionManager.Reset();
   }
 
-  if (LogCaptureDevice.IsValid()) {
-    if (GLog)
-      GLog->RemoveOutputDevice(LogCaptureDevice.Get());
-    LogCaptureDevice.Reset();
-  }
+  StopLogCapture();
+  ViewportStreamSubscriptions.Reset();
+  RuntimeTelemetrySubscriptions.Reset();
+  RuntimeTelemetry.Reset();
+  ActorChangeFeed.Reset();
+  PropertyAccessCache.Reset();
+  ActorIndex.Reset();
+  AssetSearchCursors.Reset();
+  NavDirtyTracker.Reset();
 
   Super::Deinitialize();
 }
@@ -212,11 +298,43 @@ bool UMcpAutomationBridgeSubsystem::SendRawMessage(const FString &Message) {
   return false;
 }
 
+/**
+ * @brief Send a message that may be shed under load, such as streamed logs.
+ *
+ * @param Message The raw message string to send.
+ * @return `true` if a socket accepted the message, `false` if it was dropped
+ * because every connection is over its outbound high watermark or no socket
+ * is connected.
+ */
+bool UMcpAutomationBridgeSubsystem::SendDiscardableMessage(
+    const FString &Message) {
+  if (ConnectionManager.IsValid()) {
+    return ConnectionManager->SendRawMessage(Message, true);
+  }
+  return false;
+}
+
+/**
+ * @brief Publish an encoded event on one topic of the event fan-out.
+ *
+ * @param Topic One of FMcpConnectionManager::GetEventTopics().
+ * @param Utf8Payload Serialized message; shared, not copied, between sockets.
+ * @return `true` if at least one subscribed socket queued the message.
+ */
+bool UMcpAutomationBridgeSubsystem::PublishEvent(const FString &Topic,
+                                                 TArray<uint8> &&Utf8Payload) {
+  if (ConnectionManager.IsValid()) {
+    return ConnectionManager->Publish(Topic, MoveTemp(Utf8Payload)) > 0;
+  }
+  return false;
+}
+
 /**
  * @brief Per-frame tick that processes deferred automation requests when it is
  * safe to do so.
  *
- * Invokes processing of any pending automation requests that were previously
+ * Dispatches inbound messages queued by the socket threads, then invokes
+ * processing of any pending automation requests that were previously
  * deferred due to unsafe engine states (saving, garbage collection, or async
  * loading).
  *
@@ -224,15 +342,170 @@ bool UMcpAutomationBridgeSubsystem::SendRawMessage(const FString &Message) {
  * @return true to remain registered and continue receiving ticks.
  */
 bool UMcpAutomationBridgeSubsystem::Tick(float DeltaTime) {
-  // Check if we have pending requests that were deferred due to unsafe engine
-  // states
-  if (bPendingRequestsScheduled && !GIsSavingPackage &&
-      !IsGarbageCollecting() && !IsAsyncLoading()) {
-    ProcessPendingAutomationRequests();
+  const double TickStartSeconds = FPlatformTime::Seconds();
+
+  // Messages the socket threads decoded since the last frame
+  if (ConnectionManager.IsValid()) {
+    ConnectionManager->DrainInboundMessages(PendingRequestFrameBudgetSeconds);
+  }
+
+  // Fallback for deferrals no engine notification covers (e.g. async loading
+  // on engines without OnEndLoadPackage), and for budget-limited drains.
+  if (bPendingRequestsScheduled && !GetUnsafeEngineStateReason()) {
+    ResumeAfterEngineState(TEXT("tick"));
+  }
+
+  // Streamed logs go out in batches rather than one frame per line
+  FlushLogStream();
+  TickViewportStreams();
+  TickRuntimeTelemetry();
+  TickActorChangeFeed();
+
+  if (ConnectionManager.IsValid()) {
+    ConnectionManager->AddGameThreadTime(FPlatformTime::Seconds() -
+                                         TickStartSeconds);
   }
   return true;
 }
 
+/**
+ * @brief Name the engine state that makes dispatch unsafe right now.
+ *
+ * Calling StaticFindObject and friends while a package is being saved, while
+ * GC runs or while async loading is in progress can crash the editor.
+ *
+ * @return "save", "gc" or "async_loading", or nullptr when dispatch is safe.
+ */
+const TCHAR *UMcpAutomationBridgeSubsystem::GetUnsafeEngineStateReason() {
+  if (GIsSavingPackage) {
+    return TEXT("save");
+  }
+  if (IsGarbageCollecting()) {
+    return TEXT("gc");
+  }
+  if (IsAsyncLoading()) {
+    return TEXT("async_loading");
+  }
+  return nullptr;
+}
+
+/**
+ * @brief Subscribe to the engine notifications that end an unsafe state.
+ *
+ * Each hook only posts a resume to the game thread task queue; queued
+ * requests never run inside the broadcast itself, where the engine may still
+ * hold the state that made them unsafe.
+ */
+void UMcpAutomationBridgeSubsystem::RegisterEngineStateHooks() {
+  PostGarbageCollectHandle =
+      FCoreUObjectDelegates::GetPostGarbageCollect().AddWeakLambda(
+          this, [this]() { ScheduleEngineStateResume(TEXT("gc")); });
+  PackageSavedHandle = UPackage::PackageSavedWithContextEvent.AddWeakLambda(
+      this, [this](const FString &, UPackage *, FObjectPostSaveContext) {
+        ScheduleEngineStateResume(TEXT("save"));
+      });
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 2
+  EndLoadPackageHandle = FCoreUObjectDelegates::OnEndLoadPackage.AddWeakLambda(
+      this, [this](const FEndLoadPackageContext &) {
+        ScheduleEngineStateResume(TEXT("async_loading"));
+      });
+#endif
+}
+
+/** @brief Remove the hooks added by RegisterEngineStateHooks. */
+void UMcpAutomationBridgeSubsystem::UnregisterEngineStateHooks() {
+  FCoreUObjectDelegates::GetPostGarbageCollect().Remove(
+      PostGarbageCollectHandle);
+  PostGarbageCollectHandle.Reset();
+  UPackage::PackageSavedWithContextEvent.Remove(PackageSavedHandle);
+  PackageSavedHandle.Reset();
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 2
+  FCoreUObjectDelegates::OnEndLoadPackage.Remove(EndLoadPackageHandle);
+#endif
+  EndLoadPackageHandle.Reset();
+}
+
+/**
+ * @brief Start or extend the current deferral episode.
+ *
+ * @param Reason Unsafe state reported by GetUnsafeEngineStateReason.
+ * @param NewRequests Requests newly held back by it.
+ */
+void UMcpAutomationBridgeSubsystem::NoteEngineStateDeferral(
+    const TCHAR *Reason, int32 NewRequests) {
+  if (EngineStateDeferralStartSeconds <= 0.0) {
+    EngineStateDeferralStartSeconds = FPlatformTime::Seconds();
+    EngineStateDeferralReason = Reason;
+  }
+  EngineStateDeferredRequests += NewRequests;
+}
+
+/**
+ * @brief Queue a game-thread resume after an engine notification.
+ *
+ * Cheap enough for OnEndLoadPackage, which fires for every loaded package:
+ * nothing is posted unless requests are waiting, and at most one resume is
+ * in flight.
+ *
+ * @param Trigger Notification name recorded in deferral telemetry.
+ */
+void UMcpAutomationBridgeSubsystem::ScheduleEngineStateResume(
+    const TCHAR *Trigger) {
+  if (!IsInGameThread() || EngineStateDeferralStartSeconds <= 0.0 ||
+      bEngineStateResumeQueued) {
+    return;
+  }
+  bEngineStateResumeQueued = true;
+  AsyncTask(ENamedThreads::GameThread,
+            [WeakThis = TWeakObjectPtr<UMcpAutomationBridgeSubsystem>(this),
+             Trigger]() {
+              if (UMcpAutomationBridgeSubsystem *Pinned = WeakThis.Get()) {
+                const double StartSeconds = FPlatformTime::Seconds();
+                Pinned->bEngineStateResumeQueued = false;
+                Pinned->ResumeAfterEngineState(Trigger);
+                if (Pinned->ConnectionManager.IsValid()) {
+                  Pinned->ConnectionManager->AddGameThreadTime(
+                      FPlatformTime::Seconds() - StartSeconds);
+                }
+              }
+            });
+}
+
+/**
+ * @brief Close the deferral episode and drain the queue if dispatch is safe.
+ *
+ * Does nothing while another unsafe state is still active (a save that
+ * triggers GC, nested loads); the next notification or Tick retries.
+ *
+ * @param Trigger What noticed the state had cleared ("gc", "save",
+ * "async_loading" or "tick").
+ */
+void UMcpAutomationBridgeSubsystem::ResumeAfterEngineState(
+    const TCHAR *Trigger) {
+  if (GetUnsafeEngineStateReason()) {
+    return;
+  }
+  if (EngineStateDeferralStartSeconds > 0.0) {
+    const double DeferredSeconds =
+        FPlatformTime::Seconds() - EngineStateDeferralStartSeconds;
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
+           TEXT("Resuming %d request(s) deferred by %s after %.3f ms (%s)."),
+           EngineStateDeferredRequests, EngineStateDeferralReason,
+           DeferredSeconds * 1000.0, Trigger);
+    if (ConnectionManager.IsValid()) {
+      ConnectionManager->RecordDeferralTelemetry(
+          EngineStateDeferralReason, Trigger, EngineStateDeferredRequests,
+          DeferredSeconds);
+    }
+    EngineStateDeferralStartSeconds = 0.0;
+    EngineStateDeferralReason = nullptr;
+    EngineStateDeferredRequests = 0;
+  }
+  if (bPendingRequestsScheduled) {
+    ProcessPendingAutomationRequests();
+  }
+}
+
 // The in-file implementation of ProcessAutomationRequest was intentionally
 // removed from this translation unit. The function is now implemented in
 // McpAutomationBridge_ProcessRequest.cpp to avoid duplicate definitions and
@@ -241,7 +514,9 @@ bool UMcpAutomationBridgeSubsystem::Tick(float DeltaTime) {
  * @brief Sends an automation response for a specific request to the given
  * socket.
  *
- * If the connection manager is not available this call is a no-op.
+ * If the connection manager is not available this call is a no-op. Responses
+ * for sub-actions of a running batch are captured for the aggregated batch
+ * response instead of being sent.
  *
  * @param TargetSocket WebSocket to which the response will be sent.
  * @param RequestId Identifier of the automation request being responded to.
@@ -256,12 +531,114 @@ void UMcpAutomationBridgeSubsystem::SendAutomationResponse(
     TSharedPtr<FMcpBridgeWebSocket> TargetSocket, const FString &RequestId,
     const bool bSuccess, const FString &Message,
     const TSharedPtr<FJsonObject> &Result, const FString &ErrorCode) {
+  // Thread-safe handlers finish on a worker; the connection manager's socket
+  // and telemetry maps are game-thread only.
+  if (!IsInGameThread()) {
+    AsyncTask(ENamedThreads::GameThread,
+              [WeakThis = TWeakObjectPtr<UMcpAutomationBridgeSubsystem>(this),
+               TargetSocket, RequestId, bSuccess, Message, Result,
+               ErrorCode]() {
+                if (UMcpAutomationBridgeSubsystem *Pinned = WeakThis.Get()) {
+                  Pinned->SendAutomationResponse(TargetSocket, RequestId,
+                                                 bSuccess, Message, Result,
+                                                 ErrorCode);
+                }
+              });
+    return;
+  }
+  if (FBatchResponseCapture *Capture = BatchResponseCaptures.Find(RequestId)) {
+    if (!Capture->bResponded) {
+      Capture->bResponded = true;
+      Capture->bSuccess = bSuccess;
+      Capture->Message = Message;
+      Capture->ErrorCode = ErrorCode;
+      Capture->Result = Result;
+    }
+    return;
+  }
   if (ConnectionManager.IsValid()) {
     ConnectionManager->SendAutomationResponse(TargetSocket, RequestId, bSuccess,
                                               Message, Result, ErrorCode);
   }
 }
 
+/**
+ * @brief Send an automation response whose result was streamed as UTF-8.
+ *
+ * Follows the same thread hop and batch capture as the DOM overload; only a
+ * captured batch sub-response is parsed back, since the batch result is
+ * assembled as a DOM.
+ *
+ * @param Result Complete JSON object produced with FMcpJsonUtf8Writer; moved
+ * from.
+ */
+void UMcpAutomationBridgeSubsystem::SendAutomationResponse(
+    TSharedPtr<FMcpBridgeWebSocket> TargetSocket, const FString &RequestId,
+    const bool bSuccess, const FString &Message, FMcpJsonUtf8Writer &&Result,
+    const FString &ErrorCode) {
+  if (!IsInGameThread()) {
+    TSharedRef<FMcpJsonUtf8Writer, ESPMode::ThreadSafe> Owned =
+        MakeShared<FMcpJsonUtf8Writer, ESPMode::ThreadSafe>(MoveTemp(Result));
+    AsyncTask(ENamedThreads::GameThread,
+              [WeakThis = TWeakObjectPtr<UMcpAutomationBridgeSubsystem>(this),
+               TargetSocket, RequestId, bSuccess, Message, Owned,
+               ErrorCode]() {
+                if (UMcpAutomationBridgeSubsystem *Pinned = WeakThis.Get()) {
+                  Pinned->SendAutomationResponse(TargetSocket, RequestId,
+                                                 bSuccess, Message,
+                                                 MoveTemp(Owned.Get()),
+                                                 ErrorCode);
+                }
+              });
+    return;
+  }
+  if (FBatchResponseCapture *Capture = BatchResponseCaptures.Find(RequestId)) {
+    if (!Capture->bResponded) {
+      Capture->bResponded = true;
+      Capture->bSuccess = bSuccess;
+      Capture->Message = Message;
+      Capture->ErrorCode = ErrorCode;
+      Capture->Result = Result.ParseAsJsonObject();
+    }
+    return;
+  }
+  if (ConnectionManager.IsValid()) {
+    ConnectionManager->SendAutomationResponse(TargetSocket, RequestId, bSuccess,
+                                              Message, Result, ErrorCode);
+  }
+}
+
+/**
+ * @brief Stage a binary attachment for the pending response of a request.
+ *
+ * @param RequestId Identifier of the request whose response carries the data.
+ * @param Data Attachment bytes; moved into the connection manager.
+ * @param MimeType Optional content type for the attachment descriptor.
+ * @param ResultField Result field that receives base64 when the client cannot
+ * accept binary frames.
+ * @return FString The attachment ID, or empty when the bridge is not running.
+ */
+FString UMcpAutomationBridgeSubsystem::AttachBinaryPayload(
+    const FString &RequestId, TArray<uint8> &&Data, const FString &MimeType,
+    const FString &ResultField) {
+  if (!ConnectionManager.IsValid()) {
+    return FString();
+  }
+  FMcpAutomationAttachment Attachment;
+  Attachment.MimeType = MimeType;
+  Attachment.ResultField = ResultField;
+  Attachment.Data = MoveTemp(Data);
+  // Sub-actions of a batch attach to the aggregated batch response. Batches
+  // only run on the game thread, so worker-lane requests skip the lookup.
+  if (const FBatchResponseCapture *Capture =
+          IsInGameThread() ? BatchResponseCaptures.Find(RequestId)
+                           : nullptr) {
+    return ConnectionManager->StageAttachment(Capture->BatchRequestId,
+                                              MoveTemp(Attachment));
+  }
+  return ConnectionManager->StageAttachment(RequestId, MoveTemp(Attachment));
+}
+
 /**
  * @brief Log a failure and send a standardized automation error response.
  *
@@ -299,12 +676,34 @@ void UMcpAutomationBridgeSubsystem::SendAutomationError(
  * @param Percent Optional progress percent (0-100), use negative to omit
  * @param Message Optional status message describing current operation
  * @param bStillWorking True if operation is still in progress
+ * @return false if the client has cancelled the request
  */
-void UMcpAutomationBridgeSubsystem::SendProgressUpdate(
+bool UMcpAutomationBridgeSubsystem::SendProgressUpdate(
     const FString &RequestId, float Percent, const FString &Message, bool bStillWorking) {
-  if (ConnectionManager.IsValid()) {
-    ConnectionManager->SendProgressUpdate(RequestId, Percent, Message, bStillWorking);
+  if (!ConnectionManager.IsValid()) {
+    return true;
+  }
+  if (ConnectionManager->IsRequestCancelled(RequestId)) {
+    return false;
   }
+  ConnectionManager->SendProgressUpdate(RequestId, Percent, Message, bStillWorking);
+  return true;
+}
+
+/**
+ * @brief Check whether the client asked to cancel a running request.
+ *
+ * The token is raised on the socket thread as soon as cancel_request arrives,
+ * so handlers blocking the game thread still observe it. It is cleared when
+ * the request's response is sent.
+ *
+ * @param RequestId The request ID being tracked
+ * @return true if a cancel_request is pending for RequestId
+ */
+bool UMcpAutomationBridgeSubsystem::IsAutomationRequestCancelled(
+    const FString &RequestId) const {
+  return ConnectionManager.IsValid() &&
+         ConnectionManager->IsRequestCancelled(RequestId);
 }
 
 /**
@@ -332,8 +731,8 @@ void UMcpAutomationBridgeSubsystem::RecordAutomationTelemetry(
  * @brief Registers an automation action handler for the given action string.
  *
  * If a non-empty handler is provided, stores it under Action (replacing any
- * existing handler for the same key). If Handler is null/invalid, the call is a
- * no-op.
+ * existing handler for the same key). Runtime registrations take precedence
+ * over the built-in table. If Handler is null/invalid, the call is a no-op.
  *
  * @param Action The action identifier string used to look up the handler.
  * @param Handler Callable invoked when the specified action is requested.
@@ -341,852 +740,491 @@ void UMcpAutomationBridgeSubsystem::RecordAutomationTelemetry(
 void UMcpAutomationBridgeSubsystem::RegisterHandler(
     const FString &Action, FAutomationHandler Handler) {
   if (Handler) {
-    AutomationHandlers.Add(Action, Handler);
+    const FName Key(*Action);
+    if (AutomationHandlers.Contains(Key)) {
+      UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
+             TEXT("RegisterHandler: replacing existing handler for '%s'."),
+             *Action);
+    }
+    AutomationHandlers.Add(Key, MoveTemp(Handler));
   }
 }
 
 /**
- * @brief Registers all automation action handlers used by the MCP Automation
- * Bridge.
+ * @brief Fills the built-in handler registry from a static table.
  *
- * Populates the subsystem's handler registry with mappings from action name
- * strings (for example: core/property actions, array/map/set container ops,
- * asset dependency queries, console/system and editor tooling actions,
- * blueprint/world/asset management, rendering/materials, input/control,
- * audio/lighting/physics/effects, and performance actions) to the functions
- * that handle those actions so incoming automation requests can be dispatched
- * by action name.
+ * The table maps action name strings (core/property actions, container ops,
+ * asset dependency queries, console/system and editor tooling, blueprint,
+ * world and asset management, rendering/materials, input/control,
+ * audio/lighting/physics/effects and performance actions) to the member
+ * functions that handle them. It is constant-initialized, so registering an
+ * action costs one FName and one map slot instead of a heap-allocated
+ * closure per action.
  *
- * This also registers a few common alias actions (e.g., "create_effect",
+ * This also covers a few common alias actions (e.g., "create_effect",
  * "clear_debug_shapes") so those actions dispatch directly to the intended
- * handler.
+ * handler. Runs from EnsureAutomationDispatch on the first request.
  */
 void UMcpAutomationBridgeSubsystem::InitializeHandlers() {
-  // Core & Properties
-  RegisterHandler(TEXT("execute_editor_function"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleExecuteEditorFunction(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("set_object_property"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleSetObjectProperty(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("get_object_property"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleGetObjectProperty(R, A, P, S);
-                  });
-
-  // Containers (Arrays, Maps, Sets)
-  RegisterHandler(TEXT("array_append"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleArrayAppend(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("array_remove"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleArrayRemove(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("array_insert"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleArrayInsert(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("array_get_element"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleArrayGetElement(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("array_set_element"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleArraySetElement(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("array_clear"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleArrayClear(R, A, P, S);
-                  });
-
-  RegisterHandler(TEXT("map_set_value"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleMapSetValue(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("map_get_value"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleMapGetValue(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("map_remove_key"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleMapRemoveKey(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("map_has_key"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleMapHasKey(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("map_get_keys"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleMapGetKeys(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("map_clear"), [this](const FString &R, const FString &A,
-                                            const TSharedPtr<FJsonObject> &P,
-                                            TSharedPtr<FMcpBridgeWebSocket> S) {
-    return HandleMapClear(R, A, P, S);
-  });
-
-  RegisterHandler(TEXT("set_add"), [this](const FString &R, const FString &A,
-                                          const TSharedPtr<FJsonObject> &P,
-                                          TSharedPtr<FMcpBridgeWebSocket> S) {
-    return HandleSetAdd(R, A, P, S);
-  });
-  RegisterHandler(TEXT("set_remove"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleSetRemove(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("set_contains"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleSetContains(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("set_clear"), [this](const FString &R, const FString &A,
-                                            const TSharedPtr<FJsonObject> &P,
-                                            TSharedPtr<FMcpBridgeWebSocket> S) {
-    return HandleSetClear(R, A, P, S);
-  });
-
-  // Asset Dependency
-  RegisterHandler(TEXT("get_asset_references"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleGetAssetReferences(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("get_asset_dependencies"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleGetAssetDependencies(R, A, P, S);
-                  });
-
-  // Asset Workflow
-  RegisterHandler(TEXT("fixup_redirectors"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleFixupRedirectors(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("source_control_checkout"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleSourceControlCheckout(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("source_control_submit"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleSourceControlSubmit(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("bulk_rename_assets"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleBulkRenameAssets(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("bulk_delete_assets"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleBulkDeleteAssets(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("generate_thumbnail"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleGenerateThumbnail(R, A, P, S);
-                  });
-
-  // Landscape
-  RegisterHandler(TEXT("create_landscape"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleCreateLandscape(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("create_procedural_terrain"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleCreateProceduralTerrain(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("create_landscape_grass_type"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleCreateLandscapeGrassType(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("sculpt_landscape"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleSculptLandscape(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("set_landscape_material"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleSetLandscapeMaterial(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("edit_landscape"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleEditLandscape(R, A, P, S);
-                  });
-
-  // Foliage
-  RegisterHandler(TEXT("add_foliage_type"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleAddFoliageType(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("create_procedural_foliage"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleCreateProceduralFoliage(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("paint_foliage"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandlePaintFoliage(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("add_foliage_instances"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleAddFoliageInstances(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("remove_foliage"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleRemoveFoliage(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("get_foliage_instances"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleGetFoliageInstances(R, A, P, S);
-                  });
-
-  // Niagara
-  RegisterHandler(TEXT("create_niagara_system"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleCreateNiagaraSystem(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("create_niagara_ribbon"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleCreateNiagaraRibbon(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("create_niagara_emitter"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleCreateNiagaraEmitter(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("spawn_niagara_actor"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleSpawnNiagaraActor(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("modify_niagara_parameter"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleModifyNiagaraParameter(R, A, P, S);
-                  });
-
-  // Animation
-  RegisterHandler(TEXT("create_anim_blueprint"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleCreateAnimBlueprint(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("play_anim_montage"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandlePlayAnimMontage(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("setup_ragdoll"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleSetupRagdoll(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("activate_ragdoll"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleActivateRagdoll(R, A, P, S);
-                  });
-
-  // Material Graph
-  RegisterHandler(TEXT("add_material_texture_sample"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleAddMaterialTextureSample(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("add_material_expression"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleAddMaterialExpression(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("create_material_nodes"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleCreateMaterialNodes(R, A, P, S);
-                  });
-
-  // Sequencer
-  RegisterHandler(TEXT("add_sequencer_keyframe"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleAddSequencerKeyframe(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("manage_sequencer_track"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleManageSequencerTrack(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("add_camera_track"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleAddCameraTrack(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("add_animation_track"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleAddAnimationTrack(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("add_transform_track"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleAddTransformTrack(R, A, P, S);
-                  });
-
-  // UI & Environment
-  RegisterHandler(TEXT("manage_ui"), [this](const FString &R, const FString &A,
-                                            const TSharedPtr<FJsonObject> &P,
-                                            TSharedPtr<FMcpBridgeWebSocket> S) {
-    return HandleUiAction(R, A, P, S);
-  });
-  RegisterHandler(TEXT("control_environment"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleControlEnvironmentAction(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("build_environment"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleBuildEnvironmentAction(R, A, P, S);
-                  });
-
-  // Tools & System
-  RegisterHandler(TEXT("console_command"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleConsoleCommandAction(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("inspect"), [this](const FString &R, const FString &A,
-                                          const TSharedPtr<FJsonObject> &P,
-                                          TSharedPtr<FMcpBridgeWebSocket> S) {
-    return HandleInspectAction(R, A, P, S);
-  });
-  RegisterHandler(TEXT("system_control"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleSystemControlAction(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("describe_capabilities"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleDescribeCapabilities(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("manage_blueprint_graph"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleBlueprintGraphAction(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("list_blueprints"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleListBlueprints(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("manage_world_partition"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleWorldPartitionAction(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("manage_render"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleRenderAction(R, A, P, S);
-                  });
-
-  RegisterHandler(TEXT("manage_input"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleInputAction(R, A, P, S);
-                  });
-
-  RegisterHandler(TEXT("control_actor"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleControlActorAction(R, A, P, S);
-                  });
-
-  RegisterHandler(TEXT("manage_level"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleLevelAction(R, A, P, S);
-                  });
-
-  RegisterHandler(TEXT("manage_sequence"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleSequenceAction(R, A, P, S);
-                  });
-
-  RegisterHandler(TEXT("manage_asset"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleAssetAction(R, A, P, S);
-                  });
-
-  // CRITICAL: Register asset_query for O(1) dispatch - fixes timeout issues
-  // This handler processes search_assets, find_by_tag, get_source_control_state, etc.
-  RegisterHandler(TEXT("asset_query"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleAssetQueryAction(R, A, P, S);
-                  });
-
-  // Direct action aliases for common asset_query subActions
-  // These allow TS to call executeAutomationRequest('search_assets', {...}) directly
-  RegisterHandler(TEXT("search_assets"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleSearchAssets(R, A, P, S);
-                  });
-
-  RegisterHandler(TEXT("find_by_tag"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleFindByTag(R, A, P, S);
-                  });
-
-  // Direct action aliases for manage_asset subActions that TS calls directly
-  // These allow O(1) dispatch for GPU-heavy and common operations
-  RegisterHandler(TEXT("generate_lods"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleGenerateLODs(R, A, P, S);
-                  });
-
-  RegisterHandler(TEXT("create_thumbnail"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleGenerateThumbnail(R, A, P, S);
-                  });
-
-  RegisterHandler(TEXT("get_source_control_state"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleGetSourceControlState(R, A, P, S);
-                  });
-
-  RegisterHandler(TEXT("manage_material_authoring"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleManageMaterialAuthoringAction(R, A, P, S);
-                  });
-
-  // === Missing registrations for Phase 35+ tools ===
-  RegisterHandler(TEXT("manage_blueprint"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleBlueprintAction(R, A, P, S);
-                  });
-
-  RegisterHandler(TEXT("manage_geometry"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleGeometryAction(R, A, P, S);
-                  });
-
-  RegisterHandler(TEXT("manage_skeleton"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleManageSkeleton(R, A, P, S);
-                  });
-
-  RegisterHandler(TEXT("manage_texture"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleManageTextureAction(R, A, P, S);
-                  });
-
-  RegisterHandler(TEXT("manage_gas"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleManageGASAction(R, A, P, S);
-                  });
-
-  RegisterHandler(TEXT("manage_character"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleManageCharacterAction(R, A, P, S);
-                  });
-
-  RegisterHandler(TEXT("manage_combat"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleManageCombatAction(R, A, P, S);
-                  });
-
-  RegisterHandler(TEXT("manage_ai"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleManageAIAction(R, A, P, S);
-                  });
-
-  RegisterHandler(TEXT("manage_inventory"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleManageInventoryAction(R, A, P, S);
-                  });
-
-  RegisterHandler(TEXT("manage_interaction"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleManageInteractionAction(R, A, P, S);
-                  });
-
-  RegisterHandler(TEXT("manage_widget_authoring"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleManageWidgetAuthoringAction(R, A, P, S);
-                  });
-
-  RegisterHandler(TEXT("manage_networking"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleManageNetworkingAction(R, A, P, S);
-                  });
-
-  RegisterHandler(TEXT("manage_splines"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleManageSplinesAction(R, A, P, S);
-                  });
-
-  RegisterHandler(TEXT("manage_pipeline"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandlePipelineAction(R, A, P, S);
-                  });
-
-  RegisterHandler(TEXT("manage_behavior_tree"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleBehaviorTreeAction(R, A, P, S);
-                  });
-
-  RegisterHandler(TEXT("manage_audio"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleAudioAction(R, A, P, S);
-                  });
-
-  RegisterHandler(TEXT("manage_lighting"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleLightingAction(R, A, P, S);
-                  });
-
-  RegisterHandler(TEXT("manage_physics"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleAnimationPhysicsAction(R, A, P, S);
-                  });
-
-  // Animation physics alias - TS uses 'animation_physics' as the tool name
-  RegisterHandler(TEXT("animation_physics"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleAnimationPhysicsAction(R, A, P, S);
-                  });
-
-  // Animation authoring - uses subAction field (different from animation_physics which uses action)
-  RegisterHandler(TEXT("manage_animation_authoring"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleManageAnimationAuthoringAction(R, A, P, S);
-                  });
-
-  RegisterHandler(TEXT("manage_effect"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleEffectAction(R, A, P, S);
-                  });
-
-  // Common effect aliases used by the Node server; registering them here keeps
-  // dispatch O(1) and avoids relying on the late handler chain.
-  RegisterHandler(TEXT("create_effect"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleEffectAction(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("clear_debug_shapes"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleEffectAction(R, A, P, S);
-                  });
-
-  RegisterHandler(TEXT("manage_performance"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandlePerformanceAction(R, A, P, S);
-                  });
-
-  // Python execution - allows MCP to run Python scripts in Unreal Editor
-  RegisterHandler(TEXT("execute_python"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleExecutePythonAction(R, A, P, S);
-                  });
-
-  // Phase 21: Game Framework
-  RegisterHandler(TEXT("manage_game_framework"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleManageGameFrameworkAction(R, A, P, S);
-                  });
-
-  // Phase 22: Sessions & Local Multiplayer
-  RegisterHandler(TEXT("manage_sessions"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleManageSessionsAction(R, A, P, S);
-                  });
-
-  // Phase 23: Level Structure
-  RegisterHandler(TEXT("manage_level_structure"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleManageLevelStructureAction(R, A, P, S);
-                  });
-
-  // Phase 24: Volumes & Zones
-  RegisterHandler(TEXT("manage_volumes"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleManageVolumesAction(R, A, P, S);
-                  });
-
-  // Phase 25: Navigation System
-  RegisterHandler(TEXT("manage_navigation"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleManageNavigationAction(R, A, P, S);
-                  });
-
-  // Editor Control: Quit Editor
-  RegisterHandler(TEXT("quit_editor"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleQuitEditor(R, P, S);
-                  });
-
-  // Phase 27: Misc (camera, viewport, bookmarks, post-process, networking helpers)
-  RegisterHandler(TEXT("manage_misc"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleMiscAction(R, A, P, S);
-                  });
-
-  // Direct action aliases for misc handlers
-  // Note: create_post_process_volume is handled via manage_volumes tool
-  RegisterHandler(TEXT("create_camera"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleMiscAction(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("set_camera_fov"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleMiscAction(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("set_viewport_resolution"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleMiscAction(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("set_game_speed"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleMiscAction(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("create_bookmark"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
-                    return HandleMiscAction(R, A, P, S);
-                  });
-
-  // PIE State Handler - for checking Play-In-Editor state
-  RegisterHandler(TEXT("check_pie_state"),
-                  [this](const FString &R, const FString &A,
-                         const TSharedPtr<FJsonObject> &P,
-                         TSharedPtr<FMcpBridgeWebSocket> S) {
+  using Self = UMcpAutomationBridgeSubsystem;
+  static constexpr FAutomationHandlerEntry HandlerTable[] = {
+      // Core & Properties
+      {TEXT("execute_editor_function"), &Self::HandleExecuteEditorFunction},
+      {TEXT("set_object_property"), &Self::HandleSetObjectProperty},
+      {TEXT("get_object_property"), &Self::HandleGetObjectProperty},
+      {TEXT("get_properties_bulk"), &Self::HandleGetPropertiesBulk},
+      {TEXT("set_properties_bulk"), &Self::HandleSetPropertiesBulk},
+
+      // Containers (Arrays, Maps, Sets)
+      {TEXT("array_append"), &Self::HandleArrayAppend},
+      {TEXT("array_remove"), &Self::HandleArrayRemove},
+      {TEXT("array_insert"), &Self::HandleArrayInsert},
+      {TEXT("array_get_element"), &Self::HandleArrayGetElement},
+      {TEXT("array_set_element"), &Self::HandleArraySetElement},
+      {TEXT("array_clear"), &Self::HandleArrayClear},
+      {TEXT("map_set_value"), &Self::HandleMapSetValue},
+      {TEXT("map_get_value"), &Self::HandleMapGetValue},
+      {TEXT("map_remove_key"), &Self::HandleMapRemoveKey},
+      {TEXT("map_has_key"), &Self::HandleMapHasKey},
+      {TEXT("map_get_keys"), &Self::HandleMapGetKeys},
+      {TEXT("map_clear"), &Self::HandleMapClear},
+      {TEXT("set_add"), &Self::HandleSetAdd},
+      {TEXT("set_remove"), &Self::HandleSetRemove},
+      {TEXT("set_contains"), &Self::HandleSetContains},
+      {TEXT("set_clear"), &Self::HandleSetClear},
+
+      // Asset Dependency
+      {TEXT("get_asset_references"), &Self::HandleGetAssetReferences},
+      {TEXT("get_asset_dependencies"), &Self::HandleGetAssetDependencies},
+
+      // Asset Workflow
+      {TEXT("fixup_redirectors"), &Self::HandleFixupRedirectors},
+      {TEXT("source_control_checkout"), &Self::HandleSourceControlCheckout},
+      {TEXT("source_control_submit"), &Self::HandleSourceControlSubmit},
+      {TEXT("bulk_rename_assets"), &Self::HandleBulkRenameAssets},
+      {TEXT("bulk_delete_assets"), &Self::HandleBulkDeleteAssets},
+      {TEXT("generate_thumbnail"), &Self::HandleGenerateThumbnail},
+
+      // Landscape
+      {TEXT("create_landscape"), &Self::HandleCreateLandscape},
+      {TEXT("create_procedural_terrain"), &Self::HandleCreateProceduralTerrain},
+      {TEXT("create_landscape_grass_type"),
+       &Self::HandleCreateLandscapeGrassType},
+      {TEXT("sculpt_landscape"), &Self::HandleSculptLandscape},
+      {TEXT("modify_heightmap"), &Self::HandleModifyHeightmap},
+      {TEXT("get_heightmap_region"), &Self::HandleGetHeightmapRegion},
+      {TEXT("set_landscape_material"), &Self::HandleSetLandscapeMaterial},
+      {TEXT("edit_landscape"), &Self::HandleEditLandscape},
+
+      // Foliage
+      {TEXT("add_foliage_type"), &Self::HandleAddFoliageType},
+      {TEXT("create_procedural_foliage"), &Self::HandleCreateProceduralFoliage},
+      {TEXT("paint_foliage"), &Self::HandlePaintFoliage},
+      {TEXT("add_foliage_instances"), &Self::HandleAddFoliageInstances},
+      {TEXT("remove_foliage"), &Self::HandleRemoveFoliage},
+      {TEXT("get_foliage_instances"), &Self::HandleGetFoliageInstances},
+
+      // Niagara
+      {TEXT("create_niagara_system"), &Self::HandleCreateNiagaraSystem},
+      {TEXT("create_niagara_ribbon"), &Self::HandleCreateNiagaraRibbon},
+      {TEXT("create_niagara_emitter"), &Self::HandleCreateNiagaraEmitter},
+      {TEXT("spawn_niagara_actor"), &Self::HandleSpawnNiagaraActor},
+      {TEXT("modify_niagara_parameter"), &Self::HandleModifyNiagaraParameter},
+
+      // Animation
+      {TEXT("create_anim_blueprint"), &Self::HandleCreateAnimBlueprint},
+      {TEXT("play_anim_montage"), &Self::HandlePlayAnimMontage},
+      {TEXT("setup_ragdoll"), &Self::HandleSetupRagdoll},
+      {TEXT("activate_ragdoll"), &Self::HandleActivateRagdoll},
+
+      // Material Graph
+      {TEXT("add_material_texture_sample"),
+       &Self::HandleAddMaterialTextureSample},
+      {TEXT("add_material_expression"), &Self::HandleAddMaterialExpression},
+      {TEXT("create_material_nodes"), &Self::HandleCreateMaterialNodes},
+
+      // Sequencer
+      {TEXT("add_sequencer_keyframe"), &Self::HandleAddSequencerKeyframe},
+      {TEXT("manage_sequencer_track"), &Self::HandleManageSequencerTrack},
+      {TEXT("add_camera_track"), &Self::HandleAddCameraTrack},
+      {TEXT("add_animation_track"), &Self::HandleAddAnimationTrack},
+      {TEXT("add_transform_track"), &Self::HandleAddTransformTrack},
+
+      // UI & Environment
+      {TEXT("manage_ui"), &Self::HandleUiAction},
+      {TEXT("control_environment"), &Self::HandleControlEnvironmentAction},
+      {TEXT("build_environment"), &Self::HandleBuildEnvironmentAction},
+
+      // Tools & System
+      {TEXT("console_command"), &Self::HandleConsoleCommandAction},
+      {TEXT("inspect"), &Self::HandleInspectAction},
+      {TEXT("system_control"), &Self::HandleSystemControlAction},
+      {TEXT("describe_capabilities"), &Self::HandleDescribeCapabilities},
+      {TEXT("get_recent_logs"), &Self::HandleGetRecentLogs},
+      {TEXT("get_runtime_state"), &Self::HandleGetRuntimeState},
+      {TEXT("subscribe_runtime_telemetry"),
+       &Self::HandleSubscribeRuntimeTelemetry},
+      {TEXT("unsubscribe_runtime_telemetry"),
+       &Self::HandleUnsubscribeRuntimeTelemetry},
+      {TEXT("get_bridge_metrics"), &Self::HandleGetBridgeMetrics},
+      {TEXT("bridge_echo"), &Self::HandleBridgeEcho},
+      {TEXT("subscribe_events"), &Self::HandleSubscribeEvents},
+      {TEXT("unsubscribe_events"), &Self::HandleSubscribeEvents},
+      {TEXT("batch"), &Self::HandleBatchAction},
+      {TEXT("blueprint_edit_session"), &Self::HandleBlueprintEditSession},
+      {TEXT("compile_blueprints"), &Self::HandleCompileBlueprints},
+      {TEXT("material_edit_session"), &Self::HandleMaterialEditSession},
+      {TEXT("manage_blueprint_graph"), &Self::HandleBlueprintGraphAction},
+      {TEXT("list_blueprints"), &Self::HandleListBlueprints},
+      {TEXT("manage_world_partition"), &Self::HandleWorldPartitionAction},
+      {TEXT("manage_render"), &Self::HandleRenderAction},
+      {TEXT("manage_input"), &Self::HandleInputAction},
+      {TEXT("control_actor"), &Self::HandleControlActorAction},
+      {TEXT("manage_level"), &Self::HandleLevelAction},
+      {TEXT("manage_sequence"), &Self::HandleSequenceAction},
+      {TEXT("manage_asset"), &Self::HandleAssetAction},
+
+      // CRITICAL: Register asset_query for O(1) dispatch - fixes timeout issues
+      // This handler processes search_assets, find_by_tag, get_source_control_state, etc.
+      {TEXT("asset_query"), &Self::HandleAssetQueryAction},
+
+      // Direct action aliases for common asset_query subActions
+      // These allow TS to call executeAutomationRequest('search_assets', {...}) directly
+      {TEXT("search_assets"), &Self::HandleSearchAssets},
+      {TEXT("find_by_tag"), &Self::HandleFindByTag},
+
+      // Direct action aliases for manage_asset subActions that TS calls directly
+      // These allow O(1) dispatch for GPU-heavy and common operations
+      {TEXT("generate_lods"), &Self::HandleGenerateLODs},
+      {TEXT("create_thumbnail"), &Self::HandleGenerateThumbnail},
+      {TEXT("get_source_control_state"), &Self::HandleGetSourceControlState},
+      {TEXT("manage_material_authoring"),
+       &Self::HandleManageMaterialAuthoringAction},
+
+      // === Missing registrations for Phase 35+ tools ===
+      {TEXT("manage_blueprint"), &Self::HandleBlueprintAction},
+      {TEXT("manage_geometry"), &Self::HandleGeometryAction},
+      {TEXT("manage_skeleton"), &Self::HandleManageSkeleton},
+      {TEXT("manage_texture"), &Self::HandleManageTextureAction},
+      {TEXT("manage_gas"), &Self::HandleManageGASAction},
+      {TEXT("manage_character"), &Self::HandleManageCharacterAction},
+      {TEXT("manage_combat"), &Self::HandleManageCombatAction},
+      {TEXT("manage_ai"), &Self::HandleManageAIAction},
+      {TEXT("manage_inventory"), &Self::HandleManageInventoryAction},
+      {TEXT("manage_interaction"), &Self::HandleManageInteractionAction},
+      {TEXT("manage_widget_authoring"),
+       &Self::HandleManageWidgetAuthoringAction},
+      {TEXT("manage_networking"), &Self::HandleManageNetworkingAction},
+      {TEXT("manage_splines"), &Self::HandleManageSplinesAction},
+      {TEXT("manage_pipeline"), &Self::HandlePipelineAction},
+      {TEXT("manage_behavior_tree"), &Self::HandleBehaviorTreeAction},
+      {TEXT("manage_audio"), &Self::HandleAudioAction},
+      {TEXT("manage_lighting"), &Self::HandleLightingAction},
+      {TEXT("manage_physics"), &Self::HandleAnimationPhysicsAction},
+
+      // Animation physics alias - TS uses 'animation_physics' as the tool name
+      {TEXT("animation_physics"), &Self::HandleAnimationPhysicsAction},
+
+      // Animation authoring - uses subAction field (different from animation_physics which uses action)
+      {TEXT("manage_animation_authoring"),
+       &Self::HandleManageAnimationAuthoringAction},
+      {TEXT("manage_effect"), &Self::HandleEffectAction},
+
+      // Common effect aliases used by the Node server; registering them here keeps
+      // dispatch O(1) and avoids relying on the late handler chain.
+      {TEXT("create_effect"), &Self::HandleEffectAction},
+      {TEXT("clear_debug_shapes"), &Self::HandleEffectAction},
+      {TEXT("manage_performance"), &Self::HandlePerformanceAction},
+
+      // Python execution - allows MCP to run Python scripts in Unreal Editor
+      {TEXT("execute_python"), &Self::HandleExecutePythonAction},
+
+      // Phase 21: Game Framework
+      {TEXT("manage_game_framework"), &Self::HandleManageGameFrameworkAction},
+
+      // Phase 22: Sessions & Local Multiplayer
+      {TEXT("manage_sessions"), &Self::HandleManageSessionsAction},
+
+      // Phase 23: Level Structure
+      {TEXT("manage_level_structure"), &Self::HandleManageLevelStructureAction},
+
+      // Phase 24: Volumes & Zones
+      {TEXT("manage_volumes"), &Self::HandleManageVolumesAction},
+
+      // Phase 25: Navigation System
+      {TEXT("manage_navigation"), &Self::HandleManageNavigationAction},
+
+      // Editor Control: Quit Editor
+      {TEXT("quit_editor"), &Self::HandleQuitEditorAction},
+
+      // Phase 27: Misc (camera, viewport, bookmarks, post-process, networking helpers)
+      {TEXT("manage_misc"), &Self::HandleMiscAction},
+
+      // Direct action aliases for misc handlers
+      // Note: create_post_process_volume is handled via manage_volumes tool
+      {TEXT("create_camera"), &Self::HandleMiscAction},
+      {TEXT("set_camera_fov"), &Self::HandleMiscAction},
+      {TEXT("set_viewport_resolution"), &Self::HandleMiscAction},
+      {TEXT("set_game_speed"), &Self::HandleMiscAction},
+      {TEXT("create_bookmark"), &Self::HandleMiscAction},
+
+      // PIE State Handler - for checking Play-In-Editor state
+      {TEXT("check_pie_state"), &Self::HandleCheckPieState},
+  };
+
+  BuiltinAutomationHandlers.Reset();
+  BuiltinAutomationHandlers.Reserve(UE_ARRAY_COUNT(HandlerTable));
+  for (const FAutomationHandlerEntry &Entry : HandlerTable) {
+    BuiltinAutomationHandlers.Add(FName(Entry.Action), Entry.Method);
+  }
+}
+
+/**
+ * @brief Builds the handler registry and the fallback route table before the
+ * first dispatch.
+ *
+ * Neither is needed until a client sends a request, so Initialize leaves
+ * them out of editor startup. Both use interned action names, so this must
+ * run before DispatchAutomationAction looks any name up with FNAME_Find.
+ */
+void UMcpAutomationBridgeSubsystem::EnsureAutomationDispatch() {
+  if (bAutomationDispatchReady) {
+    return;
+  }
+  bAutomationDispatchReady = true;
+
+  const double StartSeconds = FPlatformTime::Seconds();
+  InitializeHandlers();
+  InitializeAutomationRoutes();
+  const double ElapsedMs = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+  StartupPhaseMs.Emplace(TEXT("dispatchTables"), ElapsedMs);
+  UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
+         TEXT("Dispatch tables built on the first request in %.2f ms."),
+         ElapsedMs);
+}
+
+/**
+ * @brief Appends one startup phase to the timing breakdown.
+ *
+ * @param Phase Phase name reported by get_bridge_metrics.
+ * @param PhaseStartSeconds FPlatformTime::Seconds() when the phase began.
+ * @return The current time, which starts the next phase.
+ */
+double UMcpAutomationBridgeSubsystem::RecordStartupPhase(
+    const TCHAR *Phase, double PhaseStartSeconds) {
+  const double NowSeconds = FPlatformTime::Seconds();
+  StartupPhaseMs.Emplace(Phase, (NowSeconds - PhaseStartSeconds) * 1000.0);
+  return NowSeconds;
+}
+
+/**
+ * @brief Reports the startup timing breakdown for get_bridge_metrics.
+ *
+ * @return { totalMs, phases: [{ name, ms }] }; totalMs covers Initialize
+ * only, while the phases also list the deferred dispatchTables build.
+ */
+TSharedPtr<FJsonObject>
+UMcpAutomationBridgeSubsystem::GetStartupTimingJson() const {
+  TSharedPtr<FJsonObject> Startup = MakeShared<FJsonObject>();
+  Startup->SetNumberField(TEXT("totalMs"), StartupTotalMs);
+  TArray<TSharedPtr<FJsonValue>> Phases;
+  Phases.Reserve(StartupPhaseMs.Num());
+  for (const TPair<const TCHAR *, double> &Phase : StartupPhaseMs) {
+    TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
+    Entry->SetStringField(TEXT("name"), Phase.Key);
+    Entry->SetNumberField(TEXT("ms"), Phase.Value);
+    Phases.Add(MakeShared<FJsonValueObject>(Entry));
+  }
+  Startup->SetArrayField(TEXT("phases"), Phases);
+  return Startup;
+}
+
+/** @brief quit_editor entry point; the handler itself takes no action name. */
+bool UMcpAutomationBridgeSubsystem::HandleQuitEditorAction(
+    const FString &RequestId, const FString &Action,
+    const TSharedPtr<FJsonObject> &Payload,
+    TSharedPtr<FMcpBridgeWebSocket> RequestingSocket) {
+  return HandleQuitEditor(RequestId, Payload, RequestingSocket);
+}
+
+/**
+ * @brief Reports whether Play-In-Editor is running and, if so, paused.
+ */
+bool UMcpAutomationBridgeSubsystem::HandleCheckPieState(
+    const FString &RequestId, const FString &Action,
+    const TSharedPtr<FJsonObject> &Payload,
+    TSharedPtr<FMcpBridgeWebSocket> RequestingSocket) {
 #if WITH_EDITOR
-                    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-                    bool bIsInPIE = false;
-                    FString PieState = TEXT("stopped");
-                    
-                    if (GEditor && GEditor->PlayWorld) {
-                      bIsInPIE = true;
-                      if (GEditor->PlayWorld->IsPaused()) {
-                        PieState = TEXT("paused");
-                      } else {
-                        PieState = TEXT("playing");
-                      }
-                    }
-                    
-                    Result->SetBoolField(TEXT("isInPIE"), bIsInPIE);
-                    Result->SetStringField(TEXT("pieState"), PieState);
-                    
-                    SendAutomationResponse(S, R, true, 
-                        bIsInPIE ? TEXT("PIE is active") : TEXT("PIE is not active"),
-                        Result);
-                    return true;
+  TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+  bool bIsInPIE = false;
+  FString PieState = TEXT("stopped");
+
+  if (GEditor && GEditor->PlayWorld) {
+    bIsInPIE = true;
+    if (GEditor->PlayWorld->IsPaused()) {
+      PieState = TEXT("paused");
+    } else {
+      PieState = TEXT("playing");
+    }
+  }
+
+  Result->SetBoolField(TEXT("isInPIE"), bIsInPIE);
+  Result->SetStringField(TEXT("pieState"), PieState);
+
+  SendAutomationResponse(RequestingSocket, RequestId, true,
+                         bIsInPIE ? TEXT("PIE is active")
+                                  : TEXT("PIE is not active"),
+                         Result);
+  return true;
 #else
-                    SendAutomationError(S, R, TEXT("PIE state check requires editor build"), TEXT("NOT_AVAILABLE"));
-                    return true;
+  SendAutomationError(RequestingSocket, RequestId,
+                      TEXT("PIE state check requires editor build"),
+                      TEXT("NOT_AVAILABLE"));
+  return true;
 #endif
-                  });
 }
 
 // Drain and process any automation requests that were enqueued while the
 // subsystem was busy. This implementation lives in the primary subsystem
 // translation unit to ensure the symbol is available at link time for
 /**
- * @brief Processes all queued automation requests on the game thread.
+ * @brief Chooses the scheduler lane for a deferred request.
+ *
+ * An explicit payload "lane" ("interactive", "bulk" or "background") wins.
+ * Otherwise the action, and the payload's subAction/action for consolidated
+ * tools, are matched against the configured interactive and background lists;
+ * anything else is bulk.
+ *
+ * @param Action Top-level action name.
+ * @param Payload Request payload; may be null.
+ * @return EPendingRequestLane Lane the request is queued on.
+ */
+UMcpAutomationBridgeSubsystem::EPendingRequestLane
+UMcpAutomationBridgeSubsystem::ClassifyPendingRequestLane(
+    const FString &Action, const TSharedPtr<FJsonObject> &Payload) const {
+  FString Lane;
+  if (Payload.IsValid() && Payload->TryGetStringField(TEXT("lane"), Lane)) {
+    if (Lane.Equals(TEXT("interactive"), ESearchCase::IgnoreCase)) {
+      return EPendingRequestLane::Interactive;
+    }
+    if (Lane.Equals(TEXT("background"), ESearchCase::IgnoreCase)) {
+      return EPendingRequestLane::Background;
+    }
+    if (Lane.Equals(TEXT("bulk"), ESearchCase::IgnoreCase)) {
+      return EPendingRequestLane::Bulk;
+    }
+  }
+
+  TArray<FString, TInlineAllocator<3>> Keys;
+  Keys.Add(Action.ToLower());
+  if (Payload.IsValid()) {
+    FString SubAction;
+    if (Payload->TryGetStringField(TEXT("subAction"), SubAction) ||
+        Payload->TryGetStringField(TEXT("action"), SubAction)) {
+      Keys.Add(SubAction.ToLower());
+    }
+  }
+  for (const FString &Key : Keys) {
+    if (InteractiveLaneActions.Contains(Key)) {
+      return EPendingRequestLane::Interactive;
+    }
+  }
+  for (const FString &Key : Keys) {
+    if (BackgroundLaneActions.Contains(Key)) {
+      return EPendingRequestLane::Background;
+    }
+  }
+  return EPendingRequestLane::Bulk;
+}
+
+/**
+ * @brief Queue a request for ProcessPendingAutomationRequests.
+ *
+ * Thread-safe. The request is appended to the lane chosen by
+ * ClassifyPendingRequestLane and stamped with its enqueue time so the drain
+ * can report queue wait.
+ */
+void UMcpAutomationBridgeSubsystem::EnqueuePendingAutomationRequest(
+    const FString &RequestId, const FString &Action,
+    const TSharedPtr<FJsonObject> &Payload,
+    TSharedPtr<FMcpBridgeWebSocket> RequestingSocket) {
+  FPendingAutomationRequest P;
+  P.RequestId = RequestId;
+  P.Action = Action;
+  P.Payload = Payload;
+  P.RequestingSocket = RequestingSocket;
+  P.EnqueuedSeconds = FPlatformTime::Seconds();
+  const EPendingRequestLane Lane = ClassifyPendingRequestLane(Action, Payload);
+
+  {
+    FScopeLock Lock(&PendingAutomationRequestsMutex);
+    PendingRequestLanes[static_cast<int32>(Lane)].Items.Add(MoveTemp(P));
+    bPendingRequestsScheduled = true;
+  }
+  TRACE_COUNTER_SET(McpBridgePendingRequests,
+                    GetPendingAutomationRequestCount());
+}
+
+/** @brief Total number of queued requests across all lanes. */
+int32 UMcpAutomationBridgeSubsystem::GetPendingAutomationRequestCount() {
+  FScopeLock Lock(&PendingAutomationRequestsMutex);
+  int32 Total = 0;
+  for (const FPendingRequestLane &Lane : PendingRequestLanes) {
+    Total += Lane.Num();
+  }
+  return Total;
+}
+
+/**
+ * @brief Drop a queued request before it runs.
+ *
+ * Game thread. Searches every scheduler lane; a match is removed and answered
+ * with CANCELLED so the client's pending call settles immediately.
+ *
+ * @param RequestId Identifier of the request to drop.
+ * @return true if the request was still queued.
+ */
+bool UMcpAutomationBridgeSubsystem::CancelQueuedAutomationRequest(
+    const FString &RequestId) {
+  FPendingAutomationRequest Removed;
+  bool bFound = false;
+  {
+    FScopeLock Lock(&PendingAutomationRequestsMutex);
+    for (FPendingRequestLane &Lane : PendingRequestLanes) {
+      for (int32 Index = Lane.Head; Index < Lane.Items.Num(); ++Index) {
+        if (Lane.Items[Index].RequestId == RequestId) {
+          Removed = MoveTemp(Lane.Items[Index]);
+          Lane.Items.RemoveAt(Index);
+          bFound = true;
+          break;
+        }
+      }
+      if (bFound) {
+        break;
+      }
+    }
+  }
+  if (!bFound) {
+    return false;
+  }
+  TRACE_COUNTER_SET(McpBridgePendingRequests,
+                    GetPendingAutomationRequestCount());
+  SendAutomationError(Removed.RequestingSocket, RequestId,
+                      TEXT("Request was cancelled before it started."),
+                      TEXT("CANCELLED"));
+  return true;
+}
+
+/**
+ * @brief Drains queued automation requests on the game thread within the
+ * per-frame budget.
  *
  * Ensures execution on the game thread (re-dispatches if called from another
- * thread), moves the shared pending-request queue into a local list under a
- * lock, clears the shared queue and the scheduled flag, then dispatches each
- * request to ProcessAutomationRequest.
+ * thread). Requests are taken one at a time from the highest-priority
+ * non-empty lane, so anything enqueued while draining is ordered correctly.
+ * Draining stops once this frame's budget is spent (at least one request is
+ * always run so the queue makes progress) or the engine enters an unsafe
+ * state; the scheduled flag then stays set and Tick resumes next frame.
  */
 void UMcpAutomationBridgeSubsystem::ProcessPendingAutomationRequests() {
   if (!IsInGameThread()) {
@@ -1194,23 +1232,104 @@ void UMcpAutomationBridgeSubsystem::ProcessPendingAutomationRequests() {
               [this]() { this->ProcessPendingAutomationRequests(); });
     return;
   }
+  // Requests finishing inside the drain call back in here; the outer loop
+  // already picks up whatever they enqueued.
+  if (bDrainingPendingRequests || bProcessingAutomationRequest) {
+    return;
+  }
+  TGuardValue<bool> DrainGuard(bDrainingPendingRequests, true);
+  TRACE_CPUPROFILER_EVENT_SCOPE_STR("McpBridge::DrainPendingRequests");
+
+  // Starts this frame's budget when nothing has charged it yet.
+  GetFrameBudgetRemainingSeconds();
+
+  static const TCHAR *const LaneNames[] = {TEXT("interactive"), TEXT("bulk"),
+                                           TEXT("background")};
+  const double DrainStartSeconds = FPlatformTime::Seconds();
+  int32 Processed = 0;
+  int32 Remaining = 0;
+
+  for (;;) {
+    const double NowSeconds = FPlatformTime::Seconds();
+    if (Processed > 0 && PendingRequestFrameBudgetSeconds > 0.0 &&
+        PendingRequestBudgetUsedSeconds + (NowSeconds - DrainStartSeconds) >=
+            PendingRequestFrameBudgetSeconds) {
+      break;
+    }
+    if (const TCHAR *UnsafeReason = GetUnsafeEngineStateReason()) {
+      NoteEngineStateDeferral(UnsafeReason, 0);
+      break;
+    }
 
-  TArray<FPendingAutomationRequest> LocalQueue;
-  {
-    FScopeLock Lock(&PendingAutomationRequestsMutex);
-    if (PendingAutomationRequests.Num() == 0) {
-      bPendingRequestsScheduled = false;
-      return;
+    FPendingAutomationRequest Request;
+    int32 LaneIndex = INDEX_NONE;
+    {
+      FScopeLock Lock(&PendingAutomationRequestsMutex);
+      Remaining = 0;
+      for (int32 Index = 0;
+           Index < static_cast<int32>(EPendingRequestLane::Count); ++Index) {
+        FPendingRequestLane &Lane = PendingRequestLanes[Index];
+        if (LaneIndex == INDEX_NONE && Lane.Num() > 0) {
+          LaneIndex = Index;
+          Request = MoveTemp(Lane.Items[Lane.Head++]);
+          if (Lane.Head == Lane.Items.Num()) {
+            Lane.Items.Reset();
+            Lane.Head = 0;
+          } else if (Lane.Head >= 64 && Lane.Head * 2 >= Lane.Items.Num()) {
+            Lane.Items.RemoveAt(0, Lane.Head);
+            Lane.Head = 0;
+          }
+        }
+        Remaining += Lane.Num();
+      }
+      bPendingRequestsScheduled = Remaining > 0;
+      TRACE_COUNTER_SET(McpBridgePendingRequests, Remaining);
+    }
+    if (LaneIndex == INDEX_NONE) {
+      break;
+    }
+
+    if (ConnectionManager.IsValid()) {
+      ConnectionManager->RecordQueueTelemetry(
+          LaneNames[LaneIndex], NowSeconds - Request.EnqueuedSeconds,
+          Remaining);
+    }
+    ProcessAutomationRequest(Request.RequestId, Request.Action,
+                             Request.Payload, Request.RequestingSocket);
+    ++Processed;
+  }
+
+  PendingRequestBudgetUsedSeconds +=
+      FPlatformTime::Seconds() - DrainStartSeconds;
+
+  Remaining = GetPendingAutomationRequestCount();
+  if (Remaining > 0) {
+    {
+      FScopeLock Lock(&PendingAutomationRequestsMutex);
+      bPendingRequestsScheduled = true;
     }
-    LocalQueue = MoveTemp(PendingAutomationRequests);
-    PendingAutomationRequests.Empty();
-    bPendingRequestsScheduled = false;
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
+           TEXT("Pending request drain yielded after %d request(s) "
+                "(%.3f ms this frame); %d still queued."),
+           Processed, PendingRequestBudgetUsedSeconds * 1000.0, Remaining);
   }
+}
 
-  for (const FPendingAutomationRequest &Req : LocalQueue) {
-    ProcessAutomationRequest(Req.RequestId, Req.Action, Req.Payload,
-                             Req.RequestingSocket);
+double UMcpAutomationBridgeSubsystem::GetFrameBudgetRemainingSeconds() {
+  if (PendingRequestBudgetFrame != GFrameCounter) {
+    PendingRequestBudgetFrame = GFrameCounter;
+    PendingRequestBudgetUsedSeconds = 0.0;
   }
+  if (PendingRequestFrameBudgetSeconds <= 0.0) {
+    return TNumericLimits<double>::Max();
+  }
+  return FMath::Max(0.0, PendingRequestFrameBudgetSeconds -
+                             PendingRequestBudgetUsedSeconds);
+}
+
+void UMcpAutomationBridgeSubsystem::ChargeFrameBudget(double Seconds) {
+  GetFrameBudgetRemainingSeconds();
+  PendingRequestBudgetUsedSeconds += FMath::Max(0.0, Seconds);
 }
 
 // ============================================================================
@@ -11,6 +11,7 @@
 #include "McpAutomationBridgeSubsystem.h"
 #include "McpAutomationBridgeHelpers.h"
 #include "McpAutomationBridgeGlobals.h"
+#include "McpPackedArray.h"
 #include "Misc/EngineVersionComparison.h"
 
 #if WITH_EDITOR
@@ -316,6 +317,75 @@ static FRotator GetRotatorFromJsonAnim(const TSharedPtr<FJsonObject>& Obj)
     return FRotator::ZeroRotator;
 }
 
+// Helper to read a key channel (Stride numbers per key) from a track object, as a JSON number
+// array or an FMcpPackedArray f32/f64 block. Returns the key count, 0 when the field is absent,
+// or INDEX_NONE with OutError set.
+static int32 ReadPackedKeysAnim(const TSharedPtr<FJsonObject>& Obj, const TCHAR* Field, int32 Stride,
+    TArray<float>& OutValues, FString& OutError)
+{
+    const TSharedPtr<FJsonValue> FieldValue = Obj->TryGetField(Field);
+    if (!FieldValue.IsValid() || FieldValue->IsNull())
+    {
+        return 0;
+    }
+    if (FMcpPackedArray::IsPackedValue(FieldValue))
+    {
+        const TSharedPtr<FJsonObject> Packed = FieldValue->AsObject();
+        FString Layout = TEXT("f32");
+        Packed->TryGetStringField(TEXT("layout"), Layout);
+        Layout = Layout.ToLower();
+        const bool bDouble = Layout.StartsWith(TEXT("f64"));
+        if (!bDouble && !Layout.StartsWith(TEXT("f32")))
+        {
+            OutError = FString::Printf(TEXT("%s packed layout must be f32 or f64 (got '%s')"), Field, *Layout);
+            return INDEX_NONE;
+        }
+        TArray<uint8> Bytes;
+        int32 Count = 0;
+        if (!FMcpPackedArray::DecodeRaw(*Packed, bDouble ? sizeof(double) : sizeof(float), Bytes, Count, OutError))
+        {
+            return INDEX_NONE;
+        }
+        if (Count == 0 || Count % Stride != 0)
+        {
+            OutError = FString::Printf(TEXT("%s must hold %d numbers per key (got %d)"), Field, Stride, Count);
+            return INDEX_NONE;
+        }
+        OutValues.SetNumUninitialized(Count);
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            OutValues[Index] = bDouble
+                ? static_cast<float>(reinterpret_cast<const double*>(Bytes.GetData())[Index])
+                : reinterpret_cast<const float*>(Bytes.GetData())[Index];
+        }
+        return Count / Stride;
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* Values = nullptr;
+    if (!FieldValue->TryGetArray(Values) || !Values)
+    {
+        OutError = FString::Printf(TEXT("%s must be a number array or a packed block"), Field);
+        return INDEX_NONE;
+    }
+    if (Values->Num() == 0 || Values->Num() % Stride != 0)
+    {
+        OutError = FString::Printf(TEXT("%s must hold %d numbers per key (got %d)"), Field, Stride, Values->Num());
+        return INDEX_NONE;
+    }
+    OutValues.Reserve(Values->Num());
+    for (const TSharedPtr<FJsonValue>& Value : *Values)
+    {
+        double Number = 0.0;
+        if (!Value.IsValid() || !Value->TryGetNumber(Number))
+        {
+            OutError = FString::Printf(TEXT("%s must contain only numbers"), Field);
+            return INDEX_NONE;
+        }
+        OutValues.Add(static_cast<float>(Number));
+    }
+    return Values->Num() / Stride;
+}
+
 // ============================================================================
 // AnimGraph Helper Functions for State Machine Implementation
 // ============================================================================
@@ -689,6 +759,278 @@ static TSharedPtr<FJsonObject> HandleAnimationAuthoringRequest(const TSharedPtr<
         return Response;
     }
 
+    if (SubAction == TEXT("set_bone_tracks"))
+    {
+        // Whole tracks for many bones (and float curves) in one request. Keys are flat number
+        // arrays or FMcpPackedArray f32/f64 blocks: positions [x,y,z,...], rotations [x,y,z,w,...] (or [pitch,yaw,roll,...] with
+        // rotationFormat "euler"), scales [x,y,z,...], one entry per key starting at frame 0. A
+        // channel with a single key holds for the whole track; a missing channel keeps the bone's
+        // reference pose. Everything is written inside one controller bracket, so the sequence
+        // notifies and recompresses once instead of once per key.
+        FString AssetPath = NormalizeAnimPath(GetStringFieldAnimAuth(Params, TEXT("assetPath"), TEXT("")));
+        const bool bResizeToKeys = GetBoolFieldAnimAuth(Params, TEXT("resizeToKeys"), false);
+        const bool bCreateIfMissing = GetBoolFieldAnimAuth(Params, TEXT("createIfMissing"), true);
+        bool bSave = GetBoolFieldAnimAuth(Params, TEXT("save"), true);
+
+        const TArray<TSharedPtr<FJsonValue>>* TracksArray = nullptr;
+        const TArray<TSharedPtr<FJsonValue>>* CurvesArray = nullptr;
+        Params->TryGetArrayField(TEXT("tracks"), TracksArray);
+        Params->TryGetArrayField(TEXT("curves"), CurvesArray);
+        if ((!TracksArray || TracksArray->Num() == 0) && (!CurvesArray || CurvesArray->Num() == 0))
+        {
+            ANIM_ERROR_RESPONSE(TEXT("tracks or curves is required"), TEXT("MISSING_TRACKS"));
+        }
+
+        UAnimSequence* Sequence = LoadAnimSequenceFromPath(AssetPath);
+        if (!Sequence)
+        {
+            ANIM_ERROR_RESPONSE(FString::Printf(TEXT("Could not load animation sequence: %s"), *AssetPath), TEXT("SEQUENCE_NOT_FOUND"));
+        }
+        USkeleton* Skeleton = Sequence->GetSkeleton();
+        if (!Skeleton)
+        {
+            ANIM_ERROR_RESPONSE(TEXT("Animation sequence has no skeleton"), TEXT("SKELETON_NOT_FOUND"));
+        }
+
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
+        IAnimationDataController& Controller = Sequence->GetController();
+        const FReferenceSkeleton& RefSkeleton = Skeleton->GetReferenceSkeleton();
+        const FString RotationFormat = GetStringFieldAnimAuth(Params, TEXT("rotationFormat"), TEXT("quat")).ToLower();
+        const bool bEulerRotations = RotationFormat == TEXT("euler");
+
+        // Decode and validate every track before the sequence is touched.
+        struct FPackedBoneTrack
+        {
+            FName BoneName;
+            TArray<FVector3f> Positions;
+            TArray<FQuat4f> Rotations;
+            TArray<FVector3f> Scales;
+        };
+        struct FPackedCurve
+        {
+            FString Name;
+            TArray<float> Values;
+            TArray<float> Frames;
+        };
+        TArray<FPackedBoneTrack> Tracks;
+        TArray<FPackedCurve> Curves;
+        int32 NumKeys = 0;
+        auto AgreeOnKeyCount = [&NumKeys](int32 Count)
+        {
+            if (Count <= 1)
+            {
+                return true;
+            }
+            if (NumKeys <= 1)
+            {
+                NumKeys = Count;
+                return true;
+            }
+            return NumKeys == Count;
+        };
+
+        if (TracksArray)
+        {
+            for (const TSharedPtr<FJsonValue>& TrackValue : *TracksArray)
+            {
+                const TSharedPtr<FJsonObject>* TrackObj = nullptr;
+                if (!TrackValue.IsValid() || !TrackValue->TryGetObject(TrackObj))
+                {
+                    ANIM_ERROR_RESPONSE(TEXT("Every entry in tracks must be an object"), TEXT("INVALID_TRACK"));
+                }
+                const FString BoneName = GetStringFieldAnimAuth(*TrackObj, TEXT("boneName"), TEXT(""));
+                const int32 BoneIndex = RefSkeleton.FindBoneIndex(FName(*BoneName));
+                if (BoneIndex == INDEX_NONE)
+                {
+                    ANIM_ERROR_RESPONSE(FString::Printf(TEXT("Bone not found on skeleton: %s"), *BoneName), TEXT("BONE_NOT_FOUND"));
+                }
+
+                FString KeyError;
+                TArray<float> PositionValues;
+                TArray<float> RotationValues;
+                TArray<float> ScaleValues;
+                const int32 NumPositions = ReadPackedKeysAnim(*TrackObj, TEXT("positions"), 3, PositionValues, KeyError);
+                const int32 NumRotations = KeyError.IsEmpty()
+                    ? ReadPackedKeysAnim(*TrackObj, TEXT("rotations"), bEulerRotations ? 3 : 4, RotationValues, KeyError)
+                    : 0;
+                const int32 NumScales = KeyError.IsEmpty()
+                    ? ReadPackedKeysAnim(*TrackObj, TEXT("scales"), 3, ScaleValues, KeyError)
+                    : 0;
+                if (!KeyError.IsEmpty())
+                {
+                    ANIM_ERROR_RESPONSE(FString::Printf(TEXT("Track '%s': %s"), *BoneName, *KeyError), TEXT("INVALID_TRACK"));
+                }
+                if (!AgreeOnKeyCount(NumPositions) || !AgreeOnKeyCount(NumRotations) || !AgreeOnKeyCount(NumScales))
+                {
+                    ANIM_ERROR_RESPONSE(FString::Printf(TEXT("Track '%s' does not have %d keys like the other channels"), *BoneName, NumKeys),
+                        TEXT("KEY_COUNT_MISMATCH"));
+                }
+
+                FPackedBoneTrack& Track = Tracks.AddDefaulted_GetRef();
+                Track.BoneName = FName(*BoneName);
+                const FTransform& RefPose = RefSkeleton.GetRefBonePose()[BoneIndex];
+                if (NumPositions == 0)
+                {
+                    Track.Positions.Add(FVector3f(RefPose.GetTranslation()));
+                }
+                for (int32 Key = 0; Key < NumPositions; ++Key)
+                {
+                    Track.Positions.Add(FVector3f(PositionValues[Key * 3], PositionValues[Key * 3 + 1], PositionValues[Key * 3 + 2]));
+                }
+                if (NumRotations == 0)
+                {
+                    Track.Rotations.Add(FQuat4f(RefPose.GetRotation()));
+                }
+                for (int32 Key = 0; Key < NumRotations; ++Key)
+                {
+                    if (bEulerRotations)
+                    {
+                        Track.Rotations.Add(FRotator3f(RotationValues[Key * 3], RotationValues[Key * 3 + 1], RotationValues[Key * 3 + 2]).Quaternion());
+                    }
+                    else
+                    {
+                        FQuat4f Rotation(RotationValues[Key * 4], RotationValues[Key * 4 + 1], RotationValues[Key * 4 + 2], RotationValues[Key * 4 + 3]);
+                        Rotation.Normalize();
+                        Track.Rotations.Add(Rotation);
+                    }
+                }
+                if (NumScales == 0)
+                {
+                    Track.Scales.Add(FVector3f(RefPose.GetScale3D()));
+                }
+                for (int32 Key = 0; Key < NumScales; ++Key)
+                {
+                    Track.Scales.Add(FVector3f(ScaleValues[Key * 3], ScaleValues[Key * 3 + 1], ScaleValues[Key * 3 + 2]));
+                }
+            }
+        }
+
+        if (CurvesArray)
+        {
+            for (const TSharedPtr<FJsonValue>& CurveValue : *CurvesArray)
+            {
+                const TSharedPtr<FJsonObject>* CurveObj = nullptr;
+                if (!CurveValue.IsValid() || !CurveValue->TryGetObject(CurveObj))
+                {
+                    ANIM_ERROR_RESPONSE(TEXT("Every entry in curves must be an object"), TEXT("INVALID_CURVE"));
+                }
+                FPackedCurve& Curve = Curves.AddDefaulted_GetRef();
+                Curve.Name = GetStringFieldAnimAuth(*CurveObj, TEXT("curveName"), TEXT(""));
+                FString KeyError;
+                const int32 NumValues = ReadPackedKeysAnim(*CurveObj, TEXT("values"), 1, Curve.Values, KeyError);
+                const int32 NumFrames = KeyError.IsEmpty() ? ReadPackedKeysAnim(*CurveObj, TEXT("frames"), 1, Curve.Frames, KeyError) : 0;
+                if (Curve.Name.IsEmpty() || NumValues == 0)
+                {
+                    KeyError = TEXT("curveName and values are required");
+                }
+                if (KeyError.IsEmpty() && NumFrames > 0 && NumFrames != NumValues)
+                {
+                    KeyError = TEXT("frames must have one entry per value");
+                }
+                if (!KeyError.IsEmpty())
+                {
+                    ANIM_ERROR_RESPONSE(FString::Printf(TEXT("Curve '%s': %s"), *Curve.Name, *KeyError), TEXT("INVALID_CURVE"));
+                }
+            }
+        }
+
+        // Every bone track must have exactly one key per frame of the sequence.
+        const int32 ModelKeys = Controller.GetModel()->GetNumberOfKeys();
+        const bool bResize = Tracks.Num() > 0 && NumKeys > 1 && NumKeys != ModelKeys;
+        if (bResize && !bResizeToKeys)
+        {
+            ANIM_ERROR_RESPONSE(FString::Printf(TEXT("Tracks have %d keys but the sequence has %d; pass resizeToKeys to change its length"),
+                NumKeys, ModelKeys), TEXT("KEY_COUNT_MISMATCH"));
+        }
+        const int32 TrackKeys = bResize ? NumKeys : ModelKeys;
+
+        int32 KeysWritten = 0;
+        int32 TracksAdded = 0;
+        int32 CurvesAdded = 0;
+        TArray<TSharedPtr<FJsonValue>> SkippedCurves;
+        Controller.OpenBracket(FText::FromString(TEXT("MCP set_bone_tracks")));
+        if (bResize)
+        {
+            Controller.SetNumberOfFrames(FFrameNumber(NumKeys - 1));
+        }
+        for (FPackedBoneTrack& Track : Tracks)
+        {
+            // Channels given as one key (or left to the reference pose) hold for the whole track.
+            if (Track.Positions.Num() == 1)
+            {
+                Track.Positions.Init(Track.Positions[0], TrackKeys);
+            }
+            if (Track.Rotations.Num() == 1)
+            {
+                Track.Rotations.Init(Track.Rotations[0], TrackKeys);
+            }
+            if (Track.Scales.Num() == 1)
+            {
+                Track.Scales.Init(Track.Scales[0], TrackKeys);
+            }
+            if (!Controller.GetModel()->IsValidBoneTrackName(Track.BoneName))
+            {
+                Controller.AddBoneCurve(Track.BoneName);
+                ++TracksAdded;
+            }
+            Controller.SetBoneTrackKeys(Track.BoneName, Track.Positions, Track.Rotations, Track.Scales);
+            KeysWritten += TrackKeys;
+        }
+
+        const double FrameRate = Sequence->GetSamplingFrameRate().AsDecimal();
+        for (const FPackedCurve& Curve : Curves)
+        {
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+            FAnimationCurveIdentifier CurveId(FName(*Curve.Name), ERawCurveTrackTypes::RCT_Float);
+#else
+            FSmartName SmartCurveName;
+            SmartCurveName.DisplayName = FName(*Curve.Name);
+            FAnimationCurveIdentifier CurveId(SmartCurveName, ERawCurveTrackTypes::RCT_Float);
+#endif
+            if (!Sequence->GetDataModel()->FindFloatCurve(CurveId))
+            {
+                if (!bCreateIfMissing)
+                {
+                    SkippedCurves.Add(MakeShared<FJsonValueString>(Curve.Name));
+                    continue;
+                }
+                Controller.AddCurve(CurveId, AACF_DefaultCurve);
+                ++CurvesAdded;
+            }
+            TArray<FRichCurveKey> CurveKeys;
+            CurveKeys.Reserve(Curve.Values.Num());
+            for (int32 Key = 0; Key < Curve.Values.Num(); ++Key)
+            {
+                const float Frame = Curve.Frames.Num() > 0 ? Curve.Frames[Key] : static_cast<float>(Key);
+                CurveKeys.Add(FRichCurveKey(static_cast<float>(Frame / FrameRate), Curve.Values[Key]));
+            }
+            Controller.SetCurveKeys(CurveId, CurveKeys);
+            KeysWritten += CurveKeys.Num();
+        }
+        Controller.CloseBracket();
+
+        SaveAnimAsset(Sequence, bSave);
+
+        Response->SetNumberField(TEXT("tracksSet"), Tracks.Num());
+        Response->SetNumberField(TEXT("tracksAdded"), TracksAdded);
+        Response->SetNumberField(TEXT("curvesSet"), Curves.Num() - SkippedCurves.Num());
+        Response->SetNumberField(TEXT("curvesAdded"), CurvesAdded);
+        Response->SetNumberField(TEXT("keysWritten"), KeysWritten);
+        Response->SetNumberField(TEXT("numKeys"), Controller.GetModel()->GetNumberOfKeys());
+        Response->SetBoolField(TEXT("resized"), bResize);
+        if (SkippedCurves.Num() > 0)
+        {
+            Response->SetArrayField(TEXT("skippedCurves"), SkippedCurves);
+        }
+        ANIM_SUCCESS_RESPONSE(FString::Printf(TEXT("Set %d bone tracks and %d curves (%d keys)"),
+            Tracks.Num(), Curves.Num() - SkippedCurves.Num(), KeysWritten));
+        AddAssetVerification(Response, Sequence);
+        return Response;
+#else
+        ANIM_ERROR_RESPONSE(TEXT("set_bone_tracks requires UE 5.1+"), TEXT("NOT_SUPPORTED"));
+#endif
+    }
+
     if (SubAction == TEXT("add_notify"))
     {
         FString AssetPath = NormalizeAnimPath(GetStringFieldAnimAuth(Params, TEXT("assetPath"), TEXT("")));
@@ -4,6 +4,9 @@
 #include "McpAutomationBridgeGlobals.h"
 #include "McpAutomationBridgeHelpers.h"
 #include "McpAutomationBridgeSubsystem.h"
+#include "McpDependencyGraph.h"
+#include "McpAssetSearchCursors.h"
+#include "McpJsonUtf8Writer.h"
 
 #if WITH_EDITOR
 #include "EditorAssetLibrary.h"
@@ -12,6 +15,179 @@
 #include "SourceControlOperations.h"
 #endif
 
+namespace {
+// The registry module is loaded during editor startup. Looking it up instead
+// of loading it keeps the query paths callable from the worker lane.
+IAssetRegistry &GetAssetRegistryForQuery() {
+  if (FAssetRegistryModule *Module =
+          FModuleManager::GetModulePtr<FAssetRegistryModule>(
+              TEXT("AssetRegistry"))) {
+    return Module->Get();
+  }
+  return FModuleManager::LoadModuleChecked<FAssetRegistryModule>(
+             TEXT("AssetRegistry"))
+      .Get();
+}
+
+// Short class names accepted by search_assets, all in /Script/Engine.
+struct FAssetSearchClassAlias {
+  const TCHAR *Alias;
+  const TCHAR *ClassName;
+};
+
+constexpr FAssetSearchClassAlias AssetSearchClassAliases[] = {
+    {TEXT("Blueprint"), TEXT("Blueprint")},
+    {TEXT("StaticMesh"), TEXT("StaticMesh")},
+    {TEXT("SkeletalMesh"), TEXT("SkeletalMesh")},
+    {TEXT("Material"), TEXT("Material")},
+    {TEXT("MaterialInstance"), TEXT("MaterialInstanceConstant")},
+    {TEXT("MaterialInstanceConstant"), TEXT("MaterialInstanceConstant")},
+    {TEXT("Texture2D"), TEXT("Texture2D")},
+    {TEXT("Level"), TEXT("World")},
+    {TEXT("World"), TEXT("World")},
+    {TEXT("SoundCue"), TEXT("SoundCue")},
+    {TEXT("SoundWave"), TEXT("SoundWave")},
+};
+
+// Adds a full class path or a known short name to the filter; false for a
+// short name that is not in the alias table.
+bool AddAssetSearchClassFilter(FARFilter &Filter, const FString &ClassName) {
+  if (ClassName.Contains(TEXT("/"))) {
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 1
+    Filter.ClassPaths.Add(FTopLevelAssetPath(ClassName));
+#else
+    // UE 5.0: Extract class name from path like "/Script/Engine.Blueprint"
+    int32 DotIndex;
+    if (ClassName.FindLastChar(TEXT('.'), DotIndex)) {
+      Filter.ClassNames.Add(FName(*ClassName.Mid(DotIndex + 1)));
+    } else {
+      Filter.ClassNames.Add(FName(*ClassName));
+    }
+#endif
+    return true;
+  }
+  for (const FAssetSearchClassAlias &Entry : AssetSearchClassAliases) {
+    if (ClassName.Equals(Entry.Alias, ESearchCase::IgnoreCase)) {
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 1
+      Filter.ClassPaths.Add(
+          FTopLevelAssetPath(TEXT("/Script/Engine"), Entry.ClassName));
+#else
+      Filter.ClassNames.Add(Entry.ClassName);
+#endif
+      return true;
+    }
+  }
+  return false;
+}
+
+// Which fields each search_assets entry carries. Without a "fields" list an
+// entry has the assetName, assetPath and classPath it always had.
+struct FAssetSearchProjection {
+  bool bName = true;
+  bool bPath = true;
+  bool bClass = true;
+  bool bPackagePath = false;
+  bool bPackageName = false;
+  TArray<FName> Tags;
+};
+
+bool ParseAssetSearchProjection(const TSharedPtr<FJsonObject> &Payload,
+                                FAssetSearchProjection &Out,
+                                FString &OutError) {
+  const TArray<TSharedPtr<FJsonValue>> *FieldsPtr = nullptr;
+  if (!Payload->TryGetArrayField(TEXT("fields"), FieldsPtr) || !FieldsPtr ||
+      FieldsPtr->Num() == 0) {
+    return true;
+  }
+  Out = FAssetSearchProjection();
+  Out.bName = Out.bPath = Out.bClass = false;
+  for (const TSharedPtr<FJsonValue> &Val : *FieldsPtr) {
+    const FString Field = Val.IsValid() ? Val->AsString() : FString();
+    if (Field.Equals(TEXT("name"), ESearchCase::IgnoreCase) ||
+        Field.Equals(TEXT("assetName"), ESearchCase::IgnoreCase)) {
+      Out.bName = true;
+    } else if (Field.Equals(TEXT("path"), ESearchCase::IgnoreCase) ||
+               Field.Equals(TEXT("assetPath"), ESearchCase::IgnoreCase) ||
+               Field.Equals(TEXT("objectPath"), ESearchCase::IgnoreCase)) {
+      Out.bPath = true;
+    } else if (Field.Equals(TEXT("class"), ESearchCase::IgnoreCase) ||
+               Field.Equals(TEXT("classPath"), ESearchCase::IgnoreCase)) {
+      Out.bClass = true;
+    } else if (Field.Equals(TEXT("packagePath"), ESearchCase::IgnoreCase)) {
+      Out.bPackagePath = true;
+    } else if (Field.Equals(TEXT("packageName"), ESearchCase::IgnoreCase)) {
+      Out.bPackageName = true;
+    } else if (Field.StartsWith(TEXT("tag:"), ESearchCase::IgnoreCase) &&
+               Field.Len() > 4) {
+      Out.Tags.AddUnique(FName(*Field.Mid(4)));
+    } else {
+      OutError = FString::Printf(
+          TEXT("Unknown search_assets field '%s' (expected name, path, class, "
+               "packagePath, packageName or tag:<TagName>)"),
+          *Field);
+      return false;
+    }
+  }
+  return true;
+}
+
+void WriteAssetSearchResult(FMcpJsonUtf8Writer &Writer,
+                            const TArray<FAssetData> &Assets,
+                            int32 TotalCount, const FString &NextCursor,
+                            const FAssetSearchProjection &Projection) {
+  Writer.BeginObject();
+  Writer.WriteBool(TEXT("success"), true);
+  Writer.Key(TEXT("assets"));
+  Writer.BeginArray();
+  FString TagValue;
+  for (const FAssetData &Data : Assets) {
+    Writer.BeginObject();
+    if (Projection.bName) {
+      Writer.WriteString(TEXT("assetName"), Data.AssetName.ToString());
+    }
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 1
+    if (Projection.bPath) {
+      Writer.WriteString(TEXT("assetPath"), Data.GetSoftObjectPath().ToString());
+    }
+    if (Projection.bClass) {
+      Writer.WriteString(TEXT("classPath"), Data.AssetClassPath.ToString());
+    }
+#else
+    if (Projection.bPath) {
+      Writer.WriteString(TEXT("assetPath"), Data.ToSoftObjectPath().ToString());
+    }
+    if (Projection.bClass) {
+      Writer.WriteString(TEXT("classPath"), Data.AssetClass.ToString());
+    }
+#endif
+    if (Projection.bPackagePath) {
+      Writer.WriteString(TEXT("packagePath"), Data.PackagePath.ToString());
+    }
+    if (Projection.bPackageName) {
+      Writer.WriteString(TEXT("packageName"), Data.PackageName.ToString());
+    }
+    if (Projection.Tags.Num() > 0) {
+      Writer.Key(TEXT("tags"));
+      Writer.BeginObject();
+      for (const FName &Tag : Projection.Tags) {
+        if (Data.GetTagValue(Tag, TagValue)) {
+          Writer.WriteString(Tag.ToString(), TagValue);
+        }
+      }
+      Writer.EndObject();
+    }
+    Writer.EndObject();
+  }
+  Writer.EndArray();
+  Writer.WriteInt(TEXT("count"), Assets.Num());
+  Writer.WriteInt(TEXT("totalCount"), TotalCount);
+  if (!NextCursor.IsEmpty()) {
+    Writer.WriteString(TEXT("nextCursor"), NextCursor);
+  }
+  Writer.EndObject();
+}
+} // namespace
+
 /**
  * @brief Handles "asset_query" actions from a websocket request and sends a JSON response or error back.
  *
@@ -47,9 +223,6 @@ bool UMcpAutomationBridgeSubsystem::HandleAssetQueryAction(
     bool bRecursive = false;
     Payload->TryGetBoolField(TEXT("recursive"), bRecursive);
 
-    FAssetRegistryModule &AssetRegistryModule =
-        FModuleManager::LoadModuleChecked<FAssetRegistryModule>(
-            "AssetRegistry");
     TArray<FName> Dependencies;
     // TODO: bRecursive naming is confusing - true = Hard dependencies (recursive), false = Soft dependencies
     // Consider renaming to bIncludeSoftDependencies or using an enum for clarity
@@ -57,9 +230,18 @@ bool UMcpAutomationBridgeSubsystem::HandleAssetQueryAction(
         bRecursive ? UE::AssetRegistry::EDependencyQuery::Hard
                    : UE::AssetRegistry::EDependencyQuery::Soft;
 
-    AssetRegistryModule.Get().GetDependencies(
-        FName(*AssetPath), Dependencies,
-        UE::AssetRegistry::EDependencyCategory::Package, Query);
+    FMcpDependencyQuery GraphQuery;
+    GraphQuery.Root = FName(*AssetPath);
+    GraphQuery.Strength = bRecursive ? EMcpDependencyStrength::Hard
+                                     : EMcpDependencyStrength::Soft;
+    FMcpDependencyWalk Walk;
+    if (FMcpDependencyGraph::Walk(GraphQuery, Walk)) {
+      Dependencies.Append(Walk.Packages.GetData() + 1, Walk.Packages.Num() - 1);
+    } else {
+      GetAssetRegistryForQuery().GetDependencies(
+          FName(*AssetPath), Dependencies,
+          UE::AssetRegistry::EDependencyCategory::Package, Query);
+    }
 
     TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
     TArray<TSharedPtr<FJsonValue>> DepArray;
@@ -111,10 +293,7 @@ bool UMcpAutomationBridgeSubsystem::HandleAssetQueryAction(
     }
 
     // Use AssetRegistry's cached data instead of loading assets
-    FAssetRegistryModule &AssetRegistryModule =
-        FModuleManager::LoadModuleChecked<FAssetRegistryModule>(
-            "AssetRegistry");
-    IAssetRegistry &AssetRegistry = AssetRegistryModule.Get();
+    IAssetRegistry &AssetRegistry = GetAssetRegistryForQuery();
     
     // REMOVED: ScanPathsSynchronous() was causing indefinite hangs when paths weren't indexed.
     // The AssetRegistry's GetAssets() already uses cached data and will return empty results
@@ -124,6 +303,8 @@ bool UMcpAutomationBridgeSubsystem::HandleAssetQueryAction(
     FARFilter Filter;
     Filter.PackagePaths.Add(FName(*SanitizedPath));
     Filter.bRecursivePaths = true;
+    // In-memory objects may only be enumerated on the game thread.
+    Filter.bIncludeOnlyOnDiskAssets = !IsInGameThread();
 
     TArray<FAssetData> AssetDataList;
     AssetRegistry.GetAssets(Filter, AssetDataList);
@@ -174,6 +355,47 @@ bool UMcpAutomationBridgeSubsystem::HandleAssetQueryAction(
                            TEXT("Assets found by tag"), Result);
     return true;
   } else if (SubAction == TEXT("search_assets")) {
+    FAssetSearchProjection Projection;
+    FString FieldError;
+    if (!ParseAssetSearchProjection(Payload, Projection, FieldError)) {
+      SendAutomationError(RequestingSocket, RequestId, FieldError,
+                          TEXT("INVALID_ARGUMENT"));
+      return true;
+    }
+
+    double PageSizeValue = 0.0;
+    Payload->TryGetNumberField(TEXT("pageSize"), PageSizeValue);
+    const int32 PageSize =
+        FMath::Clamp(static_cast<int32>(PageSizeValue), 0, 10000);
+
+    TArray<FAssetData> AssetDataList;
+    int32 TotalCount = 0;
+    FString NextCursor;
+
+    // Later pages come from the result set kept by the first one; the filter
+    // fields are not looked at again.
+    FString Cursor;
+    if (Payload->TryGetStringField(TEXT("cursor"), Cursor) &&
+        !Cursor.IsEmpty()) {
+      if (!AssetSearchCursors.IsValid() ||
+          !AssetSearchCursors->ReadPage(Cursor, PageSize > 0 ? PageSize : 100,
+                                        AssetDataList, TotalCount,
+                                        NextCursor)) {
+        SendAutomationError(
+            RequestingSocket, RequestId,
+            TEXT("Unknown or expired cursor; run the search again"),
+            TEXT("INVALID_CURSOR"));
+        return true;
+      }
+      FMcpJsonUtf8Writer Result;
+      WriteAssetSearchResult(Result, AssetDataList, TotalCount, NextCursor,
+                             Projection);
+      SendAutomationResponse(RequestingSocket, RequestId, true,
+                             TEXT("Assets found."), MoveTemp(Result),
+                             FString());
+      return true;
+    }
+
     FARFilter Filter;
 
     // Parse Class Names
@@ -182,108 +404,13 @@ bool UMcpAutomationBridgeSubsystem::HandleAssetQueryAction(
         ClassNamesPtr) {
       for (const TSharedPtr<FJsonValue> &Val : *ClassNamesPtr) {
         const FString ClassName = Val->AsString();
-        if (!ClassName.IsEmpty()) {
-          // Support both full paths and short names
-          if (ClassName.Contains(TEXT("/"))) {
-#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 1
-            Filter.ClassPaths.Add(FTopLevelAssetPath(ClassName));
-#else
-            // UE 5.0: Extract class name from path like "/Script/Engine.Blueprint"
-            int32 DotIndex;
-            if (ClassName.FindLastChar(TEXT('.'), DotIndex))
-            {
-              Filter.ClassNames.Add(FName(*ClassName.Mid(DotIndex + 1)));
-            }
-            else
-            {
-              Filter.ClassNames.Add(FName(*ClassName));
-            }
-#endif
-          } else {
-            // Map common short names to full paths
-            if (ClassName.Equals(TEXT("Blueprint"), ESearchCase::IgnoreCase)) {
-#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 1
-              Filter.ClassPaths.Add(FTopLevelAssetPath(TEXT("/Script/Engine"),
-                                                       TEXT("Blueprint")));
-#else
-              Filter.ClassNames.Add(TEXT("Blueprint"));
-#endif
-            } else if (ClassName.Equals(TEXT("StaticMesh"),
-                                        ESearchCase::IgnoreCase)) {
-#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 1
-              Filter.ClassPaths.Add(FTopLevelAssetPath(TEXT("/Script/Engine"),
-                                                       TEXT("StaticMesh")));
-#else
-              Filter.ClassNames.Add(TEXT("StaticMesh"));
-#endif
-            } else if (ClassName.Equals(TEXT("SkeletalMesh"),
-                                        ESearchCase::IgnoreCase)) {
-#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 1
-              Filter.ClassPaths.Add(FTopLevelAssetPath(TEXT("/Script/Engine"),
-                                                       TEXT("SkeletalMesh")));
-#else
-              Filter.ClassNames.Add(TEXT("SkeletalMesh"));
-#endif
-            } else if (ClassName.Equals(TEXT("Material"),
-                                        ESearchCase::IgnoreCase)) {
-#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 1
-              Filter.ClassPaths.Add(
-                  FTopLevelAssetPath(TEXT("/Script/Engine"), TEXT("Material")));
-#else
-              Filter.ClassNames.Add(TEXT("Material"));
-#endif
-            } else if (ClassName.Equals(TEXT("MaterialInstance"),
-                                        ESearchCase::IgnoreCase) ||
-                       ClassName.Equals(TEXT("MaterialInstanceConstant"),
-                                        ESearchCase::IgnoreCase)) {
-#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 1
-              Filter.ClassPaths.Add(FTopLevelAssetPath(
-                  TEXT("/Script/Engine"), TEXT("MaterialInstanceConstant")));
-#else
-              Filter.ClassNames.Add(TEXT("MaterialInstanceConstant"));
-#endif
-            } else if (ClassName.Equals(TEXT("Texture2D"),
-                                        ESearchCase::IgnoreCase)) {
-#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 1
-              Filter.ClassPaths.Add(FTopLevelAssetPath(TEXT("/Script/Engine"),
-                                                       TEXT("Texture2D")));
-#else
-              Filter.ClassNames.Add(TEXT("Texture2D"));
-#endif
-            } else if (ClassName.Equals(TEXT("Level"),
-                                        ESearchCase::IgnoreCase) ||
-                       ClassName.Equals(TEXT("World"),
-                                        ESearchCase::IgnoreCase)) {
-#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 1
-              Filter.ClassPaths.Add(
-                  FTopLevelAssetPath(TEXT("/Script/Engine"), TEXT("World")));
-#else
-              Filter.ClassNames.Add(TEXT("World"));
-#endif
-            } else if (ClassName.Equals(TEXT("SoundCue"),
-                                        ESearchCase::IgnoreCase)) {
-#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 1
-              Filter.ClassPaths.Add(
-                  FTopLevelAssetPath(TEXT("/Script/Engine"), TEXT("SoundCue")));
-#else
-              Filter.ClassNames.Add(TEXT("SoundCue"));
-#endif
-            } else if (ClassName.Equals(TEXT("SoundWave"),
-                                        ESearchCase::IgnoreCase)) {
-#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 1
-              Filter.ClassPaths.Add(FTopLevelAssetPath(TEXT("/Script/Engine"),
-                                                       TEXT("SoundWave")));
-#else
-              Filter.ClassNames.Add(TEXT("SoundWave"));
-#endif
-            } else {
-              UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
-                     TEXT("HandleAssetQueryAction: Could not resolve short "
-                          "class name '%s' to a TopLevelAssetPath. Please use "
-                          "full class path (e.g. /Script/Engine.Blueprint)."),
-                     *ClassName);
-            }
-          }
+        if (!ClassName.IsEmpty() &&
+            !AddAssetSearchClassFilter(Filter, ClassName)) {
+          UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
+                 TEXT("HandleAssetQueryAction: Could not resolve short "
+                      "class name '%s' to a TopLevelAssetPath. Please use "
+                      "full class path (e.g. /Script/Engine.Blueprint)."),
+                 *ClassName);
         }
       }
     }
@@ -344,56 +471,40 @@ bool UMcpAutomationBridgeSubsystem::HandleAssetQueryAction(
     if (Payload->HasField(TEXT("recursiveClasses")))
       Payload->TryGetBoolField(TEXT("recursiveClasses"), bRecursiveClasses);
     Filter.bRecursiveClasses = bRecursiveClasses;
+    // In-memory objects may only be enumerated on the game thread.
+    Filter.bIncludeOnlyOnDiskAssets = !IsInGameThread();
 
     // Execute Query with safety limit
-    FAssetRegistryModule &AssetRegistryModule =
-        FModuleManager::LoadModuleChecked<FAssetRegistryModule>(
-            "AssetRegistry");
-    IAssetRegistry &AssetRegistry = AssetRegistryModule.Get();
+    IAssetRegistry &AssetRegistry = GetAssetRegistryForQuery();
     
     // REMOVED: ScanPathsSynchronous() was causing indefinite hangs when paths weren't indexed.
     // The AssetRegistry's GetAssets() already uses cached data and will return empty results
     // for unscanned paths. The cache is populated automatically during editor startup.
     // If a path is not cached, the query returns empty results rather than blocking indefinitely.
     
-    TArray<FAssetData> AssetDataList;
     AssetRegistry.GetAssets(Filter, AssetDataList);
 
-    // Apply Limit
-    int32 Limit = 100;
+    // Without a page size the legacy limit of 100 applies; with one, only an
+    // explicit limit caps the result set that is paged through.
+    int32 Limit = PageSize > 0 ? 0 : 100;
     if (Payload->HasField(TEXT("limit")))
       Payload->TryGetNumberField(TEXT("limit"), Limit);
     if (Limit > 0 && AssetDataList.Num() > Limit) {
       AssetDataList.SetNum(Limit);
     }
+    TotalCount = AssetDataList.Num();
 
-    // Build Response
-    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-    TArray<TSharedPtr<FJsonValue>> AssetsArray;
-
-    for (const FAssetData &Data : AssetDataList) {
-      TSharedPtr<FJsonObject> AssetObj = MakeShared<FJsonObject>();
-      AssetObj->SetStringField(TEXT("assetName"), Data.AssetName.ToString());
-#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 1
-      AssetObj->SetStringField(TEXT("assetPath"),
-                               Data.GetSoftObjectPath().ToString());
-      AssetObj->SetStringField(TEXT("classPath"),
-                               Data.AssetClassPath.ToString());
-#else
-      AssetObj->SetStringField(TEXT("assetPath"),
-                               Data.ToSoftObjectPath().ToString());
-      AssetObj->SetStringField(TEXT("classPath"),
-                               Data.AssetClass.ToString());
-#endif
-      AssetsArray.Add(MakeShared<FJsonValueObject>(AssetObj));
+    if (PageSize > 0 && TotalCount > PageSize && AssetSearchCursors.IsValid()) {
+      TArray<FAssetData> FirstPage(AssetDataList.GetData(), PageSize);
+      NextCursor = AssetSearchCursors->Open(MoveTemp(AssetDataList), PageSize);
+      AssetDataList = MoveTemp(FirstPage);
     }
 
-    Result->SetBoolField(TEXT("success"), true);
-    Result->SetArrayField(TEXT("assets"), AssetsArray);
-    Result->SetNumberField(TEXT("count"), AssetsArray.Num());
-
+    FMcpJsonUtf8Writer Result;
+    WriteAssetSearchResult(Result, AssetDataList, TotalCount, NextCursor,
+                           Projection);
     SendAutomationResponse(RequestingSocket, RequestId, true,
-                           TEXT("Assets found."), Result);
+                           TEXT("Assets found."), MoveTemp(Result), FString());
     return true;
   }
 #if WITH_EDITOR
@@ -6,6 +6,7 @@
 #include "McpAutomationBridgeGlobals.h"
 #include "McpAutomationBridgeHelpers.h"
 #include "McpAutomationBridgeSubsystem.h"
+#include "McpDependencyGraph.h"
 #include "Misc/EngineVersionComparison.h"
 #include "Misc/ScopeExit.h"
 #include "UObject/MetaData.h"
@@ -114,6 +115,8 @@ bool UMcpAutomationBridgeSubsystem::HandleAssetAction(
     return HandleGenerateLODs(RequestId, Action, Payload, RequestingSocket);
   if (Lower == TEXT("nanite_rebuild_mesh"))
     return HandleNaniteRebuildMesh(RequestId, Action, Payload, RequestingSocket);
+  if (Lower == TEXT("bulk_build_meshes"))
+    return HandleBulkBuildMeshes(RequestId, Action, Payload, RequestingSocket);
   if (Lower == TEXT("source_control_checkout"))
     return HandleSourceControlCheckout(RequestId, Action, Payload, RequestingSocket);
   if (Lower == TEXT("source_control_submit"))
@@ -150,6 +153,7 @@ bool UMcpAutomationBridgeSubsystem::HandleAssetAction(
 #include "AssetViewUtils.h"
 #include "EditorAssetLibrary.h"
 #include "Engine/StaticMesh.h"
+#include "StaticMeshCompiler.h"
 #include "Factories/MaterialFactoryNew.h"
 #include "Factories/MaterialInstanceConstantFactoryNew.h"
 #include "FileHelpers.h"
@@ -1927,23 +1931,88 @@ bool UMcpAutomationBridgeSubsystem::HandleGetDependencies(
   bool bRecursive = false;
   Payload->TryGetBoolField(TEXT("recursive"), bRecursive);
 
-  FAssetRegistryModule &AssetRegistryModule =
-      FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-  TArray<FName> Dependencies;
-  UE::AssetRegistry::EDependencyCategory Category =
-      UE::AssetRegistry::EDependencyCategory::Package;
-  AssetRegistryModule.Get().GetDependencies(FName(*AssetPath), Dependencies);
-
-  TArray<TSharedPtr<FJsonValue>> DepArray;
-  for (const FName &Dep : Dependencies) {
-    DepArray.Add(MakeShared<FJsonValueString>(Dep.ToString()));
-  }
-
-  TSharedPtr<FJsonObject> Resp = MakeShared<FJsonObject>();
-  Resp->SetBoolField(TEXT("success"), true);
-  Resp->SetArrayField(TEXT("dependencies"), DepArray);
+  // recursive walks the whole closure unless maxDepth bounds it.
+  FMcpDependencyQuery Query;
+  Query.Root = FName(AssetPath.Contains(TEXT("."))
+                         ? *FPackageName::ObjectPathToPackageName(AssetPath)
+                         : *AssetPath);
+  Query.MaxDepth = bRecursive ? -1 : 1;
+  double MaxDepthValue = 0.0;
+  if (Payload->TryGetNumberField(TEXT("maxDepth"), MaxDepthValue)) {
+    Query.MaxDepth = FMath::Max(1, static_cast<int32>(MaxDepthValue));
+  }
+  FString Direction;
+  Payload->TryGetStringField(TEXT("direction"), Direction);
+  const bool bReferencers =
+      Direction.Equals(TEXT("referencers"), ESearchCase::IgnoreCase);
+  Query.Direction = bReferencers ? EMcpDependencyDirection::Referencers
+                                 : EMcpDependencyDirection::Dependencies;
+  FString DependencyType;
+  Payload->TryGetStringField(TEXT("dependencyType"), DependencyType);
+  if (DependencyType.Equals(TEXT("hard"), ESearchCase::IgnoreCase)) {
+    Query.Strength = EMcpDependencyStrength::Hard;
+  } else if (DependencyType.Equals(TEXT("soft"), ESearchCase::IgnoreCase)) {
+    Query.Strength = EMcpDependencyStrength::Soft;
+  }
+  Payload->TryGetStringField(TEXT("pathPrefix"), Query.PathPrefix);
+
+  FMcpDependencyWalk Walk;
+  if (!FMcpDependencyGraph::Walk(Query, Walk)) {
+    // Graph not available yet: answer the first level from the registry.
+    TArray<FName> Direct;
+    IAssetRegistry &AssetRegistry =
+        FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry")
+            .Get();
+    if (bReferencers) {
+      AssetRegistry.GetReferencers(Query.Root, Direct);
+    } else {
+      AssetRegistry.GetDependencies(Query.Root, Direct);
+    }
+    Walk.Packages.Add(Query.Root);
+    Walk.Depths.Add(0);
+    for (const FName &Package : Direct) {
+      Walk.Packages.Add(Package);
+      Walk.Depths.Add(1);
+    }
+  }
+
+  // The root itself is not listed.
+  const int32 TotalCount = Walk.Packages.Num() - 1;
+  double OffsetValue = 0.0;
+  Payload->TryGetNumberField(TEXT("offset"), OffsetValue);
+  const int32 Offset =
+      FMath::Clamp(static_cast<int32>(OffsetValue), 0, TotalCount);
+  double LimitValue = 0.0;
+  Payload->TryGetNumberField(TEXT("limit"), LimitValue);
+  const int32 Limit = static_cast<int32>(LimitValue);
+  const int32 End =
+      Limit > 0 ? FMath::Min(TotalCount, Offset + Limit) : TotalCount;
+
+  FMcpJsonUtf8Writer Resp;
+  Resp.BeginObject();
+  Resp.WriteBool(TEXT("success"), true);
+  Resp.Key(bReferencers ? TEXT("referencers") : TEXT("dependencies"));
+  Resp.BeginArray();
+  for (int32 Index = Offset; Index < End; ++Index) {
+    Resp.String(Walk.Packages[Index + 1].ToString());
+  }
+  Resp.EndArray();
+  Resp.Key(TEXT("depths"));
+  Resp.BeginArray();
+  for (int32 Index = Offset; Index < End; ++Index) {
+    Resp.Int(Walk.Depths[Index + 1]);
+  }
+  Resp.EndArray();
+  Resp.WriteInt(TEXT("count"), End - Offset);
+  Resp.WriteInt(TEXT("totalCount"), TotalCount);
+  Resp.WriteInt(TEXT("offset"), Offset);
+  if (End < TotalCount) {
+    Resp.WriteInt(TEXT("nextOffset"), End);
+  }
+  Resp.EndObject();
   SendAutomationResponse(Socket, RequestId, true,
-                         TEXT("Dependencies retrieved"), Resp, FString());
+                         TEXT("Dependencies retrieved"), MoveTemp(Resp),
+                         FString());
   return true;
 #else
   SendAutomationError(RequestingSocket, RequestId, TEXT("Editor build required"), TEXT("NOT_SUPPORTED"));
@@ -1988,46 +2057,65 @@ bool UMcpAutomationBridgeSubsystem::HandleGetAssetGraph(
   int32 MaxDepth = 3;
   Payload->TryGetNumberField(TEXT("maxDepth"), MaxDepth);
 
-  FAssetRegistryModule &AssetRegistryModule =
-      FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-  IAssetRegistry &AssetRegistry = AssetRegistryModule.Get();
-
   TSharedPtr<FJsonObject> GraphObj = MakeShared<FJsonObject>();
 
-  TArray<FString> Queue;
-  Queue.Add(AssetPath);
+  FMcpDependencyQuery Query;
+  Query.Root = FName(*AssetPath);
+  Query.MaxDepth = FMath::Max(0, MaxDepth);
+  Query.PathPrefix = TEXT("/Game"); // Only graph Game assets for now
+  Query.bCollectEdges = true;
+  FMcpDependencyWalk Walk;
+  if (FMcpDependencyGraph::Walk(Query, Walk)) {
+    for (int32 Index = 0; Index < Walk.Packages.Num(); ++Index) {
+      TArray<TSharedPtr<FJsonValue>> DepArray;
+      for (int32 Edge = Walk.NeighbourOffsets[Index];
+           Edge < Walk.NeighbourOffsets[Index + 1]; ++Edge) {
+        DepArray.Add(
+            MakeShared<FJsonValueString>(Walk.Neighbours[Edge].ToString()));
+      }
+      GraphObj->SetArrayField(Walk.Packages[Index].ToString(), DepArray);
+    }
+  } else {
+    FAssetRegistryModule &AssetRegistryModule =
+        FModuleManager::LoadModuleChecked<FAssetRegistryModule>(
+            "AssetRegistry");
+    IAssetRegistry &AssetRegistry = AssetRegistryModule.Get();
+
+    TArray<FString> Queue;
+    Queue.Add(AssetPath);
 
-  TSet<FString> Visited;
-  Visited.Add(AssetPath);
+    TSet<FString> Visited;
+    Visited.Add(AssetPath);
 
-  TMap<FString, int32> Depths;
-  Depths.Add(AssetPath, 0);
+    TMap<FString, int32> Depths;
+    Depths.Add(AssetPath, 0);
 
-  int32 Head = 0;
-  while (Head < Queue.Num()) {
-    FString Current = Queue[Head++];
-    int32 CurrentDepth = Depths[Current];
+    int32 Head = 0;
+    while (Head < Queue.Num()) {
+      FString Current = Queue[Head++];
+      int32 CurrentDepth = Depths[Current];
 
-    TArray<FName> Dependencies;
-    AssetRegistry.GetDependencies(FName(*Current), Dependencies);
+      TArray<FName> Dependencies;
+      AssetRegistry.GetDependencies(FName(*Current), Dependencies);
 
-    TArray<TSharedPtr<FJsonValue>> DepArray;
-    for (const FName &Dep : Dependencies) {
-      FString DepStr = Dep.ToString();
-      if (!DepStr.StartsWith(TEXT("/Game")))
-        continue; // Only graph Game assets for now
+      TArray<TSharedPtr<FJsonValue>> DepArray;
+      for (const FName &Dep : Dependencies) {
+        FString DepStr = Dep.ToString();
+        if (!DepStr.StartsWith(TEXT("/Game")))
+          continue; // Only graph Game assets for now
 
-      DepArray.Add(MakeShared<FJsonValueString>(DepStr));
+        DepArray.Add(MakeShared<FJsonValueString>(DepStr));
 
-      if (CurrentDepth < MaxDepth) {
-        if (!Visited.Contains(DepStr)) {
-          Visited.Add(DepStr);
-          Depths.Add(DepStr, CurrentDepth + 1);
-          Queue.Add(DepStr);
+        if (CurrentDepth < MaxDepth) {
+          if (!Visited.Contains(DepStr)) {
+            Visited.Add(DepStr);
+            Depths.Add(DepStr, CurrentDepth + 1);
+            Queue.Add(DepStr);
+          }
         }
       }
+      GraphObj->SetArrayField(Current, DepArray);
     }
-    GraphObj->SetArrayField(Current, DepArray);
   }
 
   TSharedPtr<FJsonObject> Resp = MakeShared<FJsonObject>();
@@ -2402,44 +2490,49 @@ bool UMcpAutomationBridgeSubsystem::HandleListAssets(
     // immediate subfolders of the requested path.
   }
 
-  TArray<TSharedPtr<FJsonValue>> AssetsArray;
+  // Large projects return thousands of entries; stream them as UTF-8 rather
+  // than building a JSON object per asset.
+  FMcpJsonUtf8Writer Resp;
+  Resp.BeginObject();
+  Resp.WriteBool(TEXT("success"), true);
+  Resp.Key(TEXT("assets"));
+  Resp.BeginArray();
   for (const FAssetData &Asset : AssetList) {
-    TSharedPtr<FJsonObject> AssetObj = MakeShared<FJsonObject>();
-    AssetObj->SetStringField(TEXT("name"), Asset.AssetName.ToString());
+    Resp.BeginObject();
+    Resp.WriteString(TEXT("name"), Asset.AssetName.ToString());
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
-    AssetObj->SetStringField(TEXT("path"), Asset.GetSoftObjectPath().ToString());
-    AssetObj->SetStringField(TEXT("class"), Asset.AssetClassPath.ToString());
+    Resp.WriteString(TEXT("path"), Asset.GetSoftObjectPath().ToString());
+    Resp.WriteString(TEXT("class"), Asset.AssetClassPath.ToString());
 #else
-    AssetObj->SetStringField(TEXT("path"), Asset.ToSoftObjectPath().ToString());
-    AssetObj->SetStringField(TEXT("class"), Asset.AssetClass.ToString());
+    Resp.WriteString(TEXT("path"), Asset.ToSoftObjectPath().ToString());
+    Resp.WriteString(TEXT("class"), Asset.AssetClass.ToString());
 #endif
-    AssetObj->SetStringField(TEXT("packagePath"), Asset.PackagePath.ToString());
+    Resp.WriteString(TEXT("packagePath"), Asset.PackagePath.ToString());
 
     // Add tags for context if requested
-    TArray<TSharedPtr<FJsonValue>> Tags;
+    Resp.Key(TEXT("tags"));
+    Resp.BeginArray();
     for (auto TagPair : Asset.TagsAndValues) {
-      Tags.Add(MakeShared<FJsonValueString>(TagPair.Key.ToString()));
+      Resp.String(TagPair.Key.ToString());
     }
-    AssetObj->SetArrayField(TEXT("tags"), Tags);
-
-    AssetsArray.Add(MakeShared<FJsonValueObject>(AssetObj));
+    Resp.EndArray();
+    Resp.EndObject();
   }
+  Resp.EndArray();
 
-  TArray<TSharedPtr<FJsonValue>> FoldersJson;
+  Resp.Key(TEXT("folders"));
+  Resp.BeginArray();
   for (const FString &SubPath : SubPathList) {
-    FoldersJson.Add(MakeShared<FJsonValueString>(SubPath));
+    Resp.String(SubPath);
   }
+  Resp.EndArray();
+  Resp.WriteInt(TEXT("totalCount"), TotalCount);
+  Resp.WriteInt(TEXT("count"), AssetList.Num());
+  Resp.WriteInt(TEXT("offset"), Offset);
+  Resp.EndObject();
 
-  TSharedPtr<FJsonObject> Resp = MakeShared<FJsonObject>();
-  Resp->SetBoolField(TEXT("success"), true);
-  Resp->SetArrayField(TEXT("assets"), AssetsArray);
-  Resp->SetArrayField(TEXT("folders"), FoldersJson);
-  Resp->SetNumberField(TEXT("totalCount"), TotalCount);
-  Resp->SetNumberField(TEXT("count"), AssetsArray.Num());
-  Resp->SetNumberField(TEXT("offset"), Offset);
-
-  SendAutomationResponse(Socket, RequestId, true, TEXT("Assets listed"), Resp,
-                         FString());
+  SendAutomationResponse(Socket, RequestId, true, TEXT("Assets listed"),
+                         MoveTemp(Resp), FString());
   return true;
 #else
   SendAutomationError(RequestingSocket, RequestId, TEXT("Editor build required"), TEXT("NOT_SUPPORTED"));
@@ -3181,6 +3274,27 @@ bool UMcpAutomationBridgeSubsystem::HandleGetMaterialStats(
 #endif
 }
 
+#if WITH_EDITOR
+// Gives Mesh NumLODs source models, each reducing to half the triangles of
+// the one before (50%, 25%, 12.5%...). The caller builds the mesh.
+static void ConfigureProgressiveLODs(UStaticMesh *Mesh, int32 NumLODs) {
+  Mesh->SetNumSourceModels(NumLODs);
+  for (int32 LODIndex = 1; LODIndex < NumLODs; LODIndex++) {
+    FStaticMeshSourceModel &SourceModel = Mesh->GetSourceModel(LODIndex);
+    FMeshReductionSettings &ReductionSettings = SourceModel.ReductionSettings;
+
+    float ReductionPercent =
+        1.0f / FMath::Pow(2.0f, static_cast<float>(LODIndex));
+    ReductionSettings.PercentTriangles = ReductionPercent;
+    ReductionSettings.PercentVertices = ReductionPercent;
+
+    SourceModel.BuildSettings.bRecomputeNormals = false;
+    SourceModel.BuildSettings.bRecomputeTangents = false;
+    SourceModel.BuildSettings.bUseMikkTSpace = true;
+  }
+}
+#endif
+
 bool UMcpAutomationBridgeSubsystem::HandleGenerateLODs(
     const FString &RequestId, const FString &Action,
     const TSharedPtr<FJsonObject> &Payload,
@@ -3293,25 +3407,7 @@ bool UMcpAutomationBridgeSubsystem::HandleGenerateLODs(
                TEXT("Generating %d LODs for static mesh %s"), NumLODs, *Path);
 
         Mesh->Modify();
-        Mesh->SetNumSourceModels(NumLODs);
-
-        // Configure LOD reduction settings with progressive reduction
-        for (int32 LODIndex = 1; LODIndex < NumLODs; LODIndex++) {
-          FStaticMeshSourceModel &SourceModel = Mesh->GetSourceModel(LODIndex);
-          FMeshReductionSettings &ReductionSettings =
-              SourceModel.ReductionSettings;
-
-          // Progressive reduction: 50%, 25%, 12.5%...
-          float ReductionPercent =
-              1.0f / FMath::Pow(2.0f, static_cast<float>(LODIndex));
-          ReductionSettings.PercentTriangles = ReductionPercent;
-          ReductionSettings.PercentVertices = ReductionPercent;
-
-          // Enable reduction for this LOD level
-          SourceModel.BuildSettings.bRecomputeNormals = false;
-          SourceModel.BuildSettings.bRecomputeTangents = false;
-          SourceModel.BuildSettings.bUseMikkTSpace = true;
-        }
+        ConfigureProgressiveLODs(Mesh, NumLODs);
 
         // Build the mesh with new LOD settings
         Mesh->Build();
@@ -3478,6 +3574,49 @@ bool UMcpAutomationBridgeSubsystem::HandleGetMetadata(
 // Stub implementations for functions declared in header but removed from implementation
 // These functions are referenced by the dispatcher but were removed due to API changes
 
+#if WITH_EDITOR && ENGINE_MAJOR_VERSION >= 5
+// Writes the Nanite settings shared by nanite_rebuild_mesh and
+// bulk_build_meshes. Percentages are 0-100. The caller rebuilds the mesh.
+static void ApplyNaniteSettings(UStaticMesh *StaticMesh, bool bEnableNanite,
+                                bool bPreserveArea, double TrianglePercent,
+                                double FallbackPercent) {
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 7
+  // UE 5.7+: Use accessor functions to avoid deprecation warnings
+  FMeshNaniteSettings Settings = StaticMesh->GetNaniteSettings();
+  Settings.bEnabled = bEnableNanite;
+  Settings.PositionPrecision = 8; // Default precision
+  
+  // bPreserveArea replaced with ShapePreservation enum
+  if (bPreserveArea) {
+    Settings.ShapePreservation = ENaniteShapePreservation::PreserveArea;
+  } else {
+    Settings.ShapePreservation = ENaniteShapePreservation::None;
+  }
+  Settings.KeepPercentTriangles = static_cast<float>(TrianglePercent / 100.0);
+  Settings.FallbackPercentTriangles = static_cast<float>(FallbackPercent / 100.0);
+  if (FallbackPercent > 0.0) {
+    Settings.GenerateFallback = ENaniteGenerateFallback::Enabled;
+  } else {
+    Settings.GenerateFallback = ENaniteGenerateFallback::PlatformDefault;
+  }
+  StaticMesh->SetNaniteSettings(Settings);
+#elif ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
+  // UE 5.1-5.6: Uses KeepPercentTriangles, FallbackPercentTriangles, and bPreserveArea
+  StaticMesh->NaniteSettings.bEnabled = bEnableNanite;
+  StaticMesh->NaniteSettings.PositionPrecision = 8;
+  StaticMesh->NaniteSettings.bPreserveArea = bPreserveArea;
+  StaticMesh->NaniteSettings.KeepPercentTriangles = static_cast<float>(TrianglePercent / 100.0);
+  StaticMesh->NaniteSettings.FallbackPercentTriangles = static_cast<float>(FallbackPercent / 100.0);
+#else
+  // UE 5.0: Uses KeepPercentTriangles (no bPreserveArea)
+  StaticMesh->NaniteSettings.bEnabled = bEnableNanite;
+  StaticMesh->NaniteSettings.PositionPrecision = 8;
+  StaticMesh->NaniteSettings.KeepPercentTriangles = static_cast<float>(TrianglePercent / 100.0);
+  StaticMesh->NaniteSettings.FallbackPercentTriangles = static_cast<float>(FallbackPercent / 100.0);
+#endif
+}
+#endif
+
 bool UMcpAutomationBridgeSubsystem::HandleNaniteRebuildMesh(
     const FString &RequestId, const FString &Action,
     const TSharedPtr<FJsonObject> &Payload,
@@ -3530,40 +3669,10 @@ bool UMcpAutomationBridgeSubsystem::HandleNaniteRebuildMesh(
   TrianglePercent = FMath::Clamp(TrianglePercent, 0.0, 100.0);
   FallbackPercent = FMath::Clamp(FallbackPercent, 0.0, 100.0);
 
+  ApplyNaniteSettings(StaticMesh, bEnableNanite, bPreserveArea, TrianglePercent,
+                      FallbackPercent);
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 7
-  // UE 5.7+: Use accessor functions to avoid deprecation warnings
-  FMeshNaniteSettings Settings = StaticMesh->GetNaniteSettings();
-  Settings.bEnabled = bEnableNanite;
-  Settings.PositionPrecision = 8; // Default precision
-  
-  // bPreserveArea replaced with ShapePreservation enum
-  if (bPreserveArea) {
-    Settings.ShapePreservation = ENaniteShapePreservation::PreserveArea;
-  } else {
-    Settings.ShapePreservation = ENaniteShapePreservation::None;
-  }
-  Settings.KeepPercentTriangles = static_cast<float>(TrianglePercent / 100.0);
-  Settings.FallbackPercentTriangles = static_cast<float>(FallbackPercent / 100.0);
-  if (FallbackPercent > 0.0) {
-    Settings.GenerateFallback = ENaniteGenerateFallback::Enabled;
-  } else {
-    Settings.GenerateFallback = ENaniteGenerateFallback::PlatformDefault;
-  }
-  StaticMesh->SetNaniteSettings(Settings);
   StaticMesh->NotifyNaniteSettingsChanged();
-#elif ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
-  // UE 5.1-5.6: Uses KeepPercentTriangles, FallbackPercentTriangles, and bPreserveArea
-  StaticMesh->NaniteSettings.bEnabled = bEnableNanite;
-  StaticMesh->NaniteSettings.PositionPrecision = 8;
-  StaticMesh->NaniteSettings.bPreserveArea = bPreserveArea;
-  StaticMesh->NaniteSettings.KeepPercentTriangles = static_cast<float>(TrianglePercent / 100.0);
-  StaticMesh->NaniteSettings.FallbackPercentTriangles = static_cast<float>(FallbackPercent / 100.0);
-#else
-  // UE 5.0: Uses KeepPercentTriangles (no bPreserveArea)
-  StaticMesh->NaniteSettings.bEnabled = bEnableNanite;
-  StaticMesh->NaniteSettings.PositionPrecision = 8;
-  StaticMesh->NaniteSettings.KeepPercentTriangles = static_cast<float>(TrianglePercent / 100.0);
-  StaticMesh->NaniteSettings.FallbackPercentTriangles = static_cast<float>(FallbackPercent / 100.0);
 #endif
 
   // Mark mesh as modified
@@ -3590,6 +3699,253 @@ bool UMcpAutomationBridgeSubsystem::HandleNaniteRebuildMesh(
 #endif
 }
 
+bool UMcpAutomationBridgeSubsystem::HandleBulkBuildMeshes(
+    const FString &RequestId, const FString &Action,
+    const TSharedPtr<FJsonObject> &Payload,
+    TSharedPtr<FMcpBridgeWebSocket> Socket) {
+  const FString Lower = Action.ToLower();
+  if (!Lower.Equals(TEXT("bulk_build_meshes"), ESearchCase::IgnoreCase)) {
+    return false;
+  }
+
+#if WITH_EDITOR && ENGINE_MAJOR_VERSION >= 5
+  if (!Payload.IsValid()) {
+    SendAutomationError(Socket, RequestId,
+                        TEXT("bulk_build_meshes payload missing"),
+                        TEXT("INVALID_PAYLOAD"));
+    return true;
+  }
+
+  // 0 leaves the mesh's LODs as they are.
+  int32 NumLODs = 0;
+  Payload->TryGetNumberField(TEXT("lodCount"), NumLODs);
+  NumLODs = FMath::Clamp(NumLODs, 0, 50);
+
+  // Nanite settings are only touched when enableNanite is given.
+  bool bEnableNanite = false;
+  const bool bSetNanite =
+      Payload->TryGetBoolField(TEXT("enableNanite"), bEnableNanite);
+  bool bPreserveArea = true;
+  double TrianglePercent = 100.0;
+  double FallbackPercent = 0.0;
+  Payload->TryGetBoolField(TEXT("preserveArea"), bPreserveArea);
+  Payload->TryGetNumberField(TEXT("trianglePercent"), TrianglePercent);
+  Payload->TryGetNumberField(TEXT("fallbackPercent"), FallbackPercent);
+  TrianglePercent = FMath::Clamp(TrianglePercent, 0.0, 100.0);
+  FallbackPercent = FMath::Clamp(FallbackPercent, 0.0, 100.0);
+
+  if (NumLODs == 0 && !bSetNanite) {
+    SendAutomationError(Socket, RequestId,
+                        TEXT("lodCount or enableNanite required"),
+                        TEXT("INVALID_ARGUMENT"));
+    return true;
+  }
+
+  bool bSave = true;
+  Payload->TryGetBoolField(TEXT("save"), bSave);
+
+  // Meshes handed to the compiling manager at once; bounds the memory held
+  // by in-flight reductions and Nanite builds.
+  int32 BatchSize = 32;
+  Payload->TryGetNumberField(TEXT("batchSize"), BatchSize);
+  BatchSize = FMath::Clamp(BatchSize, 1, 256);
+
+  TArray<FString> Paths;
+  const TArray<TSharedPtr<FJsonValue>> *AssetPathsArray = nullptr;
+  if (Payload->TryGetArrayField(TEXT("assetPaths"), AssetPathsArray) &&
+      AssetPathsArray) {
+    for (const TSharedPtr<FJsonValue> &Val : *AssetPathsArray) {
+      if (Val.IsValid() && Val->Type == EJson::String) {
+        const FString SafePath = SanitizeProjectRelativePath(Val->AsString());
+        if (!SafePath.IsEmpty()) {
+          Paths.AddUnique(SafePath);
+        }
+      }
+    }
+  }
+
+  FString FolderPath;
+  if (Payload->TryGetStringField(TEXT("folderPath"), FolderPath) &&
+      !FolderPath.IsEmpty()) {
+    const FString SafeFolder = SanitizeProjectRelativePath(FolderPath);
+    if (SafeFolder.IsEmpty()) {
+      SendAutomationError(
+          Socket, RequestId,
+          FString::Printf(TEXT("Invalid or unsafe folder path: %s"), *FolderPath),
+          TEXT("SECURITY_VIOLATION"));
+      return true;
+    }
+    bool bRecursive = true;
+    Payload->TryGetBoolField(TEXT("recursive"), bRecursive);
+
+    IAssetRegistry &AssetRegistry =
+        FModuleManager::LoadModuleChecked<FAssetRegistryModule>(
+            TEXT("AssetRegistry"))
+            .Get();
+    FARFilter Filter;
+    Filter.PackagePaths.Add(FName(*SafeFolder));
+    Filter.bRecursivePaths = bRecursive;
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
+    Filter.ClassPaths.Add(UStaticMesh::StaticClass()->GetClassPathName());
+#else
+    Filter.ClassNames.Add(UStaticMesh::StaticClass()->GetFName());
+#endif
+    TArray<FAssetData> AssetDataList;
+    AssetRegistry.GetAssets(Filter, AssetDataList);
+    for (const FAssetData &AssetData : AssetDataList) {
+      Paths.AddUnique(AssetData.ToSoftObjectPath().ToString());
+    }
+  }
+
+  if (Paths.Num() == 0) {
+    SendAutomationError(Socket, RequestId,
+                        TEXT("assetPaths or folderPath with static meshes required"),
+                        TEXT("INVALID_ARGUMENT"));
+    return true;
+  }
+
+  const double StartTime = FPlatformTime::Seconds();
+  TArray<FString> NotFoundPaths;
+  TArray<FString> NotMeshPaths;
+  TArray<TSharedPtr<FJsonValue>> Results;
+  int32 Processed = 0;
+  int32 Finished = 0;
+  bool bCancelled = false;
+
+  for (int32 BatchStart = 0; BatchStart < Paths.Num() && !bCancelled;
+       BatchStart += BatchSize) {
+    const int32 BatchEnd = FMath::Min(BatchStart + BatchSize, Paths.Num());
+
+    // Settings are written here on the game thread; the builds themselves
+    // run wherever FStaticMeshCompilingManager schedules them.
+    TArray<UStaticMesh *> Meshes;
+    TArray<FString> MeshPaths;
+    for (int32 Index = BatchStart; Index < BatchEnd; ++Index) {
+      if (IsAutomationRequestCancelled(RequestId)) {
+        bCancelled = true;
+        break;
+      }
+      const FString &Path = Paths[Index];
+      UObject *Obj = LoadObject<UObject>(nullptr, *Path);
+      UStaticMesh *Mesh = Cast<UStaticMesh>(Obj);
+      if (!Mesh) {
+        (Obj ? NotMeshPaths : NotFoundPaths).Add(Path);
+        ++Finished;
+        continue;
+      }
+      Mesh->Modify();
+      if (NumLODs > 0) {
+        ConfigureProgressiveLODs(Mesh, NumLODs);
+      }
+      if (bSetNanite) {
+        ApplyNaniteSettings(Mesh, bEnableNanite, bPreserveArea,
+                            TrianglePercent, FallbackPercent);
+      }
+      Meshes.Add(Mesh);
+      MeshPaths.Add(Path);
+    }
+    if (Meshes.Num() == 0) {
+      continue;
+    }
+
+    // With async static mesh compilation (the editor default) BatchBuild
+    // queues every mesh on the compiling manager's worker pool and returns;
+    // otherwise it builds them before returning.
+    UStaticMesh::FBuildParameters BuildParameters;
+    BuildParameters.bInSilent = true;
+    UStaticMesh::BatchBuild(Meshes, BuildParameters);
+
+    for (int32 Index = 0; Index < Meshes.Num(); ++Index) {
+      UStaticMesh *Mesh = Meshes[Index];
+      FStaticMeshCompilingManager::Get().FinishCompilation({Mesh});
+      Mesh->MarkPackageDirty();
+      if (bSave) {
+        QueueAssetSave(Mesh);
+      }
+      ++Processed;
+      ++Finished;
+
+      TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
+      Entry->SetStringField(TEXT("path"), MeshPaths[Index]);
+      Entry->SetNumberField(TEXT("lodCount"), Mesh->GetNumSourceModels());
+      Entry->SetBoolField(TEXT("naniteEnabled"), Mesh->IsNaniteEnabled());
+      Entry->SetNumberField(TEXT("triangles"),
+                            Mesh->GetRenderData() ? Mesh->GetNumTriangles(0) : 0);
+      Results.Add(MakeShared<FJsonValueObject>(Entry));
+
+      if (!SendProgressUpdate(
+              RequestId, 100.0f * Finished / Paths.Num(),
+              FString::Printf(TEXT("Built %s (%d/%d)"), *MeshPaths[Index],
+                              Finished, Paths.Num()))) {
+        // Meshes already queued in this batch finish anyway; later batches
+        // are not started.
+        bCancelled = true;
+      }
+    }
+  }
+
+  // Written through the dispatch's save queue so every built package is
+  // saved in one pass and reported here.
+  TArray<FMcpAssetSaveResult> SaveResults;
+  FMcpAssetSaveQueue::Flush(&SaveResults);
+
+  TSharedPtr<FJsonObject> Resp = MakeShared<FJsonObject>();
+  Resp->SetNumberField(TEXT("requested"), Paths.Num());
+  Resp->SetNumberField(TEXT("processed"), Processed);
+  Resp->SetArrayField(TEXT("meshes"), Results);
+  Resp->SetBoolField(TEXT("cancelled"), bCancelled);
+  Resp->SetNumberField(TEXT("durationMs"),
+                       (FPlatformTime::Seconds() - StartTime) * 1000.0);
+  if (NotFoundPaths.Num() > 0) {
+    TArray<TSharedPtr<FJsonValue>> NotFoundArray;
+    for (const FString &P : NotFoundPaths) {
+      NotFoundArray.Add(MakeShared<FJsonValueString>(P));
+    }
+    Resp->SetArrayField(TEXT("notFoundPaths"), NotFoundArray);
+  }
+  if (NotMeshPaths.Num() > 0) {
+    TArray<TSharedPtr<FJsonValue>> NotMeshArray;
+    for (const FString &P : NotMeshPaths) {
+      NotMeshArray.Add(MakeShared<FJsonValueString>(P));
+    }
+    Resp->SetArrayField(TEXT("notMeshPaths"), NotMeshArray);
+  }
+  int32 SaveFailed = 0;
+  TArray<TSharedPtr<FJsonValue>> Saves;
+  for (const FMcpAssetSaveResult &Save : SaveResults) {
+    TSharedPtr<FJsonObject> SaveObj = MakeShared<FJsonObject>();
+    SaveObj->SetStringField(TEXT("package"), Save.PackageName);
+    SaveObj->SetBoolField(TEXT("saved"), Save.bSaved);
+    Saves.Add(MakeShared<FJsonValueObject>(SaveObj));
+    SaveFailed += Save.bSaved ? 0 : 1;
+  }
+  Resp->SetArrayField(TEXT("saves"), Saves);
+  Resp->SetNumberField(TEXT("saveFailed"), SaveFailed);
+
+  if (bCancelled) {
+    SendAutomationResponse(
+        Socket, RequestId, false,
+        FString::Printf(TEXT("Cancelled after building %d of %d mesh(es)"),
+                        Processed, Paths.Num()),
+        Resp, TEXT("CANCELLED"));
+  } else if (Processed == 0) {
+    SendAutomationResponse(Socket, RequestId, false,
+                           TEXT("No static meshes were built"), Resp,
+                           TEXT("ASSET_NOT_FOUND"));
+  } else {
+    SendAutomationResponse(
+        Socket, RequestId, true,
+        FString::Printf(TEXT("Built %d mesh(es)"), Processed), Resp, FString());
+  }
+  return true;
+#else
+  SendAutomationResponse(Socket, RequestId, false,
+                         TEXT("bulk_build_meshes requires UE 5.0+ editor build"),
+                         nullptr, TEXT("NOT_IMPLEMENTED"));
+  return true;
+#endif
+}
+
 bool UMcpAutomationBridgeSubsystem::HandleFindByTag(
     const FString &RequestId, const FString &Action,
     const TSharedPtr<FJsonObject> &Payload,
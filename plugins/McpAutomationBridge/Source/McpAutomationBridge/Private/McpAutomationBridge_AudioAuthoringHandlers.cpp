@@ -18,6 +18,19 @@
 #include "EditorAssetLibrary.h"
 #include "UObject/SavePackage.h"
 #include "Misc/PackageName.h"
+#include "AssetImportTask.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "Audio.h"
+#include "Editor.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Interfaces/ITargetPlatform.h"
+#include "Interfaces/ITargetPlatformManagerModule.h"
+#include "McpAssetSaveQueue.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "TimerManager.h"
 
 // Audio Core
 #include "Sound/SoundCue.h"
@@ -262,6 +275,804 @@ static USoundMix* LoadSoundMixFromPath(const FString& MixPath)
     return Cast<USoundMix>(StaticLoadObject(USoundMix::StaticClass(), nullptr, *NormalizedPath));
 }
 
+#if MCP_HAS_METASOUND && MCP_HAS_METASOUND_FRONTEND
+// Maps the short node types add_metasound_node and build_metasound_graph accept to class names;
+// anything else is taken as a class name as-is.
+static FString ResolveMetaSoundNodeClassName(const FString& NodeType)
+{
+    const FString NodeTypeLower = NodeType.ToLower();
+    if (NodeTypeLower == TEXT("oscillator") || NodeTypeLower == TEXT("sine"))
+    {
+        return TEXT("Metasound.Sine");
+    }
+    if (NodeTypeLower == TEXT("gain") || NodeTypeLower == TEXT("multiply"))
+    {
+        return TEXT("Metasound.Multiply");
+    }
+    if (NodeTypeLower == TEXT("add"))
+    {
+        return TEXT("Metasound.Add");
+    }
+    if (NodeTypeLower == TEXT("waveplayer"))
+    {
+        return TEXT("Metasound.WavePlayer");
+    }
+    return NodeType;
+}
+
+// Converts a JSON default to a MetaSound literal: booleans and strings as-is, numbers as Int32
+// when the vertex type says so and as Float otherwise.
+static bool MakeMetaSoundLiteral(const TSharedPtr<FJsonValue>& Value, const FString& TypeName, FMetasoundFrontendLiteral& OutLiteral)
+{
+    if (!Value.IsValid())
+    {
+        return false;
+    }
+    switch (Value->Type)
+    {
+        case EJson::Boolean:
+            OutLiteral.Set(Value->AsBool());
+            return true;
+        case EJson::Number:
+            if (TypeName.Contains(TEXT("Int32")))
+            {
+                OutLiteral.Set(static_cast<int32>(Value->AsNumber()));
+            }
+            else
+            {
+                OutLiteral.Set(static_cast<float>(Value->AsNumber()));
+            }
+            return true;
+        case EJson::String:
+            OutLiteral.Set(Value->AsString());
+            return true;
+        default:
+            return false;
+    }
+}
+
+// One endpoint of a build_metasound_graph connection, "node.pin" or split fields.
+struct FMetaSoundSpecEndpoint
+{
+    FString Node;
+    FString Pin;
+};
+
+static bool ParseMetaSoundSpecEndpoint(const TSharedPtr<FJsonObject>& Connection, const TCHAR* Combined, const TCHAR* NodeField,
+    const TCHAR* PinField, FMetaSoundSpecEndpoint& OutEndpoint)
+{
+    FString Joined = GetStringFieldAudioAuth(Connection, Combined, TEXT(""));
+    if (!Joined.IsEmpty())
+    {
+        // Split at the last dot: graph input names such as "UE.Source.OnPlay" contain dots themselves
+        if (!Joined.Split(TEXT("."), &OutEndpoint.Node, &OutEndpoint.Pin, ESearchCase::CaseSensitive, ESearchDir::FromEnd))
+        {
+            OutEndpoint.Node = Joined;
+            OutEndpoint.Pin.Reset();
+        }
+    }
+    else
+    {
+        OutEndpoint.Node = GetStringFieldAudioAuth(Connection, NodeField, TEXT(""));
+        OutEndpoint.Pin = GetStringFieldAudioAuth(Connection, PinField, TEXT(""));
+    }
+    return !OutEndpoint.Node.IsEmpty();
+}
+
+// Adds the graph inputs, outputs, nodes and connections a build_metasound_graph spec describes to
+// MetaSound through one document builder, so the document is rebuilt once rather than once per
+// add_metasound_* request. Spec is { inputs?: [{ name, type?, default? }], outputs?: [{ name,
+// type? }], nodes?: [{ id, className | nodeType, majorVersion?, defaults? }], connections?:
+// [{ from: "node.pin", to: "node.pin" }] }, where a node is a spec node id, a graph input or
+// output (the spec's or one the graph already has, such as an interface member) whose pin may be
+// left out. The spec is checked before the document is touched; inputs and outputs the graph
+// already has are kept, and nodes or connections the registry rejects are reported as warnings.
+static bool BuildMetaSoundGraph(UMetaSoundSource* MetaSound, const TSharedPtr<FJsonObject>& Spec,
+    TSharedPtr<FJsonObject>& OutResult, FString& OutError, FString& OutErrorCode)
+{
+    struct FSpecVertex
+    {
+        FString Name;
+        FString Type;
+        TSharedPtr<FJsonValue> Default;
+    };
+    struct FSpecNode
+    {
+        FString Id;
+        FString ClassName;
+        int32 MajorVersion = 1;
+        TSharedPtr<FJsonObject> Defaults;
+    };
+
+    auto ReadObjects = [&Spec](const TCHAR* Field, TArray<TSharedPtr<FJsonObject>>& Out) -> bool
+    {
+        const TArray<TSharedPtr<FJsonValue>>* Values = nullptr;
+        if (!Spec->TryGetArrayField(Field, Values) || !Values)
+        {
+            return true;
+        }
+        for (const TSharedPtr<FJsonValue>& Value : *Values)
+        {
+            const TSharedPtr<FJsonObject>* Obj = nullptr;
+            if (!Value.IsValid() || !Value->TryGetObject(Obj) || !Obj->IsValid())
+            {
+                return false;
+            }
+            Out.Add(*Obj);
+        }
+        return true;
+    };
+    TArray<TSharedPtr<FJsonObject>> InputObjects, OutputObjects, NodeObjects, ConnectionObjects;
+    if (!ReadObjects(TEXT("inputs"), InputObjects) || !ReadObjects(TEXT("outputs"), OutputObjects) ||
+        !ReadObjects(TEXT("nodes"), NodeObjects) || !ReadObjects(TEXT("connections"), ConnectionObjects))
+    {
+        OutError = TEXT("inputs, outputs, nodes and connections must be arrays of objects");
+        OutErrorCode = TEXT("INVALID_SPEC");
+        return false;
+    }
+
+    TArray<FSpecVertex> Inputs, Outputs;
+    TSet<FString> VertexNames;
+    for (int32 Pass = 0; Pass < 2; ++Pass)
+    {
+        for (const TSharedPtr<FJsonObject>& Obj : Pass == 0 ? InputObjects : OutputObjects)
+        {
+            FSpecVertex Vertex;
+            Vertex.Name = GetStringFieldAudioAuth(Obj, TEXT("name"), TEXT(""));
+            Vertex.Type = GetStringFieldAudioAuth(Obj, TEXT("type"), Pass == 0 ? TEXT("Float") : TEXT("Audio"));
+            Vertex.Default = Obj->TryGetField(TEXT("default"));
+            if (Vertex.Name.IsEmpty() || VertexNames.Contains(Vertex.Name))
+            {
+                OutError = Vertex.Name.IsEmpty() ? TEXT("Every graph input and output needs a name")
+                                                 : FString::Printf(TEXT("Graph vertex '%s' is declared twice"), *Vertex.Name);
+                OutErrorCode = TEXT("INVALID_SPEC");
+                return false;
+            }
+            VertexNames.Add(Vertex.Name);
+            (Pass == 0 ? Inputs : Outputs).Add(Vertex);
+        }
+    }
+
+    TArray<FSpecNode> Nodes;
+    TSet<FString> NodeIds;
+    for (const TSharedPtr<FJsonObject>& Obj : NodeObjects)
+    {
+        FSpecNode Node;
+        Node.Id = GetStringFieldAudioAuth(Obj, TEXT("id"), TEXT(""));
+        Node.ClassName = GetStringFieldAudioAuth(Obj, TEXT("className"), TEXT(""));
+        if (Node.ClassName.IsEmpty())
+        {
+            Node.ClassName = ResolveMetaSoundNodeClassName(GetStringFieldAudioAuth(Obj, TEXT("nodeType"), TEXT("")));
+        }
+        Node.MajorVersion = static_cast<int32>(GetNumberFieldAudioAuth(Obj, TEXT("majorVersion"), 1));
+        const TSharedPtr<FJsonObject>* Defaults = nullptr;
+        if (Obj->TryGetObjectField(TEXT("defaults"), Defaults))
+        {
+            Node.Defaults = *Defaults;
+        }
+        if (Node.Id.IsEmpty() || Node.ClassName.IsEmpty())
+        {
+            OutError = TEXT("Every node needs an id and a className or nodeType");
+            OutErrorCode = TEXT("INVALID_SPEC");
+            return false;
+        }
+        if (NodeIds.Contains(Node.Id) || VertexNames.Contains(Node.Id))
+        {
+            OutError = FString::Printf(TEXT("Node id '%s' is not unique in the spec"), *Node.Id);
+            OutErrorCode = TEXT("INVALID_SPEC");
+            return false;
+        }
+        NodeIds.Add(Node.Id);
+        Nodes.Add(Node);
+    }
+
+    TScriptInterface<IMetaSoundDocumentInterface> ScriptInterface(MetaSound);
+#if MCP_HAS_METASOUND_FRONTEND_V2
+    FMetaSoundFrontendDocumentBuilder Builder(ScriptInterface, nullptr, true);
+#else
+    FMetaSoundFrontendDocumentBuilder Builder(ScriptInterface);
+#endif
+
+    // Every endpoint must name a spec node or a graph vertex before anything is added
+    TArray<TPair<FMetaSoundSpecEndpoint, FMetaSoundSpecEndpoint>> Connections;
+    for (const TSharedPtr<FJsonObject>& Obj : ConnectionObjects)
+    {
+        FMetaSoundSpecEndpoint From, To;
+        if (!ParseMetaSoundSpecEndpoint(Obj, TEXT("from"), TEXT("fromNode"), TEXT("fromPin"), From) ||
+            !ParseMetaSoundSpecEndpoint(Obj, TEXT("to"), TEXT("toNode"), TEXT("toPin"), To))
+        {
+            OutError = TEXT("Every connection needs from and to (\"node.pin\") or fromNode/toNode");
+            break;
+        }
+        for (FMetaSoundSpecEndpoint* Endpoint : { &From, &To })
+        {
+            // "UE.Source.OnPlay" with no pin splits into node "UE.Source" and pin "OnPlay"; rejoin it
+            // when only the whole string names a graph vertex
+            const FString Whole = Endpoint->Pin.IsEmpty() ? Endpoint->Node : Endpoint->Node + TEXT(".") + Endpoint->Pin;
+            auto IsKnown = [&](const FString& Name)
+            {
+                return NodeIds.Contains(Name) || VertexNames.Contains(Name) ||
+                    Builder.FindGraphInputNode(FName(*Name)) != nullptr || Builder.FindGraphOutputNode(FName(*Name)) != nullptr;
+            };
+            if (!IsKnown(Endpoint->Node) && IsKnown(Whole))
+            {
+                Endpoint->Node = Whole;
+                Endpoint->Pin.Reset();
+            }
+            if (OutError.IsEmpty() && !IsKnown(Endpoint->Node))
+            {
+                OutError = FString::Printf(TEXT("Connection endpoint '%s' is not a spec node or graph input/output"), *Whole);
+            }
+            else if (OutError.IsEmpty() && Endpoint->Pin.IsEmpty() && NodeIds.Contains(Endpoint->Node))
+            {
+                OutError = FString::Printf(TEXT("Connection endpoint '%s' must name a pin of the node"), *Whole);
+            }
+        }
+        Connections.Emplace(From, To);
+    }
+    if (!OutError.IsEmpty())
+    {
+        OutErrorCode = TEXT("INVALID_SPEC");
+#if MCP_HAS_METASOUND_FRONTEND_V2
+        Builder.FinishBuilding();
+#endif
+        return false;
+    }
+
+    TArray<TSharedPtr<FJsonValue>> Warnings;
+    TMap<FString, FGuid> NodeGuids;
+    int32 InputsAdded = 0, OutputsAdded = 0, NodesAdded = 0, DefaultsSet = 0;
+
+    for (const FSpecVertex& Input : Inputs)
+    {
+        const FMetasoundFrontendNode* InputNode = Builder.FindGraphInputNode(FName(*Input.Name));
+        if (!InputNode)
+        {
+            FMetasoundFrontendClassInput ClassInput;
+            ClassInput.Name = FName(*Input.Name);
+            ClassInput.TypeName = FName(*Input.Type);
+            ClassInput.VertexID = FGuid::NewGuid();
+            ClassInput.NodeID = FGuid::NewGuid();
+            ClassInput.AccessType = EMetasoundFrontendVertexAccessType::Reference;
+            InputNode = Builder.AddGraphInput(ClassInput);
+            if (!InputNode)
+            {
+                Warnings.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("Input '%s' of type '%s' could not be added"), *Input.Name, *Input.Type)));
+                continue;
+            }
+            ++InputsAdded;
+        }
+        NodeGuids.Add(Input.Name, InputNode->GetID());
+        FMetasoundFrontendLiteral Literal;
+        if (Input.Default.IsValid())
+        {
+            if (MakeMetaSoundLiteral(Input.Default, Input.Type, Literal) && Builder.SetGraphInputDefault(FName(*Input.Name), Literal))
+            {
+                ++DefaultsSet;
+            }
+            else
+            {
+                Warnings.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("Default for input '%s' could not be set"), *Input.Name)));
+            }
+        }
+    }
+
+    for (const FSpecVertex& Output : Outputs)
+    {
+        const FMetasoundFrontendNode* OutputNode = Builder.FindGraphOutputNode(FName(*Output.Name));
+        if (!OutputNode)
+        {
+            FMetasoundFrontendClassOutput ClassOutput;
+            ClassOutput.Name = FName(*Output.Name);
+            ClassOutput.TypeName = FName(*Output.Type);
+            ClassOutput.VertexID = FGuid::NewGuid();
+            ClassOutput.NodeID = FGuid::NewGuid();
+            ClassOutput.AccessType = EMetasoundFrontendVertexAccessType::Reference;
+            OutputNode = Builder.AddGraphOutput(ClassOutput);
+            if (!OutputNode)
+            {
+                Warnings.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("Output '%s' of type '%s' could not be added"), *Output.Name, *Output.Type)));
+                continue;
+            }
+            ++OutputsAdded;
+        }
+        NodeGuids.Add(Output.Name, OutputNode->GetID());
+    }
+
+    TSharedPtr<FJsonObject> NodeIdsJson = MakeShared<FJsonObject>();
+    for (const FSpecNode& Node : Nodes)
+    {
+        const FMetasoundFrontendClassName ClassName(FName(), FName(*Node.ClassName), FName());
+        const FMetasoundFrontendNode* NewNode = Builder.AddNodeByClassName(ClassName, Node.MajorVersion, FGuid::NewGuid());
+        if (!NewNode)
+        {
+            Warnings.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("Node '%s': class '%s' not found in MetaSound registry"), *Node.Id, *Node.ClassName)));
+            continue;
+        }
+        ++NodesAdded;
+        const FGuid NodeGuid = NewNode->GetID();
+        NodeGuids.Add(Node.Id, NodeGuid);
+        NodeIdsJson->SetStringField(Node.Id, NodeGuid.ToString());
+        if (!Node.Defaults.IsValid())
+        {
+            continue;
+        }
+        for (const TPair<FString, TSharedPtr<FJsonValue>>& Default : Node.Defaults->Values)
+        {
+            const FMetasoundFrontendVertex* InputVertex = Builder.FindNodeInput(NodeGuid, FName(*Default.Key));
+            FMetasoundFrontendLiteral Literal;
+            if (InputVertex && MakeMetaSoundLiteral(Default.Value, InputVertex->TypeName.ToString(), Literal) &&
+                Builder.SetNodeInputDefault(NodeGuid, InputVertex->VertexID, Literal))
+            {
+                ++DefaultsSet;
+            }
+            else
+            {
+                Warnings.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("Node '%s': default for '%s' could not be set"), *Node.Id, *Default.Key)));
+            }
+        }
+    }
+
+    // All edges go in one call; a graph vertex endpoint without a pin uses the vertex's own name
+    TSet<Metasound::Frontend::FNamedEdge> Edges;
+    for (const TPair<FMetaSoundSpecEndpoint, FMetaSoundSpecEndpoint>& Connection : Connections)
+    {
+        auto ResolveNode = [&](const FString& Name) -> FGuid
+        {
+            if (const FGuid* Found = NodeGuids.Find(Name))
+            {
+                return *Found;
+            }
+            if (const FMetasoundFrontendNode* GraphInput = Builder.FindGraphInputNode(FName(*Name)))
+            {
+                return GraphInput->GetID();
+            }
+            if (const FMetasoundFrontendNode* GraphOutput = Builder.FindGraphOutputNode(FName(*Name)))
+            {
+                return GraphOutput->GetID();
+            }
+            return FGuid();
+        };
+        const FGuid FromGuid = ResolveNode(Connection.Key.Node);
+        const FGuid ToGuid = ResolveNode(Connection.Value.Node);
+        if (!FromGuid.IsValid() || !ToGuid.IsValid())
+        {
+            Warnings.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("Connection %s -> %s skipped: an endpoint was not added"),
+                *Connection.Key.Node, *Connection.Value.Node)));
+            continue;
+        }
+        Edges.Add(Metasound::Frontend::FNamedEdge{
+            FromGuid,
+            FName(Connection.Key.Pin.IsEmpty() ? *Connection.Key.Node : *Connection.Key.Pin),
+            ToGuid,
+            FName(Connection.Value.Pin.IsEmpty() ? *Connection.Value.Node : *Connection.Value.Pin)
+        });
+    }
+    TArray<const FMetasoundFrontendEdge*> CreatedEdges;
+    if (Edges.Num() > 0)
+    {
+        Builder.AddNamedEdges(Edges, &CreatedEdges, true);
+        if (CreatedEdges.Num() < Edges.Num())
+        {
+            Warnings.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("%d of %d connections could not be made (check pin names and types)"),
+                Edges.Num() - CreatedEdges.Num(), Edges.Num())));
+        }
+    }
+
+#if MCP_HAS_METASOUND_FRONTEND_V2
+    Builder.FinishBuilding();
+#endif
+
+    OutResult->SetNumberField(TEXT("inputsAdded"), InputsAdded);
+    OutResult->SetNumberField(TEXT("outputsAdded"), OutputsAdded);
+    OutResult->SetNumberField(TEXT("nodesAdded"), NodesAdded);
+    OutResult->SetNumberField(TEXT("defaultsSet"), DefaultsSet);
+    OutResult->SetNumberField(TEXT("edgesCreated"), CreatedEdges.Num());
+    OutResult->SetObjectField(TEXT("nodes"), NodeIdsJson);
+    OutResult->SetArrayField(TEXT("warnings"), Warnings);
+    return true;
+}
+#endif // MCP_HAS_METASOUND && MCP_HAS_METASOUND_FRONTEND
+
+// Upper bound for one import_sound_waves job, and the assets created per editor tick.
+static constexpr int32 MaxSoundImportFiles = 20000;
+static constexpr int32 DefaultSoundImportBatchSize = 100;
+
+// One file of an import_sound_waves job. Status is pending until the file is decoded, then
+// imported, exists (left alone without replaceExisting) or failed.
+struct FSoundImportItem
+{
+    FString SourcePath;
+    FString DestinationPath;
+    FString Name;
+    FString AssetPath;
+    FString Status = TEXT("pending");
+    FString Error;
+    int32 NumChannels = 0;
+    int32 SampleRate = 0;
+    double Duration = 0.0;
+};
+
+struct FSoundImportJob
+{
+    TWeakObjectPtr<UMcpAutomationBridgeSubsystem> Subsystem;
+    FString RequestId;
+    TSharedPtr<FMcpBridgeWebSocket> Socket;
+    TArray<FSoundImportItem> Items;
+    int32 NextItem = 0;
+    int32 BatchSize = DefaultSoundImportBatchSize;
+    bool bReplaceExisting = false;
+    bool bCompress = true;
+    bool bSave = true;
+    bool bCancelled = false;
+    double StartTime = 0.0;
+    double DecodeSeconds = 0.0;
+    TArray<TWeakObjectPtr<USoundWave>> Imported;
+};
+
+using FSoundImportJobRef = TSharedRef<FSoundImportJob, ESPMode::ThreadSafe>;
+
+// Worker thread: reads the file and checks it decodes, so broken files fail before any asset is
+// created and the factory later reads from a warm file cache. WAV headers are parsed for the
+// channel count, sample rate and duration; other formats are left to the sound factory.
+static void DecodeSoundImportItem(FSoundImportItem& Item)
+{
+    if (!FPaths::GetExtension(Item.SourcePath).Equals(TEXT("wav"), ESearchCase::IgnoreCase))
+    {
+        if (IFileManager::Get().FileSize(*Item.SourcePath) <= 0)
+        {
+            Item.Status = TEXT("failed");
+            Item.Error = TEXT("Source file is missing or empty");
+        }
+        return;
+    }
+
+    TArray<uint8> Bytes;
+    if (!FFileHelper::LoadFileToArray(Bytes, *Item.SourcePath))
+    {
+        Item.Status = TEXT("failed");
+        Item.Error = TEXT("Source file could not be read");
+        return;
+    }
+    FWaveModInfo WaveInfo;
+    FString Reason;
+    if (!WaveInfo.ReadWaveInfo(Bytes.GetData(), Bytes.Num(), &Reason))
+    {
+        Item.Status = TEXT("failed");
+        Item.Error = Reason.IsEmpty() ? TEXT("Not a readable WAV file") : Reason;
+        return;
+    }
+    Item.NumChannels = *WaveInfo.pChannels;
+    Item.SampleRate = static_cast<int32>(*WaveInfo.pSamplesPerSec);
+    const int32 BytesPerFrame = Item.NumChannels * (*WaveInfo.pBitsPerSample / 8);
+    if (BytesPerFrame > 0 && Item.SampleRate > 0)
+    {
+        Item.Duration = static_cast<double>(WaveInfo.SampleDataSize) / (static_cast<double>(BytesPerFrame) * Item.SampleRate);
+    }
+}
+
+static void FinishSoundImport(const FSoundImportJobRef& Job)
+{
+    UMcpAutomationBridgeSubsystem* Subsystem = Job->Subsystem.Get();
+    if (!Subsystem)
+    {
+        return;
+    }
+
+    // One save pass for every wave the job created
+    int32 SavesFailed = 0;
+    if (Job->bSave && Job->Imported.Num() > 0)
+    {
+        FMcpAssetSaveQueue::FScope SaveScope;
+        for (const TWeakObjectPtr<USoundWave>& Wave : Job->Imported)
+        {
+            if (Wave.IsValid())
+            {
+                QueueAssetSave(Wave.Get());
+            }
+        }
+        TArray<FMcpAssetSaveResult> SaveResults;
+        FMcpAssetSaveQueue::Flush(&SaveResults);
+        for (const FMcpAssetSaveResult& SaveResult : SaveResults)
+        {
+            SavesFailed += SaveResult.bSaved ? 0 : 1;
+        }
+    }
+
+    int32 ImportedCount = 0, ExistingCount = 0, FailedCount = 0, PendingCount = 0;
+    double TotalDuration = 0.0;
+    TArray<TSharedPtr<FJsonValue>> Files;
+    Files.Reserve(Job->Items.Num());
+    for (const FSoundImportItem& Item : Job->Items)
+    {
+        TSharedPtr<FJsonObject> File = MakeShared<FJsonObject>();
+        File->SetStringField(TEXT("sourcePath"), Item.SourcePath);
+        File->SetStringField(TEXT("status"), Item.Status);
+        if (!Item.AssetPath.IsEmpty())
+        {
+            File->SetStringField(TEXT("assetPath"), Item.AssetPath);
+        }
+        if (!Item.Error.IsEmpty())
+        {
+            File->SetStringField(TEXT("error"), Item.Error);
+        }
+        if (Item.SampleRate > 0)
+        {
+            File->SetNumberField(TEXT("numChannels"), Item.NumChannels);
+            File->SetNumberField(TEXT("sampleRate"), Item.SampleRate);
+            File->SetNumberField(TEXT("duration"), Item.Duration);
+        }
+        Files.Add(MakeShared<FJsonValueObject>(File));
+
+        if (Item.Status == TEXT("imported"))
+        {
+            ++ImportedCount;
+            TotalDuration += Item.Duration;
+        }
+        else if (Item.Status == TEXT("exists"))
+        {
+            ++ExistingCount;
+        }
+        else if (Item.Status == TEXT("failed"))
+        {
+            ++FailedCount;
+        }
+        else
+        {
+            ++PendingCount;
+        }
+    }
+
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetNumberField(TEXT("filesRequested"), Job->Items.Num());
+    Result->SetNumberField(TEXT("imported"), ImportedCount);
+    Result->SetNumberField(TEXT("existing"), ExistingCount);
+    Result->SetNumberField(TEXT("failed"), FailedCount);
+    Result->SetNumberField(TEXT("notProcessed"), PendingCount);
+    Result->SetNumberField(TEXT("savesFailed"), SavesFailed);
+    Result->SetNumberField(TEXT("totalDuration"), TotalDuration);
+    Result->SetBoolField(TEXT("compressionQueued"), Job->bCompress && ImportedCount > 0);
+    Result->SetNumberField(TEXT("decodeMs"), Job->DecodeSeconds * 1000.0);
+    Result->SetNumberField(TEXT("elapsedMs"), (FPlatformTime::Seconds() - Job->StartTime) * 1000.0);
+    Result->SetArrayField(TEXT("files"), Files);
+
+    if (Job->bCancelled)
+    {
+        Result->SetBoolField(TEXT("cancelled"), true);
+        Subsystem->SendAutomationResponse(Job->Socket, Job->RequestId, false,
+            FString::Printf(TEXT("Sound import cancelled after %d of %d files"), ImportedCount, Job->Items.Num()),
+            Result, TEXT("CANCELLED"));
+        return;
+    }
+    const bool bSuccess = FailedCount == 0 && SavesFailed == 0;
+    Subsystem->SendAutomationResponse(Job->Socket, Job->RequestId, bSuccess,
+        FString::Printf(TEXT("Imported %d sound waves (%d existing, %d failed)"), ImportedCount, ExistingCount, FailedCount),
+        Result, bSuccess ? FString() : TEXT("IMPORT_INCOMPLETE"));
+}
+
+// Game thread, one batch per editor tick: the batch's files go to the sound factory through one
+// ImportAssetTasks call, and each new wave starts building its compressed data for the running
+// platform on the derived data cache workers instead of on first playback.
+static void RunSoundImportBatch(const FSoundImportJobRef& Job)
+{
+    UMcpAutomationBridgeSubsystem* Subsystem = Job->Subsystem.Get();
+    if (!Subsystem || !GEditor)
+    {
+        return;
+    }
+
+    IAssetTools& AssetTools = FModuleManager::LoadModuleChecked<FAssetToolsModule>("AssetTools").Get();
+    ITargetPlatform* RunningPlatform = Job->bCompress ? GetTargetPlatformManagerRef().GetRunningTargetPlatform() : nullptr;
+
+    const int32 BatchEnd = FMath::Min(Job->NextItem + Job->BatchSize, Job->Items.Num());
+    TArray<UAssetImportTask*> Tasks;
+    TArray<int32> TaskItems;
+    for (int32 Index = Job->NextItem; Index < BatchEnd; ++Index)
+    {
+        FSoundImportItem& Item = Job->Items[Index];
+        if (Item.Status != TEXT("pending"))
+        {
+            continue;
+        }
+        Item.AssetPath = Item.DestinationPath / Item.Name + TEXT(".") + Item.Name;
+        if (!Job->bReplaceExisting && FPackageName::DoesPackageExist(Item.DestinationPath / Item.Name))
+        {
+            Item.Status = TEXT("exists");
+            continue;
+        }
+        UAssetImportTask* Task = NewObject<UAssetImportTask>();
+        Task->Filename = Item.SourcePath;
+        Task->DestinationPath = Item.DestinationPath;
+        Task->DestinationName = Item.Name;
+        Task->bReplaceExisting = Job->bReplaceExisting;
+        Task->bAutomated = true;
+        Task->bSave = false;
+        Tasks.Add(Task);
+        TaskItems.Add(Index);
+    }
+
+    if (Tasks.Num() > 0)
+    {
+        AssetTools.ImportAssetTasks(Tasks);
+    }
+    for (int32 TaskIndex = 0; TaskIndex < Tasks.Num(); ++TaskIndex)
+    {
+        FSoundImportItem& Item = Job->Items[TaskItems[TaskIndex]];
+        USoundWave* Wave = nullptr;
+        for (const FString& ObjectPath : Tasks[TaskIndex]->ImportedObjectPaths)
+        {
+            Wave = FindObject<USoundWave>(nullptr, *ObjectPath);
+            if (Wave)
+            {
+                break;
+            }
+        }
+        if (!Wave)
+        {
+            Item.Status = TEXT("failed");
+            Item.Error = TEXT("The sound factory did not create a sound wave");
+            continue;
+        }
+        Item.Status = TEXT("imported");
+        Item.AssetPath = Wave->GetPathName();
+        if (Item.SampleRate == 0)
+        {
+            Item.NumChannels = Wave->NumChannels;
+            Item.SampleRate = static_cast<int32>(Wave->GetSampleRateForCurrentPlatform());
+            Item.Duration = Wave->Duration;
+        }
+        if (RunningPlatform)
+        {
+            Wave->BeginCacheForCookedPlatformData(RunningPlatform);
+        }
+        Job->Imported.Add(Wave);
+    }
+    Job->NextItem = BatchEnd;
+
+    const float Percent = 10.0f + 85.0f * static_cast<float>(Job->NextItem) / static_cast<float>(FMath::Max(1, Job->Items.Num()));
+    if (!Subsystem->SendProgressUpdate(Job->RequestId, Percent,
+            FString::Printf(TEXT("Imported %d of %d sound files"), Job->NextItem, Job->Items.Num())))
+    {
+        Job->bCancelled = true;
+    }
+
+    if (Job->bCancelled || Job->NextItem >= Job->Items.Num())
+    {
+        FinishSoundImport(Job);
+        return;
+    }
+    GEditor->GetTimerManager()->SetTimerForNextTick([Job]() { RunSoundImportBatch(Job); });
+}
+
+// Collects the files an import_sound_waves request names: files as paths or { sourcePath,
+// destinationPath?, name? }, or every audio file under sourceDirectory with its subfolders
+// mirrored below destinationPath.
+static bool CollectSoundImportItems(const TSharedPtr<FJsonObject>& Params, TArray<FSoundImportItem>& OutItems, FString& OutError)
+{
+    const FString DestinationRoot = NormalizeAudioPath(GetStringFieldAudioAuth(Params, TEXT("destinationPath"), TEXT("/Game/Audio/Imported")));
+    if (DestinationRoot.IsEmpty())
+    {
+        OutError = TEXT("Invalid destinationPath");
+        return false;
+    }
+    auto AddItem = [&OutItems](const FString& SourcePath, const FString& DestinationPath, FString Name)
+    {
+        // UE asset names cannot contain spaces or dots
+        Name.ReplaceInline(TEXT(" "), TEXT("_"));
+        Name.ReplaceInline(TEXT("."), TEXT("_"));
+        FSoundImportItem& Item = OutItems.AddDefaulted_GetRef();
+        Item.SourcePath = FPaths::ConvertRelativePathToFull(SourcePath);
+        Item.DestinationPath = DestinationPath;
+        Item.Name = Name;
+        if (DestinationPath.IsEmpty())
+        {
+            Item.Status = TEXT("failed");
+            Item.Error = TEXT("Invalid destinationPath");
+        }
+        else if (!FPaths::FileExists(Item.SourcePath))
+        {
+            Item.Status = TEXT("failed");
+            Item.Error = TEXT("Source file not found");
+        }
+    };
+
+    const TArray<TSharedPtr<FJsonValue>>* FileValues = nullptr;
+    if (Params->TryGetArrayField(TEXT("files"), FileValues) && FileValues)
+    {
+        for (const TSharedPtr<FJsonValue>& Value : *FileValues)
+        {
+            FString SourcePath;
+            const TSharedPtr<FJsonObject>* FileObj = nullptr;
+            if (Value.IsValid() && Value->TryGetString(SourcePath))
+            {
+                AddItem(SourcePath, DestinationRoot, FPaths::GetBaseFilename(SourcePath));
+            }
+            else if (Value.IsValid() && Value->TryGetObject(FileObj) && FileObj->IsValid())
+            {
+                SourcePath = GetStringFieldAudioAuth(*FileObj, TEXT("sourcePath"), TEXT(""));
+                const FString Destination = (*FileObj)->HasField(TEXT("destinationPath"))
+                    ? NormalizeAudioPath(GetStringFieldAudioAuth(*FileObj, TEXT("destinationPath"), TEXT("")))
+                    : DestinationRoot;
+                AddItem(SourcePath, Destination, GetStringFieldAudioAuth(*FileObj, TEXT("name"), FPaths::GetBaseFilename(SourcePath)));
+            }
+            else
+            {
+                OutError = TEXT("files entries must be paths or { sourcePath, destinationPath?, name? } objects");
+                return false;
+            }
+        }
+    }
+
+    const FString SourceDirectory = GetStringFieldAudioAuth(Params, TEXT("sourceDirectory"), TEXT(""));
+    if (!SourceDirectory.IsEmpty())
+    {
+        FString Root = FPaths::ConvertRelativePathToFull(SourceDirectory);
+        FPaths::NormalizeDirectoryName(Root);
+        if (!FPaths::DirectoryExists(Root))
+        {
+            OutError = FString::Printf(TEXT("sourceDirectory not found: %s"), *SourceDirectory);
+            return false;
+        }
+        const bool bRecursive = GetBoolFieldAudioAuth(Params, TEXT("recursive"), true);
+        TArray<FString> Found;
+        for (const TCHAR* Extension : { TEXT("*.wav"), TEXT("*.ogg"), TEXT("*.flac"), TEXT("*.aif"), TEXT("*.aiff") })
+        {
+            if (bRecursive)
+            {
+                IFileManager::Get().FindFilesRecursive(Found, *Root, Extension, true, false, false);
+            }
+            else
+            {
+                TArray<FString> Names;
+                IFileManager::Get().FindFiles(Names, *(Root / Extension), true, false);
+                for (const FString& FileName : Names)
+                {
+                    Found.Add(Root / FileName);
+                }
+            }
+        }
+        Found.Sort();
+        for (const FString& File : Found)
+        {
+            FString Relative = FPaths::GetPath(File);
+            Relative = Relative.StartsWith(Root) ? Relative.Mid(Root.Len()) : FString();
+            Relative.RemoveFromStart(TEXT("/"));
+            FString Destination = DestinationRoot;
+            if (!Relative.IsEmpty())
+            {
+                Relative.ReplaceInline(TEXT(" "), TEXT("_"));
+                Destination = NormalizeAudioPath(DestinationRoot / Relative);
+            }
+            AddItem(File, Destination, FPaths::GetBaseFilename(File));
+        }
+    }
+
+    // Two files landing on one asset would overwrite each other
+    TSet<FString> Destinations;
+    for (FSoundImportItem& Item : OutItems)
+    {
+        bool bDuplicate = false;
+        Destinations.Add(Item.DestinationPath / Item.Name, &bDuplicate);
+        if (bDuplicate && Item.Status == TEXT("pending"))
+        {
+            Item.Status = TEXT("failed");
+            Item.Error = FString::Printf(TEXT("Another file in this import also maps to %s"), *(Item.DestinationPath / Item.Name));
+        }
+    }
+
+    if (OutItems.Num() == 0)
+    {
+        OutError = TEXT("No sound files to import: pass files or a sourceDirectory with audio files");
+        return false;
+    }
+    if (OutItems.Num() > MaxSoundImportFiles)
+    {
+        OutError = FString::Printf(TEXT("%d files requested; split the import into jobs of at most %d"), OutItems.Num(), MaxSoundImportFiles);
+        return false;
+    }
+    return true;
+}
+
 } // anonymous namespace
 
 // Main handler function that processes audio authoring requests
@@ -693,29 +1504,7 @@ static TSharedPtr<FJsonObject> HandleAudioAuthoringRequest(const TSharedPtr<FJso
         FString ActualClassName = NodeClassName;
         if (ActualClassName.IsEmpty() && !NodeType.IsEmpty())
         {
-            // Map common node types to class names
-            FString NodeTypeLower = NodeType.ToLower();
-            if (NodeTypeLower == TEXT("oscillator") || NodeTypeLower == TEXT("sine"))
-            {
-                ActualClassName = TEXT("Metasound.Sine");
-            }
-            else if (NodeTypeLower == TEXT("gain") || NodeTypeLower == TEXT("multiply"))
-            {
-                ActualClassName = TEXT("Metasound.Multiply");
-            }
-            else if (NodeTypeLower == TEXT("add"))
-            {
-                ActualClassName = TEXT("Metasound.Add");
-            }
-            else if (NodeTypeLower == TEXT("waveplayer"))
-            {
-                ActualClassName = TEXT("Metasound.WavePlayer");
-            }
-            else
-            {
-                // Use node type as class name directly
-                ActualClassName = NodeType;
-            }
+            ActualClassName = ResolveMetaSoundNodeClassName(NodeType);
         }
         
         if (ActualClassName.IsEmpty())
@@ -1110,6 +1899,72 @@ static TSharedPtr<FJsonObject> HandleAudioAuthoringRequest(const TSharedPtr<FJso
 #endif
     }
     
+    if (SubAction == TEXT("build_metasound_graph"))
+    {
+#if MCP_HAS_METASOUND && MCP_HAS_METASOUND_FRONTEND
+        FString AssetPath = NormalizeAudioPath(GetStringFieldAudioAuth(Params, TEXT("assetPath"), TEXT("")));
+        FString Name = GetStringFieldAudioAuth(Params, TEXT("name"), TEXT(""));
+        
+        if (AssetPath.IsEmpty() && Name.IsEmpty())
+        {
+            AUDIO_ERROR_RESPONSE(TEXT("assetPath (or name and path to create one) is required"), TEXT("MISSING_PATH"));
+        }
+        
+        UMetaSoundSource* MetaSound = AssetPath.IsEmpty() ? nullptr : Cast<UMetaSoundSource>(
+            StaticLoadObject(UMetaSoundSource::StaticClass(), nullptr, *AssetPath));
+        bool bCreated = false;
+#if MCP_HAS_METASOUND_FACTORY
+        if (!MetaSound && !Name.IsEmpty())
+        {
+            // Create the source first, as create_metasound does, so a new graph is one request
+            FString Path = NormalizeAudioPath(GetStringFieldAudioAuth(Params, TEXT("path"), TEXT("/Game/Audio/MetaSounds")));
+            UPackage* Package = CreatePackage(*(Path / Name));
+            if (!Package)
+            {
+                AUDIO_ERROR_RESPONSE(TEXT("Failed to create package"), TEXT("PACKAGE_ERROR"));
+            }
+            UMetaSoundSourceFactory* Factory = NewObject<UMetaSoundSourceFactory>();
+            MetaSound = Cast<UMetaSoundSource>(
+                Factory->FactoryCreateNew(UMetaSoundSource::StaticClass(), Package,
+                                          FName(*Name), RF_Public | RF_Standalone,
+                                          nullptr, GWarn));
+            bCreated = MetaSound != nullptr;
+        }
+#endif
+        if (!MetaSound)
+        {
+            AUDIO_ERROR_RESPONSE(FString::Printf(TEXT("Could not load MetaSound: %s"), AssetPath.IsEmpty() ? *Name : *AssetPath), TEXT("ASSET_NOT_FOUND"));
+        }
+        
+        FString BuildError;
+        FString BuildErrorCode;
+        if (!BuildMetaSoundGraph(MetaSound, Params, Response, BuildError, BuildErrorCode))
+        {
+            AUDIO_ERROR_RESPONSE(BuildError, BuildErrorCode);
+        }
+        
+        // One dirty mark for the whole rebuilt document
+        McpSafeAssetSave(MetaSound);
+        
+        Response->SetStringField(TEXT("assetPath"), MetaSound->GetPathName());
+        Response->SetBoolField(TEXT("created"), bCreated);
+        Response->SetBoolField(TEXT("success"), true);
+        Response->SetStringField(TEXT("message"), FString::Printf(TEXT("MetaSound graph built: %d nodes, %d edges"),
+            static_cast<int32>(GetNumberFieldAudioAuth(Response, TEXT("nodesAdded"), 0)),
+            static_cast<int32>(GetNumberFieldAudioAuth(Response, TEXT("edgesCreated"), 0))));
+        AddAssetVerification(Response, MetaSound);
+        return Response;
+#elif MCP_HAS_METASOUND
+        Response->SetBoolField(TEXT("success"), false);
+        Response->SetStringField(TEXT("error"), TEXT("Cannot build MetaSound graph - Frontend Builder not available"));
+        Response->SetStringField(TEXT("errorCode"), TEXT("METASOUND_FRONTEND_NOT_SUPPORTED"));
+        Response->SetStringField(TEXT("requiredVersion"), TEXT("UE 5.3+"));
+        return Response;
+#else
+        AUDIO_ERROR_RESPONSE(TEXT("MetaSound support not available"), TEXT("METASOUND_NOT_AVAILABLE"));
+#endif
+    }
+    
     // ===== 11.3 Sound Classes & Mixes =====
     
     if (SubAction == TEXT("create_sound_class"))
@@ -2196,6 +3051,72 @@ static TSharedPtr<FJsonObject> HandleAudioAuthoringRequest(const TSharedPtr<FJso
     AUDIO_ERROR_RESPONSE(FString::Printf(TEXT("Unknown audio authoring action: %s"), *SubAction), TEXT("UNKNOWN_ACTION"));
 }
 
+// import_sound_waves: imports many sound files as one job. The files are read and checked on
+// worker threads first, then created in batches of batchSize per editor tick (see
+// RunSoundImportBatch), so a large voice-over drop neither decodes serially on the game thread
+// nor freezes the editor, and the client can cancel between batches. Replies once, when the job
+// ends, with a per-file report.
+static bool HandleImportSoundWaves(UMcpAutomationBridgeSubsystem* Self, const FString& RequestId,
+    const TSharedPtr<FJsonObject>& Params, TSharedPtr<FMcpBridgeWebSocket> Socket)
+{
+    FSoundImportJobRef Job = MakeShared<FSoundImportJob, ESPMode::ThreadSafe>();
+    FString Error;
+    if (!CollectSoundImportItems(Params, Job->Items, Error))
+    {
+        Self->SendAutomationError(Socket, RequestId, Error, TEXT("INVALID_ARGUMENT"));
+        return true;
+    }
+    if (!GEditor)
+    {
+        Self->SendAutomationError(Socket, RequestId, TEXT("Editor not available for import"), TEXT("EDITOR_NOT_AVAILABLE"));
+        return true;
+    }
+    Job->Subsystem = Self;
+    Job->RequestId = RequestId;
+    Job->Socket = Socket;
+    Job->BatchSize = FMath::Clamp(static_cast<int32>(GetNumberFieldAudioAuth(Params, TEXT("batchSize"), DefaultSoundImportBatchSize)), 1, 1000);
+    Job->bReplaceExisting = GetBoolFieldAudioAuth(Params, TEXT("replaceExisting"), false);
+    Job->bCompress = GetBoolFieldAudioAuth(Params, TEXT("compress"), true);
+    Job->bSave = GetBoolFieldAudioAuth(Params, TEXT("save"), true);
+    Job->StartTime = FPlatformTime::Seconds();
+
+    Self->SendProgressUpdate(RequestId, 0.0f, FString::Printf(TEXT("Decoding %d sound files"), Job->Items.Num()));
+    AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [Job]()
+    {
+        const double DecodeStart = FPlatformTime::Seconds();
+        ParallelFor(Job->Items.Num(), [&Job](int32 Index)
+        {
+            FSoundImportItem& Item = Job->Items[Index];
+            if (Item.Status == TEXT("pending"))
+            {
+                DecodeSoundImportItem(Item);
+            }
+        });
+        Job->DecodeSeconds = FPlatformTime::Seconds() - DecodeStart;
+
+        AsyncTask(ENamedThreads::GameThread, [Job]()
+        {
+            UMcpAutomationBridgeSubsystem* Subsystem = Job->Subsystem.Get();
+            if (!Subsystem)
+            {
+                return;
+            }
+            if (!Subsystem->SendProgressUpdate(Job->RequestId, 10.0f, TEXT("Sound files decoded; creating assets")))
+            {
+                Job->bCancelled = true;
+                FinishSoundImport(Job);
+                return;
+            }
+            // Import from a timer tick, outside any task graph callback, as HandleImportAsset does
+            if (GEditor)
+            {
+                GEditor->GetTimerManager()->SetTimerForNextTick([Job]() { RunSoundImportBatch(Job); });
+            }
+        });
+    });
+    return true;
+}
+
 #endif // WITH_EDITOR
 
 // Public handler function called by the subsystem
@@ -2219,6 +3140,12 @@ bool UMcpAutomationBridgeSubsystem::HandleManageAudioAuthoringAction(
         return true;
     }
     
+    // The bulk import replies from its own job once every batch has run
+    if (GetJsonStringField(Payload, TEXT("subAction")) == TEXT("import_sound_waves"))
+    {
+        return HandleImportSoundWaves(this, RequestId, Payload, RequestingSocket);
+    }
+
     TSharedPtr<FJsonObject> Response = HandleAudioAuthoringRequest(Payload);
     
     if (Response.IsValid())
@@ -0,0 +1,248 @@
+// Location: McpAutomationBridge/Private/McpAutomationBridge_BatchHandlers.cpp
+// Summary: The "batch" envelope. Runs an ordered list of sub-actions
+//          back-to-back inside a single ProcessAutomationRequest dispatch and
+//          replies with one aggregated automation_response, so clients that
+//          issue many small edits pay one round trip, one game-thread hop and
+//          one response instead of one per action.
+// Usage: { "action": "batch", "payload": { "actions": [ { "action": "...",
+//          "payload": { ... }, "id": "optional label" }, ... ],
+//          "stopOnError": false, "transaction": false,
+//          "transactionName": "optional undo label" } }
+
+#include "Dom/JsonObject.h"
+#include "HAL/PlatformTime.h"
+#include "McpAutomationBridgeGlobals.h"
+#include "McpAutomationBridgeHelpers.h"
+#include "McpAutomationBridgeSubsystem.h"
+
+#if WITH_EDITOR
+#include "ScopedTransaction.h"
+#endif
+
+namespace {
+// Upper bound on sub-actions per envelope; keeps a single dispatch from
+// stalling the game thread indefinitely.
+constexpr int32 MaxBatchActions = 1000;
+} // namespace
+
+/**
+ * @brief Run one action through the regular dispatch chain and capture its
+ * response instead of sending it.
+ *
+ * @param OwnerRequestId Request whose response receives the attachments the
+ * action stages.
+ * @param SubRequestId Id the action runs under; a late (asynchronous)
+ * response is delivered under it.
+ * @return The captured response; bResponded is false when the action answers
+ * asynchronously.
+ */
+UMcpAutomationBridgeSubsystem::FBatchResponseCapture
+UMcpAutomationBridgeSubsystem::DispatchCapturedAction(
+    const FString &OwnerRequestId, const FString &SubRequestId,
+    const FString &Action, const TSharedPtr<FJsonObject> &Payload,
+    TSharedPtr<FMcpBridgeWebSocket> RequestingSocket) {
+  BatchResponseCaptures.Add(SubRequestId).BatchRequestId = OwnerRequestId;
+  FString HandlerLabel;
+  try {
+    DispatchAutomationAction(SubRequestId, Action, Payload, RequestingSocket,
+                             HandlerLabel);
+  } catch (const std::exception &E) {
+    SendAutomationError(
+        RequestingSocket, SubRequestId,
+        FString::Printf(TEXT("Internal error: %s"), ANSI_TO_TCHAR(E.what())),
+        TEXT("INTERNAL_ERROR"));
+  } catch (...) {
+    SendAutomationError(RequestingSocket, SubRequestId,
+                        TEXT("Internal error (unknown)."),
+                        TEXT("INTERNAL_ERROR"));
+  }
+  FBatchResponseCapture Capture;
+  BatchResponseCaptures.RemoveAndCopyValue(SubRequestId, Capture);
+  return Capture;
+}
+
+/**
+ * @brief Execute every entry of payload.actions through the regular dispatch
+ * chain and send a single aggregated response.
+ *
+ * Each sub-action runs under the id "<RequestId>#<index>". Its response is
+ * captured rather than sent; attachments it stages are moved onto the batch
+ * response. Sub-actions that answer asynchronously are reported as deferred
+ * and their late responses are delivered under their own sub-request id.
+ *
+ * @param RequestId Identifier of the batch request.
+ * @param Action Action name; only "batch" is handled.
+ * @param Payload Batch payload (actions, stopOnError, transaction).
+ * @param RequestingSocket Socket that receives the aggregated response.
+ * @return true if the action was "batch" and a response was sent.
+ */
+bool UMcpAutomationBridgeSubsystem::HandleBatchAction(
+    const FString &RequestId, const FString &Action,
+    const TSharedPtr<FJsonObject> &Payload,
+    TSharedPtr<FMcpBridgeWebSocket> RequestingSocket) {
+  if (!Action.Equals(TEXT("batch"), ESearchCase::IgnoreCase)) {
+    return false;
+  }
+
+  const TArray<TSharedPtr<FJsonValue>> *Entries = nullptr;
+  if (!Payload.IsValid() ||
+      !Payload->TryGetArrayField(TEXT("actions"), Entries) || !Entries) {
+    SendAutomationError(RequestingSocket, RequestId,
+                        TEXT("batch requires an 'actions' array."),
+                        TEXT("INVALID_PAYLOAD"));
+    return true;
+  }
+  if (Entries->Num() > MaxBatchActions) {
+    SendAutomationError(
+        RequestingSocket, RequestId,
+        FString::Printf(TEXT("batch accepts at most %d actions (got %d)."),
+                        MaxBatchActions, Entries->Num()),
+        TEXT("INVALID_ARGUMENT"));
+    return true;
+  }
+
+  const bool bStopOnError = GetJsonBoolField(Payload, TEXT("stopOnError"));
+  const bool bUseTransaction = GetJsonBoolField(Payload, TEXT("transaction"));
+
+  bool bOpenedTransaction = false;
+#if WITH_EDITOR
+  TUniquePtr<FScopedTransaction> Transaction;
+  if (bUseTransaction && Entries->Num() > 0) {
+    const FString TransactionName = GetJsonStringField(
+        Payload, TEXT("transactionName"), TEXT("MCP Batch"));
+    Transaction =
+        MakeUnique<FScopedTransaction>(FText::FromString(TransactionName));
+    bOpenedTransaction = true;
+  }
+#endif
+
+  const double StartSeconds = FPlatformTime::Seconds();
+  TArray<TSharedPtr<FJsonValue>> Results;
+  Results.Reserve(Entries->Num());
+  int32 Succeeded = 0;
+  int32 Failed = 0;
+  int32 Deferred = 0;
+  int32 StoppedAt = INDEX_NONE;
+
+  for (int32 Index = 0; Index < Entries->Num(); ++Index) {
+    const TSharedPtr<FJsonValue> &Entry = (*Entries)[Index];
+    const TSharedPtr<FJsonObject> EntryObject =
+        Entry.IsValid() && Entry->Type == EJson::Object ? Entry->AsObject()
+                                                        : nullptr;
+    const FString SubAction = GetJsonStringField(EntryObject, TEXT("action"));
+    const FString SubRequestId =
+        FString::Printf(TEXT("%s#%d"), *RequestId, Index);
+
+    TSharedPtr<FJsonObject> ItemResult = MakeShared<FJsonObject>();
+    ItemResult->SetNumberField(TEXT("index"), Index);
+    ItemResult->SetStringField(TEXT("action"), SubAction);
+    const FString Label = GetJsonStringField(EntryObject, TEXT("id"));
+    if (!Label.IsEmpty()) {
+      ItemResult->SetStringField(TEXT("id"), Label);
+    }
+
+    FBatchResponseCapture Capture;
+    if (SubAction.IsEmpty()) {
+      Capture.bResponded = true;
+      Capture.Message = TEXT("Batch entry is missing 'action'.");
+      Capture.ErrorCode = TEXT("INVALID_PAYLOAD");
+    } else if (SubAction.Equals(TEXT("batch"), ESearchCase::IgnoreCase)) {
+      Capture.bResponded = true;
+      Capture.Message = TEXT("Nested batch actions are not supported.");
+      Capture.ErrorCode = TEXT("INVALID_ARGUMENT");
+    } else {
+      const TSharedPtr<FJsonObject> *SubPayloadPtr = nullptr;
+      const TSharedPtr<FJsonObject> SubPayload =
+          EntryObject->TryGetObjectField(TEXT("payload"), SubPayloadPtr) &&
+                  SubPayloadPtr
+              ? *SubPayloadPtr
+              : MakeShared<FJsonObject>();
+
+      Capture = DispatchCapturedAction(RequestId, SubRequestId, SubAction,
+                                       SubPayload, RequestingSocket);
+    }
+
+    if (!Capture.bResponded) {
+      ++Deferred;
+      ItemResult->SetBoolField(TEXT("success"), true);
+      ItemResult->SetBoolField(TEXT("deferred"), true);
+      ItemResult->SetStringField(TEXT("requestId"), SubRequestId);
+      ItemResult->SetStringField(
+          TEXT("message"),
+          TEXT("Action completes asynchronously; its response is delivered "
+               "under requestId."));
+    } else {
+      ItemResult->SetBoolField(TEXT("success"), Capture.bSuccess);
+      if (!Capture.Message.IsEmpty()) {
+        ItemResult->SetStringField(TEXT("message"), Capture.Message);
+      }
+      if (!Capture.ErrorCode.IsEmpty()) {
+        ItemResult->SetStringField(TEXT("error"), Capture.ErrorCode);
+      }
+      if (Capture.Result.IsValid()) {
+        ItemResult->SetObjectField(TEXT("result"), Capture.Result);
+      }
+      if (Capture.bSuccess) {
+        ++Succeeded;
+      } else {
+        ++Failed;
+      }
+    }
+    Results.Add(MakeShared<FJsonValueObject>(ItemResult));
+
+    if (bStopOnError && Capture.bResponded && !Capture.bSuccess) {
+      StoppedAt = Index;
+      break;
+    }
+  }
+
+#if WITH_EDITOR
+  // Close the undo entry before replying so it is complete once the client
+  // sees the response.
+  Transaction.Reset();
+#endif
+
+  // Write the packages the sub-actions saved now rather than when the
+  // dispatch unwinds, so the reply can say which of them reached disk.
+  TArray<FMcpAssetSaveResult> SaveResults;
+  FMcpAssetSaveQueue::Flush(&SaveResults);
+  TArray<TSharedPtr<FJsonValue>> Saves;
+  int32 SaveFailed = 0;
+  for (const FMcpAssetSaveResult &Save : SaveResults) {
+    TSharedPtr<FJsonObject> SaveJson = MakeShared<FJsonObject>();
+    SaveJson->SetStringField(TEXT("package"), Save.PackageName);
+    SaveJson->SetBoolField(TEXT("saved"), Save.bSaved);
+    Saves.Add(MakeShared<FJsonValueObject>(SaveJson));
+    if (!Save.bSaved) {
+      ++SaveFailed;
+    }
+  }
+
+  TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+  Result->SetArrayField(TEXT("results"), Results);
+  Result->SetNumberField(TEXT("total"), Entries->Num());
+  Result->SetNumberField(TEXT("succeeded"), Succeeded);
+  Result->SetNumberField(TEXT("failed"), Failed);
+  Result->SetNumberField(TEXT("deferred"), Deferred);
+  if (StoppedAt != INDEX_NONE) {
+    Result->SetNumberField(TEXT("stoppedAt"), StoppedAt);
+  }
+  Result->SetArrayField(TEXT("saves"), Saves);
+  Result->SetNumberField(TEXT("saveFailed"), SaveFailed);
+  Result->SetBoolField(TEXT("transaction"), bOpenedTransaction);
+  Result->SetNumberField(TEXT("durationMs"),
+                         (FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+
+  const bool bAllSucceeded = Failed == 0;
+  const FString Message =
+      StoppedAt != INDEX_NONE
+          ? FString::Printf(TEXT("Batch stopped at action %d of %d."),
+                            StoppedAt + 1, Entries->Num())
+          : FString::Printf(TEXT("Batch executed %d action(s): %d succeeded, "
+                                 "%d failed, %d deferred."),
+                            Results.Num(), Succeeded, Failed, Deferred);
+  SendAutomationResponse(RequestingSocket, RequestId, bAllSucceeded, Message,
+                         Result,
+                         bAllSucceeded ? FString() : TEXT("BATCH_FAILED"));
+  return true;
+}
@@ -0,0 +1,215 @@
+// Location:
+// McpAutomationBridge/Private/McpAutomationBridge_BlueprintCompileHandlers.cpp
+// Summary: "compile_blueprints" compiles a set of Blueprints (listed and/or
+//          everything under a folder) in dependency order through a single
+//          FBlueprintCompilationManager pass, instead of one blueprint_compile
+//          request per Blueprint after a base class or shared struct changes.
+// Usage: { "action": "compile_blueprints", "payload": {
+//          "blueprintPaths": ["/Game/BP_A", ...], "folderPath": "/Game/AI",
+//          "recursive": true, "save": false } }
+
+#include "Dom/JsonObject.h"
+#include "HAL/PlatformTime.h"
+#include "McpAutomationBridgeGlobals.h"
+#include "McpAutomationBridgeHelpers.h"
+#include "McpAutomationBridgeSubsystem.h"
+#include "McpBlueprintCompileQueue.h"
+
+#if WITH_EDITOR
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Engine/Blueprint.h"
+#endif
+
+namespace {
+// A folder of a few thousand Blueprints still compiles in one request; past
+// that the reply and the stall are better split by folder.
+constexpr int32 MaxCompileBlueprints = 5000;
+} // namespace
+
+/**
+ * @brief Compile payload.blueprintPaths and the Blueprints under
+ * payload.folderPath in one compilation-manager pass.
+ *
+ * Replies with one entry per Blueprint in the order they were compiled
+ * (parents and referenced Blueprints first), the compile log of each failure,
+ * and the paths that did not load as Blueprints.
+ *
+ * @param RequestId Identifier of the request.
+ * @param Action Action name; only "compile_blueprints" is handled.
+ * @param Payload blueprintPaths, folderPath, recursive, save.
+ * @param RequestingSocket Socket that receives the response.
+ * @return true if the action was "compile_blueprints" and a response was sent.
+ */
+bool UMcpAutomationBridgeSubsystem::HandleCompileBlueprints(
+    const FString &RequestId, const FString &Action,
+    const TSharedPtr<FJsonObject> &Payload,
+    TSharedPtr<FMcpBridgeWebSocket> RequestingSocket) {
+  if (!Action.Equals(TEXT("compile_blueprints"), ESearchCase::IgnoreCase)) {
+    return false;
+  }
+
+#if WITH_EDITOR
+  if (!Payload.IsValid()) {
+    SendAutomationError(RequestingSocket, RequestId,
+                        TEXT("compile_blueprints requires a payload."),
+                        TEXT("INVALID_PAYLOAD"));
+    return true;
+  }
+
+  TArray<FString> Paths;
+  const TArray<TSharedPtr<FJsonValue>> *PathsArray = nullptr;
+  if (Payload->TryGetArrayField(TEXT("blueprintPaths"), PathsArray) &&
+      PathsArray) {
+    for (const TSharedPtr<FJsonValue> &Val : *PathsArray) {
+      if (Val.IsValid() && Val->Type == EJson::String) {
+        const FString SafePath = SanitizeProjectRelativePath(Val->AsString());
+        if (!SafePath.IsEmpty()) {
+          Paths.AddUnique(SafePath);
+        }
+      }
+    }
+  }
+
+  FString FolderPath;
+  if (Payload->TryGetStringField(TEXT("folderPath"), FolderPath) &&
+      !FolderPath.IsEmpty()) {
+    const FString SafeFolder = SanitizeProjectRelativePath(FolderPath);
+    if (SafeFolder.IsEmpty()) {
+      SendAutomationError(
+          RequestingSocket, RequestId,
+          FString::Printf(TEXT("Invalid or unsafe folder path: %s"),
+                          *FolderPath),
+          TEXT("SECURITY_VIOLATION"));
+      return true;
+    }
+    bool bRecursive = true;
+    Payload->TryGetBoolField(TEXT("recursive"), bRecursive);
+
+    IAssetRegistry &AssetRegistry =
+        FModuleManager::LoadModuleChecked<FAssetRegistryModule>(
+            TEXT("AssetRegistry"))
+            .Get();
+    FARFilter Filter;
+    Filter.PackagePaths.Add(FName(*SafeFolder));
+    Filter.bRecursivePaths = bRecursive;
+    // Animation and Widget Blueprints derive from UBlueprint.
+    Filter.bRecursiveClasses = true;
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
+    Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+#else
+    Filter.ClassNames.Add(UBlueprint::StaticClass()->GetFName());
+#endif
+    TArray<FAssetData> AssetDataList;
+    AssetRegistry.GetAssets(Filter, AssetDataList);
+    for (const FAssetData &AssetData : AssetDataList) {
+      Paths.AddUnique(AssetData.ToSoftObjectPath().ToString());
+    }
+  }
+
+  if (Paths.Num() == 0) {
+    SendAutomationError(
+        RequestingSocket, RequestId,
+        TEXT("blueprintPaths or folderPath with Blueprints required"),
+        TEXT("INVALID_ARGUMENT"));
+    return true;
+  }
+  if (Paths.Num() > MaxCompileBlueprints) {
+    SendAutomationError(
+        RequestingSocket, RequestId,
+        FString::Printf(TEXT("compile_blueprints accepts at most %d "
+                             "Blueprints (got %d); split the request by "
+                             "folder."),
+                        MaxCompileBlueprints, Paths.Num()),
+        TEXT("INVALID_ARGUMENT"));
+    return true;
+  }
+
+  bool bSave = false;
+  Payload->TryGetBoolField(TEXT("save"), bSave);
+
+  const double StartSeconds = FPlatformTime::Seconds();
+  TArray<UBlueprint *> Blueprints;
+  Blueprints.Reserve(Paths.Num());
+  TArray<TSharedPtr<FJsonValue>> NotFound;
+  for (const FString &Path : Paths) {
+    FString Normalized;
+    FString LoadError;
+    if (UBlueprint *Blueprint = LoadBlueprintAsset(Path, Normalized, LoadError)) {
+      Blueprints.AddUnique(Blueprint);
+    } else {
+      NotFound.Add(MakeShared<FJsonValueString>(Path));
+    }
+  }
+  const double LoadMs = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+
+  int32 NumInCycles = 0;
+  TArray<FMcpBlueprintCompileResult> CompileResults;
+  FMcpBlueprintCompileQueue::CompileMany(Blueprints, CompileResults,
+                                         &NumInCycles);
+  const double CompileMs =
+      (FPlatformTime::Seconds() - StartSeconds) * 1000.0 - LoadMs;
+
+  int32 Compiled = 0;
+  int32 Failed = 0;
+  int32 TotalErrors = 0;
+  int32 TotalWarnings = 0;
+  TArray<TSharedPtr<FJsonValue>> Results;
+  Results.Reserve(CompileResults.Num());
+  for (const FMcpBlueprintCompileResult &Compile : CompileResults) {
+    Results.Add(MakeShared<FJsonValueObject>(
+        FMcpBlueprintCompileQueue::ToJson(Compile)));
+    TotalErrors += Compile.NumErrors;
+    TotalWarnings += Compile.NumWarnings;
+    if (Compile.bCompiled) {
+      ++Compiled;
+    } else {
+      ++Failed;
+    }
+  }
+
+  int32 SaveFailed = 0;
+  if (bSave) {
+    for (UBlueprint *Blueprint : Blueprints) {
+      FMcpAssetSaveQueue::Queue(Blueprint);
+    }
+    TArray<FMcpAssetSaveResult> SaveResults;
+    FMcpAssetSaveQueue::Flush(&SaveResults);
+    for (const FMcpAssetSaveResult &Save : SaveResults) {
+      SaveFailed += Save.bSaved ? 0 : 1;
+    }
+  }
+
+  TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+  Result->SetArrayField(TEXT("blueprints"), Results);
+  Result->SetNumberField(TEXT("total"), CompileResults.Num());
+  Result->SetNumberField(TEXT("compiled"), Compiled);
+  Result->SetNumberField(TEXT("failed"), Failed);
+  Result->SetNumberField(TEXT("errors"), TotalErrors);
+  Result->SetNumberField(TEXT("warnings"), TotalWarnings);
+  Result->SetNumberField(TEXT("inCycles"), NumInCycles);
+  Result->SetArrayField(TEXT("notFound"), NotFound);
+  if (bSave) {
+    Result->SetNumberField(TEXT("saveFailed"), SaveFailed);
+  }
+  Result->SetNumberField(TEXT("loadMs"), LoadMs);
+  Result->SetNumberField(TEXT("compileMs"), CompileMs);
+  Result->SetNumberField(TEXT("durationMs"),
+                         (FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+
+  const bool bSuccess = Failed == 0 && NotFound.Num() == 0;
+  const FString Message = FString::Printf(
+      TEXT("Compiled %d Blueprint(s): %d succeeded, %d failed, %d not found."),
+      CompileResults.Num(), Compiled, Failed, NotFound.Num());
+  SendAutomationResponse(RequestingSocket, RequestId, bSuccess, Message,
+                         Result,
+                         bSuccess ? FString()
+                                  : (Failed > 0 ? TEXT("COMPILE_FAILED")
+                                                : TEXT("ASSET_NOT_FOUND")));
+  return true;
+#else
+  SendAutomationError(RequestingSocket, RequestId,
+                      TEXT("compile_blueprints requires an editor build."),
+                      TEXT("EDITOR_ONLY"));
+  return true;
+#endif
+}
@@ -630,9 +630,9 @@ bool FBlueprintCreationHandlers::HandleBlueprintCreate(
   if (WeakCreatedBp.IsValid()) {
     UBlueprint *BP = WeakCreatedBp.Get();
 #if WITH_EDITOR
-    // Force immediate save and registry scan to ensure availability
-    SaveLoadedAssetThrottled(BP, -1.0, true);
-    ScanPathSynchronous(BP->GetOutermost()->GetName());
+    // Force immediate save; the registry rescan runs once the dispatch ends
+    QueueAssetSave(BP);
+    QueueAssetRegistryScan(BP->GetOutermost()->GetName());
 #endif
   }
 
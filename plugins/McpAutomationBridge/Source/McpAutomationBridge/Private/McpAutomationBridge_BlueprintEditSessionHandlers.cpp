@@ -0,0 +1,282 @@
+// Location:
+// McpAutomationBridge/Private/McpAutomationBridge_BlueprintEditSessionHandlers.cpp
+// Summary: The "blueprint_edit_session" envelope. Applies an ordered list of
+//          structural edits to one Blueprint (graph nodes, pins, variables,
+//          SCS components, ...) with every compile they request deferred,
+//          then compiles and saves the Blueprint once and replies with the
+//          per-edit results and the single compile log. Building a 150-node
+//          graph costs one Kismet compile instead of one per edit.
+// Usage: { "action": "blueprint_edit_session", "payload": {
+//          "blueprintPath": "/Game/BP_Foo", "save": true,
+//          "stopOnError": false, "edits": [
+//            { "subAction": "create_node", "nodeType": "K2Node_IfThenElse" },
+//            { "action": "blueprint_add_variable", "payload": { ... } } ] } }
+//          An edit without "action" is a manage_blueprint_graph edit; either
+//          form gets blueprintPath filled in when it names no Blueprint.
+
+#include "Dom/JsonObject.h"
+#include "HAL/PlatformTime.h"
+#include "McpAutomationBridgeGlobals.h"
+#include "McpAutomationBridgeHelpers.h"
+#include "McpAutomationBridgeSubsystem.h"
+#include "McpBlueprintCompileQueue.h"
+
+#if WITH_EDITOR
+#include "Engine/Blueprint.h"
+#include "ScopedTransaction.h"
+#endif
+
+namespace {
+// Same bound as the batch envelope: one dispatch must not stall the game
+// thread indefinitely.
+constexpr int32 MaxEditSessionEdits = 1000;
+} // namespace
+
+/**
+ * @brief Apply payload.edits to one Blueprint with a single compile and save.
+ *
+ * Each edit runs through the regular dispatch chain under the id
+ * "<RequestId>#<index>" with its response captured, inside one undo
+ * transaction and one FMcpBlueprintCompileQueue scope. Compiles the edits
+ * request only mark their Blueprint structurally modified, so the skeleton
+ * class stays current for the edits that follow while the generated class is
+ * rebuilt once, after the last edit. Edits that read the compiled class or
+ * CDO belong after the session.
+ *
+ * @param RequestId Identifier of the session request.
+ * @param Action Action name; only "blueprint_edit_session" is handled.
+ * @param Payload Session payload (blueprintPath, edits, save, stopOnError).
+ * @param RequestingSocket Socket that receives the aggregated response.
+ * @return true if the action was "blueprint_edit_session" and a response was
+ * sent.
+ */
+bool UMcpAutomationBridgeSubsystem::HandleBlueprintEditSession(
+    const FString &RequestId, const FString &Action,
+    const TSharedPtr<FJsonObject> &Payload,
+    TSharedPtr<FMcpBridgeWebSocket> RequestingSocket) {
+  if (!Action.Equals(TEXT("blueprint_edit_session"), ESearchCase::IgnoreCase)) {
+    return false;
+  }
+
+#if WITH_EDITOR
+  const TArray<TSharedPtr<FJsonValue>> *Edits = nullptr;
+  if (!Payload.IsValid() || !Payload->TryGetArrayField(TEXT("edits"), Edits) ||
+      !Edits) {
+    SendAutomationError(RequestingSocket, RequestId,
+                        TEXT("blueprint_edit_session requires an 'edits' array."),
+                        TEXT("INVALID_PAYLOAD"));
+    return true;
+  }
+  if (Edits->Num() > MaxEditSessionEdits) {
+    SendAutomationError(
+        RequestingSocket, RequestId,
+        FString::Printf(
+            TEXT("blueprint_edit_session accepts at most %d edits (got %d)."),
+            MaxEditSessionEdits, Edits->Num()),
+        TEXT("INVALID_ARGUMENT"));
+    return true;
+  }
+
+  FString RequestedPath = GetJsonStringField(Payload, TEXT("blueprintPath"));
+  if (RequestedPath.IsEmpty()) {
+    RequestedPath = GetJsonStringField(Payload, TEXT("assetPath"));
+  }
+  const FString BlueprintPath = SanitizeProjectRelativePath(RequestedPath);
+  if (BlueprintPath.IsEmpty()) {
+    SendAutomationError(
+        RequestingSocket, RequestId,
+        RequestedPath.IsEmpty()
+            ? TEXT("blueprint_edit_session requires 'blueprintPath'.")
+            : TEXT("Invalid blueprintPath: contains traversal sequences or "
+                   "invalid characters."),
+        RequestedPath.IsEmpty() ? TEXT("INVALID_ARGUMENT")
+                                : TEXT("INVALID_PATH"));
+    return true;
+  }
+  UBlueprint *Blueprint = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
+  if (!Blueprint) {
+    SendAutomationError(
+        RequestingSocket, RequestId,
+        FString::Printf(TEXT("Could not load blueprint at path: %s"),
+                        *BlueprintPath),
+        TEXT("ASSET_NOT_FOUND"));
+    return true;
+  }
+
+  const bool bStopOnError = GetJsonBoolField(Payload, TEXT("stopOnError"));
+  const bool bSave = GetJsonBoolField(Payload, TEXT("save"), true);
+
+  const double StartSeconds = FPlatformTime::Seconds();
+  TArray<TSharedPtr<FJsonValue>> Results;
+  Results.Reserve(Edits->Num());
+  int32 Succeeded = 0;
+  int32 Failed = 0;
+  int32 Deferred = 0;
+  int32 StoppedAt = INDEX_NONE;
+  TArray<FMcpBlueprintCompileResult> CompileResults;
+
+  {
+    FMcpBlueprintCompileQueue::FScope CompileScope;
+    FScopedTransaction Transaction(FText::FromString(
+        GetJsonStringField(Payload, TEXT("transactionName"),
+                           TEXT("MCP Blueprint Edit Session"))));
+    Blueprint->Modify();
+
+    for (int32 Index = 0; Index < Edits->Num(); ++Index) {
+      const TSharedPtr<FJsonValue> &Entry = (*Edits)[Index];
+      const TSharedPtr<FJsonObject> EntryObject =
+          Entry.IsValid() && Entry->Type == EJson::Object ? Entry->AsObject()
+                                                          : nullptr;
+      const FString EditAction = GetJsonStringField(
+          EntryObject, TEXT("action"), TEXT("manage_blueprint_graph"));
+      const FString SubRequestId =
+          FString::Printf(TEXT("%s#%d"), *RequestId, Index);
+
+      // Copy the edit so filling in the Blueprint never touches the request.
+      TSharedPtr<FJsonObject> EditPayload = MakeShared<FJsonObject>();
+      const TSharedPtr<FJsonObject> *NestedPayload = nullptr;
+      if (EntryObject.IsValid() &&
+          EntryObject->TryGetObjectField(TEXT("payload"), NestedPayload) &&
+          NestedPayload) {
+        EditPayload->Values = (*NestedPayload)->Values;
+      } else if (EntryObject.IsValid()) {
+        EditPayload->Values = EntryObject->Values;
+        EditPayload->RemoveField(TEXT("action"));
+        EditPayload->RemoveField(TEXT("id"));
+      }
+      if (!EditPayload->HasField(TEXT("blueprintPath")) &&
+          !EditPayload->HasField(TEXT("assetPath")) &&
+          !EditPayload->HasField(TEXT("name"))) {
+        EditPayload->SetStringField(TEXT("blueprintPath"), BlueprintPath);
+      }
+
+      TSharedPtr<FJsonObject> ItemResult = MakeShared<FJsonObject>();
+      ItemResult->SetNumberField(TEXT("index"), Index);
+      ItemResult->SetStringField(TEXT("action"), EditAction);
+      const FString SubAction = GetJsonStringField(EditPayload, TEXT("subAction"));
+      if (!SubAction.IsEmpty()) {
+        ItemResult->SetStringField(TEXT("subAction"), SubAction);
+      }
+      const FString Label = GetJsonStringField(EntryObject, TEXT("id"));
+      if (!Label.IsEmpty()) {
+        ItemResult->SetStringField(TEXT("id"), Label);
+      }
+
+      FBatchResponseCapture Capture;
+      if (!EntryObject.IsValid()) {
+        Capture.bResponded = true;
+        Capture.Message = TEXT("Edit must be an object.");
+        Capture.ErrorCode = TEXT("INVALID_PAYLOAD");
+      } else if (EditAction.Equals(TEXT("batch"), ESearchCase::IgnoreCase) ||
+                 EditAction.Equals(TEXT("blueprint_edit_session"),
+                                   ESearchCase::IgnoreCase)) {
+        Capture.bResponded = true;
+        Capture.Message = TEXT("Nested batches and edit sessions are not "
+                               "supported.");
+        Capture.ErrorCode = TEXT("INVALID_ARGUMENT");
+      } else {
+        Capture = DispatchCapturedAction(RequestId, SubRequestId, EditAction,
+                                         EditPayload, RequestingSocket);
+      }
+
+      if (!Capture.bResponded) {
+        ++Deferred;
+        ItemResult->SetBoolField(TEXT("success"), true);
+        ItemResult->SetBoolField(TEXT("deferred"), true);
+        ItemResult->SetStringField(TEXT("requestId"), SubRequestId);
+      } else {
+        ItemResult->SetBoolField(TEXT("success"), Capture.bSuccess);
+        if (!Capture.Message.IsEmpty()) {
+          ItemResult->SetStringField(TEXT("message"), Capture.Message);
+        }
+        if (!Capture.ErrorCode.IsEmpty()) {
+          ItemResult->SetStringField(TEXT("error"), Capture.ErrorCode);
+        }
+        if (Capture.Result.IsValid()) {
+          ItemResult->SetObjectField(TEXT("result"), Capture.Result);
+        }
+        if (Capture.bSuccess) {
+          ++Succeeded;
+        } else {
+          ++Failed;
+        }
+      }
+      Results.Add(MakeShared<FJsonValueObject>(ItemResult));
+
+      if (bStopOnError && Capture.bResponded && !Capture.bSuccess) {
+        StoppedAt = Index;
+        break;
+      }
+    }
+
+    // Graph edits only mark the Blueprint modified, so the session always
+    // compiles it, along with whatever the edits queued.
+    if (IsValid(Blueprint)) {
+      FMcpBlueprintCompileQueue::Queue(Blueprint);
+    }
+    FMcpBlueprintCompileQueue::Flush(&CompileResults);
+  }
+
+  bool bAllCompiled = true;
+  TArray<TSharedPtr<FJsonValue>> Compiles;
+  for (const FMcpBlueprintCompileResult &Compile : CompileResults) {
+    Compiles.Add(MakeShared<FJsonValueObject>(FMcpBlueprintCompileQueue::ToJson(Compile)));
+    bAllCompiled &= Compile.bCompiled;
+  }
+
+  // The save queue also holds the packages the edits saved; write them all now
+  // so the reply can say which reached disk.
+  if (bSave && IsValid(Blueprint)) {
+    FMcpAssetSaveQueue::Queue(Blueprint);
+  }
+  TArray<FMcpAssetSaveResult> SaveResults;
+  FMcpAssetSaveQueue::Flush(&SaveResults);
+  TArray<TSharedPtr<FJsonValue>> Saves;
+  int32 SaveFailed = 0;
+  for (const FMcpAssetSaveResult &Save : SaveResults) {
+    TSharedPtr<FJsonObject> SaveJson = MakeShared<FJsonObject>();
+    SaveJson->SetStringField(TEXT("package"), Save.PackageName);
+    SaveJson->SetBoolField(TEXT("saved"), Save.bSaved);
+    Saves.Add(MakeShared<FJsonValueObject>(SaveJson));
+    if (!Save.bSaved) {
+      ++SaveFailed;
+    }
+  }
+
+  TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+  Result->SetStringField(TEXT("blueprintPath"), BlueprintPath);
+  Result->SetArrayField(TEXT("results"), Results);
+  Result->SetNumberField(TEXT("total"), Edits->Num());
+  Result->SetNumberField(TEXT("succeeded"), Succeeded);
+  Result->SetNumberField(TEXT("failed"), Failed);
+  Result->SetNumberField(TEXT("deferred"), Deferred);
+  if (StoppedAt != INDEX_NONE) {
+    Result->SetNumberField(TEXT("stoppedAt"), StoppedAt);
+  }
+  Result->SetBoolField(TEXT("compiled"), bAllCompiled);
+  Result->SetArrayField(TEXT("compiles"), Compiles);
+  Result->SetArrayField(TEXT("saves"), Saves);
+  Result->SetNumberField(TEXT("saveFailed"), SaveFailed);
+  Result->SetNumberField(TEXT("durationMs"),
+                         (FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+
+  const bool bSuccess = Failed == 0 && bAllCompiled;
+  const FString Message =
+      FString::Printf(TEXT("Applied %d of %d edit(s) (%d failed) with %d "
+                           "compile(s)%s."),
+                      Succeeded + Deferred, Edits->Num(), Failed,
+                      CompileResults.Num(),
+                      bAllCompiled ? TEXT("") : TEXT("; compile errors"));
+  SendAutomationResponse(
+      RequestingSocket, RequestId, bSuccess, Message, Result,
+      bSuccess ? FString()
+               : (Failed > 0 ? TEXT("EDIT_SESSION_FAILED")
+                             : TEXT("COMPILE_FAILED")));
+  return true;
+#else
+  SendAutomationError(RequestingSocket, RequestId,
+                      TEXT("Blueprint edit sessions are editor-only."),
+                      TEXT("EDITOR_ONLY"));
+  return true;
+#endif
+}
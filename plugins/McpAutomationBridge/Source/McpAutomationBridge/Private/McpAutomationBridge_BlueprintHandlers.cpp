@@ -1068,25 +1068,6 @@ FMcpAutomationBridge_FindNamedEntry(const TArray<TSharedPtr<FJsonValue>> &Array,
   return nullptr;
 }
 
-static TSharedPtr<FJsonObject>
-FMcpAutomationBridge_EnsureBlueprintEntry(const FString &Key) {
-  if (TSharedPtr<FJsonObject> *Existing = GBlueprintRegistry.Find(Key)) {
-    if (Existing->IsValid()) {
-      return *Existing;
-    }
-  }
-
-  TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
-  Entry->SetStringField(TEXT("blueprintPath"), Key);
-  Entry->SetArrayField(TEXT("variables"), TArray<TSharedPtr<FJsonValue>>());
-  Entry->SetArrayField(TEXT("functions"), TArray<TSharedPtr<FJsonValue>>());
-  Entry->SetArrayField(TEXT("events"), TArray<TSharedPtr<FJsonValue>>());
-  Entry->SetObjectField(TEXT("defaults"), MakeShared<FJsonObject>());
-  Entry->SetObjectField(TEXT("metadata"), MakeShared<FJsonObject>());
-  GBlueprintRegistry.Add(Key, Entry);
-  return Entry;
-}
-
 static TSharedPtr<FJsonObject>
 FMcpAutomationBridge_BuildBlueprintSnapshot(UBlueprint *Blueprint,
                                             const FString &NormalizedPath) {
@@ -2025,7 +2006,7 @@ bool UMcpAutomationBridgeSubsystem::HandleBlueprintAction(
                   FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(
                       LocalBP);
                   McpSafeCompileBlueprint(LocalBP);
-                  SaveLoadedAssetThrottled(LocalBP);
+                  QueueAssetSave(LocalBP);
 #endif
                   bAddedViaSubsystem = true;
                 }
@@ -2223,7 +2204,7 @@ bool UMcpAutomationBridgeSubsystem::HandleBlueprintAction(
     bool bSaveResult = false;
     if (bSave && LocalBP) {
 #if WITH_EDITOR
-      bSaveResult = SaveLoadedAssetThrottled(LocalBP);
+      bSaveResult = QueueAssetSave(LocalBP);
       if (!bSaveResult)
         LocalWarnings.Add(
             TEXT("Blueprint failed to save during apply; check output log."));
@@ -2535,7 +2516,7 @@ bool UMcpAutomationBridgeSubsystem::HandleBlueprintAction(
 
     FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
     McpSafeCompileBlueprint(Blueprint);
-    const bool bSaved = SaveLoadedAssetThrottled(Blueprint);
+    const bool bSaved = QueueAssetSave(Blueprint);
 
     const TSharedPtr<FJsonObject> Snapshot =
         FMcpAutomationBridge_BuildBlueprintSnapshot(Blueprint, RegistryKey);
@@ -2873,7 +2854,7 @@ bool UMcpAutomationBridgeSubsystem::HandleBlueprintAction(
     Blueprint->NewVariables.Add(NewVar);
     FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
     McpSafeCompileBlueprint(Blueprint);
-    const bool bSaved = SaveLoadedAssetThrottled(Blueprint);
+    const bool bSaved = QueueAssetSave(Blueprint);
 
     // Real test: Verify the variable actually exists in the compiled class or
     // blueprint
@@ -3063,7 +3044,7 @@ bool UMcpAutomationBridgeSubsystem::HandleBlueprintAction(
 
     FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
     McpSafeCompileBlueprint(Blueprint);
-    const bool bSaved = SaveLoadedAssetThrottled(Blueprint);
+    const bool bSaved = QueueAssetSave(Blueprint);
 
     TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
     Result->SetStringField(TEXT("propertyName"), PropertyName);
@@ -3149,7 +3130,7 @@ bool UMcpAutomationBridgeSubsystem::HandleBlueprintAction(
     FBlueprintEditorUtils::RemoveMemberVariable(Blueprint, TargetVarName);
     FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
     McpSafeCompileBlueprint(Blueprint);
-    const bool bSaved = SaveLoadedAssetThrottled(Blueprint);
+    const bool bSaved = QueueAssetSave(Blueprint);
 
     UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
            TEXT("HandleBlueprintAction: variable '%s' removed from '%s' "
@@ -3240,7 +3221,7 @@ bool UMcpAutomationBridgeSubsystem::HandleBlueprintAction(
                                                 FName(*NewName));
     FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
     McpSafeCompileBlueprint(Blueprint);
-    const bool bSaved = SaveLoadedAssetThrottled(Blueprint);
+    const bool bSaved = QueueAssetSave(Blueprint);
 
     UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
            TEXT("HandleBlueprintAction: variable renamed from '%s' to '%s' in "
@@ -3500,46 +3481,21 @@ bool UMcpAutomationBridgeSubsystem::HandleBlueprintAction(
 
     FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(BP);
     McpSafeCompileBlueprint(BP);
-    const bool bSaved = SaveLoadedAssetThrottled(BP);
+    const bool bSaved = QueueAssetSave(BP);
 
     // Update Registry (Persistent list of events)
-    TSharedPtr<FJsonObject> Entry =
-        FMcpAutomationBridge_EnsureBlueprintEntry(RegistryKey);
-    TArray<TSharedPtr<FJsonValue>> Events =
-        Entry->HasField(TEXT("events")) ? Entry->GetArrayField(TEXT("events"))
-                                        : TArray<TSharedPtr<FJsonValue>>();
-    bool bFound = false;
-    for (const TSharedPtr<FJsonValue> &Item : Events) {
-      if (!Item.IsValid() || Item->Type != EJson::Object)
-        continue;
-      const TSharedPtr<FJsonObject> Obj = Item->AsObject();
-      if (Obj.IsValid()) {
-        FString Existing;
-        if (Obj->TryGetStringField(TEXT("name"), Existing) &&
-            Existing.Equals(EventName.ToString(), ESearchCase::IgnoreCase)) {
-          Obj->SetStringField(TEXT("eventType"), FinalType);
-          if (Params.Num() > 0) {
-            Obj->SetArrayField(TEXT("parameters"), Params);
-          } else {
-            Obj->RemoveField(TEXT("parameters"));
-          }
-          bFound = true;
-          break;
-        }
-      }
-    }
-
-    if (!bFound) {
-      TSharedPtr<FJsonObject> Rec = MakeShared<FJsonObject>();
-      Rec->SetStringField(TEXT("name"), EventName.ToString());
-      Rec->SetStringField(TEXT("eventType"), FinalType);
-      if (Params.Num() > 0) {
-        Rec->SetArrayField(TEXT("parameters"), Params);
-      }
-      Events.Add(MakeShared<FJsonValueObject>(Rec));
-    }
-
-    Entry->SetArrayField(TEXT("events"), Events);
+    GBlueprintRegistry.Update(RegistryKey, [&](FMcpBlueprintRecord &Record) {
+      FMcpRecordedEvent *Event =
+          Record.Events.FindByPredicate([&](const FMcpRecordedEvent &E) {
+            return E.Name.Equals(EventName.ToString(), ESearchCase::IgnoreCase);
+          });
+      if (!Event) {
+        Event = &Record.Events.AddDefaulted_GetRef();
+        Event->Name = EventName.ToString();
+      }
+      Event->EventType = FinalType;
+      Event->Parameters = Params;
+    });
 
     TSharedPtr<FJsonObject> Resp = MakeShared<FJsonObject>();
     Resp->SetBoolField(TEXT("success"), true);
@@ -3601,25 +3557,14 @@ bool UMcpAutomationBridgeSubsystem::HandleBlueprintAction(
             ? NormPath
             : Path;
 
-    TSharedPtr<FJsonObject> Entry =
-        FMcpAutomationBridge_EnsureBlueprintEntry(RegistryPath);
-    TArray<TSharedPtr<FJsonValue>> Events =
-        Entry->HasField(TEXT("events")) ? Entry->GetArrayField(TEXT("events"))
-                                        : TArray<TSharedPtr<FJsonValue>>();
-    int32 FoundIdx = INDEX_NONE;
-    for (int32 i = 0; i < Events.Num(); ++i) {
-      const TSharedPtr<FJsonValue> &V = Events[i];
-      if (!V.IsValid() || V->Type != EJson::Object)
-        continue;
-      const TSharedPtr<FJsonObject> Obj = V->AsObject();
-      FString CandidateName;
-      if (Obj->TryGetStringField(TEXT("name"), CandidateName) &&
-          CandidateName.Equals(EventName, ESearchCase::IgnoreCase)) {
-        FoundIdx = i;
-        break;
-      }
-    }
-    if (FoundIdx == INDEX_NONE) {
+    const auto MatchesEventName = [&EventName](const FMcpRecordedEvent &E) {
+      return E.Name.Equals(EventName, ESearchCase::IgnoreCase);
+    };
+    bool bRecorded = false;
+    GBlueprintRegistry.Read(RegistryPath, [&](const FMcpBlueprintRecord &Record) {
+      bRecorded = Record.Events.ContainsByPredicate(MatchesEventName);
+    });
+    if (!bRecorded) {
       // Treat remove as idempotent: if the event is not present in
       // the registry consider the request successful (no-op).
       TSharedPtr<FJsonObject> Resp = MakeShared<FJsonObject>();
@@ -3669,14 +3614,15 @@ bool UMcpAutomationBridgeSubsystem::HandleBlueprintAction(
           FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(
               RemoveBlueprint);
           McpSafeCompileBlueprint(RemoveBlueprint);
-          SaveLoadedAssetThrottled(RemoveBlueprint);
+          QueueAssetSave(RemoveBlueprint);
         }
       }
     }
 #endif // WITH_EDITOR && MCP_HAS_K2NODE_HEADERS && MCP_HAS_EDGRAPH_SCHEMA_K2
-       // Update registry
-    Events.RemoveAt(FoundIdx);
-    Entry->SetArrayField(TEXT("events"), Events);
+    // Update registry
+    GBlueprintRegistry.Update(RegistryPath, [&](FMcpBlueprintRecord &Record) {
+      Record.Events.RemoveAll(MatchesEventName);
+    });
     TSharedPtr<FJsonObject> Resp = MakeShared<FJsonObject>();
     Resp->SetStringField(TEXT("eventName"), EventName);
     Resp->SetStringField(TEXT("blueprintPath"), RegistryPath);
@@ -3913,53 +3859,19 @@ bool UMcpAutomationBridgeSubsystem::HandleBlueprintAction(
     McpSafeCompileBlueprint(Blueprint);
     const bool bSaved = UEditorAssetLibrary::SaveLoadedAsset(Blueprint);
 
-    TSharedPtr<FJsonObject> Entry =
-        FMcpAutomationBridge_EnsureBlueprintEntry(RegistryKey);
-    TArray<TSharedPtr<FJsonValue>> Funcs =
-        Entry->HasField(TEXT("functions"))
-            ? Entry->GetArrayField(TEXT("functions"))
-            : TArray<TSharedPtr<FJsonValue>>();
-    bool bFound = false;
-    for (const TSharedPtr<FJsonValue> &Value : Funcs) {
-      if (!Value.IsValid() || Value->Type != EJson::Object)
-        continue;
-      const TSharedPtr<FJsonObject> Obj = Value->AsObject();
-      if (!Obj.IsValid())
-        continue;
-
-      FString Existing;
-      if (Obj->TryGetStringField(TEXT("name"), Existing) &&
-          Existing.Equals(FuncName, ESearchCase::IgnoreCase)) {
-        Obj->SetBoolField(TEXT("public"), bIsPublic);
-        if (Inputs.Num() > 0) {
-          Obj->SetArrayField(TEXT("inputs"), Inputs);
-        } else {
-          Obj->RemoveField(TEXT("inputs"));
-        }
-        if (Outputs.Num() > 0) {
-          Obj->SetArrayField(TEXT("outputs"), Outputs);
-        } else {
-          Obj->RemoveField(TEXT("outputs"));
-        }
-        bFound = true;
-        break;
-      }
-    }
-
-    if (!bFound) {
-      TSharedPtr<FJsonObject> Rec = MakeShared<FJsonObject>();
-      Rec->SetStringField(TEXT("name"), FuncName);
-      Rec->SetBoolField(TEXT("public"), bIsPublic);
-      if (Inputs.Num() > 0) {
-        Rec->SetArrayField(TEXT("inputs"), Inputs);
-      }
-      if (Outputs.Num() > 0) {
-        Rec->SetArrayField(TEXT("outputs"), Outputs);
+    GBlueprintRegistry.Update(RegistryKey, [&](FMcpBlueprintRecord &Record) {
+      FMcpRecordedFunction *Function =
+          Record.Functions.FindByPredicate([&](const FMcpRecordedFunction &F) {
+            return F.Name.Equals(FuncName, ESearchCase::IgnoreCase);
+          });
+      if (!Function) {
+        Function = &Record.Functions.AddDefaulted_GetRef();
+        Function->Name = FuncName;
       }
-      Funcs.Add(MakeShared<FJsonValueObject>(Rec));
-    }
-
-    Entry->SetArrayField(TEXT("functions"), Funcs);
+      Function->bPublic = bIsPublic;
+      Function->Inputs = Inputs;
+      Function->Outputs = Outputs;
+    });
 
     TSharedPtr<FJsonObject> Resp = MakeShared<FJsonObject>();
     Resp->SetBoolField(TEXT("success"), true);
@@ -4148,7 +4060,7 @@ bool UMcpAutomationBridgeSubsystem::HandleBlueprintAction(
 
           FBlueprintEditorUtils::MarkBlueprintAsModified(BP);
           McpSafeCompileBlueprint(BP);
-          bool bSaved = SaveLoadedAssetThrottled(BP);
+          bool bSaved = QueueAssetSave(BP);
 
           TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
           Result->SetBoolField(TEXT("success"), true);
@@ -4191,7 +4103,7 @@ bool UMcpAutomationBridgeSubsystem::HandleBlueprintAction(
       McpSafeCompileBlueprint(BP);
 
       // Save the blueprint to persist changes
-      bool bSaved = SaveLoadedAssetThrottled(BP);
+      bool bSaved = QueueAssetSave(BP);
 
       TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
       Result->SetBoolField(TEXT("success"), true);
@@ -4253,7 +4165,7 @@ bool UMcpAutomationBridgeSubsystem::HandleBlueprintAction(
     McpSafeCompileBlueprint(BP);
     bool bSaved = false;
     if (bSaveAfterCompile) {
-      bSaved = SaveLoadedAssetThrottled(BP);
+      bSaved = QueueAssetSave(BP);
     }
     TSharedPtr<FJsonObject> Out = MakeShared<FJsonObject>();
     Out->SetBoolField(TEXT("compiled"), true);
@@ -4404,64 +4316,19 @@ bool UMcpAutomationBridgeSubsystem::HandleBlueprintAction(
       }
       Entry->SetArrayField(TEXT("variables"), VarsJson);
 
-      // Merge functions and events from registry
-      TSharedPtr<FJsonObject> RegistryEntry =
-          FMcpAutomationBridge_EnsureBlueprintEntry(Key);
-      if (RegistryEntry.IsValid()) {
-        if (RegistryEntry->HasField(TEXT("functions"))) {
-          TArray<TSharedPtr<FJsonValue>> RegFuncs =
-              RegistryEntry->GetArrayField(TEXT("functions"));
-          if (!Entry->HasField(TEXT("functions"))) {
-            Entry->SetArrayField(TEXT("functions"), RegFuncs);
-          } else {
-            // Merge unique
-            TArray<TSharedPtr<FJsonValue>> ExistingFuncs =
-                Entry->GetArrayField(TEXT("functions"));
-            TSet<FString> KnownNames;
-            for (const auto &Val : ExistingFuncs) {
-              const TSharedPtr<FJsonObject> Obj = Val->AsObject();
-              FString N;
-              if (Obj.IsValid() && Obj->TryGetStringField(TEXT("name"), N))
-                KnownNames.Add(N);
-            }
-            for (const auto &Val : RegFuncs) {
-              const TSharedPtr<FJsonObject> Obj = Val->AsObject();
-              FString N;
-              if (Obj.IsValid() && Obj->TryGetStringField(TEXT("name"), N) &&
-                  !KnownNames.Contains(N))
-                ExistingFuncs.Add(Val);
-            }
-            Entry->SetArrayField(TEXT("functions"), ExistingFuncs);
-          }
+      // Functions and events the bridge added, from the registry
+      TArray<TSharedPtr<FJsonValue>> FunctionsJson;
+      TArray<TSharedPtr<FJsonValue>> EventsJson;
+      GBlueprintRegistry.Read(Key, [&](const FMcpBlueprintRecord &Record) {
+        for (const FMcpRecordedFunction &Function : Record.Functions) {
+          FunctionsJson.Add(MakeShared<FJsonValueObject>(Function.ToJson()));
         }
-
-        if (RegistryEntry->HasField(TEXT("events"))) {
-          TArray<TSharedPtr<FJsonValue>> RegEvents =
-              RegistryEntry->GetArrayField(TEXT("events"));
-          if (!Entry->HasField(TEXT("events"))) {
-            Entry->SetArrayField(TEXT("events"), RegEvents);
-          } else {
-            // Merge unique
-            TArray<TSharedPtr<FJsonValue>> ExistingEvents =
-                Entry->GetArrayField(TEXT("events"));
-            TSet<FString> KnownNames;
-            for (const auto &Val : ExistingEvents) {
-              const TSharedPtr<FJsonObject> Obj = Val->AsObject();
-              FString N;
-              if (Obj.IsValid() && Obj->TryGetStringField(TEXT("name"), N))
-                KnownNames.Add(N);
-            }
-            for (const auto &Val : RegEvents) {
-              const TSharedPtr<FJsonObject> Obj = Val->AsObject();
-              FString N;
-              if (Obj.IsValid() && Obj->TryGetStringField(TEXT("name"), N) &&
-                  !KnownNames.Contains(N))
-                ExistingEvents.Add(Val);
-            }
-            Entry->SetArrayField(TEXT("events"), ExistingEvents);
-          }
+        for (const FMcpRecordedEvent &Event : Record.Events) {
+          EventsJson.Add(MakeShared<FJsonValueObject>(Event.ToJson()));
         }
-      }
+      });
+      Entry->SetArrayField(TEXT("functions"), FunctionsJson);
+      Entry->SetArrayField(TEXT("events"), EventsJson);
     }
 #else
     SendAutomationResponse(RequestingSocket, RequestId, false,
@@ -4774,7 +4641,7 @@ bool UMcpAutomationBridgeSubsystem::HandleBlueprintAction(
     FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(BP);
 
     McpSafeCompileBlueprint(BP);
-    bSaved = SaveLoadedAssetThrottled(BP);
+    bSaved = QueueAssetSave(BP);
 
     TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
     Result->SetBoolField(TEXT("success"), true);
@@ -4979,7 +4846,7 @@ bool UMcpAutomationBridgeSubsystem::HandleBlueprintAction(
       return true;
     }
 
-    const bool bSaved = SaveLoadedAssetThrottled(BP);
+    const bool bSaved = QueueAssetSave(BP);
     Result->SetBoolField(TEXT("saved"), bSaved);
     SendAutomationResponse(RequestingSocket, RequestId, true,
                            TEXT("Pin connection complete"), Result, FString());
@@ -5224,7 +5091,7 @@ bool UMcpAutomationBridgeSubsystem::HandleBlueprintAction(
     }
 
     FBlueprintEditorUtils::MarkBlueprintAsModified(BP);
-    const bool bSaved = SaveLoadedAssetThrottled(BP);
+    const bool bSaved = QueueAssetSave(BP);
 
     TSharedPtr<FJsonObject> Resp = MakeShared<FJsonObject>();
     Resp->SetBoolField(TEXT("success"), true);
@@ -5417,7 +5284,7 @@ bool UMcpAutomationBridgeSubsystem::HandleSCSAction(
       FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
       bCompiled = McpSafeCompileBlueprint(Blueprint);
 
-      bSaved = SaveLoadedAssetThrottled(Blueprint);
+      bSaved = QueueAssetSave(Blueprint);
 
       TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
       Result->SetStringField(TEXT("componentName"), ComponentName);
@@ -5525,7 +5392,7 @@ bool UMcpAutomationBridgeSubsystem::HandleSCSAction(
           FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
           bCompiled = McpSafeCompileBlueprint(Blueprint);
 
-          bSaved = SaveLoadedAssetThrottled(Blueprint);
+          bSaved = QueueAssetSave(Blueprint);
         }
 
         TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
@@ -5596,7 +5463,7 @@ bool UMcpAutomationBridgeSubsystem::HandleSCSAction(
         FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
         bCompiled = McpSafeCompileBlueprint(Blueprint);
 
-        bSaved = SaveLoadedAssetThrottled(Blueprint);
+        bSaved = QueueAssetSave(Blueprint);
 
         TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
         Result->SetStringField(TEXT("componentName"), ComponentName);
@@ -5775,7 +5642,7 @@ bool UMcpAutomationBridgeSubsystem::HandleSCSAction(
         FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
         bCompiled = McpSafeCompileBlueprint(Blueprint);
 
-        bSaved = SaveLoadedAssetThrottled(Blueprint);
+        bSaved = QueueAssetSave(Blueprint);
 
         TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
         Result->SetStringField(TEXT("componentName"), ComponentName);
@@ -6042,7 +5909,7 @@ bool UMcpAutomationBridgeSubsystem::HandleSCSAction(
       FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
       bCompiled = McpSafeCompileBlueprint(Blueprint);
 
-      bSaved = SaveLoadedAssetThrottled(Blueprint);
+      bSaved = QueueAssetSave(Blueprint);
 
       Result->SetBoolField(TEXT("compiled"), bCompiled);
       Result->SetBoolField(TEXT("saved"), bSaved);
@@ -0,0 +1,408 @@
+// Location:
+// McpAutomationBridge/Private/McpAutomationBridge_BulkSpawnHandlers.cpp
+// Summary: control_actor "spawn_actors_bulk" places many actors of one class
+//          or mesh in one request. Actors are spawned with deferred
+//          construction, constructed in one pass once all exist, labelled
+//          from a counter seeded by the actor index, and recorded as a single
+//          undo transaction. The response lists object names instead of a
+//          verification block per actor.
+// Usage: { "action": "control_actor", "payload": { "subAction":
+//          "spawn_actors_bulk", "meshPath": "/Game/Props/SM_Rock",
+//          "transforms": [ { "location": [0, 0, 0], "rotation": [0, 90, 0],
+//                            "scale": [1, 1, 1] }, ... ]
+//          | { packed f64x10 / f32x10 (quat, translation, scale)
+//              or f64x3 / f32x3 (locations) },
+//          "labelPrefix": "Rock", "folder": "Props/Rocks", "tags": ["Scatter"] } }
+
+#include "Dom/JsonObject.h"
+#include "HAL/PlatformTime.h"
+#include "McpActorIndex.h"
+#include "McpAutomationBridgeGlobals.h"
+#include "McpAutomationBridgeHelpers.h"
+#include "McpAutomationBridgeSubsystem.h"
+#include "McpJsonUtf8Writer.h"
+#include "McpPackedArray.h"
+
+#if WITH_EDITOR
+#include "Animation/SkeletalMeshActor.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "EditorAssetLibrary.h"
+#include "Engine/Level.h"
+#include "Engine/SkeletalMesh.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/World.h"
+#include "Misc/Optional.h"
+#include "ScopedTransaction.h"
+#endif
+
+#if WITH_EDITOR
+namespace {
+// Bounds one request's game-thread time and undo record; larger scatters
+// belong in several requests or in foliage.
+constexpr int32 MaxBulkSpawnActors = 50000;
+
+bool ReadBulkSpawnTransforms(const TSharedPtr<FJsonObject> &Payload,
+                             TArray<FTransform> &OutTransforms,
+                             FString &OutError) {
+  TSharedPtr<FJsonValue> Field = Payload->TryGetField(TEXT("transforms"));
+  if (!Field.IsValid()) {
+    Field = Payload->TryGetField(TEXT("locations"));
+  }
+  if (!Field.IsValid()) {
+    OutError = TEXT("transforms (or locations) required");
+    return false;
+  }
+
+  if (FMcpPackedArray::IsPackedValue(Field)) {
+    const TSharedPtr<FJsonObject> Packed = Field->AsObject();
+    FString Layout;
+    Packed->TryGetStringField(TEXT("layout"), Layout);
+    Layout = Layout.ToLower();
+    int32 Components = 0;
+    if (Layout == TEXT("f64x10") || Layout == TEXT("f32x10")) {
+      Components = 10;
+    } else if (Layout == TEXT("f64x3") || Layout == TEXT("f32x3")) {
+      Components = 3;
+    } else {
+      OutError = FString::Printf(
+          TEXT("Packed transform layout must be f64x10, f32x10, f64x3 or f32x3 "
+               "(got '%s')"),
+          *Layout);
+      return false;
+    }
+    const bool bDouble = Layout.StartsWith(TEXT("f64"));
+    const int32 ElementSize =
+        Components * (bDouble ? sizeof(double) : sizeof(float));
+    TArray<uint8> Bytes;
+    int32 Count = 0;
+    if (!FMcpPackedArray::DecodeRaw(*Packed, ElementSize, Bytes, Count,
+                                    OutError)) {
+      return false;
+    }
+    OutTransforms.SetNum(Count);
+    for (int32 Index = 0; Index < Count; ++Index) {
+      double D[10];
+      const uint8 *Element =
+          Bytes.GetData() + static_cast<int64>(Index) * ElementSize;
+      for (int32 C = 0; C < Components; ++C) {
+        D[C] = bDouble ? reinterpret_cast<const double *>(Element)[C]
+                       : reinterpret_cast<const float *>(Element)[C];
+      }
+      OutTransforms[Index] =
+          Components == 10
+              ? FTransform(FQuat(D[0], D[1], D[2], D[3]).GetNormalized(),
+                           FVector(D[4], D[5], D[6]), FVector(D[7], D[8], D[9]))
+              : FTransform(FVector(D[0], D[1], D[2]));
+    }
+    return true;
+  }
+
+  const TArray<TSharedPtr<FJsonValue>> *Rows = nullptr;
+  if (!Field->TryGetArray(Rows) || !Rows) {
+    OutError = TEXT("transforms must be an array or a packed block");
+    return false;
+  }
+  OutTransforms.Reserve(Rows->Num());
+  for (const TSharedPtr<FJsonValue> &Row : *Rows) {
+    if (!Row.IsValid()) {
+      continue;
+    }
+    if (Row->Type == EJson::Array) {
+      // A bare location, as "locations" carries them.
+      const TSharedPtr<FJsonObject> Wrapper = MakeShared<FJsonObject>();
+      Wrapper->SetField(TEXT("location"), Row);
+      OutTransforms.Add(FTransform(
+          ExtractVectorField(Wrapper, TEXT("location"), FVector::ZeroVector)));
+      continue;
+    }
+    if (Row->Type != EJson::Object) {
+      continue;
+    }
+    const TSharedPtr<FJsonObject> Obj = Row->AsObject();
+    if (!Obj->HasField(TEXT("location"))) {
+      // { x, y, z } location rows.
+      double X = 0, Y = 0, Z = 0;
+      Obj->TryGetNumberField(TEXT("x"), X);
+      Obj->TryGetNumberField(TEXT("y"), Y);
+      Obj->TryGetNumberField(TEXT("z"), Z);
+      OutTransforms.Add(FTransform(FVector(X, Y, Z)));
+      continue;
+    }
+    OutTransforms.Add(FTransform(
+        ExtractRotatorField(Obj, TEXT("rotation"), FRotator::ZeroRotator),
+        ExtractVectorField(Obj, TEXT("location"), FVector::ZeroVector),
+        ExtractVectorField(Obj, TEXT("scale"), FVector::OneVector)));
+  }
+  return true;
+}
+
+// One past the highest "<Prefix>_<N>" label in World, found through the
+// actor index's label trie instead of a scan of every actor.
+int32 NextBulkSpawnLabelIndex(FMcpActorIndex &Index, UWorld *World,
+                              const FString &Prefix) {
+  const FString Stem = Prefix + TEXT("_");
+  TArray<AActor *> Existing;
+  Index.FindByLabelPrefix(World, Stem, Existing);
+  int32 Next = 1;
+  for (AActor *Actor : Existing) {
+    const FString Suffix = Actor->GetActorLabel().RightChop(Stem.Len());
+    if (Suffix.IsNumeric()) {
+      Next = FMath::Max(Next, FCString::Atoi(*Suffix) + 1);
+    }
+  }
+  return Next;
+}
+} // namespace
+#endif
+
+/**
+ * @brief Spawn many actors of one class or mesh in a single request.
+ *
+ * Resolves blueprintPath, classPath or meshPath once, spawns every transform
+ * with deferred construction, then constructs them in one pass (a mesh is
+ * assigned before construction, so components register once with it).
+ * Labels come from labelPrefix and a counter past the highest existing
+ * "<prefix>_<n>". In the editor world all spawns form one undo transaction.
+ *
+ * @param RequestId Identifier of the request.
+ * @param Payload classPath / blueprintPath / meshPath, transforms (or
+ * locations), labelPrefix, folder, tags, mobility.
+ * @param Socket Socket that receives the response.
+ * @return true; a response is always sent.
+ */
+bool UMcpAutomationBridgeSubsystem::HandleControlActorSpawnBulk(
+    const FString &RequestId, const TSharedPtr<FJsonObject> &Payload,
+    TSharedPtr<FMcpBridgeWebSocket> Socket) {
+#if WITH_EDITOR
+  FString ClassPath = GetJsonStringField(Payload, TEXT("classPath"));
+  const FString BlueprintPath = GetJsonStringField(Payload, TEXT("blueprintPath"));
+  const FString MeshPath = GetJsonStringField(Payload, TEXT("meshPath"));
+
+  UClass *ResolvedClass = nullptr;
+  UStaticMesh *StaticMesh = nullptr;
+  USkeletalMesh *SkeletalMesh = nullptr;
+  if (!BlueprintPath.IsEmpty()) {
+    FString NormalizedPath;
+    FString LoadError;
+    if (UBlueprint *BP =
+            LoadBlueprintAsset(BlueprintPath, NormalizedPath, LoadError)) {
+      ResolvedClass = BP->GeneratedClass;
+    }
+    ClassPath = BlueprintPath;
+  } else if (!ClassPath.IsEmpty()) {
+    if (ClassPath.Contains(TEXT("/")) && !ClassPath.StartsWith(TEXT("/Script/"))) {
+      if (UObject *Loaded = UEditorAssetLibrary::LoadAsset(ClassPath)) {
+        if (UBlueprint *BP = Cast<UBlueprint>(Loaded))
+          ResolvedClass = BP->GeneratedClass;
+        else if (UClass *C = Cast<UClass>(Loaded))
+          ResolvedClass = C;
+        else if (UStaticMesh *Mesh = Cast<UStaticMesh>(Loaded))
+          StaticMesh = Mesh;
+        else if (USkeletalMesh *SkelMesh = Cast<USkeletalMesh>(Loaded))
+          SkeletalMesh = SkelMesh;
+      }
+    }
+    if (!ResolvedClass && !StaticMesh && !SkeletalMesh)
+      ResolvedClass = ResolveClassByName(ClassPath);
+  }
+  if (!StaticMesh && !SkeletalMesh && !MeshPath.IsEmpty()) {
+    if (UObject *MeshObj = UEditorAssetLibrary::LoadAsset(MeshPath)) {
+      StaticMesh = Cast<UStaticMesh>(MeshObj);
+      if (!StaticMesh)
+        SkeletalMesh = Cast<USkeletalMesh>(MeshObj);
+    }
+    if (!StaticMesh && !SkeletalMesh) {
+      SendStandardErrorResponse(
+          this, Socket, RequestId, TEXT("ASSET_NOT_FOUND"),
+          FString::Printf(TEXT("Mesh not found: %s"), *MeshPath));
+      return true;
+    }
+  }
+  if (!ResolvedClass) {
+    ResolvedClass = StaticMesh     ? AStaticMeshActor::StaticClass()
+                    : SkeletalMesh ? ASkeletalMeshActor::StaticClass()
+                                   : nullptr;
+  }
+  if (!ResolvedClass || !ResolvedClass->IsChildOf(AActor::StaticClass()) ||
+      ResolvedClass->HasAnyClassFlags(CLASS_Abstract)) {
+    SendStandardErrorResponse(
+        this, Socket, RequestId, TEXT("CLASS_NOT_FOUND"),
+        FString::Printf(TEXT("No spawnable actor class for '%s'."),
+                        ClassPath.IsEmpty() ? *MeshPath : *ClassPath));
+    return true;
+  }
+
+  TArray<FTransform> Transforms;
+  FString Error;
+  if (!ReadBulkSpawnTransforms(Payload, Transforms, Error) ||
+      Transforms.Num() == 0) {
+    SendStandardErrorResponse(this, Socket, RequestId, TEXT("INVALID_ARGUMENT"),
+                              Error.IsEmpty() ? TEXT("transforms is empty")
+                                              : Error);
+    return true;
+  }
+  if (Transforms.Num() > MaxBulkSpawnActors) {
+    SendStandardErrorResponse(
+        this, Socket, RequestId, TEXT("INVALID_ARGUMENT"),
+        FString::Printf(TEXT("spawn_actors_bulk accepts at most %d actors per "
+                             "request; split the placement."),
+                        MaxBulkSpawnActors));
+    return true;
+  }
+
+  const bool bPlayWorld = GEditor->PlayWorld != nullptr;
+  UWorld *World =
+      bPlayWorld ? GEditor->PlayWorld : GEditor->GetEditorWorldContext().World();
+  ULevel *Level = World ? World->GetCurrentLevel() : nullptr;
+  if (!Level) {
+    SendStandardErrorResponse(this, Socket, RequestId, TEXT("NO_WORLD"),
+                              TEXT("No world to spawn into"));
+    return true;
+  }
+
+  FString LabelPrefix = GetJsonStringField(Payload, TEXT("labelPrefix"));
+  if (LabelPrefix.IsEmpty()) {
+    LabelPrefix = StaticMesh     ? StaticMesh->GetName()
+                  : SkeletalMesh ? SkeletalMesh->GetName()
+                                 : ResolvedClass->GetName();
+    LabelPrefix.RemoveFromEnd(TEXT("_C"));
+  }
+  const FString Folder = GetJsonStringField(Payload, TEXT("folder"));
+  TArray<FName> Tags;
+  const TArray<TSharedPtr<FJsonValue>> *TagsArr = nullptr;
+  if (Payload->TryGetArrayField(TEXT("tags"), TagsArr) && TagsArr) {
+    for (const TSharedPtr<FJsonValue> &TagVal : *TagsArr) {
+      Tags.Add(FName(*TagVal->AsString()));
+    }
+  }
+  TOptional<EComponentMobility::Type> Mobility;
+  const FString MobilityStr = GetJsonStringField(Payload, TEXT("mobility"));
+  if (MobilityStr.Equals(TEXT("static"), ESearchCase::IgnoreCase))
+    Mobility = EComponentMobility::Static;
+  else if (MobilityStr.Equals(TEXT("stationary"), ESearchCase::IgnoreCase))
+    Mobility = EComponentMobility::Stationary;
+  else if (MobilityStr.Equals(TEXT("movable"), ESearchCase::IgnoreCase))
+    Mobility = EComponentMobility::Movable;
+
+  const double StartSeconds = FPlatformTime::Seconds();
+  int32 NextLabel = NextBulkSpawnLabelIndex(GetActorIndex(), World, LabelPrefix);
+
+  // PIE spawns are not undoable; editor spawns share one transaction.
+  TOptional<FScopedTransaction> Transaction;
+  if (!bPlayWorld) {
+    Transaction.Emplace(FText::FromString(FString::Printf(
+        TEXT("MCP Spawn %d Actors"), Transforms.Num())));
+    Level->Modify();
+  }
+
+  FActorSpawnParameters SpawnParams;
+  SpawnParams.OverrideLevel = Level;
+  SpawnParams.bDeferConstruction = true;
+  SpawnParams.SpawnCollisionHandlingOverride =
+      ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+  if (!bPlayWorld) {
+    SpawnParams.ObjectFlags |= RF_Transactional;
+  }
+
+  // Spawn everything first; construction scripts and component registration
+  // wait for the pass below.
+  TArray<TPair<AActor *, int32>> Spawned;
+  Spawned.Reserve(Transforms.Num());
+  for (int32 Index = 0; Index < Transforms.Num(); ++Index) {
+    AActor *Actor =
+        World->SpawnActor(ResolvedClass, &Transforms[Index], SpawnParams);
+    if (!Actor) {
+      continue;
+    }
+    if (StaticMesh) {
+      if (AStaticMeshActor *MeshActor = Cast<AStaticMeshActor>(Actor)) {
+        UStaticMeshComponent *MeshComponent = MeshActor->GetStaticMeshComponent();
+        if (Mobility.IsSet())
+          MeshComponent->SetMobility(Mobility.GetValue());
+        MeshComponent->SetStaticMesh(StaticMesh);
+      }
+    } else if (SkeletalMesh) {
+      if (ASkeletalMeshActor *SkelActor = Cast<ASkeletalMeshActor>(Actor)) {
+        USkeletalMeshComponent *SkelComponent =
+            SkelActor->GetSkeletalMeshComponent();
+        if (Mobility.IsSet())
+          SkelComponent->SetMobility(Mobility.GetValue());
+        SkelComponent->SetSkeletalMesh(SkeletalMesh);
+      }
+    } else if (Mobility.IsSet() && Actor->GetRootComponent()) {
+      Actor->GetRootComponent()->SetMobility(Mobility.GetValue());
+    }
+    Actor->Tags.Append(Tags);
+    Spawned.Emplace(Actor, Index);
+  }
+  const double SpawnedSeconds = FPlatformTime::Seconds();
+
+  for (const TPair<AActor *, int32> &Entry : Spawned) {
+    Entry.Key->FinishSpawning(Transforms[Entry.Value]);
+  }
+  const double ConstructedSeconds = FPlatformTime::Seconds();
+
+  const FString FirstLabel = FString::Printf(TEXT("%s_%d"), *LabelPrefix, NextLabel);
+  for (const TPair<AActor *, int32> &Entry : Spawned) {
+    AActor *Actor = Entry.Key;
+    if (!IsValid(Actor)) {
+      continue;
+    }
+    Actor->SetActorLabel(FString::Printf(TEXT("%s_%d"), *LabelPrefix, NextLabel++),
+                         /*bMarkDirty=*/false);
+    if (!Folder.IsEmpty()) {
+      Actor->SetFolderPath(FName(*Folder));
+    }
+  }
+  Level->MarkPackageDirty();
+
+  // Compact result: object names, which FindActorByName resolves exactly,
+  // plus the label range and the path prefix that makes them full paths.
+  FMcpJsonUtf8Writer Data;
+  Data.BeginObject();
+  Data.WriteString(TEXT("classPath"), ResolvedClass->GetPathName());
+  if (StaticMesh)
+    Data.WriteString(TEXT("meshPath"), StaticMesh->GetPathName());
+  else if (SkeletalMesh)
+    Data.WriteString(TEXT("meshPath"), SkeletalMesh->GetPathName());
+  Data.WriteString(TEXT("pathPrefix"), Level->GetPathName() + TEXT("."));
+  Data.WriteInt(TEXT("requested"), Transforms.Num());
+  Data.WriteInt(TEXT("count"), Spawned.Num());
+  Data.WriteInt(TEXT("failed"), Transforms.Num() - Spawned.Num());
+  if (Spawned.Num() > 0) {
+    Data.WriteString(TEXT("firstLabel"), FirstLabel);
+    Data.WriteString(TEXT("lastLabel"),
+                     FString::Printf(TEXT("%s_%d"), *LabelPrefix, NextLabel - 1));
+  }
+  Data.Key(TEXT("actors"));
+  Data.BeginArray();
+  for (const TPair<AActor *, int32> &Entry : Spawned) {
+    if (IsValid(Entry.Key)) {
+      Data.String(Entry.Key->GetName());
+    }
+  }
+  Data.EndArray();
+  Data.WriteBool(TEXT("undoable"), !bPlayWorld);
+  Data.WriteNumber(TEXT("spawnMs"), (SpawnedSeconds - StartSeconds) * 1000.0);
+  Data.WriteNumber(TEXT("constructMs"),
+                   (ConstructedSeconds - SpawnedSeconds) * 1000.0);
+  Data.WriteNumber(TEXT("durationMs"),
+                   (FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+  Data.EndObject();
+
+  UE_LOG(LogMcpAutomationBridgeSubsystem, Display,
+         TEXT("ControlActor: Bulk spawned %d of %d '%s' actors"), Spawned.Num(),
+         Transforms.Num(), *ResolvedClass->GetName());
+  SendAutomationResponse(
+      Socket, RequestId, Spawned.Num() == Transforms.Num(),
+      FString::Printf(TEXT("Spawned %d of %d actors"), Spawned.Num(),
+                      Transforms.Num()),
+      MoveTemp(Data),
+      Spawned.Num() == Transforms.Num() ? FString() : TEXT("SPAWN_PARTIAL"));
+  return true;
+#else
+  return false;
+#endif
+}
@@ -5,6 +5,9 @@
 #include "McpAutomationBridgeGlobals.h"
 #include "McpAutomationBridgeHelpers.h"
 #include "McpAutomationBridgeSubsystem.h"
+#include "McpActorIndex.h"
+#include "McpActorQuery.h"
+#include "McpViewportCapture.h"
 #include "Misc/ScopeExit.h"
 #include "Misc/Base64.h"
 #include "IImageWrapper.h"
@@ -107,44 +110,32 @@ AActor *UMcpAutomationBridgeSubsystem::FindActorByName(const FString &Target, bo
     // world. Let's fallback if not found, just in case.
   }
 
-  UEditorActorSubsystem *ActorSS =
-      GEditor->GetEditorSubsystem<UEditorActorSubsystem>();
-  if (!ActorSS)
+  UWorld *EditorWorld = GEditor->GetEditorWorldContext().World();
+  if (!EditorWorld)
     return nullptr;
 
-  TArray<AActor *> AllActors = ActorSS->GetAllLevelActors();
-  AActor *ExactMatch = nullptr;
-  TArray<AActor *> FuzzyMatches;
-
-  for (AActor *A : AllActors) {
-    if (!A)
-      continue;
-    if (A->GetActorLabel().Equals(Target, ESearchCase::IgnoreCase) ||
-        A->GetName().Equals(Target, ESearchCase::IgnoreCase) ||
-        A->GetPathName().Equals(Target, ESearchCase::IgnoreCase)) {
-      ExactMatch = A;
-      break;
-    }
-    // Collect fuzzy matches ONLY if exact matching is not required
-    // CRITICAL FIX: Fuzzy matching can cause delete operations to delete wrong actors
-    // (e.g., "TestActor_Copy" matches when searching for "TestActor")
-    if (!bExactMatchOnly && A->GetActorLabel().Contains(Target, ESearchCase::IgnoreCase)) {
-      FuzzyMatches.Add(A);
-    }
-  }
-
-  if (ExactMatch) {
+  FMcpActorIndex &Index = GetActorIndex();
+  if (AActor *ExactMatch = Index.FindExact(EditorWorld, Target)) {
     return ExactMatch;
   }
 
-  // If no exact match, check fuzzy matches ONLY if exact matching is not required
+  // Fuzzy matches ONLY if exact matching is not required
+  // CRITICAL FIX: Fuzzy matching can cause delete operations to delete wrong
+  // actors (e.g., "TestActor_Copy" matches when searching for "TestActor")
   if (!bExactMatchOnly) {
+    // A label starting with Target wins over one that merely contains it.
+    // Two results are enough to know the match is ambiguous.
+    TArray<AActor *> FuzzyMatches;
+    Index.FindByLabelPrefix(EditorWorld, Target, FuzzyMatches, 2);
+    if (FuzzyMatches.Num() == 0) {
+      Index.FindContaining(EditorWorld, Target, true, FuzzyMatches, 2);
+    }
     if (FuzzyMatches.Num() == 1) {
       return FuzzyMatches[0];
     } else if (FuzzyMatches.Num() > 1) {
       UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
-             TEXT("FindActorByName: Ambiguous match for '%s'. Found %d matches."),
-             *Target, FuzzyMatches.Num());
+             TEXT("FindActorByName: Ambiguous match for '%s'. Found multiple matches."),
+             *Target);
     }
   }
 
@@ -158,6 +149,50 @@ AActor *UMcpAutomationBridgeSubsystem::FindActorByName(const FString &Target, bo
   return nullptr;
 }
 
+UActorComponent *UMcpAutomationBridgeSubsystem::FindActorComponent(
+    const FString &ActorName, const FString &ComponentName, AActor **OutActor) {
+  if (OutActor)
+    *OutActor = nullptr;
+#if WITH_EDITOR
+  if (ActorName.IsEmpty() || ComponentName.IsEmpty() || !GEditor)
+    return nullptr;
+
+  // Only editor-world results are memoized; PIE actors come and go.
+  UWorld *EditorWorld =
+      GEditor->PlayWorld ? nullptr : GEditor->GetEditorWorldContext().World();
+  const FString ComponentPath = ActorName + TEXT(".") + ComponentName;
+  if (EditorWorld) {
+    if (UActorComponent *Cached =
+            GetActorIndex().FindCachedComponent(EditorWorld, ComponentPath)) {
+      if (OutActor)
+        *OutActor = Cached->GetOwner();
+      return Cached;
+    }
+  }
+
+  AActor *Actor = FindActorByName(ActorName);
+  if (OutActor)
+    *OutActor = Actor;
+  if (!Actor)
+    return nullptr;
+  UActorComponent *Component = FindComponentByName(Actor, ComponentName);
+  if (Component && EditorWorld && Actor->GetWorld() == EditorWorld)
+    GetActorIndex().CacheComponent(ComponentPath, Component);
+  return Component;
+#else
+  return nullptr;
+#endif
+}
+
+#if WITH_EDITOR
+FMcpActorIndex &UMcpAutomationBridgeSubsystem::GetActorIndex() {
+  if (!ActorIndex.IsValid()) {
+    ActorIndex = MakeShared<FMcpActorIndex>();
+  }
+  return *ActorIndex;
+}
+#endif
+
 bool UMcpAutomationBridgeSubsystem::HandleControlActorSpawn(
     const FString &RequestId, const TSharedPtr<FJsonObject> &Payload,
     TSharedPtr<FMcpBridgeWebSocket> Socket) {
@@ -965,6 +1000,8 @@ bool UMcpAutomationBridgeSubsystem::HandleControlActorAddComponent(
   NewComponent->SetFlags(RF_Transactional);
   Found->AddInstanceComponent(NewComponent);
   NewComponent->OnComponentCreated();
+  // A new component can win a fuzzy name that used to pick another one.
+  GetActorIndex().InvalidateComponents();
 
   if (USceneComponent *SceneComp = Cast<USceneComponent>(NewComponent)) {
     if (Found->GetRootComponent() && !SceneComp->GetAttachParent()) {
@@ -1078,16 +1115,17 @@ bool UMcpAutomationBridgeSubsystem::HandleControlActorSetComponentProperties(
     return true;
   }
 
-  AActor *Found = FindActorByName(TargetName);
+  // CRITICAL FIX: FindActorComponent uses FindComponentByName, which supports
+  // fuzzy matching
+  AActor *Found = nullptr;
+  UActorComponent *TargetComponent =
+      FindActorComponent(TargetName, ComponentName, &Found);
   if (!Found) {
     SendStandardErrorResponse(this, Socket, RequestId, TEXT("ACTOR_NOT_FOUND"),
                               TEXT("Actor not found"), nullptr);
     return true;
   }
 
-  // CRITICAL FIX: Use FindComponentByName helper which supports fuzzy matching
-  UActorComponent *TargetComponent = FindComponentByName(Found, ComponentName);
-
   if (!TargetComponent) {
     SendStandardErrorResponse(this, Socket, RequestId, TEXT("COMPONENT_NOT_FOUND"),
                               TEXT("Component not found"), nullptr);
@@ -1521,9 +1559,16 @@ bool UMcpAutomationBridgeSubsystem::HandleControlActorFindByTag(
          TEXT("HandleControlActorFindByTag: Searching for tag '%s' (FName: %s)"),
          *TagValue, *TagName.ToString());
 
-  UEditorActorSubsystem *ActorSS =
-      GEditor->GetEditorSubsystem<UEditorActorSubsystem>();
-  TArray<AActor *> AllActors = ActorSS->GetAllLevelActors();
+  // Exact tags come straight from the actor index; substring matching still
+  // has to look at every actor's tags.
+  TArray<AActor *> AllActors;
+  if (MatchType == TEXT("contains")) {
+    AllActors = GEditor->GetEditorSubsystem<UEditorActorSubsystem>()
+                    ->GetAllLevelActors();
+  } else {
+    GetActorIndex().FindByTag(GEditor->GetEditorWorldContext().World(),
+                              TagName, AllActors);
+  }
   
   // DEBUG: Log total actors being searched
   UE_LOG(LogMcpAutomationBridgeSubsystem, Display,
@@ -1604,6 +1649,7 @@ bool UMcpAutomationBridgeSubsystem::HandleControlActorAddTag(
   Found->Modify();
   Found->Tags.AddUnique(TagName);
   Found->MarkPackageDirty();
+  GetActorIndex().NotifyActorChanged(Found);
 
   TSharedPtr<FJsonObject> Data = MakeShared<FJsonObject>();
   Data->SetBoolField(TEXT("wasPresent"), bAlreadyHad);
@@ -1642,29 +1688,20 @@ bool UMcpAutomationBridgeSubsystem::HandleControlActorFindByName(
     return true;
   }
 
-  UEditorActorSubsystem *ActorSS =
-      GEditor->GetEditorSubsystem<UEditorActorSubsystem>();
-  const TArray<AActor *> AllActors = ActorSS->GetAllLevelActors();
+  // Label, name or path containing the query, from the actor index.
+  TArray<AActor *> Found;
+  GetActorIndex().FindContaining(GEditor->GetEditorWorldContext().World(),
+                                 Query, false, Found);
   TArray<TSharedPtr<FJsonValue>> Matches;
-  for (AActor *Actor : AllActors) {
-    if (!Actor)
-      continue;
-    const FString Label = Actor->GetActorLabel();
-    const FString Name = Actor->GetName();
-    const FString Path = Actor->GetPathName();
-    const bool bMatches = Label.Contains(Query, ESearchCase::IgnoreCase) ||
-                          Name.Contains(Query, ESearchCase::IgnoreCase) ||
-                          Path.Contains(Query, ESearchCase::IgnoreCase);
-    if (bMatches) {
-      TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
-      Entry->SetStringField(TEXT("label"), Label);
-      Entry->SetStringField(TEXT("name"), Name);
-      Entry->SetStringField(TEXT("path"), Path);
-      Entry->SetStringField(TEXT("class"),
-                            Actor->GetClass() ? Actor->GetClass()->GetPathName()
-                                              : TEXT(""));
-      Matches.Add(MakeShared<FJsonValueObject>(Entry));
-    }
+  for (AActor *Actor : Found) {
+    TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
+    Entry->SetStringField(TEXT("label"), Actor->GetActorLabel());
+    Entry->SetStringField(TEXT("name"), Actor->GetName());
+    Entry->SetStringField(TEXT("path"), Actor->GetPathName());
+    Entry->SetStringField(TEXT("class"),
+                          Actor->GetClass() ? Actor->GetClass()->GetPathName()
+                                            : TEXT(""));
+    Matches.Add(MakeShared<FJsonValueObject>(Entry));
   }
 
   TSharedPtr<FJsonObject> Data = MakeShared<FJsonObject>();
@@ -1694,17 +1731,15 @@ bool UMcpAutomationBridgeSubsystem::HandleControlActorDeleteByTag(
   const FName TagName(*TagValue);
   UEditorActorSubsystem *ActorSS =
       GEditor->GetEditorSubsystem<UEditorActorSubsystem>();
-  const TArray<AActor *> AllActors = ActorSS->GetAllLevelActors();
+  TArray<AActor *> Tagged;
+  GetActorIndex().FindByTag(GEditor->GetEditorWorldContext().World(), TagName,
+                            Tagged);
   TArray<FString> Deleted;
 
-  for (AActor *Actor : AllActors) {
-    if (!Actor)
-      continue;
-    if (Actor->ActorHasTag(TagName)) {
-      const FString Label = Actor->GetActorLabel();
-      if (ActorSS->DestroyActor(Actor))
-        Deleted.Add(Label);
-    }
+  for (AActor *Actor : Tagged) {
+    const FString Label = Actor->GetActorLabel();
+    if (ActorSS->DestroyActor(Actor))
+      Deleted.Add(Label);
   }
 
   TSharedPtr<FJsonObject> Data = MakeShared<FJsonObject>();
@@ -2053,6 +2088,7 @@ bool UMcpAutomationBridgeSubsystem::HandleControlActorRemoveTag(
   Found->Modify();
   Found->Tags.Remove(TagName);
   Found->MarkPackageDirty();
+  GetActorIndex().NotifyActorChanged(Found);
 
   TSharedPtr<FJsonObject> Data = MakeShared<FJsonObject>();
   Data->SetBoolField(TEXT("wasPresent"), true);
@@ -2113,38 +2149,58 @@ bool UMcpAutomationBridgeSubsystem::HandleControlActorFindByClass(
     }
   }
 
-  TSharedPtr<FJsonObject> Data = MakeShared<FJsonObject>();
-  TArray<TSharedPtr<FJsonValue>> ActorsArray;
-
-  if (UWorld* World = GEditor->GetEditorWorldContext().World()) {
-    UClass* ClassToFind = nullptr;
-
-    // CRITICAL FIX: Use ResolveClassByName for proper engine class resolution
-    // This handles: full paths, short names like "StaticMeshActor", and loads classes if needed
-    // Without this, FindObject only finds already-loaded classes, missing engine classes like
-    // AStaticMeshActor, APawn, etc. that haven't been accessed yet
-    ClassToFind = ResolveClassByName(ClassName);
-
-    if (ClassToFind) {
-      for (TActorIterator<AActor> It(World, ClassToFind); It; ++It) {
-        if (AActor* Actor = *It) {
-          TSharedPtr<FJsonObject> ActorObj = MakeShared<FJsonObject>();
-          ActorObj->SetStringField(TEXT("name"), Actor->GetActorLabel());
-          ActorObj->SetStringField(TEXT("path"), Actor->GetPathName());
-          ActorsArray.Add(MakeShared<FJsonValueObject>(ActorObj));
-        }
-      }
-    } else {
-      // Class not found - return empty result (this is valid for searches)
+  FMcpActorQuery Query;
+  FString Error;
+  if (!FMcpActorQuery::Parse(Payload,
+                             EMcpActorField::Name | EMcpActorField::Path,
+                             Query, Error)) {
+    SendStandardErrorResponse(this, Socket, RequestId, TEXT("INVALID_ARGUMENT"),
+                              Error, nullptr);
+    return true;
+  }
+  // "name" has always carried the label here.
+  Query.bNameIsLabel = true;
+
+  // CRITICAL FIX: Use ResolveClassByName for proper engine class resolution
+  // This handles: full paths, short names like "StaticMeshActor", and loads classes if needed
+  // Without this, FindObject only finds already-loaded classes, missing engine classes like
+  // AStaticMeshActor, APawn, etc. that haven't been accessed yet
+  Query.Class = ResolveClassByName(ClassName);
+  UWorld* World = GEditor->GetEditorWorldContext().World();
+  if (!World || !Query.Class) {
+    // Class not found - return empty result (this is valid for searches)
+    if (!Query.Class) {
       UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
              TEXT("HandleControlActorFindByClass: Class '%s' not found"), *ClassName);
     }
-  }
-
-  Data->SetArrayField(TEXT("actors"), ActorsArray);
-  Data->SetNumberField(TEXT("count"), ActorsArray.Num());
-  SendStandardSuccessResponse(this, Socket, RequestId,
-                              FString::Printf(TEXT("Found %d actors"), ActorsArray.Num()), Data);
+    TSharedPtr<FJsonObject> Data = MakeShared<FJsonObject>();
+    Data->SetArrayField(TEXT("actors"), TArray<TSharedPtr<FJsonValue>>());
+    Data->SetNumberField(TEXT("count"), 0);
+    SendStandardSuccessResponse(this, Socket, RequestId, TEXT("Found 0 actors"), Data);
+    return true;
+  }
+
+  FMcpJsonUtf8Writer Data;
+  Data.BeginObject();
+  TWeakObjectPtr<UMcpAutomationBridgeSubsystem> WeakSubsystem(this);
+  FMcpActorQueryRunner::Run(
+      World, GetActorIndex(), Query, MoveTemp(Data),
+      [WeakSubsystem, Socket, RequestId](FMcpJsonUtf8Writer &&Page,
+                                         int32 Returned,
+                                         const FString &ErrorCode) {
+        UMcpAutomationBridgeSubsystem *Subsystem = WeakSubsystem.Get();
+        if (!ErrorCode.IsEmpty()) {
+          SendStandardErrorResponse(
+              Subsystem, Socket, RequestId, ErrorCode,
+              TEXT("Cursor expired or unknown; search again without it."),
+              nullptr);
+          return;
+        }
+        Page.EndObject();
+        SendStandardSuccessResponse(
+            Subsystem, Socket, RequestId,
+            FString::Printf(TEXT("Found %d actors"), Returned), Page);
+      });
   return true;
 #else
   return false;
@@ -2189,6 +2245,7 @@ bool UMcpAutomationBridgeSubsystem::HandleControlActorRemoveComponent(
   UActorComponent* Component = FindComponentByName(Actor, ComponentName);
   if (Component) {
     Component->DestroyComponent();
+    GetActorIndex().InvalidateComponents();
     TSharedPtr<FJsonObject> Data = MakeShared<FJsonObject>();
     Data->SetStringField(TEXT("actorName"), ActorName);
     Data->SetStringField(TEXT("componentName"), ComponentName);
@@ -2224,15 +2281,15 @@ bool UMcpAutomationBridgeSubsystem::HandleControlActorGetComponentProperty(
     return true;
   }
   
-  AActor* Actor = FindActorByName(ActorName);
+  // CRITICAL FIX: FindActorComponent uses FindComponentByName, which supports fuzzy matching
+  // This handles cases where component names have numeric suffixes (e.g., "StaticMeshComponent0")
+  AActor* Actor = nullptr;
+  UActorComponent* Component = FindActorComponent(ActorName, ComponentName, &Actor);
   if (!Actor) {
     SendAutomationError(Socket, RequestId, FString::Printf(TEXT("Actor not found: %s"), *ActorName), TEXT("ACTOR_NOT_FOUND"));
     return true;
   }
   
-  // CRITICAL FIX: Use FindComponentByName helper which supports fuzzy matching
-  // This handles cases where component names have numeric suffixes (e.g., "StaticMeshComponent0")
-  UActorComponent* Component = FindComponentByName(Actor, ComponentName);
   if (!Component) {
     SendAutomationError(Socket, RequestId, 
         FString::Printf(TEXT("Component not found: %s on actor: %s"), *ComponentName, *ActorName), 
@@ -2414,6 +2471,8 @@ bool UMcpAutomationBridgeSubsystem::HandleControlActorAction(
   if (LowerSub == TEXT("spawn_blueprint"))
     return HandleControlActorSpawnBlueprint(RequestId, Payload,
                                             RequestingSocket);
+  if (LowerSub == TEXT("spawn_actors_bulk") || LowerSub == TEXT("spawn_bulk"))
+    return HandleControlActorSpawnBulk(RequestId, Payload, RequestingSocket);
   if (LowerSub == TEXT("delete") || LowerSub == TEXT("remove") ||
       LowerSub == TEXT("destroy_actor"))
     return HandleControlActorDelete(RequestId, Payload, RequestingSocket);
@@ -2656,22 +2715,16 @@ bool UMcpAutomationBridgeSubsystem::HandleControlEditorFocusActor(
     return true;
   }
 
-  if (UEditorActorSubsystem *ActorSS =
-          GEditor->GetEditorSubsystem<UEditorActorSubsystem>()) {
-    TArray<AActor *> Actors = ActorSS->GetAllLevelActors();
-    for (AActor *Actor : Actors) {
-      if (!Actor)
-        continue;
-      if (Actor->GetActorLabel().Equals(ActorName, ESearchCase::IgnoreCase)) {
-        GEditor->SelectNone(true, true, false);
-        GEditor->SelectActor(Actor, true, true, true);
-        GEditor->Exec(nullptr, TEXT("EDITORTEMPVIEWPORT"));
-        GEditor->MoveViewportCamerasToActor(*Actor, false);
-        SendAutomationResponse(Socket, RequestId, true,
-                               TEXT("Viewport focused on actor"), nullptr,
-                               FString());
-        return true;
-      }
+  if (UWorld *EditorWorld = GEditor->GetEditorWorldContext().World()) {
+    if (AActor *Actor = GetActorIndex().FindByLabel(EditorWorld, ActorName)) {
+      GEditor->SelectNone(true, true, false);
+      GEditor->SelectActor(Actor, true, true, true);
+      GEditor->Exec(nullptr, TEXT("EDITORTEMPVIEWPORT"));
+      GEditor->MoveViewportCamerasToActor(*Actor, false);
+      SendAutomationResponse(Socket, RequestId, true,
+                             TEXT("Viewport focused on actor"), nullptr,
+                             FString());
+      return true;
     }
     SendStandardErrorResponse(this, Socket, RequestId, TEXT("ACTOR_NOT_FOUND"),
                               TEXT("Actor not found"), nullptr);
@@ -2876,6 +2929,10 @@ bool UMcpAutomationBridgeSubsystem::HandleControlEditorAction(
     return HandleControlEditorOpenLevel(RequestId, Payload, RequestingSocket);
   if (LowerSub == TEXT("capture_viewport"))
     return HandleControlEditorCaptureViewport(RequestId, Payload, RequestingSocket);
+  if (LowerSub == TEXT("subscribe_viewport_stream"))
+    return HandleControlEditorSubscribeViewportStream(RequestId, Payload, RequestingSocket);
+  if (LowerSub == TEXT("unsubscribe_viewport_stream"))
+    return HandleControlEditorUnsubscribeViewportStream(RequestId, Payload, RequestingSocket);
 
   // --------------------------------------------------------------------------
   // begin_transaction
@@ -4175,126 +4232,56 @@ bool UMcpAutomationBridgeSubsystem::HandleControlEditorCaptureViewport(
     return true;
   }
 
-  // Capture viewport pixels
-  TArray<FColor> Bitmap;
-  if (!Viewport->ReadPixels(Bitmap)) {
-    SendStandardErrorResponse(this, Socket, RequestId, TEXT("CAPTURE_FAILED"),
-                              TEXT("Failed to read viewport pixels"), nullptr);
-    return true;
-  }
-
-  const int32 SrcWidth = Viewport->GetSizeXY().X;
-  const int32 SrcHeight = Viewport->GetSizeXY().Y;
-
-  if (Bitmap.Num() == 0 || SrcWidth <= 0 || SrcHeight <= 0) {
-    SendStandardErrorResponse(this, Socket, RequestId, TEXT("CAPTURE_FAILED"),
-                              TEXT("Viewport returned empty bitmap"), nullptr);
-    return true;
-  }
-
-  // Resize if necessary
-  TArray<FColor> ResizedBitmap;
-  int32 FinalWidth = SrcWidth;
-  int32 FinalHeight = SrcHeight;
-  const TArray<FColor>* PixelSource = &Bitmap;
-
-  if (RequestedWidth != SrcWidth || RequestedHeight != SrcHeight) {
-    FinalWidth = RequestedWidth;
-    FinalHeight = RequestedHeight;
-    ResizedBitmap.SetNum(FinalWidth * FinalHeight);
-
-    // Bilinear resize
-    for (int32 Y = 0; Y < FinalHeight; ++Y) {
-      for (int32 X = 0; X < FinalWidth; ++X) {
-        const float SrcX = (static_cast<float>(X) + 0.5f) * SrcWidth / FinalWidth - 0.5f;
-        const float SrcY = (static_cast<float>(Y) + 0.5f) * SrcHeight / FinalHeight - 0.5f;
-
-        const int32 X0 = FMath::Clamp(FMath::FloorToInt32(SrcX), 0, SrcWidth - 1);
-        const int32 Y0 = FMath::Clamp(FMath::FloorToInt32(SrcY), 0, SrcHeight - 1);
-        const int32 X1 = FMath::Clamp(X0 + 1, 0, SrcWidth - 1);
-        const int32 Y1 = FMath::Clamp(Y0 + 1, 0, SrcHeight - 1);
-
-        const float XFrac = SrcX - FMath::FloorToFloat(SrcX);
-        const float YFrac = SrcY - FMath::FloorToFloat(SrcY);
-
-        const FColor& C00 = Bitmap[Y0 * SrcWidth + X0];
-        const FColor& C10 = Bitmap[Y0 * SrcWidth + X1];
-        const FColor& C01 = Bitmap[Y1 * SrcWidth + X0];
-        const FColor& C11 = Bitmap[Y1 * SrcWidth + X1];
-
-        const float OneMinusXFrac = 1.0f - XFrac;
-        const float OneMinusYFrac = 1.0f - YFrac;
-
-        ResizedBitmap[Y * FinalWidth + X] = FColor(
-          static_cast<uint8>(FMath::Clamp(
-            C00.R * OneMinusXFrac * OneMinusYFrac + C10.R * XFrac * OneMinusYFrac +
-            C01.R * OneMinusXFrac * YFrac + C11.R * XFrac * YFrac, 0.0f, 255.0f)),
-          static_cast<uint8>(FMath::Clamp(
-            C00.G * OneMinusXFrac * OneMinusYFrac + C10.G * XFrac * OneMinusYFrac +
-            C01.G * OneMinusXFrac * YFrac + C11.G * XFrac * YFrac, 0.0f, 255.0f)),
-          static_cast<uint8>(FMath::Clamp(
-            C00.B * OneMinusXFrac * OneMinusYFrac + C10.B * XFrac * OneMinusYFrac +
-            C01.B * OneMinusXFrac * YFrac + C11.B * XFrac * YFrac, 0.0f, 255.0f)),
-          255
-        );
-      }
-    }
-    PixelSource = &ResizedBitmap;
-  }
-
-  // Convert FColor array to raw RGBA bytes for IImageWrapper
-  TArray<uint8> RawData;
-  RawData.SetNum(FinalWidth * FinalHeight * 4);
-  for (int32 i = 0; i < PixelSource->Num(); ++i) {
-    RawData[i * 4 + 0] = (*PixelSource)[i].R;
-    RawData[i * 4 + 1] = (*PixelSource)[i].G;
-    RawData[i * 4 + 2] = (*PixelSource)[i].B;
-    RawData[i * 4 + 3] = (*PixelSource)[i].A;
-  }
-
-  // Compress using IImageWrapper
-  IImageWrapperModule& ImageWrapperModule =
-      FModuleManager::LoadModuleChecked<IImageWrapperModule>(FName("ImageWrapper"));
-  EImageFormat ImageFormat = bUsePng ? EImageFormat::PNG : EImageFormat::JPEG;
-  TSharedPtr<IImageWrapper> ImageWrapper = ImageWrapperModule.CreateImageWrapper(ImageFormat);
-
-  if (!ImageWrapper.IsValid()) {
-    SendStandardErrorResponse(this, Socket, RequestId, TEXT("ENCODE_FAILED"),
-                              TEXT("Failed to create image encoder"), nullptr);
-    return true;
-  }
-
-  if (!ImageWrapper->SetRaw(RawData.GetData(), RawData.Num(), FinalWidth, FinalHeight, ERGBFormat::RGBA, 8)) {
-    SendStandardErrorResponse(this, Socket, RequestId, TEXT("ENCODE_FAILED"),
-                              TEXT("Failed to set raw pixel data"), nullptr);
-    return true;
-  }
-
-  TArray<uint8> CompressedData = ImageWrapper->GetCompressed(bUsePng ? 100 : Quality);
-
-  if (CompressedData.Num() == 0) {
-    SendStandardErrorResponse(this, Socket, RequestId, TEXT("ENCODE_FAILED"),
-                              TEXT("Failed to compress image"), nullptr);
-    return true;
-  }
-
-  // Base64 encode
-  FString Base64Data = FBase64::Encode(CompressedData);
+  // Read the viewport back without flushing rendering: the frame is scaled on
+  // the GPU, copied out a frame or two later and encoded on a worker, and the
+  // response is sent from there.
+  FMcpViewportCaptureRequest Request;
+  Request.Width = RequestedWidth;
+  Request.Height = RequestedHeight;
+  Request.Format = bUsePng ? EImageFormat::PNG : EImageFormat::JPEG;
+  Request.Quality = Quality;
+
+  TWeakObjectPtr<UMcpAutomationBridgeSubsystem> WeakSubsystem(this);
+  FMcpViewportCapture::Capture(
+      Viewport, Request,
+      [WeakSubsystem, RequestId, Socket,
+       bUsePng](FMcpViewportCaptureResult &&Result) {
+        UMcpAutomationBridgeSubsystem *Subsystem = WeakSubsystem.Get();
+        if (!Subsystem) {
+          return;
+        }
+        if (!Result.bSuccess) {
+          SendStandardErrorResponse(Subsystem, Socket, RequestId,
+                                    Result.ErrorCode, Result.Error, nullptr);
+          return;
+        }
 
-  // Build response
-  TSharedPtr<FJsonObject> Resp = MakeShared<FJsonObject>();
-  Resp->SetBoolField(TEXT("success"), true);
-  Resp->SetStringField(TEXT("imageBase64"), Base64Data);
-  Resp->SetStringField(TEXT("mimeType"), bUsePng ? TEXT("image/png") : TEXT("image/jpeg"));
-  Resp->SetNumberField(TEXT("width"), FinalWidth);
-  Resp->SetNumberField(TEXT("height"), FinalHeight);
-  Resp->SetStringField(TEXT("format"), bUsePng ? TEXT("png") : TEXT("jpeg"));
-  Resp->SetNumberField(TEXT("sizeBytes"), CompressedData.Num());
-  Resp->SetStringField(TEXT("message"),
-      FString::Printf(TEXT("Viewport captured (%dx%d, %s, %d bytes)"),
-          FinalWidth, FinalHeight, bUsePng ? TEXT("png") : TEXT("jpeg"), CompressedData.Num()));
-
-  SendAutomationResponse(Socket, RequestId, true, TEXT("Viewport captured"), Resp, FString());
+        const int32 CompressedSize = Result.Encoded.Num();
+        const FString MimeType = bUsePng ? TEXT("image/png") : TEXT("image/jpeg");
+
+        // Ship the encoded image as a binary attachment; the connection manager
+        // falls back to base64 in "imageBase64" for clients without binary frames.
+        Subsystem->AttachBinaryPayload(RequestId, MoveTemp(Result.Encoded),
+                                       MimeType, TEXT("imageBase64"));
+
+        TSharedPtr<FJsonObject> Resp = MakeShared<FJsonObject>();
+        Resp->SetBoolField(TEXT("success"), true);
+        Resp->SetStringField(TEXT("mimeType"), MimeType);
+        Resp->SetNumberField(TEXT("width"), Result.Width);
+        Resp->SetNumberField(TEXT("height"), Result.Height);
+        Resp->SetStringField(TEXT("format"), bUsePng ? TEXT("png") : TEXT("jpeg"));
+        Resp->SetNumberField(TEXT("sizeBytes"), CompressedSize);
+        Resp->SetNumberField(TEXT("framesWaited"), Result.FramesWaited);
+        Resp->SetNumberField(TEXT("captureMs"), Result.CaptureMs);
+        Resp->SetStringField(TEXT("message"),
+            FString::Printf(TEXT("Viewport captured (%dx%d, %s, %d bytes)"),
+                Result.Width, Result.Height, bUsePng ? TEXT("png") : TEXT("jpeg"),
+                CompressedSize));
+
+        Subsystem->SendAutomationResponse(Socket, RequestId, true,
+                                          TEXT("Viewport captured"), Resp,
+                                          FString());
+      });
   return true;
 #else
   SendStandardErrorResponse(this, Socket, RequestId, TEXT("NOT_IMPLEMENTED"),
@@ -4307,45 +4294,59 @@ bool UMcpAutomationBridgeSubsystem::HandleControlActorList(
     const FString &RequestId, const TSharedPtr<FJsonObject> &Payload,
     TSharedPtr<FMcpBridgeWebSocket> Socket) {
 #if WITH_EDITOR
-  FString Filter;
-  Payload->TryGetStringField(TEXT("filter"), Filter);
-
-  UEditorActorSubsystem *ActorSS =
-      GEditor->GetEditorSubsystem<UEditorActorSubsystem>();
-  if (!ActorSS) {
-    SendStandardErrorResponse(this, Socket, RequestId, TEXT("SUBSYSTEM_MISSING"),
-                              TEXT("EditorActorSubsystem unavailable"), nullptr);
+  // Paged and projected: limit/cursor, fields, and class, tag, filter,
+  // bounds and dataLayer filters (see FMcpActorQuery).
+  FMcpActorQuery Query;
+  FString Error;
+  if (!FMcpActorQuery::Parse(Payload,
+                             EMcpActorField::Label | EMcpActorField::Name |
+                                 EMcpActorField::Path | EMcpActorField::Class,
+                             Query, Error)) {
+    SendStandardErrorResponse(this, Socket, RequestId, TEXT("INVALID_ARGUMENT"),
+                              Error, nullptr);
     return true;
   }
-
-  const TArray<AActor *> &AllActors = ActorSS->GetAllLevelActors();
-  TArray<TSharedPtr<FJsonValue>> ActorsArray;
-
-  for (AActor *Actor : AllActors) {
-    if (!Actor)
-      continue;
-    const FString Label = Actor->GetActorLabel();
-    const FString Name = Actor->GetName();
-    if (!Filter.IsEmpty() && !Label.Contains(Filter) && !Name.Contains(Filter))
-      continue;
-
-    TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
-    Entry->SetStringField(TEXT("label"), Label);
-    Entry->SetStringField(TEXT("name"), Name);
-    Entry->SetStringField(TEXT("path"), Actor->GetPathName());
-    Entry->SetStringField(TEXT("class"), Actor->GetClass()
-                                             ? Actor->GetClass()->GetPathName()
-                                             : TEXT(""));
-    ActorsArray.Add(MakeShared<FJsonValueObject>(Entry));
+  FString ClassName;
+  if (Payload->TryGetStringField(TEXT("className"), ClassName) &&
+      !ClassName.IsEmpty()) {
+    Query.Class = ResolveClassByName(ClassName);
+    if (!Query.Class) {
+      SendStandardErrorResponse(
+          this, Socket, RequestId, TEXT("CLASS_NOT_FOUND"),
+          FString::Printf(TEXT("Class not found: %s"), *ClassName), nullptr);
+      return true;
+    }
   }
 
-  TSharedPtr<FJsonObject> Data = MakeShared<FJsonObject>();
-  Data->SetArrayField(TEXT("actors"), ActorsArray);
-  Data->SetNumberField(TEXT("count"), ActorsArray.Num());
-  if (!Filter.IsEmpty())
-    Data->SetStringField(TEXT("filter"), Filter);
-  SendStandardSuccessResponse(this, Socket, RequestId, TEXT("Actors listed"),
-                              Data);
+  UWorld *World = GEditor->GetEditorWorldContext().World();
+  if (!World) {
+    SendStandardErrorResponse(this, Socket, RequestId, TEXT("NO_WORLD"),
+                              TEXT("No editor world available"), nullptr);
+    return true;
+  }
+
+  FMcpJsonUtf8Writer Data;
+  Data.BeginObject();
+  if (!Query.NameFilter.IsEmpty())
+    Data.WriteString(TEXT("filter"), Query.NameFilter);
+  TWeakObjectPtr<UMcpAutomationBridgeSubsystem> WeakSubsystem(this);
+  FMcpActorQueryRunner::Run(
+      World, GetActorIndex(), Query, MoveTemp(Data),
+      [WeakSubsystem, Socket, RequestId](FMcpJsonUtf8Writer &&Page,
+                                         int32 Returned,
+                                         const FString &ErrorCode) {
+        UMcpAutomationBridgeSubsystem *Subsystem = WeakSubsystem.Get();
+        if (!ErrorCode.IsEmpty()) {
+          SendStandardErrorResponse(
+              Subsystem, Socket, RequestId, ErrorCode,
+              TEXT("Cursor expired or unknown; list again without it."),
+              nullptr);
+          return;
+        }
+        Page.EndObject();
+        SendStandardSuccessResponse(Subsystem, Socket, RequestId,
+                                    TEXT("Actors listed"), Page);
+      });
   return true;
 #else
   return false;
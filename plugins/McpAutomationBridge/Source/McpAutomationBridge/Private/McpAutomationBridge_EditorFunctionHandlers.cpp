@@ -485,8 +485,6 @@ bool UMcpAutomationBridgeSubsystem::HandleExecuteEditorFunction(
   }
 
   if (FN == TEXT("BUILD_LIGHTING")) {
-    FString Quality;
-    Payload->TryGetStringField(TEXT("quality"), Quality);
     if (!GEditor) {
       SendAutomationResponse(RequestingSocket, RequestId, false,
                              TEXT("Editor not available"), nullptr,
@@ -509,66 +507,22 @@ bool UMcpAutomationBridgeSubsystem::HandleExecuteEditorFunction(
       return true;
     }
 
-    if (ULevelEditorSubsystem *LES =
-            GEditor->GetEditorSubsystem<ULevelEditorSubsystem>()) {
-      ELightingBuildQuality QualityEnum =
-          ELightingBuildQuality::Quality_Production;
-      if (!Quality.IsEmpty()) {
-        const FString LowerQuality = Quality.ToLower();
-        if (LowerQuality == TEXT("preview")) {
-          QualityEnum = ELightingBuildQuality::Quality_Preview;
-        } else if (LowerQuality == TEXT("medium")) {
-          QualityEnum = ELightingBuildQuality::Quality_Medium;
-        } else if (LowerQuality == TEXT("high")) {
-          QualityEnum = ELightingBuildQuality::Quality_High;
-        } else if (LowerQuality == TEXT("production")) {
-          QualityEnum = ELightingBuildQuality::Quality_Production;
-        } else {
-          TSharedPtr<FJsonObject> Err = MakeShared<FJsonObject>();
-          Err->SetBoolField(TEXT("success"), false);
-          Err->SetStringField(TEXT("error"), TEXT("unknown_quality"));
-          Err->SetStringField(TEXT("quality"), Quality);
-          Err->SetStringField(TEXT("validValues"), TEXT("preview, medium, high, production"));
-          SendAutomationResponse(RequestingSocket, RequestId, false,
-                                 TEXT("Unknown lighting quality"), Err,
-                                 TEXT("UNKNOWN_QUALITY"));
-          return true;
-        }
-      }
-      if (AWorldSettings *WS = CurrentWorld->GetWorldSettings()) {
-        if (WS->bForceNoPrecomputedLighting) {
-          TSharedPtr<FJsonObject> R = MakeShared<FJsonObject>();
-          R->SetBoolField(TEXT("skipped"), true);
-          R->SetStringField(TEXT("reason"),
-                            TEXT("bForceNoPrecomputedLighting is true"));
-          SendAutomationResponse(
-              RequestingSocket, RequestId, true,
-              TEXT("Lighting build skipped (precomputed lighting disabled)"), R,
-              FString());
-          return true;
-        }
+    if (AWorldSettings *WS = CurrentWorld->GetWorldSettings()) {
+      if (WS->bForceNoPrecomputedLighting) {
+        TSharedPtr<FJsonObject> R = MakeShared<FJsonObject>();
+        R->SetBoolField(TEXT("skipped"), true);
+        R->SetStringField(TEXT("reason"),
+                          TEXT("bForceNoPrecomputedLighting is true"));
+        SendAutomationResponse(
+            RequestingSocket, RequestId, true,
+            TEXT("Lighting build skipped (precomputed lighting disabled)"), R,
+            FString());
+        return true;
       }
-
-#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
-      LES->BuildLightMaps(QualityEnum, /*bWithReflectionCaptures*/ false);
-      TSharedPtr<FJsonObject> R = MakeShared<FJsonObject>();
-      R->SetBoolField(TEXT("requested"), true);
-      SendAutomationResponse(RequestingSocket, RequestId, true,
-                             TEXT("Build lighting requested"), R, FString());
-#else
-      // UE 5.0 fallback - BuildLightMaps not available
-      TSharedPtr<FJsonObject> R = MakeShared<FJsonObject>();
-      R->SetBoolField(TEXT("requested"), false);
-      R->SetStringField(TEXT("error"), TEXT("BuildLightMaps not available in UE 5.0"));
-      SendAutomationResponse(RequestingSocket, RequestId, false,
-                             TEXT("Build lighting not available in UE 5.0"), R, TEXT("NOT_AVAILABLE"));
-#endif
-    } else {
-      SendAutomationResponse(RequestingSocket, RequestId, false,
-                             TEXT("LevelEditorSubsystem not available"),
-                             nullptr, TEXT("SUBSYSTEM_NOT_FOUND"));
     }
-    return true;
+
+    return StartTrackedLightingBuild(RequestId, Payload, RequestingSocket,
+                                     TEXT("production"));
   }
 
   if (FN == TEXT("SAVE_CURRENT_LEVEL")) {
@@ -1,4 +1,6 @@
 #include "Dom/JsonObject.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
 #include "McpAutomationBridgeGlobals.h"
 #include "McpAutomationBridgeHelpers.h"
 #include "McpAutomationBridgeSubsystem.h"
@@ -147,7 +149,9 @@ bool UMcpAutomationBridgeSubsystem::HandleBuildEnvironmentAction(
   } else if (LowerSub == TEXT("get_foliage_instances")) {
     FString FoliageTypePath;
     Payload->TryGetStringField(TEXT("foliageType"), FoliageTypePath);
-    TSharedPtr<FJsonObject> FoliagePayload = MakeShared<FJsonObject>();
+    // Region, paging and format fields pass through unchanged.
+    TSharedPtr<FJsonObject> FoliagePayload = MakeShared<FJsonObject>(*Payload);
+    FoliagePayload->RemoveField(TEXT("foliageTypePath"));
     if (!FoliageTypePath.IsEmpty()) {
       FoliagePayload->SetStringField(TEXT("foliageTypePath"), FoliageTypePath);
     }
@@ -199,6 +203,9 @@ bool UMcpAutomationBridgeSubsystem::HandleBuildEnvironmentAction(
   } else if (LowerSub == TEXT("modify_heightmap")) {
     return HandleModifyHeightmap(RequestId, TEXT("modify_heightmap"), Payload,
                                  RequestingSocket);
+  } else if (LowerSub == TEXT("get_heightmap_region")) {
+    return HandleGetHeightmapRegion(RequestId, TEXT("get_heightmap_region"),
+                                    Payload, RequestingSocket);
   } else if (LowerSub == TEXT("set_landscape_material")) {
     return HandleSetLandscapeMaterial(RequestId, TEXT("set_landscape_material"),
                                       Payload, RequestingSocket);
@@ -1244,19 +1251,51 @@ bool UMcpAutomationBridgeSubsystem::HandleSystemControlAction(
     UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
            TEXT("Executing UAT cook: %s %s"), *UATPath, *Args);
 
-    // Execute and capture output
+    // Run UAT with a piped stdout so the wait can poll for cancel_request
+    // and keep the client's timeout alive; cooks routinely take minutes.
     int32 ReturnCode = 0;
     FString Output;
-    FString Errors;
-
-    bool bSuccess = FPlatformProcess::ExecProcess(
-        *UATPath, *Args, &ReturnCode, &Output, &Errors);
+    bool bCancelled = false;
+
+    void *PipeRead = nullptr;
+    void *PipeWrite = nullptr;
+    FPlatformProcess::CreatePipe(PipeRead, PipeWrite);
+    FProcHandle CookProc = FPlatformProcess::CreateProc(
+        *UATPath, *Args, false, true, true, nullptr, 0, nullptr, PipeWrite);
+    const bool bSuccess = CookProc.IsValid();
+    if (bSuccess) {
+      double LastProgressSeconds = FPlatformTime::Seconds();
+      while (FPlatformProcess::IsProcRunning(CookProc)) {
+        Output += FPlatformProcess::ReadPipe(PipeRead);
+        if (Output.Len() > 16000) {
+          Output = Output.Right(8000);
+        }
+        if (IsAutomationRequestCancelled(RequestId)) {
+          FPlatformProcess::TerminateProc(CookProc, true);
+          bCancelled = true;
+          break;
+        }
+        const double NowSeconds = FPlatformTime::Seconds();
+        if (NowSeconds - LastProgressSeconds >= 5.0) {
+          LastProgressSeconds = NowSeconds;
+          SendProgressUpdate(RequestId, -1.0f, TEXT("Cooking content"), true);
+        }
+        FPlatformProcess::Sleep(0.1f);
+      }
+      Output += FPlatformProcess::ReadPipe(PipeRead);
+      FPlatformProcess::GetProcReturnCode(CookProc, &ReturnCode);
+      FPlatformProcess::CloseProc(CookProc);
+    }
+    FPlatformProcess::ClosePipe(PipeRead, PipeWrite);
 
     TSharedPtr<FJsonObject> CookResult = MakeShared<FJsonObject>();
     CookResult->SetBoolField(TEXT("processStarted"), bSuccess);
     CookResult->SetNumberField(TEXT("returnCode"), ReturnCode);
     CookResult->SetStringField(TEXT("platform"), Platform);
     CookResult->SetBoolField(TEXT("iterative"), bIterative);
+    if (bCancelled) {
+      CookResult->SetBoolField(TEXT("cancelled"), true);
+    }
 
     // Truncate output if too long
     if (Output.Len() > 8000) {
@@ -1265,8 +1304,11 @@ bool UMcpAutomationBridgeSubsystem::HandleSystemControlAction(
     }
     CookResult->SetStringField(TEXT("output"), Output);
 
-    if (!Errors.IsEmpty()) {
-      CookResult->SetStringField(TEXT("errors"), Errors);
+    if (bCancelled) {
+      SendAutomationResponse(RequestingSocket, RequestId, false,
+                             TEXT("Content cooking cancelled"), CookResult,
+                             TEXT("CANCELLED"));
+      return true;
     }
 
     bool bCookSuccess = bSuccess && ReturnCode == 0;
@@ -2160,8 +2202,11 @@ bool UMcpAutomationBridgeSubsystem::HandleBakeLightmap(
   if (Payload.IsValid())
     Payload->TryGetStringField(TEXT("quality"), QualityStr);
 
-  // Reuse HandleExecuteEditorFunction logic
-  TSharedPtr<FJsonObject> P = MakeShared<FJsonObject>();
+  // Reuse HandleExecuteEditorFunction logic; the rest of the payload carries
+  // the tracked build's options (waitForCompletion, timeoutSeconds, ...).
+  TSharedPtr<FJsonObject> P = Payload.IsValid()
+                                  ? MakeShared<FJsonObject>(*Payload)
+                                  : MakeShared<FJsonObject>();
   P->SetStringField(TEXT("functionName"), TEXT("BUILD_LIGHTING"));
   P->SetStringField(TEXT("quality"), QualityStr);
 
@@ -2688,16 +2733,12 @@ bool UMcpAutomationBridgeSubsystem::HandleInspectAction(
     
     if (!ActorName.IsEmpty() && !ComponentName.IsEmpty())
     {
-      // Try to find the actor first
-      if (AActor *Actor = FindActorByName(ActorName))
+      // Find the actor, then the component on it using fuzzy name matching
+      if (UActorComponent *Comp = FindActorComponent(ActorName, ComponentName))
       {
-        // Find the component on the actor using fuzzy name matching
-        if (UActorComponent *Comp = FindComponentByName(Actor, ComponentName))
-        {
-          TargetObject = Comp;
-          // Normalize the path for downstream error messages
-          ObjectPath = Comp->GetPathName();
-        }
+        TargetObject = Comp;
+        // Normalize the path for downstream error messages
+        ObjectPath = Comp->GetPathName();
       }
     }
   }
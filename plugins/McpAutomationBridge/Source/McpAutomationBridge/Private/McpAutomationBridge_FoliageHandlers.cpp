@@ -4,6 +4,7 @@
 #include "McpAutomationBridgeSubsystem.h"
 
 #if WITH_EDITOR
+#include "Async/ParallelFor.h"
 #include "EditorAssetLibrary.h"
 #include "Engine/StaticMesh.h"
 #include "Engine/World.h"
@@ -12,6 +13,7 @@
 #include "FoliageTypeObject.h"
 #include "FoliageType_InstancedStaticMesh.h"
 #include "InstancedFoliageActor.h"
+#include "LandscapeProxy.h"
 #include "ProceduralFoliageComponent.h"
 #include "ProceduralFoliageSpawner.h"
 #include "ProceduralFoliageVolume.h"
@@ -64,6 +66,271 @@ GetOrCreateFoliageActorForWorldSafe(UWorld *World, bool bCreateIfNone) {
   SpawnParams.OverrideLevel = World->PersistentLevel;
   return World->SpawnActor<AInstancedFoliageActor>(SpawnParams);
 }
+
+// Packed instance layouts: "f64x10" / "f32x10" are transforms in the
+// FMcpPackedArray FTransform order (rotation x y z w, translation x y z,
+// scale x y z); "f64x3" / "f32x3" are locations only. The records are built
+// in parallel straight from the decoded bytes.
+static bool DecodePackedFoliageInstances(const FJsonObject &Packed,
+                                         TArray<FFoliageInstance> &OutInstances,
+                                         FString &OutError) {
+  FString Layout;
+  Packed.TryGetStringField(TEXT("layout"), Layout);
+  Layout = Layout.ToLower();
+  int32 Components = 0;
+  if (Layout == TEXT("f64x10") || Layout == TEXT("f32x10")) {
+    Components = 10;
+  } else if (Layout == TEXT("f64x3") || Layout == TEXT("f32x3")) {
+    Components = 3;
+  } else {
+    OutError = FString::Printf(
+        TEXT("Packed foliage layout must be f64x10, f32x10, f64x3 or f32x3 "
+             "(got '%s')"),
+        *Layout);
+    return false;
+  }
+  const bool bDouble = Layout.StartsWith(TEXT("f64"));
+  const int32 ElementSize = Components * (bDouble ? sizeof(double) : sizeof(float));
+
+  TArray<uint8> Bytes;
+  int32 Count = 0;
+  if (!FMcpPackedArray::DecodeRaw(Packed, ElementSize, Bytes, Count, OutError)) {
+    return false;
+  }
+
+  OutInstances.SetNum(Count);
+  const uint8 *Source = Bytes.GetData();
+  ParallelFor(Count, [&OutInstances, Source, ElementSize, Components,
+                      bDouble](int32 Index) {
+    double D[10];
+    const uint8 *Element = Source + static_cast<int64>(Index) * ElementSize;
+    for (int32 C = 0; C < Components; ++C) {
+      D[C] = bDouble ? reinterpret_cast<const double *>(Element)[C]
+                     : reinterpret_cast<const float *>(Element)[C];
+    }
+    FFoliageInstance &Instance = OutInstances[Index];
+    if (Components == 10) {
+      Instance.Rotation = FQuat(D[0], D[1], D[2], D[3]).GetNormalized().Rotator();
+      Instance.Location = FVector(D[4], D[5], D[6]);
+      Instance.DrawScale3D = FVector3f(D[7], D[8], D[9]);
+    } else {
+      Instance.Location = FVector(D[0], D[1], D[2]);
+      Instance.Rotation = FRotator::ZeroRotator;
+      Instance.DrawScale3D = FVector3f(1.0f);
+    }
+  });
+  return true;
+}
+
+// Adds Instances to FoliageType in one FFoliageInfo::AddInstances call, so the
+// HISM tree and the foliage hash are updated once for the whole list rather
+// than once per instance. With MinDistance > 0, an instance closer than that
+// to an existing instance of the type, or to one kept earlier in the list, is
+// dropped; a grid of MinDistance cells keeps each check to 27 cells.
+static int32 CommitFoliageInstances(AInstancedFoliageActor *IFA,
+                                    UFoliageType *FoliageType,
+                                    const TArray<FFoliageInstance> &Instances,
+                                    double MinDistance, int32 &OutSkipped) {
+  OutSkipped = 0;
+  IFA->Modify();
+  FFoliageInfo *Info = IFA->FindInfo(FoliageType);
+  if (!Info) {
+    IFA->AddFoliageType(FoliageType);
+    Info = IFA->FindInfo(FoliageType);
+  }
+  if (!Info) {
+    return 0;
+  }
+
+  TArray<const FFoliageInstance *> ToAdd;
+  ToAdd.Reserve(Instances.Num());
+  if (MinDistance > 0.0) {
+    const double MinDistanceSq = MinDistance * MinDistance;
+    TMap<FIntVector, TArray<FVector>> Grid;
+    auto CellOf = [MinDistance](const FVector &P) {
+      return FIntVector(FMath::FloorToInt(P.X / MinDistance),
+                        FMath::FloorToInt(P.Y / MinDistance),
+                        FMath::FloorToInt(P.Z / MinDistance));
+    };
+    auto IsClear = [&Grid, &CellOf, MinDistanceSq](const FVector &P) {
+      const FIntVector Cell = CellOf(P);
+      for (int32 X = -1; X <= 1; ++X) {
+        for (int32 Y = -1; Y <= 1; ++Y) {
+          for (int32 Z = -1; Z <= 1; ++Z) {
+            if (const TArray<FVector> *Points =
+                    Grid.Find(Cell + FIntVector(X, Y, Z))) {
+              for (const FVector &Q : *Points) {
+                if (FVector::DistSquared(P, Q) < MinDistanceSq) {
+                  return false;
+                }
+              }
+            }
+          }
+        }
+      }
+      return true;
+    };
+    for (const FFoliageInstance &Existing : Info->Instances) {
+      Grid.FindOrAdd(CellOf(Existing.Location)).Add(Existing.Location);
+    }
+    for (const FFoliageInstance &Instance : Instances) {
+      if (IsClear(Instance.Location)) {
+        Grid.FindOrAdd(CellOf(Instance.Location)).Add(Instance.Location);
+        ToAdd.Add(&Instance);
+      }
+    }
+  } else {
+    for (const FFoliageInstance &Instance : Instances) {
+      ToAdd.Add(&Instance);
+    }
+  }
+
+  OutSkipped = Instances.Num() - ToAdd.Num();
+  if (ToAdd.Num() > 0) {
+    Info->AddInstances(FoliageType, ToAdd);
+  }
+  return ToAdd.Num();
+}
+
+// get_foliage_instances pages: the default keeps a JSON dump of a dense type
+// to a few MB; packed output may ask for more per page.
+constexpr int32 DefaultFoliageInstancePage = 5000;
+constexpr int32 MaxFoliageInstancePage = 100000;
+
+// Region filter for get_foliage_instances. Box and sphere are answered by
+// the foliage instance hash; a frustum asks the hash for its bounding box and
+// then tests each candidate against the view volume.
+struct FFoliageInstanceQuery {
+  enum class EShape : uint8 { All, Box, Sphere, Frustum };
+  EShape Shape = EShape::All;
+  FBox Box = FBox(ForceInit);
+  FSphere Sphere = FSphere(ForceInit);
+  FVector Origin = FVector::ZeroVector;
+  FRotator Rotation = FRotator::ZeroRotator;
+  double TanHalfFovX = 1.0;
+  double TanHalfFovY = 1.0;
+  double NearDistance = 0.0;
+  double FarDistance = 0.0;
+};
+
+// Reads one of "box" ({min, max} or {center, extent}), "sphere" ({center,
+// radius}) or "frustum" ({origin, rotation, fov, aspectRatio, near, far},
+// fov horizontal in degrees). No shape means every instance.
+static bool ParseFoliageInstanceQuery(const TSharedPtr<FJsonObject> &Payload,
+                                      FFoliageInstanceQuery &Out,
+                                      FString &OutError) {
+  const TSharedPtr<FJsonObject> *Shape = nullptr;
+  if (Payload->TryGetObjectField(TEXT("box"), Shape) && Shape &&
+      Shape->IsValid()) {
+    if ((*Shape)->HasField(TEXT("center"))) {
+      const FVector Center =
+          ExtractVectorField(*Shape, TEXT("center"), FVector::ZeroVector);
+      const FVector Extent =
+          ExtractVectorField(*Shape, TEXT("extent"), FVector::ZeroVector)
+              .GetAbs();
+      Out.Box = FBox(Center - Extent, Center + Extent);
+    } else if ((*Shape)->HasField(TEXT("min")) &&
+               (*Shape)->HasField(TEXT("max"))) {
+      const FVector A =
+          ExtractVectorField(*Shape, TEXT("min"), FVector::ZeroVector);
+      const FVector B =
+          ExtractVectorField(*Shape, TEXT("max"), FVector::ZeroVector);
+      Out.Box = FBox(A.ComponentMin(B), A.ComponentMax(B));
+    } else {
+      OutError = TEXT("box requires min and max, or center and extent");
+      return false;
+    }
+    Out.Shape = FFoliageInstanceQuery::EShape::Box;
+    return true;
+  }
+
+  if (Payload->TryGetObjectField(TEXT("sphere"), Shape) && Shape &&
+      Shape->IsValid()) {
+    double Radius = 0.0;
+    (*Shape)->TryGetNumberField(TEXT("radius"), Radius);
+    if (Radius <= 0.0) {
+      OutError = TEXT("sphere requires a positive radius");
+      return false;
+    }
+    Out.Sphere = FSphere(
+        ExtractVectorField(*Shape, TEXT("center"), FVector::ZeroVector),
+        Radius);
+    Out.Shape = FFoliageInstanceQuery::EShape::Sphere;
+    return true;
+  }
+
+  if (Payload->TryGetObjectField(TEXT("frustum"), Shape) && Shape &&
+      Shape->IsValid()) {
+    double Fov = 90.0;
+    double Aspect = 16.0 / 9.0;
+    (*Shape)->TryGetNumberField(TEXT("fov"), Fov);
+    (*Shape)->TryGetNumberField(TEXT("aspectRatio"), Aspect);
+    (*Shape)->TryGetNumberField(TEXT("near"), Out.NearDistance);
+    (*Shape)->TryGetNumberField(TEXT("far"), Out.FarDistance);
+    if (Fov <= 0.0 || Fov >= 180.0 || Aspect <= 0.0) {
+      OutError = TEXT("frustum fov must be in (0, 180) and aspectRatio positive");
+      return false;
+    }
+    if (Out.NearDistance < 0.0 || Out.FarDistance <= Out.NearDistance) {
+      OutError = TEXT("frustum requires far greater than near");
+      return false;
+    }
+    Out.Origin =
+        ExtractVectorField(*Shape, TEXT("origin"), FVector::ZeroVector);
+    Out.Rotation =
+        ExtractRotatorField(*Shape, TEXT("rotation"), FRotator::ZeroRotator);
+    Out.TanHalfFovX = FMath::Tan(FMath::DegreesToRadians(Fov * 0.5));
+    Out.TanHalfFovY = Out.TanHalfFovX / Aspect;
+    Out.Shape = FFoliageInstanceQuery::EShape::Frustum;
+    return true;
+  }
+
+  Out.Shape = FFoliageInstanceQuery::EShape::All;
+  return true;
+}
+
+// Indices of Info's instances inside Query, ascending so a cursor offset
+// lands on the same instance from one page to the next.
+static void QueryFoliageInstances(FFoliageInfo &Info,
+                                  const FFoliageInstanceQuery &Query,
+                                  TArray<int32> &OutIndices) {
+  OutIndices.Reset();
+  switch (Query.Shape) {
+  case FFoliageInstanceQuery::EShape::Box:
+    Info.GetInstancesInsideBounds(Query.Box, OutIndices);
+    break;
+  case FFoliageInstanceQuery::EShape::Sphere:
+    Info.GetInstancesInsideSphere(Query.Sphere, OutIndices);
+    break;
+  case FFoliageInstanceQuery::EShape::Frustum: {
+    const double HalfWidth = Query.FarDistance * Query.TanHalfFovX;
+    const double HalfHeight = Query.FarDistance * Query.TanHalfFovY;
+    FBox Bounds(ForceInit);
+    Bounds += Query.Origin;
+    for (const double Y : {-HalfWidth, HalfWidth}) {
+      for (const double Z : {-HalfHeight, HalfHeight}) {
+        Bounds += Query.Origin + Query.Rotation.RotateVector(
+                                     FVector(Query.FarDistance, Y, Z));
+      }
+    }
+    TArray<int32> Candidates;
+    Info.GetInstancesInsideBounds(Bounds, Candidates);
+    for (const int32 Index : Candidates) {
+      const FVector Local = Query.Rotation.UnrotateVector(
+          Info.Instances[Index].Location - Query.Origin);
+      if (Local.X >= Query.NearDistance && Local.X <= Query.FarDistance &&
+          FMath::Abs(Local.Y) <= Local.X * Query.TanHalfFovX &&
+          FMath::Abs(Local.Z) <= Local.X * Query.TanHalfFovY) {
+        OutIndices.Add(Index);
+      }
+    }
+    break;
+  }
+  default:
+    return;
+  }
+  OutIndices.Sort();
+}
 #endif
 
 bool UMcpAutomationBridgeSubsystem::HandlePaintFoliage(
@@ -120,10 +387,21 @@ bool UMcpAutomationBridgeSubsystem::HandlePaintFoliage(
     return true;
   }
 
-  // Accept single 'position' or array of 'locations'
+  // Accept packed 'locations', a single 'position' or an array of 'locations'
   TArray<FVector> Locations;
+  TArray<FFoliageInstance> PackedInstances;
+  const TSharedPtr<FJsonValue> PackedLocations =
+      Payload->TryGetField(TEXT("locations"));
   const TArray<TSharedPtr<FJsonValue>> *LocationsArray = nullptr;
-  if ((Payload->TryGetArrayField(TEXT("locations"), LocationsArray) ||
+  if (FMcpPackedArray::IsPackedValue(PackedLocations)) {
+    FString PackedError;
+    if (!DecodePackedFoliageInstances(*PackedLocations->AsObject(),
+                                      PackedInstances, PackedError)) {
+      SendAutomationError(RequestingSocket, RequestId, PackedError,
+                          TEXT("INVALID_ARGUMENT"));
+      return true;
+    }
+  } else if ((Payload->TryGetArrayField(TEXT("locations"), LocationsArray) ||
        Payload->TryGetArrayField(TEXT("location"), LocationsArray)) &&
       LocationsArray && LocationsArray->Num() > 0) {
     for (const TSharedPtr<FJsonValue> &Val : *LocationsArray) {
@@ -152,7 +430,7 @@ bool UMcpAutomationBridgeSubsystem::HandlePaintFoliage(
     }
   }
 
-  if (Locations.Num() == 0) {
+  if (Locations.Num() == 0 && PackedInstances.Num() == 0) {
     SendAutomationError(RequestingSocket, RequestId,
                         TEXT("locations array or position required"),
                         TEXT("INVALID_ARGUMENT"));
@@ -229,32 +507,26 @@ bool UMcpAutomationBridgeSubsystem::HandlePaintFoliage(
     return true;
   }
 
-  TArray<FVector> PlacedLocations;
+  TArray<FFoliageInstance> Instances = MoveTemp(PackedInstances);
   for (const FVector &Location : Locations) {
-    FFoliageInstance Instance;
+    FFoliageInstance &Instance = Instances.AddDefaulted_GetRef();
     Instance.Location = Location;
     Instance.Rotation = FRotator::ZeroRotator;
     Instance.DrawScale3D = FVector3f(1.0f);
     Instance.ZOffset = 0.0f;
-
-    if (FFoliageInfo *Info = IFA->FindInfo(FoliageType)) {
-      Info->AddInstance(FoliageType, Instance, /*InBaseComponent*/ nullptr);
-    } else {
-      IFA->AddFoliageType(FoliageType);
-      if (FFoliageInfo *NewInfo = IFA->FindInfo(FoliageType)) {
-        NewInfo->AddInstance(FoliageType, Instance,
-                             /*InBaseComponent*/ nullptr);
-      }
-    }
-    PlacedLocations.Add(Location);
   }
 
-  IFA->Modify();
+  double MinDistance = 0.0;
+  Payload->TryGetNumberField(TEXT("minDistance"), MinDistance);
+  int32 Skipped = 0;
+  const int32 Placed =
+      CommitFoliageInstances(IFA, FoliageType, Instances, MinDistance, Skipped);
 
   TSharedPtr<FJsonObject> Resp = MakeShared<FJsonObject>();
   Resp->SetBoolField(TEXT("success"), true);
   Resp->SetStringField(TEXT("foliageTypePath"), FoliageTypePath);
-  Resp->SetNumberField(TEXT("instancesPlaced"), PlacedLocations.Num());
+  Resp->SetNumberField(TEXT("instancesPlaced"), Placed);
+  Resp->SetNumberField(TEXT("skippedByDistance"), Skipped);
   
   // Add verification data
   Resp->SetStringField(TEXT("foliageActorPath"), IFA->GetPathName());
@@ -391,6 +663,41 @@ bool UMcpAutomationBridgeSubsystem::HandleGetFoliageInstances(
     return true;
   }
 
+  FFoliageInstanceQuery Query;
+  FString QueryError;
+  if (!ParseFoliageInstanceQuery(Payload, Query, QueryError)) {
+    SendAutomationError(RequestingSocket, RequestId, QueryError,
+                        TEXT("INVALID_ARGUMENT"));
+    return true;
+  }
+
+  bool bCountOnly = false;
+  Payload->TryGetBoolField(TEXT("countOnly"), bCountOnly);
+  FString Format;
+  Payload->TryGetStringField(TEXT("format"), Format);
+  const bool bPacked =
+      !bCountOnly && Format.Equals(TEXT("packed"), ESearchCase::IgnoreCase);
+  double PageSizeValue = 0.0;
+  Payload->TryGetNumberField(TEXT("pageSize"), PageSizeValue);
+  const int32 PageSize =
+      PageSizeValue >= 1.0
+          ? FMath::Min(static_cast<int32>(PageSizeValue), MaxFoliageInstancePage)
+          : DefaultFoliageInstancePage;
+  // Cursors are offsets into the ordered result and are re-resolved on each
+  // call, so edits between pages can shift the remaining instances.
+  int64 CursorOffset = 0;
+  FString Cursor;
+  if (Payload->TryGetStringField(TEXT("cursor"), Cursor) && !Cursor.IsEmpty()) {
+    if (!Cursor.IsNumeric() || Cursor.Contains(TEXT("-")) ||
+        Cursor.Contains(TEXT("."))) {
+      SendAutomationError(RequestingSocket, RequestId,
+                          FString::Printf(TEXT("Invalid cursor: %s"), *Cursor),
+                          TEXT("INVALID_ARGUMENT"));
+      return true;
+    }
+    LexFromString(CursorOffset, *Cursor);
+  }
+
   FString FoliageTypePath;
   Payload->TryGetStringField(TEXT("foliageTypePath"), FoliageTypePath);
 
@@ -427,13 +734,34 @@ bool UMcpAutomationBridgeSubsystem::HandleGetFoliageInstances(
     TSharedPtr<FJsonObject> Resp = MakeShared<FJsonObject>();
     Resp->SetBoolField(TEXT("success"), true);
     Resp->SetArrayField(TEXT("instances"), TArray<TSharedPtr<FJsonValue>>());
+    Resp->SetNumberField(TEXT("totalCount"), 0);
     SendAutomationResponse(RequestingSocket, RequestId, true,
                            TEXT("No foliage actor found"), Resp, FString());
     return true;
   }
 
-  TArray<TSharedPtr<FJsonValue>> InstancesArray;
+  // Matching instances per foliage type, in ForEachFoliageInfo order. A
+  // query without a region takes every instance and keeps no index list.
+  struct FFoliageTypeMatches {
+    UFoliageType *Type = nullptr;
+    FFoliageInfo *Info = nullptr;
+    TArray<int32> Indices;
+    int32 Count = 0;
+  };
+  TArray<FFoliageTypeMatches> Matches;
+  auto AddMatches = [&Matches, &Query](UFoliageType *Type, FFoliageInfo &Info) {
+    FFoliageTypeMatches &Entry = Matches.AddDefaulted_GetRef();
+    Entry.Type = Type;
+    Entry.Info = &Info;
+    if (Query.Shape == FFoliageInstanceQuery::EShape::All) {
+      Entry.Count = Info.Instances.Num();
+    } else {
+      QueryFoliageInstances(Info, Query, Entry.Indices);
+      Entry.Count = Entry.Indices.Num();
+    }
+  };
 
+  const bool bPerTypeFields = FoliageTypePath.IsEmpty();
   if (!FoliageTypePath.IsEmpty()) {
     if (!UEditorAssetLibrary::DoesAssetExist(FoliageTypePath)) {
       // If asked for a specific type that doesn't exist, return empty list
@@ -441,6 +769,7 @@ bool UMcpAutomationBridgeSubsystem::HandleGetFoliageInstances(
       TSharedPtr<FJsonObject> Resp = MakeShared<FJsonObject>();
       Resp->SetBoolField(TEXT("success"), true);
       Resp->SetArrayField(TEXT("instances"), TArray<TSharedPtr<FJsonValue>>());
+      Resp->SetNumberField(TEXT("totalCount"), 0);
       SendAutomationResponse(RequestingSocket, RequestId, true,
                              TEXT("Foliage type not found, 0 instances"), Resp,
                              FString());
@@ -450,39 +779,138 @@ bool UMcpAutomationBridgeSubsystem::HandleGetFoliageInstances(
     UFoliageType *FoliageType =
         LoadObject<UFoliageType>(nullptr, *FoliageTypePath);
     if (FoliageType) {
-      FFoliageInfo *Info = IFA->FindInfo(FoliageType);
-      if (Info) {
-        for (const FFoliageInstance &Inst : Info->Instances) {
-          TSharedPtr<FJsonObject> InstObj = MakeShared<FJsonObject>();
-          InstObj->SetNumberField(TEXT("x"), Inst.Location.X);
-          InstObj->SetNumberField(TEXT("y"), Inst.Location.Y);
-          InstObj->SetNumberField(TEXT("z"), Inst.Location.Z);
-          InstObj->SetNumberField(TEXT("pitch"), Inst.Rotation.Pitch);
-          InstObj->SetNumberField(TEXT("yaw"), Inst.Rotation.Yaw);
-          InstObj->SetNumberField(TEXT("roll"), Inst.Rotation.Roll);
-          InstancesArray.Add(MakeShared<FJsonValueObject>(InstObj));
-        }
+      if (FFoliageInfo *Info = IFA->FindInfo(FoliageType)) {
+        AddMatches(FoliageType, *Info);
       }
     }
   } else {
     IFA->ForEachFoliageInfo([&](UFoliageType *Type, FFoliageInfo &Info) {
-      for (const FFoliageInstance &Inst : Info.Instances) {
-        TSharedPtr<FJsonObject> InstObj = MakeShared<FJsonObject>();
-        InstObj->SetStringField(TEXT("foliageType"), Type->GetPathName());
-        InstObj->SetNumberField(TEXT("x"), Inst.Location.X);
-        InstObj->SetNumberField(TEXT("y"), Inst.Location.Y);
-        InstObj->SetNumberField(TEXT("z"), Inst.Location.Z);
-        InstancesArray.Add(MakeShared<FJsonValueObject>(InstObj));
-      }
+      AddMatches(Type, Info);
       return true;
     });
   }
 
+  int64 TotalCount = 0;
+  TArray<TSharedPtr<FJsonValue>> CountsByType;
+  for (const FFoliageTypeMatches &Entry : Matches) {
+    TotalCount += Entry.Count;
+    TSharedPtr<FJsonObject> TypeObj = MakeShared<FJsonObject>();
+    TypeObj->SetStringField(TEXT("foliageType"), Entry.Type->GetPathName());
+    TypeObj->SetNumberField(TEXT("count"), Entry.Count);
+    CountsByType.Add(MakeShared<FJsonValueObject>(TypeObj));
+  }
+
+  // The page as (match entry, instance index) pairs; the cursor is the offset
+  // of the page into the whole ordered result.
+  TArray<TPair<int32, int32>> Page;
+  if (!bCountOnly) {
+    int64 Skip = CursorOffset;
+    for (int32 EntryIndex = 0;
+         EntryIndex < Matches.Num() && Page.Num() < PageSize; ++EntryIndex) {
+      const FFoliageTypeMatches &Entry = Matches[EntryIndex];
+      if (Skip >= Entry.Count) {
+        Skip -= Entry.Count;
+        continue;
+      }
+      for (int32 Position = static_cast<int32>(Skip);
+           Position < Entry.Count && Page.Num() < PageSize; ++Position) {
+        Page.Emplace(EntryIndex, Entry.Indices.Num() > 0 ? Entry.Indices[Position]
+                                                          : Position);
+      }
+      Skip = 0;
+    }
+  }
+
   TSharedPtr<FJsonObject> Resp = MakeShared<FJsonObject>();
   Resp->SetBoolField(TEXT("success"), true);
-  Resp->SetArrayField(TEXT("instances"), InstancesArray);
-  Resp->SetNumberField(TEXT("count"), InstancesArray.Num());
-  
+  if (bPacked) {
+    // FMcpPackedArray FTransform order: rotation x y z w, translation x y z,
+    // scale x y z. With several types, typeIndices points into foliageTypes.
+    TArray<uint8> Bytes;
+    Bytes.SetNumUninitialized(Page.Num() * 10 * sizeof(double));
+    double *Out = reinterpret_cast<double *>(Bytes.GetData());
+    ParallelFor(Page.Num(), [&Page, &Matches, Out](int32 Index) {
+      const FFoliageInstance &Inst =
+          Matches[Page[Index].Key].Info->Instances[Page[Index].Value];
+      const FQuat Rotation = Inst.Rotation.Quaternion();
+      const FVector Scale(Inst.DrawScale3D);
+      double *Record = Out + Index * 10;
+      Record[0] = Rotation.X;
+      Record[1] = Rotation.Y;
+      Record[2] = Rotation.Z;
+      Record[3] = Rotation.W;
+      Record[4] = Inst.Location.X;
+      Record[5] = Inst.Location.Y;
+      Record[6] = Inst.Location.Z;
+      Record[7] = Scale.X;
+      Record[8] = Scale.Y;
+      Record[9] = Scale.Z;
+    });
+    TSharedPtr<FJsonObject> Transforms = MakeShared<FJsonObject>();
+    Transforms->SetStringField(TEXT("layout"), TEXT("f64x10"));
+    Transforms->SetNumberField(TEXT("count"), Page.Num());
+    Transforms->SetStringField(TEXT("field"), TEXT("transformsData"));
+    Transforms->SetStringField(
+        TEXT("attachmentId"),
+        AttachBinaryPayload(RequestId, MoveTemp(Bytes),
+                            TEXT("application/octet-stream"),
+                            TEXT("transformsData")));
+    Resp->SetObjectField(TEXT("transforms"), Transforms);
+
+    if (bPerTypeFields) {
+      TArray<uint8> TypeBytes;
+      TypeBytes.SetNumUninitialized(Page.Num() * sizeof(int32));
+      int32 *TypeOut = reinterpret_cast<int32 *>(TypeBytes.GetData());
+      for (int32 Index = 0; Index < Page.Num(); ++Index) {
+        TypeOut[Index] = Page[Index].Key;
+      }
+      TSharedPtr<FJsonObject> TypeIndices = MakeShared<FJsonObject>();
+      TypeIndices->SetStringField(TEXT("layout"), TEXT("i32"));
+      TypeIndices->SetNumberField(TEXT("count"), Page.Num());
+      TypeIndices->SetStringField(TEXT("field"), TEXT("typeIndicesData"));
+      TypeIndices->SetStringField(
+          TEXT("attachmentId"),
+          AttachBinaryPayload(RequestId, MoveTemp(TypeBytes),
+                              TEXT("application/octet-stream"),
+                              TEXT("typeIndicesData")));
+      Resp->SetObjectField(TEXT("typeIndices"), TypeIndices);
+
+      TArray<TSharedPtr<FJsonValue>> TypePaths;
+      for (const FFoliageTypeMatches &Entry : Matches) {
+        TypePaths.Add(
+            MakeShared<FJsonValueString>(Entry.Type->GetPathName()));
+      }
+      Resp->SetArrayField(TEXT("foliageTypes"), TypePaths);
+    }
+  } else if (!bCountOnly) {
+    TArray<TSharedPtr<FJsonValue>> InstancesArray;
+    InstancesArray.Reserve(Page.Num());
+    for (const TPair<int32, int32> &Item : Page) {
+      const FFoliageTypeMatches &Entry = Matches[Item.Key];
+      const FFoliageInstance &Inst = Entry.Info->Instances[Item.Value];
+      TSharedPtr<FJsonObject> InstObj = MakeShared<FJsonObject>();
+      if (bPerTypeFields) {
+        InstObj->SetStringField(TEXT("foliageType"), Entry.Type->GetPathName());
+      }
+      InstObj->SetNumberField(TEXT("x"), Inst.Location.X);
+      InstObj->SetNumberField(TEXT("y"), Inst.Location.Y);
+      InstObj->SetNumberField(TEXT("z"), Inst.Location.Z);
+      InstObj->SetNumberField(TEXT("pitch"), Inst.Rotation.Pitch);
+      InstObj->SetNumberField(TEXT("yaw"), Inst.Rotation.Yaw);
+      InstObj->SetNumberField(TEXT("roll"), Inst.Rotation.Roll);
+      InstancesArray.Add(MakeShared<FJsonValueObject>(InstObj));
+    }
+    Resp->SetArrayField(TEXT("instances"), InstancesArray);
+  }
+  Resp->SetNumberField(TEXT("count"), Page.Num());
+  Resp->SetNumberField(TEXT("totalCount"), static_cast<double>(TotalCount));
+  Resp->SetArrayField(TEXT("countsByType"), CountsByType);
+  if (!bCountOnly && CursorOffset + Page.Num() < TotalCount) {
+    Resp->SetStringField(
+        TEXT("nextCursor"),
+        LexToString(CursorOffset + static_cast<int64>(Page.Num())));
+  }
+
   // Add verification data
   Resp->SetStringField(TEXT("foliageActorPath"), IFA->GetPathName());
   Resp->SetBoolField(TEXT("existsAfter"), true);
@@ -726,9 +1154,23 @@ bool UMcpAutomationBridgeSubsystem::HandleAddFoliageInstances(
     FVector Scale = FVector::OneVector;
   };
   TArray<FFoliageTransformData> ParsedTransforms;
+  TArray<FFoliageInstance> PackedInstances;
 
+  // Packed 'transforms' (or 'locations') skip the per-instance JSON below.
+  TSharedPtr<FJsonValue> PackedField = Payload->TryGetField(TEXT("transforms"));
+  if (!FMcpPackedArray::IsPackedValue(PackedField)) {
+    PackedField = Payload->TryGetField(TEXT("locations"));
+  }
   const TArray<TSharedPtr<FJsonValue>> *Transforms = nullptr;
-  if (Payload->TryGetArrayField(TEXT("transforms"), Transforms) && Transforms) {
+  if (FMcpPackedArray::IsPackedValue(PackedField)) {
+    FString PackedError;
+    if (!DecodePackedFoliageInstances(*PackedField->AsObject(), PackedInstances,
+                                      PackedError)) {
+      SendAutomationError(RequestingSocket, RequestId, PackedError,
+                          TEXT("INVALID_ARGUMENT"));
+      return true;
+    }
+  } else if (Payload->TryGetArrayField(TEXT("transforms"), Transforms) && Transforms) {
     for (const TSharedPtr<FJsonValue> &V : *Transforms) {
       if (!V.IsValid() || V->Type != EJson::Object)
         continue;
@@ -802,7 +1244,7 @@ bool UMcpAutomationBridgeSubsystem::HandleAddFoliageInstances(
     }
   }
 
-  if (ParsedTransforms.Num() == 0) {
+  if (ParsedTransforms.Num() == 0 && PackedInstances.Num() == 0) {
     // Fallback to 'locations' if provided (legacy support, default rotation/scale)
     const TArray<TSharedPtr<FJsonValue>> *LocationsArray = nullptr;
     if (Payload->TryGetArrayField(TEXT("locations"), LocationsArray) &&
@@ -877,28 +1319,25 @@ bool UMcpAutomationBridgeSubsystem::HandleAddFoliageInstances(
     return true;
   }
 
-  int32 Added = 0;
+  TArray<FFoliageInstance> Instances = MoveTemp(PackedInstances);
+  Instances.Reserve(Instances.Num() + ParsedTransforms.Num());
   for (const FFoliageTransformData &TransformData : ParsedTransforms) {
-    FFoliageInstance Instance;
+    FFoliageInstance &Instance = Instances.AddDefaulted_GetRef();
     Instance.Location = TransformData.Location;
     Instance.Rotation = TransformData.Rotation;
     Instance.DrawScale3D = FVector3f(TransformData.Scale);
-
-    if (FFoliageInfo *Info = IFA->FindInfo(FoliageType)) {
-      Info->AddInstance(FoliageType, Instance, nullptr);
-    } else {
-      IFA->AddFoliageType(FoliageType);
-      if (FFoliageInfo *NewInfo = IFA->FindInfo(FoliageType)) {
-        NewInfo->AddInstance(FoliageType, Instance, nullptr);
-      }
-    }
-    ++Added;
   }
-  IFA->Modify();
+
+  double MinDistance = 0.0;
+  Payload->TryGetNumberField(TEXT("minDistance"), MinDistance);
+  int32 Skipped = 0;
+  const int32 Added =
+      CommitFoliageInstances(IFA, FoliageType, Instances, MinDistance, Skipped);
 
   TSharedPtr<FJsonObject> Resp = MakeShared<FJsonObject>();
   Resp->SetBoolField(TEXT("success"), true);
   Resp->SetNumberField(TEXT("instances_count"), Added);
+  Resp->SetNumberField(TEXT("skippedByDistance"), Skipped);
   
   // Add verification data
   Resp->SetStringField(TEXT("foliageActorPath"), IFA->GetPathName());
@@ -916,6 +1355,210 @@ bool UMcpAutomationBridgeSubsystem::HandleAddFoliageInstances(
 #endif
 }
 
+#if WITH_EDITOR
+// The bridge scatter runs one work item per (tile, foliage type); these bound
+// the item count and the instances a single call may try to place.
+static constexpr int32 MaxFoliageScatterTiles = 65536;
+static constexpr double MaxFoliageScatterInstances = 2000000.0;
+
+struct FFoliageScatterType {
+  UFoliageType *FoliageType = nullptr;
+  // Instances per 1000x1000 unit area, as UFoliageType::Density.
+  double Density = 10.0;
+  // Poisson-disc radius: no two instances of the type are placed closer.
+  double MinDistance = 0.0;
+  float ScaleMin = 1.0f;
+  float ScaleMax = 1.0f;
+  bool bRandomYaw = true;
+  bool bAlignToNormal = false;
+  // Hits whose normal Z is below this (cos of the max slope) are rejected.
+  double MinNormalZ = -1.0;
+  double ZOffset = 0.0;
+};
+
+struct FFoliageScatterSettings {
+  FBox Bounds = FBox(ForceInit);
+  double TileSize = 2000.0;
+  int32 TilesX = 1;
+  int32 TilesY = 1;
+  int32 Seed = 0;
+  bool bLandscapeOnly = false;
+};
+
+// Everything a work item draws comes from a stream seeded by the call seed,
+// the tile coordinates and the type index alone, so an item produces the same
+// samples whichever worker runs it and in whatever order.
+static int32 GetFoliageScatterTileSeed(int32 Seed, int32 TileX, int32 TileY,
+                                       int32 TypeIndex) {
+  uint32 Hash = HashCombine(GetTypeHash(Seed), GetTypeHash(TileX));
+  Hash = HashCombine(Hash, GetTypeHash(TileY));
+  Hash = HashCombine(Hash, GetTypeHash(TypeIndex));
+  return static_cast<int32>(Hash);
+}
+
+// Dart-throwing Poisson-disc sampling over one tile, followed by a downward
+// trace per sample from the top of the bounds. Cells of MinDistance / sqrt(2)
+// hold at most one sample, so a candidate is checked against 5x5 cells.
+// Traces are read-only scene queries and run on the calling worker.
+static void ScatterFoliageTile(UWorld *World, const FFoliageScatterSettings &Settings,
+                               const FFoliageScatterType &Type, int32 TypeIndex,
+                               int32 TileX, int32 TileY,
+                               const FCollisionQueryParams &TraceParams,
+                               TArray<FFoliageInstance> &OutInstances,
+                               int32 &OutSamples) {
+  const double X0 = Settings.Bounds.Min.X + TileX * Settings.TileSize;
+  const double Y0 = Settings.Bounds.Min.Y + TileY * Settings.TileSize;
+  const double W = FMath::Min(Settings.TileSize, Settings.Bounds.Max.X - X0);
+  const double H = FMath::Min(Settings.TileSize, Settings.Bounds.Max.Y - Y0);
+  OutSamples = 0;
+  if (W <= 0.0 || H <= 0.0) {
+    return;
+  }
+
+  FRandomStream Stream(
+      GetFoliageScatterTileSeed(Settings.Seed, TileX, TileY, TypeIndex));
+  const double Expected = Type.Density * W * H / 1000000.0;
+  const int32 Target = FMath::FloorToInt(Expected) +
+                       (Stream.FRand() < FMath::Frac(Expected) ? 1 : 0);
+  if (Target <= 0) {
+    return;
+  }
+
+  TArray<FVector2D> Samples;
+  Samples.Reserve(Target);
+  if (Type.MinDistance > 0.0) {
+    const double MinDistanceSq = Type.MinDistance * Type.MinDistance;
+    const double Cell = Type.MinDistance / UE_SQRT_2;
+    TMap<FIntPoint, int32> Grid;
+    Grid.Reserve(Target);
+    const int32 MaxAttempts = Target * 30;
+    for (int32 Attempt = 0; Attempt < MaxAttempts && Samples.Num() < Target;
+         ++Attempt) {
+      const FVector2D P(X0 + Stream.FRand() * W, Y0 + Stream.FRand() * H);
+      const FIntPoint C(FMath::FloorToInt((P.X - X0) / Cell),
+                        FMath::FloorToInt((P.Y - Y0) / Cell));
+      bool bClear = true;
+      for (int32 DY = -2; DY <= 2 && bClear; ++DY) {
+        for (int32 DX = -2; DX <= 2 && bClear; ++DX) {
+          if (const int32 *Other = Grid.Find(C + FIntPoint(DX, DY))) {
+            bClear = FVector2D::DistSquared(P, Samples[*Other]) >= MinDistanceSq;
+          }
+        }
+      }
+      if (bClear) {
+        Grid.Add(C, Samples.Add(P));
+      }
+    }
+  } else {
+    for (int32 Index = 0; Index < Target; ++Index) {
+      Samples.Emplace(X0 + Stream.FRand() * W, Y0 + Stream.FRand() * H);
+    }
+  }
+  OutSamples = Samples.Num();
+
+  OutInstances.Reserve(Samples.Num());
+  for (const FVector2D &P : Samples) {
+    // Drawn before the trace so rejected samples use the stream the same way.
+    const float Yaw = Type.bRandomYaw ? Stream.FRandRange(0.0f, 360.0f) : 0.0f;
+    const float Scale = Stream.FRandRange(Type.ScaleMin, Type.ScaleMax);
+
+    FHitResult Hit;
+    const FVector Start(P.X, P.Y, Settings.Bounds.Max.Z);
+    const FVector End(P.X, P.Y, Settings.Bounds.Min.Z);
+    if (!World->LineTraceSingleByChannel(Hit, Start, End, ECC_WorldStatic,
+                                         TraceParams)) {
+      continue;
+    }
+    if (Settings.bLandscapeOnly && !Cast<ALandscapeProxy>(Hit.GetActor())) {
+      continue;
+    }
+    const FVector Normal = Hit.ImpactNormal.GetSafeNormal(
+        UE_SMALL_NUMBER, FVector::UpVector);
+    if (Normal.Z < Type.MinNormalZ) {
+      continue;
+    }
+
+    FQuat Rotation(FVector::UpVector, FMath::DegreesToRadians(Yaw));
+    if (Type.bAlignToNormal) {
+      Rotation = FQuat::FindBetweenNormals(FVector::UpVector, Normal) * Rotation;
+    }
+    FFoliageInstance &Instance = OutInstances.AddDefaulted_GetRef();
+    Instance.Location = Hit.ImpactPoint + FVector(0.0, 0.0, Type.ZOffset);
+    Instance.Rotation = Rotation.Rotator();
+    Instance.DrawScale3D = FVector3f(Scale);
+  }
+}
+
+// Scatters every type over every tile across the task graph, then commits
+// each type's instances in tile order through CommitFoliageInstances. Its
+// MinDistance pass drops samples that clash across a tile border or with
+// instances already in the level, always keeping the earlier tile's, so the
+// result does not depend on how many workers ran the tiles.
+static TSharedPtr<FJsonObject>
+RunFoliageScatter(UWorld *World, AInstancedFoliageActor *IFA,
+                  const FFoliageScatterSettings &Settings,
+                  const TArray<FFoliageScatterType> &Types, bool bParallel) {
+  const int32 NumTiles = Settings.TilesX * Settings.TilesY;
+  const int32 NumItems = NumTiles * Types.Num();
+  TArray<TArray<FFoliageInstance>> ItemInstances;
+  ItemInstances.SetNum(NumItems);
+  TArray<int32> ItemSamples;
+  ItemSamples.SetNumZeroed(NumItems);
+
+  FCollisionQueryParams TraceParams(SCENE_QUERY_STAT(McpFoliageScatter), true);
+  TraceParams.AddIgnoredActor(IFA);
+
+  const double StartSeconds = FPlatformTime::Seconds();
+  ParallelFor(
+      NumItems,
+      [&](int32 Item) {
+        const int32 TypeIndex = Item % Types.Num();
+        const int32 Tile = Item / Types.Num();
+        ScatterFoliageTile(World, Settings, Types[TypeIndex], TypeIndex,
+                           Tile % Settings.TilesX, Tile / Settings.TilesX,
+                           TraceParams, ItemInstances[Item], ItemSamples[Item]);
+      },
+      bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+  const double ScatterSeconds = FPlatformTime::Seconds() - StartSeconds;
+
+  TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+  TArray<TSharedPtr<FJsonValue>> TypeResults;
+  int32 TotalAdded = 0;
+  for (int32 TypeIndex = 0; TypeIndex < Types.Num(); ++TypeIndex) {
+    TArray<FFoliageInstance> Instances;
+    int32 Samples = 0;
+    for (int32 Tile = 0; Tile < NumTiles; ++Tile) {
+      const int32 Item = Tile * Types.Num() + TypeIndex;
+      Samples += ItemSamples[Item];
+      Instances.Append(MoveTemp(ItemInstances[Item]));
+    }
+    int32 Skipped = 0;
+    const int32 Added = CommitFoliageInstances(
+        IFA, Types[TypeIndex].FoliageType, Instances,
+        Types[TypeIndex].MinDistance, Skipped);
+    TotalAdded += Added;
+
+    TSharedPtr<FJsonObject> TypeResult = MakeShared<FJsonObject>();
+    TypeResult->SetStringField(TEXT("foliageTypePath"),
+                               Types[TypeIndex].FoliageType->GetPathName());
+    TypeResult->SetNumberField(TEXT("samples"), Samples);
+    TypeResult->SetNumberField(TEXT("hits"), Instances.Num());
+    TypeResult->SetNumberField(TEXT("added"), Added);
+    TypeResult->SetNumberField(TEXT("skipped"), Skipped);
+    TypeResults.Add(MakeShared<FJsonValueObject>(TypeResult));
+  }
+
+  Result->SetArrayField(TEXT("foliageTypes"), TypeResults);
+  Result->SetNumberField(TEXT("instancesAdded"), TotalAdded);
+  Result->SetNumberField(TEXT("tilesX"), Settings.TilesX);
+  Result->SetNumberField(TEXT("tilesY"), Settings.TilesY);
+  Result->SetNumberField(TEXT("tileSize"), Settings.TileSize);
+  Result->SetNumberField(TEXT("seed"), Settings.Seed);
+  Result->SetNumberField(TEXT("scatterMs"), ScatterSeconds * 1000.0);
+  return Result;
+}
+#endif
+
 bool UMcpAutomationBridgeSubsystem::HandleCreateProceduralFoliage(
     const FString &RequestId, const FString &Action,
     const TSharedPtr<FJsonObject> &Payload,
@@ -991,6 +1634,166 @@ bool UMcpAutomationBridgeSubsystem::HandleCreateProceduralFoliage(
     return true;
   }
 
+  // mode "scatter" places the instances itself instead of resimulating a
+  // UProceduralFoliageComponent on the game thread; no volume or spawner is
+  // created and the instances land straight in the level's foliage actor.
+  FString Mode;
+  Payload->TryGetStringField(TEXT("mode"), Mode);
+  if (Mode.Equals(TEXT("scatter"), ESearchCase::IgnoreCase)) {
+    UWorld *World = GEditor->GetEditorWorldContext().World();
+    if (!World) {
+      SendAutomationError(RequestingSocket, RequestId,
+                          TEXT("Editor world not available"),
+                          TEXT("EDITOR_NOT_AVAILABLE"));
+      return true;
+    }
+
+    FFoliageScatterSettings Settings;
+    Settings.Bounds = FBox(Location - Size * 0.5, Location + Size * 0.5);
+    Settings.Seed = Seed;
+    Payload->TryGetNumberField(TEXT("tileSize"), Settings.TileSize);
+    Payload->TryGetBoolField(TEXT("landscapeOnly"), Settings.bLandscapeOnly);
+    bool bParallel = true;
+    Payload->TryGetBoolField(TEXT("parallel"), bParallel);
+    if (Settings.TileSize < 100.0 || Size.X <= 0.0 || Size.Y <= 0.0) {
+      SendAutomationError(RequestingSocket, RequestId,
+                          TEXT("tileSize must be at least 100 and bounds size "
+                               "must be positive"),
+                          TEXT("INVALID_ARGUMENT"));
+      return true;
+    }
+    Settings.TilesX = FMath::Max(
+        1, FMath::CeilToInt(Size.X / Settings.TileSize));
+    Settings.TilesY = FMath::Max(
+        1, FMath::CeilToInt(Size.Y / Settings.TileSize));
+    if (static_cast<int64>(Settings.TilesX) * Settings.TilesY >
+        MaxFoliageScatterTiles) {
+      SendAutomationError(
+          RequestingSocket, RequestId,
+          FString::Printf(TEXT("Scatter needs %d x %d tiles; raise tileSize "
+                               "(at most %d tiles)"),
+                          Settings.TilesX, Settings.TilesY,
+                          MaxFoliageScatterTiles),
+          TEXT("SCATTER_TOO_LARGE"));
+      return true;
+    }
+
+    TArray<FFoliageScatterType> Types;
+    double ExpectedInstances = 0.0;
+    for (int32 Index = 0; Index < FoliageTypesArr->Num(); ++Index) {
+      const TSharedPtr<FJsonObject> *TypeObj = nullptr;
+      if (!(*FoliageTypesArr)[Index]->TryGetObject(TypeObj) || !TypeObj) {
+        continue;
+      }
+      FFoliageScatterType Type;
+      FString FoliageTypePath;
+      FString MeshPath;
+      (*TypeObj)->TryGetStringField(TEXT("foliageTypePath"), FoliageTypePath);
+      (*TypeObj)->TryGetStringField(TEXT("meshPath"), MeshPath);
+      if (!FoliageTypePath.IsEmpty()) {
+        Type.FoliageType = LoadObject<UFoliageType>(nullptr, *FoliageTypePath);
+        if (Type.FoliageType) {
+          Type.Density = Type.FoliageType->Density;
+        }
+      } else if (UStaticMesh *Mesh =
+                     MeshPath.IsEmpty()
+                         ? nullptr
+                         : LoadObject<UStaticMesh>(nullptr, *MeshPath)) {
+        // One foliage type asset per entry, reused by later calls.
+        const FString FTName = FString::Printf(TEXT("%s_FT_%d"), *Name, Index);
+        const FString FTPath = FString::Printf(
+            TEXT("/Game/ProceduralFoliage/%s"), *FTName);
+        UFoliageType_InstancedStaticMesh *FT =
+            UEditorAssetLibrary::DoesAssetExist(FTPath)
+                ? LoadObject<UFoliageType_InstancedStaticMesh>(nullptr, *FTPath)
+                : nullptr;
+        if (!FT) {
+          if (UPackage *FTPackage = CreatePackage(*FTPath)) {
+            FT = NewObject<UFoliageType_InstancedStaticMesh>(
+                FTPackage, FName(*FTName), RF_Public | RF_Standalone);
+            FAssetRegistryModule::AssetCreated(FT);
+          }
+        }
+        if (FT) {
+          FT->SetStaticMesh(Mesh);
+          FT->MarkPackageDirty();
+          McpSafeAssetSave(FT);
+        }
+        Type.FoliageType = FT;
+      }
+      if (!Type.FoliageType) {
+        SendAutomationError(
+            RequestingSocket, RequestId,
+            FString::Printf(TEXT("foliageTypes[%d]: could not load '%s'"),
+                            Index,
+                            FoliageTypePath.IsEmpty() ? *MeshPath
+                                                      : *FoliageTypePath),
+            TEXT("ASSET_NOT_FOUND"));
+        return true;
+      }
+
+      (*TypeObj)->TryGetNumberField(TEXT("density"), Type.Density);
+      Type.Density = FMath::Max(0.0, Type.Density);
+      // Half the mean spacing by default: loose enough for dart throwing to
+      // reach the density, tight enough to avoid visible clumps.
+      Type.MinDistance =
+          Type.Density > 0.0 ? 500.0 / FMath::Sqrt(Type.Density) : 0.0;
+      (*TypeObj)->TryGetNumberField(TEXT("minDistance"), Type.MinDistance);
+      Type.MinDistance = FMath::Max(0.0, Type.MinDistance);
+      double ScaleMin = 1.0;
+      double ScaleMax = 1.0;
+      (*TypeObj)->TryGetNumberField(TEXT("minScale"), ScaleMin);
+      (*TypeObj)->TryGetNumberField(TEXT("maxScale"), ScaleMax);
+      Type.ScaleMin = static_cast<float>(FMath::Min(ScaleMin, ScaleMax));
+      Type.ScaleMax = static_cast<float>(FMath::Max(ScaleMin, ScaleMax));
+      (*TypeObj)->TryGetBoolField(TEXT("randomYaw"), Type.bRandomYaw);
+      (*TypeObj)->TryGetBoolField(TEXT("alignToNormal"), Type.bAlignToNormal);
+      double MaxSlope = 90.0;
+      if ((*TypeObj)->TryGetNumberField(TEXT("maxSlope"), MaxSlope)) {
+        Type.MinNormalZ =
+            FMath::Cos(FMath::DegreesToRadians(FMath::Clamp(MaxSlope, 0.0, 90.0)));
+      }
+      (*TypeObj)->TryGetNumberField(TEXT("zOffset"), Type.ZOffset);
+
+      ExpectedInstances += Type.Density * Size.X * Size.Y / 1000000.0;
+      Types.Add(Type);
+    }
+    if (Types.Num() == 0) {
+      SendAutomationError(RequestingSocket, RequestId,
+                          TEXT("foliageTypes must list at least one type"),
+                          TEXT("INVALID_ARGUMENT"));
+      return true;
+    }
+    if (ExpectedInstances > MaxFoliageScatterInstances) {
+      SendAutomationError(
+          RequestingSocket, RequestId,
+          FString::Printf(TEXT("Scatter would place about %.0f instances "
+                               "(at most %.0f per call)"),
+                          ExpectedInstances, MaxFoliageScatterInstances),
+          TEXT("SCATTER_TOO_LARGE"));
+      return true;
+    }
+
+    AInstancedFoliageActor *IFA =
+        GetOrCreateFoliageActorForWorldSafe(World, true);
+    if (!IFA) {
+      SendAutomationError(RequestingSocket, RequestId,
+                          TEXT("Failed to get foliage actor"),
+                          TEXT("FOLIAGE_ACTOR_FAILED"));
+      return true;
+    }
+
+    TSharedPtr<FJsonObject> Resp =
+        RunFoliageScatter(World, IFA, Settings, Types, bParallel);
+    Resp->SetBoolField(TEXT("success"), true);
+    Resp->SetStringField(TEXT("mode"), TEXT("scatter"));
+    Resp->SetStringField(TEXT("foliageActorPath"), IFA->GetPathName());
+    SendAutomationResponse(RequestingSocket, RequestId, true,
+                           TEXT("Procedural foliage scattered"), Resp,
+                           FString());
+    return true;
+  }
+
   // Create Spawner Asset
   FString PackagePath = TEXT("/Game/ProceduralFoliage");
   FString AssetName = Name + TEXT("_Spawner");
@@ -1,7 +1,7 @@
 #include "Dom/JsonObject.h"
 // McpAutomationBridge_GASHandlers.cpp
 // Phase 13: Gameplay Ability System (GAS)
-// Implements 31 actions for abilities, effects, attributes, and gameplay cues.
+// Implements 32 actions for abilities, effects, attributes, and gameplay cues.
 // 
 // Actions:
 // 13.1 Components & Attributes: add_ability_system_component, configure_asc, create_attribute_set,
@@ -14,10 +14,14 @@
 // 13.5 Tags/Utility: add_tag_to_asset, get_gas_info
 // 13.6 Ability Sets: create_ability_set, add_ability, grant_ability
 // 13.7 Execution Calculations: create_execution_calculation
+// 13.8 Bulk Import: import_gas_table
 
 #include "McpAutomationBridgeSubsystem.h"
 #include "McpAutomationBridgeHelpers.h"
 #include "McpAutomationBridgeGlobals.h"
+#include "McpAssetSaveQueue.h"
+#include "McpBlueprintCompileQueue.h"
+#include "HAL/PlatformTime.h"
 #include "Misc/EngineVersionComparison.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogMcpGASHandlers, Log, All);
@@ -213,6 +217,625 @@ static UBlueprint* CreateGASBlueprint(const FString& Path, const FString& Name,
     Blueprint->MarkPackageDirty();
     return Blueprint;
 }
+
+// ------------------------------------------------------------
+// import_gas_table helpers
+// ------------------------------------------------------------
+
+// Rows past this are almost certainly a wrong sheet; split real imports by table.
+static constexpr int32 MaxGASImportRows = 5000;
+// Progress (and a chance to cancel) every this many rows.
+static constexpr int32 GASImportProgressRows = 50;
+
+// Parses RFC 4180 CSV: the first record names the columns, every later non-blank record is one
+// row object of string cells. Quoted cells may hold commas, newlines and "" escapes.
+static bool ParseGASImportCsv(const FString& Csv, TArray<TSharedPtr<FJsonObject>>& OutRows, FString& OutError)
+{
+    TArray<TArray<FString>> Records;
+    TArray<FString> Record;
+    FString Cell;
+    bool bQuoted = false;
+    bool bCellStarted = false;
+    const int32 Len = Csv.Len();
+    for (int32 Index = 0; Index < Len; ++Index)
+    {
+        const TCHAR Ch = Csv[Index];
+        if (bQuoted)
+        {
+            if (Ch == TEXT('"'))
+            {
+                if (Index + 1 < Len && Csv[Index + 1] == TEXT('"'))
+                {
+                    Cell.AppendChar(TEXT('"'));
+                    ++Index;
+                }
+                else
+                {
+                    bQuoted = false;
+                }
+            }
+            else
+            {
+                Cell.AppendChar(Ch);
+            }
+            continue;
+        }
+        if (Ch == TEXT('"') && !bCellStarted)
+        {
+            bQuoted = true;
+            bCellStarted = true;
+        }
+        else if (Ch == TEXT(','))
+        {
+            Record.Add(MoveTemp(Cell));
+            Cell.Reset();
+            bCellStarted = false;
+        }
+        else if (Ch == TEXT('\n') || Ch == TEXT('\r'))
+        {
+            if (Ch == TEXT('\r') && Index + 1 < Len && Csv[Index + 1] == TEXT('\n'))
+            {
+                ++Index;
+            }
+            Record.Add(MoveTemp(Cell));
+            Cell.Reset();
+            bCellStarted = false;
+            Records.Add(MoveTemp(Record));
+            Record.Reset();
+        }
+        else
+        {
+            Cell.AppendChar(Ch);
+            bCellStarted = true;
+        }
+    }
+    if (bQuoted)
+    {
+        OutError = TEXT("csv ends inside a quoted cell");
+        return false;
+    }
+    if (bCellStarted || Record.Num() > 0)
+    {
+        Record.Add(MoveTemp(Cell));
+        Records.Add(MoveTemp(Record));
+    }
+
+    auto IsBlank = [](const TArray<FString>& Cells)
+    {
+        for (const FString& Value : Cells)
+        {
+            if (!Value.TrimStartAndEnd().IsEmpty())
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    int32 HeaderIndex = 0;
+    while (HeaderIndex < Records.Num() && IsBlank(Records[HeaderIndex]))
+    {
+        ++HeaderIndex;
+    }
+    if (HeaderIndex >= Records.Num())
+    {
+        OutError = TEXT("csv has no header row");
+        return false;
+    }
+    TArray<FString> Columns;
+    for (const FString& Column : Records[HeaderIndex])
+    {
+        Columns.Add(Column.TrimStartAndEnd());
+    }
+    for (int32 RecordIndex = HeaderIndex + 1; RecordIndex < Records.Num(); ++RecordIndex)
+    {
+        const TArray<FString>& Cells = Records[RecordIndex];
+        if (IsBlank(Cells))
+        {
+            continue;
+        }
+        TSharedPtr<FJsonObject> Row = MakeShareable(new FJsonObject());
+        for (int32 Column = 0; Column < Columns.Num() && Column < Cells.Num(); ++Column)
+        {
+            if (!Columns[Column].IsEmpty() && !Cells[Column].TrimStartAndEnd().IsEmpty())
+            {
+                Row->SetStringField(Columns[Column], Cells[Column].TrimStartAndEnd());
+            }
+        }
+        OutRows.Add(Row);
+    }
+    return true;
+}
+
+// A cell as text whether the row came from CSV (strings) or JSON (strings, numbers, bools).
+static FString GetGASRowString(const TSharedPtr<FJsonObject>& Row, const TCHAR* Key, const TCHAR* Alias = nullptr)
+{
+    TSharedPtr<FJsonValue> Value = Row->TryGetField(Key);
+    if ((!Value.IsValid() || Value->IsNull()) && Alias)
+    {
+        Value = Row->TryGetField(Alias);
+    }
+    if (!Value.IsValid() || Value->IsNull())
+    {
+        return FString();
+    }
+    bool bValue = false;
+    if (Value->Type == EJson::Boolean && Value->TryGetBool(bValue))
+    {
+        return bValue ? TEXT("true") : TEXT("false");
+    }
+    FString Text;
+    return Value->TryGetString(Text) ? Text.TrimStartAndEnd() : FString();
+}
+
+// False when the cell is empty; OutError is set when it holds something that is not a number.
+static bool GetGASRowNumber(const TSharedPtr<FJsonObject>& Row, const TCHAR* Key, double& OutValue, FString& OutError)
+{
+    const TSharedPtr<FJsonValue> Value = Row->TryGetField(Key);
+    if (!Value.IsValid() || Value->IsNull())
+    {
+        return false;
+    }
+    if (Value->Type == EJson::Number)
+    {
+        OutValue = Value->AsNumber();
+        return true;
+    }
+    const FString Text = GetGASRowString(Row, Key);
+    if (Text.IsEmpty())
+    {
+        return false;
+    }
+    if (!Text.IsNumeric())
+    {
+        OutError = FString::Printf(TEXT("'%s' is not a number: %s"), Key, *Text);
+        return false;
+    }
+    OutValue = FCString::Atod(*Text);
+    return true;
+}
+
+// Tags as a JSON array or one cell separated by ';' or '|' (commas belong to the CSV).
+static TArray<FString> GetGASRowList(const TSharedPtr<FJsonObject>& Row, const TCHAR* Key)
+{
+    TArray<FString> Out;
+    const TArray<TSharedPtr<FJsonValue>>* Array = nullptr;
+    if (Row->TryGetArrayField(Key, Array))
+    {
+        for (const TSharedPtr<FJsonValue>& Value : *Array)
+        {
+            FString Text;
+            if (Value.IsValid() && Value->TryGetString(Text) && !Text.TrimStartAndEnd().IsEmpty())
+            {
+                Out.Add(Text.TrimStartAndEnd());
+            }
+        }
+        return Out;
+    }
+    const FString Text = GetGASRowString(Row, Key).Replace(TEXT("|"), TEXT(";"));
+    Text.ParseIntoArray(Out, TEXT(";"), true);
+    for (FString& Item : Out)
+    {
+        Item.TrimStartAndEndInline();
+    }
+    Out.RemoveAll([](const FString& Item) { return Item.IsEmpty(); });
+    return Out;
+}
+
+// One asset an import created or updated, in the order first touched.
+struct FGASImportAsset
+{
+    UBlueprint* Blueprint = nullptr;
+    FString Kind;
+    bool bCreated = false;
+    /** Attribute sets whose variables or defaults changed, so need the compile pass. */
+    bool bNeedsCompile = false;
+    /** Gameplay effects whose modifiers this import has already replaced. */
+    bool bModifiersReset = false;
+};
+
+struct FGASImportState
+{
+    TArray<FGASImportAsset> Assets;
+    /** Asset references as written in the table, plus each asset's name and object path. */
+    TMap<FString, int32> AssetsByRef;
+};
+
+// Finds or creates the Blueprint a row names: a name (created under DefaultPath) or a
+// /Game/... package or object path.
+static FGASImportAsset* FindOrCreateGASImportAsset(FGASImportState& State, const FString& Ref,
+    const FString& DefaultPath, UClass* ParentClass, const TCHAR* Kind, FString& OutError)
+{
+    if (const int32* Existing = State.AssetsByRef.Find(Ref))
+    {
+        FGASImportAsset& Asset = State.Assets[*Existing];
+        if (Asset.Kind != Kind)
+        {
+            OutError = FString::Printf(TEXT("'%s' is used as both %s and %s"), *Ref, *Asset.Kind, Kind);
+            return nullptr;
+        }
+        return &Asset;
+    }
+
+    FString Folder = DefaultPath;
+    FString AssetName = Ref;
+    if (Ref.StartsWith(TEXT("/")))
+    {
+        FString PackagePath = Ref;
+        int32 DotIndex = INDEX_NONE;
+        if (PackagePath.FindChar(TEXT('.'), DotIndex))
+        {
+            PackagePath.LeftInline(DotIndex);
+        }
+        Folder = FPackageName::GetLongPackagePath(PackagePath);
+        AssetName = FPackageName::GetShortName(PackagePath);
+    }
+
+    bool bReusedExisting = false;
+    UBlueprint* Blueprint = CreateGASBlueprint(Folder, AssetName, ParentClass, OutError, bReusedExisting);
+    if (!Blueprint)
+    {
+        return nullptr;
+    }
+    if (const int32* Existing = State.AssetsByRef.Find(Blueprint->GetPathName()))
+    {
+        State.AssetsByRef.Add(Ref, *Existing);
+        return &State.Assets[*Existing];
+    }
+
+    const int32 Index = State.Assets.AddDefaulted();
+    FGASImportAsset& Asset = State.Assets[Index];
+    Asset.Blueprint = Blueprint;
+    Asset.Kind = Kind;
+    Asset.bCreated = !bReusedExisting;
+    State.AssetsByRef.Add(Ref, Index);
+    State.AssetsByRef.Add(Blueprint->GetName(), Index);
+    State.AssetsByRef.Add(Blueprint->GetPathName(), Index);
+    return &Asset;
+}
+
+// "Set.Attribute", where Set is an attribute set of this import, a Blueprint path or a native class.
+// Resolved after the compile pass, so attributes the import just added are real properties.
+static FProperty* ResolveGASImportAttribute(const FGASImportState& State, const FString& Ref, FString& OutError)
+{
+    FString SetRef;
+    FString AttributeName;
+    if (!Ref.Split(TEXT("."), &SetRef, &AttributeName, ESearchCase::CaseSensitive, ESearchDir::FromEnd) ||
+        SetRef.IsEmpty() || AttributeName.IsEmpty())
+    {
+        OutError = FString::Printf(TEXT("Attribute '%s' must be written as AttributeSet.Attribute"), *Ref);
+        return nullptr;
+    }
+
+    UClass* SetClass = nullptr;
+    if (const int32* Index = State.AssetsByRef.Find(SetRef))
+    {
+        SetClass = State.Assets[*Index].Blueprint->GeneratedClass;
+    }
+    else if (SetRef.StartsWith(TEXT("/")))
+    {
+        FString ObjectPath = SetRef;
+        if (!ObjectPath.Contains(TEXT(".")))
+        {
+            ObjectPath += TEXT(".") + FPackageName::GetShortName(SetRef);
+        }
+        if (UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *ObjectPath))
+        {
+            SetClass = Blueprint->GeneratedClass;
+        }
+    }
+    else
+    {
+        SetClass = ResolveClassByName(SetRef);
+    }
+    if (!SetClass || !SetClass->IsChildOf(UAttributeSet::StaticClass()))
+    {
+        OutError = FString::Printf(TEXT("Attribute set not found: %s"), *SetRef);
+        return nullptr;
+    }
+
+    FProperty* Property = FindFProperty<FProperty>(SetClass, FName(*AttributeName));
+    if (!Property || (!FGameplayAttribute::IsGameplayAttributeDataProperty(Property) && !CastField<FNumericProperty>(Property)))
+    {
+        OutError = FString::Printf(TEXT("Attribute not found on %s: %s"), *SetClass->GetName(), *AttributeName);
+        return nullptr;
+    }
+    return Property;
+}
+
+// Adds or updates one FGameplayAttributeData variable of an attribute set. Defaults are written to
+// the variable description, so they reach the class defaults in the compile pass.
+static bool ApplyGASAttributeRow(const TSharedPtr<FJsonObject>& Row, const FString& DefaultPath,
+    FGASImportState& State, const TSharedPtr<FJsonObject>& Report, FString& OutError)
+{
+    const FString SetRef = GetGASRowString(Row, TEXT("attributeSet"), TEXT("set"));
+    const FString AttributeName = GetGASRowString(Row, TEXT("attribute"), TEXT("name"));
+    if (SetRef.IsEmpty() || AttributeName.IsEmpty())
+    {
+        OutError = TEXT("Attribute rows need 'attributeSet' and 'attribute'");
+        return false;
+    }
+    double BaseValue = 0.0;
+    const bool bHasBaseValue = GetGASRowNumber(Row, TEXT("baseValue"), BaseValue, OutError);
+    if (!OutError.IsEmpty())
+    {
+        return false;
+    }
+
+    FGASImportAsset* Asset = FindOrCreateGASImportAsset(State, SetRef, DefaultPath, UAttributeSet::StaticClass(), TEXT("attributeSet"), OutError);
+    if (!Asset)
+    {
+        return false;
+    }
+    UBlueprint* Blueprint = Asset->Blueprint;
+    const FName VarName(*AttributeName);
+
+    int32 VarIndex = FBlueprintEditorUtils::FindNewVariableIndex(Blueprint, VarName);
+    bool bAdded = false;
+    if (VarIndex == INDEX_NONE)
+    {
+        if (Blueprint->ParentClass && FindFProperty<FProperty>(Blueprint->ParentClass, VarName))
+        {
+            OutError = FString::Printf(TEXT("%s is inherited from %s; set its default there"), *AttributeName, *Blueprint->ParentClass->GetName());
+            return false;
+        }
+        FEdGraphPinType PinType;
+        PinType.PinCategory = UEdGraphSchema_K2::PC_Struct;
+        PinType.PinSubCategoryObject = FGameplayAttributeData::StaticStruct();
+        if (!FBlueprintEditorUtils::AddMemberVariable(Blueprint, VarName, PinType))
+        {
+            OutError = FString::Printf(TEXT("Failed to add attribute %s"), *AttributeName);
+            return false;
+        }
+        VarIndex = FBlueprintEditorUtils::FindNewVariableIndex(Blueprint, VarName);
+        bAdded = true;
+        Asset->bNeedsCompile = true;
+    }
+    if (VarIndex == INDEX_NONE)
+    {
+        OutError = FString::Printf(TEXT("Failed to add attribute %s"), *AttributeName);
+        return false;
+    }
+    FBPVariableDescription& Var = Blueprint->NewVariables[VarIndex];
+    if (Var.VarType.PinSubCategoryObject.Get() != FGameplayAttributeData::StaticStruct())
+    {
+        OutError = FString::Printf(TEXT("%s exists but is not a GameplayAttributeData variable"), *AttributeName);
+        return false;
+    }
+
+    if (bHasBaseValue)
+    {
+        const FString Value = FString::SanitizeFloat(BaseValue);
+        const FString DefaultValue = FString::Printf(TEXT("(BaseValue=%s,CurrentValue=%s)"), *Value, *Value);
+        if (Var.DefaultValue != DefaultValue)
+        {
+            Var.DefaultValue = DefaultValue;
+            Asset->bNeedsCompile = true;
+        }
+        Report->SetNumberField(TEXT("baseValue"), BaseValue);
+    }
+    const FString Category = GetGASRowString(Row, TEXT("category"));
+    if (!Category.IsEmpty() && !Var.Category.ToString().Equals(Category))
+    {
+        FBlueprintEditorUtils::SetBlueprintVariableCategory(Blueprint, VarName, nullptr, FText::FromString(Category), true);
+        Asset->bNeedsCompile = true;
+    }
+
+    Report->SetStringField(TEXT("asset"), Blueprint->GetPathName());
+    Report->SetStringField(TEXT("attribute"), AttributeName);
+    Report->SetStringField(TEXT("op"), bAdded ? TEXT("added") : TEXT("updated"));
+    return true;
+}
+
+static bool ParseGASModifierOp(const FString& Operation, EGameplayModOp::Type& OutOp)
+{
+    if (Operation.IsEmpty() || Operation == TEXT("additive") || Operation == TEXT("add"))
+    {
+        OutOp = EGameplayModOp::Additive;
+    }
+    else if (Operation == TEXT("multiplicative") || Operation == TEXT("multiply"))
+    {
+        OutOp = EGameplayModOp::Multiplicitive;
+    }
+    else if (Operation == TEXT("division") || Operation == TEXT("divide"))
+    {
+        OutOp = EGameplayModOp::Division;
+    }
+    else if (Operation == TEXT("override"))
+    {
+        OutOp = EGameplayModOp::Override;
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+// Creates or updates one gameplay effect's class defaults. Several rows may name the same effect,
+// one modifier each; the first of them replaces the modifiers the effect had, so re-importing a
+// sheet converges instead of appending.
+static bool ApplyGASEffectRow(const TSharedPtr<FJsonObject>& Row, const FString& DefaultPath,
+    FGASImportState& State, const TSharedPtr<FJsonObject>& Report, FString& OutError)
+{
+    const FString EffectRef = GetGASRowString(Row, TEXT("effect"), TEXT("name"));
+    if (EffectRef.IsEmpty())
+    {
+        OutError = TEXT("Effect rows need 'effect'");
+        return false;
+    }
+
+    // Validate every cell before touching the effect.
+    const FString DurationType = GetGASRowString(Row, TEXT("durationType"));
+    if (!DurationType.IsEmpty() && DurationType != TEXT("instant") && DurationType != TEXT("infinite") &&
+        DurationType != TEXT("has_duration"))
+    {
+        OutError = FString::Printf(TEXT("durationType must be instant, infinite or has_duration: %s"), *DurationType);
+        return false;
+    }
+    const FString StackingType = GetGASRowString(Row, TEXT("stackingType"));
+    if (!StackingType.IsEmpty() && StackingType != TEXT("none") && StackingType != TEXT("aggregate_by_source") &&
+        StackingType != TEXT("aggregate_by_target"))
+    {
+        OutError = FString::Printf(TEXT("stackingType must be none, aggregate_by_source or aggregate_by_target: %s"), *StackingType);
+        return false;
+    }
+    double Duration = 0.0;
+    double Period = 0.0;
+    double StackLimit = 0.0;
+    double Magnitude = 0.0;
+    const bool bHasDuration = GetGASRowNumber(Row, TEXT("duration"), Duration, OutError);
+    const bool bHasPeriod = OutError.IsEmpty() && GetGASRowNumber(Row, TEXT("period"), Period, OutError);
+    const bool bHasStackLimit = OutError.IsEmpty() && GetGASRowNumber(Row, TEXT("stackLimit"), StackLimit, OutError);
+    const bool bHasMagnitude = OutError.IsEmpty() && GetGASRowNumber(Row, TEXT("magnitude"), Magnitude, OutError);
+    if (!OutError.IsEmpty())
+    {
+        return false;
+    }
+    const FString AttributeRef = GetGASRowString(Row, TEXT("modifierAttribute"), TEXT("attribute"));
+    EGameplayModOp::Type ModOp = EGameplayModOp::Additive;
+    const FString Operation = GetGASRowString(Row, TEXT("modifierOp"), TEXT("operation")).ToLower();
+    if (!ParseGASModifierOp(Operation, ModOp))
+    {
+        OutError = FString::Printf(TEXT("modifierOp must be add, multiply, divide or override: %s"), *Operation);
+        return false;
+    }
+    if (bHasMagnitude && AttributeRef.IsEmpty())
+    {
+        OutError = TEXT("A modifier magnitude needs 'modifierAttribute'");
+        return false;
+    }
+    FProperty* AttributeProperty = nullptr;
+    if (!AttributeRef.IsEmpty())
+    {
+        AttributeProperty = ResolveGASImportAttribute(State, AttributeRef, OutError);
+        if (!AttributeProperty)
+        {
+            return false;
+        }
+    }
+
+    FGASImportAsset* Asset = FindOrCreateGASImportAsset(State, EffectRef, DefaultPath, UGameplayEffect::StaticClass(), TEXT("gameplayEffect"), OutError);
+    if (!Asset)
+    {
+        return false;
+    }
+    UGameplayEffect* EffectCDO = Asset->Blueprint->GeneratedClass
+        ? Cast<UGameplayEffect>(Asset->Blueprint->GeneratedClass->GetDefaultObject())
+        : nullptr;
+    if (!EffectCDO)
+    {
+        OutError = TEXT("Not a GameplayEffect blueprint");
+        return false;
+    }
+    EffectCDO->Modify();
+
+    if (DurationType == TEXT("instant"))
+    {
+        EffectCDO->DurationPolicy = EGameplayEffectDurationType::Instant;
+    }
+    else if (DurationType == TEXT("infinite"))
+    {
+        EffectCDO->DurationPolicy = EGameplayEffectDurationType::Infinite;
+    }
+    else if (DurationType == TEXT("has_duration"))
+    {
+        EffectCDO->DurationPolicy = EGameplayEffectDurationType::HasDuration;
+    }
+    if (bHasDuration)
+    {
+        EffectCDO->DurationMagnitude = FGameplayEffectModifierMagnitude(FScalableFloat(static_cast<float>(Duration)));
+    }
+    if (bHasPeriod)
+    {
+        EffectCDO->Period = FScalableFloat(static_cast<float>(Period));
+    }
+
+    // UE 5.7+: StackingType is deprecated
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 7
+    PRAGMA_DISABLE_DEPRECATION_WARNINGS
+#endif
+    if (StackingType == TEXT("none"))
+    {
+        EffectCDO->StackingType = EGameplayEffectStackingType::None;
+    }
+    else if (StackingType == TEXT("aggregate_by_source"))
+    {
+        EffectCDO->StackingType = EGameplayEffectStackingType::AggregateBySource;
+    }
+    else if (StackingType == TEXT("aggregate_by_target"))
+    {
+        EffectCDO->StackingType = EGameplayEffectStackingType::AggregateByTarget;
+    }
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 7
+    PRAGMA_ENABLE_DEPRECATION_WARNINGS
+#endif
+    if (bHasStackLimit)
+    {
+        EffectCDO->StackLimitCount = static_cast<int32>(StackLimit);
+    }
+
+    if (AttributeProperty)
+    {
+        if (!Asset->bModifiersReset)
+        {
+            EffectCDO->Modifiers.Reset();
+            Asset->bModifiersReset = true;
+        }
+        FGameplayModifierInfo Modifier;
+        Modifier.Attribute = FGameplayAttribute(AttributeProperty);
+        Modifier.ModifierOp = ModOp;
+        Modifier.ModifierMagnitude = FGameplayEffectModifierMagnitude(FScalableFloat(static_cast<float>(Magnitude)));
+        EffectCDO->Modifiers.Add(Modifier);
+    }
+
+    TArray<TSharedPtr<FJsonValue>> Warnings;
+    for (const FString& TagName : GetGASRowList(Row, TEXT("grantedTags")))
+    {
+        const FGameplayTag Tag = GetOrRequestTag(TagName);
+        if (!Tag.IsValid())
+        {
+            Warnings.Add(MakeShareable(new FJsonValueString(FString::Printf(TEXT("Unknown gameplay tag: %s"), *TagName))));
+            continue;
+        }
+        // InheritableOwnedTagsContainer is deprecated in UE 5.5+, as in set_effect_tags.
+        PRAGMA_DISABLE_DEPRECATION_WARNINGS
+        EffectCDO->InheritableOwnedTagsContainer.AddTag(Tag);
+        PRAGMA_ENABLE_DEPRECATION_WARNINGS
+    }
+    for (const FString& TagName : GetGASRowList(Row, TEXT("cueTags")))
+    {
+        const FGameplayTag Tag = GetOrRequestTag(TagName);
+        if (!Tag.IsValid())
+        {
+            Warnings.Add(MakeShareable(new FJsonValueString(FString::Printf(TEXT("Unknown gameplay tag: %s"), *TagName))));
+            continue;
+        }
+        const bool bHasCue = EffectCDO->GameplayCues.ContainsByPredicate([&Tag](const FGameplayEffectCue& Cue)
+        {
+            return Cue.GameplayCueTags.HasTagExact(Tag);
+        });
+        if (!bHasCue)
+        {
+            FGameplayEffectCue Cue;
+            Cue.GameplayCueTags.AddTag(Tag);
+            EffectCDO->GameplayCues.Add(Cue);
+        }
+    }
+
+    Report->SetStringField(TEXT("asset"), Asset->Blueprint->GetPathName());
+    Report->SetStringField(TEXT("op"), Asset->bCreated ? TEXT("created") : TEXT("updated"));
+    if (AttributeProperty)
+    {
+        Report->SetStringField(TEXT("modifierAttribute"), AttributeRef);
+        Report->SetNumberField(TEXT("modifierCount"), EffectCDO->Modifiers.Num());
+    }
+    if (Warnings.Num() > 0)
+    {
+        Report->SetArrayField(TEXT("warnings"), Warnings);
+    }
+    return true;
+}
 #endif
 
 bool UMcpAutomationBridgeSubsystem::HandleManageGASAction(
@@ -2684,6 +3307,227 @@ bool UMcpAutomationBridgeSubsystem::HandleManageGASAction(
         return true;
     }
 
+    // ============================================================
+    // 13.8 BULK IMPORT
+    // ============================================================
+
+    // import_gas_table - Create or update attribute sets and gameplay effects from a table.
+    // Attribute rows are applied first and every touched set is compiled in one pass, so effect
+    // rows can reference attributes added by the same table.
+    if (SubAction == TEXT("import_gas_table"))
+    {
+        const double StartTime = FPlatformTime::Seconds();
+        TArray<TSharedPtr<FJsonObject>> Rows;
+        const TArray<TSharedPtr<FJsonValue>>* RowsArray = nullptr;
+        const FString Csv = GetStringFieldGAS(Payload, TEXT("csv"));
+        if (Payload->TryGetArrayField(TEXT("rows"), RowsArray))
+        {
+            for (const TSharedPtr<FJsonValue>& Value : *RowsArray)
+            {
+                const TSharedPtr<FJsonObject>* RowObject = nullptr;
+                if (!Value.IsValid() || !Value->TryGetObject(RowObject))
+                {
+                    SendAutomationError(RequestingSocket, RequestId, TEXT("Every entry in 'rows' must be an object."), TEXT("INVALID_ARGUMENT"));
+                    return true;
+                }
+                Rows.Add(*RowObject);
+            }
+        }
+        else if (!Csv.IsEmpty())
+        {
+            FString CsvError;
+            if (!ParseGASImportCsv(Csv, Rows, CsvError))
+            {
+                SendAutomationError(RequestingSocket, RequestId, CsvError, TEXT("INVALID_ARGUMENT"));
+                return true;
+            }
+        }
+        else
+        {
+            SendAutomationError(RequestingSocket, RequestId, TEXT("Missing 'rows' or 'csv'."), TEXT("INVALID_ARGUMENT"));
+            return true;
+        }
+        if (Rows.Num() == 0)
+        {
+            SendAutomationError(RequestingSocket, RequestId, TEXT("The table has no rows."), TEXT("INVALID_ARGUMENT"));
+            return true;
+        }
+        if (Rows.Num() > MaxGASImportRows)
+        {
+            SendAutomationError(RequestingSocket, RequestId,
+                FString::Printf(TEXT("The table has %d rows; split it into imports of at most %d."), Rows.Num(), MaxGASImportRows),
+                TEXT("INVALID_ARGUMENT"));
+            return true;
+        }
+        const bool bSave = GetBoolFieldGAS(Payload, TEXT("save"), true);
+
+        // Sort rows into attribute and effect rows; a row without 'kind' is an attribute row when it
+        // names an attribute set or an attribute but no effect.
+        TArray<TSharedPtr<FJsonObject>> Reports;
+        TArray<int32> AttributeRows;
+        TArray<int32> EffectRows;
+        int32 RowsFailed = 0;
+        for (int32 RowIndex = 0; RowIndex < Rows.Num(); ++RowIndex)
+        {
+            const TSharedPtr<FJsonObject>& Row = Rows[RowIndex];
+            FString Kind = GetGASRowString(Row, TEXT("kind")).ToLower();
+            if (Kind.IsEmpty())
+            {
+                const bool bNamesEffect = !GetGASRowString(Row, TEXT("effect")).IsEmpty();
+                const bool bNamesAttribute = !GetGASRowString(Row, TEXT("attributeSet"), TEXT("set")).IsEmpty();
+                Kind = (bNamesAttribute && !bNamesEffect) ? TEXT("attribute") : TEXT("effect");
+            }
+            TSharedPtr<FJsonObject> Report = MakeShareable(new FJsonObject());
+            Report->SetNumberField(TEXT("row"), RowIndex + 1);
+            Report->SetStringField(TEXT("kind"), Kind);
+            Report->SetStringField(TEXT("status"), TEXT("skipped"));
+            Reports.Add(Report);
+            if (Kind == TEXT("attribute"))
+            {
+                AttributeRows.Add(RowIndex);
+            }
+            else if (Kind == TEXT("effect"))
+            {
+                EffectRows.Add(RowIndex);
+            }
+            else
+            {
+                Report->SetStringField(TEXT("status"), TEXT("failed"));
+                Report->SetStringField(TEXT("error"), FString::Printf(TEXT("kind must be attribute or effect: %s"), *Kind));
+                ++RowsFailed;
+            }
+        }
+
+        FGASImportState State;
+        int32 RowsDone = 0;
+        bool bCancelled = false;
+        auto ApplyRows = [&](const TArray<int32>& RowIndices, bool bAttributes)
+        {
+            for (const int32 RowIndex : RowIndices)
+            {
+                if (bCancelled)
+                {
+                    return;
+                }
+                FString RowError;
+                const TSharedPtr<FJsonObject>& Report = Reports[RowIndex];
+                const bool bOk = bAttributes
+                    ? ApplyGASAttributeRow(Rows[RowIndex], Path, State, Report, RowError)
+                    : ApplyGASEffectRow(Rows[RowIndex], Path, State, Report, RowError);
+                Report->SetStringField(TEXT("status"), bOk ? TEXT("ok") : TEXT("failed"));
+                if (!bOk)
+                {
+                    Report->SetStringField(TEXT("error"), RowError);
+                    ++RowsFailed;
+                }
+                if (++RowsDone % GASImportProgressRows == 0 &&
+                    !SendProgressUpdate(RequestId, 100.0f * RowsDone / Rows.Num(),
+                        FString::Printf(TEXT("Imported %d/%d rows"), RowsDone, Rows.Num())))
+                {
+                    // Rows already applied stay applied and are still compiled and saved below.
+                    bCancelled = true;
+                }
+            }
+        };
+
+        ApplyRows(AttributeRows, true);
+
+        // One dependency-ordered compile for every attribute set that changed, instead of one per row.
+        TArray<UBlueprint*> SetsToCompile;
+        for (FGASImportAsset& Asset : State.Assets)
+        {
+            if (Asset.bNeedsCompile)
+            {
+                FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Asset.Blueprint);
+                SetsToCompile.Add(Asset.Blueprint);
+            }
+        }
+        TArray<FMcpBlueprintCompileResult> CompileResults;
+        if (SetsToCompile.Num() > 0)
+        {
+            FMcpBlueprintCompileQueue::CompileMany(SetsToCompile, CompileResults);
+        }
+
+        ApplyRows(EffectRows, false);
+
+        // Effects only changed class defaults, which need no recompile.
+        for (FGASImportAsset& Asset : State.Assets)
+        {
+            if (Asset.Kind == TEXT("gameplayEffect"))
+            {
+                FBlueprintEditorUtils::MarkBlueprintAsModified(Asset.Blueprint);
+            }
+            if (bSave)
+            {
+                QueueAssetSave(Asset.Blueprint);
+            }
+        }
+        TArray<FMcpAssetSaveResult> SaveResults;
+        FMcpAssetSaveQueue::Flush(&SaveResults);
+
+        int32 CompileFailed = 0;
+        int32 SaveFailed = 0;
+        TArray<TSharedPtr<FJsonValue>> AssetsArray;
+        for (const FGASImportAsset& Asset : State.Assets)
+        {
+            TSharedPtr<FJsonObject> AssetObj = MakeShareable(new FJsonObject());
+            AssetObj->SetStringField(TEXT("path"), Asset.Blueprint->GetPathName());
+            AssetObj->SetStringField(TEXT("kind"), Asset.Kind);
+            AssetObj->SetBoolField(TEXT("created"), Asset.bCreated);
+            for (const FMcpBlueprintCompileResult& Compile : CompileResults)
+            {
+                if (Compile.BlueprintPath == Asset.Blueprint->GetPathName())
+                {
+                    AssetObj->SetObjectField(TEXT("compile"), FMcpBlueprintCompileQueue::ToJson(Compile));
+                    CompileFailed += Compile.bCompiled ? 0 : 1;
+                }
+            }
+            const FString PackageName = Asset.Blueprint->GetOutermost()->GetName();
+            for (const FMcpAssetSaveResult& Save : SaveResults)
+            {
+                if (Save.PackageName == PackageName)
+                {
+                    AssetObj->SetBoolField(TEXT("saved"), Save.bSaved);
+                    SaveFailed += Save.bSaved ? 0 : 1;
+                }
+            }
+            AssetsArray.Add(MakeShareable(new FJsonValueObject(AssetObj)));
+        }
+
+        TArray<TSharedPtr<FJsonValue>> RowsReport;
+        int32 RowsSkipped = 0;
+        for (const TSharedPtr<FJsonObject>& Report : Reports)
+        {
+            FString Status;
+            Report->TryGetStringField(TEXT("status"), Status);
+            RowsSkipped += Status == TEXT("skipped") ? 1 : 0;
+            RowsReport.Add(MakeShareable(new FJsonValueObject(Report)));
+        }
+
+        TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject());
+        Result->SetNumberField(TEXT("rowCount"), Rows.Num());
+        Result->SetNumberField(TEXT("rowsOk"), Rows.Num() - RowsFailed - RowsSkipped);
+        Result->SetNumberField(TEXT("rowsFailed"), RowsFailed);
+        Result->SetNumberField(TEXT("rowsSkipped"), RowsSkipped);
+        Result->SetNumberField(TEXT("compiled"), CompileResults.Num());
+        Result->SetNumberField(TEXT("compileFailed"), CompileFailed);
+        Result->SetNumberField(TEXT("saved"), SaveResults.Num() - SaveFailed);
+        Result->SetNumberField(TEXT("saveFailed"), SaveFailed);
+        Result->SetBoolField(TEXT("cancelled"), bCancelled);
+        Result->SetNumberField(TEXT("durationMs"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+        Result->SetArrayField(TEXT("assets"), AssetsArray);
+        Result->SetArrayField(TEXT("rows"), RowsReport);
+
+        const bool bComplete = RowsFailed == 0 && RowsSkipped == 0 && CompileFailed == 0 && SaveFailed == 0;
+        SendAutomationResponse(RequestingSocket, RequestId, bComplete,
+            bComplete
+                ? FString::Printf(TEXT("Imported %d rows into %d assets"), Rows.Num(), State.Assets.Num())
+                : FString::Printf(TEXT("Import incomplete: %d failed, %d skipped, %d compile errors, %d save errors"),
+                    RowsFailed, RowsSkipped, CompileFailed, SaveFailed),
+            Result, bComplete ? FString() : (bCancelled ? TEXT("CANCELLED") : TEXT("IMPORT_INCOMPLETE")));
+        return true;
+    }
+
     // Unknown subAction
     SendAutomationError(RequestingSocket, RequestId, 
         FString::Printf(TEXT("Unknown GAS subAction: %s"), *SubAction), TEXT("UNKNOWN_SUBACTION"));
@@ -15,13 +15,19 @@ DEFINE_LOG_CATEGORY_STATIC(LogMcpGeometryHandlers, Log, All);
 
 #if WITH_EDITOR
 
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
 #include "Components/DynamicMeshComponent.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
 #include "DynamicMeshActor.h"
 #include "DynamicMesh/DynamicMesh3.h"
 #include "DynamicMesh/DynamicMeshAttributeSet.h"
 #include "Engine/StaticMesh.h"
 #include "Engine/StaticMeshActor.h"
 #include "EngineUtils.h"
+#include "Misc/Base64.h"
+#include "Misc/PackageName.h"
+#include "UObject/StrongObjectPtr.h"
 
 // GeometryCore includes for low-level mesh operations (FMeshBoundaryLoops, FEdgeLoop)
 // Required for bridge operations in UE 5.5+
@@ -724,6 +730,138 @@ static bool HandleCreateDisc(UMcpAutomationBridgeSubsystem* Self, const FString&
     return true;
 }
 
+// -------------------------------------------------------------------------
+// Background Geometry Jobs
+// -------------------------------------------------------------------------
+
+static ADynamicMeshActor* FindDynamicMeshActorByLabel(UWorld* World, const FString& Label)
+{
+    if (!World)
+    {
+        return nullptr;
+    }
+    for (TActorIterator<ADynamicMeshActor> It(World); It; ++It)
+    {
+        if (It->GetActorLabel() == Label)
+        {
+            return *It;
+        }
+    }
+    return nullptr;
+}
+
+// Labels of actors whose mesh a background job is rewriting. Game thread
+// only; other geometry subActions on these actors are refused until the job
+// has swapped its result in.
+static TSet<FString> GBusyGeometryActors;
+
+// A heavy operation on a detached copy of an actor's mesh. Work runs on a
+// task-graph worker against WorkingMesh (and ToolMesh, for booleans), which
+// no component listens to; the game thread only copies the mesh in and swaps
+// the result back. The job is released on the game thread.
+struct FGeometryJob
+{
+    // Valid while Work runs: Deinitialize waits for background work.
+    UMcpAutomationBridgeSubsystem* Self = nullptr;
+    FString RequestId;
+    TSharedPtr<FMcpBridgeWebSocket> Socket;
+    FString ActorName;
+    TWeakObjectPtr<ADynamicMeshActor> TargetActor;
+    TStrongObjectPtr<UDynamicMesh> WorkingMesh;
+    TStrongObjectPtr<UDynamicMesh> ToolMesh;
+    FString SuccessMessage;
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+
+    // Worker thread. Returns false with Error/ErrorCode set on failure.
+    TFunction<bool(FGeometryJob&)> Work;
+    // Game thread, once Work succeeded. Defaults to swapping WorkingMesh in.
+    TFunction<void(FGeometryJob&, ADynamicMeshActor*)> Commit;
+
+    bool bSucceeded = false;
+    FString Error;
+    FString ErrorCode;
+
+    // Reports progress from Work; false once the client cancelled, in which
+    // case Work should return early.
+    bool Progress(float Percent, const FString& Message)
+    {
+        if (!Self->SendProgressUpdate(RequestId, Percent, Message))
+        {
+            Error = TEXT("Cancelled by client");
+            ErrorCode = TEXT("CANCELLED");
+            return false;
+        }
+        return true;
+    }
+};
+
+static void FinishGeometryJob(const TSharedRef<FGeometryJob>& Job, const TWeakObjectPtr<UMcpAutomationBridgeSubsystem>& WeakSelf)
+{
+    GBusyGeometryActors.Remove(Job->ActorName);
+    UMcpAutomationBridgeSubsystem* Self = WeakSelf.Get();
+    if (!Self)
+    {
+        return;
+    }
+
+    if (Self->IsAutomationRequestCancelled(Job->RequestId))
+    {
+        Self->SendAutomationError(Job->Socket, Job->RequestId, TEXT("Cancelled by client"), TEXT("CANCELLED"));
+        return;
+    }
+    if (!Job->bSucceeded)
+    {
+        Self->SendAutomationError(Job->Socket, Job->RequestId, Job->Error, Job->ErrorCode);
+        return;
+    }
+
+    ADynamicMeshActor* TargetActor = Job->TargetActor.Get();
+    UDynamicMeshComponent* DMC = TargetActor ? TargetActor->GetDynamicMeshComponent() : nullptr;
+    if (!DMC || !DMC->GetDynamicMesh())
+    {
+        Self->SendAutomationError(Job->Socket, Job->RequestId,
+            FString::Printf(TEXT("Actor was removed while the operation ran: %s"), *Job->ActorName),
+            TEXT("ACTOR_NOT_FOUND"));
+        return;
+    }
+
+    if (Job->Commit)
+    {
+        Job->Commit(*Job, TargetActor);
+    }
+    else
+    {
+        // SetMesh broadcasts one change, which the component turns into a
+        // single proxy rebuild.
+        DMC->GetDynamicMesh()->SetMesh(MoveTemp(Job->WorkingMesh->GetMeshRef()));
+    }
+    AddActorVerification(Job->Result, TargetActor);
+    Self->SendAutomationResponse(Job->Socket, Job->RequestId, true, Job->SuccessMessage, Job->Result);
+}
+
+// Copies SourceMesh into the job and hands Work to a worker. The response is
+// sent from the game thread once the job finishes.
+static void LaunchGeometryJob(const TSharedRef<FGeometryJob>& Job, UDynamicMesh* SourceMesh)
+{
+    Job->WorkingMesh.Reset(GetOrCreateDynamicMesh(GetTransientPackage()));
+    Job->WorkingMesh->SetMesh(SourceMesh->GetMeshRef());
+    GBusyGeometryActors.Add(Job->ActorName);
+
+    TWeakObjectPtr<UMcpAutomationBridgeSubsystem> WeakSelf(Job->Self);
+    Job->Self->LaunchBackgroundWork(
+        [Job = TSharedPtr<FGeometryJob>(Job), WeakSelf]() mutable
+        {
+            Job->bSucceeded = Job->Work(*Job);
+            // Moved so the last reference, and the rooted meshes, are
+            // released on the game thread.
+            AsyncTask(ENamedThreads::GameThread,
+                [Job = MoveTemp(Job), WeakSelf]()
+                {
+                    FinishGeometryJob(Job.ToSharedRef(), WeakSelf);
+                });
+        });
+}
+
 // -------------------------------------------------------------------------
 // Booleans
 // -------------------------------------------------------------------------
@@ -817,74 +955,87 @@ static bool HandleBooleanOperation(UMcpAutomationBridgeSubsystem* Self, const FS
         return true;
     }
 
-    FGeometryScriptMeshBooleanOptions BoolOptions;
-    BoolOptions.bFillHoles = true;
-    BoolOptions.bSimplifyOutput = false;
-
-    // UE 5.7: ApplyMeshBoolean returns UDynamicMesh* directly, no Outcome parameter
-    UDynamicMesh* ResultMesh = UGeometryScriptLibrary_MeshBooleanFunctions::ApplyMeshBoolean(
-        TargetMesh,
-        TargetActor->GetActorTransform(),
-        ToolMesh,
-        ToolActor->GetActorTransform(),
-        BoolOp,
-        BoolOptions,
-        nullptr
-    );
-
-    bool bBooleanSucceeded = (ResultMesh != nullptr);
+    TSharedRef<FGeometryJob> Job = MakeShared<FGeometryJob>();
+    Job->Self = Self;
+    Job->RequestId = RequestId;
+    Job->Socket = Socket;
+    Job->ActorName = TargetActorName;
+    Job->TargetActor = TargetActor;
+    Job->SuccessMessage = FString::Printf(TEXT("Boolean %s completed"), *OpName);
+    Job->ToolMesh.Reset(GetOrCreateDynamicMesh(GetTransientPackage()));
+    Job->ToolMesh->SetMesh(ToolMesh->GetMeshRef());
+    Job->Result->SetStringField(TEXT("targetActor"), TargetActorName);
+    Job->Result->SetStringField(TEXT("operation"), OpName);
+    Job->Result->SetBoolField(TEXT("success"), true);
+    Job->Result->SetNumberField(TEXT("targetTriangles"), TargetTriCount);
+    Job->Result->SetNumberField(TEXT("toolTriangles"), ToolTriCount);
 
-    // Safety: Check result polygon count
-    int32 ResultTriCount = 0;
-    if (ResultMesh)
+    const FTransform TargetTransform = TargetActor->GetActorTransform();
+    const FTransform ToolTransform = ToolActor->GetActorTransform();
+    Job->Work = [TargetTransform, ToolTransform, BoolOp, OpName](FGeometryJob& J)
     {
-        ResultTriCount = ResultMesh->GetTriangleCount();
-        
-        // Check if result exceeds limit
+        if (!J.Progress(0.0f, FString::Printf(TEXT("Boolean %s"), *OpName)))
+        {
+            return false;
+        }
+
+        FGeometryScriptMeshBooleanOptions BoolOptions;
+        BoolOptions.bFillHoles = true;
+        BoolOptions.bSimplifyOutput = false;
+
+        // UE 5.7: ApplyMeshBoolean returns UDynamicMesh* directly, no Outcome parameter
+        UDynamicMesh* ResultMesh = UGeometryScriptLibrary_MeshBooleanFunctions::ApplyMeshBoolean(
+            J.WorkingMesh.Get(),
+            TargetTransform,
+            J.ToolMesh.Get(),
+            ToolTransform,
+            BoolOp,
+            BoolOptions,
+            nullptr
+        );
+        if (!ResultMesh)
+        {
+            // Typically an empty result (e.g. intersection of non-overlapping meshes)
+            UE_LOG(LogMcpGeometryHandlers, Warning,
+                   TEXT("Boolean %s returned null result - operation may have produced empty geometry"), *OpName);
+            J.Error = FString::Printf(TEXT("Boolean %s failed - operation produced empty geometry"), *OpName);
+            J.ErrorCode = TEXT("OPERATION_FAILED");
+            return false;
+        }
+
+        const int32 ResultTriCount = ResultMesh->GetTriangleCount();
         if (ResultTriCount > MAX_TRIANGLES_PER_DYNAMIC_MESH)
         {
             // Log warning but don't fail - the operation already completed
-            UE_LOG(LogMcpGeometryHandlers, Warning, 
-                   TEXT("Boolean %s result has %d triangles (exceeds limit of %d)"), 
+            UE_LOG(LogMcpGeometryHandlers, Warning,
+                   TEXT("Boolean %s result has %d triangles (exceeds limit of %d)"),
                    *OpName, ResultTriCount, MAX_TRIANGLES_PER_DYNAMIC_MESH);
         }
-        
-        // Warning if approaching limit
-        if (ResultTriCount > WARNING_TRIANGLE_THRESHOLD)
+        else if (ResultTriCount > WARNING_TRIANGLE_THRESHOLD)
         {
-            UE_LOG(LogMcpGeometryHandlers, Warning, 
-                   TEXT("Boolean %s result has %d triangles (warning threshold: %d)"), 
+            UE_LOG(LogMcpGeometryHandlers, Warning,
+                   TEXT("Boolean %s result has %d triangles (warning threshold: %d)"),
                    *OpName, ResultTriCount, WARNING_TRIANGLE_THRESHOLD);
         }
-    }
-    else
-    {
-        // Boolean operation returned null - this typically means the operation failed
-        // (e.g., empty result from intersection, non-overlapping meshes)
-        UE_LOG(LogMcpGeometryHandlers, Warning, 
-               TEXT("Boolean %s returned null result - operation may have produced empty geometry"), *OpName);
-    }
+        J.Result->SetNumberField(TEXT("resultTriangles"), ResultTriCount);
+        return true;
+    };
 
-    // Optionally delete tool actor
+    // Optionally delete tool actor once the result is in
     if (!bKeepTool)
     {
-        ToolActor->Destroy();
-    }
-
-    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-    Result->SetStringField(TEXT("targetActor"), TargetActorName);
-    Result->SetStringField(TEXT("operation"), OpName);
-    Result->SetBoolField(TEXT("success"), bBooleanSucceeded);
-    Result->SetNumberField(TEXT("targetTriangles"), TargetTriCount);
-    Result->SetNumberField(TEXT("toolTriangles"), ToolTriCount);
-    if (bBooleanSucceeded)
-    {
-        Result->SetNumberField(TEXT("resultTriangles"), ResultTriCount);
+        TWeakObjectPtr<ADynamicMeshActor> WeakTool(ToolActor);
+        Job->Commit = [WeakTool](FGeometryJob& J, ADynamicMeshActor* Target)
+        {
+            Target->GetDynamicMeshComponent()->GetDynamicMesh()->SetMesh(MoveTemp(J.WorkingMesh->GetMeshRef()));
+            if (ADynamicMeshActor* Tool = WeakTool.Get())
+            {
+                Tool->Destroy();
+            }
+        };
     }
 
-    Self->SendAutomationResponse(Socket, RequestId, bBooleanSucceeded, 
-        bBooleanSucceeded ? FString::Printf(TEXT("Boolean %s completed"), *OpName) : FString::Printf(TEXT("Boolean %s failed - operation produced empty geometry"), *OpName), 
-        Result);
+    LaunchGeometryJob(Job, TargetMesh);
     return true;
 }
 
@@ -1137,36 +1288,48 @@ static bool HandleSimplifyMesh(UMcpAutomationBridgeSubsystem* Self, const FStrin
 
     UDynamicMesh* Mesh = DMC->GetDynamicMesh();
 
-    // UE 5.7: Use FGeometryScriptSimplifyMeshOptions (renamed from FGeometryScriptMeshSimplifyOptions)
-    FGeometryScriptSimplifyMeshOptions SimplifyOptions;
-    SimplifyOptions.Method = EGeometryScriptRemoveMeshSimplificationType::StandardQEM;
-    // Note: bPreserveSharpEdges was removed in UE 5.7
-    SimplifyOptions.bAllowSeamCollapse = true;
-
     // UE 5.7: FGeometryScriptMeshInfo and GetMeshInfo() were removed
     // Use individual query functions instead
     int32 TriCountBefore = Mesh->GetTriangleCount();
 
-    int32 TargetTriCount = FMath::Max(1, FMath::RoundToInt(TriCountBefore * (TargetPercentage / 100.0)));
+    TSharedRef<FGeometryJob> Job = MakeShared<FGeometryJob>();
+    Job->Self = Self;
+    Job->RequestId = RequestId;
+    Job->Socket = Socket;
+    Job->ActorName = ActorName;
+    Job->TargetActor = TargetActor;
+    Job->SuccessMessage = TEXT("Mesh simplified");
+    Job->Result->SetStringField(TEXT("actorName"), ActorName);
+    Job->Result->SetNumberField(TEXT("originalTriangles"), TriCountBefore);
+    Job->Work = [TriCountBefore, TargetPercentage](FGeometryJob& J)
+    {
+        if (!J.Progress(0.0f, TEXT("Simplifying mesh")))
+        {
+            return false;
+        }
 
-    UGeometryScriptLibrary_MeshSimplifyFunctions::ApplySimplifyToTriangleCount(
-        Mesh,
-        TargetTriCount,
-        SimplifyOptions,
-        nullptr
-    );
+        // UE 5.7: Use FGeometryScriptSimplifyMeshOptions (renamed from FGeometryScriptMeshSimplifyOptions)
+        FGeometryScriptSimplifyMeshOptions SimplifyOptions;
+        SimplifyOptions.Method = EGeometryScriptRemoveMeshSimplificationType::StandardQEM;
+        // Note: bPreserveSharpEdges was removed in UE 5.7
+        SimplifyOptions.bAllowSeamCollapse = true;
 
-    int32 TriCountAfter = Mesh->GetTriangleCount();
+        int32 TargetTriCount = FMath::Max(1, FMath::RoundToInt(TriCountBefore * (TargetPercentage / 100.0)));
 
-    DMC->NotifyMeshUpdated();
+        UGeometryScriptLibrary_MeshSimplifyFunctions::ApplySimplifyToTriangleCount(
+            J.WorkingMesh.Get(),
+            TargetTriCount,
+            SimplifyOptions,
+            nullptr
+        );
 
-    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-    Result->SetStringField(TEXT("actorName"), ActorName);
-    Result->SetNumberField(TEXT("originalTriangles"), TriCountBefore);
-    Result->SetNumberField(TEXT("simplifiedTriangles"), TriCountAfter);
-    Result->SetNumberField(TEXT("reductionPercent"), (1.0 - ((double)TriCountAfter / (double)TriCountBefore)) * 100.0);
+        int32 TriCountAfter = J.WorkingMesh->GetTriangleCount();
+        J.Result->SetNumberField(TEXT("simplifiedTriangles"), TriCountAfter);
+        J.Result->SetNumberField(TEXT("reductionPercent"), (1.0 - ((double)TriCountAfter / (double)TriCountBefore)) * 100.0);
+        return true;
+    };
 
-    Self->SendAutomationResponse(Socket, RequestId, true, TEXT("Mesh simplified"), Result);
+    LaunchGeometryJob(Job, Mesh);
     return true;
 }
 
@@ -2621,6 +2784,246 @@ static bool HandleMirror(UMcpAutomationBridgeSubsystem* Self, const FString& Req
     return true;
 }
 
+// -------------------------------------------------------------------------
+// Instanced Array Output
+// -------------------------------------------------------------------------
+
+// outputMode "instances" adds one transform per copy instead of baking mesh
+// copies, so the cap is far above the merged-array limit.
+static constexpr int32 MAX_ARRAY_INSTANCES = 10000;
+static const FName McpArrayInstancesTag(TEXT("McpArrayInstances"));
+
+static bool IsInstancedArrayOutput(const TSharedPtr<FJsonObject>& Payload)
+{
+    return GetStringFieldGeom(Payload, TEXT("outputMode"), TEXT("merge")).Equals(TEXT("instances"), ESearchCase::IgnoreCase);
+}
+
+// Uses the "instanceMesh" asset when given; otherwise snapshots the dynamic
+// mesh into a new StaticMesh asset so earlier arrays keep their own mesh.
+static UStaticMesh* ResolveArrayInstanceMesh(const TSharedPtr<FJsonObject>& Payload, const FString& ActorName,
+                                             UDynamicMesh* SourceMesh, FString& OutPath, FString& OutError)
+{
+    const FString InstanceMesh = GetStringFieldGeom(Payload, TEXT("instanceMesh"));
+    if (!InstanceMesh.IsEmpty())
+    {
+        OutPath = SanitizeProjectRelativePath(InstanceMesh);
+        UStaticMesh* StaticMesh = OutPath.IsEmpty() ? nullptr : LoadObject<UStaticMesh>(nullptr, *OutPath);
+        if (!StaticMesh)
+        {
+            OutError = FString::Printf(TEXT("StaticMesh not found: %s"), *InstanceMesh);
+        }
+        return StaticMesh;
+    }
+
+    const FString BasePath = FString::Printf(TEXT("/Game/GeneratedMeshes/%s_Instance"), *ActorName);
+    OutPath = BasePath;
+    for (int32 Suffix = 1; FPackageName::DoesPackageExist(OutPath) || FindPackage(nullptr, *OutPath); ++Suffix)
+    {
+        OutPath = FString::Printf(TEXT("%s_%d"), *BasePath, Suffix);
+    }
+
+    FGeometryScriptCreateNewStaticMeshAssetOptions CreateOptions;
+    CreateOptions.bEnableRecomputeNormals = false;
+    CreateOptions.bEnableRecomputeTangents = true;
+    CreateOptions.bEnableNanite = false;
+
+    EGeometryScriptOutcomePins Outcome;
+    UStaticMesh* StaticMesh = UGeometryScriptLibrary_CreateNewAssetFunctions::CreateNewStaticMeshAssetFromMesh(
+        SourceMesh, OutPath, CreateOptions, Outcome, nullptr);
+    if (Outcome != EGeometryScriptOutcomePins::Success || !StaticMesh)
+    {
+        OutError = FString::Printf(TEXT("Failed to create instance StaticMesh at %s"), *OutPath);
+        return nullptr;
+    }
+    return StaticMesh;
+}
+
+// Adds an (H)ISM component holding Transforms to Owner, attached to its root.
+// Relative transforms are in the root's space, matching the merged array.
+static UInstancedStaticMeshComponent* AddArrayInstanceComponent(AActor* Owner, UStaticMesh* StaticMesh,
+                                                                UMeshComponent* MaterialSource,
+                                                                const TArray<FTransform>& Transforms,
+                                                                bool bWorldSpace, bool bHierarchical)
+{
+    USceneComponent* Root = Owner->GetRootComponent();
+    UClass* ComponentClass = bHierarchical
+        ? UHierarchicalInstancedStaticMeshComponent::StaticClass()
+        : UInstancedStaticMeshComponent::StaticClass();
+
+    Owner->Modify();
+    UInstancedStaticMeshComponent* Instances = NewObject<UInstancedStaticMeshComponent>(
+        Owner, ComponentClass, MakeUniqueObjectName(Owner, ComponentClass, TEXT("ArrayInstances")), RF_Transactional);
+    Instances->ComponentTags.Add(McpArrayInstancesTag);
+    Instances->SetStaticMesh(StaticMesh);
+    if (Root)
+    {
+        Instances->SetMobility(Root->Mobility);
+        Instances->SetupAttachment(Root);
+    }
+    if (MaterialSource)
+    {
+        for (int32 Slot = 0; Slot < MaterialSource->GetNumMaterials(); ++Slot)
+        {
+            Instances->SetMaterial(Slot, MaterialSource->GetMaterial(Slot));
+        }
+    }
+    Owner->AddInstanceComponent(Instances);
+    Instances->RegisterComponent();
+    Instances->AddInstances(Transforms, false, bWorldSpace);
+    return Instances;
+}
+
+// Validates the instance count, creates the instance mesh and component and
+// sends the response shared by array_linear, array_radial and
+// duplicate_along_spline.
+static bool SendArrayAsInstances(UMcpAutomationBridgeSubsystem* Self, const FString& RequestId,
+                                 const TSharedPtr<FJsonObject>& Payload, TSharedPtr<FMcpBridgeWebSocket> Socket,
+                                 ADynamicMeshActor* TargetActor, const FString& ActorName,
+                                 const TArray<FTransform>& Transforms, bool bWorldSpace, const FString& Message)
+{
+    UDynamicMeshComponent* DMC = TargetActor->GetDynamicMeshComponent();
+    FString MeshPath;
+    FString Error;
+    UStaticMesh* StaticMesh = ResolveArrayInstanceMesh(Payload, ActorName, DMC->GetDynamicMesh(), MeshPath, Error);
+    if (!StaticMesh)
+    {
+        Self->SendAutomationError(Socket, RequestId, Error, TEXT("ASSET_CREATION_FAILED"));
+        return true;
+    }
+
+    const bool bHierarchical = GetBoolFieldGeom(Payload, TEXT("hierarchical"), true);
+    UInstancedStaticMeshComponent* Instances =
+        AddArrayInstanceComponent(TargetActor, StaticMesh, DMC, Transforms, bWorldSpace, bHierarchical);
+
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetStringField(TEXT("actorName"), ActorName);
+    Result->SetStringField(TEXT("outputMode"), TEXT("instances"));
+    Result->SetStringField(TEXT("instanceComponent"), Instances->GetName());
+    Result->SetStringField(TEXT("instanceMesh"), MeshPath);
+    Result->SetBoolField(TEXT("hierarchical"), bHierarchical);
+    Result->SetNumberField(TEXT("instanceCount"), Instances->GetInstanceCount());
+    AddActorVerification(Result, TargetActor);
+    Self->SendAutomationResponse(Socket, RequestId, true, Message, Result);
+    return true;
+}
+
+// bake_instances: appends the instances added by outputMode "instances" (or
+// the named component) into the actor's dynamic mesh and removes them.
+static bool HandleBakeInstances(UMcpAutomationBridgeSubsystem* Self, const FString& RequestId,
+                                const TSharedPtr<FJsonObject>& Payload, TSharedPtr<FMcpBridgeWebSocket> Socket)
+{
+    FString ActorName = GetStringFieldGeom(Payload, TEXT("actorName"));
+    FString ComponentName = GetStringFieldGeom(Payload, TEXT("componentName"));
+
+    if (ActorName.IsEmpty())
+    {
+        Self->SendAutomationError(Socket, RequestId, TEXT("actorName required"), TEXT("INVALID_ARGUMENT"));
+        return true;
+    }
+
+    UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+    ADynamicMeshActor* TargetActor = FindDynamicMeshActorByLabel(World, ActorName);
+    if (!TargetActor)
+    {
+        Self->SendAutomationError(Socket, RequestId, FString::Printf(TEXT("Actor not found: %s"), *ActorName), TEXT("ACTOR_NOT_FOUND"));
+        return true;
+    }
+
+    UDynamicMeshComponent* DMC = TargetActor->GetDynamicMeshComponent();
+    if (!DMC || !DMC->GetDynamicMesh())
+    {
+        Self->SendAutomationError(Socket, RequestId, TEXT("DynamicMesh not available"), TEXT("MESH_NOT_FOUND"));
+        return true;
+    }
+
+    TInlineComponentArray<UInstancedStaticMeshComponent*> Candidates(TargetActor);
+    TArray<UInstancedStaticMeshComponent*> ToBake;
+    int64 EstimatedTriangles = DMC->GetDynamicMesh()->GetTriangleCount();
+    for (UInstancedStaticMeshComponent* Candidate : Candidates)
+    {
+        const bool bMatches = ComponentName.IsEmpty()
+            ? Candidate->ComponentHasTag(McpArrayInstancesTag)
+            : Candidate->GetName() == ComponentName;
+        if (bMatches && Candidate->GetStaticMesh())
+        {
+            ToBake.Add(Candidate);
+            EstimatedTriangles += static_cast<int64>(Candidate->GetStaticMesh()->GetNumTriangles(0)) * Candidate->GetInstanceCount();
+        }
+    }
+    if (ToBake.Num() == 0)
+    {
+        Self->SendAutomationError(Socket, RequestId, FString::Printf(TEXT("No array instances to bake on %s"), *ActorName), TEXT("NO_INSTANCES"));
+        return true;
+    }
+
+    if (!IsMemoryPressureSafe())
+    {
+        Self->SendAutomationError(Socket, RequestId,
+            FString::Printf(TEXT("Memory pressure too high (%.1f%% used). Bake blocked to prevent OOM."),
+                           GetMemoryUsagePercent()),
+            TEXT("MEMORY_PRESSURE"));
+        return true;
+    }
+    if (EstimatedTriangles > MAX_TRIANGLES_PER_DYNAMIC_MESH)
+    {
+        Self->SendAutomationError(Socket, RequestId,
+            FString::Printf(TEXT("Bake would exceed triangle limit. Estimated: %lld, Max: %d"),
+                           EstimatedTriangles, MAX_TRIANGLES_PER_DYNAMIC_MESH),
+            TEXT("POLYGON_LIMIT_EXCEEDED"));
+        return true;
+    }
+
+    UDynamicMesh* Mesh = DMC->GetDynamicMesh();
+    const FTransform MeshToWorld = DMC->GetComponentTransform();
+    int32 InstancesBaked = 0;
+    TArray<TSharedPtr<FJsonValue>> Baked;
+    for (UInstancedStaticMeshComponent* Instances : ToBake)
+    {
+        UDynamicMesh* SourceMesh = NewObject<UDynamicMesh>(GetTransientPackage());
+        FGeometryScriptCopyMeshFromAssetOptions CopyOptions;
+        FGeometryScriptMeshReadLOD ReadLOD;
+        EGeometryScriptOutcomePins Outcome;
+        UGeometryScriptLibrary_StaticMeshFunctions::CopyMeshFromStaticMesh(
+            Instances->GetStaticMesh(), SourceMesh, CopyOptions, ReadLOD, Outcome, nullptr);
+        if (Outcome != EGeometryScriptOutcomePins::Success)
+        {
+            Self->SendAutomationError(Socket, RequestId,
+                FString::Printf(TEXT("Failed to read %s"), *Instances->GetStaticMesh()->GetPathName()), TEXT("CONVERSION_FAILED"));
+            return true;
+        }
+
+        TArray<FTransform> Transforms;
+        Transforms.SetNum(Instances->GetInstanceCount());
+        ParallelFor(Transforms.Num(), [Instances, &Transforms, &MeshToWorld](int32 Index)
+        {
+            FTransform InstanceToWorld;
+            Instances->GetInstanceTransform(Index, InstanceToWorld, true);
+            Transforms[Index] = InstanceToWorld.GetRelativeTransform(MeshToWorld);
+        });
+
+        FGeometryScriptAppendMeshOptions AppendOptions;
+        UGeometryScriptLibrary_MeshBasicEditFunctions::AppendMeshTransformed(
+            Mesh, SourceMesh, Transforms, FTransform::Identity, true, false, AppendOptions, nullptr);
+
+        InstancesBaked += Transforms.Num();
+        Baked.Add(MakeShared<FJsonValueString>(Instances->GetName()));
+        TargetActor->Modify();
+        TargetActor->RemoveInstanceComponent(Instances);
+        Instances->DestroyComponent();
+    }
+
+    DMC->NotifyMeshUpdated();
+
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetStringField(TEXT("actorName"), ActorName);
+    Result->SetArrayField(TEXT("components"), Baked);
+    Result->SetNumberField(TEXT("instancesBaked"), InstancesBaked);
+    Result->SetNumberField(TEXT("triangles"), Mesh->GetTriangleCount());
+    AddActorVerification(Result, TargetActor);
+    Self->SendAutomationResponse(Socket, RequestId, true, TEXT("Instances baked into mesh"), Result);
+    return true;
+}
+
 static bool HandleArrayLinear(UMcpAutomationBridgeSubsystem* Self, const FString& RequestId,
                               const TSharedPtr<FJsonObject>& Payload, TSharedPtr<FMcpBridgeWebSocket> Socket)
 {
@@ -2634,9 +3037,11 @@ static bool HandleArrayLinear(UMcpAutomationBridgeSubsystem* Self, const FString
         return true;
     }
 
-    if (Count < 1 || Count > 100)
+    const bool bInstanced = IsInstancedArrayOutput(Payload);
+    const int32 MaxCount = bInstanced ? MAX_ARRAY_INSTANCES : 100;
+    if (Count < 1 || Count > MaxCount)
     {
-        Self->SendAutomationError(Socket, RequestId, TEXT("count must be between 1 and 100"), TEXT("INVALID_ARGUMENT"));
+        Self->SendAutomationError(Socket, RequestId, FString::Printf(TEXT("count must be between 1 and %d"), MaxCount), TEXT("INVALID_ARGUMENT"));
         return true;
     }
 
@@ -2677,6 +3082,19 @@ static bool HandleArrayLinear(UMcpAutomationBridgeSubsystem* Self, const FString
         return true;
     }
 
+    if (bInstanced)
+    {
+        // Copies 1..Count-1; the original mesh stays as copy 0.
+        TArray<FTransform> Transforms;
+        Transforms.SetNum(Count - 1);
+        ParallelFor(Transforms.Num(), [&Transforms, Offset](int32 Index)
+        {
+            Transforms[Index] = FTransform(Offset * (Index + 1));
+        });
+        return SendArrayAsInstances(Self, RequestId, Payload, Socket, TargetActor, ActorName, Transforms, false,
+                                    TEXT("Linear array instanced"));
+    }
+
     // Safety: Estimate triangles after array and check against limit
     int32 TriCountBefore = Mesh->GetTriangleCount();
     int64 EstimatedTriangles = static_cast<int64>(TriCountBefore) * Count;
@@ -2726,9 +3144,11 @@ static bool HandleArrayRadial(UMcpAutomationBridgeSubsystem* Self, const FString
         return true;
     }
 
-    if (Count < 1 || Count > 100)
+    const bool bInstanced = IsInstancedArrayOutput(Payload);
+    const int32 MaxCount = bInstanced ? MAX_ARRAY_INSTANCES : 100;
+    if (Count < 1 || Count > MaxCount)
     {
-        Self->SendAutomationError(Socket, RequestId, TEXT("count must be between 1 and 100"), TEXT("INVALID_ARGUMENT"));
+        Self->SendAutomationError(Socket, RequestId, FString::Printf(TEXT("count must be between 1 and %d"), MaxCount), TEXT("INVALID_ARGUMENT"));
         return true;
     }
 
@@ -2769,6 +3189,32 @@ static bool HandleArrayRadial(UMcpAutomationBridgeSubsystem* Self, const FString
         return true;
     }
 
+    // Calculate rotation per step
+    double AngleStep = TotalAngle / Count;
+    FVector RotationAxis = FVector::UpVector;
+    if (Axis == TEXT("X")) RotationAxis = FVector::ForwardVector;
+    else if (Axis == TEXT("Y")) RotationAxis = FVector::RightVector;
+
+    // Build transforms array; copy 0 is the original, so slot i holds copy i + 1
+    TArray<FTransform> Transforms;
+    Transforms.SetNum(Count - 1);
+    ParallelFor(Transforms.Num(), [&Transforms, AngleStep, RotationAxis, Center](int32 Index)
+    {
+        double Angle = AngleStep * (Index + 1);
+        FQuat Rotation = FQuat(RotationAxis, FMath::DegreesToRadians(Angle));
+        FTransform Transform;
+        Transform.SetRotation(Rotation);
+        // Rotate around center point
+        Transform.SetLocation(Center + Rotation.RotateVector(-Center));
+        Transforms[Index] = Transform;
+    });
+
+    if (bInstanced)
+    {
+        return SendArrayAsInstances(Self, RequestId, Payload, Socket, TargetActor, ActorName, Transforms, false,
+                                    TEXT("Radial array instanced"));
+    }
+
     // Safety: Estimate triangles after array and check against limit
     int32 TriCountBefore = Mesh->GetTriangleCount();
     int64 EstimatedTriangles = static_cast<int64>(TriCountBefore) * Count;
@@ -2786,25 +3232,6 @@ static bool HandleArrayRadial(UMcpAutomationBridgeSubsystem* Self, const FString
     UDynamicMesh* SourceMesh = NewObject<UDynamicMesh>(GetTransientPackage());
     SourceMesh->SetMesh(Mesh->GetMeshRef());
 
-    // Calculate rotation per step
-    double AngleStep = TotalAngle / Count;
-    FVector RotationAxis = FVector::UpVector;
-    if (Axis == TEXT("X")) RotationAxis = FVector::ForwardVector;
-    else if (Axis == TEXT("Y")) RotationAxis = FVector::RightVector;
-
-    // Build transforms array
-    TArray<FTransform> Transforms;
-    for (int32 i = 1; i < Count; ++i)  // Start from 1 (original is at 0)
-    {
-        double Angle = AngleStep * i;
-        FQuat Rotation = FQuat(RotationAxis, FMath::DegreesToRadians(Angle));
-        FTransform Transform;
-        Transform.SetRotation(Rotation);
-        // Rotate around center point
-        Transform.SetLocation(Center + Rotation.RotateVector(-Center));
-        Transforms.Add(Transform);
-    }
-
     FGeometryScriptAppendMeshOptions AppendOptions;
     UGeometryScriptLibrary_MeshBasicEditFunctions::AppendMeshTransformed(
         Mesh, SourceMesh, Transforms, FTransform::Identity, true, false, AppendOptions, nullptr);
@@ -4847,20 +5274,58 @@ int32 Count = GetIntFieldGeom(Payload, TEXT("count"), 10);
         return true;
     }
 
-    // Create duplicates along spline
     float SplineLength = SplineComp->GetSplineLength();
-    TArray<FString> CreatedActors;
-    
-    UEditorActorSubsystem* ActorSS = GEditor->GetEditorSubsystem<UEditorActorSubsystem>();
-    if (!ActorSS)
-    {
-        Self->SendAutomationError(Socket, RequestId, TEXT("EditorActorSubsystem unavailable"), TEXT("EDITOR_SUBSYSTEM_MISSING"));
-        return true;
-    }
 
-    for (int32 i = 0; i < Count; ++i)
+    if (IsInstancedArrayOutput(Payload))
     {
-        float Distance = SplineLength * ((float)i / FMath::Max(Count - 1, 1));
+        if (Count < 1 || Count > MAX_ARRAY_INSTANCES)
+        {
+            Self->SendAutomationError(Socket, RequestId,
+                FString::Printf(TEXT("count must be between 1 and %d"), MAX_ARRAY_INSTANCES), TEXT("INVALID_ARGUMENT"));
+            return true;
+        }
+        UDynamicMeshComponent* DMC = SourceActor->GetDynamicMeshComponent();
+        if (!DMC || !DMC->GetDynamicMesh())
+        {
+            Self->SendAutomationError(Socket, RequestId, TEXT("DynamicMesh not available"), TEXT("MESH_NOT_FOUND"));
+            return true;
+        }
+
+        // World-space instances on the source actor; each index seeds its own
+        // stream so the scale variation does not depend on thread order.
+        const int32 Seed = GetIntFieldGeom(Payload, TEXT("seed"), 0);
+        TArray<FTransform> Transforms;
+        Transforms.SetNum(Count);
+        ParallelFor(Count, [&Transforms, SplineComp, SplineLength, Count, bAlignToSpline, ScaleVariation, Seed](int32 Index)
+        {
+            float Distance = SplineLength * ((float)Index / FMath::Max(Count - 1, 1));
+            FVector Location = SplineComp->GetLocationAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World);
+            FRotator Rotation = bAlignToSpline ? SplineComp->GetRotationAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World) : FRotator::ZeroRotator;
+            double ScaleFactor = 1.0;
+            if (ScaleVariation > 0.0)
+            {
+                FRandomStream Stream(Seed + Index);
+                ScaleFactor = 1.0 + Stream.FRandRange(-ScaleVariation, ScaleVariation);
+            }
+            Transforms[Index] = FTransform(Rotation, Location, FVector(ScaleFactor));
+        });
+        return SendArrayAsInstances(Self, RequestId, Payload, Socket, SourceActor, ActorName, Transforms, true,
+                                    TEXT("Instances created along spline"));
+    }
+
+    // Create duplicates along spline
+    TArray<FString> CreatedActors;
+    
+    UEditorActorSubsystem* ActorSS = GEditor->GetEditorSubsystem<UEditorActorSubsystem>();
+    if (!ActorSS)
+    {
+        Self->SendAutomationError(Socket, RequestId, TEXT("EditorActorSubsystem unavailable"), TEXT("EDITOR_SUBSYSTEM_MISSING"));
+        return true;
+    }
+
+    for (int32 i = 0; i < Count; ++i)
+    {
+        float Distance = SplineLength * ((float)i / FMath::Max(Count - 1, 1));
         FVector Location = SplineComp->GetLocationAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World);
         FRotator Rotation = bAlignToSpline ? SplineComp->GetRotationAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World) : FRotator::ZeroRotator;
 
@@ -5794,6 +6259,442 @@ static bool HandleSetVertexPosition(UMcpAutomationBridgeSubsystem* Self, const F
     return true;
 }
 
+// -------------------------------------------------------------------------
+// get_mesh_buffers / set_mesh_buffers - Whole-buffer vertex attribute access
+// -------------------------------------------------------------------------
+
+// Per-vertex buffers, indexed by vertex ID from "start". Values are packed
+// little-endian 32-bit floats (triangles: int32), matching the FMcpPackedArray
+// wire form. uvs and colors map every overlay element to its parent vertex,
+// so a write gives all elements of a vertex (both sides of a seam) one value.
+struct FMeshBufferSpec
+{
+    const TCHAR* Name;
+    const TCHAR* Layout;
+    int32 Components;
+};
+
+static const FMeshBufferSpec MeshBufferSpecs[] = {
+    {TEXT("positions"), TEXT("f32x3"), 3},
+    {TEXT("normals"), TEXT("f32x3"), 3},
+    {TEXT("uvs"), TEXT("f32x2"), 2},
+    {TEXT("colors"), TEXT("f32x4"), 4},
+    // Read only; indexed by triangle ID over the whole mesh.
+    {TEXT("triangles"), TEXT("i32x3"), 3},
+};
+
+static const FMeshBufferSpec* FindMeshBufferSpec(const FString& Name)
+{
+    for (const FMeshBufferSpec& Spec : MeshBufferSpecs)
+    {
+        if (Name.Equals(Spec.Name, ESearchCase::IgnoreCase))
+        {
+            return &Spec;
+        }
+    }
+    return nullptr;
+}
+
+// Reads an overlay as one value per vertex in [Start, Start + Count).
+template <typename OverlayType>
+static void ReadOverlayPerVertex(const OverlayType* Overlay, int32 Start, int32 Count, int32 Components, float* Out)
+{
+    for (int32 ElementID : Overlay->ElementIndicesItr())
+    {
+        const int32 Local = Overlay->GetParentVertex(ElementID) - Start;
+        if (Local >= 0 && Local < Count)
+        {
+            Overlay->GetElement(ElementID, Out + Local * Components);
+        }
+    }
+}
+
+// Writes one value per vertex in [Start, Start + Count) to every overlay
+// element of that vertex. Elements are distinct, so the copy runs in parallel.
+template <typename OverlayType>
+static void WriteOverlayPerVertex(OverlayType* Overlay, int32 Start, int32 Count, int32 Components, const float* In)
+{
+    ParallelFor(Overlay->MaxElementID(), [Overlay, Start, Count, Components, In](int32 ElementID)
+    {
+        if (!Overlay->IsElement(ElementID))
+        {
+            return;
+        }
+        const int32 Local = Overlay->GetParentVertex(ElementID) - Start;
+        if (Local >= 0 && Local < Count)
+        {
+            Overlay->SetElement(ElementID, In + Local * Components);
+        }
+    });
+}
+
+// Gives an overlay with no elements one element per vertex, shared by every
+// triangle around it, so per-vertex writes have somewhere to land.
+template <typename OverlayType>
+static void SeedOverlayPerVertex(const UE::Geometry::FDynamicMesh3& EditMesh, OverlayType* Overlay, const float* Default)
+{
+    TArray<int32> ElementForVertex;
+    ElementForVertex.Init(UE::Geometry::FDynamicMesh3::InvalidID, EditMesh.MaxVertexID());
+    for (int32 VID : EditMesh.VertexIndicesItr())
+    {
+        ElementForVertex[VID] = Overlay->AppendElement(Default);
+    }
+    for (int32 TID : EditMesh.TriangleIndicesItr())
+    {
+        const UE::Geometry::FIndex3i Tri = EditMesh.GetTriangle(TID);
+        Overlay->SetTriangle(TID, UE::Geometry::FIndex3i(ElementForVertex[Tri.A], ElementForVertex[Tri.B], ElementForVertex[Tri.C]));
+    }
+}
+
+static ADynamicMeshActor* FindBufferTargetActor(UMcpAutomationBridgeSubsystem* Self, const FString& RequestId,
+                                                TSharedPtr<FMcpBridgeWebSocket> Socket, const FString& ActorName)
+{
+    if (ActorName.IsEmpty())
+    {
+        Self->SendAutomationError(Socket, RequestId, TEXT("actorName required"), TEXT("INVALID_ARGUMENT"));
+        return nullptr;
+    }
+    UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+    ADynamicMeshActor* TargetActor = FindDynamicMeshActorByLabel(World, ActorName);
+    if (!TargetActor)
+    {
+        Self->SendAutomationError(Socket, RequestId, FString::Printf(TEXT("Actor not found: %s"), *ActorName), TEXT("ACTOR_NOT_FOUND"));
+        return nullptr;
+    }
+    UDynamicMeshComponent* DMC = TargetActor->GetDynamicMeshComponent();
+    if (!DMC || !DMC->GetDynamicMesh())
+    {
+        Self->SendAutomationError(Socket, RequestId, TEXT("DynamicMesh not available"), TEXT("MESH_NOT_FOUND"));
+        return nullptr;
+    }
+    return TargetActor;
+}
+
+static bool HandleGetMeshBuffers(UMcpAutomationBridgeSubsystem* Self, const FString& RequestId,
+                                 const TSharedPtr<FJsonObject>& Payload, TSharedPtr<FMcpBridgeWebSocket> Socket)
+{
+    FString ActorName = GetStringFieldGeom(Payload, TEXT("actorName"));
+    int32 Start = FMath::Max(0, GetIntFieldGeom(Payload, TEXT("start"), 0));
+    int32 RequestedCount = GetIntFieldGeom(Payload, TEXT("count"), -1);
+    int32 UVChannel = GetIntFieldGeom(Payload, TEXT("uvChannel"), 0);
+
+    TArray<FString> BufferNames;
+    const TArray<TSharedPtr<FJsonValue>>* BuffersField = nullptr;
+    if (Payload->TryGetArrayField(TEXT("buffers"), BuffersField) && BuffersField)
+    {
+        for (const TSharedPtr<FJsonValue>& Value : *BuffersField)
+        {
+            FString Name;
+            if (Value.IsValid() && Value->TryGetString(Name))
+            {
+                BufferNames.AddUnique(Name.ToLower());
+            }
+        }
+    }
+    if (BufferNames.Num() == 0)
+    {
+        BufferNames.Add(TEXT("positions"));
+    }
+    // Validated up front so no attachment is left behind by a failed request.
+    for (const FString& Name : BufferNames)
+    {
+        if (!FindMeshBufferSpec(Name))
+        {
+            Self->SendAutomationError(Socket, RequestId, FString::Printf(TEXT("Unknown buffer: %s"), *Name), TEXT("INVALID_ARGUMENT"));
+            return true;
+        }
+    }
+
+    ADynamicMeshActor* TargetActor = FindBufferTargetActor(Self, RequestId, Socket, ActorName);
+    if (!TargetActor)
+    {
+        return true;
+    }
+    const UE::Geometry::FDynamicMesh3& ReadMesh = TargetActor->GetDynamicMeshComponent()->GetDynamicMesh()->GetMeshRef();
+    const UE::Geometry::FDynamicMeshAttributeSet* Attributes = ReadMesh.Attributes();
+
+    const int32 MaxVertexID = ReadMesh.MaxVertexID();
+    Start = FMath::Min(Start, MaxVertexID);
+    const int32 Count = RequestedCount < 0 ? MaxVertexID - Start : FMath::Min(RequestedCount, MaxVertexID - Start);
+
+    if (BufferNames.Contains(TEXT("normals")) && !ReadMesh.HasVertexNormals() && !(Attributes && Attributes->PrimaryNormals()))
+    {
+        Self->SendAutomationError(Socket, RequestId, TEXT("Mesh has no normals"), TEXT("NO_NORMALS"));
+        return true;
+    }
+    if (BufferNames.Contains(TEXT("uvs")) && (!Attributes || UVChannel < 0 || UVChannel >= Attributes->NumUVLayers()))
+    {
+        Self->SendAutomationError(Socket, RequestId, FString::Printf(TEXT("No UV layer %d"), UVChannel), TEXT("UV_LAYER_ERROR"));
+        return true;
+    }
+    if (BufferNames.Contains(TEXT("colors")) && !(Attributes && Attributes->PrimaryColors()))
+    {
+        Self->SendAutomationError(Socket, RequestId, TEXT("Mesh has no vertex colors"), TEXT("NO_COLORS"));
+        return true;
+    }
+
+    TSharedPtr<FJsonObject> Buffers = MakeShared<FJsonObject>();
+    for (const FString& Name : BufferNames)
+    {
+        const FMeshBufferSpec* Spec = FindMeshBufferSpec(Name);
+        const bool bTriangles = Name == TEXT("triangles");
+        const int32 ElementCount = bTriangles ? ReadMesh.MaxTriangleID() : Count;
+
+        TArray<uint8> Bytes;
+        Bytes.SetNumZeroed(ElementCount * Spec->Components * sizeof(float));
+        float* Out = reinterpret_cast<float*>(Bytes.GetData());
+
+        if (Name == TEXT("positions"))
+        {
+            ParallelFor(Count, [&ReadMesh, Start, Out](int32 Index)
+            {
+                if (ReadMesh.IsVertex(Start + Index))
+                {
+                    const FVector3d P = ReadMesh.GetVertex(Start + Index);
+                    Out[Index * 3 + 0] = static_cast<float>(P.X);
+                    Out[Index * 3 + 1] = static_cast<float>(P.Y);
+                    Out[Index * 3 + 2] = static_cast<float>(P.Z);
+                }
+            });
+        }
+        else if (Name == TEXT("normals"))
+        {
+            if (ReadMesh.HasVertexNormals())
+            {
+                ParallelFor(Count, [&ReadMesh, Start, Out](int32 Index)
+                {
+                    if (ReadMesh.IsVertex(Start + Index))
+                    {
+                        const FVector3f N = ReadMesh.GetVertexNormal(Start + Index);
+                        Out[Index * 3 + 0] = N.X;
+                        Out[Index * 3 + 1] = N.Y;
+                        Out[Index * 3 + 2] = N.Z;
+                    }
+                });
+            }
+            else
+            {
+                ReadOverlayPerVertex(Attributes->PrimaryNormals(), Start, Count, 3, Out);
+            }
+        }
+        else if (Name == TEXT("uvs"))
+        {
+            ReadOverlayPerVertex(Attributes->GetUVLayer(UVChannel), Start, Count, 2, Out);
+        }
+        else if (Name == TEXT("colors"))
+        {
+            ReadOverlayPerVertex(Attributes->PrimaryColors(), Start, Count, 4, Out);
+        }
+        else
+        {
+            // Removed triangle IDs read as -1 -1 -1.
+            int32* OutIndices = reinterpret_cast<int32*>(Out);
+            ParallelFor(ElementCount, [&ReadMesh, OutIndices](int32 TID)
+            {
+                const UE::Geometry::FIndex3i Tri = ReadMesh.IsTriangle(TID)
+                    ? ReadMesh.GetTriangle(TID)
+                    : UE::Geometry::FIndex3i::Invalid();
+                OutIndices[TID * 3 + 0] = Tri.A;
+                OutIndices[TID * 3 + 1] = Tri.B;
+                OutIndices[TID * 3 + 2] = Tri.C;
+            });
+        }
+
+        const FString Field = Name + TEXT("Data");
+        TSharedPtr<FJsonObject> Descriptor = MakeShared<FJsonObject>();
+        Descriptor->SetStringField(TEXT("layout"), Spec->Layout);
+        Descriptor->SetNumberField(TEXT("start"), bTriangles ? 0 : Start);
+        Descriptor->SetNumberField(TEXT("count"), ElementCount);
+        Descriptor->SetStringField(TEXT("field"), Field);
+        Descriptor->SetStringField(TEXT("attachmentId"),
+            Self->AttachBinaryPayload(RequestId, MoveTemp(Bytes), TEXT("application/octet-stream"), Field));
+        Buffers->SetObjectField(Name, Descriptor);
+    }
+
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetStringField(TEXT("actorName"), ActorName);
+    Result->SetNumberField(TEXT("vertexCount"), ReadMesh.VertexCount());
+    Result->SetNumberField(TEXT("maxVertexId"), MaxVertexID);
+    Result->SetBoolField(TEXT("isCompact"), ReadMesh.IsCompactV());
+    Result->SetObjectField(TEXT("buffers"), Buffers);
+    Self->SendAutomationResponse(Socket, RequestId, true, TEXT("Mesh buffers retrieved"), Result);
+    return true;
+}
+
+static bool HandleSetMeshBuffers(UMcpAutomationBridgeSubsystem* Self, const FString& RequestId,
+                                 const TSharedPtr<FJsonObject>& Payload, TSharedPtr<FMcpBridgeWebSocket> Socket)
+{
+    FString ActorName = GetStringFieldGeom(Payload, TEXT("actorName"));
+    int32 Start = FMath::Max(0, GetIntFieldGeom(Payload, TEXT("start"), 0));
+    int32 UVChannel = GetIntFieldGeom(Payload, TEXT("uvChannel"), 0);
+
+    const TSharedPtr<FJsonObject>* BufferData = nullptr;
+    if (!Payload->TryGetObjectField(TEXT("bufferData"), BufferData) || !BufferData || (*BufferData)->Values.Num() == 0)
+    {
+        Self->SendAutomationError(Socket, RequestId, TEXT("bufferData object required"), TEXT("INVALID_ARGUMENT"));
+        return true;
+    }
+
+    if (UVChannel < 0 || UVChannel >= MAX_STATIC_TEXCOORDS)
+    {
+        Self->SendAutomationError(Socket, RequestId, FString::Printf(TEXT("Invalid uvChannel: %d"), UVChannel), TEXT("UV_LAYER_ERROR"));
+        return true;
+    }
+
+    ADynamicMeshActor* TargetActor = FindBufferTargetActor(Self, RequestId, Socket, ActorName);
+    if (!TargetActor)
+    {
+        return true;
+    }
+    UDynamicMeshComponent* DMC = TargetActor->GetDynamicMeshComponent();
+    UE::Geometry::FDynamicMesh3& EditMesh = DMC->GetDynamicMesh()->GetMeshRef();
+    const int32 MaxVertexID = EditMesh.MaxVertexID();
+
+    // Decode and validate everything before touching the mesh.
+    TMap<FString, TArray<uint8>> Decoded;
+    int32 Count = -1;
+    for (const TPair<FString, TSharedPtr<FJsonValue>>& Entry : (*BufferData)->Values)
+    {
+        const FString Name = Entry.Key.ToLower();
+        const FMeshBufferSpec* Spec = FindMeshBufferSpec(Name);
+        if (!Spec || Name == TEXT("triangles"))
+        {
+            Self->SendAutomationError(Socket, RequestId, FString::Printf(TEXT("Buffer cannot be written: %s"), *Entry.Key), TEXT("INVALID_ARGUMENT"));
+            return true;
+        }
+        const TSharedPtr<FJsonObject>* Packed = nullptr;
+        FString Data;
+        if (!Entry.Value.IsValid() || !Entry.Value->TryGetObject(Packed) || !Packed ||
+            !(*Packed)->TryGetStringField(TEXT("data"), Data))
+        {
+            Self->SendAutomationError(Socket, RequestId,
+                FString::Printf(TEXT("%s must be a packed array: { encoding: \"base64\", layout, count, data }"), *Entry.Key),
+                TEXT("INVALID_ARGUMENT"));
+            return true;
+        }
+        FString Layout;
+        if ((*Packed)->TryGetStringField(TEXT("layout"), Layout) && !Layout.Equals(Spec->Layout, ESearchCase::IgnoreCase))
+        {
+            Self->SendAutomationError(Socket, RequestId,
+                FString::Printf(TEXT("%s layout must be %s (got %s)"), *Entry.Key, Spec->Layout, *Layout),
+                TEXT("INVALID_ARGUMENT"));
+            return true;
+        }
+        TArray<uint8>& Bytes = Decoded.Add(Name);
+        const int32 Stride = Spec->Components * sizeof(float);
+        if (!FBase64::Decode(Data, Bytes) || Bytes.Num() % Stride != 0)
+        {
+            Self->SendAutomationError(Socket, RequestId,
+                FString::Printf(TEXT("%s data is not a whole number of %s elements"), *Entry.Key, Spec->Layout),
+                TEXT("INVALID_ARGUMENT"));
+            return true;
+        }
+        const int32 BufferCount = Bytes.Num() / Stride;
+        if ((Count >= 0 && BufferCount != Count) || Start + BufferCount > MaxVertexID)
+        {
+            Self->SendAutomationError(Socket, RequestId,
+                FString::Printf(TEXT("%s has %d elements; buffers must share one count within maxVertexId %d"),
+                                *Entry.Key, BufferCount, MaxVertexID),
+                TEXT("INVALID_ARGUMENT"));
+            return true;
+        }
+        Count = BufferCount;
+    }
+
+    if (const TArray<uint8>* Bytes = Decoded.Find(TEXT("positions")))
+    {
+        const float* In = reinterpret_cast<const float*>(Bytes->GetData());
+        // Writes distinct vertices; change tracking is skipped per vertex and
+        // the component is notified once below.
+        ParallelFor(Count, [&EditMesh, Start, In](int32 Index)
+        {
+            if (EditMesh.IsVertex(Start + Index))
+            {
+                EditMesh.SetVertex(Start + Index, FVector3d(In[Index * 3 + 0], In[Index * 3 + 1], In[Index * 3 + 2]), false);
+            }
+        });
+    }
+
+    if (const TArray<uint8>* Bytes = Decoded.Find(TEXT("normals")))
+    {
+        const float* In = reinterpret_cast<const float*>(Bytes->GetData());
+        UE::Geometry::FDynamicMeshAttributeSet* Attributes = EditMesh.Attributes();
+        if (!EditMesh.HasVertexNormals() && !(Attributes && Attributes->PrimaryNormals()))
+        {
+            EditMesh.EnableVertexNormals(FVector3f::UnitZ());
+        }
+        if (EditMesh.HasVertexNormals())
+        {
+            ParallelFor(Count, [&EditMesh, Start, In](int32 Index)
+            {
+                if (EditMesh.IsVertex(Start + Index))
+                {
+                    EditMesh.SetVertexNormal(Start + Index, FVector3f(In[Index * 3 + 0], In[Index * 3 + 1], In[Index * 3 + 2]));
+                }
+            });
+        }
+        if (Attributes && Attributes->PrimaryNormals())
+        {
+            WriteOverlayPerVertex(Attributes->PrimaryNormals(), Start, Count, 3, In);
+        }
+    }
+
+    if (const TArray<uint8>* Bytes = Decoded.Find(TEXT("uvs")))
+    {
+        if (!EditMesh.HasAttributes())
+        {
+            EditMesh.EnableAttributes();
+        }
+        UE::Geometry::FDynamicMeshAttributeSet* Attributes = EditMesh.Attributes();
+        if (UVChannel >= Attributes->NumUVLayers())
+        {
+            Attributes->SetNumUVLayers(UVChannel + 1);
+        }
+        UE::Geometry::FDynamicMeshUVOverlay* UVOverlay = Attributes->GetUVLayer(UVChannel);
+        if (UVOverlay->ElementCount() == 0)
+        {
+            const float ZeroUV[2] = {0.0f, 0.0f};
+            SeedOverlayPerVertex(EditMesh, UVOverlay, ZeroUV);
+        }
+        WriteOverlayPerVertex(UVOverlay, Start, Count, 2, reinterpret_cast<const float*>(Bytes->GetData()));
+    }
+
+    if (const TArray<uint8>* Bytes = Decoded.Find(TEXT("colors")))
+    {
+        if (!EditMesh.HasAttributes())
+        {
+            EditMesh.EnableAttributes();
+        }
+        UE::Geometry::FDynamicMeshAttributeSet* Attributes = EditMesh.Attributes();
+        if (!Attributes->HasPrimaryColors())
+        {
+            Attributes->EnablePrimaryColors();
+        }
+        UE::Geometry::FDynamicMeshColorOverlay* ColorOverlay = Attributes->PrimaryColors();
+        if (ColorOverlay->ElementCount() == 0)
+        {
+            const float White[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+            SeedOverlayPerVertex(EditMesh, ColorOverlay, White);
+        }
+        WriteOverlayPerVertex(ColorOverlay, Start, Count, 4, reinterpret_cast<const float*>(Bytes->GetData()));
+    }
+
+    DMC->NotifyMeshUpdated();
+
+    TArray<TSharedPtr<FJsonValue>> Written;
+    for (const TPair<FString, TArray<uint8>>& Entry : Decoded)
+    {
+        Written.Add(MakeShared<FJsonValueString>(Entry.Key));
+    }
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetStringField(TEXT("actorName"), ActorName);
+    Result->SetNumberField(TEXT("start"), Start);
+    Result->SetNumberField(TEXT("count"), Count);
+    Result->SetArrayField(TEXT("buffers"), Written);
+    Self->SendAutomationResponse(Socket, RequestId, true, TEXT("Mesh buffers written"), Result);
+    return true;
+}
+
 // -------------------------------------------------------------------------
 // translate_mesh - Translate entire mesh
 // -------------------------------------------------------------------------
@@ -6529,44 +7430,57 @@ static bool HandleRemeshVoxel(UMcpAutomationBridgeSubsystem* Self, const FString
     UDynamicMesh* Mesh = DMC->GetDynamicMesh();
     int32 TrisBefore = Mesh->GetTriangleCount();
 
-    // Voxel remesh: Use uniform remesh as approximation (UE5 doesn't have direct voxel remesh in GeometryScript)
-    // For voxel-like results, we use uniform remesh with the voxel size as target edge length approximation
-    FGeometryScriptRemeshOptions RemeshOptions;
-    RemeshOptions.bDiscardAttributes = false;
-    RemeshOptions.bReprojectToInputMesh = true;
-    
-    FGeometryScriptUniformRemeshOptions UniformOptions;
-    // Calculate target triangle count based on voxel size
-    int32 TargetTris = FMath::Max(100, TrisBefore / 2);
-    UniformOptions.TargetType = EGeometryScriptUniformRemeshTargetType::TriangleCount;
-    UniformOptions.TargetTriangleCount = TargetTris;
-    
-    UGeometryScriptLibrary_RemeshingFunctions::ApplyUniformRemesh(Mesh, RemeshOptions, UniformOptions, nullptr);
-    
-    // Fill holes if requested
-    if (bFillHoles)
-    {
-        FGeometryScriptFillHolesOptions FillOptions;
-        FillOptions.FillMethod = EGeometryScriptFillHolesMethod::Automatic;
-        int32 NumFilled = 0;
-        int32 NumFailed = 0;
-        UGeometryScriptLibrary_MeshRepairFunctions::FillAllMeshHoles(Mesh, FillOptions, NumFilled, NumFailed, nullptr);
-    }
+    TSharedRef<FGeometryJob> Job = MakeShared<FGeometryJob>();
+    Job->Self = Self;
+    Job->RequestId = RequestId;
+    Job->Socket = Socket;
+    Job->ActorName = ActorName;
+    Job->TargetActor = TargetActor;
+    Job->SuccessMessage = TEXT("Voxel remesh applied");
+    Job->Result->SetStringField(TEXT("actorName"), ActorName);
+    Job->Result->SetNumberField(TEXT("voxelSize"), VoxelSize);
+    Job->Result->SetNumberField(TEXT("trianglesBefore"), TrisBefore);
+    Job->Work = [TrisBefore, bFillHoles](FGeometryJob& J)
+    {
+        UDynamicMesh* WorkMesh = J.WorkingMesh.Get();
+        if (!J.Progress(0.0f, TEXT("Remeshing")))
+        {
+            return false;
+        }
 
-    DMC->NotifyMeshUpdated();
+        // Voxel remesh: Use uniform remesh as approximation (UE5 doesn't have direct voxel remesh in GeometryScript)
+        // For voxel-like results, we use uniform remesh with the voxel size as target edge length approximation
+        FGeometryScriptRemeshOptions RemeshOptions;
+        RemeshOptions.bDiscardAttributes = false;
+        RemeshOptions.bReprojectToInputMesh = true;
 
-    int32 TrisAfter = Mesh->GetTriangleCount();
+        FGeometryScriptUniformRemeshOptions UniformOptions;
+        // Calculate target triangle count based on voxel size
+        int32 TargetTris = FMath::Max(100, TrisBefore / 2);
+        UniformOptions.TargetType = EGeometryScriptUniformRemeshTargetType::TriangleCount;
+        UniformOptions.TargetTriangleCount = TargetTris;
 
-    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-    Result->SetStringField(TEXT("actorName"), ActorName);
-    Result->SetNumberField(TEXT("voxelSize"), VoxelSize);
-    Result->SetNumberField(TEXT("trianglesBefore"), TrisBefore);
-    Result->SetNumberField(TEXT("trianglesAfter"), TrisAfter);
-    
-    // Add verification data
-    AddActorVerification(Result, TargetActor);
-    
-    Self->SendAutomationResponse(Socket, RequestId, true, TEXT("Voxel remesh applied"), Result);
+        UGeometryScriptLibrary_RemeshingFunctions::ApplyUniformRemesh(WorkMesh, RemeshOptions, UniformOptions, nullptr);
+
+        // Fill holes if requested
+        if (bFillHoles)
+        {
+            if (!J.Progress(70.0f, TEXT("Filling holes")))
+            {
+                return false;
+            }
+            FGeometryScriptFillHolesOptions FillOptions;
+            FillOptions.FillMethod = EGeometryScriptFillHolesMethod::Automatic;
+            int32 NumFilled = 0;
+            int32 NumFailed = 0;
+            UGeometryScriptLibrary_MeshRepairFunctions::FillAllMeshHoles(WorkMesh, FillOptions, NumFilled, NumFailed, nullptr);
+        }
+
+        J.Result->SetNumberField(TEXT("trianglesAfter"), WorkMesh->GetTriangleCount());
+        return true;
+    };
+
+    LaunchGeometryJob(Job, Mesh);
     return true;
 }
 
@@ -6616,32 +7530,48 @@ static bool HandleGenerateComplexCollision(UMcpAutomationBridgeSubsystem* Self,
     UDynamicMesh* Mesh = DMC->GetDynamicMesh();
 
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 5
-    FGeometryScriptCollisionFromMeshOptions CollisionOptions;
-    CollisionOptions.Method = EGeometryScriptCollisionGenerationMethod::ConvexHulls;
-    CollisionOptions.MaxConvexHullsPerMesh = FMath::Clamp(MaxHullCount, 1, 64);
-    CollisionOptions.bEmitTransaction = false;
-    
-    // Generate collision from mesh
-    FGeometryScriptSimpleCollision Collision = UGeometryScriptLibrary_CollisionFunctions::GenerateCollisionFromMesh(
-        Mesh, CollisionOptions, nullptr);
+    // Hulls are computed from a copy on a worker; only assigning them to the
+    // component happens on the game thread. The mesh itself is unchanged.
+    TSharedRef<FGeometryJob> Job = MakeShared<FGeometryJob>();
+    Job->Self = Self;
+    Job->RequestId = RequestId;
+    Job->Socket = Socket;
+    Job->ActorName = ActorName;
+    Job->TargetActor = TargetActor;
+    Job->SuccessMessage = TEXT("Complex collision generated");
+    Job->Result->SetStringField(TEXT("actorName"), ActorName);
+    Job->Result->SetNumberField(TEXT("hullCount"), MaxHullCount);
+    Job->Result->SetStringField(TEXT("collisionType"), TEXT("convex_decomposition"));
+
+    TSharedRef<FGeometryScriptSimpleCollision> Collision = MakeShared<FGeometryScriptSimpleCollision>();
+    Job->Work = [Collision, MaxHullCount](FGeometryJob& J)
+    {
+        if (!J.Progress(0.0f, TEXT("Generating convex hulls")))
+        {
+            return false;
+        }
 
-    // Set the collision on the DynamicMeshComponent
-    FGeometryScriptSetSimpleCollisionOptions SetOptions;
-    UGeometryScriptLibrary_CollisionFunctions::SetSimpleCollisionOfDynamicMeshComponent(
-        Collision, DMC, SetOptions, nullptr);
+        FGeometryScriptCollisionFromMeshOptions CollisionOptions;
+        CollisionOptions.Method = EGeometryScriptCollisionGenerationMethod::ConvexHulls;
+        CollisionOptions.MaxConvexHullsPerMesh = FMath::Clamp(MaxHullCount, 1, 64);
+        CollisionOptions.bEmitTransaction = false;
 
-    int32 ShapeCount = UGeometryScriptLibrary_CollisionFunctions::GetSimpleCollisionShapeCount(Collision);
+        // Generate collision from mesh
+        *Collision = UGeometryScriptLibrary_CollisionFunctions::GenerateCollisionFromMesh(
+            J.WorkingMesh.Get(), CollisionOptions, nullptr);
+        J.Result->SetNumberField(TEXT("shapeCount"),
+            UGeometryScriptLibrary_CollisionFunctions::GetSimpleCollisionShapeCount(*Collision));
+        return true;
+    };
+    Job->Commit = [Collision](FGeometryJob& J, ADynamicMeshActor* Target)
+    {
+        // Set the collision on the DynamicMeshComponent
+        FGeometryScriptSetSimpleCollisionOptions SetOptions;
+        UGeometryScriptLibrary_CollisionFunctions::SetSimpleCollisionOfDynamicMeshComponent(
+            *Collision, Target->GetDynamicMeshComponent(), SetOptions, nullptr);
+    };
 
-    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-    Result->SetStringField(TEXT("actorName"), ActorName);
-    Result->SetNumberField(TEXT("hullCount"), MaxHullCount);
-    Result->SetNumberField(TEXT("shapeCount"), ShapeCount);
-    Result->SetStringField(TEXT("collisionType"), TEXT("convex_decomposition"));
-    
-    // Add verification data
-    AddActorVerification(Result, TargetActor);
-    
-    Self->SendAutomationResponse(Socket, RequestId, true, TEXT("Complex collision generated"), Result);
+    LaunchGeometryJob(Job, Mesh);
 #else
     Self->SendAutomationError(Socket, RequestId, TEXT("Complex collision generation requires UE 5.4+"), TEXT("VERSION_NOT_SUPPORTED"));
 #endif
@@ -7033,6 +7963,347 @@ static bool HandleSetLODScreenSizes(UMcpAutomationBridgeSubsystem* Self, const F
     return true;
 }
 
+// -------------------------------------------------------------------------
+// Geometry Pipeline
+// -------------------------------------------------------------------------
+
+// Upper bound on steps per pipeline; keeps one request from holding the game
+// thread indefinitely.
+static constexpr int32 MAX_PIPELINE_STEPS = 100;
+
+// Applies one pipeline step to the working mesh. Steps take the same
+// parameters as the matching standalone subAction, minus actorName. Returns
+// false with OutError/OutErrorCode set when the step cannot run.
+static bool ApplyGeometryPipelineStep(UDynamicMesh* Mesh, const FString& Op, const TSharedPtr<FJsonObject>& Step,
+                                      UWorld* World, const FTransform& TargetTransform,
+                                      FString& OutError, FString& OutErrorCode)
+{
+    if (Op == TEXT("extrude"))
+    {
+        FGeometryScriptMeshLinearExtrudeOptions ExtrudeOptions;
+        ExtrudeOptions.Distance = GetNumberFieldGeom(Step, TEXT("distance"), 10.0);
+        ExtrudeOptions.Direction = ReadVectorFromPayload(Step, TEXT("direction"), FVector(0, 0, 1));
+        ExtrudeOptions.DirectionMode = EGeometryScriptLinearExtrudeDirection::FixedDirection;
+        FGeometryScriptMeshSelection Selection;
+        UGeometryScriptLibrary_MeshModelingFunctions::ApplyMeshLinearExtrudeFaces(
+            Mesh, ExtrudeOptions, Selection, nullptr);
+        return true;
+    }
+    if (Op == TEXT("inset") || Op == TEXT("outset"))
+    {
+        const double Distance = GetNumberFieldGeom(Step, TEXT("distance"), 5.0);
+        FGeometryScriptMeshInsetOutsetFacesOptions Options;
+        Options.Distance = Op == TEXT("inset") ? -Distance : Distance;
+        Options.bReproject = true;
+        FGeometryScriptMeshSelection Selection;
+        UGeometryScriptLibrary_MeshModelingFunctions::ApplyMeshInsetOutsetFaces(
+            Mesh, Options, Selection, nullptr);
+        return true;
+    }
+    if (Op == TEXT("bevel"))
+    {
+        FGeometryScriptMeshBevelOptions BevelOptions;
+        BevelOptions.BevelDistance = GetNumberFieldGeom(Step, TEXT("distance"), 5.0);
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4
+        BevelOptions.Subdivisions = GetIntFieldGeom(Step, TEXT("subdivisions"), 0);
+#endif
+        UGeometryScriptLibrary_MeshModelingFunctions::ApplyMeshPolygroupBevel(
+            Mesh, BevelOptions, nullptr);
+        return true;
+    }
+    if (Op == TEXT("recalculate_normals"))
+    {
+        FGeometryScriptCalculateNormalsOptions NormalOptions;
+        NormalOptions.bAreaWeighted = GetBoolFieldGeom(Step, TEXT("areaWeighted"), true);
+        NormalOptions.bAngleWeighted = true;
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+        UGeometryScriptLibrary_MeshNormalsFunctions::RecomputeNormals(Mesh, NormalOptions, false, nullptr);
+#else
+        UGeometryScriptLibrary_MeshNormalsFunctions::RecomputeNormals(Mesh, NormalOptions, nullptr);
+#endif
+        return true;
+    }
+    if (Op == TEXT("flip_normals"))
+    {
+        UGeometryScriptLibrary_MeshNormalsFunctions::FlipNormals(Mesh, nullptr);
+        return true;
+    }
+    if (Op == TEXT("simplify_mesh"))
+    {
+        const double TargetPercentage = GetNumberFieldGeom(Step, TEXT("targetPercentage"), 50.0);
+        FGeometryScriptSimplifyMeshOptions SimplifyOptions;
+        SimplifyOptions.Method = EGeometryScriptRemoveMeshSimplificationType::StandardQEM;
+        SimplifyOptions.bAllowSeamCollapse = true;
+        const int32 TargetTriCount = FMath::Max(1, FMath::RoundToInt(Mesh->GetTriangleCount() * (TargetPercentage / 100.0)));
+        UGeometryScriptLibrary_MeshSimplifyFunctions::ApplySimplifyToTriangleCount(
+            Mesh, TargetTriCount, SimplifyOptions, nullptr);
+        return true;
+    }
+    if (Op == TEXT("subdivide"))
+    {
+        const int32 Iterations = FMath::Clamp(GetIntFieldGeom(Step, TEXT("iterations"), 1), 1, MAX_SUBDIVIDE_ITERATIONS);
+        int64 EstimatedTriangles = Mesh->GetTriangleCount();
+        for (int32 i = 0; i < Iterations; ++i)
+        {
+            EstimatedTriangles *= 4;
+        }
+        if (EstimatedTriangles > MAX_TRIANGLES_PER_DYNAMIC_MESH)
+        {
+            OutError = FString::Printf(TEXT("Subdivide would exceed triangle limit. Estimated after: %lld, Max allowed: %d"),
+                                       EstimatedTriangles, MAX_TRIANGLES_PER_DYNAMIC_MESH);
+            OutErrorCode = TEXT("POLYGON_LIMIT_EXCEEDED");
+            return false;
+        }
+        for (int32 i = 0; i < Iterations; ++i)
+        {
+            FGeometryScriptPNTessellateOptions TessOptions;
+            UGeometryScriptLibrary_MeshSubdivideFunctions::ApplyPNTessellation(Mesh, TessOptions, 1, nullptr);
+        }
+        return true;
+    }
+    if (Op == TEXT("auto_uv"))
+    {
+        UGeometryScriptLibrary_MeshUVFunctions::AutoGenerateXAtlasMeshUVs(
+            Mesh, 0, FGeometryScriptXAtlasOptions(), nullptr);
+        return true;
+    }
+    if (Op == TEXT("smooth"))
+    {
+        FGeometryScriptIterativeMeshSmoothingOptions SmoothOptions;
+        SmoothOptions.NumIterations = GetIntFieldGeom(Step, TEXT("iterations"), 10);
+        SmoothOptions.Alpha = GetNumberFieldGeom(Step, TEXT("alpha"), 0.2);
+        FGeometryScriptMeshSelection Selection;
+        UGeometryScriptLibrary_MeshDeformFunctions::ApplyIterativeSmoothingToMesh(
+            Mesh, Selection, SmoothOptions, nullptr);
+        return true;
+    }
+    if (Op == TEXT("weld_vertices"))
+    {
+        FGeometryScriptWeldEdgesOptions WeldOptions;
+        WeldOptions.Tolerance = GetNumberFieldGeom(Step, TEXT("tolerance"), 0.0001);
+        WeldOptions.bOnlyUniquePairs = true;
+        UGeometryScriptLibrary_MeshRepairFunctions::WeldMeshEdges(Mesh, WeldOptions, nullptr);
+        return true;
+    }
+    if (Op == TEXT("fill_holes"))
+    {
+        FGeometryScriptFillHolesOptions FillOptions;
+        FillOptions.FillMethod = EGeometryScriptFillHolesMethod::Automatic;
+        int32 NumFilledHoles = 0;
+        int32 NumFailedHoleFills = 0;
+        UGeometryScriptLibrary_MeshRepairFunctions::FillAllMeshHoles(
+            Mesh, FillOptions, NumFilledHoles, NumFailedHoleFills, nullptr);
+        return true;
+    }
+    if (Op == TEXT("remove_degenerates"))
+    {
+        FGeometryScriptDegenerateTriangleOptions Options;
+        Options.Mode = EGeometryScriptRepairMeshMode::RepairOrDelete;
+        UGeometryScriptLibrary_MeshRepairFunctions::RepairMeshDegenerateGeometry(Mesh, Options, nullptr);
+        return true;
+    }
+    if (Op == TEXT("remesh_uniform"))
+    {
+        FGeometryScriptRemeshOptions RemeshOptions;
+        RemeshOptions.bDiscardAttributes = false;
+        RemeshOptions.bReprojectToInputMesh = true;
+        FGeometryScriptUniformRemeshOptions UniformOptions;
+        UniformOptions.TargetType = EGeometryScriptUniformRemeshTargetType::TriangleCount;
+        UniformOptions.TargetTriangleCount = GetIntFieldGeom(Step, TEXT("targetTriangleCount"), 5000);
+        UGeometryScriptLibrary_RemeshingFunctions::ApplyUniformRemesh(
+            Mesh, RemeshOptions, UniformOptions, nullptr);
+        return true;
+    }
+    if (Op == TEXT("boolean_union") || Op == TEXT("boolean_subtract") || Op == TEXT("difference") ||
+        Op == TEXT("boolean_intersection"))
+    {
+        const FString ToolActorName = GetStringFieldGeom(Step, TEXT("toolActor"));
+        ADynamicMeshActor* ToolActor = FindDynamicMeshActorByLabel(World, ToolActorName);
+        UDynamicMesh* ToolMesh = ToolActor && ToolActor->GetDynamicMeshComponent()
+                                     ? ToolActor->GetDynamicMeshComponent()->GetDynamicMesh()
+                                     : nullptr;
+        if (!ToolMesh)
+        {
+            OutError = FString::Printf(TEXT("Tool actor not found: %s"), *ToolActorName);
+            OutErrorCode = TEXT("ACTOR_NOT_FOUND");
+            return false;
+        }
+        const int64 EstimatedWithSafetyMargin =
+            (static_cast<int64>(Mesh->GetTriangleCount()) + ToolMesh->GetTriangleCount()) * 3;
+        if (EstimatedWithSafetyMargin > MAX_TRIANGLES_PER_DYNAMIC_MESH)
+        {
+            OutError = FString::Printf(TEXT("Boolean would exceed polygon limit. Estimated max: %lld, Limit: %d"),
+                                       EstimatedWithSafetyMargin, MAX_TRIANGLES_PER_DYNAMIC_MESH);
+            OutErrorCode = TEXT("POLYGON_LIMIT_EXCEEDED");
+            return false;
+        }
+        const EGeometryScriptBooleanOperation BoolOp =
+            Op == TEXT("boolean_union") ? EGeometryScriptBooleanOperation::Union
+            : Op == TEXT("boolean_intersection") ? EGeometryScriptBooleanOperation::Intersection
+            : EGeometryScriptBooleanOperation::Subtract;
+        FGeometryScriptMeshBooleanOptions BoolOptions;
+        BoolOptions.bFillHoles = true;
+        BoolOptions.bSimplifyOutput = false;
+        if (!UGeometryScriptLibrary_MeshBooleanFunctions::ApplyMeshBoolean(
+                Mesh, TargetTransform, ToolMesh, ToolActor->GetActorTransform(), BoolOp, BoolOptions, nullptr))
+        {
+            OutError = TEXT("Boolean operation produced empty geometry");
+            OutErrorCode = TEXT("OPERATION_FAILED");
+            return false;
+        }
+        return true;
+    }
+
+    OutError = FString::Printf(TEXT("Unsupported pipeline op: '%s'"), *Op);
+    OutErrorCode = TEXT("UNKNOWN_SUBACTION");
+    return false;
+}
+
+// Runs an ordered list of operations against one working copy of the actor's
+// mesh and commits the result once, so a multi-step recipe pays a single mesh
+// change notification and render proxy rebuild instead of one per step. The
+// actor's mesh is left untouched when any step fails.
+//
+// Payload: { actorName, operations: [ { op: "extrude", distance: 10 }, ... ] }
+static bool HandleGeometryPipeline(UMcpAutomationBridgeSubsystem* Self, const FString& RequestId,
+                                   const TSharedPtr<FJsonObject>& Payload, TSharedPtr<FMcpBridgeWebSocket> Socket)
+{
+    FString ActorName = GetStringFieldGeom(Payload, TEXT("actorName"));
+    const TArray<TSharedPtr<FJsonValue>>* Operations = nullptr;
+
+    if (ActorName.IsEmpty())
+    {
+        Self->SendAutomationError(Socket, RequestId, TEXT("actorName required"), TEXT("INVALID_ARGUMENT"));
+        return true;
+    }
+    if (!Payload->TryGetArrayField(TEXT("operations"), Operations) || !Operations || Operations->Num() == 0)
+    {
+        Self->SendAutomationError(Socket, RequestId, TEXT("operations array required"), TEXT("INVALID_ARGUMENT"));
+        return true;
+    }
+    if (Operations->Num() > MAX_PIPELINE_STEPS)
+    {
+        Self->SendAutomationError(Socket, RequestId,
+            FString::Printf(TEXT("Pipeline accepts at most %d operations (got %d)"), MAX_PIPELINE_STEPS, Operations->Num()),
+            TEXT("INVALID_ARGUMENT"));
+        return true;
+    }
+
+    if (!IsMemoryPressureSafe())
+    {
+        Self->SendAutomationError(Socket, RequestId,
+            FString::Printf(TEXT("Memory pressure too high (%.1f%% used). Pipeline blocked to prevent OOM."),
+                           GetMemoryUsagePercent()),
+            TEXT("MEMORY_PRESSURE"));
+        return true;
+    }
+
+    UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+    ADynamicMeshActor* TargetActor = FindDynamicMeshActorByLabel(World, ActorName);
+    if (!TargetActor)
+    {
+        Self->SendAutomationError(Socket, RequestId, FString::Printf(TEXT("Actor not found: %s"), *ActorName), TEXT("ACTOR_NOT_FOUND"));
+        return true;
+    }
+
+    UDynamicMeshComponent* DMC = TargetActor->GetDynamicMeshComponent();
+    if (!DMC || !DMC->GetDynamicMesh())
+    {
+        Self->SendAutomationError(Socket, RequestId, TEXT("DynamicMesh not available"), TEXT("MESH_NOT_FOUND"));
+        return true;
+    }
+
+    UDynamicMesh* TargetMesh = DMC->GetDynamicMesh();
+    const int32 TriCountBefore = TargetMesh->GetTriangleCount();
+
+    // The working mesh is not bound to any component, so the steps below
+    // broadcast their change events to nobody.
+    UDynamicMesh* WorkingMesh = GetOrCreateDynamicMesh(GetTransientPackage());
+    WorkingMesh->SetMesh(TargetMesh->GetMeshRef());
+
+    const double PipelineStartSeconds = FPlatformTime::Seconds();
+    TArray<TSharedPtr<FJsonValue>> Steps;
+    FString Error;
+    FString ErrorCode;
+    int32 FailedStep = INDEX_NONE;
+
+    for (int32 Index = 0; Index < Operations->Num(); ++Index)
+    {
+        const TSharedPtr<FJsonObject>* StepObj = nullptr;
+        const TSharedPtr<FJsonValue>& StepValue = (*Operations)[Index];
+        FString Op;
+        if (StepValue.IsValid() && StepValue->TryGetObject(StepObj) && StepObj && StepObj->IsValid())
+        {
+            Op = GetStringFieldGeom(*StepObj, TEXT("op"));
+        }
+
+        TSharedPtr<FJsonObject> StepResult = MakeShared<FJsonObject>();
+        StepResult->SetNumberField(TEXT("index"), Index);
+        StepResult->SetStringField(TEXT("op"), Op);
+
+        const double StepStartSeconds = FPlatformTime::Seconds();
+        bool bStepSucceeded = false;
+        if (Op.IsEmpty())
+        {
+            Error = TEXT("Each operation must be an object with an 'op' field");
+            ErrorCode = TEXT("INVALID_ARGUMENT");
+        }
+        else
+        {
+            bStepSucceeded = ApplyGeometryPipelineStep(WorkingMesh, Op, *StepObj, World,
+                                                       TargetActor->GetActorTransform(), Error, ErrorCode);
+        }
+
+        StepResult->SetBoolField(TEXT("success"), bStepSucceeded);
+        StepResult->SetNumberField(TEXT("durationMs"), (FPlatformTime::Seconds() - StepStartSeconds) * 1000.0);
+        StepResult->SetNumberField(TEXT("triangles"), WorkingMesh->GetTriangleCount());
+        if (!bStepSucceeded)
+        {
+            StepResult->SetStringField(TEXT("error"), Error);
+        }
+        Steps.Add(MakeShared<FJsonValueObject>(StepResult));
+
+        if (!bStepSucceeded)
+        {
+            FailedStep = Index;
+            break;
+        }
+    }
+
+    const bool bSucceeded = FailedStep == INDEX_NONE;
+    const int32 TriCountAfter = WorkingMesh->GetTriangleCount();
+    if (bSucceeded)
+    {
+        if (TriCountAfter > WARNING_TRIANGLE_THRESHOLD)
+        {
+            UE_LOG(LogMcpGeometryHandlers, Warning, TEXT("Pipeline result has %d triangles (warning threshold: %d)"),
+                   TriCountAfter, WARNING_TRIANGLE_THRESHOLD);
+        }
+        // SetMesh broadcasts one change, which the component turns into a
+        // single proxy rebuild.
+        TargetMesh->SetMesh(MoveTemp(WorkingMesh->GetMeshRef()));
+    }
+    WorkingMesh->MarkAsGarbage();
+
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetStringField(TEXT("actorName"), ActorName);
+    Result->SetArrayField(TEXT("steps"), Steps);
+    Result->SetBoolField(TEXT("committed"), bSucceeded);
+    Result->SetNumberField(TEXT("originalTriangles"), TriCountBefore);
+    Result->SetNumberField(TEXT("resultTriangles"), bSucceeded ? TriCountAfter : TriCountBefore);
+    Result->SetNumberField(TEXT("durationMs"), (FPlatformTime::Seconds() - PipelineStartSeconds) * 1000.0);
+    if (!bSucceeded)
+    {
+        Result->SetNumberField(TEXT("failedStep"), FailedStep);
+    }
+
+    Self->SendAutomationResponse(Socket, RequestId, bSucceeded,
+        bSucceeded ? FString::Printf(TEXT("Pipeline applied %d operation(s)"), Steps.Num())
+                   : FString::Printf(TEXT("Pipeline step %d failed: %s"), FailedStep, *Error),
+        Result, bSucceeded ? FString() : ErrorCode);
+    return true;
+}
+
 // -------------------------------------------------------------------------
 // Handler Dispatcher
 // -------------------------------------------------------------------------
@@ -7065,6 +8336,20 @@ bool UMcpAutomationBridgeSubsystem::HandleGeometryAction(
         return true;
     }
 
+    // A background job is rewriting this mesh; anything applied now would be
+    // overwritten when its result is swapped in.
+    for (const TCHAR* Field : {TEXT("actorName"), TEXT("targetActor")})
+    {
+        const FString Label = GetStringFieldGeom(Payload, Field);
+        if (!Label.IsEmpty() && GBusyGeometryActors.Contains(Label))
+        {
+            SendAutomationError(RequestingSocket, RequestId,
+                FString::Printf(TEXT("A background geometry operation is still running on '%s'"), *Label),
+                TEXT("MESH_BUSY"));
+            return true;
+        }
+    }
+
     // Primitives
     if (SubAction == TEXT("create_box")) return HandleCreateBox(this, RequestId, Payload, RequestingSocket);
     if (SubAction == TEXT("create_sphere")) return HandleCreateSphere(this, RequestId, Payload, RequestingSocket);
@@ -7134,6 +8419,7 @@ bool UMcpAutomationBridgeSubsystem::HandleGeometryAction(
     if (SubAction == TEXT("mirror")) return HandleMirror(this, RequestId, Payload, RequestingSocket);
     if (SubAction == TEXT("array_linear")) return HandleArrayLinear(this, RequestId, Payload, RequestingSocket);
     if (SubAction == TEXT("array_radial")) return HandleArrayRadial(this, RequestId, Payload, RequestingSocket);
+    if (SubAction == TEXT("bake_instances")) return HandleBakeInstances(this, RequestId, Payload, RequestingSocket);
 
     // Mesh Topology Operations
     if (SubAction == TEXT("triangulate")) return HandleTriangulate(this, RequestId, Payload, RequestingSocket);
@@ -7165,6 +8451,8 @@ bool UMcpAutomationBridgeSubsystem::HandleGeometryAction(
     if (SubAction == TEXT("get_vertex_position")) return HandleGetVertexPosition(this, RequestId, Payload, RequestingSocket);
     if (SubAction == TEXT("set_vertex_position")) return HandleSetVertexPosition(this, RequestId, Payload, RequestingSocket);
     if (SubAction == TEXT("translate_mesh")) return HandleTranslateMesh(this, RequestId, Payload, RequestingSocket);
+    if (SubAction == TEXT("get_mesh_buffers")) return HandleGetMeshBuffers(this, RequestId, Payload, RequestingSocket);
+    if (SubAction == TEXT("set_mesh_buffers")) return HandleSetMeshBuffers(this, RequestId, Payload, RequestingSocket);
 
     // Additional UV Operations
     if (SubAction == TEXT("unwrap_uv")) return HandleUnwrapUV(this, RequestId, Payload, RequestingSocket);
@@ -7176,6 +8464,9 @@ bool UMcpAutomationBridgeSubsystem::HandleGeometryAction(
     // Spline-based Operations
     if (SubAction == TEXT("extrude_along_spline")) return HandleExtrudeAlongSpline(this, RequestId, Payload, RequestingSocket);
 
+    // Multi-step recipes on one working mesh
+    if (SubAction == TEXT("pipeline")) return HandleGeometryPipeline(this, RequestId, Payload, RequestingSocket);
+
     // Aliases
     if (SubAction == TEXT("difference")) return HandleBooleanSubtract(this, RequestId, Payload, RequestingSocket);
 
@@ -134,7 +134,7 @@ bool UMcpAutomationBridgeSubsystem::HandleInputAction(
 
     if (NewAsset) {
       // Force save
-      SaveLoadedAssetThrottled(NewAsset, -1.0, true);
+      QueueAssetSave(NewAsset);
       TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
       Result->SetStringField(TEXT("assetPath"), NewAsset->GetPathName());
       AddAssetVerification(Result, NewAsset);
@@ -194,7 +194,7 @@ bool UMcpAutomationBridgeSubsystem::HandleInputAction(
         AssetTools.CreateAsset(Name, SanitizedPath, ContextClass, nullptr);
 
     if (NewAsset) {
-      SaveLoadedAssetThrottled(NewAsset, -1.0, true);
+      QueueAssetSave(NewAsset);
       TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
       Result->SetStringField(TEXT("assetPath"), NewAsset->GetPathName());
       AddAssetVerification(Result, NewAsset);
@@ -300,7 +300,7 @@ bool UMcpAutomationBridgeSubsystem::HandleInputAction(
     }
 
     // Save changes
-    SaveLoadedAssetThrottled(Context, -1.0, true);
+    QueueAssetSave(Context);
 
     TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
     Result->SetStringField(TEXT("contextPath"), SanitizedContextPath);
@@ -351,7 +351,7 @@ bool UMcpAutomationBridgeSubsystem::HandleInputAction(
     for (const FKey &KeyToRemove : KeysToRemove) {
       Context->UnmapKey(InAction, KeyToRemove);
     }
-    SaveLoadedAssetThrottled(Context, -1.0, true);
+    QueueAssetSave(Context);
 
     TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
     Result->SetStringField(TEXT("contextPath"), SanitizedContextPath);
@@ -407,7 +407,7 @@ bool UMcpAutomationBridgeSubsystem::HandleInputAction(
     }
 
     FEnhancedActionKeyMapping &Mapping = Context->MapKey(InAction, Key);
-    SaveLoadedAssetThrottled(Context, -1.0, true);
+    QueueAssetSave(Context);
 
     TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
     Result->SetStringField(TEXT("contextPath"), SanitizedContextPath);
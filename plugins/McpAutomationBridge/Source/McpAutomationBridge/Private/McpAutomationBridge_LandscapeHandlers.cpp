@@ -8,6 +8,7 @@
 
 #if WITH_EDITOR
 #include "Async/Async.h"
+#include "Async/ParallelFor.h"
 #include "EditorAssetLibrary.h"
 #include "Engine/World.h"
 #include "Landscape.h"
@@ -22,6 +23,7 @@
 #include "LandscapeStreamingProxy.h"
 #include "Materials/Material.h"
 #include "Materials/MaterialInstanceConstant.h"
+#include "McpPackedArray.h"
 #include "Misc/ScopedSlowTask.h"
 #include "UObject/SavePackage.h"
 
@@ -32,6 +34,346 @@
 #endif
 #endif
 
+#if WITH_EDITOR
+// Largest region get_heightmap_region returns in one response (a 4097 x 4097
+// landscape); bigger reads are split by the caller into several regions.
+constexpr int64 MaxHeightmapRegionSamples = 4097 * 4097;
+
+// Landscape by actor label or package path. Level actors are searched first
+// so transient landscapes are found; a saved one is then loaded from disk.
+static ALandscape *FindLandscapeByNameOrPath(const FString &LandscapeName,
+                                             const FString &LandscapePath) {
+  if (GEditor) {
+    if (UEditorActorSubsystem *ActorSS =
+            GEditor->GetEditorSubsystem<UEditorActorSubsystem>()) {
+      for (AActor *A : ActorSS->GetAllLevelActors()) {
+        ALandscape *L = Cast<ALandscape>(A);
+        if (!L) {
+          continue;
+        }
+        // Match by landscapeName if provided (actor label)
+        if (!LandscapeName.IsEmpty() &&
+            L->GetActorLabel().Equals(LandscapeName, ESearchCase::IgnoreCase)) {
+          return L;
+        }
+        // Match by path: compare asset path from the landscape's package
+        if (!LandscapePath.IsEmpty()) {
+          FString NormalizedRequest = LandscapePath;
+          FString NormalizedActor = L->GetPackage()->GetPathName();
+          NormalizedRequest.ReplaceInline(TEXT("\\"), TEXT("/"));
+          NormalizedActor.ReplaceInline(TEXT("\\"), TEXT("/"));
+          // Remove .uasset extension if present
+          if (NormalizedActor.EndsWith(TEXT(".uasset"))) {
+            NormalizedActor = NormalizedActor.LeftChop(7);
+          }
+          if (NormalizedActor.Equals(NormalizedRequest,
+                                     ESearchCase::IgnoreCase)) {
+            return L;
+          }
+        }
+      }
+    }
+  }
+  if (!LandscapePath.IsEmpty()) {
+    return Cast<ALandscape>(
+        StaticLoadObject(ALandscape::StaticClass(), nullptr, *LandscapePath));
+  }
+  return nullptr;
+}
+
+// Heights as a JSON number array, or a packed { encoding: "base64", layout:
+// "u16", count, data } block copied straight into OutHeights. A missing
+// field leaves OutHeights empty.
+static bool ReadHeightSamples(const TSharedPtr<FJsonObject> &Payload,
+                              TArray<uint16> &OutHeights, FString &OutError) {
+  const TSharedPtr<FJsonValue> Field = Payload->TryGetField(TEXT("heightData"));
+  if (!Field.IsValid()) {
+    return true;
+  }
+  if (FMcpPackedArray::IsPackedValue(Field)) {
+    const TSharedPtr<FJsonObject> Packed = Field->AsObject();
+    FString Layout;
+    Packed->TryGetStringField(TEXT("layout"), Layout);
+    if (!Layout.IsEmpty() && !Layout.Equals(TEXT("u16"), ESearchCase::IgnoreCase)) {
+      OutError = FString::Printf(
+          TEXT("heightData layout must be u16, got '%s'"), *Layout);
+      return false;
+    }
+    TArray<uint8> Bytes;
+    int32 Count = 0;
+    if (!FMcpPackedArray::DecodeRaw(*Packed, sizeof(uint16), Bytes, Count,
+                                    OutError)) {
+      return false;
+    }
+    OutHeights.SetNumUninitialized(Count);
+    FMemory::Memcpy(OutHeights.GetData(), Bytes.GetData(), Bytes.Num());
+    return true;
+  }
+  const TArray<TSharedPtr<FJsonValue>> *Values = nullptr;
+  if (Field->TryGetArray(Values) && Values) {
+    OutHeights.Reserve(Values->Num());
+    for (const TSharedPtr<FJsonValue> &Val : *Values) {
+      if (Val.IsValid() && Val->Type == EJson::Number) {
+        OutHeights.Add(
+            static_cast<uint16>(FMath::Clamp(Val->AsNumber(), 0.0, 65535.0)));
+      }
+    }
+  }
+  return true;
+}
+
+// Region in landscape vertex coordinates from a "region" object or from
+// top-level minX/minY/maxX/maxY; a missing bound stays -1 (full extent).
+static void ReadHeightmapRegion(const TSharedPtr<FJsonObject> &Payload,
+                                int32 &OutMinX, int32 &OutMinY,
+                                int32 &OutMaxX, int32 &OutMaxY) {
+  OutMinX = OutMinY = OutMaxX = OutMaxY = -1;
+  const TSharedPtr<FJsonObject> *RegionObj = nullptr;
+  const FJsonObject *Source = Payload.Get();
+  if (Payload->TryGetObjectField(TEXT("region"), RegionObj) && RegionObj &&
+      RegionObj->IsValid()) {
+    Source = RegionObj->Get();
+  }
+  Source->TryGetNumberField(TEXT("minX"), OutMinX);
+  Source->TryGetNumberField(TEXT("minY"), OutMinY);
+  Source->TryGetNumberField(TEXT("maxX"), OutMaxX);
+  Source->TryGetNumberField(TEXT("maxY"), OutMaxY);
+}
+
+// Most dabs a single sculpt or paint stroke may carry after spacing.
+constexpr int32 MaxLandscapeStrokeDabs = 100000;
+
+// One brush dab of a stroke, in world space; Falloff is a 0-1 fraction of
+// Radius.
+struct FLandscapeStrokeDab {
+  FVector Location = FVector::ZeroVector;
+  double Radius = 0.0;
+  double Strength = 0.0;
+  double Falloff = 0.0;
+};
+
+// The same dab in landscape vertex space. Target is the flatten height.
+struct FLandscapeVertexDab {
+  FVector2D Center = FVector2D::ZeroVector;
+  float Radius = 1.0f;
+  float FalloffVerts = 0.0f;
+  float Strength = 0.0f;
+  float Target = 32768.0f;
+};
+
+// Reads "stroke": an array of points ({ x, y, z }, { location, radius,
+// strength, falloff } or [x, y, z, radius?, strength?, falloff?]) or a
+// packed f32x6 / f64x6 block of x y z radius strength falloff. Values a
+// point leaves out come from Defaults. With "spacing" > 0 extra dabs are
+// interpolated so consecutive dabs are at most that far apart. A missing
+// stroke leaves OutDabs empty.
+static bool ReadLandscapeStroke(const TSharedPtr<FJsonObject> &Payload,
+                                const FLandscapeStrokeDab &Defaults,
+                                TArray<FLandscapeStrokeDab> &OutDabs,
+                                FString &OutError) {
+  OutDabs.Reset();
+  const TSharedPtr<FJsonValue> Field = Payload->TryGetField(TEXT("stroke"));
+  if (!Field.IsValid()) {
+    return true;
+  }
+
+  TArray<FLandscapeStrokeDab> Points;
+  if (FMcpPackedArray::IsPackedValue(Field)) {
+    const TSharedPtr<FJsonObject> Packed = Field->AsObject();
+    FString Layout;
+    Packed->TryGetStringField(TEXT("layout"), Layout);
+    const bool bDouble = Layout.Equals(TEXT("f64x6"), ESearchCase::IgnoreCase);
+    if (!bDouble && !Layout.Equals(TEXT("f32x6"), ESearchCase::IgnoreCase)) {
+      OutError = TEXT("stroke layout must be f32x6 or f64x6 (x y z radius "
+                      "strength falloff)");
+      return false;
+    }
+    TArray<uint8> Bytes;
+    int32 Count = 0;
+    if (!FMcpPackedArray::DecodeRaw(*Packed, bDouble ? 6 * sizeof(double)
+                                                     : 6 * sizeof(float),
+                                    Bytes, Count, OutError)) {
+      return false;
+    }
+    const double *Doubles = reinterpret_cast<const double *>(Bytes.GetData());
+    const float *Floats = reinterpret_cast<const float *>(Bytes.GetData());
+    Points.SetNum(Count);
+    for (int32 Index = 0; Index < Count; ++Index) {
+      double C[6];
+      for (int32 Component = 0; Component < 6; ++Component) {
+        C[Component] = bDouble ? Doubles[Index * 6 + Component]
+                               : Floats[Index * 6 + Component];
+      }
+      Points[Index] = {FVector(C[0], C[1], C[2]), C[3], C[4], C[5]};
+    }
+  } else {
+    const TArray<TSharedPtr<FJsonValue>> *Values = nullptr;
+    if (!Field->TryGetArray(Values) || !Values) {
+      OutError = TEXT("stroke must be an array of points or a packed block");
+      return false;
+    }
+    for (const TSharedPtr<FJsonValue> &Value : *Values) {
+      FLandscapeStrokeDab &Dab = Points.Add_GetRef(Defaults);
+      const TSharedPtr<FJsonObject> *PointObj = nullptr;
+      const TArray<TSharedPtr<FJsonValue>> *PointArr = nullptr;
+      if (Value.IsValid() && Value->TryGetObject(PointObj) && PointObj) {
+        if ((*PointObj)->HasField(TEXT("location"))) {
+          Dab.Location = ExtractVectorField(*PointObj, TEXT("location"),
+                                            FVector::ZeroVector);
+        } else if ((*PointObj)->HasField(TEXT("position"))) {
+          Dab.Location = ExtractVectorField(*PointObj, TEXT("position"),
+                                            FVector::ZeroVector);
+        } else {
+          (*PointObj)->TryGetNumberField(TEXT("x"), Dab.Location.X);
+          (*PointObj)->TryGetNumberField(TEXT("y"), Dab.Location.Y);
+          (*PointObj)->TryGetNumberField(TEXT("z"), Dab.Location.Z);
+        }
+        (*PointObj)->TryGetNumberField(TEXT("radius"), Dab.Radius);
+        (*PointObj)->TryGetNumberField(TEXT("strength"), Dab.Strength);
+        (*PointObj)->TryGetNumberField(TEXT("falloff"), Dab.Falloff);
+      } else if (Value.IsValid() && Value->TryGetArray(PointArr) && PointArr &&
+                 PointArr->Num() >= 3) {
+        double *Targets[6] = {&Dab.Location.X, &Dab.Location.Y,
+                              &Dab.Location.Z, &Dab.Radius,
+                              &Dab.Strength,   &Dab.Falloff};
+        for (int32 Component = 0;
+             Component < FMath::Min(6, PointArr->Num()); ++Component) {
+          *Targets[Component] = (*PointArr)[Component]->AsNumber();
+        }
+      } else {
+        OutError = TEXT("stroke points must be objects or number arrays");
+        return false;
+      }
+    }
+  }
+
+  double Spacing = 0.0;
+  Payload->TryGetNumberField(TEXT("spacing"), Spacing);
+  for (int32 Index = 0; Index < Points.Num(); ++Index) {
+    if (Spacing > 0.0 && Index > 0) {
+      const FLandscapeStrokeDab &A = Points[Index - 1];
+      const FLandscapeStrokeDab &B = Points[Index];
+      const int32 Steps = FMath::Min(
+          FMath::CeilToInt(FVector::Dist(A.Location, B.Location) / Spacing),
+          MaxLandscapeStrokeDabs + 1);
+      for (int32 Step = 1; Step < Steps; ++Step) {
+        const double T = static_cast<double>(Step) / Steps;
+        OutDabs.Add({FMath::Lerp(A.Location, B.Location, T),
+                     FMath::Lerp(A.Radius, B.Radius, T),
+                     FMath::Lerp(A.Strength, B.Strength, T),
+                     FMath::Lerp(A.Falloff, B.Falloff, T)});
+      }
+    }
+    OutDabs.Add(Points[Index]);
+    if (OutDabs.Num() > MaxLandscapeStrokeDabs) {
+      OutError = FString::Printf(TEXT("stroke exceeds %d dabs"),
+                                 MaxLandscapeStrokeDabs);
+      return false;
+    }
+  }
+  return true;
+}
+
+// Converts world-space dabs to Landscape's vertex space, with the brush
+// conversions sculpt_landscape has always used, and returns their bounding
+// rect clamped to the landscape extent. False when the stroke misses the
+// landscape.
+static bool ToLandscapeVertexDabs(const ALandscape *Landscape,
+                                  ULandscapeInfo *LandscapeInfo,
+                                  const TArray<FLandscapeStrokeDab> &Dabs,
+                                  TArray<FLandscapeVertexDab> &OutDabs,
+                                  FIntRect &OutRect) {
+  const FTransform LandscapeTransform = Landscape->GetActorTransform();
+  const FVector Scale = Landscape->GetActorScale3D();
+  const double LandscapeZ = Landscape->GetActorLocation().Z;
+  OutRect = FIntRect(MAX_int32, MAX_int32, MIN_int32, MIN_int32);
+  OutDabs.Reset(Dabs.Num());
+  for (const FLandscapeStrokeDab &Dab : Dabs) {
+    const FVector LocalPos =
+        LandscapeTransform.InverseTransformPosition(Dab.Location);
+    const int32 RadiusVerts =
+        FMath::Max(1, FMath::RoundToInt(Dab.Radius / Scale.X));
+    FLandscapeVertexDab &Out = OutDabs.AddDefaulted_GetRef();
+    Out.Center = FVector2D(FMath::RoundToInt(LocalPos.X),
+                           FMath::RoundToInt(LocalPos.Y));
+    Out.Radius = static_cast<float>(RadiusVerts);
+    Out.FalloffVerts =
+        static_cast<float>(FMath::RoundToInt(RadiusVerts * Dab.Falloff));
+    Out.Strength = static_cast<float>(Dab.Strength);
+    Out.Target = static_cast<float>((Dab.Location.Z - LandscapeZ) / Scale.Z *
+                                        128.0 +
+                                    32768.0);
+    const int32 CenterX = static_cast<int32>(Out.Center.X);
+    const int32 CenterY = static_cast<int32>(Out.Center.Y);
+    OutRect.Min.X = FMath::Min(OutRect.Min.X, CenterX - RadiusVerts);
+    OutRect.Min.Y = FMath::Min(OutRect.Min.Y, CenterY - RadiusVerts);
+    OutRect.Max.X = FMath::Max(OutRect.Max.X, CenterX + RadiusVerts);
+    OutRect.Max.Y = FMath::Max(OutRect.Max.Y, CenterY + RadiusVerts);
+  }
+
+  int32 LMinX, LMinY, LMaxX, LMaxY;
+  if (LandscapeInfo->GetLandscapeExtent(LMinX, LMinY, LMaxX, LMaxY)) {
+    OutRect.Min.X = FMath::Max(OutRect.Min.X, LMinX);
+    OutRect.Min.Y = FMath::Max(OutRect.Min.Y, LMinY);
+    OutRect.Max.X = FMath::Min(OutRect.Max.X, LMaxX);
+    OutRect.Max.Y = FMath::Min(OutRect.Max.Y, LMaxY);
+  }
+  return OutDabs.Num() > 0 && OutRect.Min.X <= OutRect.Max.X &&
+         OutRect.Min.Y <= OutRect.Max.Y;
+}
+
+// Runs Apply(Value, Alpha, Dab) on Values (laid out row-major over Rect) for
+// every vertex under each dab, in stroke order per vertex, so the whole
+// stroke accumulates into one buffer. Rows are independent and run in
+// parallel; each row only visits the dabs that cross it.
+template <typename ApplyType>
+static void RasterizeLandscapeStroke(const TArray<FLandscapeVertexDab> &Dabs,
+                                     const FIntRect &Rect,
+                                     TArray<float> &Values,
+                                     const ApplyType &Apply) {
+  const int32 SizeX = Rect.Max.X - Rect.Min.X + 1;
+  const int32 SizeY = Rect.Max.Y - Rect.Min.Y + 1;
+  TArray<TArray<int32>> RowDabs;
+  RowDabs.SetNum(SizeY);
+  for (int32 DabIndex = 0; DabIndex < Dabs.Num(); ++DabIndex) {
+    const FLandscapeVertexDab &Dab = Dabs[DabIndex];
+    const int32 Y0 = FMath::Max(Rect.Min.Y,
+                                FMath::FloorToInt(Dab.Center.Y - Dab.Radius));
+    const int32 Y1 = FMath::Min(Rect.Max.Y,
+                                FMath::CeilToInt(Dab.Center.Y + Dab.Radius));
+    for (int32 Y = Y0; Y <= Y1; ++Y) {
+      RowDabs[Y - Rect.Min.Y].Add(DabIndex);
+    }
+  }
+
+  ParallelFor(SizeY, [&](int32 Row) {
+    const float Y = static_cast<float>(Rect.Min.Y + Row);
+    float *RowValues = Values.GetData() + Row * SizeX;
+    for (const int32 DabIndex : RowDabs[Row]) {
+      const FLandscapeVertexDab &Dab = Dabs[DabIndex];
+      const float DY = Y - static_cast<float>(Dab.Center.Y);
+      const int32 X0 = FMath::Max(Rect.Min.X,
+                                  FMath::FloorToInt(Dab.Center.X - Dab.Radius));
+      const int32 X1 = FMath::Min(Rect.Max.X,
+                                  FMath::CeilToInt(Dab.Center.X + Dab.Radius));
+      const float FalloffStart = Dab.Radius - Dab.FalloffVerts;
+      for (int32 X = X0; X <= X1; ++X) {
+        const float DX = static_cast<float>(X) - static_cast<float>(Dab.Center.X);
+        const float Dist = FMath::Sqrt(DX * DX + DY * DY);
+        if (Dist > Dab.Radius) {
+          continue;
+        }
+        float Alpha = 1.0f;
+        if (Dist > FalloffStart) {
+          Alpha = 1.0f - (Dist - FalloffStart) / Dab.FalloffVerts;
+        }
+        Apply(RowValues[X - Rect.Min.X], FMath::Clamp(Alpha, 0.0f, 1.0f), Dab);
+      }
+    }
+  });
+}
+#endif
+
 bool UMcpAutomationBridgeSubsystem::HandleEditLandscape(
     const FString &RequestId, const FString &Action,
     const TSharedPtr<FJsonObject> &Payload,
@@ -39,6 +381,8 @@ bool UMcpAutomationBridgeSubsystem::HandleEditLandscape(
   // Dispatch to specific edit operations implemented below
   if (HandleModifyHeightmap(RequestId, Action, Payload, RequestingSocket))
     return true;
+  if (HandleGetHeightmapRegion(RequestId, Action, Payload, RequestingSocket))
+    return true;
   if (HandlePaintLandscapeLayer(RequestId, Action, Payload, RequestingSocket))
     return true;
   if (HandleSculptLandscape(RequestId, Action, Payload, RequestingSocket))
@@ -174,6 +518,27 @@ bool UMcpAutomationBridgeSubsystem::HandleCreateLandscape(
     return true;
   }
 
+  // Optional initial heights, one per vertex in row-major order.
+  TArray<uint16> InitialHeights;
+  FString HeightError;
+  if (!ReadHeightSamples(Payload, InitialHeights, HeightError)) {
+    SendAutomationError(RequestingSocket, RequestId, HeightError,
+                        TEXT("INVALID_ARGUMENT"));
+    return true;
+  }
+  const int64 ExpectedHeights =
+      static_cast<int64>(ComponentsX * QuadsPerComponent + 1) *
+      (ComponentsY * QuadsPerComponent + 1);
+  if (InitialHeights.Num() > 0 && InitialHeights.Num() != ExpectedHeights) {
+    SendAutomationError(
+        RequestingSocket, RequestId,
+        FString::Printf(TEXT("heightData has %d samples; the landscape has "
+                             "%lld vertices"),
+                        InitialHeights.Num(), ExpectedHeights),
+        TEXT("INVALID_ARGUMENT"));
+    return true;
+  }
+
   // Capture parameters by value for the async task
   const int32 CaptComponentsX = ComponentsX;
   const int32 CaptComponentsY = ComponentsY;
@@ -196,7 +561,9 @@ bool UMcpAutomationBridgeSubsystem::HandleCreateLandscape(
                                         RequestingSocket, CaptComponentsX,
                                         CaptComponentsY, CaptQuadsPerComponent,
                                         CaptSectionsPerComponent, CaptLocation,
-                                        CaptMaterialPath, CaptName]() {
+                                        CaptMaterialPath, CaptName,
+                                        InitialHeights =
+                                            MoveTemp(InitialHeights)]() {
     UMcpAutomationBridgeSubsystem *Subsystem = WeakSubsystem.Get();
     if (!Subsystem)
       return;
@@ -253,7 +620,11 @@ bool UMcpAutomationBridgeSubsystem::HandleCreateLandscape(
     const int32 VertY = CaptComponentsY * CaptQuadsPerComponent + 1;
 
     TArray<uint16> HeightArray;
-    HeightArray.Init(32768, VertX * VertY);
+    if (InitialHeights.Num() == VertX * VertY) {
+      HeightArray = InitialHeights;
+    } else {
+      HeightArray.Init(32768, VertX * VertY);
+    }
 
     const int32 InMinX = 0;
     const int32 InMinY = 0;
@@ -457,23 +828,22 @@ bool UMcpAutomationBridgeSubsystem::HandleModifyHeightmap(
   Payload->TryGetStringField(TEXT("operation"), Operation);
 
   // Optional region for partial updates
-  int32 RegionMinX = -1, RegionMinY = -1, RegionMaxX = -1, RegionMaxY = -1;
-  const TSharedPtr<FJsonObject> *RegionObj = nullptr;
-  if (Payload->TryGetObjectField(TEXT("region"), RegionObj) && RegionObj) {
-    (*RegionObj)->TryGetNumberField(TEXT("minX"), RegionMinX);
-    (*RegionObj)->TryGetNumberField(TEXT("minY"), RegionMinY);
-    (*RegionObj)->TryGetNumberField(TEXT("maxX"), RegionMaxX);
-    (*RegionObj)->TryGetNumberField(TEXT("maxY"), RegionMaxY);
-  }
+  int32 RegionMinX, RegionMinY, RegionMaxX, RegionMaxY;
+  ReadHeightmapRegion(Payload, RegionMinX, RegionMinY, RegionMaxX, RegionMaxY);
 
-  const TArray<TSharedPtr<FJsonValue>> *HeightDataArray = nullptr;
-  const bool bHasHeightData = Payload->TryGetArrayField(TEXT("heightData"), HeightDataArray) &&
-                              HeightDataArray && HeightDataArray->Num() > 0;
+  // Copy height data for async task
+  TArray<uint16> HeightValues;
+  FString HeightError;
+  if (!ReadHeightSamples(Payload, HeightValues, HeightError)) {
+    SendAutomationError(RequestingSocket, RequestId, HeightError,
+                        TEXT("INVALID_ARGUMENT"));
+    return true;
+  }
 
   // For operations like raise/lower, a single value is used as delta
   // For flatten, the single value is the target height
   // For set, heightData is required
-  if (!bHasHeightData && Operation.Equals(TEXT("set"), ESearchCase::IgnoreCase)) {
+  if (HeightValues.Num() == 0 && Operation.Equals(TEXT("set"), ESearchCase::IgnoreCase)) {
     SendAutomationError(RequestingSocket, RequestId,
                         TEXT("heightData array required for 'set' operation"),
                         TEXT("INVALID_ARGUMENT"));
@@ -487,17 +857,6 @@ bool UMcpAutomationBridgeSubsystem::HandleModifyHeightmap(
   bool bSkipFlush = false;
   Payload->TryGetBoolField(TEXT("skipFlush"), bSkipFlush);
 
-  // Copy height data for async task
-  TArray<uint16> HeightValues;
-  if (bHasHeightData) {
-    for (const TSharedPtr<FJsonValue> &Val : *HeightDataArray) {
-      if (Val.IsValid() && Val->Type == EJson::Number) {
-        HeightValues.Add(
-            static_cast<uint16>(FMath::Clamp(Val->AsNumber(), 0.0, 65535.0)));
-      }
-    }
-  }
-
   TWeakObjectPtr<UMcpAutomationBridgeSubsystem> WeakSubsystem(this);
 
   // Dispatch to Game Thread
@@ -511,51 +870,8 @@ bool UMcpAutomationBridgeSubsystem::HandleModifyHeightmap(
     if (!Subsystem)
       return;
 
-    // PRIORITY 1: Find landscape in current world by name (works for transient actors)
-    ALandscape *Landscape = nullptr;
-    if (GEditor) {
-      if (UEditorActorSubsystem *ActorSS =
-              GEditor->GetEditorSubsystem<UEditorActorSubsystem>()) {
-        TArray<AActor *> AllActors = ActorSS->GetAllLevelActors();
-
-        for (AActor *A : AllActors) {
-          if (ALandscape *L = Cast<ALandscape>(A)) {
-            // Match by landscapeName if provided (actor label)
-            if (!LandscapeName.IsEmpty() &&
-                L->GetActorLabel().Equals(LandscapeName,
-                                          ESearchCase::IgnoreCase)) {
-              Landscape = L;
-              break;
-            }
-            // Match by path: compare asset path from the landscape's package
-            if (!LandscapePath.IsEmpty()) {
-              FString ActorAssetPath = L->GetPackage()->GetPathName();
-              // Normalize both paths for comparison
-              FString NormalizedRequest = LandscapePath;
-              FString NormalizedActor = ActorAssetPath;
-              NormalizedRequest.ReplaceInline(TEXT("\\"), TEXT("/"));
-              NormalizedActor.ReplaceInline(TEXT("\\"), TEXT("/"));
-              // Remove .uasset extension if present
-              if (NormalizedActor.EndsWith(TEXT(".uasset"))) {
-                NormalizedActor = NormalizedActor.LeftChop(7);
-              }
-              if (NormalizedActor.Equals(NormalizedRequest, ESearchCase::IgnoreCase)) {
-                Landscape = L;
-                break;
-              }
-            }
-          }
-        }
-
-        // NOTE: Removed silent fallback - if specific landscape requested but not found, fail
-      }
-    }
-
-    // PRIORITY 2: Try to load from disk (for saved landscape assets)
-    if (!Landscape && !LandscapePath.IsEmpty()) {
-      Landscape = Cast<ALandscape>(
-          StaticLoadObject(ALandscape::StaticClass(), nullptr, *LandscapePath));
-    }
+    // No silent fallback: a landscape that was asked for and not found fails
+    ALandscape *Landscape = FindLandscapeByNameOrPath(LandscapeName, LandscapePath);
     if (!Landscape) {
       FString ErrorMessage = LandscapeName.IsEmpty() 
           ? FString::Printf(TEXT("Landscape not found at path: %s"), *LandscapePath)
@@ -574,10 +890,6 @@ bool UMcpAutomationBridgeSubsystem::HandleModifyHeightmap(
       return;
     }
 
-    // Note: Do NOT call MakeDialog() - it blocks indefinitely in headless environments
-    FScopedSlowTask SlowTask(2.0f,
-                             FText::FromString(TEXT("Modifying heightmap...")));
-
     // Get full landscape extent first
     int32 FullMinX, FullMinY, FullMaxX, FullMaxY;
     if (!LandscapeInfo->GetLandscapeExtent(FullMinX, FullMinY, FullMaxX, FullMaxY)) {
@@ -603,80 +915,116 @@ bool UMcpAutomationBridgeSubsystem::HandleModifyHeightmap(
     const int32 SizeY = (MaxY - MinY + 1);
     const int32 RegionSize = SizeX * SizeY;
 
-    SlowTask.EnterProgressFrame(
-        1.0f, FText::FromString(TEXT("Reading current heightmap data")));
-
-    // Read current height data for the region
-    // Pass false for bInUploadTextureChangesToGPU to prevent GPU sync hang on Intel GPUs
-    TArray<uint16> CurrentHeights;
-    CurrentHeights.SetNumZeroed(RegionSize);
-    FLandscapeEditDataInterface LandscapeEditRead(LandscapeInfo, false);
-    LandscapeEditRead.GetHeightData(MinX, MinY, MaxX, MaxY, CurrentHeights.GetData(), 0);
-
-    // Prepare output height data
-    TArray<uint16> OutputHeights;
-    OutputHeights.SetNumUninitialized(RegionSize);
-
     // Get single value for operations (default: 32768 = mid-height)
     const uint16 SingleValue = HeightValues.Num() > 0 ? HeightValues[0] : 32768;
     const int16 Delta = static_cast<int16>(SingleValue) - 32768; // Convert to signed delta for raise/lower
+    const bool bRaise = Operation.Equals(TEXT("raise"), ESearchCase::IgnoreCase);
+    const bool bLower = Operation.Equals(TEXT("lower"), ESearchCase::IgnoreCase);
+    const bool bFlatten = Operation.Equals(TEXT("flatten"), ESearchCase::IgnoreCase);
+    // "set" uses heightData when it covers the region, otherwise the single value
+    const bool bSetFromValues = HeightValues.Num() == RegionSize;
+
+    // The region is walked in component-sized tiles, half-open on the
+    // component grid so a vertex shared by two components is applied once.
+    // Each tile is read, edited and written back as the rect of samples that
+    // actually changed, so components outside the edit are never touched.
+    const int32 TileSize = FMath::Max(1, Landscape->ComponentSizeQuads);
+    const int32 FirstTileX = FMath::DivideAndRoundDown(MinX, TileSize);
+    const int32 FirstTileY = FMath::DivideAndRoundDown(MinY, TileSize);
+    const int32 LastTileX = FMath::DivideAndRoundDown(MaxX, TileSize);
+    const int32 LastTileY = FMath::DivideAndRoundDown(MaxY, TileSize);
+    const int32 TileCount =
+        (LastTileX - FirstTileX + 1) * (LastTileY - FirstTileY + 1);
+
+    // Note: Do NOT call MakeDialog() - it blocks indefinitely in headless environments
+    FScopedSlowTask SlowTask(static_cast<float>(TileCount + 1),
+                             FText::FromString(TEXT("Modifying heightmap...")));
 
-    // Apply operation
+    // Pass false for bInUploadTextureChangesToGPU to prevent GPU sync hang on Intel GPUs
+    FLandscapeEditDataInterface LandscapeEdit(LandscapeInfo, false);
+    TArray<uint16> Tile;
+    TSet<ULandscapeComponent *> TouchedComponents;
     int32 ModifiedCount = 0;
-    for (int32 i = 0; i < RegionSize; ++i) {
-      uint16 NewHeight = CurrentHeights[i];
-
-      if (Operation.Equals(TEXT("raise"), ESearchCase::IgnoreCase)) {
-        // Raise by delta (positive values raise, negative lower)
-        // Use int32 to avoid overflow for heights > 32767
-        NewHeight = FMath::Clamp(static_cast<int32>(CurrentHeights[i]) + FMath::Abs(Delta) / 10, 0, 65535);
-        ModifiedCount++;
-      } else if (Operation.Equals(TEXT("lower"), ESearchCase::IgnoreCase)) {
-        // Lower by delta
-        // Use int32 to avoid overflow for heights > 32767
-        NewHeight = FMath::Clamp(static_cast<int32>(CurrentHeights[i]) - FMath::Abs(Delta) / 10, 0, 65535);
-        ModifiedCount++;
-      } else if (Operation.Equals(TEXT("flatten"), ESearchCase::IgnoreCase)) {
-        // Flatten to target height
-        NewHeight = SingleValue;
-        ModifiedCount++;
-      } else {
-        // "set" operation - use heightData if provided and matches size, otherwise use single value
-        if (HeightValues.Num() == RegionSize) {
-          NewHeight = HeightValues[i];
-        } else {
-          NewHeight = SingleValue;
+    int32 ChangedCount = 0;
+    int32 TilesWritten = 0;
+    FIntRect DirtyRect(MAX_int32, MAX_int32, MIN_int32, MIN_int32);
+
+    for (int32 TileY = FirstTileY; TileY <= LastTileY; ++TileY) {
+      const int32 Y0 = FMath::Max(MinY, TileY * TileSize);
+      const int32 Y1 = FMath::Min(MaxY, TileY * TileSize + TileSize - 1);
+      for (int32 TileX = FirstTileX; TileX <= LastTileX; ++TileX) {
+        SlowTask.EnterProgressFrame(1.0f);
+        const int32 X0 = FMath::Max(MinX, TileX * TileSize);
+        const int32 X1 = FMath::Min(MaxX, TileX * TileSize + TileSize - 1);
+        const int32 TileW = X1 - X0 + 1;
+        Tile.SetNumUninitialized(TileW * (Y1 - Y0 + 1));
+        // GetHeightData may clip the rect it is given; clip a per-tile copy
+        // so the buffer layout above and the next tile keep the real bounds.
+        int32 ReadX0 = X0, ReadY0 = Y0, ReadX1 = X1, ReadY1 = Y1;
+        LandscapeEdit.GetHeightData(ReadX0, ReadY0, ReadX1, ReadY1,
+                                    Tile.GetData(), TileW);
+
+        FIntRect TileDirty(MAX_int32, MAX_int32, MIN_int32, MIN_int32);
+        for (int32 Y = Y0; Y <= Y1; ++Y) {
+          for (int32 X = X0; X <= X1; ++X) {
+            uint16 &Height = Tile[(Y - Y0) * TileW + (X - X0)];
+            uint16 NewHeight;
+            if (bRaise) {
+              // Raise by delta; int32 avoids overflow for heights > 32767
+              NewHeight = FMath::Clamp(static_cast<int32>(Height) + FMath::Abs(Delta) / 10, 0, 65535);
+            } else if (bLower) {
+              NewHeight = FMath::Clamp(static_cast<int32>(Height) - FMath::Abs(Delta) / 10, 0, 65535);
+            } else if (bFlatten || !bSetFromValues) {
+              NewHeight = SingleValue;
+            } else {
+              NewHeight = HeightValues[(Y - MinY) * SizeX + (X - MinX)];
+            }
+            ++ModifiedCount;
+            if (NewHeight != Height) {
+              Height = NewHeight;
+              ++ChangedCount;
+              TileDirty.Min.X = FMath::Min(TileDirty.Min.X, X);
+              TileDirty.Min.Y = FMath::Min(TileDirty.Min.Y, Y);
+              TileDirty.Max.X = FMath::Max(TileDirty.Max.X, X);
+              TileDirty.Max.Y = FMath::Max(TileDirty.Max.Y, Y);
+            }
+          }
+        }
+        if (TileDirty.Min.X > TileDirty.Max.X) {
+          continue;
         }
-        ModifiedCount++;
-      }
 
-      OutputHeights[i] = NewHeight;
+        // Use bCalcNormals=false in SetHeightData to avoid blocking GPU
+        // synchronization; this prevents 60+ second hangs on large landscapes
+        const uint16 *DirtyData =
+            Tile.GetData() + (TileDirty.Min.Y - Y0) * TileW + (TileDirty.Min.X - X0);
+        LandscapeEdit.SetHeightData(TileDirty.Min.X, TileDirty.Min.Y,
+                                    TileDirty.Max.X, TileDirty.Max.Y, DirtyData,
+                                    TileW, false);
+        LandscapeInfo->GetComponentsInRegion(TileDirty.Min.X, TileDirty.Min.Y,
+                                             TileDirty.Max.X, TileDirty.Max.Y,
+                                             TouchedComponents);
+        DirtyRect.Min = DirtyRect.Min.ComponentMin(TileDirty.Min);
+        DirtyRect.Max = DirtyRect.Max.ComponentMax(TileDirty.Max);
+        ++TilesWritten;
+      }
     }
 
-    SlowTask.EnterProgressFrame(
-        1.0f, FText::FromString(TEXT("Writing heightmap data")));
-
-    // Write the modified height data
-    // Pass false for bInUploadTextureChangesToGPU to prevent GPU sync hang on Intel GPUs
-    // Use bForce=false in SetHeightData to avoid blocking GPU synchronization
-    // This prevents 60+ second hangs on large landscapes
-    FLandscapeEditDataInterface LandscapeEditWrite(LandscapeInfo, false);
-    LandscapeEditWrite.SetHeightData(MinX, MinY, MaxX, MaxY, OutputHeights.GetData(),
-                                     SizeX, false);
-
     // Flush is expensive - it forces render thread synchronization
     // Skip if requested for batch operations, but note that changes
     // won't be visible until the next flush or edit operation
-    if (!bSkipFlush) {
-      SlowTask.EnterProgressFrame(
-          1.0f, FText::FromString(TEXT("Flushing changes to GPU")));
-      LandscapeEditWrite.Flush();
+    SlowTask.EnterProgressFrame(
+        1.0f, FText::FromString(TEXT("Flushing changes to GPU")));
+    if (!bSkipFlush && TilesWritten > 0) {
+      LandscapeEdit.Flush();
     }
-    
+
     // Use MarkPackageDirty instead of PostEditChange to avoid full landscape rebuild
     // PostEditChange triggers collision rebuild, shader recompilation, and nav mesh update
     // which can take 60+ seconds for large landscapes
-    Landscape->MarkPackageDirty();
+    if (TilesWritten > 0) {
+      Landscape->MarkPackageDirty();
+    }
 
     TSharedPtr<FJsonObject> Resp = MakeShared<FJsonObject>();
     Resp->SetBoolField(TEXT("success"), true);
@@ -684,8 +1032,20 @@ bool UMcpAutomationBridgeSubsystem::HandleModifyHeightmap(
     Resp->SetStringField(TEXT("landscapeName"), Landscape->GetActorLabel());
     Resp->SetStringField(TEXT("operation"), Operation);
     Resp->SetNumberField(TEXT("modifiedVertices"), ModifiedCount);
+    Resp->SetNumberField(TEXT("changedVertices"), ChangedCount);
     Resp->SetNumberField(TEXT("regionSizeX"), SizeX);
     Resp->SetNumberField(TEXT("regionSizeY"), SizeY);
+    Resp->SetNumberField(TEXT("tileSize"), TileSize);
+    Resp->SetNumberField(TEXT("tilesWritten"), TilesWritten);
+    Resp->SetNumberField(TEXT("componentsTouched"), TouchedComponents.Num());
+    if (TilesWritten > 0) {
+      TSharedPtr<FJsonObject> DirtyObj = MakeShared<FJsonObject>();
+      DirtyObj->SetNumberField(TEXT("minX"), DirtyRect.Min.X);
+      DirtyObj->SetNumberField(TEXT("minY"), DirtyRect.Min.Y);
+      DirtyObj->SetNumberField(TEXT("maxX"), DirtyRect.Max.X);
+      DirtyObj->SetNumberField(TEXT("maxY"), DirtyRect.Max.Y);
+      Resp->SetObjectField(TEXT("dirtyRect"), DirtyObj);
+    }
     Resp->SetBoolField(TEXT("flushSkipped"), bSkipFlush);
     
     // Add verification data
@@ -705,6 +1065,137 @@ bool UMcpAutomationBridgeSubsystem::HandleModifyHeightmap(
 #endif
 }
 
+bool UMcpAutomationBridgeSubsystem::HandleGetHeightmapRegion(
+    const FString &RequestId, const FString &Action,
+    const TSharedPtr<FJsonObject> &Payload,
+    TSharedPtr<FMcpBridgeWebSocket> RequestingSocket) {
+  const FString Lower = Action.ToLower();
+  if (!Lower.Equals(TEXT("get_heightmap_region"), ESearchCase::IgnoreCase)) {
+    return false;
+  }
+
+#if WITH_EDITOR
+  if (!Payload.IsValid()) {
+    SendAutomationError(RequestingSocket, RequestId,
+                        TEXT("get_heightmap_region payload missing"),
+                        TEXT("INVALID_PAYLOAD"));
+    return true;
+  }
+
+  FString LandscapePath;
+  Payload->TryGetStringField(TEXT("landscapePath"), LandscapePath);
+  FString LandscapeName;
+  Payload->TryGetStringField(TEXT("landscapeName"), LandscapeName);
+  if (!LandscapePath.IsEmpty()) {
+    FString SafePath = SanitizeProjectRelativePath(LandscapePath);
+    if (SafePath.IsEmpty()) {
+      SendAutomationError(RequestingSocket, RequestId,
+                          FString::Printf(TEXT("Invalid or unsafe landscape path: %s"), *LandscapePath),
+                          TEXT("SECURITY_VIOLATION"));
+      return true;
+    }
+    LandscapePath = SafePath;
+  }
+
+  ALandscape *Landscape = FindLandscapeByNameOrPath(LandscapeName, LandscapePath);
+  ULandscapeInfo *LandscapeInfo = Landscape ? Landscape->GetLandscapeInfo() : nullptr;
+  if (!LandscapeInfo) {
+    SendAutomationError(
+        RequestingSocket, RequestId,
+        FString::Printf(TEXT("Landscape '%s' not found (path: %s)"),
+                        *LandscapeName, *LandscapePath),
+        TEXT("LANDSCAPE_NOT_FOUND"));
+    return true;
+  }
+
+  int32 FullMinX, FullMinY, FullMaxX, FullMaxY;
+  if (!LandscapeInfo->GetLandscapeExtent(FullMinX, FullMinY, FullMaxX, FullMaxY)) {
+    SendAutomationError(RequestingSocket, RequestId,
+                        TEXT("Failed to get landscape extent"),
+                        TEXT("INVALID_LANDSCAPE"));
+    return true;
+  }
+
+  int32 MinX, MinY, MaxX, MaxY;
+  ReadHeightmapRegion(Payload, MinX, MinY, MaxX, MaxY);
+  MinX = FMath::Clamp(MinX >= 0 ? MinX : FullMinX, FullMinX, FullMaxX);
+  MinY = FMath::Clamp(MinY >= 0 ? MinY : FullMinY, FullMinY, FullMaxY);
+  MaxX = FMath::Clamp(MaxX >= 0 ? MaxX : FullMaxX, MinX, FullMaxX);
+  MaxY = FMath::Clamp(MaxY >= 0 ? MaxY : FullMaxY, MinY, FullMaxY);
+
+  const int32 SizeX = MaxX - MinX + 1;
+  const int32 SizeY = MaxY - MinY + 1;
+  if (static_cast<int64>(SizeX) * SizeY > MaxHeightmapRegionSamples) {
+    SendAutomationError(
+        RequestingSocket, RequestId,
+        FString::Printf(TEXT("Region of %dx%d samples exceeds the %lld sample "
+                             "limit; request it as several regions"),
+                        SizeX, SizeY, MaxHeightmapRegionSamples),
+        TEXT("REGION_TOO_LARGE"));
+    return true;
+  }
+
+  // Read a component-sized tile at a time straight into the output rows, so
+  // the edit interface never caches more than one tile's components at once.
+  const int32 TileSize = FMath::Max(1, Landscape->ComponentSizeQuads);
+  TArray<uint8> Bytes;
+  Bytes.SetNumUninitialized(SizeX * SizeY * sizeof(uint16));
+  uint16 *Heights = reinterpret_cast<uint16 *>(Bytes.GetData());
+  {
+    FLandscapeEditDataInterface LandscapeEdit(LandscapeInfo, false);
+    const int32 LastTileX = FMath::DivideAndRoundDown(MaxX, TileSize);
+    const int32 LastTileY = FMath::DivideAndRoundDown(MaxY, TileSize);
+    for (int32 TileY = FMath::DivideAndRoundDown(MinY, TileSize); TileY <= LastTileY; ++TileY) {
+      const int32 Y0 = FMath::Max(MinY, TileY * TileSize);
+      const int32 Y1 = FMath::Min(MaxY, TileY * TileSize + TileSize - 1);
+      for (int32 TileX = FMath::DivideAndRoundDown(MinX, TileSize); TileX <= LastTileX; ++TileX) {
+        const int32 X0 = FMath::Max(MinX, TileX * TileSize);
+        const int32 X1 = FMath::Min(MaxX, TileX * TileSize + TileSize - 1);
+        // The read may clip its rect; the destination offset uses the
+        // unclipped tile origin and later tiles start from fresh bounds.
+        int32 ReadX0 = X0, ReadY0 = Y0, ReadX1 = X1, ReadY1 = Y1;
+        LandscapeEdit.GetHeightData(ReadX0, ReadY0, ReadX1, ReadY1,
+                                    Heights + (Y0 - MinY) * SizeX + (X0 - MinX),
+                                    SizeX);
+      }
+    }
+  }
+
+  TSharedPtr<FJsonObject> HeightObj = MakeShared<FJsonObject>();
+  HeightObj->SetStringField(TEXT("layout"), TEXT("u16"));
+  HeightObj->SetNumberField(TEXT("count"), SizeX * SizeY);
+  HeightObj->SetStringField(TEXT("field"), TEXT("heightDataData"));
+  HeightObj->SetStringField(
+      TEXT("attachmentId"),
+      AttachBinaryPayload(RequestId, MoveTemp(Bytes),
+                          TEXT("application/octet-stream"),
+                          TEXT("heightDataData")));
+
+  TSharedPtr<FJsonObject> RegionObj = MakeShared<FJsonObject>();
+  RegionObj->SetNumberField(TEXT("minX"), MinX);
+  RegionObj->SetNumberField(TEXT("minY"), MinY);
+  RegionObj->SetNumberField(TEXT("maxX"), MaxX);
+  RegionObj->SetNumberField(TEXT("maxY"), MaxY);
+
+  TSharedPtr<FJsonObject> Resp = MakeShared<FJsonObject>();
+  Resp->SetBoolField(TEXT("success"), true);
+  Resp->SetStringField(TEXT("landscapeName"), Landscape->GetActorLabel());
+  Resp->SetObjectField(TEXT("region"), RegionObj);
+  Resp->SetNumberField(TEXT("sizeX"), SizeX);
+  Resp->SetNumberField(TEXT("sizeY"), SizeY);
+  Resp->SetNumberField(TEXT("tileSize"), TileSize);
+  Resp->SetObjectField(TEXT("heightData"), HeightObj);
+  SendAutomationResponse(RequestingSocket, RequestId, true,
+                         TEXT("Heightmap region retrieved"), Resp, FString());
+  return true;
+#else
+  SendAutomationResponse(RequestingSocket, RequestId, false,
+                         TEXT("get_heightmap_region requires editor build."),
+                         nullptr, TEXT("NOT_IMPLEMENTED"));
+  return true;
+#endif
+}
+
 bool UMcpAutomationBridgeSubsystem::HandlePaintLandscapeLayer(
     const FString &RequestId, const FString &Action,
     const TSharedPtr<FJsonObject> &Payload,
@@ -761,6 +1252,22 @@ bool UMcpAutomationBridgeSubsystem::HandlePaintLandscapeLayer(
   Payload->TryGetNumberField(TEXT("strength"), Strength);
   Strength = FMath::Clamp(Strength, 0.0, 1.0);
 
+  // Optional brush stroke: dabs blend the layer weight toward full, instead
+  // of filling the region with one value
+  FLandscapeStrokeDab Brush;
+  Brush.Radius = 1000.0;
+  Brush.Falloff = 0.5;
+  Brush.Strength = Strength;
+  Payload->TryGetNumberField(TEXT("brushRadius"), Brush.Radius);
+  Payload->TryGetNumberField(TEXT("brushFalloff"), Brush.Falloff);
+  TArray<FLandscapeStrokeDab> Dabs;
+  FString StrokeError;
+  if (!ReadLandscapeStroke(Payload, Brush, Dabs, StrokeError)) {
+    SendAutomationError(RequestingSocket, RequestId, StrokeError,
+                        TEXT("INVALID_ARGUMENT"));
+    return true;
+  }
+
   // Optional: Skip the expensive Flush() operation for performance
   bool bSkipFlush = false;
   Payload->TryGetBoolField(TEXT("skipFlush"), bSkipFlush);
@@ -770,57 +1277,14 @@ bool UMcpAutomationBridgeSubsystem::HandlePaintLandscapeLayer(
   AsyncTask(ENamedThreads::GameThread, [WeakSubsystem, RequestId,
                                         RequestingSocket, LandscapePath,
                                         LandscapeName, LayerName, MinX, MinY,
-                                        MaxX, MaxY, Strength, bSkipFlush]() {
+                                        MaxX, MaxY, Strength,
+                                        Dabs = MoveTemp(Dabs), bSkipFlush]() {
     UMcpAutomationBridgeSubsystem *Subsystem = WeakSubsystem.Get();
     if (!Subsystem)
       return;
 
-    // PRIORITY 1: Find landscape in current world by name (works for transient actors)
-    ALandscape *Landscape = nullptr;
-    if (GEditor) {
-      if (UEditorActorSubsystem *ActorSS =
-              GEditor->GetEditorSubsystem<UEditorActorSubsystem>()) {
-        TArray<AActor *> AllActors = ActorSS->GetAllLevelActors();
-
-        for (AActor *A : AllActors) {
-          if (ALandscape *L = Cast<ALandscape>(A)) {
-            // Match by landscapeName if provided (actor label)
-            if (!LandscapeName.IsEmpty() &&
-                L->GetActorLabel().Equals(LandscapeName,
-                                          ESearchCase::IgnoreCase)) {
-              Landscape = L;
-              break;
-            }
-            // Match by path: compare asset path from the landscape's package
-            if (!LandscapePath.IsEmpty()) {
-              FString ActorAssetPath = L->GetPackage()->GetPathName();
-              // Normalize both paths for comparison
-              FString NormalizedRequest = LandscapePath;
-              FString NormalizedActor = ActorAssetPath;
-              NormalizedRequest.ReplaceInline(TEXT("\\"), TEXT("/"));
-              NormalizedActor.ReplaceInline(TEXT("\\"), TEXT("/"));
-              // Remove .uasset extension if present
-              if (NormalizedActor.EndsWith(TEXT(".uasset"))) {
-                NormalizedActor = NormalizedActor.LeftChop(7);
-              }
-              if (NormalizedActor.Equals(NormalizedRequest, ESearchCase::IgnoreCase)) {
-                Landscape = L;
-                break;
-              }
-            }
-          }
-        }
-
-        // NOTE: Removed silent fallback to single landscape - this was causing false positives
-        // If a specific landscape was requested but not found, we should fail, not silently use another
-      }
-    }
-
-    // PRIORITY 2: Try to load from disk (for saved landscape assets)
-    if (!Landscape && !LandscapePath.IsEmpty()) {
-      Landscape = Cast<ALandscape>(
-          StaticLoadObject(ALandscape::StaticClass(), nullptr, *LandscapePath));
-    }
+    // No silent fallback: a landscape that was asked for and not found fails
+    ALandscape *Landscape = FindLandscapeByNameOrPath(LandscapeName, LandscapePath);
     if (!Landscape) {
       // Provide helpful error message distinguishing between "no landscape found" and "wrong name"
       FString ErrorMessage = LandscapeName.IsEmpty() 
@@ -892,6 +1356,89 @@ bool UMcpAutomationBridgeSubsystem::HandlePaintLandscapeLayer(
     FScopedSlowTask SlowTask(
         1.0f, FText::FromString(TEXT("Painting landscape layer...")));
 
+    if (Dabs.Num() > 0) {
+      TArray<FLandscapeVertexDab> VertexDabs;
+      FIntRect Rect;
+      if (!ToLandscapeVertexDabs(Landscape, LandscapeInfo, Dabs, VertexDabs,
+                                 Rect)) {
+        Subsystem->SendAutomationResponse(
+            RequestingSocket, RequestId, false,
+            TEXT("Brush outside landscape bounds"), nullptr,
+            TEXT("OUT_OF_BOUNDS"));
+        return;
+      }
+      int32 StrokeMinX = Rect.Min.X, StrokeMinY = Rect.Min.Y;
+      int32 StrokeMaxX = Rect.Max.X, StrokeMaxY = Rect.Max.Y;
+      const int32 SizeX = StrokeMaxX - StrokeMinX + 1;
+      const int32 SizeY = StrokeMaxY - StrokeMinY + 1;
+      if (static_cast<int64>(SizeX) * SizeY > MaxHeightmapRegionSamples) {
+        Subsystem->SendAutomationError(
+            RequestingSocket, RequestId,
+            FString::Printf(TEXT("Stroke covers %dx%d vertices; split it "
+                                 "into smaller strokes"),
+                            SizeX, SizeY),
+            TEXT("STROKE_TOO_LARGE"));
+        return;
+      }
+
+      // One read and one write of the stroke's bounding rect
+      TArray<uint8> WeightData;
+      WeightData.SetNumZeroed(SizeX * SizeY);
+      FLandscapeEditDataInterface LandscapeEdit(LandscapeInfo, false);
+      LandscapeEdit.GetWeightData(LayerInfo, StrokeMinX, StrokeMinY,
+                                  StrokeMaxX, StrokeMaxY, WeightData.GetData(),
+                                  0);
+      TArray<float> Weights;
+      Weights.SetNumUninitialized(WeightData.Num());
+      for (int32 Index = 0; Index < WeightData.Num(); ++Index) {
+        Weights[Index] = WeightData[Index];
+      }
+      RasterizeLandscapeStroke(
+          VertexDabs, Rect, Weights,
+          [](float &Weight, float Alpha, const FLandscapeVertexDab &Dab) {
+            Weight += (255.0f - Weight) * Dab.Strength * Alpha;
+          });
+
+      int32 ModifiedCount = 0;
+      for (int32 Index = 0; Index < WeightData.Num(); ++Index) {
+        const uint8 NewWeight = static_cast<uint8>(
+            FMath::Clamp(FMath::RoundToInt(Weights[Index]), 0, 255));
+        if (NewWeight != WeightData[Index]) {
+          WeightData[Index] = NewWeight;
+          ++ModifiedCount;
+        }
+      }
+      if (ModifiedCount > 0) {
+        LandscapeEdit.SetAlphaData(LayerInfo, StrokeMinX, StrokeMinY,
+                                   StrokeMaxX, StrokeMaxY, WeightData.GetData(),
+                                   SizeX);
+        if (!bSkipFlush) {
+          LandscapeEdit.Flush();
+        }
+        Landscape->MarkPackageDirty();
+      }
+
+      TSharedPtr<FJsonObject> Bounds = MakeShared<FJsonObject>();
+      Bounds->SetNumberField(TEXT("minX"), StrokeMinX);
+      Bounds->SetNumberField(TEXT("minY"), StrokeMinY);
+      Bounds->SetNumberField(TEXT("maxX"), StrokeMaxX);
+      Bounds->SetNumberField(TEXT("maxY"), StrokeMaxY);
+
+      TSharedPtr<FJsonObject> Resp = MakeShared<FJsonObject>();
+      Resp->SetBoolField(TEXT("success"), true);
+      Resp->SetStringField(TEXT("landscapePath"), Landscape->GetPackage()->GetPathName());
+      Resp->SetStringField(TEXT("landscapeName"), Landscape->GetActorLabel());
+      Resp->SetStringField(TEXT("layerName"), LayerName);
+      Resp->SetNumberField(TEXT("strength"), Strength);
+      Resp->SetNumberField(TEXT("modifiedVertices"), ModifiedCount);
+      Resp->SetNumberField(TEXT("dabCount"), VertexDabs.Num());
+      Resp->SetObjectField(TEXT("bounds"), Bounds);
+      Subsystem->SendAutomationResponse(RequestingSocket, RequestId, true,
+                                        TEXT("Layer stroke painted"), Resp,
+                                        FString());
+      return;
+    }
+
     int32 PaintMinX = MinX;
     int32 PaintMinY = MinY;
     int32 PaintMaxX = MaxX;
@@ -982,38 +1529,44 @@ bool UMcpAutomationBridgeSubsystem::HandleSculptLandscape(
          TEXT("HandleSculptLandscape: RequestId=%s Path='%s' Name='%s'"),
          *RequestId, *LandscapePath, *LandscapeName);
 
-  double LocX = 0, LocY = 0, LocZ = 0;
-  const TSharedPtr<FJsonObject> *LocObj = nullptr;
-  // Accept both 'location' and 'position' parameter names for consistency
-  if (Payload->TryGetObjectField(TEXT("location"), LocObj) && LocObj) {
-    (*LocObj)->TryGetNumberField(TEXT("x"), LocX);
-    (*LocObj)->TryGetNumberField(TEXT("y"), LocY);
-    (*LocObj)->TryGetNumberField(TEXT("z"), LocZ);
-  } else if (Payload->TryGetObjectField(TEXT("position"), LocObj) && LocObj) {
-    (*LocObj)->TryGetNumberField(TEXT("x"), LocX);
-    (*LocObj)->TryGetNumberField(TEXT("y"), LocY);
-    (*LocObj)->TryGetNumberField(TEXT("z"), LocZ);
-  } else {
-    SendAutomationError(
-        RequestingSocket, RequestId,
-        TEXT("location or position required. Example: {\"location\": {\"x\": "
-             "0, \"y\": 0, \"z\": 100}}"),
-        TEXT("INVALID_ARGUMENT"));
-    return true;
-  }
-  FVector TargetLocation(LocX, LocY, LocZ);
-
   FString ToolMode = TEXT("Raise");
   Payload->TryGetStringField(TEXT("toolMode"), ToolMode);
 
-  double BrushRadius = 1000.0;
-  Payload->TryGetNumberField(TEXT("brushRadius"), BrushRadius);
-
-  double BrushFalloff = 0.5;
-  Payload->TryGetNumberField(TEXT("brushFalloff"), BrushFalloff);
-
-  double Strength = 0.1;
-  Payload->TryGetNumberField(TEXT("strength"), Strength);
+  // Brush settings; a stroke's points fall back to these
+  FLandscapeStrokeDab Brush;
+  Brush.Radius = 1000.0;
+  Brush.Falloff = 0.5;
+  Brush.Strength = 0.1;
+  Payload->TryGetNumberField(TEXT("brushRadius"), Brush.Radius);
+  Payload->TryGetNumberField(TEXT("brushFalloff"), Brush.Falloff);
+  Payload->TryGetNumberField(TEXT("strength"), Brush.Strength);
+
+  // A stroke applies many dabs in one edit; otherwise one dab at location
+  TArray<FLandscapeStrokeDab> Dabs;
+  FString StrokeError;
+  if (!ReadLandscapeStroke(Payload, Brush, Dabs, StrokeError)) {
+    SendAutomationError(RequestingSocket, RequestId, StrokeError,
+                        TEXT("INVALID_ARGUMENT"));
+    return true;
+  }
+  if (Dabs.Num() == 0) {
+    // Accept both 'location' and 'position' parameter names for consistency
+    const TSharedPtr<FJsonObject> *LocObj = nullptr;
+    if ((Payload->TryGetObjectField(TEXT("location"), LocObj) && LocObj) ||
+        (Payload->TryGetObjectField(TEXT("position"), LocObj) && LocObj)) {
+      (*LocObj)->TryGetNumberField(TEXT("x"), Brush.Location.X);
+      (*LocObj)->TryGetNumberField(TEXT("y"), Brush.Location.Y);
+      (*LocObj)->TryGetNumberField(TEXT("z"), Brush.Location.Z);
+    } else {
+      SendAutomationError(
+          RequestingSocket, RequestId,
+          TEXT("location, position or stroke required. Example: "
+               "{\"location\": {\"x\": 0, \"y\": 0, \"z\": 100}}"),
+          TEXT("INVALID_ARGUMENT"));
+      return true;
+    }
+    Dabs.Add(Brush);
+  }
 
   // Optional: Skip the expensive Flush() operation for performance
   bool bSkipFlush = false;
@@ -1023,57 +1576,14 @@ bool UMcpAutomationBridgeSubsystem::HandleSculptLandscape(
 
   AsyncTask(ENamedThreads::GameThread, [WeakSubsystem, RequestId,
                                         RequestingSocket, LandscapePath,
-                                        LandscapeName, TargetLocation, ToolMode,
-                                        BrushRadius, BrushFalloff, Strength, bSkipFlush]() {
+                                        LandscapeName, Dabs = MoveTemp(Dabs),
+                                        ToolMode, bSkipFlush]() {
     UMcpAutomationBridgeSubsystem *Subsystem = WeakSubsystem.Get();
     if (!Subsystem)
       return;
 
-    // PRIORITY 1: Find landscape in current world by name (works for transient actors)
-    ALandscape *Landscape = nullptr;
-    if (GEditor) {
-      if (UEditorActorSubsystem *ActorSS =
-              GEditor->GetEditorSubsystem<UEditorActorSubsystem>()) {
-        TArray<AActor *> AllActors = ActorSS->GetAllLevelActors();
-
-        for (AActor *A : AllActors) {
-          if (ALandscape *L = Cast<ALandscape>(A)) {
-            // Match by landscapeName if provided (actor label)
-            if (!LandscapeName.IsEmpty() &&
-                L->GetActorLabel().Equals(LandscapeName,
-                                          ESearchCase::IgnoreCase)) {
-              Landscape = L;
-              break;
-            }
-            // Match by path: compare asset path from the landscape's package
-            if (!LandscapePath.IsEmpty()) {
-              FString ActorAssetPath = L->GetPackage()->GetPathName();
-              // Normalize both paths for comparison
-              FString NormalizedRequest = LandscapePath;
-              FString NormalizedActor = ActorAssetPath;
-              NormalizedRequest.ReplaceInline(TEXT("\\"), TEXT("/"));
-              NormalizedActor.ReplaceInline(TEXT("\\"), TEXT("/"));
-              // Remove .uasset extension if present
-              if (NormalizedActor.EndsWith(TEXT(".uasset"))) {
-                NormalizedActor = NormalizedActor.LeftChop(7);
-              }
-              if (NormalizedActor.Equals(NormalizedRequest, ESearchCase::IgnoreCase)) {
-                Landscape = L;
-                break;
-              }
-            }
-          }
-        }
-
-        // NOTE: Removed silent fallback - if specific landscape requested but not found, fail
-      }
-    }
-
-    // PRIORITY 2: Try to load from disk (for saved landscape assets)
-    if (!Landscape && !LandscapePath.IsEmpty()) {
-      Landscape = Cast<ALandscape>(
-          StaticLoadObject(ALandscape::StaticClass(), nullptr, *LandscapePath));
-    }
+    // No silent fallback: a landscape that was asked for and not found fails
+    ALandscape *Landscape = FindLandscapeByNameOrPath(LandscapeName, LandscapePath);
     if (!Landscape) {
       FString ErrorMessage = LandscapeName.IsEmpty() 
           ? FString::Printf(TEXT("Landscape not found at path: %s"), *LandscapePath)
@@ -1092,98 +1602,74 @@ bool UMcpAutomationBridgeSubsystem::HandleSculptLandscape(
       return;
     }
 
-    // Convert World Location to Landscape Local Space
-    FVector LocalPos =
-        Landscape->GetActorTransform().InverseTransformPosition(TargetLocation);
-    int32 CenterX = FMath::RoundToInt(LocalPos.X);
-    int32 CenterY = FMath::RoundToInt(LocalPos.Y);
-
-    // Convert Brush Radius to Vertex Units (assuming uniform scale for
-    // simplicity, or use X)
-    float ScaleX = Landscape->GetActorScale3D().X;
-    int32 RadiusVerts = FMath::Max(1, FMath::RoundToInt(BrushRadius / ScaleX));
-    int32 FalloffVerts = FMath::RoundToInt(RadiusVerts * BrushFalloff);
-
-    int32 MinX = CenterX - RadiusVerts;
-    int32 MaxX = CenterX + RadiusVerts;
-    int32 MinY = CenterY - RadiusVerts;
-    int32 MaxY = CenterY + RadiusVerts;
-
-    // Clamp to landscape extents
-    int32 LMinX, LMinY, LMaxX, LMaxY;
-    if (LandscapeInfo->GetLandscapeExtent(LMinX, LMinY, LMaxX, LMaxY)) {
-      MinX = FMath::Max(MinX, LMinX);
-      MinY = FMath::Max(MinY, LMinY);
-      MaxX = FMath::Min(MaxX, LMaxX);
-      MaxY = FMath::Min(MaxY, LMaxY);
-    }
-
-    if (MinX > MaxX || MinY > MaxY) {
+    TArray<FLandscapeVertexDab> VertexDabs;
+    FIntRect Rect;
+    if (!ToLandscapeVertexDabs(Landscape, LandscapeInfo, Dabs, VertexDabs, Rect)) {
       Subsystem->SendAutomationResponse(RequestingSocket, RequestId, false,
                                         TEXT("Brush outside landscape bounds"),
                                         nullptr, TEXT("OUT_OF_BOUNDS"));
       return;
     }
+    int32 MinX = Rect.Min.X, MinY = Rect.Min.Y;
+    int32 MaxX = Rect.Max.X, MaxY = Rect.Max.Y;
+    const int32 SizeX = MaxX - MinX + 1;
+    const int32 SizeY = MaxY - MinY + 1;
+    if (static_cast<int64>(SizeX) * SizeY > MaxHeightmapRegionSamples) {
+      Subsystem->SendAutomationError(
+          RequestingSocket, RequestId,
+          FString::Printf(TEXT("Stroke covers %dx%d vertices; split it into "
+                               "smaller strokes"),
+                          SizeX, SizeY),
+          TEXT("STROKE_TOO_LARGE"));
+      return;
+    }
 
-    int32 SizeX = MaxX - MinX + 1;
-    int32 SizeY = MaxY - MinY + 1;
+    // One read of the stroke's bounding rect
+    // Pass false for bInUploadTextureChangesToGPU to prevent GPU sync hang on Intel GPUs
     TArray<uint16> HeightData;
     HeightData.SetNumZeroed(SizeX * SizeY);
-
-    // Pass false for bInUploadTextureChangesToGPU to prevent GPU sync hang on Intel GPUs
     FLandscapeEditDataInterface LandscapeEdit(LandscapeInfo, false);
     LandscapeEdit.GetHeightData(MinX, MinY, MaxX, MaxY, HeightData.GetData(),
                                 0);
 
-    bool bModified = false;
-    for (int32 Y = MinY; Y <= MaxY; ++Y) {
-      for (int32 X = MinX; X <= MaxX; ++X) {
-        float Dist = FMath::Sqrt(FMath::Square((float)(X - CenterX)) +
-                                 FMath::Square((float)(Y - CenterY)));
-        if (Dist > RadiusVerts)
-          continue;
-
-        float Alpha = 1.0f;
-        if (Dist > (RadiusVerts - FalloffVerts)) {
-          Alpha = 1.0f -
-                  ((Dist - (RadiusVerts - FalloffVerts)) / (float)FalloffVerts);
-        }
-        Alpha = FMath::Clamp(Alpha, 0.0f, 1.0f);
-
-        int32 Index = (Y - MinY) * SizeX + (X - MinX);
-        if (Index < 0 || Index >= HeightData.Num())
-          continue;
+    TArray<float> Heights;
+    Heights.SetNumUninitialized(HeightData.Num());
+    for (int32 Index = 0; Index < HeightData.Num(); ++Index) {
+      Heights[Index] = HeightData[Index];
+    }
 
-        uint16 CurrentHeight = HeightData[Index];
-
-        float ScaleZ = Landscape->GetActorScale3D().Z;
-        float HeightScale =
-            128.0f / ScaleZ; // Conversion factor from World Z to uint16
-
-        float Delta = 0.0f;
-        if (ToolMode.Equals(TEXT("Raise"), ESearchCase::IgnoreCase)) {
-          Delta = Strength * Alpha * 100.0f *
-                  HeightScale; // Arbitrary strength multiplier
-        } else if (ToolMode.Equals(TEXT("Lower"), ESearchCase::IgnoreCase)) {
-          Delta = -Strength * Alpha * 100.0f * HeightScale;
-        } else if (ToolMode.Equals(TEXT("Flatten"), ESearchCase::IgnoreCase)) {
-          float CurrentVal = (float)CurrentHeight;
-          float Target = (TargetLocation.Z - Landscape->GetActorLocation().Z) /
-                             ScaleZ * 128.0f +
-                         32768.0f;
-          Delta = (Target - CurrentVal) * Strength * Alpha;
-        }
+    // Conversion factor from World Z to uint16
+    const float HeightScale = 128.0f / Landscape->GetActorScale3D().Z;
+    if (ToolMode.Equals(TEXT("Raise"), ESearchCase::IgnoreCase)) {
+      RasterizeLandscapeStroke(VertexDabs, Rect, Heights,
+          [HeightScale](float &Height, float Alpha, const FLandscapeVertexDab &Dab) {
+            // Arbitrary strength multiplier
+            Height += Dab.Strength * Alpha * 100.0f * HeightScale;
+          });
+    } else if (ToolMode.Equals(TEXT("Lower"), ESearchCase::IgnoreCase)) {
+      RasterizeLandscapeStroke(VertexDabs, Rect, Heights,
+          [HeightScale](float &Height, float Alpha, const FLandscapeVertexDab &Dab) {
+            Height -= Dab.Strength * Alpha * 100.0f * HeightScale;
+          });
+    } else if (ToolMode.Equals(TEXT("Flatten"), ESearchCase::IgnoreCase)) {
+      RasterizeLandscapeStroke(VertexDabs, Rect, Heights,
+          [](float &Height, float Alpha, const FLandscapeVertexDab &Dab) {
+            Height += (Dab.Target - Height) * Dab.Strength * Alpha;
+          });
+    }
 
-        int32 NewHeight =
-            FMath::Clamp((int32)(CurrentHeight + Delta), 0, 65535);
-        if (NewHeight != CurrentHeight) {
-          HeightData[Index] = (uint16)NewHeight;
-          bModified = true;
-        }
+    int32 ModifiedCount = 0;
+    for (int32 Index = 0; Index < HeightData.Num(); ++Index) {
+      const uint16 NewHeight =
+          static_cast<uint16>(FMath::Clamp((int32)Heights[Index], 0, 65535));
+      if (NewHeight != HeightData[Index]) {
+        HeightData[Index] = NewHeight;
+        ++ModifiedCount;
       }
     }
 
-    if (bModified) {
+    if (ModifiedCount > 0) {
+      // The whole stroke is committed with one write
       LandscapeEdit.SetHeightData(MinX, MinY, MaxX, MaxY, HeightData.GetData(),
                                   0, true);
 
@@ -1198,11 +1684,18 @@ bool UMcpAutomationBridgeSubsystem::HandleSculptLandscape(
       Landscape->MarkPackageDirty();
     }
 
+    TSharedPtr<FJsonObject> Bounds = MakeShared<FJsonObject>();
+    Bounds->SetNumberField(TEXT("minX"), MinX);
+    Bounds->SetNumberField(TEXT("minY"), MinY);
+    Bounds->SetNumberField(TEXT("maxX"), MaxX);
+    Bounds->SetNumberField(TEXT("maxY"), MaxY);
+
     TSharedPtr<FJsonObject> Resp = MakeShared<FJsonObject>();
     Resp->SetBoolField(TEXT("success"), true);
     Resp->SetStringField(TEXT("toolMode"), ToolMode);
-    Resp->SetNumberField(TEXT("modifiedVertices"),
-                         bModified ? HeightData.Num() : 0);
+    Resp->SetNumberField(TEXT("modifiedVertices"), ModifiedCount);
+    Resp->SetNumberField(TEXT("dabCount"), VertexDabs.Num());
+    Resp->SetObjectField(TEXT("bounds"), Bounds);
 
     Subsystem->SendAutomationResponse(RequestingSocket, RequestId, true,
                                       TEXT("Landscape sculpted"), Resp,
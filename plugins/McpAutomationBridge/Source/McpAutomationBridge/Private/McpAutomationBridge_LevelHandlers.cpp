@@ -2,6 +2,7 @@
 #include "Dom/JsonObject.h"
 #include "McpAutomationBridgeHelpers.h"
 #include "McpAutomationBridgeSubsystem.h"
+#include "McpActorQuery.h"
 
 #if WITH_EDITOR
 #include "Editor.h"
@@ -741,13 +742,12 @@ TSharedPtr<FJsonObject> Resp = MakeShared<FJsonObject>();
   }
   if (EffectiveAction == TEXT("build_lighting") ||
       EffectiveAction == TEXT("bake_lightmap")) {
-    TSharedPtr<FJsonObject> P = MakeShared<FJsonObject>();
+    // Forward the whole payload so waitForCompletion, timeoutSeconds and
+    // buildReflectionCaptures reach the tracked build.
+    TSharedPtr<FJsonObject> P = Payload.IsValid()
+                                    ? MakeShared<FJsonObject>(*Payload)
+                                    : MakeShared<FJsonObject>();
     P->SetStringField(TEXT("functionName"), TEXT("BUILD_LIGHTING"));
-    if (Payload.IsValid()) {
-      FString Q;
-      if (Payload->TryGetStringField(TEXT("quality"), Q) && !Q.IsEmpty())
-        P->SetStringField(TEXT("quality"), Q);
-    }
     return HandleExecuteEditorFunction(
         RequestId, TEXT("execute_editor_function"), P, RequestingSocket);
   }
@@ -2079,19 +2079,46 @@ TSharedPtr<FJsonObject> Resp = MakeShared<FJsonObject>();
       return true;
     }
     
-    TArray<TSharedPtr<FJsonValue>> ActorsArray;
-    for (AActor* Actor : TargetLevel->Actors) {
-      if (Actor) {
-        ActorsArray.Add(MakeShared<FJsonValueString>(Actor->GetName()));
+    // Streamed and paged: big levels hold tens of thousands of actors. Without
+    // fields the actors stay a list of object names.
+    FMcpActorQuery Query;
+    FString QueryError;
+    if (!FMcpActorQuery::Parse(Payload, EMcpActorField::Name, Query, QueryError)) {
+      SendAutomationResponse(RequestingSocket, RequestId, false, QueryError, nullptr, TEXT("INVALID_ARGUMENT"));
+      return true;
+    }
+    Query.Level = TargetLevel;
+    Query.bNamesOnly = !Payload.IsValid() || !Payload->HasField(TEXT("fields"));
+    FString ClassName;
+    if (Payload.IsValid() && Payload->TryGetStringField(TEXT("className"), ClassName) && !ClassName.IsEmpty()) {
+      Query.Class = ResolveClassByName(ClassName);
+      if (!Query.Class) {
+        SendAutomationResponse(RequestingSocket, RequestId, false,
+                               FString::Printf(TEXT("Class not found: %s"), *ClassName),
+                               nullptr, TEXT("CLASS_NOT_FOUND"));
+        return true;
       }
     }
-    
-    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-    Result->SetStringField(TEXT("levelPath"), TargetLevel->GetOutermost() ? TargetLevel->GetOutermost()->GetName() : TEXT(""));
-    Result->SetNumberField(TEXT("count"), ActorsArray.Num());
-    Result->SetArrayField(TEXT("actors"), ActorsArray);
-    
-    SendAutomationResponse(RequestingSocket, RequestId, true, TEXT("Level actors retrieved"), Result);
+
+    FMcpJsonUtf8Writer Result;
+    Result.BeginObject();
+    Result.WriteString(TEXT("levelPath"), TargetLevel->GetOutermost() ? TargetLevel->GetOutermost()->GetName() : FString());
+    TWeakObjectPtr<UMcpAutomationBridgeSubsystem> WeakSubsystem(this);
+    FMcpActorQueryRunner::Run(World, GetActorIndex(), Query, MoveTemp(Result),
+      [WeakSubsystem, RequestingSocket, RequestId](FMcpJsonUtf8Writer&& Page, int32 Returned, const FString& ErrorCode) {
+        UMcpAutomationBridgeSubsystem* Subsystem = WeakSubsystem.Get();
+        if (!Subsystem) {
+          return;
+        }
+        if (!ErrorCode.IsEmpty()) {
+          Subsystem->SendAutomationResponse(RequestingSocket, RequestId, false,
+                                            TEXT("Cursor expired or unknown; list again without it."),
+                                            nullptr, ErrorCode);
+          return;
+        }
+        Page.EndObject();
+        Subsystem->SendAutomationResponse(RequestingSocket, RequestId, true, TEXT("Level actors retrieved"), MoveTemp(Page));
+      });
     return true;
   }
   if (EffectiveAction == TEXT("get_level_bounds")) {
@@ -2175,13 +2202,8 @@ TSharedPtr<FJsonObject> Resp = MakeShared<FJsonObject>();
       return true;
     }
     
-    FEditorBuildUtils::EditorBuild(World, FBuildOptions::BuildLighting);
-    
-    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-    Result->SetBoolField(TEXT("buildStarted"), true);
-    
-    SendAutomationResponse(RequestingSocket, RequestId, true, TEXT("Lighting build started"), Result);
-    return true;
+    return StartTrackedLightingBuild(RequestId, Payload, RequestingSocket,
+                                     TEXT("production"));
   }
   if (EffectiveAction == TEXT("build_level_navigation")) {
     UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
@@ -2190,6 +2212,17 @@ TSharedPtr<FJsonObject> Resp = MakeShared<FJsonObject>();
                              TEXT("No editor world available"), nullptr, TEXT("NO_WORLD"));
       return true;
     }
+
+    // Dirty bounds, named actors or recent edits rebuild just those tiles
+    // through manage_navigation and answer once they are built.
+    if (Payload.IsValid() &&
+        (Payload->HasField(TEXT("bounds")) || Payload->HasField(TEXT("actorNames")) ||
+         Payload->HasField(TEXT("recent")))) {
+      TSharedPtr<FJsonObject> NavPayload = MakeShared<FJsonObject>(*Payload);
+      NavPayload->SetStringField(TEXT("subAction"), TEXT("rebuild_navigation"));
+      return HandleManageNavigationAction(RequestId, TEXT("manage_navigation"),
+                                          NavPayload, RequestingSocket);
+    }
     
     FEditorBuildUtils::EditorBuild(World, FBuildOptions::BuildAIPaths);
     
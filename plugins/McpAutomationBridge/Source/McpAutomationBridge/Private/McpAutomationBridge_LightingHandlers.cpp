@@ -2,6 +2,7 @@
 #include "Dom/JsonObject.h"
 #include "McpAutomationBridgeHelpers.h"
 #include "McpAutomationBridgeSubsystem.h"
+#include "McpLightingBuild.h"
 #include "UObject/UObjectIterator.h"
 
 #include "Components/ExponentialHeightFogComponent.h"
@@ -522,43 +523,8 @@ bool UMcpAutomationBridgeSubsystem::HandleLightingAction(
         }
       }
       
-      // Read quality parameter
-      FString Quality;
-      Payload->TryGetStringField(TEXT("quality"), Quality);
-      
-      // Map quality string to console command
-      FString QualityCmd = TEXT("Production"); // Default
-      if (!Quality.IsEmpty()) {
-        const FString LowerQuality = Quality.ToLower();
-        if (LowerQuality == TEXT("preview") || LowerQuality == TEXT("0")) {
-          QualityCmd = TEXT("Preview");
-        } else if (LowerQuality == TEXT("medium") || LowerQuality == TEXT("1")) {
-          QualityCmd = TEXT("Medium");
-        } else if (LowerQuality == TEXT("high") || LowerQuality == TEXT("2")) {
-          QualityCmd = TEXT("High");
-        } else if (LowerQuality == TEXT("production") || LowerQuality == TEXT("3")) {
-          QualityCmd = TEXT("Production");
-        } else {
-          // Unknown quality - return error
-          TSharedPtr<FJsonObject> Err = MakeShared<FJsonObject>();
-          Err->SetStringField(TEXT("error"), TEXT("unknown_quality"));
-          Err->SetStringField(TEXT("quality"), Quality);
-          Err->SetStringField(TEXT("validValues"), TEXT("preview/0, medium/1, high/2, production/3"));
-          SendAutomationResponse(RequestingSocket, RequestId, false,
-                                 TEXT("Unknown lighting quality"), Err,
-                                 TEXT("UNKNOWN_QUALITY"));
-          return true;
-        }
-      }
-      
-      FString Command = FString::Printf(TEXT("BuildLighting %s"), *QualityCmd);
-      GEditor->Exec(GEditor->GetEditorWorldContext().World(), *Command);
-      
-      TSharedPtr<FJsonObject> Resp = MakeShared<FJsonObject>();
-      Resp->SetStringField(TEXT("quality"), QualityCmd);
-      Resp->SetBoolField(TEXT("started"), true);
-      SendAutomationResponse(RequestingSocket, RequestId, true,
-                             FString::Printf(TEXT("Lighting build started with quality: %s"), *QualityCmd), Resp);
+      return StartTrackedLightingBuild(RequestId, Payload, RequestingSocket,
+                                       TEXT("production"));
     } else {
       SendAutomationError(RequestingSocket, RequestId,
                           TEXT("Editor world not available"),
@@ -972,3 +938,118 @@ bool UMcpAutomationBridgeSubsystem::HandleLightingAction(
   return true;
 #endif
 }
+
+bool UMcpAutomationBridgeSubsystem::StartTrackedLightingBuild(
+    const FString &RequestId, const TSharedPtr<FJsonObject> &Payload,
+    TSharedPtr<FMcpBridgeWebSocket> RequestingSocket,
+    const FString &DefaultQuality) {
+#if WITH_EDITOR
+  UWorld *World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+  if (!World) {
+    SendAutomationError(RequestingSocket, RequestId,
+                        TEXT("Editor world not available for build lighting"),
+                        TEXT("EDITOR_WORLD_NOT_AVAILABLE"));
+    return true;
+  }
+
+  FString Quality = DefaultQuality;
+  bool bWait = true;
+  bool bReflectionCaptures = false;
+  double TimeoutSeconds = 0.0;
+  if (Payload.IsValid()) {
+    FString Requested;
+    if (Payload->TryGetStringField(TEXT("quality"), Requested) &&
+        !Requested.IsEmpty()) {
+      Quality = Requested;
+    }
+    Payload->TryGetBoolField(TEXT("waitForCompletion"), bWait);
+    Payload->TryGetBoolField(TEXT("buildReflectionCaptures"),
+                             bReflectionCaptures);
+    Payload->TryGetNumberField(TEXT("timeoutSeconds"), TimeoutSeconds);
+  }
+  ELightingBuildQuality QualityEnum = ELightingBuildQuality::Quality_Production;
+  if (!FMcpLightingBuild::ParseQuality(Quality, QualityEnum)) {
+    TSharedPtr<FJsonObject> Err = MakeShared<FJsonObject>();
+    Err->SetStringField(TEXT("error"), TEXT("unknown_quality"));
+    Err->SetStringField(TEXT("quality"), Quality);
+    Err->SetStringField(TEXT("validValues"),
+                        TEXT("preview/0, medium/1, high/2, production/3"));
+    SendAutomationResponse(RequestingSocket, RequestId, false,
+                           TEXT("Unknown lighting quality"), Err,
+                           TEXT("UNKNOWN_QUALITY"));
+    return true;
+  }
+
+  // The request loop is free as soon as this returns; the build is followed
+  // from the core ticker and answered from there.
+  TWeakObjectPtr<UMcpAutomationBridgeSubsystem> WeakSelf(this);
+  TFunction<bool(const FString &, float, double)> OnProgress =
+      [WeakSelf, RequestId](const FString &Stage, float Percent, double Seconds) {
+        UMcpAutomationBridgeSubsystem *S = WeakSelf.Get();
+        return S && S->SendProgressUpdate(
+                        RequestId, Percent,
+                        FString::Printf(TEXT("Lighting build: %s (%.0f s)"),
+                                        *Stage, Seconds));
+      };
+  TFunction<void(const FMcpLightingBuildResult &)> OnFinished =
+      [WeakSelf, RequestingSocket, RequestId](const FMcpLightingBuildResult &Build) {
+        UMcpAutomationBridgeSubsystem *S = WeakSelf.Get();
+        if (!S) {
+          return;
+        }
+        FString ErrorCode;
+        FString Message = TEXT("Lighting build succeeded");
+        if (Build.bCancelled) {
+          ErrorCode = TEXT("CANCELLED");
+          Message = TEXT("Stopped following the lighting build; the editor keeps building");
+        } else if (Build.bTimedOut) {
+          ErrorCode = TEXT("TIMEOUT");
+          Message = TEXT("Lighting build still running after timeoutSeconds");
+        } else if (Build.Outcome == TEXT("failed")) {
+          ErrorCode = TEXT("LIGHTING_BUILD_FAILED");
+          Message = TEXT("Lighting build failed");
+        } else if (Build.Outcome != TEXT("succeeded")) {
+          ErrorCode = TEXT("LIGHTING_BUILD_STOPPED");
+          Message = TEXT("Lighting build stopped before completing");
+        }
+        S->SendAutomationResponse(RequestingSocket, RequestId, ErrorCode.IsEmpty(),
+                                  Message, Build.ToJson(), ErrorCode);
+      };
+  if (!bWait) {
+    OnProgress = nullptr;
+    OnFinished = [](const FMcpLightingBuildResult &Build) {
+      UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
+             TEXT("Lighting build %s in %.1f s (%d warnings, %d errors)"),
+             *Build.Outcome, Build.WallMs / 1000.0, Build.Warnings,
+             Build.Errors);
+    };
+  }
+
+  FString Error;
+  if (!FMcpLightingBuild::Start(World, QualityEnum, bReflectionCaptures,
+                                TimeoutSeconds, MoveTemp(OnProgress),
+                                MoveTemp(OnFinished), Error)) {
+    const bool bBusy = FMcpLightingBuild::IsTracking() ||
+                       GEditor->IsLightingBuildCurrentlyRunning();
+    SendAutomationError(RequestingSocket, RequestId, Error,
+                        bBusy ? TEXT("LIGHTING_BUILD_IN_PROGRESS")
+                              : TEXT("LIGHTING_BUILD_FAILED"));
+    return true;
+  }
+  if (!bWait) {
+    TSharedPtr<FJsonObject> Resp = MakeShared<FJsonObject>();
+    Resp->SetStringField(TEXT("quality"), FMcpLightingBuild::QualityName(QualityEnum));
+    Resp->SetBoolField(TEXT("started"), true);
+    SendAutomationResponse(RequestingSocket, RequestId, true,
+                           FString::Printf(TEXT("Lighting build started with quality: %s"),
+                                           *FMcpLightingBuild::QualityName(QualityEnum)),
+                           Resp);
+  }
+  return true;
+#else
+  SendAutomationResponse(RequestingSocket, RequestId, false,
+                         TEXT("Lighting builds require editor build"), nullptr,
+                         TEXT("NOT_IMPLEMENTED"));
+  return true;
+#endif
+}
@@ -2,95 +2,211 @@
 #include "McpAutomationBridgeSubsystem.h"
 #include "McpAutomationBridgeHelpers.h"
 #include "McpAutomationBridgeGlobals.h"
+#include "McpAutomationBridgeSettings.h"
+#include "McpConnectionManager.h"
+#include "McpLogFilter.h"
+#include "McpLogRingBuffer.h"
 #include "Misc/OutputDevice.h"
-#include "Async/Async.h"
+#include "Runtime/Launch/Resources/Version.h"
 
-// Define a custom output device to capture logs and stream them via the bridge
+// Output device that copies every log line into the bridge's ring buffer. It
+// runs on whichever thread logged, so it only filters and writes; streaming
+// to subscribers happens in batches from the subsystem tick.
 class FMcpLogOutputDevice : public FOutputDevice
 {
 public:
-    FMcpLogOutputDevice(UMcpAutomationBridgeSubsystem* InSubsystem) 
-        : Subsystem(InSubsystem) 
+    FMcpLogOutputDevice(const TSharedRef<FMcpLogRingBuffer, ESPMode::ThreadSafe>& InRingBuffer)
+        : RingBuffer(InRingBuffer)
     {
     }
 
     virtual void Serialize(const TCHAR* V, ELogVerbosity::Type Verbosity, const class FName& Category) override
     {
-        if (!Subsystem || !Subsystem->IsValidLowLevel())
+        static const FName LogRHIName(TEXT("LogRHI"));
+        static const FName LogEOSSDKName(TEXT("LogEOSSDK"));
+        static const FName LogCsvProfilerName(TEXT("LogCsvProfiler"));
+        static const FName LogSlateStyleName(TEXT("LogSlateStyle"));
+        static const FName LogStatsName(TEXT("LogStats"));
+
+        // Our own category is skipped so streaming never feeds on itself, and
+        // a few highly verbose categories would only push useful lines out.
+        if (Category == LogMcpAutomationBridgeSubsystem.GetCategoryName() ||
+            Category == LogRHIName ||
+            Category == LogEOSSDKName ||
+            Category == LogCsvProfilerName)
         {
             return;
         }
 
-        // Filter out very verbose logs if needed, but for now allow all
-        // Prevent infinite recursion if our own logging causes more logging
-        // Filter out highly verbose categories that clutter test output
-        // Use string comparison to be robust against FName issues
-        FString CategoryStr = Category.ToString();
-
-        if (Category == LogMcpAutomationBridgeSubsystem.GetCategoryName() ||
-            CategoryStr == TEXT("LogRHI") ||
-            CategoryStr == TEXT("LogEOSSDK") ||
-            CategoryStr == TEXT("LogCsvProfiler"))
+        // "Missing Resource from 'ProfileVisualizerStyle'" is a known engine warning during 'show collision'
+        if (Verbosity == ELogVerbosity::Warning && Category == LogSlateStyleName &&
+            FCString::Strstr(V, TEXT("Missing Resource from 'ProfileVisualizerStyle'")))
         {
-            return; 
+            return;
         }
 
-        // Filter specific noisy warnings
-        if (Verbosity == ELogVerbosity::Warning && CategoryStr == TEXT("LogSlateStyle"))
+        // "There is no thread with id" is noise during stat commands
+        if (Category == LogStatsName && FCString::Strstr(V, TEXT("There is no thread with id")))
         {
-            // "Missing Resource from 'ProfileVisualizerStyle'" is a known engine warning during 'show collision'
-            if (FString(V).Contains(TEXT("Missing Resource from 'ProfileVisualizerStyle'")))
-            {
-                return;
-            }
+            return;
         }
 
-        if (CategoryStr == TEXT("LogStats")) 
+        RingBuffer->Write(V, Verbosity, Category);
+    }
+
+    virtual bool CanBeUsedOnAnyThread() const override
+    {
+        return true;
+    }
+
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
+    virtual bool CanBeUsedOnMultipleThreads() const override
+    {
+        return true;
+    }
+#endif
+
+private:
+    TSharedRef<FMcpLogRingBuffer, ESPMode::ThreadSafe> RingBuffer;
+};
+
+namespace
+{
+    void WriteMcpLogRecord(FMcpJsonUtf8Writer& Writer, const FMcpLogRecord& Record)
+    {
+        Writer.BeginObject();
+        Writer.WriteInt(TEXT("seq"), static_cast<int64>(Record.Sequence));
+        Writer.WriteString(TEXT("timestamp"), Record.Timestamp.ToIso8601());
+        Writer.WriteString(TEXT("category"), Record.Category);
+        Writer.WriteString(TEXT("level"), ToString(Record.Verbosity));
+        Writer.WriteString(TEXT("message"), Record.Message);
+        if (Record.bTruncated)
         {
-             // "There is no thread with id" is noise during stat commands
-             if (FString(V).Contains(TEXT("There is no thread with id")))
-             {
-                 return;
-             }
+            Writer.WriteBool(TEXT("truncated"), true);
         }
+        Writer.EndObject();
+    }
+}
+
+void UMcpAutomationBridgeSubsystem::StartLogCapture()
+{
+    if (LogCaptureDevice.IsValid() || !GLog)
+    {
+        return;
+    }
+
+    int32 Capacity = 4096;
+    if (const UMcpAutomationBridgeSettings* Settings = GetDefault<UMcpAutomationBridgeSettings>())
+    {
+        Capacity = Settings->LogRingBufferCapacity;
+        LogStreamFlushIntervalSeconds = FMath::Max(0.0f, Settings->LogStreamFlushIntervalSeconds);
+        LogStreamMaxBatchEntries = FMath::Max(1, Settings->LogStreamMaxBatchEntries);
+    }
+
+    LogRingBuffer = MakeShared<FMcpLogRingBuffer, ESPMode::ThreadSafe>(Capacity);
+    LogCaptureDevice = MakeShared<FMcpLogOutputDevice>(LogRingBuffer.ToSharedRef());
+    GLog->AddOutputDevice(LogCaptureDevice.Get());
+}
 
-        FString VerbosityString;
-        switch (Verbosity)
+void UMcpAutomationBridgeSubsystem::StopLogCapture()
+{
+    LogStreamSubscriptions.Reset();
+    if (LogCaptureDevice.IsValid())
+    {
+        if (GLog)
         {
-            case ELogVerbosity::Fatal: VerbosityString = TEXT("Fatal"); break;
-            case ELogVerbosity::Error: VerbosityString = TEXT("Error"); break;
-            case ELogVerbosity::Warning: VerbosityString = TEXT("Warning"); break;
-            case ELogVerbosity::Display: VerbosityString = TEXT("Display"); break;
-            case ELogVerbosity::Log: VerbosityString = TEXT("Log"); break;
-            case ELogVerbosity::Verbose: VerbosityString = TEXT("Verbose"); break;
-            case ELogVerbosity::VeryVerbose: VerbosityString = TEXT("VeryVerbose"); break;
-            default: VerbosityString = TEXT("Log"); break;
+            GLog->RemoveOutputDevice(LogCaptureDevice.Get());
         }
+        LogCaptureDevice.Reset();
+    }
+    LogRingBuffer.Reset();
+}
 
-        FString Message = FString(V);
-        FString CategoryString = Category.ToString();
+bool UMcpAutomationBridgeSubsystem::FlushLogSubscription(FLogStreamSubscription& Subscription)
+{
+    const TSharedPtr<FMcpBridgeWebSocket> Socket = Subscription.Socket.Pin();
+    if (Subscription.bBoundToSocket && (!Socket.IsValid() || !Socket->IsConnected()))
+    {
+        return false;
+    }
+    if (Subscription.Cursor == LogRingBuffer->GetNextSequence())
+    {
+        return true;
+    }
 
-        // Dispatch to game thread to ensure safe socket sending if not already there
-        // Actually, SendRawMessage might be thread safe, but let's be safe.
-        // Copy data for lambda capture
-        const FString PayloadJson = FString::Printf(TEXT("{\"event\":\"log\",\"category\":\"%s\",\"verbosity\":\"%s\",\"message\":\"%s\"}"), 
-            *CategoryString, *VerbosityString, *Message.ReplaceCharWithEscapedChar());
+    TArray<FMcpLogRecord> Records;
+    uint64 Skipped = 0;
+    const uint64 NextCursor = LogRingBuffer->Read(Subscription.Cursor, LogStreamMaxBatchEntries, Records, Skipped,
+                                                  Subscription.Filter.Get());
+    if (Records.Num() == 0 && Skipped == 0)
+    {
+        // Everything in range was filtered out; nothing to send, but the
+        // subscriber has seen it.
+        Subscription.Cursor = NextCursor;
+        return true;
+    }
 
-        // Use a weak pointer to the subsystem to avoid crashing if it's destroyed
-        TWeakObjectPtr<UMcpAutomationBridgeSubsystem> WeakSubsystem(Subsystem);
+    FMcpJsonUtf8Writer Writer;
+    Writer.BeginObject();
+    Writer.WriteString(TEXT("type"), TEXT("automation_event"));
+    Writer.WriteString(TEXT("event"), TEXT("log_batch"));
+    Writer.Key(TEXT("payload"));
+    Writer.BeginObject();
+    Writer.Key(TEXT("entries"));
+    Writer.BeginArray();
+    for (const FMcpLogRecord& Record : Records)
+    {
+        WriteMcpLogRecord(Writer, Record);
+    }
+    Writer.EndArray();
+    Writer.WriteInt(TEXT("cursor"), static_cast<int64>(NextCursor));
+    Writer.WriteInt(TEXT("skipped"), static_cast<int64>(Skipped));
+    Writer.EndObject();
+    Writer.EndObject();
 
-        AsyncTask(ENamedThreads::GameThread, [WeakSubsystem, PayloadJson]()
-        {
-            if (UMcpAutomationBridgeSubsystem* StrongSubsystem = WeakSubsystem.Get())
-            {
-               StrongSubsystem->SendRawMessage(PayloadJson);
-            }
-        });
+    // Under backpressure the batch is dropped but the cursor stays put, so the
+    // lines go out on a later flush; whatever the ring overwrites meanwhile is
+    // reported through "skipped".
+    bool bSent = false;
+    if (Subscription.bBoundToSocket)
+    {
+        TArray<uint8> Bytes(Writer.GetBuffer());
+        bSent = ConnectionManager.IsValid() && ConnectionManager->SendDiscardableTo(Socket, MoveTemp(Bytes));
+    }
+    else
+    {
+        bSent = PublishEvent(TEXT("logs"), TArray<uint8>(Writer.GetBuffer()));
+    }
+    if (bSent)
+    {
+        Subscription.Cursor = NextCursor;
     }
+    return true;
+}
 
-private:
-    UMcpAutomationBridgeSubsystem* Subsystem;
-};
+void UMcpAutomationBridgeSubsystem::FlushLogStream()
+{
+    if (LogStreamSubscriptions.Num() == 0 || !LogRingBuffer.IsValid())
+    {
+        return;
+    }
+
+    const double Now = FPlatformTime::Seconds();
+    if (Now - LastLogStreamFlushSeconds < LogStreamFlushIntervalSeconds)
+    {
+        return;
+    }
+    LastLogStreamFlushSeconds = Now;
+
+    for (int32 Index = LogStreamSubscriptions.Num() - 1; Index >= 0; --Index)
+    {
+        if (!FlushLogSubscription(LogStreamSubscriptions[Index]))
+        {
+            UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose, TEXT("Dropping log subscription of a closed connection."));
+            LogStreamSubscriptions.RemoveAtSwap(Index);
+        }
+    }
+}
 
 bool UMcpAutomationBridgeSubsystem::HandleLogAction(const FString& RequestId, const FString& Action, const TSharedPtr<FJsonObject>& Payload, TSharedPtr<FMcpBridgeWebSocket> RequestingSocket)
 {
@@ -107,27 +223,74 @@ bool UMcpAutomationBridgeSubsystem::HandleLogAction(const FString& RequestId, co
 
     FString SubAction = GetJsonStringField(Payload, TEXT("subAction"));
 
+    // One subscription per connection; subscribing again replaces its filter.
+    auto FindSubscription = [this, &RequestingSocket]() -> int32
+    {
+        return LogStreamSubscriptions.IndexOfByPredicate([&RequestingSocket](const FLogStreamSubscription& Existing)
+        {
+            return Existing.bBoundToSocket == RequestingSocket.IsValid() &&
+                   Existing.Socket.Pin() == RequestingSocket;
+        });
+    };
+
     if (SubAction == TEXT("subscribe"))
     {
-        if (!LogCaptureDevice.IsValid())
+        if (!LogRingBuffer.IsValid())
+        {
+            SendAutomationError(RequestingSocket, RequestId, TEXT("Log capture is unavailable."), TEXT("LOG_CAPTURE_UNAVAILABLE"));
+            return true;
+        }
+
+        TSharedRef<FMcpLogFilter> Filter = MakeShared<FMcpLogFilter>();
+        FString FilterError;
+        if (!FMcpLogFilter::Compile(Payload, *Filter, FilterError))
         {
-            LogCaptureDevice = MakeShared<FMcpLogOutputDevice>(this);
-            GLog->AddOutputDevice(LogCaptureDevice.Get());
-            UE_LOG(LogMcpAutomationBridgeSubsystem, Display, TEXT("Log streaming enabled by client request."));
+            SendAutomationError(RequestingSocket, RequestId, FilterError, TEXT("INVALID_FILTER"));
+            return true;
+        }
+
+        // Streaming starts at the live tail unless the client asks to replay
+        // from a cursor it got earlier (from get_recent_logs or a batch).
+        double CursorValue = 0.0;
+        const uint64 Next = LogRingBuffer->GetNextSequence();
+        const uint64 Cursor = Payload->TryGetNumberField(TEXT("cursor"), CursorValue) && CursorValue >= 0.0
+            ? FMath::Min(static_cast<uint64>(CursorValue), Next)
+            : Next;
+
+        const int32 ExistingIndex = FindSubscription();
+        FLogStreamSubscription& Subscription = ExistingIndex != INDEX_NONE
+            ? LogStreamSubscriptions[ExistingIndex]
+            : LogStreamSubscriptions.AddDefaulted_GetRef();
+        Subscription.Socket = RequestingSocket;
+        Subscription.bBoundToSocket = RequestingSocket.IsValid();
+        Subscription.Cursor = Cursor;
+        Subscription.Filter = Filter;
+        if (ExistingIndex == INDEX_NONE)
+        {
+            UE_LOG(LogMcpAutomationBridgeSubsystem, Display, TEXT("Log streaming enabled by client request (%d subscriber(s))."),
+                   LogStreamSubscriptions.Num());
         }
 
         TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
         Result->SetStringField(TEXT("action"), TEXT("subscribe"));
         Result->SetBoolField(TEXT("subscribed"), true);
+        Result->SetNumberField(TEXT("cursor"), static_cast<double>(Cursor));
+        Result->SetNumberField(TEXT("flushIntervalSeconds"), LogStreamFlushIntervalSeconds);
+        Result->SetObjectField(TEXT("filter"), Filter->Describe());
         SendAutomationResponse(RequestingSocket, RequestId, true, TEXT("Subscribed to editor logs."), Result);
         return true;
     }
     else if (SubAction == TEXT("unsubscribe"))
     {
-        if (LogCaptureDevice.IsValid())
+        const int32 ExistingIndex = FindSubscription();
+        if (ExistingIndex != INDEX_NONE)
         {
-            GLog->RemoveOutputDevice(LogCaptureDevice.Get());
-            LogCaptureDevice.Reset();
+            // Push whatever is still pending before going quiet.
+            if (LogRingBuffer.IsValid())
+            {
+                FlushLogSubscription(LogStreamSubscriptions[ExistingIndex]);
+            }
+            LogStreamSubscriptions.RemoveAtSwap(ExistingIndex);
             UE_LOG(LogMcpAutomationBridgeSubsystem, Display, TEXT("Log streaming disabled by client request."));
         }
 
@@ -141,3 +304,94 @@ bool UMcpAutomationBridgeSubsystem::HandleLogAction(const FString& RequestId, co
     SendAutomationError(RequestingSocket, RequestId, TEXT("Unknown subAction."), TEXT("INVALID_SUBACTION"));
     return true;
 }
+
+// ============================================================================
+// get_recent_logs — Return buffered log entries
+// ============================================================================
+bool UMcpAutomationBridgeSubsystem::HandleGetRecentLogs(
+    const FString& RequestId,
+    const FString& Action,
+    const TSharedPtr<FJsonObject>& Payload,
+    TSharedPtr<FMcpBridgeWebSocket> RequestingSocket)
+{
+    // Registered on the thread-safe lane too: the ring is lock-free, and it is
+    // created in Initialize and released only after worker dispatches drain.
+    const TSharedPtr<FMcpLogRingBuffer, ESPMode::ThreadSafe> Ring = LogRingBuffer;
+    if (!Ring.IsValid())
+    {
+        SendAutomationResponse(RequestingSocket, RequestId, false,
+            TEXT("Log capture is not active."), nullptr, TEXT("LOG_CAPTURE_UNAVAILABLE"));
+        return true;
+    }
+
+    FMcpLogFilter Filter;
+    FString FilterError;
+    if (!FMcpLogFilter::Compile(Payload, Filter, FilterError))
+    {
+        SendAutomationResponse(RequestingSocket, RequestId, false, FilterError, nullptr, TEXT("INVALID_FILTER"));
+        return true;
+    }
+
+    double CursorValue = -1.0;
+    const bool bHasCursor = Payload.IsValid() && Payload->TryGetNumberField(TEXT("cursor"), CursorValue) && CursorValue >= 0.0;
+    int32 Limit = GetJsonIntField(Payload, TEXT("limit"), GetJsonIntField(Payload, TEXT("count"), 100));
+    Limit = FMath::Clamp(Limit, 1, 1000);
+
+    // With a cursor: the next Limit matches after it, oldest first, and the
+    // cursor to pass next time. Without one: the newest Limit matches.
+    const uint64 Next = Ring->GetNextSequence();
+    uint64 Cursor = bHasCursor
+        ? FMath::Min(static_cast<uint64>(CursorValue), Next)
+        : (!Filter.IsPassAll() ? Ring->GetOldestSequence() : (Next > static_cast<uint64>(Limit) ? Next - Limit : 0));
+
+    TArray<FMcpLogRecord> Matched;
+    uint64 Skipped = 0;
+    if (bHasCursor)
+    {
+        Cursor = Ring->Read(Cursor, Limit, Matched, Skipped, &Filter);
+    }
+    else
+    {
+        // Rejected lines are never decoded, so scanning the whole ring for the
+        // newest matches only pays for the lines that are kept.
+        constexpr int32 ChunkSize = 256;
+        while (Cursor < Next)
+        {
+            const uint64 ChunkEnd = Ring->Read(Cursor, ChunkSize, Matched, Skipped, &Filter);
+            if (ChunkEnd == Cursor)
+            {
+                break;
+            }
+            Cursor = ChunkEnd;
+            if (Matched.Num() > Limit * 2)
+            {
+                Matched.RemoveAt(0, Matched.Num() - Limit);
+            }
+        }
+        if (Matched.Num() > Limit)
+        {
+            Matched.RemoveAt(0, Matched.Num() - Limit);
+        }
+    }
+
+    FMcpJsonUtf8Writer Result;
+    Result.BeginObject();
+    Result.WriteBool(TEXT("success"), true);
+    Result.Key(TEXT("logs"));
+    Result.BeginArray();
+    for (const FMcpLogRecord& Record : Matched)
+    {
+        WriteMcpLogRecord(Result, Record);
+    }
+    Result.EndArray();
+    Result.WriteInt(TEXT("count"), Matched.Num());
+    Result.WriteInt(TEXT("cursor"), static_cast<int64>(Cursor));
+    Result.WriteInt(TEXT("oldestCursor"), static_cast<int64>(Ring->GetOldestSequence()));
+    Result.WriteInt(TEXT("skipped"), static_cast<int64>(Skipped));
+    Result.WriteInt(TEXT("capacity"), Ring->GetCapacity());
+    Result.EndObject();
+
+    SendAutomationResponse(RequestingSocket, RequestId, true,
+        FString::Printf(TEXT("Returned %d log entries"), Matched.Num()), MoveTemp(Result));
+    return true;
+}
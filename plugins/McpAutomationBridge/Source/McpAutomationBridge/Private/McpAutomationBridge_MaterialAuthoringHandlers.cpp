@@ -70,6 +70,7 @@
 #include "Materials/MaterialExpressionDesaturation.h"
 #include "Materials/MaterialFunction.h"
 #include "Materials/MaterialInstanceConstant.h"
+#include "MaterialShared.h"
 #include "PhysicalMaterials/PhysicalMaterial.h"
 #include "UObject/SavePackage.h"
 #include "EditorAssetLibrary.h"
@@ -90,18 +91,12 @@
 
 /**
  * Properly recompile a material after expression or connection changes.
- * Syncs the EdGraph so connections persist across save/load.
+ * Inside a material_edit_session the recompile is deferred to the end of the
+ * session (see FMcpMaterialCompileQueue).
  */
 static void McpRecompileMaterialAuthoring(UMaterial* Material)
 {
-    if (!Material) return;
-    Material->PreEditChange(nullptr);
-    Material->PostEditChange();
-    if (Material->MaterialGraph)
-    {
-        Material->MaterialGraph->RebuildGraph();
-    }
-    Material->MarkPackageDirty();
+    FMcpMaterialCompileQueue::Queue(Material);
 }
 
 static UMaterialExpression* FindExpressionByIdOrName(UMaterial* Material, const FString& NodeIdOrName);
@@ -2298,6 +2293,300 @@ MCP_GET_MATERIAL_INPUT(Material, WorldPositionOffset).Expression =
     return true;
   }
 
+  // --------------------------------------------------------------------------
+  // bulk_set_instance_parameters
+  // --------------------------------------------------------------------------
+  // Applies a parameter table (instance x parameter -> value) in one pass:
+  // every instance gets one PostEditChange inside a single
+  // FMaterialUpdateContext, which recaches uniform expressions and refreshes
+  // the primitives using them once for the whole table, and the packages go
+  // through the dispatch's save queue.
+  if (SubAction == TEXT("bulk_set_instance_parameters")) {
+    // Shared parameters apply to every instance; an instance's own entries
+    // win for the same name.
+    const TArray<TSharedPtr<FJsonValue>> *SharedParams = nullptr;
+    Payload->TryGetArrayField(TEXT("parameters"), SharedParams);
+
+    TArray<TPair<FString, TSharedPtr<FJsonObject>>> Rows;
+    const TArray<TSharedPtr<FJsonValue>> *InstancesArray = nullptr;
+    if (Payload->TryGetArrayField(TEXT("instances"), InstancesArray) &&
+        InstancesArray) {
+      for (const TSharedPtr<FJsonValue> &Val : *InstancesArray) {
+        const TSharedPtr<FJsonObject> Row =
+            Val.IsValid() && Val->Type == EJson::Object ? Val->AsObject()
+                                                        : nullptr;
+        if (Row.IsValid()) {
+          Rows.Emplace(GetJsonStringField(Row, TEXT("assetPath")), Row);
+        }
+      }
+    }
+    const TArray<TSharedPtr<FJsonValue>> *PathsArray = nullptr;
+    if (Payload->TryGetArrayField(TEXT("assetPaths"), PathsArray) &&
+        PathsArray) {
+      for (const TSharedPtr<FJsonValue> &Val : *PathsArray) {
+        if (Val.IsValid() && Val->Type == EJson::String) {
+          Rows.Emplace(Val->AsString(), nullptr);
+        }
+      }
+    }
+    if (Rows.Num() == 0) {
+      SendAutomationError(Socket, RequestId,
+                          TEXT("Missing 'instances' or 'assetPaths'."),
+                          TEXT("INVALID_ARGUMENT"));
+      return true;
+    }
+    constexpr int32 MaxBulkParameterInstances = 5000;
+    if (Rows.Num() > MaxBulkParameterInstances) {
+      SendAutomationError(
+          Socket, RequestId,
+          FString::Printf(TEXT("bulk_set_instance_parameters accepts at most "
+                               "%d instances (got %d)."),
+                          MaxBulkParameterInstances, Rows.Num()),
+          TEXT("INVALID_ARGUMENT"));
+      return true;
+    }
+
+    bool bSave = true;
+    Payload->TryGetBoolField(TEXT("save"), bSave);
+
+    // Sweeps assign the same few textures to many instances.
+    TMap<FString, UTexture *> TextureCache;
+    auto ResolveTexture = [&TextureCache](const FString &Path,
+                                          FString &OutError) -> UTexture * {
+      const FString SafePath = SanitizeProjectRelativePath(Path);
+      if (SafePath.IsEmpty()) {
+        OutError = FString::Printf(TEXT("Invalid texture path '%s'"), *Path);
+        return nullptr;
+      }
+      if (UTexture **Cached = TextureCache.Find(SafePath)) {
+        return *Cached;
+      }
+      UTexture *Texture = LoadObject<UTexture>(nullptr, *SafePath);
+      if (!Texture) {
+        OutError = FString::Printf(TEXT("Could not load texture '%s'"), *Path);
+        return nullptr;
+      }
+      TextureCache.Add(SafePath, Texture);
+      return Texture;
+    };
+
+    // Applies one { name, type?, value } entry. Returns false with OutError
+    // set when it cannot be applied; bOutChanged says whether the override
+    // differs from what the instance already had.
+    auto ApplyParameter = [&ResolveTexture](UMaterialInstanceConstant *Instance,
+                                            const TSharedPtr<FJsonObject> &Param,
+                                            bool &bOutChanged,
+                                            FString &OutError) -> bool {
+      bOutChanged = false;
+      const FString ParamName = GetJsonStringField(Param, TEXT("name"));
+      const TSharedPtr<FJsonValue> Value =
+          Param.IsValid() ? Param->TryGetField(TEXT("value")) : nullptr;
+      if (ParamName.IsEmpty() || !Value.IsValid()) {
+        OutError = TEXT("Parameter entries need 'name' and 'value'");
+        return false;
+      }
+      FString Type = GetJsonStringField(Param, TEXT("type")).ToLower();
+      if (Type.IsEmpty()) {
+        Type = Value->Type == EJson::Number   ? TEXT("scalar")
+               : Value->Type == EJson::String ? TEXT("texture")
+                                              : TEXT("vector");
+      }
+      const FName ParamFName(*ParamName);
+      const FHashedMaterialParameterInfo Info{ParamFName};
+
+      if (Type == TEXT("scalar")) {
+        float Current = 0.0f;
+        if (!Instance->GetScalarParameterValue(Info, Current)) {
+          OutError = FString::Printf(TEXT("No scalar parameter '%s'"), *ParamName);
+          return false;
+        }
+        const float NewValue = static_cast<float>(Value->AsNumber());
+        float Overridden = 0.0f;
+        bOutChanged = !Instance->GetScalarParameterValue(Info, Overridden, true) ||
+                      Overridden != NewValue;
+        if (bOutChanged) {
+          Instance->SetScalarParameterValueEditorOnly(ParamFName, NewValue);
+        }
+        return true;
+      }
+      if (Type == TEXT("vector")) {
+        FLinearColor Current;
+        if (!Instance->GetVectorParameterValue(Info, Current)) {
+          OutError = FString::Printf(TEXT("No vector parameter '%s'"), *ParamName);
+          return false;
+        }
+        FLinearColor NewValue = Current;
+        const TSharedPtr<FJsonObject> *ValueObj = nullptr;
+        const TArray<TSharedPtr<FJsonValue>> *ValueArr = nullptr;
+        if (Value->TryGetObject(ValueObj) && ValueObj) {
+          double R = Current.R, G = Current.G, B = Current.B, A = Current.A;
+          (*ValueObj)->TryGetNumberField(TEXT("r"), R);
+          (*ValueObj)->TryGetNumberField(TEXT("g"), G);
+          (*ValueObj)->TryGetNumberField(TEXT("b"), B);
+          (*ValueObj)->TryGetNumberField(TEXT("a"), A);
+          NewValue = FLinearColor(R, G, B, A);
+        } else if (Value->TryGetArray(ValueArr) && ValueArr &&
+                   ValueArr->Num() >= 3) {
+          NewValue.R = (*ValueArr)[0]->AsNumber();
+          NewValue.G = (*ValueArr)[1]->AsNumber();
+          NewValue.B = (*ValueArr)[2]->AsNumber();
+          NewValue.A = ValueArr->Num() > 3 ? (*ValueArr)[3]->AsNumber() : 1.0f;
+        } else {
+          OutError = FString::Printf(
+              TEXT("Vector parameter '%s' needs {r,g,b,a} or [r,g,b,a]"),
+              *ParamName);
+          return false;
+        }
+        FLinearColor Overridden;
+        bOutChanged = !Instance->GetVectorParameterValue(Info, Overridden, true) ||
+                      !Overridden.Equals(NewValue, 0.0f);
+        if (bOutChanged) {
+          Instance->SetVectorParameterValueEditorOnly(ParamFName, NewValue);
+        }
+        return true;
+      }
+      if (Type == TEXT("texture")) {
+        UTexture *Current = nullptr;
+        if (!Instance->GetTextureParameterValue(Info, Current)) {
+          OutError = FString::Printf(TEXT("No texture parameter '%s'"), *ParamName);
+          return false;
+        }
+        UTexture *Texture = ResolveTexture(Value->AsString(), OutError);
+        if (!Texture) {
+          return false;
+        }
+        UTexture *Overridden = nullptr;
+        bOutChanged = !Instance->GetTextureParameterValue(Info, Overridden, true) ||
+                      Overridden != Texture;
+        if (bOutChanged) {
+          Instance->SetTextureParameterValueEditorOnly(ParamFName, Texture);
+        }
+        return true;
+      }
+      OutError = FString::Printf(
+          TEXT("Unsupported parameter type '%s' (scalar, vector, texture)"),
+          *Type);
+      return false;
+    };
+
+    const double StartSeconds = FPlatformTime::Seconds();
+    TArray<TSharedPtr<FJsonValue>> Results;
+    Results.Reserve(Rows.Num());
+    int32 InstancesUpdated = 0;
+    int32 ParametersSet = 0;
+    int32 ParametersUnchanged = 0;
+    int32 Errors = 0;
+    {
+      FMaterialUpdateContext UpdateContext;
+      for (const TPair<FString, TSharedPtr<FJsonObject>> &Row : Rows) {
+        TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
+        Entry->SetStringField(TEXT("assetPath"), Row.Key);
+        Results.Add(MakeShared<FJsonValueObject>(Entry));
+
+        const FString SafePath = SanitizeProjectRelativePath(Row.Key);
+        UMaterialInstanceConstant *Instance =
+            SafePath.IsEmpty()
+                ? nullptr
+                : LoadObject<UMaterialInstanceConstant>(nullptr, *SafePath);
+        if (!Instance) {
+          ++Errors;
+          Entry->SetBoolField(TEXT("success"), false);
+          Entry->SetStringField(TEXT("error"),
+                                SafePath.IsEmpty() ? TEXT("INVALID_PATH")
+                                                   : TEXT("ASSET_NOT_FOUND"));
+          continue;
+        }
+
+        // Instance entries first so they take precedence for a name.
+        TArray<TSharedPtr<FJsonObject>> Params;
+        TSet<FString> Seen;
+        auto AddParams = [&Params, &Seen](
+                             const TArray<TSharedPtr<FJsonValue>> *List) {
+          if (!List) {
+            return;
+          }
+          for (const TSharedPtr<FJsonValue> &Val : *List) {
+            const TSharedPtr<FJsonObject> Param =
+                Val.IsValid() && Val->Type == EJson::Object ? Val->AsObject()
+                                                            : nullptr;
+            bool bAlreadySeen = false;
+            Seen.Add(GetJsonStringField(Param, TEXT("name")), &bAlreadySeen);
+            if (!bAlreadySeen) {
+              Params.Add(Param);
+            }
+          }
+        };
+        const TArray<TSharedPtr<FJsonValue>> *RowParams = nullptr;
+        if (Row.Value.IsValid() &&
+            Row.Value->TryGetArrayField(TEXT("parameters"), RowParams)) {
+          AddParams(RowParams);
+        }
+        AddParams(SharedParams);
+
+        int32 Changed = 0;
+        TArray<TSharedPtr<FJsonValue>> ParamErrors;
+        for (const TSharedPtr<FJsonObject> &Param : Params) {
+          bool bChanged = false;
+          FString Error;
+          if (!ApplyParameter(Instance, Param, bChanged, Error)) {
+            ParamErrors.Add(MakeShared<FJsonValueString>(Error));
+          } else if (bChanged) {
+            ++Changed;
+          } else {
+            ++ParametersUnchanged;
+          }
+        }
+        ParametersSet += Changed;
+        Errors += ParamErrors.Num();
+
+        if (Changed > 0) {
+          Instance->PostEditChange();
+          Instance->MarkPackageDirty();
+          UpdateContext.AddMaterialInstance(Instance);
+          if (bSave) {
+            FMcpAssetSaveQueue::Queue(Instance);
+          }
+          ++InstancesUpdated;
+        }
+        Entry->SetBoolField(TEXT("success"), ParamErrors.Num() == 0);
+        Entry->SetNumberField(TEXT("changed"), Changed);
+        if (ParamErrors.Num() > 0) {
+          Entry->SetArrayField(TEXT("errors"), ParamErrors);
+        }
+      }
+    }
+
+    int32 SaveFailed = 0;
+    if (bSave) {
+      TArray<FMcpAssetSaveResult> SaveResults;
+      FMcpAssetSaveQueue::Flush(&SaveResults);
+      for (const FMcpAssetSaveResult &SaveResult : SaveResults) {
+        SaveFailed += SaveResult.bSaved ? 0 : 1;
+      }
+    }
+
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetArrayField(TEXT("instances"), Results);
+    Result->SetNumberField(TEXT("total"), Rows.Num());
+    Result->SetNumberField(TEXT("instancesUpdated"), InstancesUpdated);
+    Result->SetNumberField(TEXT("parametersSet"), ParametersSet);
+    Result->SetNumberField(TEXT("parametersUnchanged"), ParametersUnchanged);
+    Result->SetNumberField(TEXT("errors"), Errors);
+    if (bSave) {
+      Result->SetNumberField(TEXT("saveFailed"), SaveFailed);
+    }
+    Result->SetNumberField(TEXT("durationMs"),
+                           (FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+    const bool bSuccess = Errors == 0 && SaveFailed == 0;
+    SendAutomationResponse(
+        Socket, RequestId, bSuccess,
+        FString::Printf(TEXT("Set %d parameter(s) on %d of %d instance(s), "
+                             "%d error(s)."),
+                        ParametersSet, InstancesUpdated, Rows.Num(), Errors),
+        Result, bSuccess ? FString() : TEXT("PARAMETER_UPDATE_PARTIAL"));
+    return true;
+  }
+
   // ==========================================================================
   // 8.5 Specialized Materials
   // ==========================================================================
@@ -2671,7 +2960,8 @@ PRAGMA_ENABLE_DEPRECATION_WARNINGS
       return true;
     }
 
-    // Force recompile
+    // Force recompile. This only submits the shader jobs; they compile on
+    // the shader compiling manager's workers.
     McpRecompileMaterialAuthoring(Material);
 
     bool bSave = true;
@@ -2684,7 +2974,58 @@ PRAGMA_ENABLE_DEPRECATION_WARNINGS
     Result->SetStringField(TEXT("assetPath"), AssetPath);
     Result->SetBoolField(TEXT("compiled"), true);
     Result->SetBoolField(TEXT("saved"), bSave);
-    SendAutomationResponse(Socket, RequestId, true, TEXT("Material compiled."), Result);
+
+    bool bWaitForShaders = false;
+    Payload->TryGetBoolField(TEXT("waitForShaders"), bWaitForShaders);
+    if (!bWaitForShaders) {
+      Result->SetNumberField(
+          TEXT("remainingShaderJobs"),
+          FMcpMaterialCompileQueue::GetNumRemainingShaderJobs());
+      SendAutomationResponse(Socket, RequestId, true,
+                             TEXT("Material recompile submitted."), Result);
+      return true;
+    }
+
+    // Answer once the shader map is done, polling from the ticker so the
+    // game thread keeps running, with the remaining job count as progress.
+    double TimeoutSeconds = 300.0;
+    Payload->TryGetNumberField(TEXT("timeoutSeconds"), TimeoutSeconds);
+    TWeakObjectPtr<UMcpAutomationBridgeSubsystem> WeakSubsystem(this);
+    FMcpMaterialCompileQueue::WatchShaders(
+        Material, TimeoutSeconds,
+        [WeakSubsystem, RequestId](int32 RemainingJobs) {
+          UMcpAutomationBridgeSubsystem *Subsystem = WeakSubsystem.Get();
+          return Subsystem &&
+                 Subsystem->SendProgressUpdate(
+                     RequestId, -1.0f,
+                     FString::Printf(TEXT("Compiling shaders (%d jobs left)"),
+                                     RemainingJobs));
+        },
+        [WeakSubsystem, RequestId, Socket,
+         Result](const FMcpMaterialShaderStatus &Status) {
+          UMcpAutomationBridgeSubsystem *Subsystem = WeakSubsystem.Get();
+          if (!Subsystem) {
+            return;
+          }
+          Result->SetObjectField(TEXT("shaders"),
+                                 FMcpMaterialCompileQueue::ToJson(Status));
+          const bool bSuccess = Status.bFinished && Status.Errors.Num() == 0;
+          const FString Message =
+              Status.bFinished
+                  ? FString::Printf(TEXT("Material compiled with %d shader "
+                                         "error(s)."),
+                                    Status.Errors.Num())
+                  : (Status.bCancelled
+                         ? FString(TEXT("Shader compile wait cancelled."))
+                         : FString(TEXT("Timed out waiting for shaders.")));
+          Subsystem->SendAutomationResponse(
+              Socket, RequestId, bSuccess, Message, Result,
+              bSuccess ? FString()
+                       : (Status.bFinished
+                              ? TEXT("SHADER_COMPILE_FAILED")
+                              : (Status.bCancelled ? TEXT("CANCELLED")
+                                                   : TEXT("TIMEOUT"))));
+        });
     return true;
   }
 
@@ -0,0 +1,311 @@
+// Location:
+// McpAutomationBridge/Private/McpAutomationBridge_MaterialEditSessionHandlers.cpp
+// Summary: The "material_edit_session" envelope. Applies an ordered list of
+//          expression edits to one material (add nodes, set properties,
+//          connect pins, ...) with every recompile they request deferred,
+//          then recompiles and saves the material once. Building a 60-node
+//          material submits one set of shader jobs instead of one per edit.
+//          With waitForShaders the reply waits, without blocking the game
+//          thread, until the shader map finishes, reporting progress.
+// Usage: { "action": "material_edit_session", "payload": {
+//          "assetPath": "/Game/M_Foo", "save": true, "stopOnError": false,
+//          "waitForShaders": false, "edits": [
+//            { "subAction": "add_math_node", "operation": "Multiply" },
+//            { "action": "manage_material_graph", "payload": { ... } } ] } }
+//          An edit without "action" is a manage_material_authoring edit;
+//          either form gets assetPath filled in when it names no material.
+
+#include "Dom/JsonObject.h"
+#include "HAL/PlatformTime.h"
+#include "McpAutomationBridgeGlobals.h"
+#include "McpAutomationBridgeHelpers.h"
+#include "McpAutomationBridgeSubsystem.h"
+#include "McpMaterialCompileQueue.h"
+
+#if WITH_EDITOR
+#include "Materials/Material.h"
+#include "ScopedTransaction.h"
+#endif
+
+namespace {
+// Same bound as the Blueprint edit session.
+constexpr int32 MaxMaterialEditSessionEdits = 1000;
+} // namespace
+
+/**
+ * @brief Apply payload.edits to one material with a single recompile and save.
+ *
+ * Each edit runs through the regular dispatch chain under the id
+ * "<RequestId>#<index>" with its response captured, inside one undo
+ * transaction and one FMcpMaterialCompileQueue scope, so the material's
+ * shader map is rebuilt once, after the last edit. The reply carries the
+ * shader job count left at that point; with waitForShaders it is sent once
+ * the material's shaders finish (or timeoutSeconds pass), with progress
+ * updates meanwhile.
+ *
+ * @param RequestId Identifier of the session request.
+ * @param Action Action name; only "material_edit_session" is handled.
+ * @param Payload Session payload (assetPath, edits, save, stopOnError,
+ * waitForShaders, timeoutSeconds).
+ * @param RequestingSocket Socket that receives the aggregated response.
+ * @return true if the action was "material_edit_session" and a response was
+ * sent or scheduled.
+ */
+bool UMcpAutomationBridgeSubsystem::HandleMaterialEditSession(
+    const FString &RequestId, const FString &Action,
+    const TSharedPtr<FJsonObject> &Payload,
+    TSharedPtr<FMcpBridgeWebSocket> RequestingSocket) {
+  if (!Action.Equals(TEXT("material_edit_session"), ESearchCase::IgnoreCase)) {
+    return false;
+  }
+
+#if WITH_EDITOR
+  const TArray<TSharedPtr<FJsonValue>> *Edits = nullptr;
+  if (!Payload.IsValid() || !Payload->TryGetArrayField(TEXT("edits"), Edits) ||
+      !Edits) {
+    SendAutomationError(RequestingSocket, RequestId,
+                        TEXT("material_edit_session requires an 'edits' array."),
+                        TEXT("INVALID_PAYLOAD"));
+    return true;
+  }
+  if (Edits->Num() > MaxMaterialEditSessionEdits) {
+    SendAutomationError(
+        RequestingSocket, RequestId,
+        FString::Printf(
+            TEXT("material_edit_session accepts at most %d edits (got %d)."),
+            MaxMaterialEditSessionEdits, Edits->Num()),
+        TEXT("INVALID_ARGUMENT"));
+    return true;
+  }
+
+  FString RequestedPath = GetJsonStringField(Payload, TEXT("assetPath"));
+  if (RequestedPath.IsEmpty()) {
+    RequestedPath = GetJsonStringField(Payload, TEXT("materialPath"));
+  }
+  const FString MaterialPath = SanitizeProjectRelativePath(RequestedPath);
+  if (MaterialPath.IsEmpty()) {
+    SendAutomationError(
+        RequestingSocket, RequestId,
+        RequestedPath.IsEmpty()
+            ? TEXT("material_edit_session requires 'assetPath'.")
+            : TEXT("Invalid assetPath: contains traversal sequences or "
+                   "invalid characters."),
+        RequestedPath.IsEmpty() ? TEXT("INVALID_ARGUMENT")
+                                : TEXT("INVALID_PATH"));
+    return true;
+  }
+  UMaterial *Material = LoadObject<UMaterial>(nullptr, *MaterialPath);
+  if (!Material) {
+    SendAutomationError(
+        RequestingSocket, RequestId,
+        FString::Printf(TEXT("Could not load material at path: %s"),
+                        *MaterialPath),
+        TEXT("ASSET_NOT_FOUND"));
+    return true;
+  }
+
+  const bool bStopOnError = GetJsonBoolField(Payload, TEXT("stopOnError"));
+  const bool bSave = GetJsonBoolField(Payload, TEXT("save"), true);
+  const bool bWaitForShaders =
+      GetJsonBoolField(Payload, TEXT("waitForShaders"));
+  double TimeoutSeconds = 300.0;
+  Payload->TryGetNumberField(TEXT("timeoutSeconds"), TimeoutSeconds);
+
+  const double StartSeconds = FPlatformTime::Seconds();
+  TArray<TSharedPtr<FJsonValue>> Results;
+  Results.Reserve(Edits->Num());
+  int32 Succeeded = 0;
+  int32 Failed = 0;
+  int32 StoppedAt = INDEX_NONE;
+  TArray<FString> Recompiled;
+
+  {
+    FMcpMaterialCompileQueue::FScope CompileScope;
+    FScopedTransaction Transaction(FText::FromString(
+        GetJsonStringField(Payload, TEXT("transactionName"),
+                           TEXT("MCP Material Edit Session"))));
+    Material->Modify();
+
+    for (int32 Index = 0; Index < Edits->Num(); ++Index) {
+      const TSharedPtr<FJsonValue> &Entry = (*Edits)[Index];
+      const TSharedPtr<FJsonObject> EntryObject =
+          Entry.IsValid() && Entry->Type == EJson::Object ? Entry->AsObject()
+                                                          : nullptr;
+      const FString EditAction = GetJsonStringField(
+          EntryObject, TEXT("action"), TEXT("manage_material_authoring"));
+      const FString SubRequestId =
+          FString::Printf(TEXT("%s#%d"), *RequestId, Index);
+
+      // Copy the edit so filling in the material never touches the request.
+      TSharedPtr<FJsonObject> EditPayload = MakeShared<FJsonObject>();
+      const TSharedPtr<FJsonObject> *NestedPayload = nullptr;
+      if (EntryObject.IsValid() &&
+          EntryObject->TryGetObjectField(TEXT("payload"), NestedPayload) &&
+          NestedPayload) {
+        EditPayload->Values = (*NestedPayload)->Values;
+      } else if (EntryObject.IsValid()) {
+        EditPayload->Values = EntryObject->Values;
+        EditPayload->RemoveField(TEXT("action"));
+        EditPayload->RemoveField(TEXT("id"));
+      }
+      if (!EditPayload->HasField(TEXT("assetPath"))) {
+        EditPayload->SetStringField(TEXT("assetPath"), MaterialPath);
+      }
+
+      TSharedPtr<FJsonObject> ItemResult = MakeShared<FJsonObject>();
+      ItemResult->SetNumberField(TEXT("index"), Index);
+      ItemResult->SetStringField(TEXT("action"), EditAction);
+      const FString SubAction = GetJsonStringField(EditPayload, TEXT("subAction"));
+      if (!SubAction.IsEmpty()) {
+        ItemResult->SetStringField(TEXT("subAction"), SubAction);
+      }
+      const FString Label = GetJsonStringField(EntryObject, TEXT("id"));
+      if (!Label.IsEmpty()) {
+        ItemResult->SetStringField(TEXT("id"), Label);
+      }
+
+      FBatchResponseCapture Capture;
+      if (!EntryObject.IsValid()) {
+        Capture.bResponded = true;
+        Capture.Message = TEXT("Edit must be an object.");
+        Capture.ErrorCode = TEXT("INVALID_PAYLOAD");
+      } else if (!EditAction.Equals(TEXT("manage_material_authoring"),
+                                    ESearchCase::IgnoreCase) &&
+                 !EditAction.Equals(TEXT("manage_material_graph"),
+                                    ESearchCase::IgnoreCase)) {
+        Capture.bResponded = true;
+        Capture.Message = TEXT("Edits must be manage_material_authoring or "
+                               "manage_material_graph actions.");
+        Capture.ErrorCode = TEXT("INVALID_ARGUMENT");
+      } else if (SubAction.Equals(TEXT("compile_material"),
+                                  ESearchCase::IgnoreCase)) {
+        // Its shader wait would answer after the session has.
+        Capture.bResponded = true;
+        Capture.Message = TEXT("compile_material is implied by the session; "
+                               "use waitForShaders on the session instead.");
+        Capture.ErrorCode = TEXT("INVALID_ARGUMENT");
+      } else {
+        Capture = DispatchCapturedAction(RequestId, SubRequestId, EditAction,
+                                         EditPayload, RequestingSocket);
+        if (!Capture.bResponded) {
+          Capture.Message = TEXT("Edit did not reply within the session.");
+          Capture.ErrorCode = TEXT("NO_RESPONSE");
+        }
+      }
+
+      ItemResult->SetBoolField(TEXT("success"), Capture.bSuccess);
+      if (!Capture.Message.IsEmpty()) {
+        ItemResult->SetStringField(TEXT("message"), Capture.Message);
+      }
+      if (!Capture.ErrorCode.IsEmpty()) {
+        ItemResult->SetStringField(TEXT("error"), Capture.ErrorCode);
+      }
+      if (Capture.Result.IsValid()) {
+        ItemResult->SetObjectField(TEXT("result"), Capture.Result);
+      }
+      if (Capture.bSuccess) {
+        ++Succeeded;
+      } else {
+        ++Failed;
+      }
+      Results.Add(MakeShared<FJsonValueObject>(ItemResult));
+
+      if (bStopOnError && !Capture.bSuccess) {
+        StoppedAt = Index;
+        break;
+      }
+    }
+
+    // Read-only edits queue nothing; the session still leaves the material
+    // compiled against its final graph.
+    if (IsValid(Material)) {
+      FMcpMaterialCompileQueue::Queue(Material);
+    }
+    FMcpMaterialCompileQueue::Flush(&Recompiled);
+  }
+
+  if (bSave && IsValid(Material)) {
+    FMcpAssetSaveQueue::Queue(Material);
+  }
+  TArray<FMcpAssetSaveResult> SaveResults;
+  FMcpAssetSaveQueue::Flush(&SaveResults);
+  int32 SaveFailed = 0;
+  for (const FMcpAssetSaveResult &Save : SaveResults) {
+    SaveFailed += Save.bSaved ? 0 : 1;
+  }
+
+  TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+  Result->SetStringField(TEXT("assetPath"), MaterialPath);
+  Result->SetArrayField(TEXT("results"), Results);
+  Result->SetNumberField(TEXT("total"), Edits->Num());
+  Result->SetNumberField(TEXT("succeeded"), Succeeded);
+  Result->SetNumberField(TEXT("failed"), Failed);
+  if (StoppedAt != INDEX_NONE) {
+    Result->SetNumberField(TEXT("stoppedAt"), StoppedAt);
+  }
+  TArray<TSharedPtr<FJsonValue>> RecompiledJson;
+  for (const FString &Path : Recompiled) {
+    RecompiledJson.Add(MakeShared<FJsonValueString>(Path));
+  }
+  Result->SetArrayField(TEXT("recompiled"), RecompiledJson);
+  Result->SetNumberField(TEXT("saves"), SaveResults.Num());
+  Result->SetNumberField(TEXT("saveFailed"), SaveFailed);
+  Result->SetNumberField(TEXT("editMs"),
+                         (FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+
+  const FString Message = FString::Printf(
+      TEXT("Applied %d of %d edit(s) (%d failed) with %d recompile(s)."),
+      Succeeded, Edits->Num(), Failed, Recompiled.Num());
+  const bool bEditsSucceeded = Failed == 0;
+
+  if (!bWaitForShaders || !IsValid(Material)) {
+    Result->SetNumberField(
+        TEXT("remainingShaderJobs"),
+        FMcpMaterialCompileQueue::GetNumRemainingShaderJobs());
+    SendAutomationResponse(RequestingSocket, RequestId, bEditsSucceeded,
+                           Message, Result,
+                           bEditsSucceeded ? FString()
+                                           : TEXT("EDIT_SESSION_FAILED"));
+    return true;
+  }
+
+  TWeakObjectPtr<UMcpAutomationBridgeSubsystem> WeakSubsystem(this);
+  FMcpMaterialCompileQueue::WatchShaders(
+      Material, TimeoutSeconds,
+      [WeakSubsystem, RequestId](int32 RemainingJobs) {
+        UMcpAutomationBridgeSubsystem *Subsystem = WeakSubsystem.Get();
+        return Subsystem &&
+               Subsystem->SendProgressUpdate(
+                   RequestId, -1.0f,
+                   FString::Printf(TEXT("Compiling shaders (%d jobs left)"),
+                                   RemainingJobs));
+      },
+      [WeakSubsystem, RequestId, RequestingSocket, Result, Message,
+       bEditsSucceeded](const FMcpMaterialShaderStatus &Status) {
+        UMcpAutomationBridgeSubsystem *Subsystem = WeakSubsystem.Get();
+        if (!Subsystem) {
+          return;
+        }
+        Result->SetObjectField(TEXT("shaders"),
+                               FMcpMaterialCompileQueue::ToJson(Status));
+        const bool bShadersOk = Status.bFinished && Status.Errors.Num() == 0;
+        const bool bSuccess = bEditsSucceeded && bShadersOk;
+        FString ErrorCode;
+        if (!bEditsSucceeded) {
+          ErrorCode = TEXT("EDIT_SESSION_FAILED");
+        } else if (!bShadersOk) {
+          ErrorCode = Status.bFinished    ? TEXT("SHADER_COMPILE_FAILED")
+                      : Status.bCancelled ? TEXT("CANCELLED")
+                                          : TEXT("TIMEOUT");
+        }
+        Subsystem->SendAutomationResponse(RequestingSocket, RequestId, bSuccess,
+                                          Message, Result, ErrorCode);
+      });
+  return true;
+#else
+  SendAutomationError(RequestingSocket, RequestId,
+                      TEXT("Material edit sessions are editor-only."),
+                      TEXT("EDITOR_ONLY"));
+  return true;
+#endif
+}
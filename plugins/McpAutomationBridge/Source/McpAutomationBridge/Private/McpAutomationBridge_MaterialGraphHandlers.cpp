@@ -22,18 +22,12 @@
 
 /**
  * Properly recompile a material after expression or connection changes.
- * Syncs the EdGraph so connections persist across save/load.
+ * Inside a material_edit_session the recompile is deferred to the end of the
+ * session (see FMcpMaterialCompileQueue).
  */
 static void McpRecompileMaterial(UMaterial* Material)
 {
-    if (!Material) return;
-    Material->PreEditChange(nullptr);
-    Material->PostEditChange();
-    if (Material->MaterialGraph)
-    {
-        Material->MaterialGraph->RebuildGraph();
-    }
-    Material->MarkPackageDirty();
+    FMcpMaterialCompileQueue::Queue(Material);
 }
 
 bool UMcpAutomationBridgeSubsystem::HandleMaterialGraphAction(
@@ -5,6 +5,7 @@
 #include "McpAutomationBridgeSubsystem.h"
 #include "McpAutomationBridgeHelpers.h"
 #include "McpBridgeWebSocket.h"
+#include "McpNavigationRebuild.h"
 #include "Misc/EngineVersionComparison.h"
 
 #if WITH_EDITOR
@@ -434,21 +435,172 @@ static bool HandleRebuildNavigation(
     ARecastNavMesh* NavMesh = Cast<ARecastNavMesh>(NavSys->GetDefaultNavDataInstance());
     bool bHasNavMesh = (NavMesh != nullptr);
 
-    // Trigger full navigation rebuild
-    NavSys->Build();
+    // Dirty areas from explicit bounds, named actors and/or the actors edited
+    // since the last "recent" rebuild. Asking for none keeps the full rebuild.
+    const double Padding = FMath::Max(0.0, GetJsonNumberFieldNav(Payload, TEXT("padding"), 200.0));
+    TArray<FBox> Areas;
+    bool bIncremental = false;
+    auto ReadArea = [&Areas](const TSharedPtr<FJsonObject>& Source)
+    {
+        if (!Source.IsValid())
+        {
+            return;
+        }
+        FBox Box(ForceInit);
+        if (Source->HasField(TEXT("min")) && Source->HasField(TEXT("max")))
+        {
+            Box = FBox(ExtractVectorField(Source, TEXT("min"), FVector::ZeroVector),
+                       ExtractVectorField(Source, TEXT("max"), FVector::ZeroVector));
+        }
+        else if (Source->HasField(TEXT("extent")))
+        {
+            const FVector Center = ExtractVectorField(Source, TEXT("center"), FVector::ZeroVector);
+            const FVector Extent = ExtractVectorField(Source, TEXT("extent"), FVector::ZeroVector);
+            Box = FBox(Center - Extent, Center + Extent);
+        }
+        if (Box.IsValid)
+        {
+            Areas.Add(Box);
+        }
+    };
+    if (const TSharedPtr<FJsonValue> BoundsVal = Payload.IsValid() ? Payload->TryGetField(TEXT("bounds")) : TSharedPtr<FJsonValue>())
+    {
+        bIncremental = true;
+        if (BoundsVal->Type == EJson::Array)
+        {
+            for (const TSharedPtr<FJsonValue>& Entry : BoundsVal->AsArray())
+            {
+                if (Entry.IsValid() && Entry->Type == EJson::Object)
+                {
+                    ReadArea(Entry->AsObject());
+                }
+            }
+        }
+        else if (BoundsVal->Type == EJson::Object)
+        {
+            ReadArea(BoundsVal->AsObject());
+        }
+    }
+
+    TArray<FString> MissingActors;
+    const TArray<TSharedPtr<FJsonValue>>* ActorNames = nullptr;
+    if (Payload.IsValid() && Payload->TryGetArrayField(TEXT("actorNames"), ActorNames) && ActorNames)
+    {
+        bIncremental = true;
+        for (const TSharedPtr<FJsonValue>& NameVal : *ActorNames)
+        {
+            const FString Name = NameVal.IsValid() ? NameVal->AsString() : FString();
+            AActor* Actor = Name.IsEmpty() ? nullptr : Self->FindActorByName(Name);
+            const FBox Box = Actor ? Actor->GetComponentsBoundingBox(false) : FBox(ForceInit);
+            if (Box.IsValid)
+            {
+                Areas.Add(Box.ExpandBy(Padding));
+            }
+            else
+            {
+                MissingActors.Add(Name);
+            }
+        }
+    }
+
+    if (GetJsonBoolFieldNav(Payload, TEXT("recent")))
+    {
+        bIncremental = true;
+        if (FMcpNavDirtyTracker* Tracker = Self->GetNavDirtyTracker())
+        {
+            Areas.Append(Tracker->Consume(World, Padding));
+        }
+    }
 
     TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-    Result->SetBoolField(TEXT("rebuilding"), NavSys->IsNavigationBuildInProgress());
     Result->SetBoolField(TEXT("hasNavMesh"), bHasNavMesh);
     Result->SetBoolField(TEXT("navMeshPresent"), bHasNavMesh);
     Result->SetBoolField(TEXT("bHasNavMesh"), bHasNavMesh);
-    
-    // Add verification data
     Result->SetStringField(TEXT("navigationSystemPath"), NavSys->GetPathName());
     Result->SetBoolField(TEXT("existsAfter"), true);
+    if (MissingActors.Num() > 0)
+    {
+        TArray<TSharedPtr<FJsonValue>> MissingValues;
+        for (const FString& Name : MissingActors)
+        {
+            MissingValues.Add(MakeShared<FJsonValueString>(Name));
+        }
+        Result->SetArrayField(TEXT("missingActors"), MissingValues);
+    }
 
-    Self->SendAutomationResponse(Socket, RequestId, true,
-        bHasNavMesh ? TEXT("Navigation rebuild initiated") : TEXT("Navigation rebuild initiated (no existing NavMesh - ensure NavMeshBoundsVolume is present)"), Result);
+    if (bIncremental && Areas.Num() == 0)
+    {
+        if (MissingActors.Num() > 0)
+        {
+            Self->SendAutomationResponse(Socket, RequestId, false,
+                TEXT("None of the actorNames were found"), Result, TEXT("ACTOR_NOT_FOUND"));
+            return true;
+        }
+        Result->SetBoolField(TEXT("incremental"), true);
+        Result->SetNumberField(TEXT("dirtyAreas"), 0);
+        Self->SendAutomationResponse(Socket, RequestId, true,
+            TEXT("No dirty navigation areas to rebuild"), Result);
+        return true;
+    }
+
+    // A full rebuild answers right away unless asked to wait; dirty areas
+    // always answer once their tiles are built.
+    if (!bIncremental && !GetJsonBoolFieldNav(Payload, TEXT("waitForCompletion")))
+    {
+        NavSys->Build();
+        Result->SetBoolField(TEXT("rebuilding"), NavSys->IsNavigationBuildInProgress());
+        Self->SendAutomationResponse(Socket, RequestId, true,
+            bHasNavMesh ? TEXT("Navigation rebuild initiated") : TEXT("Navigation rebuild initiated (no existing NavMesh - ensure NavMeshBoundsVolume is present)"), Result);
+        return true;
+    }
+
+    TWeakObjectPtr<UMcpAutomationBridgeSubsystem> WeakSelf(Self);
+    FString Error;
+    const bool bStarted = FMcpNavigationRebuild::Run(World, MoveTemp(Areas),
+        GetJsonNumberFieldNav(Payload, TEXT("timeoutSeconds"), 300.0),
+        [WeakSelf, RequestId](int32 Remaining, int32 Peak)
+        {
+            UMcpAutomationBridgeSubsystem* S = WeakSelf.Get();
+            const float Percent = Peak > 0 ? 100.0f * (Peak - Remaining) / Peak : -1.0f;
+            return S && S->SendProgressUpdate(RequestId, Percent,
+                FString::Printf(TEXT("%d navigation build tasks remaining"), Remaining));
+        },
+        [WeakSelf, Socket, RequestId, Result](const FMcpNavRebuildResult& Rebuild)
+        {
+            UMcpAutomationBridgeSubsystem* S = WeakSelf.Get();
+            if (!S)
+            {
+                return;
+            }
+            const TSharedPtr<FJsonObject> RebuildJson = Rebuild.ToJson();
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : RebuildJson->Values)
+            {
+                Result->SetField(Field.Key, Field.Value);
+            }
+            Result->SetBoolField(TEXT("rebuilding"), Rebuild.RemainingBuildTasks > 0);
+            if (Rebuild.bCancelled)
+            {
+                S->SendAutomationResponse(Socket, RequestId, false,
+                    TEXT("Navigation rebuild wait cancelled; tiles keep building"), Result, TEXT("CANCELLED"));
+            }
+            else if (Rebuild.bTimedOut)
+            {
+                S->SendAutomationResponse(Socket, RequestId, false,
+                    FString::Printf(TEXT("Navigation rebuild still had %d build tasks after %.0f ms"), Rebuild.RemainingBuildTasks, Rebuild.WallMs),
+                    Result, TEXT("TIMEOUT"));
+            }
+            else
+            {
+                S->SendAutomationResponse(Socket, RequestId, true,
+                    FString::Printf(TEXT("Navigation rebuilt (%d tiles, %.0f ms)"), Rebuild.PeakBuildTasks, Rebuild.WallMs),
+                    Result);
+            }
+        },
+        Error);
+    if (!bStarted)
+    {
+        Self->SendAutomationResponse(Socket, RequestId, false, Error, nullptr, TEXT("NO_NAV_SYS"));
+    }
     return true;
 }
 
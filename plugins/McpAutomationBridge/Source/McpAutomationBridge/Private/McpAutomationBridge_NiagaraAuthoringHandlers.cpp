@@ -1,11 +1,12 @@
 // McpAutomationBridge_NiagaraAuthoringHandlers.cpp
 // Phase 12: Complete Niagara VFX System Authoring
-// Implements 35 actions for Niagara system/emitter creation, modules, parameters, events, and GPU simulation.
+// Implements 36 actions for Niagara system/emitter creation, modules, parameters, events, and GPU simulation.
 
 #include "McpAutomationBridgeSubsystem.h"
 #include "Dom/JsonObject.h"
 #include "McpAutomationBridgeHelpers.h"
 #include "McpAutomationBridgeGlobals.h"
+#include "McpNiagaraSystemBuilder.h"
 
 // Note: FVersionedNiagaraEmitterData and related APIs were introduced in UE 5.1
 // UE 5.0 uses direct emitter pointers, UE 5.1+ uses versioned emitter data
@@ -166,7 +167,7 @@ bool UMcpAutomationBridgeSubsystem::HandleManageNiagaraAuthoringAction(
     TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject());
 
     // =========================================================================
-    // 12.1 Systems & Emitters (4 actions)
+    // 12.1 Systems & Emitters (5 actions)
     // =========================================================================
 
     if (SubAction == TEXT("create_niagara_system"))
@@ -363,6 +364,121 @@ bool UMcpAutomationBridgeSubsystem::HandleManageNiagaraAuthoringAction(
         return true;
     }
 
+    if (SubAction == TEXT("build_niagara_system"))
+    {
+        // A whole effect in one request: every emitter, module, renderer and parameter edit is
+        // applied with no compile in between, then the system compiles once and the reply waits
+        // (on the ticker, not by blocking the game thread) for that compile to land.
+        if (SystemPath.IsEmpty())
+        {
+            SendAutomationError(RequestingSocket, RequestId, TEXT("Missing 'systemPath'."), TEXT("INVALID_ARGUMENT"));
+            return true;
+        }
+
+        UNiagaraSystem* System = LoadObject<UNiagaraSystem>(nullptr, *SystemPath);
+        if (!System)
+        {
+            SendAutomationError(RequestingSocket, RequestId, TEXT("Could not load Niagara System."), TEXT("ASSET_NOT_FOUND"));
+            return true;
+        }
+
+        const bool bCompile = GetBoolFieldNiagAuth(Payload, TEXT("compile"), true);
+        if (bCompile && FMcpNiagaraSystemBuilder::IsCompiling(System))
+        {
+            SendAutomationError(RequestingSocket, RequestId, TEXT("A build of this system is still compiling."), TEXT("NIAGARA_COMPILE_IN_PROGRESS"));
+            return true;
+        }
+
+        FMcpNiagaraSystemBuildResult Build;
+        FString BuildError;
+        FString BuildErrorCode;
+        if (!FMcpNiagaraSystemBuilder::Apply(System, Payload, Build, BuildError, BuildErrorCode))
+        {
+            SendAutomationError(RequestingSocket, RequestId, BuildError, BuildErrorCode);
+            return true;
+        }
+
+        if (Build.HasChanges())
+        {
+            System->MarkPackageDirty();
+        }
+        AddAssetVerification(Result, System);
+        Result->SetObjectField(TEXT("build"), Build.ToJson());
+
+        // Nothing changed, or the caller compiles later: reply now. Saving a system with edits
+        // but no compile leaves the compile to the save.
+        if (!bCompile || !Build.HasChanges())
+        {
+            if (bSave && Build.HasChanges())
+            {
+                McpSafeAssetSave(System);
+            }
+            Result->SetBoolField(TEXT("compileRequested"), false);
+            SendAutomationResponse(RequestingSocket, RequestId, true,
+                Build.HasChanges() ? TEXT("Niagara system built.") : TEXT("Niagara system already matches the spec."), Result);
+            return true;
+        }
+
+        const double TimeoutSeconds = GetNumberFieldNiagAuth(Payload, TEXT("compileTimeoutSeconds"), 300.0);
+        TWeakObjectPtr<UMcpAutomationBridgeSubsystem> WeakSelf(this);
+        TWeakObjectPtr<UNiagaraSystem> WeakSystem(System);
+        FString CompileError;
+        const bool bStarted = FMcpNiagaraSystemBuilder::StartCompile(
+            System, TimeoutSeconds,
+            [WeakSelf, RequestId](float Percent)
+            {
+                UMcpAutomationBridgeSubsystem* S = WeakSelf.Get();
+                return S && S->SendProgressUpdate(RequestId, Percent, TEXT("Compiling Niagara system"));
+            },
+            [WeakSelf, WeakSystem, RequestingSocket, RequestId, Result, bSave](const TSharedPtr<FJsonObject>& Compile)
+            {
+                UMcpAutomationBridgeSubsystem* S = WeakSelf.Get();
+                if (!S)
+                {
+                    return;
+                }
+                Result->SetBoolField(TEXT("compileRequested"), true);
+                Result->SetObjectField(TEXT("compile"), Compile);
+                bool bCancelled = false;
+                bool bTimedOut = false;
+                bool bCompiled = false;
+                Compile->TryGetBoolField(TEXT("cancelled"), bCancelled);
+                Compile->TryGetBoolField(TEXT("timedOut"), bTimedOut);
+                Compile->TryGetBoolField(TEXT("compiled"), bCompiled);
+                if (bCancelled)
+                {
+                    S->SendAutomationResponse(RequestingSocket, RequestId, false,
+                        TEXT("Niagara system built; stopped waiting for its compile."), Result, TEXT("CANCELLED"));
+                    return;
+                }
+                if (bTimedOut)
+                {
+                    S->SendAutomationResponse(RequestingSocket, RequestId, false,
+                        TEXT("Niagara system built; its compile did not finish in time."), Result, TEXT("NIAGARA_COMPILE_TIMEOUT"));
+                    return;
+                }
+                // Written only once compiled: saving mid-compile would wait on it in PreSave.
+                UNiagaraSystem* Built = WeakSystem.Get();
+                if (bSave && Built)
+                {
+                    QueueAssetSave(Built);
+                }
+                if (!bCompiled)
+                {
+                    S->SendAutomationResponse(RequestingSocket, RequestId, false,
+                        TEXT("Niagara system built, but its scripts failed to compile."), Result, TEXT("COMPILE_FAILED"));
+                    return;
+                }
+                S->SendAutomationResponse(RequestingSocket, RequestId, true, TEXT("Niagara system built and compiled."), Result);
+            },
+            CompileError);
+        if (!bStarted)
+        {
+            SendAutomationError(RequestingSocket, RequestId, CompileError, TEXT("NIAGARA_COMPILE_IN_PROGRESS"));
+        }
+        return true;
+    }
+
     // =========================================================================
     // 12.2 Module Library (17 actions)
     // Helper macro to reduce repetition for module additions
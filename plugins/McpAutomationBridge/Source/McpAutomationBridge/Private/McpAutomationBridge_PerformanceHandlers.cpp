@@ -2,6 +2,8 @@
 #include "Dom/JsonObject.h"
 #include "McpAutomationBridgeHelpers.h"
 #include "McpAutomationBridgeSubsystem.h"
+#include "McpBenchmark.h"
+#include "McpMemorySnapshot.h"
 
 
 #if WITH_EDITOR
@@ -13,6 +15,7 @@
 #include "IMergeActorsTool.h"
 #include "Kismet/GameplayStatics.h"
 #include "LevelEditor.h"
+#include "LevelSequence.h"
 #include "ProfilingDebugging/ScopedTimers.h"
 #include "Subsystems/EditorActorSubsystem.h"
 
@@ -24,6 +27,7 @@ bool UMcpAutomationBridgeSubsystem::HandlePerformanceAction(
     TSharedPtr<FMcpBridgeWebSocket> RequestingSocket) {
   const FString Lower = Action.ToLower();
   if (!Lower.StartsWith(TEXT("generate_memory_report")) &&
+      !Lower.StartsWith(TEXT("memory_snapshot")) &&
       !Lower.StartsWith(TEXT("configure_texture_streaming")) &&
       !Lower.StartsWith(TEXT("merge_actors")) &&
       !Lower.StartsWith(TEXT("start_profiling")) &&
@@ -78,6 +82,74 @@ bool UMcpAutomationBridgeSubsystem::HandlePerformanceAction(
     SendAutomationResponse(RequestingSocket, RequestId, true,
                            TEXT("Memory report generated"), nullptr);
     return true;
+  } else if (Lower == TEXT("memory_snapshot")) {
+    // Structured alternative to memreport: per-class counts and resource
+    // sizes walked a slice per frame, streaming and RHI texture memory, and
+    // an optional diff against an earlier snapshot id.
+    FMcpMemorySnapshotOptions Options;
+    double TopN = Options.TopN;
+    Payload->TryGetNumberField(TEXT("topN"), TopN);
+    Options.TopN = static_cast<int32>(TopN);
+    Payload->TryGetNumberField(TEXT("budgetMs"), Options.BudgetMs);
+    Payload->TryGetStringField(TEXT("diffWith"), Options.DiffWith);
+    FString SortBy = TEXT("bytes");
+    Payload->TryGetStringField(TEXT("sortBy"), SortBy);
+    FString Mode = TEXT("exclusive");
+    Payload->TryGetStringField(TEXT("resourceSizeMode"), Mode);
+    if (!SortBy.Equals(TEXT("bytes"), ESearchCase::IgnoreCase) &&
+        !SortBy.Equals(TEXT("count"), ESearchCase::IgnoreCase)) {
+      SendAutomationError(RequestingSocket, RequestId,
+                          TEXT("sortBy must be 'bytes' or 'count'"),
+                          TEXT("INVALID_ARGUMENT"));
+      return true;
+    }
+    if (!Mode.Equals(TEXT("exclusive"), ESearchCase::IgnoreCase) &&
+        !Mode.Equals(TEXT("estimatedTotal"), ESearchCase::IgnoreCase)) {
+      SendAutomationError(RequestingSocket, RequestId,
+                          TEXT("resourceSizeMode must be 'exclusive' or 'estimatedTotal'"),
+                          TEXT("INVALID_ARGUMENT"));
+      return true;
+    }
+    Options.bSortByCount = SortBy.Equals(TEXT("count"), ESearchCase::IgnoreCase);
+    Options.bEstimatedTotal = Mode.Equals(TEXT("estimatedTotal"), ESearchCase::IgnoreCase);
+    if (!Options.DiffWith.IsEmpty() && !FMcpMemorySnapshot::HasSnapshot(Options.DiffWith)) {
+      SendAutomationError(RequestingSocket, RequestId,
+                          FString::Printf(TEXT("No stored memory snapshot '%s'"), *Options.DiffWith),
+                          TEXT("SNAPSHOT_NOT_FOUND"));
+      return true;
+    }
+
+    TWeakObjectPtr<UMcpAutomationBridgeSubsystem> WeakSelf(this);
+    FString Error;
+    const bool bStarted = FMcpMemorySnapshot::Start(
+        MoveTemp(Options),
+        [WeakSelf, RequestId](float Percent) {
+          UMcpAutomationBridgeSubsystem *S = WeakSelf.Get();
+          return S && S->SendProgressUpdate(RequestId, Percent,
+                                            TEXT("Walking objects"));
+        },
+        [WeakSelf, RequestingSocket, RequestId](const TSharedPtr<FJsonObject> &Result) {
+          UMcpAutomationBridgeSubsystem *S = WeakSelf.Get();
+          if (!S) {
+            return;
+          }
+          bool bCancelled = false;
+          Result->TryGetBoolField(TEXT("cancelled"), bCancelled);
+          if (bCancelled) {
+            S->SendAutomationResponse(RequestingSocket, RequestId, false,
+                                      TEXT("Memory snapshot cancelled"), Result, TEXT("CANCELLED"));
+            return;
+          }
+          S->SendAutomationResponse(RequestingSocket, RequestId, true,
+                                    TEXT("Memory snapshot captured"), Result);
+        },
+        Error);
+    if (!bStarted) {
+      SendAutomationError(RequestingSocket, RequestId, Error,
+                          FMcpMemorySnapshot::IsRunning() ? TEXT("MEMORY_SNAPSHOT_IN_PROGRESS")
+                                                          : TEXT("MEMORY_SNAPSHOT_FAILED"));
+    }
+    return true;
   } else if (Lower == TEXT("start_profiling")) {
     // "stat startfile"
     if (!GEditor)
@@ -457,33 +529,158 @@ bool UMcpAutomationBridgeSubsystem::HandlePerformanceAction(
                            FString());
     return true;
   } else if (Lower == TEXT("run_benchmark")) {
-    // Run performance benchmark
-    double Duration = 60.0;
-    Payload->TryGetNumberField(TEXT("duration"), Duration);
-
+    // Plays a camera path for duration seconds after a warm-up and replies
+    // with frame/game/render/GPU/RHI percentiles, hitches and a histogram,
+    // optionally saved as or compared against a per-map baseline.
+    if (!GEditor) {
+      SendAutomationError(RequestingSocket, RequestId, TEXT("Editor not available"), TEXT("NO_EDITOR"));
+      return true;
+    }
+    UWorld *World = GEditor->PlayWorld;
+    if (!World) {
+      World = GEditor->GetEditorWorldContext().World();
+    }
+
+    FMcpBenchmarkOptions Options;
+    Options.DurationSeconds = 60.0;
+    Options.WarmupSeconds = 3.0;
+    Payload->TryGetNumberField(TEXT("duration"), Options.DurationSeconds);
+    Payload->TryGetNumberField(TEXT("warmup"), Options.WarmupSeconds);
+    Payload->TryGetNumberField(TEXT("pathSeconds"), Options.PathSeconds);
+    Payload->TryGetBoolField(TEXT("loopPath"), Options.bLoopPath);
+    Payload->TryGetNumberField(TEXT("hitchThresholdMs"), Options.HitchThresholdMs);
+    Payload->TryGetBoolField(TEXT("csvProfile"), Options.bCsvProfile);
+    const TArray<TSharedPtr<FJsonValue>> *Edges = nullptr;
+    if (Payload->TryGetArrayField(TEXT("histogramMs"), Edges)) {
+      for (const TSharedPtr<FJsonValue> &Edge : *Edges) {
+        double Value = 0.0;
+        if (Edge.IsValid() && Edge->TryGetNumber(Value) && Value > 0.0) {
+          Options.HistogramEdgesMs.Add(Value);
+        }
+      }
+    }
+    const TArray<TSharedPtr<FJsonValue>> *Path = nullptr;
+    if (Payload->TryGetArrayField(TEXT("cameraPath"), Path)) {
+      for (const TSharedPtr<FJsonValue> &Key : *Path) {
+        const TSharedPtr<FJsonObject> KeyObj = Key.IsValid() ? Key->AsObject() : nullptr;
+        if (!KeyObj.IsValid()) {
+          SendAutomationError(RequestingSocket, RequestId,
+                              TEXT("cameraPath entries must be { location, rotation } objects"),
+                              TEXT("INVALID_ARGUMENT"));
+          return true;
+        }
+        Options.CameraPath.Add(FTransform(
+            ExtractRotatorField(KeyObj, TEXT("rotation"), FRotator::ZeroRotator),
+            ExtractVectorField(KeyObj, TEXT("location"), FVector::ZeroVector)));
+      }
+    }
+    FString SequencePath;
+    if (Payload->TryGetStringField(TEXT("sequencePath"), SequencePath) &&
+        !SequencePath.IsEmpty()) {
+      ULevelSequence *Sequence = LoadObject<ULevelSequence>(nullptr, *SequencePath);
+      if (!Sequence) {
+        SendAutomationError(RequestingSocket, RequestId,
+                            FString::Printf(TEXT("Level Sequence not found: %s"), *SequencePath),
+                            TEXT("ASSET_NOT_FOUND"));
+        return true;
+      }
+      Options.Sequence = Sequence;
+    }
+
+    // saveBaseline: name (or true for "default") to store this run under;
+    // baseline: name of a stored run of this map to compare against.
+    FString SaveName;
+    bool bSaveDefault = false;
+    if (!Payload->TryGetStringField(TEXT("saveBaseline"), SaveName) &&
+        Payload->TryGetBoolField(TEXT("saveBaseline"), bSaveDefault) && bSaveDefault) {
+      SaveName = TEXT("default");
+    }
+    FString CompareName;
+    Payload->TryGetStringField(TEXT("baseline"), CompareName);
+    for (const FString *Name : {&SaveName, &CompareName}) {
+      if (!Name->IsEmpty() && !FMcpBenchmark::IsValidBaselineName(*Name)) {
+        SendAutomationError(RequestingSocket, RequestId,
+                            FString::Printf(TEXT("Invalid baseline name '%s' (letters, digits, _ - .)"), **Name),
+                            TEXT("INVALID_ARGUMENT"));
+        return true;
+      }
+    }
+    double ThresholdPct = 10.0;
+    double MinDeltaMs = 0.5;
+    bool bFailOnRegression = false;
+    Payload->TryGetNumberField(TEXT("regressionThresholdPct"), ThresholdPct);
+    Payload->TryGetNumberField(TEXT("minDeltaMs"), MinDeltaMs);
+    Payload->TryGetBoolField(TEXT("failOnRegression"), bFailOnRegression);
     FString BenchmarkType = TEXT("all");
     Payload->TryGetStringField(TEXT("type"), BenchmarkType);
 
-    // Start profiling for benchmark
-    if (!GEditor)
-    {
-        SendAutomationError(RequestingSocket, RequestId, TEXT("Editor not available"), TEXT("NO_EDITOR"));
-        return true;
+    TWeakObjectPtr<UMcpAutomationBridgeSubsystem> WeakSelf(this);
+    FString Error;
+    const bool bStarted = FMcpBenchmark::Start(
+        World, MoveTemp(Options),
+        [WeakSelf, RequestId](const FString &Phase, float Percent) {
+          UMcpAutomationBridgeSubsystem *S = WeakSelf.Get();
+          return S && S->SendProgressUpdate(RequestId, Percent,
+                                            FString::Printf(TEXT("Benchmark %s"), *Phase));
+        },
+        [WeakSelf, RequestingSocket, RequestId, SaveName, CompareName, ThresholdPct,
+         MinDeltaMs, bFailOnRegression, BenchmarkType](const TSharedPtr<FJsonObject> &Summary) {
+          UMcpAutomationBridgeSubsystem *S = WeakSelf.Get();
+          if (!S) {
+            return;
+          }
+          bool bCancelled = false;
+          Summary->TryGetBoolField(TEXT("cancelled"), bCancelled);
+          TSharedPtr<FJsonObject> Resp = MakeShared<FJsonObject>(*Summary);
+          Resp->SetStringField(TEXT("type"), BenchmarkType);
+          if (bCancelled) {
+            S->SendAutomationResponse(RequestingSocket, RequestId, false,
+                                      TEXT("Benchmark cancelled"), Resp, TEXT("CANCELLED"));
+            return;
+          }
+          FString Map;
+          Summary->TryGetStringField(TEXT("map"), Map);
+          bool bRegressed = false;
+          if (!CompareName.IsEmpty()) {
+            TSharedPtr<FJsonObject> Baseline;
+            FString LoadError;
+            if (FMcpBenchmark::LoadBaseline(Map, CompareName, Baseline, LoadError)) {
+              TSharedPtr<FJsonObject> Diff =
+                  FMcpBenchmark::Compare(Summary, Baseline, ThresholdPct, MinDeltaMs);
+              Diff->SetStringField(TEXT("name"), CompareName);
+              Diff->TryGetBoolField(TEXT("regressed"), bRegressed);
+              Resp->SetObjectField(TEXT("comparison"), Diff);
+            } else {
+              Resp->SetStringField(TEXT("comparisonError"), LoadError);
+            }
+          }
+          if (!SaveName.IsEmpty()) {
+            FString SavedPath;
+            FString SaveError;
+            if (FMcpBenchmark::SaveBaseline(Summary, SaveName, SavedPath, SaveError)) {
+              Resp->SetStringField(TEXT("baselinePath"), SavedPath);
+            } else {
+              Resp->SetStringField(TEXT("baselineError"), SaveError);
+            }
+          }
+          Resp->SetBoolField(TEXT("regressed"), bRegressed);
+          if (bRegressed && bFailOnRegression) {
+            S->SendAutomationResponse(RequestingSocket, RequestId, false,
+                                      FString::Printf(TEXT("Performance regressed against baseline '%s'"), *CompareName),
+                                      Resp, TEXT("PERF_REGRESSION"));
+            return;
+          }
+          S->SendAutomationResponse(RequestingSocket, RequestId, true,
+                                    bRegressed ? TEXT("Benchmark complete (regressed against baseline)")
+                                               : TEXT("Benchmark complete"),
+                                    Resp);
+        },
+        Error);
+    if (!bStarted) {
+      SendAutomationError(RequestingSocket, RequestId, Error,
+                          FMcpBenchmark::IsRunning() ? TEXT("BENCHMARK_IN_PROGRESS")
+                                                     : TEXT("BENCHMARK_FAILED"));
     }
-
-    GEngine->Exec(GEditor->GetEditorWorldContext().World(),
-                  TEXT("stat startfile"));
-
-    TSharedPtr<FJsonObject> Resp = MakeShared<FJsonObject>();
-    Resp->SetNumberField(TEXT("duration"), Duration);
-    Resp->SetStringField(TEXT("type"), BenchmarkType);
-    Resp->SetStringField(TEXT("status"), TEXT("started"));
-
-    SendAutomationResponse(
-        RequestingSocket, RequestId, true,
-        FString::Printf(TEXT("Benchmark started (type: %s, duration: %.0fs)"),
-                        *BenchmarkType, Duration),
-        Resp);
     return true;
   } else if (Lower == TEXT("enable_gpu_timing")) {
     bool bEnabled = true;
@@ -4,6 +4,7 @@
 #include "McpAutomationBridgeGlobals.h"
 #include "McpAutomationBridgeHelpers.h"
 #include "McpAutomationBridgeSubsystem.h"
+#include "McpBridgeTrace.h"
 #include "McpConnectionManager.h"
 #include "Misc/ScopeExit.h"
 #include "Misc/ScopeLock.h"
@@ -34,7 +35,7 @@ void UMcpAutomationBridgeSubsystem::ProcessAutomationRequest(
          *RequestId, *Action,
          ConnectionManager.IsValid() ? ConnectionManager->GetActiveSocketCount()
                                      : 0,
-         PendingAutomationRequests.Num());
+         GetPendingAutomationRequestCount());
   if (!IsInGameThread()) {
     UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
            TEXT("Scheduling ProcessAutomationRequest on GameThread: "
@@ -54,22 +55,15 @@ void UMcpAutomationBridgeSubsystem::ProcessAutomationRequest(
   // Guard against unsafe engine states (Saving, GC, Async Loading)
   // Calling StaticFindObject (via ResolveClassByName) during these states can
   // cause crashes.
-  if (GIsSavingPackage || IsGarbageCollecting() || IsAsyncLoading()) {
+  if (const TCHAR *UnsafeReason = GetUnsafeEngineStateReason()) {
     UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
-           TEXT("Deferring ProcessAutomationRequest due to active "
-                "Serialization/GC/Loading: RequestId=%s Action=%s"),
-           *RequestId, *Action);
+           TEXT("Deferring ProcessAutomationRequest due to active %s: "
+                "RequestId=%s Action=%s"),
+           UnsafeReason, *RequestId, *Action);
 
-    FPendingAutomationRequest P;
-    P.RequestId = RequestId;
-    P.Action = Action;
-    P.Payload = Payload;
-    P.RequestingSocket = RequestingSocket;
-    {
-      FScopeLock Lock(&PendingAutomationRequestsMutex);
-      PendingAutomationRequests.Add(MoveTemp(P));
-      bPendingRequestsScheduled = true;
-    }
+    EnqueuePendingAutomationRequest(RequestId, Action, Payload,
+                                    RequestingSocket);
+    NoteEngineStateDeferral(UnsafeReason, 1);
     return;
   }
 
@@ -79,24 +73,28 @@ void UMcpAutomationBridgeSubsystem::ProcessAutomationRequest(
          *RequestId, *Action,
          bProcessingAutomationRequest ? TEXT("true") : TEXT("false"));
 
-  const FString LowerAction = Action.ToLower();
-
   if (ConnectionManager.IsValid()) {
     ConnectionManager->StartRequestTelemetry(RequestId, Action);
   }
 
+  // A cancel that raced the scheduler drain; nothing has run yet.
+  if (IsAutomationRequestCancelled(RequestId)) {
+    SendAutomationError(RequestingSocket, RequestId,
+                        TEXT("Request was cancelled before it started."),
+                        TEXT("CANCELLED"));
+    return;
+  }
+
+  // Read-only requests flagged thread-safe run on a worker, concurrently
+  // with editor frames and with each other.
+  if (TryDispatchThreadSafe(RequestId, Action, Payload, RequestingSocket)) {
+    return;
+  }
+
   // Reentrancy guard / enqueue
   if (bProcessingAutomationRequest) {
-    FPendingAutomationRequest P;
-    P.RequestId = RequestId;
-    P.Action = Action;
-    P.Payload = Payload;
-    P.RequestingSocket = RequestingSocket;
-    {
-      FScopeLock Lock(&PendingAutomationRequestsMutex);
-      PendingAutomationRequests.Add(MoveTemp(P));
-      bPendingRequestsScheduled = true;
-    }
+    EnqueuePendingAutomationRequest(RequestId, Action, Payload,
+                                    RequestingSocket);
     UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
            TEXT("Enqueued automation request %s for action %s (processing in "
                 "progress)."),
@@ -105,25 +103,28 @@ void UMcpAutomationBridgeSubsystem::ProcessAutomationRequest(
   }
 
   bProcessingAutomationRequest = true;
+  if (ConnectionManager.IsValid()) {
+    ConnectionManager->MarkRequestDispatched(RequestId);
+  }
   bool bDispatchHandled = false;
   FString ConsumedHandlerLabel = TEXT("unknown-handler");
   const double DispatchStartSeconds = FPlatformTime::Seconds();
-
-  auto HandleAndLog = [&](const TCHAR *HandlerLabel, auto &&Callable) -> bool {
-    const bool bResult = Callable();
-    if (bResult) {
-      bDispatchHandled = true;
-      ConsumedHandlerLabel = HandlerLabel;
-    }
-    return bResult;
-  };
+  // Registry rescans requested by this dispatch, a batch included, and by the
+  // pending requests drained after it run once, when this returns.
+  FMcpAssetScanQueue::FScope AssetScanScope;
+  // Package saves are flushed the same way; declared after the scan scope so
+  // they are written before the rescans read those files.
+  FMcpAssetSaveQueue::FScope AssetSaveScope;
 
   {
+    TRACE_CPUPROFILER_EVENT_SCOPE_STR("McpBridge::Handler");
     ON_SCOPE_EXIT {
       bProcessingAutomationRequest = false;
       const double DispatchEndSeconds = FPlatformTime::Seconds();
       const double DurationMs =
           (DispatchEndSeconds - DispatchStartSeconds) * 1000.0;
+      TRACE_BOOKMARK(TEXT("MCP done %s [%s] %.3f ms"), *ConsumedHandlerLabel,
+                     *RequestId, DurationMs);
       if (bDispatchHandled) {
         UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
                TEXT("ProcessAutomationRequest: Completed handler='%s' "
@@ -150,446 +151,8 @@ void UMcpAutomationBridgeSubsystem::ProcessAutomationRequest(
         ConnectionManager->RegisterRequestSocket(RequestId, RequestingSocket);
       }
 
-      // ---------------------------------------------------------
-      // Check Handler Registry (O(1) dispatch)
-      // ---------------------------------------------------------
-      if (const FAutomationHandler *Handler = AutomationHandlers.Find(Action)) {
-        if (HandleAndLog(*Action, [&]() {
-              return (*Handler)(RequestId, Action, Payload, RequestingSocket);
-            })) {
-          return;
-        }
-      }
-
-      UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
-             TEXT("ProcessAutomationRequest: Starting handler dispatch for "
-                  "action='%s'"),
-             *Action);
-
-      // Prioritize blueprint actions early only for blueprint-like actions to
-      // avoid noisy prefix logs
-      {
-        FString LowerNormalized = LowerAction;
-        LowerNormalized.ReplaceInline(TEXT("-"), TEXT("_"));
-        LowerNormalized.ReplaceInline(TEXT(" "), TEXT("_"));
-        const bool bLooksBlueprint =
-            (LowerNormalized.StartsWith(TEXT("blueprint_")) ||
-             LowerNormalized.StartsWith(TEXT("manage_blueprint")) ||
-             LowerNormalized.Contains(TEXT("_scs")) ||
-             LowerNormalized.Contains(TEXT("scs_")) ||
-             LowerNormalized.Contains(TEXT("scs")));
-        if (bLooksBlueprint) {
-          UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
-                 TEXT("ProcessAutomationRequest: Checking "
-                      "HandleBlueprintAction (early)"));
-          if (HandleAndLog(TEXT("HandleBlueprintAction (early)"), [&]() {
-                return HandleBlueprintAction(RequestId, Action, Payload,
-                                             RequestingSocket);
-              })) {
-            UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
-                   TEXT("HandleBlueprintAction (early) consumed request"));
-            return;
-          }
-        }
-      }
-
-      // Allow small handlers to short-circuit fast (property/function)
-      UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
-             TEXT("ProcessAutomationRequest: About to call "
-                  "HandleExecuteEditorFunction"));
-      if (HandleAndLog(TEXT("HandleExecuteEditorFunction"), [&]() {
-            return HandleExecuteEditorFunction(RequestId, Action, Payload,
-                                               RequestingSocket);
-          })) {
-        UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
-               TEXT("HandleExecuteEditorFunction consumed request"));
-        return;
-      }
-      UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
-             TEXT("ProcessAutomationRequest: HandleExecuteEditorFunction "
-                  "returned false"));
-
-      // Level utilities (top-level aliases)
-      UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
-             TEXT("ProcessAutomationRequest: Checking HandleLevelAction"));
-      if (HandleAndLog(TEXT("HandleLevelAction"), [&]() {
-            return HandleLevelAction(RequestId, Action, Payload,
-                                     RequestingSocket);
-          })) {
-        UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
-               TEXT("HandleLevelAction consumed request"));
-        return;
-      }
-
-      // Try asset actions early (materials, import, list, rename, etc.)
-      UE_LOG(
-          LogMcpAutomationBridgeSubsystem, Verbose,
-          TEXT("ProcessAutomationRequest: Checking HandleAssetAction (early)"));
-      if (HandleAndLog(TEXT("HandleAssetAction (early)"), [&]() {
-            return HandleAssetAction(RequestId, Action, Payload,
-                                     RequestingSocket);
-          })) {
-        UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
-               TEXT("HandleAssetAction (early) consumed request"));
-        return;
-      }
-      if (HandleAndLog(TEXT("HandleSetObjectProperty"), [&]() {
-            return HandleSetObjectProperty(RequestId, Action, Payload,
-                                           RequestingSocket);
-          }))
-        return;
-      if (HandleAndLog(TEXT("HandleGetObjectProperty"), [&]() {
-            return HandleGetObjectProperty(RequestId, Action, Payload,
-                                           RequestingSocket);
-          }))
-        return;
-
-      // Specialized actions (Array, Map, Set, Landscape, Foliage, Niagara,
-      // Animation, Sequencer, etc.) are now handled by the O(1)
-      // AutomationHandlers registry check at the top of this function. The
-      // linear checks have been removed for performance.
-
-      // Delegate asset/control/blueprint/sequence actions to their handlers
-      UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
-             TEXT("ProcessAutomationRequest: Checking HandleAssetAction"));
-      if (HandleAndLog(TEXT("HandleAssetAction"), [&]() {
-            return HandleAssetAction(RequestId, Action, Payload,
-                                     RequestingSocket);
-          })) {
-        UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
-               TEXT("HandleAssetAction consumed request"));
-        return;
-      }
-      UE_LOG(
-          LogMcpAutomationBridgeSubsystem, Verbose,
-          TEXT("ProcessAutomationRequest: Checking HandleControlActorAction"));
-      if (HandleAndLog(TEXT("HandleControlActorAction"), [&]() {
-            return HandleControlActorAction(RequestId, Action, Payload,
-                                            RequestingSocket);
-          })) {
-        UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
-               TEXT("HandleControlActorAction consumed request"));
-        return;
-      }
-      UE_LOG(
-          LogMcpAutomationBridgeSubsystem, Verbose,
-          TEXT("ProcessAutomationRequest: Checking HandleControlEditorAction"));
-      if (HandleAndLog(TEXT("HandleControlEditorAction"), [&]() {
-            return HandleControlEditorAction(RequestId, Action, Payload,
-                                             RequestingSocket);
-          })) {
-        UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
-               TEXT("HandleControlEditorAction consumed request"));
-        return;
-      }
-      UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
-             TEXT("ProcessAutomationRequest: Checking HandleUiAction"));
-      if (HandleAndLog(TEXT("HandleUiAction"), [&]() {
-            return HandleUiAction(RequestId, Action, Payload, RequestingSocket);
-          })) {
-        UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
-               TEXT("HandleUiAction consumed request"));
-        return;
-      }
-      UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
-             TEXT("ProcessAutomationRequest: Checking HandleBlueprintAction "
-                  "(late)"));
-      if (HandleAndLog(TEXT("HandleBlueprintAction (late)"), [&]() {
-            return HandleBlueprintAction(RequestId, Action, Payload,
-                                         RequestingSocket);
-          })) {
-        UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
-               TEXT("HandleBlueprintAction (late) consumed request"));
-        return;
-      }
-      UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
-             TEXT("ProcessAutomationRequest: Checking HandleSequenceAction"));
-      if (HandleAndLog(TEXT("HandleSequenceAction"), [&]() {
-            return HandleSequenceAction(RequestId, Action, Payload,
-                                        RequestingSocket);
-          })) {
-        UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
-               TEXT("HandleSequenceAction consumed request"));
-        return;
-      }
-      if (HandleAndLog(TEXT("HandleEffectAction"), [&]() {
-            return HandleEffectAction(RequestId, Action, Payload,
-                                      RequestingSocket);
-          }))
-        return;
-      UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
-             TEXT("ProcessAutomationRequest: Checking "
-                  "HandleAnimationPhysicsAction"));
-      if (HandleAndLog(TEXT("HandleAnimationPhysicsAction"), [&]() {
-            return HandleAnimationPhysicsAction(RequestId, Action, Payload,
-                                                RequestingSocket);
-          })) {
-        UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
-               TEXT("HandleAnimationPhysicsAction consumed request"));
-        return;
-      }
-      if (HandleAndLog(TEXT("HandleAudioAction"), [&]() {
-            return HandleAudioAction(RequestId, Action, Payload,
-                                     RequestingSocket);
-          }))
-        return;
-      if (HandleAndLog(TEXT("HandleLightingAction"), [&]() {
-            return HandleLightingAction(RequestId, Action, Payload,
-                                        RequestingSocket);
-          }))
-        return;
-      if (HandleAndLog(TEXT("HandlePerformanceAction"), [&]() {
-            return HandlePerformanceAction(RequestId, Action, Payload,
-                                           RequestingSocket);
-          }))
-        return;
-      if (HandleAndLog(TEXT("HandleBuildEnvironmentAction"), [&]() {
-            return HandleBuildEnvironmentAction(RequestId, Action, Payload,
-                                                RequestingSocket);
-          }))
-        return;
-      if (HandleAndLog(TEXT("HandleControlEnvironmentAction"), [&]() {
-            return HandleControlEnvironmentAction(RequestId, Action, Payload,
-                                                  RequestingSocket);
-          }))
-        return;
-
-      // Additional consolidated tool handlers
-      if (HandleAndLog(TEXT("HandleSystemControlAction"), [&]() {
-            return HandleSystemControlAction(RequestId, Action, Payload,
-                                             RequestingSocket);
-          }))
-        return;
-      if (HandleAndLog(TEXT("HandleConsoleCommandAction"), [&]() {
-            return HandleConsoleCommandAction(RequestId, Action, Payload,
-                                              RequestingSocket);
-          }))
-        return;
-      if (HandleAndLog(TEXT("HandleInspectAction"), [&]() {
-            return HandleInspectAction(RequestId, Action, Payload,
-                                       RequestingSocket);
-          }))
-        return;
-
-      // 1. Editor Authoring & Graph Editing
-      if (HandleAndLog(TEXT("HandleBlueprintGraphAction"), [&]() {
-            return HandleBlueprintGraphAction(RequestId, Action, Payload,
-                                              RequestingSocket);
-          }))
-        return;
-      if (HandleAndLog(TEXT("HandleNiagaraGraphAction"), [&]() {
-            return HandleNiagaraGraphAction(RequestId, Action, Payload,
-                                            RequestingSocket);
-          }))
-        return;
-      if (HandleAndLog(TEXT("HandleMaterialGraphAction"), [&]() {
-            return HandleMaterialGraphAction(RequestId, Action, Payload,
-                                             RequestingSocket);
-          }))
-        return;
-      if (HandleAndLog(TEXT("HandleBehaviorTreeAction"), [&]() {
-            return HandleBehaviorTreeAction(RequestId, Action, Payload,
-                                            RequestingSocket);
-          }))
-        return;
-      if (HandleAndLog(TEXT("HandleWorldPartitionAction"), [&]() {
-            return HandleWorldPartitionAction(RequestId, Action, Payload,
-                                              RequestingSocket);
-          }))
-        return;
-      if (HandleAndLog(TEXT("HandleRenderAction"), [&]() {
-            return HandleRenderAction(RequestId, Action, Payload,
-                                      RequestingSocket);
-          }))
-        return;
-
-      // Phase 6: Geometry Script
-      if (HandleAndLog(TEXT("HandleGeometryAction"), [&]() {
-            return HandleGeometryAction(RequestId, Action, Payload,
-                                        RequestingSocket);
-          }))
-        return;
-
-      // Phase 7: Skeleton & Rigging
-      if (HandleAndLog(TEXT("HandleManageSkeleton"), [&]() {
-            return HandleManageSkeleton(RequestId, Action, Payload, RequestingSocket);
-          }))
-        return;
-
-      // Phase 8: Material Authoring
-      if (HandleAndLog(TEXT("HandleManageMaterialAuthoringAction"), [&]() {
-            return HandleManageMaterialAuthoringAction(RequestId, Action, Payload,
-                                                        RequestingSocket);
-          }))
-        return;
-
-      // Phase 9: Texture Management
-      if (HandleAndLog(TEXT("HandleManageTextureAction"), [&]() {
-            return HandleManageTextureAction(RequestId, Action, Payload,
-                                             RequestingSocket);
-          }))
-        return;
-
-      // Phase 10: Animation Authoring
-      if (HandleAndLog(TEXT("HandleManageAnimationAuthoringAction"), [&]() {
-            return HandleManageAnimationAuthoringAction(RequestId, Action, Payload,
-                                                         RequestingSocket);
-          }))
-        return;
-
-      // Phase 11: Audio Authoring
-      if (HandleAndLog(TEXT("HandleManageAudioAuthoringAction"), [&]() {
-            return HandleManageAudioAuthoringAction(RequestId, Action, Payload,
-                                                    RequestingSocket);
-          }))
-        return;
-
-      // Phase 12: Niagara Authoring
-      if (HandleAndLog(TEXT("HandleManageNiagaraAuthoringAction"), [&]() {
-            return HandleManageNiagaraAuthoringAction(RequestId, Action, Payload,
-                                                       RequestingSocket);
-          }))
-        return;
-
-      // Phase 13: GAS (Gameplay Ability System)
-      if (HandleAndLog(TEXT("HandleManageGASAction"), [&]() {
-            return HandleManageGASAction(RequestId, Action, Payload,
-                                         RequestingSocket);
-          }))
-        return;
-
-      // Phase 14: Character & Movement System
-      if (HandleAndLog(TEXT("HandleManageCharacterAction"), [&]() {
-            return HandleManageCharacterAction(RequestId, Action, Payload,
-                                               RequestingSocket);
-          }))
-        return;
-
-      // Phase 15: Combat & Weapons System
-      if (HandleAndLog(TEXT("HandleManageCombatAction"), [&]() {
-            return HandleManageCombatAction(RequestId, Action, Payload,
-                                            RequestingSocket);
-          }))
-        return;
-
-      // Phase 16: AI System
-      if (HandleAndLog(TEXT("HandleManageAIAction"), [&]() {
-            return HandleManageAIAction(RequestId, Action, Payload,
-                                        RequestingSocket);
-          }))
-        return;
-
-      // Phase 17: Inventory & Items System
-      if (HandleAndLog(TEXT("HandleManageInventoryAction"), [&]() {
-            return HandleManageInventoryAction(RequestId, Action, Payload,
-                                               RequestingSocket);
-          }))
-        return;
-
-      // Phase 18: Interaction System
-      if (HandleAndLog(TEXT("HandleManageInteractionAction"), [&]() {
-            return HandleManageInteractionAction(RequestId, Action, Payload,
-                                                 RequestingSocket);
-          }))
-        return;
-
-      // Phase 19: Widget Authoring System
-      if (HandleAndLog(TEXT("HandleManageWidgetAuthoringAction"), [&]() {
-            return HandleManageWidgetAuthoringAction(RequestId, Action, Payload,
-                                                     RequestingSocket);
-          }))
-        return;
-
-      // Phase 20: Networking & Multiplayer
-      if (HandleAndLog(TEXT("HandleManageNetworkingAction"), [&]() {
-            return HandleManageNetworkingAction(RequestId, Action, Payload,
-                                                RequestingSocket);
-          }))
-        return;
-
-      // Phase 21: Game Framework
-      if (HandleAndLog(TEXT("HandleManageGameFrameworkAction"), [&]() {
-            return HandleManageGameFrameworkAction(RequestId, Action, Payload,
-                                                   RequestingSocket);
-          }))
-        return;
-
-      // Phase 22: Sessions & Local Multiplayer
-      if (HandleAndLog(TEXT("HandleManageSessionsAction"), [&]() {
-            return HandleManageSessionsAction(RequestId, Action, Payload,
-                                              RequestingSocket);
-          }))
-        return;
-
-      // Phase 23: Level Structure
-      if (HandleAndLog(TEXT("HandleManageLevelStructureAction"), [&]() {
-            return HandleManageLevelStructureAction(RequestId, Action, Payload,
-                                                    RequestingSocket);
-          }))
-        return;
-
-      // Phase 24: Volumes & Zones
-      if (HandleAndLog(TEXT("HandleManageVolumesAction"), [&]() {
-            return HandleManageVolumesAction(RequestId, Action, Payload,
-                                             RequestingSocket);
-          }))
-        return;
-
-      // Phase 25: Navigation System
-      if (HandleAndLog(TEXT("HandleManageNavigationAction"), [&]() {
-            return HandleManageNavigationAction(RequestId, Action, Payload,
-                                                RequestingSocket);
-          }))
-        return;
-
-      // Phase 26: Spline System
-      if (HandleAndLog(TEXT("HandleManageSplinesAction"), [&]() {
-            return HandleManageSplinesAction(RequestId, Action, Payload,
-                                             RequestingSocket);
-          }))
-        return;
-
-      // 2. Execution & Build / Test Pipeline
-      if (HandleAndLog(TEXT("HandlePipelineAction"), [&]() {
-            return HandlePipelineAction(RequestId, Action, Payload,
-                                        RequestingSocket);
-          }))
-        return;
-      if (HandleAndLog(TEXT("HandleTestAction"), [&]() {
-            return HandleTestAction(RequestId, Action, Payload,
-                                    RequestingSocket);
-          }))
-        return;
-
-      // 3. Observability, Logs, Debugging & History
-      if (HandleAndLog(TEXT("HandleLogAction"), [&]() {
-            return HandleLogAction(RequestId, Action, Payload,
-                                   RequestingSocket);
-          }))
-        return;
-      if (HandleAndLog(TEXT("HandleDebugAction"), [&]() {
-            return HandleDebugAction(RequestId, Action, Payload,
-                                     RequestingSocket);
-          }))
-        return;
-      if (HandleAndLog(TEXT("HandleAssetQueryAction"), [&]() {
-            return HandleAssetQueryAction(RequestId, Action, Payload,
-                                          RequestingSocket);
-          }))
-        return;
-      if (HandleAndLog(TEXT("HandleInsightsAction"), [&]() {
-            return HandleInsightsAction(RequestId, Action, Payload,
-                                        RequestingSocket);
-          }))
-        return;
-
-      // Unhandled action
-      bDispatchHandled = true;
-      ConsumedHandlerLabel = TEXT("SendAutomationError (unknown action)");
-      SendAutomationError(
-          RequestingSocket, RequestId,
-          FString::Printf(TEXT("Unknown automation action: %s"), *Action),
-          TEXT("UNKNOWN_ACTION"));
+      bDispatchHandled = DispatchAutomationAction(
+          RequestId, Action, Payload, RequestingSocket, ConsumedHandlerLabel);
     } catch (const std::exception &E) {
       UE_LOG(LogMcpAutomationBridgeSubsystem, Error,
              TEXT("Unhandled exception processing automation request %s: %s"),
@@ -614,6 +177,760 @@ void UMcpAutomationBridgeSubsystem::ProcessAutomationRequest(
   }
 }
 
+namespace {
+// Pattern-matched action names are interned and cached only once a route
+// has consumed them; this caps how many such names the cache may hold.
+constexpr int32 MaxLazyRouteCacheEntries = 4096;
+} // namespace
+
+/**
+ * @brief Runs the handler registry and the fallback route table for one
+ * action.
+ *
+ * Callers own the reentrancy guard, telemetry and exception handling; this is
+ * shared by ProcessAutomationRequest and the batch handler.
+ *
+ * @param RequestId Identifier the handler responds to.
+ * @param Action Action name to dispatch.
+ * @param Payload Action payload.
+ * @param RequestingSocket Socket the response is routed to.
+ * @param OutHandlerLabel Receives the label of the consuming handler.
+ * @return true once a handler (or the unknown-action error) responded.
+ */
+bool UMcpAutomationBridgeSubsystem::DispatchAutomationAction(
+    const FString &RequestId, const FString &Action,
+    const TSharedPtr<FJsonObject> &Payload,
+    TSharedPtr<FMcpBridgeWebSocket> RequestingSocket,
+    FString &OutHandlerLabel) {
+  EnsureAutomationDispatch();
+
+  // FNAME_Find keeps arbitrary client strings out of the name table; an
+  // action that was never interned cannot be a registry or route key.
+  const FName ActionName(*Action, FNAME_Find);
+  if (!ActionName.IsNone()) {
+    if (const FAutomationHandler *Handler =
+            AutomationHandlers.Find(ActionName)) {
+      MCP_TRACE_LABEL_SCOPE(*Action);
+      if ((*Handler)(RequestId, Action, Payload, RequestingSocket)) {
+        OutHandlerLabel = Action;
+        return true;
+      }
+    } else if (const FAutomationHandlerMethod *Method =
+                   BuiltinAutomationHandlers.Find(ActionName)) {
+      MCP_TRACE_LABEL_SCOPE(*Action);
+      if ((this->**Method)(RequestId, Action, Payload, RequestingSocket)) {
+        OutHandlerLabel = Action;
+        return true;
+      }
+    }
+  }
+
+  FString NormalizedAction = Action.ToLower();
+  NormalizedAction.ReplaceInline(TEXT("-"), TEXT("_"));
+  NormalizedAction.ReplaceInline(TEXT(" "), TEXT("_"));
+  const FName RouteKey =
+      NormalizedAction.Equals(Action, ESearchCase::IgnoreCase)
+          ? ActionName
+          : FName(*NormalizedAction, FNAME_Find);
+
+  // Copy the candidate list: handlers may re-enter dispatch (batch) and
+  // grow the cache while we iterate.
+  FAutomationRouteList Candidates;
+  bool bPrecomputed = false;
+  if (!RouteKey.IsNone()) {
+    if (const FAutomationRouteList *Found =
+            AutomationRouteCandidates.Find(RouteKey)) {
+      Candidates = *Found;
+      bPrecomputed = true;
+    }
+  }
+  if (!bPrecomputed) {
+    FindPatternRoutes(NormalizedAction, Candidates);
+  }
+
+  for (const int32 RouteIndex : Candidates) {
+    const FAutomationRoute &Route = AutomationRoutes[RouteIndex];
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
+           TEXT("DispatchAutomationAction: trying %s for action='%s'"),
+           Route.Label, *Action);
+    MCP_TRACE_LABEL_SCOPE(Route.Label);
+    if (Route.Handler(RequestId, Action, Payload, RequestingSocket)) {
+      OutHandlerLabel = Route.Label;
+      if (!bPrecomputed &&
+          AutomationRouteCandidates.Num() < MaxLazyRouteCacheEntries) {
+        AutomationRouteCandidates.Add(FName(*NormalizedAction),
+                                      MoveTemp(Candidates));
+      }
+      return true;
+    }
+  }
+
+  // Unhandled action
+  OutHandlerLabel = TEXT("SendAutomationError (unknown action)");
+  SendAutomationError(
+      RequestingSocket, RequestId,
+      FString::Printf(TEXT("Unknown automation action: %s"), *Action),
+      TEXT("UNKNOWN_ACTION"));
+  return true;
+}
+
+bool UMcpAutomationBridgeSubsystem::FAutomationRoute::MatchesPattern(
+    const FString &NormalizedAction) const {
+  for (const FString &Prefix : Prefixes) {
+    if (NormalizedAction.StartsWith(Prefix, ESearchCase::CaseSensitive)) {
+      return true;
+    }
+  }
+  for (const FString &Substring : Substrings) {
+    if (NormalizedAction.Contains(Substring, ESearchCase::CaseSensitive)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * @brief Collects, in priority order, the routes whose prefixes or
+ * substrings match an action that has no precomputed entry.
+ *
+ * @param NormalizedAction Lower-case action with '-' and ' ' mapped to '_'.
+ * @param OutRoutes Receives matching route indices.
+ */
+void UMcpAutomationBridgeSubsystem::FindPatternRoutes(
+    const FString &NormalizedAction, FAutomationRouteList &OutRoutes) const {
+  for (int32 Index = 0; Index < AutomationRoutes.Num(); ++Index) {
+    if (AutomationRoutes[Index].MatchesPattern(NormalizedAction)) {
+      OutRoutes.Add(Index);
+    }
+  }
+}
+
+/**
+ * @brief Appends a fallback route. Routes are tried in registration order
+ * after the registry, so register narrower routes first.
+ *
+ * @param Label Handler label reported in telemetry and logs.
+ * @param Handler Callable invoked for matching actions.
+ * @param Actions Exact action names the route owns.
+ * @param Prefixes Lower-case prefixes of generated action names it owns.
+ * @param Substrings Lower-case substrings of action names it owns.
+ */
+void UMcpAutomationBridgeSubsystem::RegisterAutomationRoute(
+    const TCHAR *Label, FAutomationHandler Handler,
+    std::initializer_list<const TCHAR *> Actions,
+    std::initializer_list<const TCHAR *> Prefixes,
+    std::initializer_list<const TCHAR *> Substrings) {
+  if (!Handler) {
+    return;
+  }
+  FAutomationRoute &Route = AutomationRoutes.AddDefaulted_GetRef();
+  Route.Label = Label;
+  Route.Handler = MoveTemp(Handler);
+  for (const TCHAR *Name : Actions) {
+    Route.Actions.AddUnique(FName(Name));
+  }
+  for (const TCHAR *Prefix : Prefixes) {
+    Route.Prefixes.Add(FString(Prefix).ToLower());
+  }
+  for (const TCHAR *Substring : Substrings) {
+    Route.Substrings.Add(FString(Substring).ToLower());
+  }
+}
+
+/**
+ * @brief Declares the fallback routes for the consolidated tool handlers.
+ *
+ * The order preserves the priority of the former if-chain: when several
+ * routes claim an action, the first one that returns true consumes it.
+ * Must run after InitializeHandlers() so the precomputed table covers every
+ * registered action.
+ */
+void UMcpAutomationBridgeSubsystem::InitializeAutomationRoutes() {
+  auto Bind = [this](FAutomationHandlerMethod Method) -> FAutomationHandler {
+    return [this, Method](const FString &R, const FString &A,
+                          const TSharedPtr<FJsonObject> &P,
+                          TSharedPtr<FMcpBridgeWebSocket> S) {
+      return (this->*Method)(R, A, P, S);
+    };
+  };
+
+  AutomationRoutes.Reset();
+
+  // Blueprint-like actions are tried first so SCS edits are not claimed by
+  // the broader property handlers below.
+  RegisterAutomationRoute(
+      TEXT("HandleBlueprintAction (early)"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleBlueprintAction), {},
+      {TEXT("blueprint_"), TEXT("manage_blueprint")},
+      {TEXT("scs")});
+
+  // Small handlers that short-circuit fast (property/function)
+  RegisterAutomationRoute(
+      TEXT("HandleExecuteEditorFunction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleExecuteEditorFunction), {},
+      {}, {TEXT("execute_editor_function"), TEXT("execute_console_command")});
+
+  // Level utilities (top-level aliases)
+  RegisterAutomationRoute(
+      TEXT("HandleLevelAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleLevelAction),
+      {TEXT("manage_level"), TEXT("save_current_level"),
+       TEXT("create_new_level"), TEXT("stream_level"), TEXT("spawn_light"),
+       TEXT("build_lighting"), TEXT("bake_lightmap"), TEXT("list_levels"),
+       TEXT("export_level"), TEXT("import_level"), TEXT("add_sublevel")});
+
+  // Asset actions (materials, import, list, rename, etc.)
+  RegisterAutomationRoute(
+      TEXT("HandleAssetAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleAssetAction),
+      {TEXT("manage_asset"),
+       TEXT("import"),
+       TEXT("duplicate"),
+       TEXT("rename"),
+       TEXT("move"),
+       TEXT("delete"),
+       TEXT("delete_asset"),
+       TEXT("delete_assets"),
+       TEXT("create_folder"),
+       TEXT("create_material"),
+       TEXT("create_material_instance"),
+       TEXT("get_dependencies"),
+       TEXT("get_asset_graph"),
+       TEXT("set_tags"),
+       TEXT("set_metadata"),
+       TEXT("get_metadata"),
+       TEXT("validate"),
+       TEXT("list"),
+       TEXT("list_assets"),
+       TEXT("generate_report"),
+       TEXT("create_thumbnail"),
+       TEXT("generate_thumbnail"),
+       TEXT("add_material_parameter"),
+       TEXT("list_instances"),
+       TEXT("reset_instance_parameters"),
+       TEXT("exists"),
+       TEXT("get_material_stats"),
+       TEXT("search_assets"),
+       TEXT("fixup_redirectors"),
+       TEXT("bulk_rename"),
+       TEXT("bulk_delete"),
+       TEXT("generate_lods"),
+       TEXT("nanite_rebuild_mesh"),
+       TEXT("bulk_build_meshes"),
+       TEXT("source_control_checkout"),
+       TEXT("source_control_submit"),
+       TEXT("get_source_control_state"),
+       TEXT("source_control_enable"),
+       TEXT("analyze_graph"),
+       TEXT("find_by_tag"),
+       TEXT("add_material_node"),
+       TEXT("connect_material_pins"),
+       TEXT("remove_material_node"),
+       TEXT("break_material_connections"),
+       TEXT("get_material_node_details"),
+       TEXT("rebuild_material")});
+
+  RegisterAutomationRoute(
+      TEXT("HandleSetObjectProperty"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleSetObjectProperty), {}, {},
+      {TEXT("set_object_property")});
+  RegisterAutomationRoute(
+      TEXT("HandleGetObjectProperty"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleGetObjectProperty), {}, {},
+      {TEXT("get_object_property")});
+  RegisterAutomationRoute(
+      TEXT("HandleGetPropertiesBulk"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleGetPropertiesBulk), {}, {},
+      {TEXT("get_properties_bulk")});
+  RegisterAutomationRoute(
+      TEXT("HandleSetPropertiesBulk"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleSetPropertiesBulk), {}, {},
+      {TEXT("set_properties_bulk")});
+
+  // Control/blueprint/sequence tool families
+  RegisterAutomationRoute(
+      TEXT("HandleControlActorAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleControlActorAction), {},
+      {TEXT("control_actor")});
+  RegisterAutomationRoute(
+      TEXT("HandleControlEditorAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleControlEditorAction), {},
+      {TEXT("control_editor")});
+  RegisterAutomationRoute(
+      TEXT("HandleUiAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleUiAction),
+      {TEXT("system_control"), TEXT("manage_ui")});
+  RegisterAutomationRoute(
+      TEXT("HandleBlueprintAction (late)"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleBlueprintAction), {},
+      {TEXT("blueprint_"), TEXT("manage_blueprint"),
+       TEXT("manageblueprint")},
+      {TEXT("blueprint"), TEXT("scs")});
+  RegisterAutomationRoute(
+      TEXT("HandleSequenceAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleSequenceAction),
+      {TEXT("manage_sequence")}, {TEXT("sequence_")});
+  RegisterAutomationRoute(
+      TEXT("HandleEffectAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleEffectAction),
+      {TEXT("spawn_niagara"), TEXT("set_niagara_parameter"),
+       TEXT("list_debug_shapes"), TEXT("clear_debug_shapes")},
+      {TEXT("create_effect"), TEXT("add_"), TEXT("set_parameter"),
+       TEXT("bind_parameter"), TEXT("enable_gpu"), TEXT("configure_event")});
+  RegisterAutomationRoute(
+      TEXT("HandleAnimationPhysicsAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleAnimationPhysicsAction), {},
+      {TEXT("animation_physics")});
+  RegisterAutomationRoute(
+      TEXT("HandleAudioAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleAudioAction), {},
+      {TEXT("audio_"), TEXT("create_sound_"), TEXT("play_sound_"),
+       TEXT("set_sound_"), TEXT("push_sound_"), TEXT("pop_sound_"),
+       TEXT("create_audio_"), TEXT("create_ambient_"), TEXT("create_reverb_"),
+       TEXT("enable_audio_"), TEXT("fade_sound"), TEXT("set_doppler_"),
+       TEXT("set_audio_"), TEXT("clear_sound_"), TEXT("set_base_sound_"),
+       TEXT("prime_"), TEXT("spawn_sound_")});
+  RegisterAutomationRoute(
+      TEXT("HandleLightingAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleLightingAction), {},
+      {TEXT("spawn_light"), TEXT("spawn_sky_light"), TEXT("create_sky_light"),
+       TEXT("create_light"), TEXT("build_lighting"), TEXT("bake_lightmap"),
+       TEXT("ensure_single_sky_light"), TEXT("create_lighting_enabled_level"),
+       TEXT("create_lightmass_volume"), TEXT("create_dynamic_light"),
+       TEXT("setup_volumetric_fog"), TEXT("setup_global_illumination"),
+       TEXT("configure_shadows"), TEXT("set_exposure"),
+       TEXT("list_light_types"), TEXT("set_ambient_occlusion")});
+  RegisterAutomationRoute(
+      TEXT("HandlePerformanceAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandlePerformanceAction), {},
+      {TEXT("generate_memory_report"), TEXT("memory_snapshot"),
+       TEXT("configure_texture_streaming"),
+       TEXT("merge_actors"), TEXT("start_profiling"), TEXT("stop_profiling"),
+       TEXT("show_fps"), TEXT("show_stats"), TEXT("set_scalability"),
+       TEXT("set_resolution_scale"), TEXT("set_vsync"),
+       TEXT("set_frame_rate_limit"), TEXT("configure_nanite"),
+       TEXT("configure_lod"), TEXT("run_benchmark"),
+       TEXT("enable_gpu_timing"), TEXT("apply_baseline_settings"),
+       TEXT("optimize_draw_calls"), TEXT("configure_occlusion_culling"),
+       TEXT("optimize_shaders"), TEXT("configure_world_partition")});
+  RegisterAutomationRoute(
+      TEXT("HandleBuildEnvironmentAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleBuildEnvironmentAction), {},
+      {TEXT("build_environment")});
+  RegisterAutomationRoute(
+      TEXT("HandleControlEnvironmentAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleControlEnvironmentAction),
+      {}, {TEXT("control_environment")});
+
+  // Additional consolidated tool handlers
+  RegisterAutomationRoute(
+      TEXT("HandleSystemControlAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleSystemControlAction), {},
+      {TEXT("system_control")});
+  RegisterAutomationRoute(
+      TEXT("HandleConsoleCommandAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleConsoleCommandAction),
+      {TEXT("console_command"), TEXT("system_control")});
+  RegisterAutomationRoute(
+      TEXT("HandleInspectAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleInspectAction),
+      {TEXT("inspect")});
+
+  // 1. Editor Authoring & Graph Editing
+  RegisterAutomationRoute(
+      TEXT("HandleBlueprintGraphAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleBlueprintGraphAction),
+      {TEXT("manage_blueprint_graph")});
+  RegisterAutomationRoute(
+      TEXT("HandleNiagaraGraphAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleNiagaraGraphAction),
+      {TEXT("manage_niagara_graph")});
+  RegisterAutomationRoute(
+      TEXT("HandleMaterialGraphAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleMaterialGraphAction),
+      {TEXT("manage_material_graph")});
+  RegisterAutomationRoute(
+      TEXT("HandleBehaviorTreeAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleBehaviorTreeAction),
+      {TEXT("manage_behavior_tree")});
+  RegisterAutomationRoute(
+      TEXT("HandleWorldPartitionAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleWorldPartitionAction),
+      {TEXT("manage_world_partition")});
+  RegisterAutomationRoute(
+      TEXT("HandleRenderAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleRenderAction),
+      {TEXT("manage_render")});
+
+  // Phases 6-26: authoring and gameplay systems
+  RegisterAutomationRoute(
+      TEXT("HandleGeometryAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleGeometryAction),
+      {TEXT("manage_geometry")});
+  RegisterAutomationRoute(
+      TEXT("HandleManageSkeleton"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleManageSkeleton),
+      {TEXT("manage_skeleton")});
+  RegisterAutomationRoute(
+      TEXT("HandleManageMaterialAuthoringAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleManageMaterialAuthoringAction),
+      {TEXT("manage_material_authoring")});
+  RegisterAutomationRoute(
+      TEXT("HandleManageTextureAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleManageTextureAction),
+      {TEXT("manage_texture")});
+  RegisterAutomationRoute(
+      TEXT("HandleManageAnimationAuthoringAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleManageAnimationAuthoringAction),
+      {TEXT("manage_animation_authoring")});
+  RegisterAutomationRoute(
+      TEXT("HandleManageAudioAuthoringAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleManageAudioAuthoringAction),
+      {}, {TEXT("manage_audio_authoring")});
+  RegisterAutomationRoute(
+      TEXT("HandleManageNiagaraAuthoringAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleManageNiagaraAuthoringAction),
+      {TEXT("manage_niagara_authoring")});
+  RegisterAutomationRoute(
+      TEXT("HandleManageGASAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleManageGASAction),
+      {TEXT("manage_gas")});
+  RegisterAutomationRoute(
+      TEXT("HandleManageCharacterAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleManageCharacterAction),
+      {TEXT("manage_character")});
+  RegisterAutomationRoute(
+      TEXT("HandleManageCombatAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleManageCombatAction),
+      {TEXT("manage_combat")});
+  RegisterAutomationRoute(
+      TEXT("HandleManageAIAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleManageAIAction),
+      {TEXT("manage_ai")});
+  RegisterAutomationRoute(
+      TEXT("HandleManageInventoryAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleManageInventoryAction),
+      {TEXT("manage_inventory")});
+  RegisterAutomationRoute(
+      TEXT("HandleManageInteractionAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleManageInteractionAction),
+      {TEXT("manage_interaction")});
+  RegisterAutomationRoute(
+      TEXT("HandleManageWidgetAuthoringAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleManageWidgetAuthoringAction),
+      {TEXT("manage_widget_authoring")});
+  RegisterAutomationRoute(
+      TEXT("HandleManageNetworkingAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleManageNetworkingAction),
+      {TEXT("manage_networking")});
+  RegisterAutomationRoute(
+      TEXT("HandleManageGameFrameworkAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleManageGameFrameworkAction),
+      {TEXT("manage_game_framework")});
+  RegisterAutomationRoute(
+      TEXT("HandleManageSessionsAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleManageSessionsAction),
+      {TEXT("manage_sessions")});
+  RegisterAutomationRoute(
+      TEXT("HandleManageLevelStructureAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleManageLevelStructureAction),
+      {TEXT("manage_level_structure")});
+  RegisterAutomationRoute(
+      TEXT("HandleManageVolumesAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleManageVolumesAction),
+      {TEXT("manage_volumes")});
+  RegisterAutomationRoute(
+      TEXT("HandleManageNavigationAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleManageNavigationAction),
+      {TEXT("manage_navigation")});
+  RegisterAutomationRoute(
+      TEXT("HandleManageSplinesAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleManageSplinesAction),
+      {TEXT("manage_splines")});
+
+  // 2. Execution & Build / Test Pipeline
+  RegisterAutomationRoute(
+      TEXT("HandlePipelineAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandlePipelineAction),
+      {TEXT("manage_pipeline")});
+  RegisterAutomationRoute(
+      TEXT("HandleTestAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleTestAction),
+      {TEXT("manage_tests")});
+
+  // 3. Observability, Logs, Debugging & History
+  RegisterAutomationRoute(
+      TEXT("HandleLogAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleLogAction),
+      {TEXT("manage_logs")});
+  RegisterAutomationRoute(
+      TEXT("HandleDebugAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleDebugAction),
+      {TEXT("manage_debug")});
+  RegisterAutomationRoute(
+      TEXT("HandleAssetQueryAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleAssetQueryAction),
+      {TEXT("asset_query")});
+  RegisterAutomationRoute(
+      TEXT("HandleInsightsAction"),
+      Bind(&UMcpAutomationBridgeSubsystem::HandleInsightsAction),
+      {TEXT("manage_insights")});
+
+  BuildAutomationRouteTable();
+}
+
+/**
+ * @brief Precomputes the candidate routes for every registered and declared
+ * action name and logs a report of overlapping and unreachable routes.
+ */
+void UMcpAutomationBridgeSubsystem::BuildAutomationRouteTable() {
+  AutomationRouteCandidates.Reset();
+
+  TMap<FName, TArray<const TCHAR *>> Owners;
+  for (const FAutomationRoute &Route : AutomationRoutes) {
+    for (const FName &Name : Route.Actions) {
+      Owners.FindOrAdd(Name).Add(Route.Label);
+    }
+  }
+  TSet<FName> Keys;
+  for (const TPair<FName, TArray<const TCHAR *>> &Pair : Owners) {
+    Keys.Add(Pair.Key);
+  }
+  for (const TPair<FName, FAutomationHandler> &Pair : AutomationHandlers) {
+    Keys.Add(Pair.Key);
+  }
+  for (const TPair<FName, FAutomationHandlerMethod> &Pair :
+       BuiltinAutomationHandlers) {
+    Keys.Add(Pair.Key);
+  }
+
+  // Registered-only names get an entry too (possibly empty) so dispatch
+  // never falls back to a pattern scan for them.
+  for (const FName &Key : Keys) {
+    const FString Normalized = Key.ToString().ToLower();
+    FAutomationRouteList &Candidates = AutomationRouteCandidates.Add(Key);
+    for (int32 Index = 0; Index < AutomationRoutes.Num(); ++Index) {
+      const FAutomationRoute &Route = AutomationRoutes[Index];
+      if (Route.Actions.Contains(Key) || Route.MatchesPattern(Normalized)) {
+        Candidates.Add(Index);
+      }
+    }
+  }
+
+  int32 SharedActions = 0;
+  for (const TPair<FName, TArray<const TCHAR *>> &Pair : Owners) {
+    if (Pair.Value.Num() > 1) {
+      ++SharedActions;
+      UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
+             TEXT("Action routing: '%s' is declared by %d routes (%s); "
+                  "they are tried in that order."),
+             *Pair.Key.ToString(), Pair.Value.Num(),
+             *FString::Join(Pair.Value, TEXT(", ")));
+    }
+  }
+
+  int32 FallbackOnlyRoutes = 0;
+  for (const FAutomationRoute &Route : AutomationRoutes) {
+    if (Route.Actions.Num() == 0 && Route.Prefixes.Num() == 0 &&
+        Route.Substrings.Num() == 0) {
+      UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
+             TEXT("Action routing: %s declares no actions and is "
+                  "unreachable."),
+             Route.Label);
+      continue;
+    }
+    if (Route.Prefixes.Num() > 0 || Route.Substrings.Num() > 0 ||
+        Route.Actions.Num() == 0) {
+      continue;
+    }
+    bool bAllRegistered = true;
+    for (const FName &Name : Route.Actions) {
+      if (!AutomationHandlers.Contains(Name) &&
+          !BuiltinAutomationHandlers.Contains(Name)) {
+        bAllRegistered = false;
+        break;
+      }
+    }
+    if (bAllRegistered) {
+      ++FallbackOnlyRoutes;
+      UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
+             TEXT("Action routing: every action of %s is also registered; "
+                  "it only runs when the registered handler declines."),
+             Route.Label);
+    }
+  }
+
+  UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
+         TEXT("Action routing: %d registered actions, %d fallback routes, "
+              "%d precomputed names, %d shared declarations, %d "
+              "fallback-only routes."),
+         BuiltinAutomationHandlers.Num() + AutomationHandlers.Num(),
+         AutomationRoutes.Num(),
+         AutomationRouteCandidates.Num(), SharedActions, FallbackOnlyRoutes);
+}
+
+/**
+ * @brief Flags a handler as safe to run on a task-graph worker.
+ *
+ * Only register handlers whose selected code paths avoid UObject access,
+ * editor state and modules that are game-thread bound. Responses are
+ * marshalled back to the game thread by SendAutomationResponse.
+ *
+ * @param Action Action name the handler is registered for.
+ * @param Handler Callable invoked on the worker.
+ * @param SubActionField Payload field that selects the sub-action, or empty
+ * when every request for Action is thread-safe.
+ * @param SubActions Sub-actions that may take the worker lane.
+ */
+void UMcpAutomationBridgeSubsystem::RegisterThreadSafeHandler(
+    const FString &Action, FAutomationHandler Handler,
+    const FString &SubActionField,
+    std::initializer_list<const TCHAR *> SubActions) {
+  if (!Handler) {
+    return;
+  }
+  FThreadSafeHandler &Entry = ThreadSafeHandlers.Add(FName(*Action));
+  Entry.Handler = MoveTemp(Handler);
+  Entry.SubActionField = SubActionField;
+  for (const TCHAR *SubAction : SubActions) {
+    Entry.SubActions.Add(SubAction);
+  }
+}
+
+/**
+ * @brief Declares the read-only requests that may run off the game thread.
+ */
+void UMcpAutomationBridgeSubsystem::InitializeThreadSafeHandlers() {
+  // Asset Registry queries; the registry is internally locked.
+  RegisterThreadSafeHandler(
+      TEXT("asset_query"),
+      [this](const FString &R, const FString &A,
+             const TSharedPtr<FJsonObject> &P,
+             TSharedPtr<FMcpBridgeWebSocket> S) {
+        return HandleAssetQueryAction(R, A, P, S);
+      },
+      TEXT("subAction"),
+      {TEXT("get_dependencies"), TEXT("find_by_tag"), TEXT("search_assets")});
+
+  // Static listings and engine metadata
+  RegisterThreadSafeHandler(
+      TEXT("manage_pipeline"),
+      [this](const FString &R, const FString &A,
+             const TSharedPtr<FJsonObject> &P,
+             TSharedPtr<FMcpBridgeWebSocket> S) {
+        return HandlePipelineAction(R, A, P, S);
+      },
+      TEXT("subAction"), {TEXT("list_categories")});
+  RegisterThreadSafeHandler(
+      TEXT("system_control"),
+      [this](const FString &R, const FString &A,
+             const TSharedPtr<FJsonObject> &P,
+             TSharedPtr<FMcpBridgeWebSocket> S) {
+        return HandleSystemControlAction(R, A, P, S);
+      },
+      TEXT("action"), {TEXT("get_engine_version")});
+
+  // Lock-free log ring; formatting a full page of lines stays off the frame
+  RegisterThreadSafeHandler(
+      TEXT("get_recent_logs"),
+      [this](const FString &R, const FString &A,
+             const TSharedPtr<FJsonObject> &P,
+             TSharedPtr<FMcpBridgeWebSocket> S) {
+        return HandleGetRecentLogs(R, A, P, S);
+      });
+
+  // Bridge overhead probe; "thread": "worker" measures the worker lane
+  RegisterThreadSafeHandler(
+      TEXT("bridge_echo"),
+      [this](const FString &R, const FString &A,
+             const TSharedPtr<FJsonObject> &P,
+             TSharedPtr<FMcpBridgeWebSocket> S) {
+        return HandleBridgeEcho(R, A, P, S);
+      },
+      TEXT("thread"), {TEXT("worker")});
+}
+
+/**
+ * @brief Runs a request on a task-graph worker when its handler is flagged
+ * thread-safe, bypassing the reentrancy queue and the frame budget.
+ *
+ * @param RequestId Identifier the handler responds to.
+ * @param Action Action name.
+ * @param Payload Action payload.
+ * @param RequestingSocket Socket the response is routed to.
+ * @return true if the request was handed to a worker.
+ */
+bool UMcpAutomationBridgeSubsystem::TryDispatchThreadSafe(
+    const FString &RequestId, const FString &Action,
+    const TSharedPtr<FJsonObject> &Payload,
+    TSharedPtr<FMcpBridgeWebSocket> RequestingSocket) {
+  if (!bRunThreadSafeActionsOffGameThread || ThreadSafeHandlers.Num() == 0) {
+    return false;
+  }
+  const FName ActionName(*Action, FNAME_Find);
+  const FThreadSafeHandler *Entry =
+      ActionName.IsNone() ? nullptr : ThreadSafeHandlers.Find(ActionName);
+  if (!Entry) {
+    return false;
+  }
+  if (!Entry->SubActionField.IsEmpty() &&
+      !Entry->SubActions.Contains(
+          GetJsonStringField(Payload, *Entry->SubActionField))) {
+    return false;
+  }
+
+  UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
+         TEXT("Dispatching RequestId=%s action='%s' on a worker thread"),
+         *RequestId, *Action);
+  if (ConnectionManager.IsValid()) {
+    ConnectionManager->MarkRequestDispatched(RequestId);
+  }
+  ++ThreadSafeRequestsInFlight;
+  AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask,
+            [this, Handler = Entry->Handler, RequestId, Action, Payload,
+             RequestingSocket]() {
+              ON_SCOPE_EXIT { --ThreadSafeRequestsInFlight; };
+              TRACE_CPUPROFILER_EVENT_SCOPE_STR("McpBridge::Handler");
+              MCP_TRACE_LABEL_SCOPE(*Action);
+              try {
+                if (!Handler(RequestId, Action, Payload, RequestingSocket)) {
+                  SendAutomationError(
+                      RequestingSocket, RequestId,
+                      FString::Printf(TEXT("Unknown automation action: %s"),
+                                      *Action),
+                      TEXT("UNKNOWN_ACTION"));
+                }
+              } catch (const std::exception &E) {
+                SendAutomationError(RequestingSocket, RequestId,
+                                    FString::Printf(TEXT("Internal error: %s"),
+                                                    ANSI_TO_TCHAR(E.what())),
+                                    TEXT("INTERNAL_ERROR"));
+              } catch (...) {
+                SendAutomationError(RequestingSocket, RequestId,
+                                    TEXT("Internal error (unknown)."),
+                                    TEXT("INTERNAL_ERROR"));
+              }
+            });
+  return true;
+}
+
+/**
+ * @brief Runs Work on a task-graph worker, counted with the thread-safe lane
+ * so Deinitialize waits for it.
+ *
+ * @param Work Function to run; it answers its request itself.
+ */
+void UMcpAutomationBridgeSubsystem::LaunchBackgroundWork(
+    TUniqueFunction<void()> &&Work) {
+  ++ThreadSafeRequestsInFlight;
+  AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask,
+            [this, Work = MoveTemp(Work)]() mutable {
+              ON_SCOPE_EXIT { --ThreadSafeRequestsInFlight; };
+              TRACE_CPUPROFILER_EVENT_SCOPE_STR("McpBridge::BackgroundWork");
+              Work();
+            });
+}
+
 // ProcessPendingAutomationRequests() intentionally implemented in the
 // primary subsystem translation unit (McpAutomationBridgeSubsystem.cpp)
 // to ensure the linker emits the symbol into the module's object file.
@@ -2,58 +2,156 @@
 #include "Dom/JsonObject.h"
 #include "McpAutomationBridgeHelpers.h" // Enhanced with struct array support
 #include "McpAutomationBridgeSubsystem.h"
+#include "McpJsonUtf8Writer.h"
+#include "McpPropertyAccessPlan.h"
 
 #if WITH_EDITOR
 #include "Engine/Blueprint.h"
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "Kismet2/KismetEditorUtilities.h"
+#include "ScopedTransaction.h"
 #endif
 
-bool UMcpAutomationBridgeSubsystem::HandleSetObjectProperty(
-    const FString &RequestId, const FString &Action,
-    const TSharedPtr<FJsonObject> &Payload,
-    TSharedPtr<FMcpBridgeWebSocket> RequestingSocket) {
-  const FString LowerAction = Action.ToLower();
-  if (!Action.Equals(TEXT("set_object_property"), ESearchCase::IgnoreCase) &&
-      !LowerAction.Contains(TEXT("set_object_property")))
-    return false;
+namespace {
+// bPackArrays: numeric arrays come back in FMcpPackedArray's base64 form
+// when their element type allows it.
+TSharedPtr<FJsonValue> ExportPlannedProperty(const FMcpPropertyAccessPlan &Plan,
+                                             void *TargetContainer,
+                                             bool bPackArrays = false) {
+  if (bPackArrays) {
+    if (const FArrayProperty *ArrayProp =
+            CastField<FArrayProperty>(Plan.Property)) {
+      if (TSharedPtr<FJsonValue> Packed = FMcpPackedArray::Export(
+              ArrayProp, ArrayProp->ContainerPtrToValuePtr<void>(
+                             TargetContainer))) {
+        return Packed;
+      }
+    }
+  }
+  if (Plan.Export) {
+    return Plan.Export(Plan.Property,
+                       Plan.Property->ContainerPtrToValuePtr<void>(
+                           TargetContainer));
+  }
+  return ExportPropertyToJsonValue(TargetContainer, Plan.Property);
+}
 
-  if (!Payload.IsValid()) {
-    SendAutomationError(RequestingSocket, RequestId,
-                        TEXT("set_object_property payload missing."),
-                        TEXT("INVALID_PAYLOAD"));
-    return true;
+// Bulk responses report at most this many per-cell errors; the count is
+// always exact.
+constexpr int32 MaxBulkPropertyErrors = 200;
+
+// Accepts a string array or a single string.
+void ReadBulkPropertyStrings(const TSharedPtr<FJsonObject> &Payload,
+                             const TCHAR *Field, TArray<FString> &Out) {
+  const TSharedPtr<FJsonValue> Value = Payload->TryGetField(Field);
+  if (!Value.IsValid()) {
+    return;
+  }
+  FString Single;
+  if (Value->TryGetString(Single)) {
+    if (!Single.TrimStartAndEnd().IsEmpty()) {
+      Out.Add(Single);
+    }
+    return;
+  }
+  const TArray<TSharedPtr<FJsonValue>> *Items = nullptr;
+  if (Value->TryGetArray(Items) && Items) {
+    for (const TSharedPtr<FJsonValue> &Item : *Items) {
+      FString Entry;
+      if (Item.IsValid() && Item->TryGetString(Entry) &&
+          !Entry.TrimStartAndEnd().IsEmpty()) {
+        Out.Add(Entry);
+      }
+    }
   }
+}
 
-  FString ObjectPath;
-  if (!Payload->TryGetStringField(TEXT("objectPath"), ObjectPath) ||
-      ObjectPath.TrimStartAndEnd().IsEmpty()) {
-    SendAutomationError(
-        RequestingSocket, RequestId,
-        TEXT("set_object_property requires a non-empty objectPath."),
-        TEXT("INVALID_OBJECT"));
-    return true;
+void WriteBulkJsonValue(FMcpJsonUtf8Writer &Writer,
+                        const TSharedPtr<FJsonValue> &Value) {
+  if (!Value.IsValid()) {
+    Writer.Null();
+    return;
+  }
+  switch (Value->Type) {
+  case EJson::String:
+    Writer.String(Value->AsString());
+    break;
+  case EJson::Number:
+    Writer.Number(Value->AsNumber());
+    break;
+  case EJson::Boolean:
+    Writer.Bool(Value->AsBool());
+    break;
+  case EJson::Array:
+    Writer.BeginArray();
+    for (const TSharedPtr<FJsonValue> &Item : Value->AsArray()) {
+      WriteBulkJsonValue(Writer, Item);
+    }
+    Writer.EndArray();
+    break;
+  case EJson::Object:
+    Writer.BeginObject();
+    if (const TSharedPtr<FJsonObject> Object = Value->AsObject()) {
+      for (const TPair<FString, TSharedPtr<FJsonValue>> &Field :
+           Object->Values) {
+        Writer.Key(Field.Key);
+        WriteBulkJsonValue(Writer, Field.Value);
+      }
+    }
+    Writer.EndObject();
+    break;
+  default:
+    Writer.Null();
+    break;
   }
+}
 
-  FString PropertyName;
-  if (!Payload->TryGetStringField(TEXT("propertyName"), PropertyName) ||
-      PropertyName.TrimStartAndEnd().IsEmpty()) {
-    SendAutomationError(
-        RequestingSocket, RequestId,
-        TEXT("set_object_property requires a non-empty propertyName."),
-        TEXT("INVALID_PROPERTY"));
-    return true;
+struct FBulkPropertyError {
+  int32 ObjectIndex = INDEX_NONE;
+  int32 PropertyIndex = INDEX_NONE;
+  FString Code;
+  FString Message;
+};
+
+void WriteBulkPropertyErrors(FMcpJsonUtf8Writer &Writer,
+                             const TArray<FBulkPropertyError> &Errors,
+                             int32 ErrorCount) {
+  Writer.Key(TEXT("errors"));
+  Writer.BeginArray();
+  for (const FBulkPropertyError &Error : Errors) {
+    Writer.BeginObject();
+    Writer.WriteInt(TEXT("object"), Error.ObjectIndex);
+    if (Error.PropertyIndex != INDEX_NONE) {
+      Writer.WriteInt(TEXT("property"), Error.PropertyIndex);
+    }
+    Writer.WriteString(TEXT("code"), Error.Code);
+    Writer.WriteString(TEXT("message"), Error.Message);
+    Writer.EndObject();
   }
+  Writer.EndArray();
+  Writer.WriteInt(TEXT("errorCount"), ErrorCount);
+  Writer.WriteBool(TEXT("errorsTruncated"), ErrorCount > Errors.Num());
+}
+} // namespace
 
-  const TSharedPtr<FJsonValue> ValueField = Payload->TryGetField(TEXT("value"));
-  if (!ValueField.IsValid()) {
-    SendAutomationError(
-        RequestingSocket, RequestId,
-        TEXT("set_object_property payload missing value field."),
-        TEXT("INVALID_VALUE"));
-    return true;
+FMcpPropertyAccessCache &
+UMcpAutomationBridgeSubsystem::GetPropertyAccessCache() {
+  if (!PropertyAccessCache.IsValid()) {
+    PropertyAccessCache = MakeShared<FMcpPropertyAccessCache>();
   }
+  return *PropertyAccessCache;
+}
 
+/**
+ * Resolve the object a property request targets: "Actor.Component" paths,
+ * actor labels/names, then /Game/ asset paths (loading the package).
+ *
+ * @param ObjectPath Path from the request; normalized to the resolved
+ * object's path name when an actor or component matched.
+ * @returns The object, or nullptr if nothing matched.
+ */
+UObject *
+UMcpAutomationBridgeSubsystem::ResolvePropertyRootObject(FString &ObjectPath) {
   UObject *RootObject = nullptr;
 #if WITH_EDITOR
   // CRITICAL FIX: Handle component paths in "ActorName.ComponentName" format
@@ -65,16 +163,12 @@ bool UMcpAutomationBridgeSubsystem::HandleSetObjectProperty(
     
     if (!ActorName.IsEmpty() && !ComponentName.IsEmpty())
     {
-      // Try to find the actor first
-      if (AActor *Actor = FindActorByName(ActorName))
+      // Find the actor, then the component on it using fuzzy name matching
+      if (UActorComponent *Comp = FindActorComponent(ActorName, ComponentName))
       {
-        // Find the component on the actor using fuzzy name matching
-        if (UActorComponent *Comp = FindComponentByName(Actor, ComponentName))
-        {
-          RootObject = Comp;
-          // Normalize the path for downstream error messages
-          ObjectPath = Comp->GetPathName();
-        }
+        RootObject = Comp;
+        // Normalize the path for downstream error messages
+        ObjectPath = Comp->GetPathName();
       }
     }
   }
@@ -102,6 +196,55 @@ bool UMcpAutomationBridgeSubsystem::HandleSetObjectProperty(
 #else
   RootObject = FindObject<UObject>(nullptr, *ObjectPath);
 #endif
+  return RootObject;
+}
+
+bool UMcpAutomationBridgeSubsystem::HandleSetObjectProperty(
+    const FString &RequestId, const FString &Action,
+    const TSharedPtr<FJsonObject> &Payload,
+    TSharedPtr<FMcpBridgeWebSocket> RequestingSocket) {
+  const FString LowerAction = Action.ToLower();
+  if (!Action.Equals(TEXT("set_object_property"), ESearchCase::IgnoreCase) &&
+      !LowerAction.Contains(TEXT("set_object_property")))
+    return false;
+
+  if (!Payload.IsValid()) {
+    SendAutomationError(RequestingSocket, RequestId,
+                        TEXT("set_object_property payload missing."),
+                        TEXT("INVALID_PAYLOAD"));
+    return true;
+  }
+
+  FString ObjectPath;
+  if (!Payload->TryGetStringField(TEXT("objectPath"), ObjectPath) ||
+      ObjectPath.TrimStartAndEnd().IsEmpty()) {
+    SendAutomationError(
+        RequestingSocket, RequestId,
+        TEXT("set_object_property requires a non-empty objectPath."),
+        TEXT("INVALID_OBJECT"));
+    return true;
+  }
+
+  FString PropertyName;
+  if (!Payload->TryGetStringField(TEXT("propertyName"), PropertyName) ||
+      PropertyName.TrimStartAndEnd().IsEmpty()) {
+    SendAutomationError(
+        RequestingSocket, RequestId,
+        TEXT("set_object_property requires a non-empty propertyName."),
+        TEXT("INVALID_PROPERTY"));
+    return true;
+  }
+
+  const TSharedPtr<FJsonValue> ValueField = Payload->TryGetField(TEXT("value"));
+  if (!ValueField.IsValid()) {
+    SendAutomationError(
+        RequestingSocket, RequestId,
+        TEXT("set_object_property payload missing value field."),
+        TEXT("INVALID_VALUE"));
+    return true;
+  }
+
+  UObject *RootObject = ResolvePropertyRootObject(ObjectPath);
   if (!RootObject) {
     SendAutomationError(
         RequestingSocket, RequestId,
@@ -260,44 +403,40 @@ bool UMcpAutomationBridgeSubsystem::HandleSetObjectProperty(
     }
   }
 
-  // Support nested property paths (e.g., "MyComponent.PropertyName")
+  // Support nested property paths (e.g., "MyComponent.PropertyName"). The
+  // lookup is compiled once per (class, path) and reused.
   void *TargetContainer = nullptr;
-  FProperty *Property = nullptr;
-
-  if (PropertyName.Contains(TEXT("."))) {
-    FString ResolveError;
-    Property = ResolveNestedPropertyPath(RootObject, PropertyName,
-                                         TargetContainer, ResolveError);
-    if (!Property || !TargetContainer) {
-      SendAutomationError(
-          RequestingSocket, RequestId,
-          FString::Printf(
-              TEXT("Failed to resolve nested property path '%s': %s"),
-              *PropertyName, *ResolveError),
-          TEXT("PROPERTY_NOT_FOUND"));
-      return true;
-    }
-  } else {
-    // Simple property name - look it up directly
-    TargetContainer = RootObject;
-    Property = RootObject->GetClass()->FindPropertyByName(*PropertyName);
-    if (!Property) {
-      SendAutomationError(
-          RequestingSocket, RequestId,
-          FString::Printf(TEXT("Property %s not found on object %s."),
-                          *PropertyName, *ObjectPath),
-          TEXT("PROPERTY_NOT_FOUND"));
-      return true;
-    }
+  FString ResolveError;
+  const TSharedPtr<const FMcpPropertyAccessPlan> Plan =
+      GetPropertyAccessCache().Resolve(
+          RootObject, PropertyName, TargetContainer, ResolveError);
+  if (!Plan.IsValid()) {
+    SendAutomationError(
+        RequestingSocket, RequestId,
+        PropertyName.Contains(TEXT("."))
+            ? FString::Printf(
+                  TEXT("Failed to resolve nested property path '%s': %s"),
+                  *PropertyName, *ResolveError)
+            : FString::Printf(TEXT("Property %s not found on object %s."),
+                              *PropertyName, *ObjectPath),
+        TEXT("PROPERTY_NOT_FOUND"));
+    return true;
   }
+  FProperty *Property = Plan->Property;
 
   FString ConversionError;
 #if WITH_EDITOR
   RootObject->Modify();
 #endif
 
-  if (!ApplyJsonValueToProperty(TargetContainer, Property, ValueField,
-                                ConversionError)) {
+  const bool bApplied =
+      Plan->Apply
+          ? Plan->Apply(Property,
+                        Property->ContainerPtrToValuePtr<void>(TargetContainer),
+                        *ValueField, ConversionError)
+          : ApplyJsonValueToProperty(TargetContainer, Property, ValueField,
+                                     ConversionError);
+  if (!bApplied) {
     SendAutomationError(RequestingSocket, RequestId, ConversionError,
                         TEXT("PROPERTY_CONVERSION_FAILED"));
     return true;
@@ -317,7 +456,7 @@ bool UMcpAutomationBridgeSubsystem::HandleSetObjectProperty(
     OwningBlueprint->Modify();
     FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(OwningBlueprint);
     FKismetEditorUtilities::CompileBlueprint(OwningBlueprint);
-    SaveLoadedAssetThrottled(OwningBlueprint);
+    QueueAssetSave(OwningBlueprint);
   } else {
     RootObject->PostEditChange();
   }
@@ -335,7 +474,8 @@ bool UMcpAutomationBridgeSubsystem::HandleSetObjectProperty(
   }
 
   if (TSharedPtr<FJsonValue> CurrentValue =
-          ExportPropertyToJsonValue(TargetContainer, Property)) {
+          ExportPlannedProperty(*Plan, TargetContainer,
+                                FMcpPackedArray::IsPackedValue(ValueField))) {
     ResultPayload->SetField(TEXT("value"), CurrentValue);
   }
 
@@ -381,54 +521,7 @@ bool UMcpAutomationBridgeSubsystem::HandleGetObjectProperty(
     return true;
   }
 
-  UObject *RootObject = nullptr;
-#if WITH_EDITOR
-  // CRITICAL FIX: Handle component paths in "ActorName.ComponentName" format
-  // This resolves paths like "TestActor.StaticMeshComponent0" to the actual component object
-  if (ObjectPath.Contains(TEXT(".")) && !ObjectPath.StartsWith(TEXT("/")))
-  {
-    FString ActorName = ObjectPath.Left(ObjectPath.Find(TEXT(".")));
-    FString ComponentName = ObjectPath.Right(ObjectPath.Len() - ActorName.Len() - 1);
-    
-    if (!ActorName.IsEmpty() && !ComponentName.IsEmpty())
-    {
-      // Try to find the actor first
-      if (AActor *Actor = FindActorByName(ActorName))
-      {
-        // Find the component on the actor using fuzzy name matching
-        if (UActorComponent *Comp = FindComponentByName(Actor, ComponentName))
-        {
-          RootObject = Comp;
-          // Normalize the path for downstream error messages
-          ObjectPath = Comp->GetPathName();
-        }
-      }
-    }
-  }
-  
-  if (!RootObject) {
-    if (AActor *FoundActor = FindActorByName(ObjectPath)) {
-      RootObject = FoundActor;
-      // Normalize for downstream error messages / responses
-      ObjectPath = FoundActor->GetPathName();
-    }
-  }
-  if (!RootObject && ObjectPath.StartsWith(TEXT("/Game/"))) {
-    FString PackagePath = ObjectPath;
-    if (PackagePath.Contains(TEXT("."))) {
-      PackagePath = PackagePath.Left(PackagePath.Find(TEXT(".")));
-    }
-    UPackage* LoadedPackage = LoadPackage(nullptr, *PackagePath, LOAD_None);
-    if (LoadedPackage) {
-      RootObject = FindObject<UObject>(LoadedPackage, *ObjectPath);
-      if (!RootObject) {
-        RootObject = LoadedPackage;
-      }
-    }
-  }
-#else
-  RootObject = FindObject<UObject>(nullptr, *ObjectPath);
-#endif
+  UObject *RootObject = ResolvePropertyRootObject(ObjectPath);
   if (!RootObject) {
     SendAutomationError(
         RequestingSocket, RequestId,
@@ -498,39 +591,30 @@ bool UMcpAutomationBridgeSubsystem::HandleGetObjectProperty(
     }
   }
 
-  // Support nested property paths (e.g., "MyComponent.PropertyName")
+  // Support nested property paths (e.g., "MyComponent.PropertyName"). The
+  // lookup is compiled once per (class, path) and reused.
   void *TargetContainer = nullptr;
-  FProperty *Property = nullptr;
-
-  if (PropertyName.Contains(TEXT("."))) {
-    FString ResolveError;
-    Property = ResolveNestedPropertyPath(RootObject, PropertyName,
-                                         TargetContainer, ResolveError);
-    if (!Property || !TargetContainer) {
-      SendAutomationError(
-          RequestingSocket, RequestId,
-          FString::Printf(
-              TEXT("Failed to resolve nested property path '%s': %s"),
-              *PropertyName, *ResolveError),
-          TEXT("PROPERTY_NOT_FOUND"));
-      return true;
-    }
-  } else {
-    // Simple property name - look it up directly
-    TargetContainer = RootObject;
-    Property = RootObject->GetClass()->FindPropertyByName(*PropertyName);
-    if (!Property) {
-      SendAutomationError(
-          RequestingSocket, RequestId,
-          FString::Printf(TEXT("Property %s not found on object %s."),
-                          *PropertyName, *ObjectPath),
-          TEXT("PROPERTY_NOT_FOUND"));
-      return true;
-    }
+  FString ResolveError;
+  const TSharedPtr<const FMcpPropertyAccessPlan> Plan =
+      GetPropertyAccessCache().Resolve(
+          RootObject, PropertyName, TargetContainer, ResolveError);
+  if (!Plan.IsValid()) {
+    SendAutomationError(
+        RequestingSocket, RequestId,
+        PropertyName.Contains(TEXT("."))
+            ? FString::Printf(
+                  TEXT("Failed to resolve nested property path '%s': %s"),
+                  *PropertyName, *ResolveError)
+            : FString::Printf(TEXT("Property %s not found on object %s."),
+                              *PropertyName, *ObjectPath),
+        TEXT("PROPERTY_NOT_FOUND"));
+    return true;
   }
 
+  bool bPackArrays = false;
+  Payload->TryGetBoolField(TEXT("packedArrays"), bPackArrays);
   const TSharedPtr<FJsonValue> CurrentValue =
-      ExportPropertyToJsonValue(TargetContainer, Property);
+      ExportPlannedProperty(*Plan, TargetContainer, bPackArrays);
   if (!CurrentValue.IsValid()) {
     SendAutomationError(
         RequestingSocket, RequestId,
@@ -556,6 +640,361 @@ TSharedPtr<FJsonObject> ResultPayload = MakeShared<FJsonObject>();
   return true;
 }
 
+/**
+ * Reads several properties off several objects in one request.
+ *
+ * Payload: objectPaths (string[]) and propertyPaths (string[], alias
+ * "properties"), resolved the same way as get_object_property. The result is
+ * columnar: "values" maps each property path to an array holding one entry
+ * per object, null where the object or property could not be read. The
+ * failures are listed in "errors" by object and property index. With
+ * packedArrays, numeric arrays come back base64-packed (see FMcpPackedArray).
+ */
+bool UMcpAutomationBridgeSubsystem::HandleGetPropertiesBulk(
+    const FString &RequestId, const FString &Action,
+    const TSharedPtr<FJsonObject> &Payload,
+    TSharedPtr<FMcpBridgeWebSocket> RequestingSocket) {
+  if (!Action.Equals(TEXT("get_properties_bulk"), ESearchCase::IgnoreCase))
+    return false;
+
+  if (!Payload.IsValid()) {
+    SendAutomationError(RequestingSocket, RequestId,
+                        TEXT("get_properties_bulk payload missing."),
+                        TEXT("INVALID_PAYLOAD"));
+    return true;
+  }
+
+  TArray<FString> ObjectPaths;
+  ReadBulkPropertyStrings(Payload, TEXT("objectPaths"), ObjectPaths);
+  TArray<FString> PropertyPaths;
+  ReadBulkPropertyStrings(Payload, TEXT("propertyPaths"), PropertyPaths);
+  ReadBulkPropertyStrings(Payload, TEXT("properties"), PropertyPaths);
+  bool bPackArrays = false;
+  Payload->TryGetBoolField(TEXT("packedArrays"), bPackArrays);
+  if (ObjectPaths.Num() == 0 || PropertyPaths.Num() == 0) {
+    SendAutomationError(
+        RequestingSocket, RequestId,
+        TEXT("get_properties_bulk requires non-empty objectPaths and "
+             "propertyPaths."),
+        TEXT("INVALID_PAYLOAD"));
+    return true;
+  }
+
+  TArray<FBulkPropertyError> Errors;
+  int32 ErrorCount = 0;
+  auto AddError = [&Errors, &ErrorCount](int32 ObjectIndex,
+                                         int32 PropertyIndex,
+                                         const TCHAR *Code, FString Message) {
+    if (++ErrorCount <= MaxBulkPropertyErrors) {
+      Errors.Add({ObjectIndex, PropertyIndex, Code, MoveTemp(Message)});
+    }
+  };
+
+  TArray<UObject *> Objects;
+  Objects.Reserve(ObjectPaths.Num());
+  for (int32 ObjectIndex = 0; ObjectIndex < ObjectPaths.Num();
+       ++ObjectIndex) {
+    UObject *Object = ResolvePropertyRootObject(ObjectPaths[ObjectIndex]);
+    if (!Object) {
+      AddError(ObjectIndex, INDEX_NONE, TEXT("OBJECT_NOT_FOUND"),
+               FString::Printf(TEXT("Unable to find object at path %s."),
+                               *ObjectPaths[ObjectIndex]));
+    }
+    Objects.Add(Object);
+  }
+
+  // Streamed: 20 properties over 500 actors is 10k cells.
+  FMcpJsonUtf8Writer Result;
+  Result.BeginObject();
+  Result.Key(TEXT("objects"));
+  Result.BeginArray();
+  for (int32 ObjectIndex = 0; ObjectIndex < Objects.Num(); ++ObjectIndex) {
+    if (Objects[ObjectIndex]) {
+      Result.String(ObjectPaths[ObjectIndex]);
+    } else {
+      Result.Null();
+    }
+  }
+  Result.EndArray();
+
+  FMcpPropertyAccessCache &Cache = GetPropertyAccessCache();
+  int32 ReadCount = 0;
+  Result.Key(TEXT("values"));
+  Result.BeginObject();
+  for (int32 PropertyIndex = 0; PropertyIndex < PropertyPaths.Num();
+       ++PropertyIndex) {
+    const FString &PropertyPath = PropertyPaths[PropertyIndex];
+    Result.Key(PropertyPath);
+    Result.BeginArray();
+    for (int32 ObjectIndex = 0; ObjectIndex < Objects.Num(); ++ObjectIndex) {
+      UObject *Object = Objects[ObjectIndex];
+      if (!Object) {
+        Result.Null();
+        continue;
+      }
+      void *TargetContainer = nullptr;
+      FString ResolveError;
+      const TSharedPtr<const FMcpPropertyAccessPlan> Plan =
+          Cache.Resolve(Object, PropertyPath, TargetContainer, ResolveError);
+      if (!Plan.IsValid()) {
+        AddError(ObjectIndex, PropertyIndex, TEXT("PROPERTY_NOT_FOUND"),
+                 MoveTemp(ResolveError));
+        Result.Null();
+        continue;
+      }
+      const TSharedPtr<FJsonValue> Value =
+          ExportPlannedProperty(*Plan, TargetContainer, bPackArrays);
+      if (!Value.IsValid()) {
+        AddError(ObjectIndex, PropertyIndex, TEXT("PROPERTY_EXPORT_FAILED"),
+                 FString::Printf(TEXT("Unable to export property %s."),
+                                 *PropertyPath));
+        Result.Null();
+        continue;
+      }
+      WriteBulkJsonValue(Result, Value);
+      ++ReadCount;
+    }
+    Result.EndArray();
+  }
+  Result.EndObject();
+
+  Result.WriteInt(TEXT("objectCount"), Objects.Num());
+  Result.WriteInt(TEXT("propertyCount"), PropertyPaths.Num());
+  Result.WriteInt(TEXT("readCount"), ReadCount);
+  WriteBulkPropertyErrors(Result, Errors, ErrorCount);
+  Result.EndObject();
+
+  SendAutomationResponse(
+      RequestingSocket, RequestId, true,
+      FString::Printf(TEXT("Read %d of %d property values."), ReadCount,
+                      Objects.Num() * PropertyPaths.Num()),
+      MoveTemp(Result));
+  return true;
+}
+
+/**
+ * Writes several properties on several objects in one request.
+ *
+ * Payload: objectPaths (string[]) plus either or both of
+ *   values   {propertyPath: value}, the same value written to every object
+ *   columns  {propertyPath: [value per object]}, columnar like
+ *            get_properties_bulk; a null entry leaves that object alone
+ * and optional markDirty (default true). All writes share one editor
+ * transaction, and each object gets a single PostEditChange after all of its
+ * properties are set (Blueprint CDOs: one compile per Blueprint instead).
+ */
+bool UMcpAutomationBridgeSubsystem::HandleSetPropertiesBulk(
+    const FString &RequestId, const FString &Action,
+    const TSharedPtr<FJsonObject> &Payload,
+    TSharedPtr<FMcpBridgeWebSocket> RequestingSocket) {
+  if (!Action.Equals(TEXT("set_properties_bulk"), ESearchCase::IgnoreCase))
+    return false;
+
+  if (!Payload.IsValid()) {
+    SendAutomationError(RequestingSocket, RequestId,
+                        TEXT("set_properties_bulk payload missing."),
+                        TEXT("INVALID_PAYLOAD"));
+    return true;
+  }
+
+  TArray<FString> ObjectPaths;
+  ReadBulkPropertyStrings(Payload, TEXT("objectPaths"), ObjectPaths);
+  if (ObjectPaths.Num() == 0) {
+    SendAutomationError(
+        RequestingSocket, RequestId,
+        TEXT("set_properties_bulk requires non-empty objectPaths."),
+        TEXT("INVALID_PAYLOAD"));
+    return true;
+  }
+
+  // One column per property: either a single broadcast value or one value
+  // per object.
+  struct FBulkColumn {
+    FString PropertyPath;
+    TSharedPtr<FJsonValue> Broadcast;
+    const TArray<TSharedPtr<FJsonValue>> *PerObject = nullptr;
+  };
+  TArray<FBulkColumn> Columns;
+  const TSharedPtr<FJsonObject> *ValuesObject = nullptr;
+  if (Payload->TryGetObjectField(TEXT("values"), ValuesObject) &&
+      ValuesObject && ValuesObject->IsValid()) {
+    for (const TPair<FString, TSharedPtr<FJsonValue>> &Field :
+         (*ValuesObject)->Values) {
+      if (Field.Value.IsValid()) {
+        Columns.Add({Field.Key, Field.Value, nullptr});
+      }
+    }
+  }
+  const TSharedPtr<FJsonObject> *ColumnsObject = nullptr;
+  if (Payload->TryGetObjectField(TEXT("columns"), ColumnsObject) &&
+      ColumnsObject && ColumnsObject->IsValid()) {
+    for (const TPair<FString, TSharedPtr<FJsonValue>> &Field :
+         (*ColumnsObject)->Values) {
+      const TArray<TSharedPtr<FJsonValue>> *Cells = nullptr;
+      if (!Field.Value.IsValid() || !Field.Value->TryGetArray(Cells) ||
+          !Cells || Cells->Num() != ObjectPaths.Num()) {
+        SendAutomationError(
+            RequestingSocket, RequestId,
+            FString::Printf(TEXT("columns.%s must be an array with one value "
+                                 "per object (%d)."),
+                            *Field.Key, ObjectPaths.Num()),
+            TEXT("INVALID_PAYLOAD"));
+        return true;
+      }
+      Columns.Add({Field.Key, nullptr, Cells});
+    }
+  }
+  if (Columns.Num() == 0) {
+    SendAutomationError(
+        RequestingSocket, RequestId,
+        TEXT("set_properties_bulk requires values or columns."),
+        TEXT("INVALID_PAYLOAD"));
+    return true;
+  }
+
+  bool bMarkDirty = true;
+  Payload->TryGetBoolField(TEXT("markDirty"), bMarkDirty);
+
+  TArray<FBulkPropertyError> Errors;
+  int32 ErrorCount = 0;
+  auto AddError = [&Errors, &ErrorCount](int32 ObjectIndex,
+                                         int32 PropertyIndex,
+                                         const TCHAR *Code, FString Message) {
+    if (++ErrorCount <= MaxBulkPropertyErrors) {
+      Errors.Add({ObjectIndex, PropertyIndex, Code, MoveTemp(Message)});
+    }
+  };
+
+  FMcpPropertyAccessCache &Cache = GetPropertyAccessCache();
+  int32 AppliedCount = 0;
+  int32 ObjectsChanged = 0;
+  TBitArray<> ObjectFound(false, ObjectPaths.Num());
+  {
+#if WITH_EDITOR
+    const FScopedTransaction Transaction(
+        FText::FromString(TEXT("MCP Set Properties")));
+    TSet<UBlueprint *> BlueprintsToCompile;
+#endif
+    for (int32 ObjectIndex = 0; ObjectIndex < ObjectPaths.Num();
+         ++ObjectIndex) {
+      UObject *Object = ResolvePropertyRootObject(ObjectPaths[ObjectIndex]);
+      if (!Object) {
+        AddError(ObjectIndex, INDEX_NONE, TEXT("OBJECT_NOT_FOUND"),
+                 FString::Printf(TEXT("Unable to find object at path %s."),
+                                 *ObjectPaths[ObjectIndex]));
+        continue;
+      }
+      ObjectFound[ObjectIndex] = true;
+
+      bool bChanged = false;
+      for (int32 PropertyIndex = 0; PropertyIndex < Columns.Num();
+           ++PropertyIndex) {
+        const FBulkColumn &Column = Columns[PropertyIndex];
+        const TSharedPtr<FJsonValue> &Value =
+            Column.PerObject ? (*Column.PerObject)[ObjectIndex]
+                             : Column.Broadcast;
+        if (!Value.IsValid() || Value->IsNull()) {
+          continue;
+        }
+
+        void *TargetContainer = nullptr;
+        FString Error;
+        const TSharedPtr<const FMcpPropertyAccessPlan> Plan = Cache.Resolve(
+            Object, Column.PropertyPath, TargetContainer, Error);
+        if (!Plan.IsValid()) {
+          AddError(ObjectIndex, PropertyIndex, TEXT("PROPERTY_NOT_FOUND"),
+                   MoveTemp(Error));
+          continue;
+        }
+
+#if WITH_EDITOR
+        if (!bChanged) {
+          Object->Modify();
+        }
+#endif
+        FProperty *Property = Plan->Property;
+        const bool bApplied =
+            Plan->Apply
+                ? Plan->Apply(
+                      Property,
+                      Property->ContainerPtrToValuePtr<void>(TargetContainer),
+                      *Value, Error)
+                : ApplyJsonValueToProperty(TargetContainer, Property, Value,
+                                           Error);
+        if (!bApplied) {
+          AddError(ObjectIndex, PropertyIndex,
+                   TEXT("PROPERTY_CONVERSION_FAILED"), MoveTemp(Error));
+          continue;
+        }
+        bChanged = true;
+        ++AppliedCount;
+      }
+
+      if (!bChanged) {
+        continue;
+      }
+      ++ObjectsChanged;
+      if (bMarkDirty) {
+        Object->MarkPackageDirty();
+      }
+#if WITH_EDITOR
+      UBlueprint *OwningBlueprint =
+          Object->GetClass()
+              ? Cast<UBlueprint>(Object->GetClass()->ClassGeneratedBy)
+              : nullptr;
+      if (OwningBlueprint) {
+        BlueprintsToCompile.Add(OwningBlueprint);
+      } else {
+        Object->PostEditChange();
+      }
+#endif
+    }
+
+#if WITH_EDITOR
+    // Compiling drops the property access cache, so it runs once per
+    // Blueprint after every write has landed.
+    for (UBlueprint *Blueprint : BlueprintsToCompile) {
+      Blueprint->Modify();
+      FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+      FKismetEditorUtilities::CompileBlueprint(Blueprint);
+      QueueAssetSave(Blueprint);
+    }
+#endif
+  }
+
+  FMcpJsonUtf8Writer Result;
+  Result.BeginObject();
+  Result.Key(TEXT("objects"));
+  Result.BeginArray();
+  for (int32 ObjectIndex = 0; ObjectIndex < ObjectPaths.Num(); ++ObjectIndex) {
+    if (ObjectFound[ObjectIndex]) {
+      Result.String(ObjectPaths[ObjectIndex]);
+    } else {
+      Result.Null();
+    }
+  }
+  Result.EndArray();
+  Result.Key(TEXT("properties"));
+  Result.BeginArray();
+  for (const FBulkColumn &Column : Columns) {
+    Result.String(Column.PropertyPath);
+  }
+  Result.EndArray();
+  Result.WriteInt(TEXT("appliedCount"), AppliedCount);
+  Result.WriteInt(TEXT("objectsChanged"), ObjectsChanged);
+  WriteBulkPropertyErrors(Result, Errors, ErrorCount);
+  Result.EndObject();
+
+  const bool bSuccess = AppliedCount > 0 || ErrorCount == 0;
+  SendAutomationResponse(
+      RequestingSocket, RequestId, bSuccess,
+      FString::Printf(TEXT("Applied %d property values across %d objects."),
+                      AppliedCount, ObjectsChanged),
+      MoveTemp(Result),
+      bSuccess ? FString() : FString(TEXT("PROPERTY_SET_FAILED")));
+  return true;
+}
+
 bool UMcpAutomationBridgeSubsystem::HandleArrayAppend(
     const FString &RequestId, const FString &Action,
     const TSharedPtr<FJsonObject> &Payload,
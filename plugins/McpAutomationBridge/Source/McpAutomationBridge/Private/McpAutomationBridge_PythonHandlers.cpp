@@ -12,10 +12,13 @@
 #include "McpAutomationBridgeGlobals.h"
 #include "McpAutomationBridgeHelpers.h"
 #include "McpAutomationBridgeSubsystem.h"
+#include "McpPythonContexts.h"
 
 #if WITH_EDITOR
 
 // Python scripting plugin interface
+#include "Containers/Ticker.h"
+#include "HAL/PlatformTime.h"
 #include "Misc/Paths.h"
 #include "Misc/FileHelper.h"
 #include "HAL/PlatformFilemanager.h"
@@ -257,11 +260,242 @@ static bool ExecutePythonScript(const FString& ScriptPath, FString& OutOutput, F
 #endif
 }
 
+/**
+ * Resolve a script path the way execute_script does: as given, else relative
+ * to the project directory. Returns an empty string when no .py file exists.
+ */
+static FString ResolvePythonScriptPath(const FString& ScriptPath)
+{
+    FString ResolvedPath = ScriptPath;
+    if (!FPaths::FileExists(ResolvedPath))
+    {
+        ResolvedPath = FPaths::ProjectDir() / ScriptPath;
+    }
+    return FPaths::FileExists(ResolvedPath) && ResolvedPath.EndsWith(TEXT(".py")) ? ResolvedPath : FString();
+}
+
+/**
+ * Copy the members of a _mcp_bridge reply that belong in a response into Result
+ * and send it: success when the reply says ok, else its error and code.
+ */
+static void SendPythonBridgeReply(UMcpAutomationBridgeSubsystem* Subsystem,
+    TSharedPtr<FMcpBridgeWebSocket> Socket, const FString& RequestId,
+    const TSharedPtr<FJsonObject>& Reply, const TSharedPtr<FJsonObject>& Result,
+    const FString& SuccessMessage)
+{
+    static const TPair<const TCHAR*, const TCHAR*> Members[] = {
+        {TEXT("result"), TEXT("result")},
+        {TEXT("output"), TEXT("output")},
+        {TEXT("ms"), TEXT("durationMs")},
+        {TEXT("traceback"), TEXT("traceback")},
+    };
+    for (const TPair<const TCHAR*, const TCHAR*>& Member : Members)
+    {
+        const TSharedPtr<FJsonValue> Value = Reply->TryGetField(Member.Key);
+        if (Value.IsValid() && !Result->HasField(Member.Value))
+        {
+            Result->SetField(Member.Value, Value);
+        }
+    }
+
+    bool bOk = false;
+    Reply->TryGetBoolField(TEXT("ok"), bOk);
+    if (bOk)
+    {
+        Subsystem->SendAutomationResponse(Socket, RequestId, true, SuccessMessage, Result);
+        return;
+    }
+    FString Error;
+    FString ErrorCode;
+    Reply->TryGetStringField(TEXT("error"), Error);
+    if (!Reply->TryGetStringField(TEXT("code"), ErrorCode))
+    {
+        ErrorCode = TEXT("PYTHON_EXECUTION_FAILED");
+    }
+    Result->SetStringField(TEXT("error"), Error);
+    Subsystem->SendAutomationResponse(Socket, RequestId, false, Error, Result, ErrorCode);
+}
+
+/** Output kept from the steps of one cooperative run; later output is dropped. */
+static constexpr int32 MaxPythonRunOutputChars = 1024 * 1024;
+
+/**
+ * Step a cooperative Python run (a script whose result is a generator) once
+ * per core-ticker tick, BudgetMs at a time, reporting its progress until it
+ * finishes, fails, times out or the client cancels. The first step runs
+ * immediately.
+ */
+static void DrivePythonRun(UMcpAutomationBridgeSubsystem* Subsystem,
+    TSharedPtr<FMcpBridgeWebSocket> Socket, const FString& RequestId,
+    const FString& RunId, double BudgetMs, double TimeoutSeconds,
+    const TSharedPtr<FJsonObject>& Result, const FString& InitialOutput)
+{
+    struct FPythonRun
+    {
+        TWeakObjectPtr<UMcpAutomationBridgeSubsystem> WeakSubsystem;
+        TSharedPtr<FMcpBridgeWebSocket> Socket;
+        FString RequestId;
+        FString RunId;
+        double BudgetMs = 0.0;
+        double TimeoutSeconds = 0.0;
+        double StartSeconds = 0.0;
+        int32 Steps = 0;
+        FString Output;
+        bool bOutputTruncated = false;
+        TSharedPtr<FJsonObject> Result;
+    };
+    TSharedRef<FPythonRun> Run = MakeShared<FPythonRun>();
+    Run->WeakSubsystem = Subsystem;
+    Run->Socket = Socket;
+    Run->RequestId = RequestId;
+    Run->RunId = RunId;
+    Run->BudgetMs = BudgetMs;
+    Run->TimeoutSeconds = TimeoutSeconds;
+    Run->StartSeconds = FPlatformTime::Seconds();
+    Run->Output = InitialOutput;
+    Run->Result = Result;
+
+    auto Fail = [](const TSharedRef<FPythonRun>& R, UMcpAutomationBridgeSubsystem* S, const FString& Message, const FString& Code)
+    {
+        FMcpPythonContexts::Cancel(R->RunId);
+        if (S)
+        {
+            R->Result->SetNumberField(TEXT("steps"), R->Steps);
+            R->Result->SetStringField(TEXT("output"), R->Output);
+            S->SendAutomationResponse(R->Socket, R->RequestId, false, Message, R->Result, Code);
+        }
+    };
+
+    auto Tick = [Run, Fail]() -> bool
+    {
+        UMcpAutomationBridgeSubsystem* S = Run->WeakSubsystem.Get();
+        if (!S)
+        {
+            Fail(Run, nullptr, FString(), FString());
+            return false;
+        }
+        const double Elapsed = FPlatformTime::Seconds() - Run->StartSeconds;
+        if (Run->TimeoutSeconds > 0.0 && Elapsed > Run->TimeoutSeconds)
+        {
+            Fail(Run, S, FString::Printf(TEXT("Python run timed out after %.1fs"), Elapsed), TEXT("TIMEOUT"));
+            return false;
+        }
+
+        TSharedPtr<FJsonObject> Reply;
+        FString Error;
+        if (!FMcpPythonContexts::Step(Run->RunId, Run->BudgetMs, Reply, Error))
+        {
+            Fail(Run, S, Error, TEXT("PYTHON_BRIDGE_ERROR"));
+            return false;
+        }
+        ++Run->Steps;
+
+        FString StepOutput;
+        if (Reply->TryGetStringField(TEXT("output"), StepOutput) && !Run->bOutputTruncated)
+        {
+            if (Run->Output.Len() + StepOutput.Len() > MaxPythonRunOutputChars)
+            {
+                Run->bOutputTruncated = true;
+            }
+            else
+            {
+                Run->Output += StepOutput;
+            }
+        }
+
+        bool bDone = false;
+        Reply->TryGetBoolField(TEXT("done"), bDone);
+        if (bDone)
+        {
+            Run->Result->SetNumberField(TEXT("steps"), Run->Steps);
+            Run->Result->SetNumberField(TEXT("durationMs"), Elapsed * 1000.0);
+            Run->Result->SetStringField(TEXT("output"), Run->Output);
+            if (Run->bOutputTruncated)
+            {
+                Run->Result->SetBoolField(TEXT("outputTruncated"), true);
+            }
+            SendPythonBridgeReply(S, Run->Socket, Run->RequestId, Reply, Run->Result,
+                TEXT("Python script completed."));
+            return false;
+        }
+
+        double Progress = 0.0;
+        const float Percent = Reply->TryGetNumberField(TEXT("progress"), Progress)
+            ? static_cast<float>(FMath::Clamp(Progress, 0.0, 1.0) * 100.0)
+            : -1.0f;
+        FString Message;
+        Reply->TryGetStringField(TEXT("message"), Message);
+        if (!S->SendProgressUpdate(Run->RequestId, Percent, Message))
+        {
+            Fail(Run, S, TEXT("Python run cancelled by the client."), TEXT("CANCELLED"));
+            return false;
+        }
+        return true;
+    };
+
+    if (Tick())
+    {
+        FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+            [Tick](float) { return Tick(); }));
+    }
+}
+
+/**
+ * Run the script registered under Handle, or InlineCode, in a persistent
+ * context and reply, stepping it cooperatively when its result is a generator.
+ * Payload may carry context, args, budgetMs and timeoutSeconds.
+ */
+static void InvokePersistentPython(UMcpAutomationBridgeSubsystem* Subsystem,
+    TSharedPtr<FMcpBridgeWebSocket> Socket, const FString& RequestId,
+    const TSharedPtr<FJsonObject>& Payload, const FString& Handle, const FString& InlineCode)
+{
+    const FString Context = GetJsonStringField(Payload, TEXT("context"), TEXT("default"));
+    if (!FMcpPythonContexts::IsValidName(Context))
+    {
+        Subsystem->SendAutomationError(Socket, RequestId,
+            TEXT("context must be 1-128 letters, digits, '_', '-' or '.'."), TEXT("INVALID_ARGUMENT"));
+        return;
+    }
+    const TSharedPtr<FJsonObject>* Args = nullptr;
+    Payload->TryGetObjectField(TEXT("args"), Args);
+
+    TSharedPtr<FJsonObject> Reply;
+    FString Error;
+    if (!FMcpPythonContexts::Invoke(Handle, InlineCode, Context, Args ? *Args : TSharedPtr<FJsonObject>(), Reply, Error))
+    {
+        Subsystem->SendAutomationError(Socket, RequestId, Error, TEXT("PYTHON_BRIDGE_ERROR"));
+        return;
+    }
+
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetStringField(TEXT("context"), Context);
+    if (!Handle.IsEmpty())
+    {
+        Result->SetStringField(TEXT("handle"), Handle);
+    }
+
+    FString RunId;
+    if (Reply->TryGetStringField(TEXT("running"), RunId))
+    {
+        double BudgetMs = 8.0;
+        double TimeoutSeconds = 0.0;
+        Payload->TryGetNumberField(TEXT("budgetMs"), BudgetMs);
+        Payload->TryGetNumberField(TEXT("timeoutSeconds"), TimeoutSeconds);
+        Result->SetBoolField(TEXT("cooperative"), true);
+        DrivePythonRun(Subsystem, Socket, RequestId, RunId, FMath::Clamp(BudgetMs, 1.0, 1000.0),
+            TimeoutSeconds, Result, GetJsonStringField(Reply, TEXT("output")));
+        return;
+    }
+    SendPythonBridgeReply(Subsystem, Socket, RequestId, Reply, Result, TEXT("Python script executed successfully."));
+}
+
 #endif // WITH_EDITOR
 
 /**
  * Handle the execute_python automation action.
- * Supports actions: execute_script, execute_code, get_python_info
+ * Supports actions: execute_script, execute_code, get_python_info, and the
+ * persistent-context actions register_script, invoke_script,
+ * unregister_script, reset_context and list_contexts.
  */
 bool UMcpAutomationBridgeSubsystem::HandleExecutePythonAction(
     const FString& RequestId,
@@ -331,6 +565,13 @@ bool UMcpAutomationBridgeSubsystem::HandleExecutePythonAction(
             return true;
         }
 
+        // With a context the code runs in persistent globals, like invoke_script.
+        if (Payload->HasField(TEXT("context")))
+        {
+            InvokePersistentPython(this, RequestingSocket, RequestId, Payload, FString(), Code);
+            return true;
+        }
+
         FString Output, Error;
         bool bSuccess = ExecutePythonCommand(Code, Output, Error);
 
@@ -354,6 +595,91 @@ bool UMcpAutomationBridgeSubsystem::HandleExecutePythonAction(
             SendAutomationError(RequestingSocket, RequestId, Error, TEXT("PYTHON_EXECUTION_FAILED"));
         }
     }
+    else if (SubAction == TEXT("register_script"))
+    {
+        const FString Handle = GetJsonStringField(Payload, TEXT("handle"));
+        if (!FMcpPythonContexts::IsValidName(Handle))
+        {
+            SendAutomationError(RequestingSocket, RequestId,
+                TEXT("handle must be 1-128 letters, digits, '_', '-' or '.'."), TEXT("INVALID_ARGUMENT"));
+            return true;
+        }
+        FString Code = GetJsonStringField(Payload, TEXT("code"));
+        const FString ScriptPath = GetJsonStringField(Payload, TEXT("scriptPath"));
+        if (Code.IsEmpty() && !ScriptPath.IsEmpty())
+        {
+            const FString ResolvedPath = ResolvePythonScriptPath(ScriptPath);
+            if (ResolvedPath.IsEmpty() || !FFileHelper::LoadFileToString(Code, *ResolvedPath))
+            {
+                SendAutomationError(RequestingSocket, RequestId,
+                    FString::Printf(TEXT("Python script file not found: %s"), *ScriptPath), TEXT("FILE_NOT_FOUND"));
+                return true;
+            }
+        }
+        if (Code.IsEmpty())
+        {
+            SendAutomationError(RequestingSocket, RequestId, TEXT("code or scriptPath is required for register_script action."), TEXT("INVALID_ARGUMENT"));
+            return true;
+        }
+
+        TSharedPtr<FJsonObject> Reply;
+        FString Error;
+        if (!FMcpPythonContexts::RegisterScript(Handle, Code, Reply, Error))
+        {
+            SendAutomationError(RequestingSocket, RequestId, Error, TEXT("PYTHON_BRIDGE_ERROR"));
+            return true;
+        }
+        TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+        Result->SetStringField(TEXT("handle"), Handle);
+        Result->SetNumberField(TEXT("codeLength"), Code.Len());
+        SendPythonBridgeReply(this, RequestingSocket, RequestId, Reply, Result,
+            FString::Printf(TEXT("Python script registered as %s."), *Handle));
+    }
+    else if (SubAction == TEXT("invoke_script"))
+    {
+        const FString Handle = GetJsonStringField(Payload, TEXT("handle"));
+        if (!FMcpPythonContexts::IsValidName(Handle))
+        {
+            SendAutomationError(RequestingSocket, RequestId, TEXT("handle of a registered script is required for invoke_script action."), TEXT("INVALID_ARGUMENT"));
+            return true;
+        }
+        InvokePersistentPython(this, RequestingSocket, RequestId, Payload, Handle, FString());
+    }
+    else if (SubAction == TEXT("unregister_script"))
+    {
+        const FString Handle = GetJsonStringField(Payload, TEXT("handle"));
+        TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+        Result->SetStringField(TEXT("handle"), Handle);
+        Result->SetBoolField(TEXT("removed"), FMcpPythonContexts::IsValidName(Handle) && FMcpPythonContexts::UnregisterScript(Handle));
+        SendAutomationResponse(RequestingSocket, RequestId, true, TEXT("Python script unregistered."), Result);
+    }
+    else if (SubAction == TEXT("reset_context"))
+    {
+        // An empty context resets all of them.
+        const FString Context = GetJsonStringField(Payload, TEXT("context"));
+        if (!Context.IsEmpty() && !FMcpPythonContexts::IsValidName(Context))
+        {
+            SendAutomationError(RequestingSocket, RequestId, TEXT("context must be 1-128 letters, digits, '_', '-' or '.'."), TEXT("INVALID_ARGUMENT"));
+            return true;
+        }
+        FMcpPythonContexts::ResetContext(Context);
+        TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+        Result->SetStringField(TEXT("context"), Context);
+        SendAutomationResponse(RequestingSocket, RequestId, true,
+            Context.IsEmpty() ? TEXT("All Python contexts reset.") : TEXT("Python context reset."), Result);
+    }
+    else if (SubAction == TEXT("list_contexts"))
+    {
+        TSharedPtr<FJsonObject> Reply;
+        FString Error;
+        if (!FMcpPythonContexts::Describe(Reply, Error))
+        {
+            SendAutomationError(RequestingSocket, RequestId, Error, TEXT("PYTHON_BRIDGE_ERROR"));
+            return true;
+        }
+        Reply->RemoveField(TEXT("ok"));
+        SendAutomationResponse(RequestingSocket, RequestId, true, TEXT("Python contexts listed."), Reply);
+    }
     else if (SubAction == TEXT("get_python_info"))
     {
         TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
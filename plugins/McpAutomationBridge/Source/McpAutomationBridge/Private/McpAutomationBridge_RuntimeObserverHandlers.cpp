@@ -3,54 +3,30 @@
 // Sprint 8: Runtime Observability C++ handlers
 //
 // Adds:
-//   get_recent_logs     — returns buffered log entries from the in-memory ring buffer
 //   get_runtime_state   — PIE state, player position, FPS, memory stats
-//   capture_telemetry   — snapshot of game state during PIE
+//   subscribe_runtime_telemetry / unsubscribe_runtime_telemetry
+//                       — per-frame sampling pushed as aggregated
+//                         runtime_telemetry events at a chosen interval
 //
-// Requires: FMcpLogRingBuffer to be added to the subsystem header.
-// If the ring buffer isn't compiled yet, these handlers return NOT_IMPLEMENTED.
+// get_recent_logs lives with the log capture device in
+// McpAutomationBridge_LogHandlers.cpp, next to the ring buffer it reads.
 
 #include "McpAutomationBridgeSubsystem.h"
+#include "McpAutomationBridgeHelpers.h"
+#include "McpBridgeWebSocket.h"
+#include "McpConnectionManager.h"
+#include "McpJsonUtf8Writer.h"
+#include "McpRuntimeTelemetry.h"
 #include "Editor.h"
 #include "Engine/World.h"
+#include "EngineUtils.h"
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/Pawn.h"
 #include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
 #include "Engine/Engine.h"
 #include "Misc/App.h"
 
-// ============================================================================
-// get_recent_logs — Return buffered log entries
-// ============================================================================
-bool UMcpAutomationBridgeSubsystem::HandleGetRecentLogs(
-    const FString& RequestId,
-    const FString& Action,
-    const TSharedPtr<FJsonObject>& Payload,
-    TSharedPtr<FMcpBridgeWebSocket> RequestingSocket)
-{
-    // If no log capture device is active, return empty
-    if (!LogCaptureDevice.IsValid())
-    {
-        TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-        Result->SetBoolField(TEXT("success"), true);
-        Result->SetStringField(TEXT("message"), TEXT("Log capture not active. Use manage_logs subscribe first."));
-
-        TArray<TSharedPtr<FJsonValue>> EmptyArray;
-        Result->SetArrayField(TEXT("logs"), EmptyArray);
-        Result->SetNumberField(TEXT("count"), 0);
-
-        SendAutomationResponse(RequestingSocket, RequestId, true, TEXT("No logs captured"), Result);
-        return true;
-    }
-
-    // NOTE: This handler requires FMcpLogRingBuffer to be added to FMcpLogOutputDevice.
-    // If not compiled yet, return NOT_IMPLEMENTED so the TS side falls back to disk logs.
-    SendAutomationResponse(RequestingSocket, RequestId, false,
-        TEXT("NOT_IMPLEMENTED: Log ring buffer not yet compiled. Use disk log fallback."),
-        nullptr, TEXT("NOT_IMPLEMENTED"));
-    return true;
-}
-
 // ============================================================================
 // get_runtime_state — PIE state, player info, FPS
 // ============================================================================
@@ -149,3 +125,169 @@ bool UMcpAutomationBridgeSubsystem::HandleGetRuntimeState(
     SendAutomationResponse(RequestingSocket, RequestId, true, TEXT("Runtime state captured"), Result);
     return true;
 }
+
+// ============================================================================
+// subscribe_runtime_telemetry — push aggregated per-frame telemetry
+// ============================================================================
+void UMcpAutomationBridgeSubsystem::TickRuntimeTelemetry()
+{
+    if (RuntimeTelemetrySubscriptions.Num() == 0 || !RuntimeTelemetry.IsValid())
+    {
+        return;
+    }
+    RuntimeTelemetry->SampleFrame();
+
+    const double Now = FPlatformTime::Seconds();
+    for (int32 Index = RuntimeTelemetrySubscriptions.Num() - 1; Index >= 0; --Index)
+    {
+        FRuntimeTelemetrySubscription& Subscription = RuntimeTelemetrySubscriptions[Index];
+        const TSharedPtr<FMcpBridgeWebSocket> Socket = Subscription.Socket.Pin();
+        if (Subscription.bBoundToSocket && (!Socket.IsValid() || !Socket->IsConnected()))
+        {
+            UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose, TEXT("Dropping runtime telemetry of a closed connection."));
+            RuntimeTelemetrySubscriptions.RemoveAtSwap(Index);
+            continue;
+        }
+        if (Now < Subscription.NextPushSeconds)
+        {
+            continue;
+        }
+        // Keep the cadence even when a tick runs late.
+        Subscription.NextPushSeconds = FMath::Max(Subscription.NextPushSeconds + Subscription.IntervalSeconds, Now);
+
+        FMcpJsonUtf8Writer Writer;
+        Writer.BeginObject();
+        Writer.WriteString(TEXT("type"), TEXT("automation_event"));
+        Writer.WriteString(TEXT("event"), TEXT("runtime_telemetry"));
+        Writer.Key(TEXT("payload"));
+        Writer.BeginObject();
+        Writer.WriteInt(TEXT("id"), Subscription.Id);
+        Writer.WriteInt(TEXT("seq"), Subscription.PushesSent + 1);
+        Writer.WriteInt(TEXT("t"), FMath::RoundToInt((Now - Subscription.StartSeconds) * 1000.0));
+        Subscription.Reader->WritePush(Writer);
+        Writer.EndObject();
+        Writer.EndObject();
+
+        // Dropped pushes under backpressure are not lost: the next one
+        // aggregates their frames too.
+        bool bSent = false;
+        if (Subscription.bBoundToSocket)
+        {
+            TArray<uint8> Bytes(Writer.GetBuffer());
+            bSent = ConnectionManager.IsValid() && ConnectionManager->SendDiscardableTo(Socket, MoveTemp(Bytes));
+        }
+        else
+        {
+            bSent = PublishEvent(TEXT("telemetry"), TArray<uint8>(Writer.GetBuffer()));
+        }
+        if (bSent)
+        {
+            Subscription.Reader->Commit();
+            ++Subscription.PushesSent;
+        }
+        else
+        {
+            ++Subscription.PushesDropped;
+        }
+    }
+
+    if (RuntimeTelemetrySubscriptions.Num() == 0)
+    {
+        RuntimeTelemetry.Reset();
+    }
+}
+
+bool UMcpAutomationBridgeSubsystem::HandleSubscribeRuntimeTelemetry(
+    const FString& RequestId,
+    const FString& Action,
+    const TSharedPtr<FJsonObject>& Payload,
+    TSharedPtr<FMcpBridgeWebSocket> RequestingSocket)
+{
+    const double IntervalMs = FMath::Clamp(GetJsonNumberField(Payload, TEXT("intervalMs"), 1000.0), 100.0, 60000.0);
+    const double HitchThresholdMs = FMath::Max(1.0, GetJsonNumberField(Payload, TEXT("hitchThresholdMs"), 50.0));
+
+    if (!RuntimeTelemetry.IsValid())
+    {
+        RuntimeTelemetry = MakeShared<FMcpRuntimeTelemetry>();
+    }
+
+    // One subscription per connection; subscribing again replaces its settings.
+    const int32 ExistingIndex = RuntimeTelemetrySubscriptions.IndexOfByPredicate(
+        [&RequestingSocket](const FRuntimeTelemetrySubscription& Existing)
+        {
+            return Existing.bBoundToSocket == RequestingSocket.IsValid() &&
+                   Existing.Socket.Pin() == RequestingSocket;
+        });
+    FRuntimeTelemetrySubscription& Subscription = ExistingIndex != INDEX_NONE
+        ? RuntimeTelemetrySubscriptions[ExistingIndex]
+        : RuntimeTelemetrySubscriptions.AddDefaulted_GetRef();
+    Subscription = FRuntimeTelemetrySubscription();
+    Subscription.Socket = RequestingSocket;
+    Subscription.bBoundToSocket = RequestingSocket.IsValid();
+    Subscription.Id = NextRuntimeTelemetryId++;
+    Subscription.IntervalSeconds = IntervalMs / 1000.0;
+    Subscription.StartSeconds = FPlatformTime::Seconds();
+    Subscription.NextPushSeconds = Subscription.StartSeconds + Subscription.IntervalSeconds;
+    Subscription.Reader = MakeShared<FMcpRuntimeTelemetryReader>(RuntimeTelemetry.ToSharedRef(), HitchThresholdMs);
+    if (ExistingIndex == INDEX_NONE)
+    {
+        UE_LOG(LogMcpAutomationBridgeSubsystem, Display, TEXT("Runtime telemetry enabled by client request (%d subscriber(s))."),
+               RuntimeTelemetrySubscriptions.Num());
+    }
+
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetBoolField(TEXT("subscribed"), true);
+    Result->SetNumberField(TEXT("subscriptionId"), Subscription.Id);
+    Result->SetNumberField(TEXT("intervalMs"), IntervalMs);
+    Result->SetNumberField(TEXT("hitchThresholdMs"), HitchThresholdMs);
+    Result->SetStringField(TEXT("event"), TEXT("runtime_telemetry"));
+
+    // Key legend for the compact pushes.
+    TSharedPtr<FJsonObject> Format = MakeShared<FJsonObject>();
+    Format->SetStringField(TEXT("t"), TEXT("ms since subscribing"));
+    Format->SetStringField(TEXT("n"), TEXT("frames aggregated (miss: frames the sample ring overwrote)"));
+    Format->SetStringField(TEXT("us"), TEXT("frame/game/render/gpu/rhi: [mean, p50, p95, max] in microseconds"));
+    Format->SetStringField(TEXT("hitch"), TEXT("frames at or above hitchThresholdMs, omitted when 0"));
+    Format->SetStringField(TEXT("peakMb"), TEXT("peak resident memory over the window"));
+    Format->SetStringField(TEXT("mem"), TEXT("[usedPhysicalMb, availablePhysicalMb, usedVirtualMb], when changed"));
+    Format->SetStringField(TEXT("obj"), TEXT("[uobjects, actors], when changed"));
+    Format->SetStringField(TEXT("pie"), TEXT("[playing, paused], when changed"));
+    Format->SetStringField(TEXT("player"), TEXT("{loc, rot, speed, class} when changed; null when no pawn"));
+    Format->SetStringField(TEXT("full"), TEXT("true on a push carrying every section"));
+    Result->SetObjectField(TEXT("format"), Format);
+    SendAutomationResponse(RequestingSocket, RequestId, true, TEXT("Subscribed to runtime telemetry."), Result);
+    return true;
+}
+
+bool UMcpAutomationBridgeSubsystem::HandleUnsubscribeRuntimeTelemetry(
+    const FString& RequestId,
+    const FString& Action,
+    const TSharedPtr<FJsonObject>& Payload,
+    TSharedPtr<FMcpBridgeWebSocket> RequestingSocket)
+{
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetBoolField(TEXT("subscribed"), false);
+
+    const int32 ExistingIndex = RuntimeTelemetrySubscriptions.IndexOfByPredicate(
+        [&RequestingSocket](const FRuntimeTelemetrySubscription& Existing)
+        {
+            return Existing.bBoundToSocket == RequestingSocket.IsValid() &&
+                   Existing.Socket.Pin() == RequestingSocket;
+        });
+    if (ExistingIndex != INDEX_NONE)
+    {
+        const FRuntimeTelemetrySubscription& Subscription = RuntimeTelemetrySubscriptions[ExistingIndex];
+        TSharedPtr<FJsonObject> Stats = MakeShared<FJsonObject>();
+        Stats->SetNumberField(TEXT("pushesSent"), static_cast<double>(Subscription.PushesSent));
+        Stats->SetNumberField(TEXT("pushesDropped"), static_cast<double>(Subscription.PushesDropped));
+        Result->SetObjectField(TEXT("stats"), Stats);
+        RuntimeTelemetrySubscriptions.RemoveAtSwap(ExistingIndex);
+        UE_LOG(LogMcpAutomationBridgeSubsystem, Display, TEXT("Runtime telemetry disabled by client request."));
+    }
+    if (RuntimeTelemetrySubscriptions.Num() == 0)
+    {
+        RuntimeTelemetry.Reset();
+    }
+    SendAutomationResponse(RequestingSocket, RequestId, true, TEXT("Unsubscribed from runtime telemetry."), Result);
+    return true;
+}
@@ -43,8 +43,8 @@ void FSCSHandlers::FinalizeBlueprintSCSChange(UBlueprint *Blueprint,
   bOutCompiled = McpSafeCompileBlueprint(Blueprint);
 
   
-  // UE 5.7+ Fix: Use McpSafeAssetSave instead of SaveLoadedAssetThrottled.
-  // SaveLoadedAssetThrottled triggers UEditorAssetLibrary::SaveLoadedAsset() which
+  // UE 5.7+ Fix: Use McpSafeAssetSave instead of QueueAssetSave.
+  // Writing the package to disk (as a queued save eventually does) triggers
   // causes thumbnail generation and recursive FlushRenderingCommands calls (11+ times).
   // This corrupts render thread state and causes access violations in RenderCore.dll.
   // McpSafeAssetSave marks package dirty without triggering disk save operations.
@@ -119,16 +119,12 @@ FString UMcpAutomationBridgeSubsystem::ResolveSequencePath(
   return FString();
 }
 
-TSharedPtr<FJsonObject>
-UMcpAutomationBridgeSubsystem::EnsureSequenceEntry(const FString &SeqPath) {
+bool UMcpAutomationBridgeSubsystem::EnsureSequenceEntry(
+    const FString &SeqPath) {
   if (SeqPath.IsEmpty())
-    return nullptr;
-  if (TSharedPtr<FJsonObject> *Found = GSequenceRegistry.Find(SeqPath))
-    return *Found;
-  TSharedPtr<FJsonObject> NewObj = MakeShared<FJsonObject>();
-  NewObj->SetStringField(TEXT("sequencePath"), SeqPath);
-  GSequenceRegistry.Add(SeqPath, NewObj);
-  return NewObj;
+    return false;
+  GSequenceRegistry.Update(SeqPath, [](FMcpSequenceRecord &) {});
+  return true;
 }
 
 bool UMcpAutomationBridgeSubsystem::HandleSequenceCreate(
@@ -2406,6 +2402,8 @@ bool UMcpAutomationBridgeSubsystem::HandleSequenceAction(
     return HandleSequenceGetMetadata(RequestId, LocalPayload, RequestingSocket);
   if (EffectiveAction == TEXT("sequence_add_keyframe"))
     return HandleSequenceAddKeyframe(RequestId, LocalPayload, RequestingSocket);
+  if (EffectiveAction == TEXT("sequence_add_keyframes"))
+    return HandleSequenceAddKeyframes(RequestId, LocalPayload, RequestingSocket);
 
   // New handlers
   if (EffectiveAction == TEXT("sequence_add_section"))
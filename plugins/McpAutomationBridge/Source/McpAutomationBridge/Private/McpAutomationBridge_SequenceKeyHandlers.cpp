@@ -0,0 +1,645 @@
+// Location:
+// McpAutomationBridge/Private/McpAutomationBridge_SequenceKeyHandlers.cpp
+// Summary: "sequence_add_keyframes" inserts whole key arrays into the channels
+//          of one track (float, double, bool or 3D transform) in one request,
+//          one undo transaction and one MarkAsChanged, instead of one
+//          sequence_add_keyframe request per key. Mocap-derived camera paths
+//          and procedural animation arrive as packed time/value arrays.
+// Usage: { "action": "sequence_add_keyframes", "payload": {
+//          "path": "/Game/Cine/LS_Shot", "actorName": "CineCam",
+//          "property": "Transform", "timeUnit": "frames",
+//          "times": [0, 1, 2, ...], "interpolation": "cubic",
+//          "channels": [ { "channel": "location.x", "values": [...] },
+//                        { "channel": "rotation.yaw", "times": {packed f64},
+//                          "values": {packed f64} } ] } }
+//          times and values are JSON arrays or FMcpPackedArray blocks (f64,
+//          f32, or u8 for bool). A channel without times uses the top-level
+//          times; a single-channel track may put values at the top level.
+
+#include "Algo/BinarySearch.h"
+#include "Algo/StableSort.h"
+#include "Dom/JsonObject.h"
+#include "HAL/PlatformTime.h"
+#include "McpAutomationBridgeGlobals.h"
+#include "McpAutomationBridgeHelpers.h"
+#include "McpAutomationBridgeSubsystem.h"
+#include "McpPackedArray.h"
+
+#if WITH_EDITOR
+#include "Channels/MovieSceneBoolChannel.h"
+#include "Channels/MovieSceneChannelProxy.h"
+#include "Channels/MovieSceneDoubleChannel.h"
+#include "Channels/MovieSceneFloatChannel.h"
+#include "EditorAssetLibrary.h"
+#include "LevelSequence.h"
+#include "MovieScene.h"
+#include "ScopedTransaction.h"
+#include "Sections/MovieScene3DTransformSection.h"
+#include "Sections/MovieSceneBoolSection.h"
+#include "Sections/MovieSceneFloatSection.h"
+#include "Tracks/MovieScene3DTransformTrack.h"
+#include "Tracks/MovieSceneBoolTrack.h"
+#include "Tracks/MovieSceneFloatTrack.h"
+#if __has_include("Tracks/MovieSceneDoubleTrack.h")
+#include "Sections/MovieSceneDoubleSection.h"
+#include "Tracks/MovieSceneDoubleTrack.h"
+#define MCP_HAS_DOUBLE_PROPERTY_TRACK 1
+#else
+#define MCP_HAS_DOUBLE_PROPERTY_TRACK 0
+#endif
+#endif
+
+#if WITH_EDITOR
+namespace {
+// A minute of 120 fps mocap on all nine transform channels is ~65k keys; this
+// leaves room for long takes while bounding one game-thread stall.
+constexpr int32 MaxSequenceKeysPerRequest = 1000000;
+
+// Reads a JSON array of numbers (or bools) or a packed f64/f32/u8 block.
+bool ReadKeyNumbers(const TSharedPtr<FJsonValue> &Field, TArray<double> &Out,
+                    FString &OutError) {
+  Out.Reset();
+  if (!Field.IsValid()) {
+    return true;
+  }
+  if (FMcpPackedArray::IsPackedValue(Field)) {
+    const TSharedPtr<FJsonObject> Packed = Field->AsObject();
+    FString Layout = TEXT("f64");
+    Packed->TryGetStringField(TEXT("layout"), Layout);
+    Layout = Layout.ToLower();
+    const int32 ElementSize = Layout == TEXT("f64")   ? sizeof(double)
+                              : Layout == TEXT("f32") ? sizeof(float)
+                              : Layout == TEXT("u8")  ? sizeof(uint8)
+                                                      : 0;
+    if (ElementSize == 0) {
+      OutError = FString::Printf(
+          TEXT("Packed key layout must be f64, f32 or u8 (got '%s')"), *Layout);
+      return false;
+    }
+    TArray<uint8> Bytes;
+    int32 Count = 0;
+    if (!FMcpPackedArray::DecodeRaw(*Packed, ElementSize, Bytes, Count,
+                                    OutError)) {
+      return false;
+    }
+    Out.SetNumUninitialized(Count);
+    for (int32 Index = 0; Index < Count; ++Index) {
+      const uint8 *Element = Bytes.GetData() + Index * ElementSize;
+      Out[Index] = ElementSize == sizeof(double)
+                       ? *reinterpret_cast<const double *>(Element)
+                   : ElementSize == sizeof(float)
+                       ? *reinterpret_cast<const float *>(Element)
+                       : *Element;
+    }
+    return true;
+  }
+  const TArray<TSharedPtr<FJsonValue>> *Values = nullptr;
+  if (!Field->TryGetArray(Values) || !Values) {
+    OutError = TEXT("times and values must be arrays or packed blocks");
+    return false;
+  }
+  Out.Reserve(Values->Num());
+  for (const TSharedPtr<FJsonValue> &Value : *Values) {
+    if (!Value.IsValid() ||
+        (Value->Type != EJson::Number && Value->Type != EJson::Boolean)) {
+      OutError = TEXT("times and values must hold numbers or booleans");
+      return false;
+    }
+    Out.Add(Value->Type == EJson::Boolean ? (Value->AsBool() ? 1.0 : 0.0)
+                                          : Value->AsNumber());
+  }
+  return true;
+}
+
+bool ParseInterpMode(const FString &Name, ERichCurveInterpMode &OutMode) {
+  if (Name.IsEmpty() || Name.Equals(TEXT("cubic"), ESearchCase::IgnoreCase) ||
+      Name.Equals(TEXT("auto"), ESearchCase::IgnoreCase)) {
+    OutMode = RCIM_Cubic;
+  } else if (Name.Equals(TEXT("linear"), ESearchCase::IgnoreCase)) {
+    OutMode = RCIM_Linear;
+  } else if (Name.Equals(TEXT("constant"), ESearchCase::IgnoreCase)) {
+    OutMode = RCIM_Constant;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+// Double channel index in UMovieScene3DTransformSection's proxy.
+int32 TransformChannelIndex(const FString &Name) {
+  static const TCHAR *Names[9][2] = {
+      {TEXT("location.x"), nullptr},       {TEXT("location.y"), nullptr},
+      {TEXT("location.z"), nullptr},       {TEXT("rotation.x"), TEXT("rotation.roll")},
+      {TEXT("rotation.y"), TEXT("rotation.pitch")},
+      {TEXT("rotation.z"), TEXT("rotation.yaw")},
+      {TEXT("scale.x"), nullptr},          {TEXT("scale.y"), nullptr},
+      {TEXT("scale.z"), nullptr}};
+  for (int32 Index = 0; Index < 9; ++Index) {
+    if (Name.Equals(Names[Index][0], ESearchCase::IgnoreCase) ||
+        (Names[Index][1] &&
+         Name.Equals(Names[Index][1], ESearchCase::IgnoreCase))) {
+      return Index;
+    }
+  }
+  return Name.IsNumeric() ? FCString::Atoi(*Name) : INDEX_NONE;
+}
+
+/** Keys of one channel, converted to tick times, sorted, last duplicate wins. */
+struct FIncomingKeys {
+  TArray<FFrameNumber> Times;
+  TArray<double> Values;
+  TArray<ERichCurveInterpMode> Interp;
+};
+
+struct FKeyIngestStats {
+  int32 Added = 0;
+  int32 Replaced = 0;
+  bool bAppended = false;
+  int32 Total = 0;
+};
+
+void SortIncomingKeys(FIncomingKeys &Keys) {
+  TArray<int32> Order;
+  Order.SetNumUninitialized(Keys.Times.Num());
+  for (int32 Index = 0; Index < Order.Num(); ++Index) {
+    Order[Index] = Index;
+  }
+  Algo::StableSortBy(Order, [&Keys](int32 Index) { return Keys.Times[Index]; });
+  FIncomingKeys Sorted;
+  Sorted.Times.Reserve(Order.Num());
+  Sorted.Values.Reserve(Order.Num());
+  Sorted.Interp.Reserve(Order.Num());
+  for (const int32 Index : Order) {
+    if (Sorted.Times.Num() > 0 && Sorted.Times.Last() == Keys.Times[Index]) {
+      Sorted.Values.Last() = Keys.Values[Index];
+      Sorted.Interp.Last() = Keys.Interp[Index];
+      continue;
+    }
+    Sorted.Times.Add(Keys.Times[Index]);
+    Sorted.Values.Add(Keys.Values[Index]);
+    Sorted.Interp.Add(Keys.Interp[Index]);
+  }
+  Keys = MoveTemp(Sorted);
+}
+
+// Float and double curve channels: appended through AddKeys when every new
+// key follows the existing ones (the usual import case), otherwise merged
+// with them and written back with one Set. Tangents are recomputed once.
+template <typename ChannelType, typename KeyValueType>
+FKeyIngestStats IngestCurveKeys(ChannelType &Channel,
+                                const FIncomingKeys &Keys) {
+  using FScalar = decltype(KeyValueType::Value);
+  FKeyIngestStats Stats;
+  TArray<KeyValueType> NewValues;
+  NewValues.Reserve(Keys.Values.Num());
+  for (int32 Index = 0; Index < Keys.Values.Num(); ++Index) {
+    KeyValueType &Key =
+        NewValues.Emplace_GetRef(static_cast<FScalar>(Keys.Values[Index]));
+    Key.InterpMode = Keys.Interp[Index];
+    Key.TangentMode = RCTM_Auto;
+  }
+
+  const TArrayView<const FFrameNumber> OldTimes = Channel.GetTimes();
+  const TArrayView<const KeyValueType> OldValues = Channel.GetValues();
+  if (OldTimes.Num() == 0 || OldTimes.Last() < Keys.Times[0]) {
+    Channel.AddKeys(Keys.Times, NewValues);
+    Stats.Added = Keys.Times.Num();
+    Stats.bAppended = true;
+  } else {
+    TArray<FFrameNumber> Times;
+    TArray<KeyValueType> Values;
+    Times.Reserve(OldTimes.Num() + Keys.Times.Num());
+    Values.Reserve(OldTimes.Num() + Keys.Times.Num());
+    int32 Old = 0;
+    int32 New = 0;
+    while (Old < OldTimes.Num() || New < Keys.Times.Num()) {
+      if (New == Keys.Times.Num() ||
+          (Old < OldTimes.Num() && OldTimes[Old] < Keys.Times[New])) {
+        Times.Add(OldTimes[Old]);
+        Values.Add(OldValues[Old]);
+        ++Old;
+        continue;
+      }
+      if (Old < OldTimes.Num() && OldTimes[Old] == Keys.Times[New]) {
+        ++Old;
+        ++Stats.Replaced;
+      } else {
+        ++Stats.Added;
+      }
+      Times.Add(Keys.Times[New]);
+      Values.Add(NewValues[New]);
+      ++New;
+    }
+    Channel.Set(MoveTemp(Times), MoveTemp(Values));
+  }
+  Channel.AutoSetTangents();
+  Stats.Total = Channel.GetTimes().Num();
+  return Stats;
+}
+
+// Bool channels have no bulk insert; the merged keys are re-added in order,
+// which appends each one.
+FKeyIngestStats IngestBoolKeys(FMovieSceneBoolChannel &Channel,
+                               const FIncomingKeys &Keys) {
+  FKeyIngestStats Stats;
+  TMovieSceneChannelData<bool> Data = Channel.GetData();
+  TArray<FFrameNumber> Times(Data.GetTimes().GetData(), Data.GetTimes().Num());
+  TArray<bool> Values(Data.GetValues().GetData(), Data.GetValues().Num());
+  Stats.bAppended = Times.Num() == 0 || Times.Last() < Keys.Times[0];
+  for (int32 Index = 0; Index < Keys.Times.Num(); ++Index) {
+    const int32 At = Algo::LowerBound(Times, Keys.Times[Index]);
+    if (Times.IsValidIndex(At) && Times[At] == Keys.Times[Index]) {
+      Values[At] = Keys.Values[Index] != 0.0;
+      ++Stats.Replaced;
+    } else {
+      Times.Insert(Keys.Times[Index], At);
+      Values.Insert(Keys.Values[Index] != 0.0, At);
+      ++Stats.Added;
+    }
+  }
+  Data.Reset();
+  for (int32 Index = 0; Index < Times.Num(); ++Index) {
+    Data.AddKey(Times[Index], Values[Index]);
+  }
+  Stats.Total = Times.Num();
+  return Stats;
+}
+
+FGuid FindKeyBindingGuid(UMovieScene *MovieScene, const FString &BindingIdStr,
+                         const FString &ActorName) {
+  FGuid BindingGuid;
+  if (!BindingIdStr.IsEmpty()) {
+    FGuid::Parse(BindingIdStr, BindingGuid);
+    return BindingGuid;
+  }
+  for (const FMovieSceneBinding &Binding :
+       const_cast<const UMovieScene *>(MovieScene)->GetBindings()) {
+    FString BindingName;
+    if (FMovieScenePossessable *Possessable =
+            MovieScene->FindPossessable(Binding.GetObjectGuid())) {
+      BindingName = Possessable->GetName();
+    } else if (FMovieSceneSpawnable *Spawnable =
+                   MovieScene->FindSpawnable(Binding.GetObjectGuid())) {
+      BindingName = Spawnable->GetName();
+    }
+    if (BindingName.Equals(ActorName, ESearchCase::IgnoreCase)) {
+      return Binding.GetObjectGuid();
+    }
+  }
+  return BindingGuid;
+}
+
+template <typename TrackType>
+TrackType *FindOrAddPropertyTrack(UMovieScene *MovieScene,
+                                  const FGuid &BindingGuid,
+                                  const FString &PropertyName) {
+  TrackType *Track =
+      MovieScene->FindTrack<TrackType>(BindingGuid, FName(*PropertyName));
+  if (!Track) {
+    Track = MovieScene->AddTrack<TrackType>(BindingGuid);
+    if (Track) {
+      Track->SetPropertyNameAndPath(FName(*PropertyName), PropertyName);
+    }
+  }
+  return Track;
+}
+} // namespace
+#endif
+
+/**
+ * @brief Insert packed key arrays into the channels of one Sequencer track.
+ *
+ * Resolves the binding like sequence_add_keyframe (bindingId or actorName),
+ * finds or creates the property's track and section, converts every time to
+ * tick resolution and writes each channel's keys in one pass under a single
+ * transaction, then calls MarkAsChanged once on the section.
+ *
+ * @param RequestId Identifier of the request.
+ * @param Payload path, bindingId/actorName, property, type, timeUnit, times,
+ * values, interpolation, channels.
+ * @param Socket Socket that receives the response.
+ * @return true; a response is always sent.
+ */
+bool UMcpAutomationBridgeSubsystem::HandleSequenceAddKeyframes(
+    const FString &RequestId, const TSharedPtr<FJsonObject> &Payload,
+    TSharedPtr<FMcpBridgeWebSocket> Socket) {
+#if WITH_EDITOR
+  TSharedPtr<FJsonObject> LocalPayload =
+      Payload.IsValid() ? Payload : MakeShared<FJsonObject>();
+  const FString SeqPath = ResolveSequencePath(LocalPayload);
+  if (SeqPath.IsEmpty()) {
+    SendAutomationError(Socket, RequestId,
+                        TEXT("sequence_add_keyframes requires a sequence path"),
+                        TEXT("INVALID_SEQUENCE"));
+    return true;
+  }
+  const FString BindingIdStr = GetJsonStringField(LocalPayload, TEXT("bindingId"));
+  const FString ActorName = GetJsonStringField(LocalPayload, TEXT("actorName"));
+  const FString PropertyName = GetJsonStringField(LocalPayload, TEXT("property"));
+  if ((BindingIdStr.IsEmpty() && ActorName.IsEmpty()) || PropertyName.IsEmpty()) {
+    SendAutomationError(Socket, RequestId,
+                        TEXT("bindingId or actorName, and property, are "
+                             "required"),
+                        TEXT("INVALID_ARGUMENT"));
+    return true;
+  }
+  FString TrackType = GetJsonStringField(LocalPayload, TEXT("type")).ToLower();
+  if (TrackType.IsEmpty()) {
+    TrackType = PropertyName.Equals(TEXT("Transform"), ESearchCase::IgnoreCase)
+                    ? TEXT("transform")
+                    : TEXT("float");
+  }
+  const FString TimeUnit =
+      GetJsonStringField(LocalPayload, TEXT("timeUnit"), TEXT("frames")).ToLower();
+  ERichCurveInterpMode DefaultInterp = RCIM_Cubic;
+  if (!ParseInterpMode(GetJsonStringField(LocalPayload, TEXT("interpolation")),
+                       DefaultInterp)) {
+    SendAutomationError(Socket, RequestId,
+                        TEXT("interpolation must be cubic, linear or constant"),
+                        TEXT("INVALID_ARGUMENT"));
+    return true;
+  }
+
+  ULevelSequence *LevelSeq =
+      Cast<ULevelSequence>(UEditorAssetLibrary::LoadAsset(SeqPath));
+  UMovieScene *MovieScene = LevelSeq ? LevelSeq->GetMovieScene() : nullptr;
+  if (!MovieScene) {
+    SendAutomationError(Socket, RequestId,
+                        TEXT("Sequence not found or not a LevelSequence"),
+                        TEXT("INVALID_SEQUENCE"));
+    return true;
+  }
+  const FGuid BindingGuid =
+      FindKeyBindingGuid(MovieScene, BindingIdStr, ActorName);
+  if (!BindingGuid.IsValid() || !MovieScene->FindBinding(BindingGuid)) {
+    SendAutomationError(
+        Socket, RequestId,
+        FString::Printf(TEXT("Binding not found for '%s'. Ensure actor is "
+                             "bound to sequence."),
+                        BindingIdStr.IsEmpty() ? *ActorName : *BindingIdStr),
+        TEXT("BINDING_NOT_FOUND"));
+    return true;
+  }
+
+  // Channel specs: the "channels" array, or the top-level times/values for a
+  // single-channel track.
+  TArray<TSharedPtr<FJsonObject>> Specs;
+  const TArray<TSharedPtr<FJsonValue>> *ChannelsArray = nullptr;
+  if (LocalPayload->TryGetArrayField(TEXT("channels"), ChannelsArray) &&
+      ChannelsArray) {
+    for (const TSharedPtr<FJsonValue> &Val : *ChannelsArray) {
+      if (Val.IsValid() && Val->Type == EJson::Object) {
+        Specs.Add(Val->AsObject());
+      }
+    }
+  } else if (LocalPayload->HasField(TEXT("values"))) {
+    Specs.Add(LocalPayload);
+  }
+  if (Specs.Num() == 0) {
+    SendAutomationError(Socket, RequestId,
+                        TEXT("channels (or values) required"),
+                        TEXT("INVALID_ARGUMENT"));
+    return true;
+  }
+
+  TArray<double> SharedTimes;
+  FString Error;
+  if (!ReadKeyNumbers(LocalPayload->TryGetField(TEXT("times")), SharedTimes,
+                      Error)) {
+    SendAutomationError(Socket, RequestId, Error, TEXT("INVALID_ARGUMENT"));
+    return true;
+  }
+
+  const FFrameRate TickResolution = MovieScene->GetTickResolution();
+  const FFrameRate DisplayRate = MovieScene->GetDisplayRate();
+  auto ToTick = [&](double Time) -> FFrameNumber {
+    if (TimeUnit == TEXT("seconds")) {
+      return TickResolution.AsFrameTime(Time).RoundToFrame();
+    }
+    if (TimeUnit == TEXT("ticks")) {
+      return FFrameNumber(static_cast<int32>(FMath::RoundToDouble(Time)));
+    }
+    return FFrameRate::TransformTime(FFrameTime::FromDecimal(Time), DisplayRate,
+                                     TickResolution)
+        .RoundToFrame();
+  };
+
+  // Decode and validate everything before touching the sequence.
+  TArray<int32> ChannelIndices;
+  TArray<FIncomingKeys> Incoming;
+  int64 TotalKeys = 0;
+  for (const TSharedPtr<FJsonObject> &Spec : Specs) {
+    int32 ChannelIndex = 0;
+    if (TrackType == TEXT("transform")) {
+      const TSharedPtr<FJsonValue> ChannelField = Spec->TryGetField(TEXT("channel"));
+      ChannelIndex = !ChannelField.IsValid() ? INDEX_NONE
+                     : ChannelField->Type == EJson::Number
+                         ? static_cast<int32>(ChannelField->AsNumber())
+                         : TransformChannelIndex(ChannelField->AsString());
+      if (ChannelIndex < 0 || ChannelIndex > 8) {
+        SendAutomationError(
+            Socket, RequestId,
+            TEXT("Transform channels are location.x|y|z, rotation.roll|pitch|"
+                 "yaw (or .x|y|z), scale.x|y|z, or indices 0-8"),
+            TEXT("INVALID_ARGUMENT"));
+        return true;
+      }
+    }
+
+    TArray<double> Times;
+    TArray<double> Values;
+    if (!ReadKeyNumbers(Spec->TryGetField(TEXT("values")), Values, Error) ||
+        (Spec != LocalPayload &&
+         !ReadKeyNumbers(Spec->TryGetField(TEXT("times")), Times, Error))) {
+      SendAutomationError(Socket, RequestId, Error, TEXT("INVALID_ARGUMENT"));
+      return true;
+    }
+    if (Times.Num() == 0) {
+      Times = SharedTimes;
+    }
+    if (Times.Num() != Values.Num() || Values.Num() == 0) {
+      SendAutomationError(
+          Socket, RequestId,
+          FString::Printf(TEXT("Channel %d has %d time(s) and %d value(s); "
+                               "they must match and be non-empty"),
+                          ChannelIndex, Times.Num(), Values.Num()),
+          TEXT("INVALID_ARGUMENT"));
+      return true;
+    }
+    TotalKeys += Values.Num();
+    if (TotalKeys > MaxSequenceKeysPerRequest) {
+      SendAutomationError(
+          Socket, RequestId,
+          FString::Printf(TEXT("sequence_add_keyframes accepts at most %d "
+                               "keys per request; split the import."),
+                          MaxSequenceKeysPerRequest),
+          TEXT("INVALID_ARGUMENT"));
+      return true;
+    }
+
+    ERichCurveInterpMode ChannelInterp = DefaultInterp;
+    if (!ParseInterpMode(GetJsonStringField(Spec, TEXT("interpolation")),
+                         ChannelInterp)) {
+      ChannelInterp = DefaultInterp;
+    }
+    FIncomingKeys Keys;
+    Keys.Times.Reserve(Times.Num());
+    for (const double Time : Times) {
+      Keys.Times.Add(ToTick(Time));
+    }
+    Keys.Values = MoveTemp(Values);
+    Keys.Interp.Init(ChannelInterp, Keys.Values.Num());
+    const TArray<TSharedPtr<FJsonValue>> *InterpArray = nullptr;
+    if (Spec->TryGetArrayField(TEXT("interpolations"), InterpArray) &&
+        InterpArray) {
+      for (int32 Index = 0;
+           Index < FMath::Min(InterpArray->Num(), Keys.Interp.Num()); ++Index) {
+        ParseInterpMode((*InterpArray)[Index]->AsString(), Keys.Interp[Index]);
+      }
+    }
+    SortIncomingKeys(Keys);
+    ChannelIndices.Add(ChannelIndex);
+    Incoming.Add(MoveTemp(Keys));
+  }
+
+  const double StartSeconds = FPlatformTime::Seconds();
+  FScopedTransaction Transaction(
+      FText::FromString(TEXT("MCP Add Sequencer Keys")));
+  MovieScene->Modify();
+
+  UMovieSceneSection *Section = nullptr;
+  bool bSectionAdded = false;
+  if (TrackType == TEXT("transform")) {
+    UMovieScene3DTransformTrack *Track =
+        MovieScene->FindTrack<UMovieScene3DTransformTrack>(BindingGuid,
+                                                           FName("Transform"));
+    if (!Track) {
+      Track = MovieScene->AddTrack<UMovieScene3DTransformTrack>(BindingGuid);
+    }
+    Section = Track ? Track->FindOrAddSection(0, bSectionAdded) : nullptr;
+  } else if (TrackType == TEXT("float")) {
+    UMovieSceneFloatTrack *Track = FindOrAddPropertyTrack<UMovieSceneFloatTrack>(
+        MovieScene, BindingGuid, PropertyName);
+    Section = Track ? Track->FindOrAddSection(0, bSectionAdded) : nullptr;
+#if MCP_HAS_DOUBLE_PROPERTY_TRACK
+  } else if (TrackType == TEXT("double")) {
+    UMovieSceneDoubleTrack *Track =
+        FindOrAddPropertyTrack<UMovieSceneDoubleTrack>(MovieScene, BindingGuid,
+                                                       PropertyName);
+    Section = Track ? Track->FindOrAddSection(0, bSectionAdded) : nullptr;
+#endif
+  } else if (TrackType == TEXT("bool")) {
+    UMovieSceneBoolTrack *Track = FindOrAddPropertyTrack<UMovieSceneBoolTrack>(
+        MovieScene, BindingGuid, PropertyName);
+    Section = Track ? Track->FindOrAddSection(0, bSectionAdded) : nullptr;
+  } else {
+    Transaction.Cancel();
+    SendAutomationError(
+        Socket, RequestId,
+        FString::Printf(TEXT("Unsupported key type '%s' (float, double, bool, "
+                             "transform)"),
+                        *TrackType),
+        TEXT("UNSUPPORTED_PROPERTY"));
+    return true;
+  }
+  if (!Section) {
+    Transaction.Cancel();
+    SendAutomationError(Socket, RequestId,
+                        TEXT("Failed to create the track or section"),
+                        TEXT("UNSUPPORTED_PROPERTY"));
+    return true;
+  }
+  Section->Modify();
+
+  FMovieSceneChannelProxy &Proxy = Section->GetChannelProxy();
+  TArray<TSharedPtr<FJsonValue>> ChannelResults;
+  int32 KeysAdded = 0;
+  int32 KeysReplaced = 0;
+  FFrameNumber MinTime = Incoming[0].Times[0];
+  FFrameNumber MaxTime = Incoming[0].Times.Last();
+  for (int32 SpecIndex = 0; SpecIndex < Incoming.Num(); ++SpecIndex) {
+    const FIncomingKeys &Keys = Incoming[SpecIndex];
+    const int32 ChannelIndex = ChannelIndices[SpecIndex];
+    FKeyIngestStats Stats;
+    bool bHaveChannel = true;
+    if (TrackType == TEXT("bool")) {
+      FMovieSceneBoolChannel *Channel =
+          Proxy.GetChannel<FMovieSceneBoolChannel>(ChannelIndex);
+      bHaveChannel = Channel != nullptr;
+      if (Channel) {
+        Stats = IngestBoolKeys(*Channel, Keys);
+      }
+    } else if (TrackType == TEXT("float")) {
+      FMovieSceneFloatChannel *Channel =
+          Proxy.GetChannel<FMovieSceneFloatChannel>(ChannelIndex);
+      bHaveChannel = Channel != nullptr;
+      if (Channel) {
+        Stats = IngestCurveKeys<FMovieSceneFloatChannel, FMovieSceneFloatValue>(
+            *Channel, Keys);
+      }
+    } else {
+      FMovieSceneDoubleChannel *Channel =
+          Proxy.GetChannel<FMovieSceneDoubleChannel>(ChannelIndex);
+      bHaveChannel = Channel != nullptr;
+      if (Channel) {
+        Stats =
+            IngestCurveKeys<FMovieSceneDoubleChannel, FMovieSceneDoubleValue>(
+                *Channel, Keys);
+      }
+    }
+
+    TSharedPtr<FJsonObject> ChannelJson = MakeShared<FJsonObject>();
+    ChannelJson->SetNumberField(TEXT("channel"), ChannelIndex);
+    if (!bHaveChannel) {
+      ChannelJson->SetStringField(TEXT("error"), TEXT("CHANNEL_NOT_FOUND"));
+    } else {
+      ChannelJson->SetNumberField(TEXT("added"), Stats.Added);
+      ChannelJson->SetNumberField(TEXT("replaced"), Stats.Replaced);
+      ChannelJson->SetBoolField(TEXT("appended"), Stats.bAppended);
+      ChannelJson->SetNumberField(TEXT("totalKeys"), Stats.Total);
+      KeysAdded += Stats.Added;
+      KeysReplaced += Stats.Replaced;
+      MinTime = FMath::Min(MinTime, Keys.Times[0]);
+      MaxTime = FMath::Max(MaxTime, Keys.Times.Last());
+    }
+    ChannelResults.Add(MakeShared<FJsonValueObject>(ChannelJson));
+  }
+
+  // A section with a finite range would clip keys outside it.
+  Section->ExpandToFrame(MinTime);
+  Section->ExpandToFrame(MaxTime);
+  Section->MarkAsChanged();
+  MovieScene->MarkPackageDirty();
+
+  TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+  Result->SetStringField(TEXT("path"), SeqPath);
+  Result->SetStringField(TEXT("bindingId"), BindingGuid.ToString());
+  Result->SetStringField(TEXT("property"), PropertyName);
+  Result->SetStringField(TEXT("type"), TrackType);
+  Result->SetBoolField(TEXT("sectionCreated"), bSectionAdded);
+  Result->SetArrayField(TEXT("channels"), ChannelResults);
+  Result->SetNumberField(TEXT("keysAdded"), KeysAdded);
+  Result->SetNumberField(TEXT("keysReplaced"), KeysReplaced);
+  Result->SetNumberField(
+      TEXT("startFrame"),
+      FFrameRate::TransformTime(FFrameTime(MinTime), TickResolution, DisplayRate)
+          .AsDecimal());
+  Result->SetNumberField(
+      TEXT("endFrame"),
+      FFrameRate::TransformTime(FFrameTime(MaxTime), TickResolution, DisplayRate)
+          .AsDecimal());
+  Result->SetNumberField(TEXT("durationMs"),
+                         (FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+  SendAutomationResponse(
+      Socket, RequestId, true,
+      FString::Printf(TEXT("Added %d key(s), replaced %d, on %d channel(s)."),
+                      KeysAdded, KeysReplaced, ChannelResults.Num()),
+      Result);
+  return true;
+#else
+  SendAutomationError(Socket, RequestId,
+                      TEXT("sequence_add_keyframes requires editor build."),
+                      TEXT("NOT_IMPLEMENTED"));
+  return true;
+#endif
+}
@@ -9,9 +9,12 @@
 #include "McpAutomationBridgeGlobals.h"
 #include "McpAutomationBridgeHelpers.h"
 #include "McpAutomationBridgeSubsystem.h"
+#include "McpPackedArray.h"
 
 #if WITH_EDITOR
 
+#include "Async/ParallelFor.h"
+#include "Templates/Atomic.h"
 #include "Animation/Skeleton.h"
 #include "Engine/SkeletalMesh.h"
 #include "Components/SkeletalMeshComponent.h"
@@ -244,6 +247,184 @@ static FRotator ParseRotatorFromJson(const TSharedPtr<FJsonObject>& JsonObj, con
     return Default;
 }
 
+/**
+ * Helper: Read an integer buffer from a JSON number array or an FMcpPackedArray block
+ * (layout i32, u32, u16 or u8). Returns false with OutError on a malformed field; an absent
+ * field leaves Out empty.
+ */
+static bool ReadSkinIntBuffer(const TSharedPtr<FJsonObject>& Obj, const TCHAR* Field, TArray<int32>& Out, FString& OutError)
+{
+    Out.Reset();
+    const TSharedPtr<FJsonValue> Value = Obj->TryGetField(Field);
+    if (!Value.IsValid() || Value->IsNull())
+    {
+        return true;
+    }
+    if (FMcpPackedArray::IsPackedValue(Value))
+    {
+        const TSharedPtr<FJsonObject> Packed = Value->AsObject();
+        FString Layout = TEXT("i32");
+        Packed->TryGetStringField(TEXT("layout"), Layout);
+        Layout = Layout.ToLower();
+        const int32 ElementSize = (Layout == TEXT("i32") || Layout == TEXT("u32")) ? 4
+            : Layout == TEXT("u16") ? 2
+            : Layout == TEXT("u8") ? 1
+            : 0;
+        if (ElementSize == 0)
+        {
+            OutError = FString::Printf(TEXT("%s packed layout must be i32, u32, u16 or u8 (got '%s')"), Field, *Layout);
+            return false;
+        }
+        TArray<uint8> Bytes;
+        int32 Count = 0;
+        if (!FMcpPackedArray::DecodeRaw(*Packed, ElementSize, Bytes, Count, OutError))
+        {
+            return false;
+        }
+        Out.SetNumUninitialized(Count);
+        const uint8* Data = Bytes.GetData();
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            const uint8* Element = Data + static_cast<int64>(Index) * ElementSize;
+            Out[Index] = ElementSize == 4 ? (Layout == TEXT("u32") ? static_cast<int32>(FMath::Min<uint32>(*reinterpret_cast<const uint32*>(Element), MAX_int32)) : *reinterpret_cast<const int32*>(Element))
+                : ElementSize == 2 ? *reinterpret_cast<const uint16*>(Element)
+                : *Element;
+        }
+        return true;
+    }
+    const TArray<TSharedPtr<FJsonValue>>* Values = nullptr;
+    if (!Value->TryGetArray(Values) || !Values)
+    {
+        OutError = FString::Printf(TEXT("%s must be a number array or a packed block"), Field);
+        return false;
+    }
+    Out.Reserve(Values->Num());
+    for (const TSharedPtr<FJsonValue>& Element : *Values)
+    {
+        double Number = 0.0;
+        if (!Element.IsValid() || !Element->TryGetNumber(Number))
+        {
+            OutError = FString::Printf(TEXT("%s must contain only numbers"), Field);
+            return false;
+        }
+        Out.Add(static_cast<int32>(Number));
+    }
+    return true;
+}
+
+/**
+ * Helper: Read a float buffer from a JSON number array or an FMcpPackedArray block
+ * (layout f32 or f64, optionally with a component suffix such as f32x3).
+ */
+static bool ReadSkinFloatBuffer(const TSharedPtr<FJsonObject>& Obj, const TCHAR* Field, TArray<float>& Out, FString& OutError)
+{
+    Out.Reset();
+    const TSharedPtr<FJsonValue> Value = Obj->TryGetField(Field);
+    if (!Value.IsValid() || Value->IsNull())
+    {
+        return true;
+    }
+    if (FMcpPackedArray::IsPackedValue(Value))
+    {
+        const TSharedPtr<FJsonObject> Packed = Value->AsObject();
+        FString Layout = TEXT("f32");
+        Packed->TryGetStringField(TEXT("layout"), Layout);
+        Layout = Layout.ToLower();
+        const bool bDouble = Layout.StartsWith(TEXT("f64"));
+        if (!bDouble && !Layout.StartsWith(TEXT("f32")))
+        {
+            OutError = FString::Printf(TEXT("%s packed layout must be f32 or f64 (got '%s')"), Field, *Layout);
+            return false;
+        }
+        TArray<uint8> Bytes;
+        int32 Count = 0;
+        if (!FMcpPackedArray::DecodeRaw(*Packed, bDouble ? sizeof(double) : sizeof(float), Bytes, Count, OutError))
+        {
+            return false;
+        }
+        Out.SetNumUninitialized(Count);
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            Out[Index] = bDouble
+                ? static_cast<float>(reinterpret_cast<const double*>(Bytes.GetData())[Index])
+                : reinterpret_cast<const float*>(Bytes.GetData())[Index];
+        }
+        return true;
+    }
+    const TArray<TSharedPtr<FJsonValue>>* Values = nullptr;
+    if (!Value->TryGetArray(Values) || !Values)
+    {
+        OutError = FString::Printf(TEXT("%s must be a number array or a packed block"), Field);
+        return false;
+    }
+    Out.Reserve(Values->Num());
+    for (const TSharedPtr<FJsonValue>& Element : *Values)
+    {
+        double Number = 0.0;
+        if (!Element.IsValid() || !Element->TryGetNumber(Number))
+        {
+            OutError = FString::Printf(TEXT("%s must contain only numbers"), Field);
+            return false;
+        }
+        Out.Add(static_cast<float>(Number));
+    }
+    return true;
+}
+
+/**
+ * Helper: Build one vertex's skin weight from InfluenceCount (bone, weight) pairs. Influences at
+ * or below PruneThreshold are dropped (the strongest one is always kept), the rest are sorted by
+ * weight and capped at MAX_TOTAL_INFLUENCES, and with bNormalize the quantized weights sum to
+ * exactly 65535. Returns false when a bone index is outside [0, NumBones).
+ */
+static bool BuildRawSkinWeight(const int32* Bones, const float* Weights, int32 InfluenceCount, int32 NumBones,
+    bool bNormalize, float PruneThreshold, FRawSkinWeight& OutWeight, int32& OutPruned)
+{
+    TArray<TPair<float, int32>, TInlineAllocator<MAX_TOTAL_INFLUENCES * 2>> Influences;
+    for (int32 Index = 0; Index < InfluenceCount; ++Index)
+    {
+        if (Weights[Index] <= 0.0f)
+        {
+            continue;
+        }
+        if (Bones[Index] < 0 || Bones[Index] >= NumBones)
+        {
+            return false;
+        }
+        Influences.Emplace(Weights[Index], Bones[Index]);
+    }
+    Influences.Sort([](const TPair<float, int32>& A, const TPair<float, int32>& B) { return A.Key > B.Key; });
+
+    int32 Kept = FMath::Min(Influences.Num(), static_cast<int32>(MAX_TOTAL_INFLUENCES));
+    while (Kept > 1 && Influences[Kept - 1].Key <= PruneThreshold)
+    {
+        --Kept;
+    }
+    OutPruned = Influences.Num() - Kept;
+
+    FMemory::Memzero(&OutWeight, sizeof(FRawSkinWeight));
+    float Total = 0.0f;
+    for (int32 Index = 0; Index < Kept; ++Index)
+    {
+        Total += Influences[Index].Key;
+    }
+    const float Scale = (bNormalize && Total > 0.0f) ? 1.0f / Total : 1.0f;
+    int32 Remaining = 65535;
+    for (int32 Index = 0; Index < Kept; ++Index)
+    {
+        const int32 Quantized = FMath::Clamp(FMath::RoundToInt(Influences[Index].Key * Scale * 65535.0f), 0, Remaining);
+        OutWeight.InfluenceBones[Index] = static_cast<FBoneIndexType>(Influences[Index].Value);
+        OutWeight.InfluenceWeights[Index] = static_cast<uint16>(Quantized);
+        Remaining -= Quantized;
+    }
+    if (bNormalize && Kept > 0)
+    {
+        // Rounding leftovers go to the strongest influence so the vertex sums to one.
+        OutWeight.InfluenceWeights[0] = static_cast<uint16>(OutWeight.InfluenceWeights[0] + Remaining);
+    }
+    return true;
+}
+
 } // anonymous namespace
 
 
@@ -2031,6 +2212,275 @@ bool UMcpAutomationBridgeSubsystem::HandlePruneWeights(
     return true;
 }
 
+/**
+ * Handle: upload_skin_data
+ * Replace skin weights and morph target deltas for one LOD from packed buffers, with a single
+ * mesh rebuild for the whole upload.
+ *
+ * skinWeights: { vertexIndices [N], boneIndices [N*K], boneWeights [N*K], influencesPerVertex K }
+ * morphTargets: [{ morphTargetName, vertexIndices [M], positionDeltas [M*3], tangentDeltas? [M*3] }]
+ * Every buffer is a JSON number array or an FMcpPackedArray block. Weights are decoded, validated,
+ * pruned (pruneThreshold) and normalized (normalize, default on) per vertex in parallel before the
+ * mesh is touched, so a bad entry rejects the upload instead of leaving half of it applied.
+ */
+bool UMcpAutomationBridgeSubsystem::HandleUploadSkinData(
+    const FString& RequestId,
+    const TSharedPtr<FJsonObject>& Payload,
+    TSharedPtr<FMcpBridgeWebSocket> RequestingSocket)
+{
+    FString SkeletalMeshPath = GetStringFieldSkel(Payload, TEXT("skeletalMeshPath"));
+    FString ProfileName = GetStringFieldSkel(Payload, TEXT("profileName"));
+    if (ProfileName.IsEmpty())
+    {
+        ProfileName = TEXT("CustomWeights");
+    }
+    const bool bNormalize = GetBoolFieldSkel(Payload, TEXT("normalize"), true);
+    const float PruneThreshold = static_cast<float>(GetNumberFieldSkel(Payload, TEXT("pruneThreshold"), 0.0));
+    const int32 LODIndex = GetIntFieldSkel(Payload, TEXT("lodIndex"), 0);
+
+    if (SkeletalMeshPath.IsEmpty())
+    {
+        SendAutomationError(RequestingSocket, RequestId, TEXT("skeletalMeshPath is required"), TEXT("MISSING_PARAM"));
+        return true;
+    }
+
+    const TSharedPtr<FJsonObject>* WeightsObj = nullptr;
+    const TArray<TSharedPtr<FJsonValue>>* MorphArray = nullptr;
+    const bool bHasWeights = Payload->TryGetObjectField(TEXT("skinWeights"), WeightsObj) && WeightsObj && WeightsObj->IsValid();
+    const bool bHasMorphs = Payload->TryGetArrayField(TEXT("morphTargets"), MorphArray) && MorphArray && MorphArray->Num() > 0;
+    if (!bHasWeights && !bHasMorphs)
+    {
+        SendAutomationError(RequestingSocket, RequestId, TEXT("skinWeights or morphTargets is required"), TEXT("MISSING_PARAM"));
+        return true;
+    }
+
+    FString Error;
+    USkeletalMesh* Mesh = LoadSkeletalMeshFromPathSkel(SkeletalMeshPath, Error);
+    if (!Mesh)
+    {
+        SendAutomationError(RequestingSocket, RequestId, Error, TEXT("MESH_NOT_FOUND"));
+        return true;
+    }
+
+#if WITH_EDITORONLY_DATA
+    FSkeletalMeshModel* ImportedModel = Mesh->GetImportedModel();
+    if (!ImportedModel || !ImportedModel->LODModels.IsValidIndex(LODIndex))
+    {
+        SendAutomationError(RequestingSocket, RequestId,
+            FString::Printf(TEXT("LOD index %d out of range"), LODIndex), TEXT("INVALID_LOD"));
+        return true;
+    }
+    FSkeletalMeshLODModel& LODModel = ImportedModel->LODModels[LODIndex];
+    const int32 NumVertices = static_cast<int32>(LODModel.NumVertices);
+    const int32 NumBones = Mesh->GetRefSkeleton().GetRawBoneNum();
+
+    // ---- Decode and validate everything before the mesh is modified ----
+
+    TArray<int32> WeightVertices;
+    TArray<FRawSkinWeight> DecodedWeights;
+    int32 InfluencesPruned = 0;
+    if (bHasWeights)
+    {
+        TArray<int32> BoneIndices;
+        TArray<float> BoneWeights;
+        if (!ReadSkinIntBuffer(*WeightsObj, TEXT("vertexIndices"), WeightVertices, Error) ||
+            !ReadSkinIntBuffer(*WeightsObj, TEXT("boneIndices"), BoneIndices, Error) ||
+            !ReadSkinFloatBuffer(*WeightsObj, TEXT("boneWeights"), BoneWeights, Error))
+        {
+            SendAutomationError(RequestingSocket, RequestId, Error, TEXT("INVALID_WEIGHTS"));
+            return true;
+        }
+        const int32 Stride = GetIntFieldSkel((*WeightsObj), TEXT("influencesPerVertex"), 4);
+        if (Stride <= 0 || WeightVertices.Num() == 0 ||
+            BoneIndices.Num() != WeightVertices.Num() * Stride || BoneWeights.Num() != BoneIndices.Num())
+        {
+            SendAutomationError(RequestingSocket, RequestId,
+                FString::Printf(TEXT("skinWeights needs %d vertexIndices with influencesPerVertex (%d) boneIndices and boneWeights each (got %d and %d)"),
+                    WeightVertices.Num(), Stride, BoneIndices.Num(), BoneWeights.Num()),
+                TEXT("INVALID_WEIGHTS"));
+            return true;
+        }
+
+        DecodedWeights.SetNumUninitialized(WeightVertices.Num());
+        TArray<int32> PrunedPerVertex;
+        PrunedPerVertex.SetNumZeroed(WeightVertices.Num());
+        TArray<uint8> Invalid;
+        Invalid.SetNumZeroed(WeightVertices.Num());
+        ParallelFor(WeightVertices.Num(), [&](int32 Entry)
+        {
+            const int32 VertexIndex = WeightVertices[Entry];
+            const bool bValid = VertexIndex >= 0 && VertexIndex < NumVertices &&
+                BuildRawSkinWeight(&BoneIndices[Entry * Stride], &BoneWeights[Entry * Stride], Stride, NumBones,
+                    bNormalize, PruneThreshold, DecodedWeights[Entry], PrunedPerVertex[Entry]);
+            Invalid[Entry] = bValid ? 0 : 1;
+        });
+        const int32 Entry = Invalid.Find(1);
+        if (Entry != INDEX_NONE)
+        {
+            SendAutomationError(RequestingSocket, RequestId,
+                FString::Printf(TEXT("Weight entry %d (vertex %d) has a vertex outside [0, %d) or a bone outside [0, %d)"),
+                    Entry, WeightVertices[Entry], NumVertices, NumBones),
+                TEXT("INVALID_WEIGHTS"));
+            return true;
+        }
+        for (const int32 Pruned : PrunedPerVertex)
+        {
+            InfluencesPruned += Pruned;
+        }
+    }
+
+    struct FDecodedMorph
+    {
+        FName Name;
+        TArray<FMorphTargetDelta> Deltas;
+    };
+    TArray<FDecodedMorph> DecodedMorphs;
+    if (bHasMorphs)
+    {
+        for (const TSharedPtr<FJsonValue>& MorphValue : *MorphArray)
+        {
+            const TSharedPtr<FJsonObject>* MorphObj = nullptr;
+            if (!MorphValue.IsValid() || !MorphValue->TryGetObject(MorphObj) || !MorphObj)
+            {
+                SendAutomationError(RequestingSocket, RequestId, TEXT("Every entry in morphTargets must be an object"), TEXT("INVALID_MORPH_DATA"));
+                return true;
+            }
+            const FString MorphName = GetStringFieldSkel((*MorphObj), TEXT("morphTargetName"));
+            TArray<int32> Vertices;
+            TArray<float> Positions;
+            TArray<float> Tangents;
+            if (!ReadSkinIntBuffer(*MorphObj, TEXT("vertexIndices"), Vertices, Error) ||
+                !ReadSkinFloatBuffer(*MorphObj, TEXT("positionDeltas"), Positions, Error) ||
+                !ReadSkinFloatBuffer(*MorphObj, TEXT("tangentDeltas"), Tangents, Error))
+            {
+                SendAutomationError(RequestingSocket, RequestId, FString::Printf(TEXT("Morph '%s': %s"), *MorphName, *Error), TEXT("INVALID_MORPH_DATA"));
+                return true;
+            }
+            if (MorphName.IsEmpty() || Vertices.Num() == 0 || Positions.Num() != Vertices.Num() * 3 ||
+                (Tangents.Num() > 0 && Tangents.Num() != Vertices.Num() * 3))
+            {
+                SendAutomationError(RequestingSocket, RequestId,
+                    FString::Printf(TEXT("Morph '%s' needs morphTargetName, vertexIndices and three positionDeltas (and tangentDeltas) per vertex"), *MorphName),
+                    TEXT("INVALID_MORPH_DATA"));
+                return true;
+            }
+
+            FDecodedMorph& Morph = DecodedMorphs.AddDefaulted_GetRef();
+            Morph.Name = FName(*MorphName);
+            Morph.Deltas.SetNumUninitialized(Vertices.Num());
+            TAtomic<bool> bOutOfRange(false);
+            ParallelFor(Vertices.Num(), [&](int32 Entry)
+            {
+                FMorphTargetDelta& Delta = Morph.Deltas[Entry];
+                if (Vertices[Entry] < 0 || Vertices[Entry] >= NumVertices)
+                {
+                    bOutOfRange = true;
+                }
+                Delta.SourceIdx = static_cast<uint32>(FMath::Max(Vertices[Entry], 0));
+                Delta.PositionDelta = FVector3f(Positions[Entry * 3], Positions[Entry * 3 + 1], Positions[Entry * 3 + 2]);
+                Delta.TangentZDelta = Tangents.Num() > 0
+                    ? FVector3f(Tangents[Entry * 3], Tangents[Entry * 3 + 1], Tangents[Entry * 3 + 2])
+                    : FVector3f::ZeroVector;
+            });
+            if (bOutOfRange)
+            {
+                SendAutomationError(RequestingSocket, RequestId,
+                    FString::Printf(TEXT("Morph '%s' references a vertex outside [0, %d)"), *MorphName, NumVertices),
+                    TEXT("INVALID_MORPH_DATA"));
+                return true;
+            }
+        }
+    }
+
+    // ---- Apply ----
+
+    Mesh->Modify();
+    if (bHasWeights)
+    {
+        bool bHasProfile = false;
+        for (const FSkinWeightProfileInfo& Info : Mesh->GetSkinWeightProfiles())
+        {
+            bHasProfile |= Info.Name == FName(*ProfileName);
+        }
+        if (!bHasProfile)
+        {
+            FSkinWeightProfileInfo NewProfile;
+            NewProfile.Name = FName(*ProfileName);
+            Mesh->AddSkinWeightProfile(NewProfile);
+        }
+        FImportedSkinWeightProfileData& ProfileData = LODModel.SkinWeightProfiles.FindOrAdd(FName(*ProfileName));
+        ProfileData.SkinWeights.SetNum(NumVertices);
+        for (int32 Entry = 0; Entry < WeightVertices.Num(); ++Entry)
+        {
+            ProfileData.SkinWeights[WeightVertices[Entry]] = DecodedWeights[Entry];
+        }
+    }
+
+    int32 MorphsCreated = 0;
+    int32 DeltaCount = 0;
+    for (const FDecodedMorph& Morph : DecodedMorphs)
+    {
+        UMorphTarget* MorphTarget = Mesh->FindMorphTarget(Morph.Name);
+        const bool bCreate = MorphTarget == nullptr;
+        if (bCreate)
+        {
+            MorphTarget = NewObject<UMorphTarget>(Mesh, Morph.Name);
+            MorphTarget->BaseSkelMesh = Mesh;
+        }
+        MorphTarget->PopulateDeltas(Morph.Deltas, LODIndex, LODModel.Sections, false, false);
+        if (bCreate)
+        {
+            if (!MorphTarget->HasValidData())
+            {
+                MorphTarget->MarkAsGarbage();
+                continue;
+            }
+            // Render data is rebuilt once below, not per morph target.
+            Mesh->RegisterMorphTarget(MorphTarget, false);
+            ++MorphsCreated;
+        }
+        DeltaCount += Morph.Deltas.Num();
+    }
+
+    // One rebuild for the whole upload: weight profiles need the full build, morph-only uploads
+    // just refresh the morph render data.
+    if (bHasWeights)
+    {
+        Mesh->Build();
+    }
+    else
+    {
+        Mesh->InitMorphTargetsAndRebuildRenderData();
+    }
+    McpSafeAssetSave(Mesh);
+
+    TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject());
+    Result->SetStringField(TEXT("skeletalMeshPath"), SkeletalMeshPath);
+    Result->SetNumberField(TEXT("lodIndex"), LODIndex);
+    if (bHasWeights)
+    {
+        Result->SetStringField(TEXT("profileName"), ProfileName);
+        Result->SetNumberField(TEXT("verticesModified"), WeightVertices.Num());
+        Result->SetNumberField(TEXT("influencesPruned"), InfluencesPruned);
+        Result->SetBoolField(TEXT("normalized"), bNormalize);
+    }
+    if (bHasMorphs)
+    {
+        Result->SetNumberField(TEXT("morphTargetsSet"), DecodedMorphs.Num());
+        Result->SetNumberField(TEXT("morphTargetsCreated"), MorphsCreated);
+        Result->SetNumberField(TEXT("deltaCount"), DeltaCount);
+    }
+    Result->SetNumberField(TEXT("rebuilds"), 1);
+
+    SendAutomationResponse(RequestingSocket, RequestId, true,
+        FString::Printf(TEXT("Uploaded weights for %d vertices and %d morph targets"), WeightVertices.Num(), DecodedMorphs.Num()), Result);
+    return true;
+#else
+    SendAutomationError(RequestingSocket, RequestId, TEXT("upload_skin_data requires editor mode"), TEXT("NOT_EDITOR"));
+    return true;
+#endif
+}
+
 
 // ============================================================================
 // BATCH 8: Cloth Operations
@@ -3069,7 +3519,7 @@ bool UMcpAutomationBridgeSubsystem::HandleManageSkeleton(
     // Only handle manage_skeleton action
     if (Action != TEXT("manage_skeleton"))
     {
-        return true; // Not handled
+        return false; // Not handled
     }
 
     // Read subAction from payload (the actual operation to perform)
@@ -3203,6 +3653,10 @@ bool UMcpAutomationBridgeSubsystem::HandleManageSkeleton(
     {
         return HandlePruneWeights(RequestId, Payload, RequestingSocket);
     }
+    else if (SubAction == TEXT("upload_skin_data"))
+    {
+        return HandleUploadSkinData(RequestId, Payload, RequestingSocket);
+    }
     // Cloth operations
     else if (SubAction == TEXT("bind_cloth_to_skeletal_mesh"))
     {
@@ -19,9 +19,13 @@
 // Spline System includes
 #include "Components/SplineComponent.h"
 #include "Components/SplineMeshComponent.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
 #include "Engine/StaticMesh.h"
 #include "Materials/MaterialInterface.h"
 #include "GameFramework/Actor.h"
+#include "Async/ParallelFor.h"
+#include "Math/RandomStream.h"
+#include "McpPackedArray.h"
 #endif
 
 DEFINE_LOG_CATEGORY_STATIC(LogMcpSplineHandlers, Log, All);
@@ -174,6 +178,103 @@ static FString SplinePointTypeToString(ESplinePointType::Type Type)
     }
 }
 
+// Upper bounds for one request, so a typo in spacing or a runaway generator cannot stall the
+// editor for minutes.
+static constexpr int32 MaxSplinePointsPerRequest = 100000;
+static constexpr int32 MaxSplineScatterInstances = 1000000;
+
+// Tag on the HISM components scatter_meshes_along_spline owns, one per mesh.
+static const FName McpSplineScatterTag(TEXT("McpSplineScatter"));
+
+// Helper to read a list of 3-vectors: a flat number array [x,y,z,...], an array of [x,y,z]
+// arrays or {x,y,z} objects ({pitch,yaw,roll} with bRotator), or an FMcpPackedArray f64x3/f32x3
+// block. An absent field leaves OutVectors empty.
+static bool ReadSplineVectorArray(const TSharedPtr<FJsonObject>& Payload, const TCHAR* FieldName, bool bRotator,
+    TArray<FVector>& OutVectors, FString& OutError)
+{
+    OutVectors.Reset();
+    const TSharedPtr<FJsonValue> Field = Payload.IsValid() ? Payload->TryGetField(FieldName) : nullptr;
+    if (!Field.IsValid() || Field->IsNull())
+    {
+        return true;
+    }
+
+    if (FMcpPackedArray::IsPackedValue(Field))
+    {
+        const TSharedPtr<FJsonObject> Packed = Field->AsObject();
+        FString Layout = TEXT("f64x3");
+        Packed->TryGetStringField(TEXT("layout"), Layout);
+        Layout = Layout.ToLower();
+        if (Layout != TEXT("f64x3") && Layout != TEXT("f32x3"))
+        {
+            OutError = FString::Printf(TEXT("%s packed layout must be f64x3 or f32x3 (got '%s')"), FieldName, *Layout);
+            return false;
+        }
+        const bool bDouble = Layout == TEXT("f64x3");
+        TArray<uint8> Bytes;
+        int32 Count = 0;
+        if (!FMcpPackedArray::DecodeRaw(*Packed, 3 * (bDouble ? sizeof(double) : sizeof(float)), Bytes, Count, OutError))
+        {
+            return false;
+        }
+        OutVectors.SetNumUninitialized(Count);
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            OutVectors[Index] = bDouble
+                ? FVector(reinterpret_cast<const double*>(Bytes.GetData())[Index * 3],
+                          reinterpret_cast<const double*>(Bytes.GetData())[Index * 3 + 1],
+                          reinterpret_cast<const double*>(Bytes.GetData())[Index * 3 + 2])
+                : FVector(reinterpret_cast<const float*>(Bytes.GetData())[Index * 3],
+                          reinterpret_cast<const float*>(Bytes.GetData())[Index * 3 + 1],
+                          reinterpret_cast<const float*>(Bytes.GetData())[Index * 3 + 2]);
+        }
+        return true;
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* Values = nullptr;
+    if (!Field->TryGetArray(Values) || !Values)
+    {
+        OutError = FString::Printf(TEXT("%s must be an array or a packed block"), FieldName);
+        return false;
+    }
+    if (Values->Num() > 0 && (*Values)[0].IsValid() && (*Values)[0]->Type == EJson::Number)
+    {
+        if (Values->Num() % 3 != 0)
+        {
+            OutError = FString::Printf(TEXT("%s must hold three numbers per point (got %d)"), FieldName, Values->Num());
+            return false;
+        }
+        OutVectors.Reserve(Values->Num() / 3);
+        for (int32 Index = 0; Index < Values->Num(); Index += 3)
+        {
+            OutVectors.Add(FVector((*Values)[Index]->AsNumber(), (*Values)[Index + 1]->AsNumber(), (*Values)[Index + 2]->AsNumber()));
+        }
+        return true;
+    }
+    OutVectors.Reserve(Values->Num());
+    for (const TSharedPtr<FJsonValue>& Value : *Values)
+    {
+        const TArray<TSharedPtr<FJsonValue>>* Triple = nullptr;
+        const TSharedPtr<FJsonObject>* Obj = nullptr;
+        if (Value.IsValid() && Value->TryGetArray(Triple) && Triple && Triple->Num() == 3)
+        {
+            OutVectors.Add(FVector((*Triple)[0]->AsNumber(), (*Triple)[1]->AsNumber(), (*Triple)[2]->AsNumber()));
+        }
+        else if (Value.IsValid() && Value->TryGetObject(Obj) && Obj->IsValid())
+        {
+            OutVectors.Add(bRotator
+                ? FVector(GetJsonNumberFieldSpline(*Obj, TEXT("pitch")), GetJsonNumberFieldSpline(*Obj, TEXT("yaw")), GetJsonNumberFieldSpline(*Obj, TEXT("roll")))
+                : FVector(GetJsonNumberFieldSpline(*Obj, TEXT("x")), GetJsonNumberFieldSpline(*Obj, TEXT("y")), GetJsonNumberFieldSpline(*Obj, TEXT("z"))));
+        }
+        else
+        {
+            OutError = FString::Printf(TEXT("%s entries must be numbers, [x,y,z] arrays or objects"), FieldName);
+            return false;
+        }
+    }
+    return true;
+}
+
 // ============================================================================
 // Spline Creation Handlers
 // ============================================================================
@@ -351,6 +452,211 @@ static bool HandleAddSplinePoint(
     return true;
 }
 
+// Replaces (or with append, extends) the spline's points from packed arrays in one call:
+// positions, plus optional arriveTangents/leaveTangents (or tangents for both), rotations
+// (pitch, yaw, roll) and scales, one entry per point, or the schema's points objects. The
+// points are built in parallel and added with a single UpdateSpline, instead of one
+// reparameterization per point.
+static bool HandleSetSplinePoints(
+    UMcpAutomationBridgeSubsystem* Self,
+    const FString& RequestId,
+    const TSharedPtr<FJsonObject>& Payload,
+    TSharedPtr<FMcpBridgeWebSocket> Socket)
+{
+    FString ActorName = GetJsonStringFieldSpline(Payload, TEXT("actorName"));
+    FString ComponentName = GetJsonStringFieldSpline(Payload, TEXT("componentName"));
+    FString PointType = GetJsonStringFieldSpline(Payload, TEXT("pointType"), TEXT("Curve"));
+    bool bAppend = GetJsonBoolFieldSpline(Payload, TEXT("append"), false);
+    bool bWorldSpace = GetJsonStringFieldSpline(Payload, TEXT("coordinateSpace"), TEXT("Local")).Equals(TEXT("World"), ESearchCase::IgnoreCase);
+
+    if (ActorName.IsEmpty())
+    {
+        Self->SendAutomationResponse(Socket, RequestId, false,
+            TEXT("actorName is required"), nullptr, TEXT("MISSING_PARAM"));
+        return true;
+    }
+
+    FString Error;
+    TArray<FVector> Positions;
+    TArray<FVector> ArriveTangents;
+    TArray<FVector> LeaveTangents;
+    TArray<FVector> Rotations;
+    TArray<FVector> Scales;
+    if (!ReadSplineVectorArray(Payload, TEXT("positions"), false, Positions, Error) ||
+        !ReadSplineVectorArray(Payload, TEXT("arriveTangents"), false, ArriveTangents, Error) ||
+        !ReadSplineVectorArray(Payload, TEXT("leaveTangents"), false, LeaveTangents, Error) ||
+        !ReadSplineVectorArray(Payload, TEXT("rotations"), true, Rotations, Error) ||
+        !ReadSplineVectorArray(Payload, TEXT("scales"), false, Scales, Error))
+    {
+        Self->SendAutomationResponse(Socket, RequestId, false, Error, nullptr, TEXT("INVALID_PARAM"));
+        return true;
+    }
+    if (ArriveTangents.Num() == 0 && LeaveTangents.Num() == 0)
+    {
+        if (!ReadSplineVectorArray(Payload, TEXT("tangents"), false, ArriveTangents, Error))
+        {
+            Self->SendAutomationResponse(Socket, RequestId, false, Error, nullptr, TEXT("INVALID_PARAM"));
+            return true;
+        }
+        LeaveTangents = ArriveTangents;
+    }
+
+    // Without packed channels, take the schema's points: [{ position, arriveTangent?, leaveTangent?, rotation?, scale? }]
+    const TArray<TSharedPtr<FJsonValue>>* PointsArray = nullptr;
+    if (Positions.Num() == 0 && Payload->TryGetArrayField(TEXT("points"), PointsArray) && PointsArray)
+    {
+        for (const TSharedPtr<FJsonValue>& Value : *PointsArray)
+        {
+            const TSharedPtr<FJsonObject>* PointObj = nullptr;
+            if (!Value.IsValid() || !Value->TryGetObject(PointObj) || !PointObj->IsValid())
+            {
+                continue;
+            }
+            Positions.Add(GetJsonVectorFieldSpline(*PointObj, TEXT("position")));
+            if ((*PointObj)->HasField(TEXT("arriveTangent")) || (*PointObj)->HasField(TEXT("leaveTangent")))
+            {
+                ArriveTangents.SetNumZeroed(Positions.Num() - 1);
+                LeaveTangents.SetNumZeroed(Positions.Num() - 1);
+                ArriveTangents.Add(GetJsonVectorFieldSpline(*PointObj, TEXT("arriveTangent")));
+                LeaveTangents.Add(GetJsonVectorFieldSpline(*PointObj, TEXT("leaveTangent")));
+            }
+            if ((*PointObj)->HasField(TEXT("rotation")))
+            {
+                const FRotator Rotation = GetJsonRotatorFieldSpline(*PointObj, TEXT("rotation"));
+                Rotations.SetNumZeroed(Positions.Num() - 1);
+                Rotations.Add(FVector(Rotation.Pitch, Rotation.Yaw, Rotation.Roll));
+            }
+            if ((*PointObj)->HasField(TEXT("scale")))
+            {
+                while (Scales.Num() < Positions.Num() - 1)
+                {
+                    Scales.Add(FVector::OneVector);
+                }
+                Scales.Add(GetJsonVectorFieldSpline(*PointObj, TEXT("scale"), FVector::OneVector));
+            }
+        }
+        // Points that left out a channel another point set get its default
+        for (TArray<FVector>* Channel : { &ArriveTangents, &LeaveTangents, &Rotations })
+        {
+            if (Channel->Num() > 0)
+            {
+                Channel->SetNumZeroed(Positions.Num());
+            }
+        }
+        if (Scales.Num() > 0)
+        {
+            while (Scales.Num() < Positions.Num())
+            {
+                Scales.Add(FVector::OneVector);
+            }
+        }
+    }
+
+    const int32 NumPoints = Positions.Num();
+    if (NumPoints == 0 || NumPoints > MaxSplinePointsPerRequest)
+    {
+        Self->SendAutomationResponse(Socket, RequestId, false,
+            FString::Printf(TEXT("positions must hold between 1 and %d points (got %d)"), MaxSplinePointsPerRequest, NumPoints),
+            nullptr, TEXT("INVALID_PARAM"));
+        return true;
+    }
+    const bool bHasTangents = ArriveTangents.Num() > 0 || LeaveTangents.Num() > 0;
+    if ((bHasTangents && (ArriveTangents.Num() != NumPoints || LeaveTangents.Num() != NumPoints)) ||
+        (Rotations.Num() > 0 && Rotations.Num() != NumPoints) ||
+        (Scales.Num() > 0 && Scales.Num() != NumPoints))
+    {
+        Self->SendAutomationResponse(Socket, RequestId, false,
+            FString::Printf(TEXT("Every point array must have %d entries like positions (arrive and leave tangents go together)"), NumPoints),
+            nullptr, TEXT("INVALID_PARAM"));
+        return true;
+    }
+
+    UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+    if (!World)
+    {
+        Self->SendAutomationResponse(Socket, RequestId, false,
+            TEXT("No editor world available"), nullptr, TEXT("NO_WORLD"));
+        return true;
+    }
+
+    AActor* Actor = FindActorByName(World, ActorName);
+    if (!Actor)
+    {
+        Self->SendAutomationResponse(Socket, RequestId, false,
+            FString::Printf(TEXT("Actor not found: %s"), *ActorName), nullptr, TEXT("NOT_FOUND"));
+        return true;
+    }
+
+    USplineComponent* SplineComp = FindSplineComponent(Actor, ComponentName);
+    if (!SplineComp)
+    {
+        Self->SendAutomationResponse(Socket, RequestId, false,
+            TEXT("No spline component found on actor"), nullptr, TEXT("NO_SPLINE"));
+        return true;
+    }
+
+    // Points carry explicit tangents when any were given; otherwise the spline computes them.
+    const ESplinePointType::Type Type = bHasTangents ? ESplinePointType::CurveCustomTangent : ParseSplinePointType(PointType);
+    const FTransform ComponentToWorld = SplineComp->GetComponentTransform();
+    const int32 FirstKey = bAppend ? SplineComp->GetNumberOfSplinePoints() : 0;
+    TArray<FSplinePoint> Points;
+    Points.SetNum(NumPoints);
+    ParallelFor(NumPoints, [&](int32 Index)
+    {
+        FSplinePoint& Point = Points[Index];
+        Point.InputKey = static_cast<float>(FirstKey + Index);
+        Point.Position = bWorldSpace ? ComponentToWorld.InverseTransformPosition(Positions[Index]) : Positions[Index];
+        if (bHasTangents)
+        {
+            Point.ArriveTangent = bWorldSpace ? ComponentToWorld.InverseTransformVector(ArriveTangents[Index]) : ArriveTangents[Index];
+            Point.LeaveTangent = bWorldSpace ? ComponentToWorld.InverseTransformVector(LeaveTangents[Index]) : LeaveTangents[Index];
+        }
+        else
+        {
+            Point.ArriveTangent = FVector::ZeroVector;
+            Point.LeaveTangent = FVector::ZeroVector;
+        }
+        if (Rotations.Num() > 0)
+        {
+            const FRotator Rotation(Rotations[Index].X, Rotations[Index].Y, Rotations[Index].Z);
+            Point.Rotation = bWorldSpace ? ComponentToWorld.InverseTransformRotation(Rotation.Quaternion()).Rotator() : Rotation;
+        }
+        else
+        {
+            Point.Rotation = FRotator::ZeroRotator;
+        }
+        Point.Scale = Scales.Num() > 0 ? Scales[Index] : FVector::OneVector;
+        Point.Type = Type;
+    });
+
+    SplineComp->Modify();
+    if (!bAppend)
+    {
+        SplineComp->ClearSplinePoints(false);
+    }
+    SplineComp->AddPoints(Points, false);
+    if (Payload->HasField(TEXT("bClosedLoop")))
+    {
+        SplineComp->SetClosedLoop(GetJsonBoolFieldSpline(Payload, TEXT("bClosedLoop")), false);
+    }
+    SplineComp->UpdateSpline();
+
+    World->MarkPackageDirty();
+
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetNumberField(TEXT("pointsSet"), NumPoints);
+    Result->SetNumberField(TEXT("totalPoints"), SplineComp->GetNumberOfSplinePoints());
+    Result->SetNumberField(TEXT("splineLength"), SplineComp->GetSplineLength());
+    Result->SetBoolField(TEXT("appended"), bAppend);
+
+    // Add verification data
+    AddActorVerification(Result, Actor);
+
+    Self->SendAutomationResponse(Socket, RequestId, true,
+        FString::Printf(TEXT("Set %d spline points (%d total)"), NumPoints, SplineComp->GetNumberOfSplinePoints()), Result);
+    return true;
+}
+
 static bool HandleRemoveSplinePoint(
     UMcpAutomationBridgeSubsystem* Self,
     const FString& RequestId,
@@ -1288,6 +1594,12 @@ static bool HandleCreateSplineMeshActor(
 // Mesh Scattering Handlers
 // ============================================================================
 
+// Scatters meshPath (or meshPaths, cycled per instance) every spacing units along the spline.
+// Instance transforms are computed in parallel, with the configure_mesh_spacing and
+// configure_mesh_randomization options seeded per instance so a re-run is reproducible, and
+// emitted into one hierarchical instanced mesh component per mesh rather than a component per
+// instance. A re-run replaces the instances of a previous scatter of the same mesh unless
+// clearExisting is false.
 static bool HandleScatterMeshesAlongSpline(
     UMcpAutomationBridgeSubsystem* Self,
     const FString& RequestId,
@@ -1295,18 +1607,37 @@ static bool HandleScatterMeshesAlongSpline(
     TSharedPtr<FMcpBridgeWebSocket> Socket)
 {
     FString ActorName = GetJsonStringFieldSpline(Payload, TEXT("actorName"));
-    FString MeshPath = GetJsonStringFieldSpline(Payload, TEXT("meshPath"));
+    FString ComponentName = GetJsonStringFieldSpline(Payload, TEXT("componentName"));
     double Spacing = GetJsonNumberFieldSpline(Payload, TEXT("spacing"), 100.0);
-    bool bAlignToSpline = GetJsonBoolFieldSpline(Payload, TEXT("alignToSpline"), true);
-
-    // Sanitize mesh path
-    FString SafeMeshPath = SanitizeProjectRelativePath(MeshPath);
-    if (SafeMeshPath.IsEmpty())
+    double StartOffset = GetJsonNumberFieldSpline(Payload, TEXT("startOffset"), 0.0);
+    bool bAlignToSpline = GetJsonBoolFieldSpline(Payload, TEXT("alignToSpline"), GetJsonBoolFieldSpline(Payload, TEXT("bAlignToSpline"), true));
+    bool bClearExisting = GetJsonBoolFieldSpline(Payload, TEXT("clearExisting"), true);
+    bool bUseRandomOffset = GetJsonBoolFieldSpline(Payload, TEXT("useRandomOffset"), false);
+    double RandomOffsetRange = GetJsonNumberFieldSpline(Payload, TEXT("randomOffsetRange"), 0.0);
+    // The configure_mesh_randomization names, falling back to the tool schema's b-prefixed ones
+    bool bRandomizeScale = GetJsonBoolFieldSpline(Payload, TEXT("randomizeScale"), GetJsonBoolFieldSpline(Payload, TEXT("bRandomizeScale"), false));
+    double MinScale = GetJsonNumberFieldSpline(Payload, TEXT("minScale"), GetJsonNumberFieldSpline(Payload, TEXT("scaleMin"), 0.8));
+    double MaxScale = GetJsonNumberFieldSpline(Payload, TEXT("maxScale"), GetJsonNumberFieldSpline(Payload, TEXT("scaleMax"), 1.2));
+    bool bRandomizeRotation = GetJsonBoolFieldSpline(Payload, TEXT("randomizeRotation"), GetJsonBoolFieldSpline(Payload, TEXT("bRandomizeRotation"), false));
+    double RotationRange = GetJsonNumberFieldSpline(Payload, TEXT("rotationRange"), 360.0);
+    int32 Seed = GetJsonIntFieldSpline(Payload, TEXT("seed"), GetJsonIntFieldSpline(Payload, TEXT("randomSeed"), 0));
+
+    TArray<FString> MeshPaths;
+    const TArray<TSharedPtr<FJsonValue>>* MeshPathValues = nullptr;
+    if (Payload->TryGetArrayField(TEXT("meshPaths"), MeshPathValues) && MeshPathValues)
+    {
+        for (const TSharedPtr<FJsonValue>& Value : *MeshPathValues)
+        {
+            FString Path;
+            if (Value.IsValid() && Value->TryGetString(Path) && !Path.IsEmpty())
+            {
+                MeshPaths.Add(Path);
+            }
+        }
+    }
+    if (MeshPaths.Num() == 0)
     {
-        Self->SendAutomationResponse(Socket, RequestId, false,
-            FString::Printf(TEXT("Invalid or unsafe meshPath: %s. Path must be relative to project (e.g., /Game/...)"), *MeshPath),
-            nullptr, TEXT("SECURITY_VIOLATION"));
-        return true;
+        MeshPaths.Add(GetJsonStringFieldSpline(Payload, TEXT("meshPath")));
     }
 
     // Validate spacing to prevent division by zero
@@ -1317,6 +1648,28 @@ static bool HandleScatterMeshesAlongSpline(
         return true;
     }
 
+    // Sanitize and load every mesh before the actor is touched
+    TArray<UStaticMesh*> Meshes;
+    for (const FString& MeshPath : MeshPaths)
+    {
+        FString SafeMeshPath = SanitizeProjectRelativePath(MeshPath);
+        if (SafeMeshPath.IsEmpty())
+        {
+            Self->SendAutomationResponse(Socket, RequestId, false,
+                FString::Printf(TEXT("Invalid or unsafe meshPath: %s. Path must be relative to project (e.g., /Game/...)"), *MeshPath),
+                nullptr, TEXT("SECURITY_VIOLATION"));
+            return true;
+        }
+        UStaticMesh* Mesh = LoadObject<UStaticMesh>(nullptr, *SafeMeshPath);
+        if (!Mesh)
+        {
+            Self->SendAutomationResponse(Socket, RequestId, false,
+                FString::Printf(TEXT("Mesh not found: %s"), *SafeMeshPath), nullptr, TEXT("MESH_NOT_FOUND"));
+            return true;
+        }
+        Meshes.Add(Mesh);
+    }
+
     UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
     if (!World)
     {
@@ -1333,7 +1686,7 @@ static bool HandleScatterMeshesAlongSpline(
         return true;
     }
 
-    USplineComponent* SplineComp = FindSplineComponent(Actor);
+    USplineComponent* SplineComp = FindSplineComponent(Actor, ComponentName);
     if (!SplineComp)
     {
         Self->SendAutomationResponse(Socket, RequestId, false,
@@ -1341,44 +1694,117 @@ static bool HandleScatterMeshesAlongSpline(
         return true;
     }
 
-    UStaticMesh* Mesh = LoadObject<UStaticMesh>(nullptr, *SafeMeshPath);
-    if (!Mesh)
+    const double SplineLength = SplineComp->GetSplineLength();
+    StartOffset = FMath::Clamp(StartOffset, 0.0, SplineLength);
+    const int64 InstanceCount64 = FMath::FloorToInt64((SplineLength - StartOffset) / Spacing) + 1;
+    if (InstanceCount64 > MaxSplineScatterInstances)
     {
         Self->SendAutomationResponse(Socket, RequestId, false,
-            FString::Printf(TEXT("Mesh not found: %s"), *SafeMeshPath), nullptr, TEXT("MESH_NOT_FOUND"));
+            FString::Printf(TEXT("spacing %.2f would scatter %lld instances along %.0f units (max %d)"),
+                Spacing, InstanceCount64, SplineLength, MaxSplineScatterInstances),
+            nullptr, TEXT("INVALID_PARAM"));
         return true;
     }
+    const int32 InstanceCount = static_cast<int32>(InstanceCount64);
+    if (MinScale > MaxScale)
+    {
+        Swap(MinScale, MaxScale);
+    }
 
-    float SplineLength = SplineComp->GetSplineLength();
-    int32 MeshCount = FMath::FloorToInt(SplineLength / Spacing);
-    
-    TArray<FString> CreatedMeshes;
-
-    for (int32 i = 0; i <= MeshCount; i++)
+    // Sampling the spline only reads its curves, so every instance is computed independently
+    TArray<FTransform> Transforms;
+    Transforms.SetNum(InstanceCount);
+    ParallelFor(InstanceCount, [&](int32 Index)
     {
-        float Distance = i * Spacing;
+        const float Distance = static_cast<float>(StartOffset + Index * Spacing);
+        FRandomStream Stream(static_cast<int32>(HashCombine(GetTypeHash(Seed), GetTypeHash(Index))));
         FVector Location = SplineComp->GetLocationAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World);
-        FRotator Rotation = bAlignToSpline 
+        FRotator Rotation = bAlignToSpline
             ? SplineComp->GetRotationAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World)
             : FRotator::ZeroRotator;
+        if (bUseRandomOffset && RandomOffsetRange > 0.0)
+        {
+            Location += SplineComp->GetRightVectorAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World) *
+                Stream.FRandRange(static_cast<float>(-RandomOffsetRange), static_cast<float>(RandomOffsetRange));
+        }
+        if (bRandomizeRotation)
+        {
+            Rotation.Yaw += Stream.FRandRange(static_cast<float>(-0.5 * RotationRange), static_cast<float>(0.5 * RotationRange));
+        }
+        const double Scale = bRandomizeScale ? Stream.FRandRange(static_cast<float>(MinScale), static_cast<float>(MaxScale)) : 1.0;
+        Transforms[Index] = FTransform(Rotation, Location, FVector(Scale));
+    });
+
+    TArray<TArray<FTransform>> TransformsPerMesh;
+    TransformsPerMesh.SetNum(Meshes.Num());
+    for (int32 Index = 0; Index < InstanceCount; ++Index)
+    {
+        TransformsPerMesh[Index % Meshes.Num()].Add(Transforms[Index]);
+    }
 
-        // Create a static mesh component for each instance
-        UStaticMeshComponent* MeshComp = NewObject<UStaticMeshComponent>(Actor);
-        if (MeshComp)
+    TArray<UHierarchicalInstancedStaticMeshComponent*> ExistingScatter;
+    Actor->GetComponents<UHierarchicalInstancedStaticMeshComponent>(ExistingScatter);
+    ExistingScatter.RemoveAll([](const UHierarchicalInstancedStaticMeshComponent* Comp)
+    {
+        return !Comp->ComponentHasTag(McpSplineScatterTag);
+    });
+
+    Actor->Modify();
+    TArray<TSharedPtr<FJsonValue>> ComponentsJson;
+    int32 InstancesCreated = 0;
+    for (int32 MeshIndex = 0; MeshIndex < Meshes.Num(); ++MeshIndex)
+    {
+        if (TransformsPerMesh[MeshIndex].Num() == 0)
         {
-            MeshComp->SetStaticMesh(Mesh);
-            MeshComp->SetWorldLocationAndRotation(Location, Rotation);
-            MeshComp->RegisterComponent();
-            Actor->AddInstanceComponent(MeshComp);
-            MeshComp->AttachToComponent(SplineComp, FAttachmentTransformRules::KeepWorldTransform);
-            CreatedMeshes.Add(MeshComp->GetName());
+            continue;
+        }
+        UStaticMesh* Mesh = Meshes[MeshIndex];
+        UHierarchicalInstancedStaticMeshComponent* const* Found = ExistingScatter.FindByPredicate(
+            [Mesh, SplineComp](const UHierarchicalInstancedStaticMeshComponent* Comp)
+            {
+                return Comp->GetStaticMesh() == Mesh && Comp->GetAttachParent() == SplineComp;
+            });
+        UHierarchicalInstancedStaticMeshComponent* HISM = Found ? *Found : nullptr;
+        if (HISM)
+        {
+            HISM->Modify();
+            if (bClearExisting)
+            {
+                HISM->ClearInstances();
+            }
         }
+        else
+        {
+            HISM = NewObject<UHierarchicalInstancedStaticMeshComponent>(
+                Actor, UHierarchicalInstancedStaticMeshComponent::StaticClass(),
+                MakeUniqueObjectName(Actor, UHierarchicalInstancedStaticMeshComponent::StaticClass(),
+                    FName(*FString::Printf(TEXT("SplineScatter_%s"), *Mesh->GetName()))),
+                RF_Transactional);
+            HISM->ComponentTags.Add(McpSplineScatterTag);
+            HISM->SetStaticMesh(Mesh);
+            HISM->SetMobility(SplineComp->Mobility);
+            HISM->SetupAttachment(SplineComp);
+            Actor->AddInstanceComponent(HISM);
+            HISM->RegisterComponent();
+            ExistingScatter.Add(HISM);
+        }
+        HISM->AddInstances(TransformsPerMesh[MeshIndex], false, true);
+        InstancesCreated += TransformsPerMesh[MeshIndex].Num();
+
+        TSharedPtr<FJsonObject> ComponentJson = MakeShared<FJsonObject>();
+        ComponentJson->SetStringField(TEXT("componentName"), HISM->GetName());
+        ComponentJson->SetStringField(TEXT("meshPath"), Mesh->GetPathName());
+        ComponentJson->SetNumberField(TEXT("instanceCount"), HISM->GetInstanceCount());
+        ComponentsJson.Add(MakeShared<FJsonValueObject>(ComponentJson));
     }
 
     World->MarkPackageDirty();
 
     TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-    Result->SetNumberField(TEXT("meshesCreated"), CreatedMeshes.Num());
+    Result->SetNumberField(TEXT("instancesCreated"), InstancesCreated);
+    // Kept for callers written against the per-component scatter
+    Result->SetNumberField(TEXT("meshesCreated"), InstancesCreated);
+    Result->SetArrayField(TEXT("components"), ComponentsJson);
     Result->SetNumberField(TEXT("splineLength"), SplineLength);
     Result->SetNumberField(TEXT("spacing"), Spacing);
 
@@ -1386,7 +1812,7 @@ static bool HandleScatterMeshesAlongSpline(
     AddActorVerification(Result, Actor);
 
     Self->SendAutomationResponse(Socket, RequestId, true,
-        FString::Printf(TEXT("Scattered %d meshes along spline"), CreatedMeshes.Num()), Result);
+        FString::Printf(TEXT("Scattered %d instances along spline into %d instanced components"), InstancesCreated, ComponentsJson.Num()), Result);
     return true;
 }
 
@@ -1689,6 +2115,8 @@ bool UMcpAutomationBridgeSubsystem::HandleManageSplinesAction(
         return HandleCreateSplineActor(this, RequestId, Payload, Socket);
     if (SubAction == TEXT("add_spline_point"))
         return HandleAddSplinePoint(this, RequestId, Payload, Socket);
+    if (SubAction == TEXT("set_spline_points"))
+        return HandleSetSplinePoints(this, RequestId, Payload, Socket);
     if (SubAction == TEXT("remove_spline_point"))
         return HandleRemoveSplinePoint(this, RequestId, Payload, Socket);
     if (SubAction == TEXT("set_spline_point_position"))
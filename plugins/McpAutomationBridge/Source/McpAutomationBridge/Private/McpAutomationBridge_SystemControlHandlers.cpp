@@ -4,6 +4,7 @@
 #include "McpAutomationBridgeSubsystem.h"
 
 #if WITH_EDITOR
+#include "Containers/Ticker.h"
 #include "Editor/UnrealEd/Public/Editor.h"
 #include "HAL/FileManager.h"
 #include "HAL/PlatformFileManager.h"
@@ -29,6 +30,219 @@
 #include "EditorUtilityObject.h"
 #endif
 
+#if WITH_EDITOR
+namespace {
+// Per-command output kept in a console_batch result; the combined "output"
+// keeps the 64 KB cap execute_script has always applied.
+constexpr int32 MaxConsoleCommandOutputChars = 16 * 1024;
+constexpr int32 MaxConsoleBatchOutputChars = 64 * 1024;
+
+// Output of one console_batch command: what Exec writes to its output device
+// plus what is logged while it runs.
+class FMcpConsoleCommandOutput : public FOutputDevice {
+public:
+  FString Text;
+  int32 Warnings = 0;
+  int32 Errors = 0;
+  bool bTruncated = false;
+
+  virtual void Serialize(const TCHAR *V, ELogVerbosity::Type Verbosity,
+                         const FName &Category) override {
+    if (!V) {
+      return;
+    }
+    const ELogVerbosity::Type Level = static_cast<ELogVerbosity::Type>(
+        Verbosity & ELogVerbosity::VerbosityMask);
+    if (Level == ELogVerbosity::Error || Level == ELogVerbosity::Fatal) {
+      ++Errors;
+    } else if (Level == ELogVerbosity::Warning) {
+      ++Warnings;
+    }
+    if (Text.Len() >= MaxConsoleCommandOutputChars) {
+      bTruncated = true;
+      return;
+    }
+    Text += V;
+    if (!Text.EndsWith(TEXT("\n"))) {
+      Text += TEXT("\n");
+    }
+  }
+};
+
+struct FMcpConsoleBatch {
+  TWeakObjectPtr<UMcpAutomationBridgeSubsystem> WeakSubsystem;
+  TSharedPtr<FMcpBridgeWebSocket> Socket;
+  FString RequestId;
+  /** 1-based script line and command text. */
+  TArray<TPair<int32, FString>> Commands;
+  int32 Next = 0;
+  int32 Failed = 0;
+  int32 Ticks = 0;
+  bool bStopOnError = false;
+  double StartSeconds = 0.0;
+  double TimeoutSeconds = 30.0;
+  FString Output;
+  /** Result object, open inside its "results" array until the batch ends. */
+  FMcpJsonUtf8Writer Result;
+};
+using FMcpConsoleBatchRef = TSharedRef<FMcpConsoleBatch>;
+
+// Runs commands until this frame's shared budget is spent (always at least
+// one), then reports progress; returns true while commands remain.
+bool TickConsoleBatch(const FMcpConsoleBatchRef &Batch) {
+  UMcpAutomationBridgeSubsystem *Subsystem = Batch->WeakSubsystem.Get();
+  if (!Subsystem) {
+    return false;
+  }
+
+  FString Error;
+  FString ErrorCode = TEXT("SCRIPT_EXECUTION_FAILED");
+  const double SliceStart = FPlatformTime::Seconds();
+  const double SliceBudget = Subsystem->GetFrameBudgetRemainingSeconds();
+  int32 RanThisTick = 0;
+  while (Batch->Next < Batch->Commands.Num()) {
+    const double NowSeconds = FPlatformTime::Seconds();
+    if (NowSeconds - Batch->StartSeconds > Batch->TimeoutSeconds) {
+      Error = FString::Printf(TEXT("Timeout after %d/%d commands (%.1fs)"),
+                              Batch->Next, Batch->Commands.Num(),
+                              Batch->TimeoutSeconds);
+      break;
+    }
+    if (RanThisTick > 0 && NowSeconds - SliceStart >= SliceBudget) {
+      break;
+    }
+    // A command may change maps, so the world is looked up per command.
+    UWorld *World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+    if (!GEngine || !World) {
+      Error = TEXT("Editor world context not available for console command "
+                   "execution");
+      break;
+    }
+
+    const TPair<int32, FString> &Command = Batch->Commands[Batch->Next++];
+    FMcpConsoleCommandOutput Capture;
+    GLog->AddOutputDevice(&Capture);
+    const double CommandStart = FPlatformTime::Seconds();
+    const bool bHandled = GEngine->Exec(World, *Command.Value, Capture);
+    const double CommandMs = (FPlatformTime::Seconds() - CommandStart) * 1000.0;
+    GLog->RemoveOutputDevice(&Capture);
+    ++RanThisTick;
+
+    FMcpJsonUtf8Writer &Result = Batch->Result;
+    Result.BeginObject();
+    Result.WriteInt(TEXT("line"), Command.Key);
+    Result.WriteString(TEXT("command"), Command.Value);
+    Result.WriteBool(TEXT("handled"), bHandled);
+    Result.WriteNumber(TEXT("durationMs"), CommandMs);
+    Result.WriteString(TEXT("output"), Capture.Text);
+    Result.WriteInt(TEXT("warnings"), Capture.Warnings);
+    Result.WriteInt(TEXT("errors"), Capture.Errors);
+    if (Capture.bTruncated) {
+      Result.WriteBool(TEXT("outputTruncated"), true);
+    }
+    Result.EndObject();
+
+    if (Batch->Output.Len() < MaxConsoleBatchOutputChars) {
+      Batch->Output += Capture.Text;
+    }
+    if (!bHandled) {
+      ++Batch->Failed;
+      if (Batch->bStopOnError) {
+        Error = FString::Printf(TEXT("Line %d: command not handled: %s"),
+                                Command.Key, *Command.Value);
+        break;
+      }
+    }
+  }
+  Subsystem->ChargeFrameBudget(FPlatformTime::Seconds() - SliceStart);
+  ++Batch->Ticks;
+
+  if (Error.IsEmpty() && Batch->Next < Batch->Commands.Num()) {
+    const float Percent =
+        100.0f * Batch->Next / FMath::Max(1, Batch->Commands.Num());
+    if (Subsystem->SendProgressUpdate(
+            Batch->RequestId, Percent,
+            FString::Printf(TEXT("%d/%d console commands"), Batch->Next,
+                            Batch->Commands.Num()))) {
+      return true;
+    }
+    Error = TEXT("console_batch cancelled by the client");
+    ErrorCode = TEXT("CANCELLED");
+  }
+
+  const double DurationMs =
+      (FPlatformTime::Seconds() - Batch->StartSeconds) * 1000.0;
+  if (Error.IsEmpty()) {
+    Batch->Output += FString::Printf(
+        TEXT("Executed %d console commands successfully.\n"), Batch->Next);
+  }
+  FMcpJsonUtf8Writer &Result = Batch->Result;
+  Result.EndArray();
+  Result.WriteInt(TEXT("total"), Batch->Commands.Num());
+  Result.WriteInt(TEXT("executed"), Batch->Next);
+  Result.WriteInt(TEXT("failed"), Batch->Failed);
+  Result.WriteInt(TEXT("ticks"), Batch->Ticks);
+  Result.WriteNumber(TEXT("duration_ms"), DurationMs);
+  Result.WriteString(TEXT("output"), Batch->Output);
+  if (!Error.IsEmpty()) {
+    Result.WriteString(TEXT("error"), Error);
+  }
+  Result.EndObject();
+
+  if (Error.IsEmpty()) {
+    Subsystem->SendAutomationResponse(
+        Batch->Socket, Batch->RequestId, true,
+        FString::Printf(TEXT("Script executed successfully (%.0fms)"),
+                        DurationMs),
+        MoveTemp(Result));
+  } else {
+    Subsystem->SendAutomationResponse(Batch->Socket, Batch->RequestId, false,
+                                      Error, MoveTemp(Result), ErrorCode);
+  }
+  return false;
+}
+
+// console_batch: one command per line ("//" and "#" lines are comments),
+// executed across ticks within the shared frame budget, each with its own
+// captured output and timing. The first slice runs immediately.
+void StartConsoleBatch(UMcpAutomationBridgeSubsystem *Subsystem,
+                       TSharedPtr<FMcpBridgeWebSocket> Socket,
+                       const FString &RequestId, const FString &ScriptName,
+                       const FString &ScriptContent, double TimeoutSeconds,
+                       bool bStopOnError) {
+  FMcpConsoleBatchRef Batch = MakeShared<FMcpConsoleBatch>();
+  Batch->WeakSubsystem = Subsystem;
+  Batch->Socket = Socket;
+  Batch->RequestId = RequestId;
+  Batch->StartSeconds = FPlatformTime::Seconds();
+  Batch->TimeoutSeconds = TimeoutSeconds;
+  Batch->bStopOnError = bStopOnError;
+
+  TArray<FString> Lines;
+  ScriptContent.ParseIntoArray(Lines, TEXT("\n"), /*InCullEmpty=*/false);
+  for (int32 Index = 0; Index < Lines.Num(); ++Index) {
+    FString Command = Lines[Index].TrimStartAndEnd();
+    if (Command.IsEmpty() || Command.StartsWith(TEXT("//")) ||
+        Command.StartsWith(TEXT("#"))) {
+      continue;
+    }
+    Batch->Commands.Emplace(Index + 1, MoveTemp(Command));
+  }
+
+  Batch->Result.BeginObject();
+  Batch->Result.WriteString(TEXT("scriptType"), TEXT("console_batch"));
+  Batch->Result.WriteString(TEXT("scriptName"), ScriptName);
+  Batch->Result.Key(TEXT("results"));
+  Batch->Result.BeginArray();
+
+  if (TickConsoleBatch(Batch)) {
+    FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+        [Batch](float) { return TickConsoleBatch(Batch); }));
+  }
+}
+} // namespace
+#endif
+
 bool UMcpAutomationBridgeSubsystem::HandleSystemControlAction(
     const FString &RequestId, const FString &Action,
     const TSharedPtr<FJsonObject> &Payload,
@@ -283,10 +497,20 @@ bool UMcpAutomationBridgeSubsystem::HandleSystemControlAction(
     
     for (int32 i = 1; i <= Steps; i++) {
       // Send progress update before each step
-      if (bSendProgress) {
+      bool bKeepGoing = !IsAutomationRequestCancelled(RequestId);
+      if (bKeepGoing && bSendProgress) {
         float Percent = (static_cast<float>(i) / static_cast<float>(Steps)) * 100.0f;
         FString StatusMsg = FString::Printf(TEXT("Step %d/%d"), i, Steps);
-        SendProgressUpdate(RequestId, Percent, StatusMsg, true);
+        bKeepGoing = SendProgressUpdate(RequestId, Percent, StatusMsg, true);
+      }
+      if (!bKeepGoing) {
+        TSharedPtr<FJsonObject> Partial = MakeShared<FJsonObject>();
+        Partial->SetNumberField(TEXT("steps"), Steps);
+        Partial->SetNumberField(TEXT("completedSteps"), i - 1);
+        SendAutomationResponse(RequestingSocket, RequestId, false,
+                               TEXT("Progress protocol test cancelled"),
+                               Partial, TEXT("CANCELLED"));
+        return true;
       }
       
       // Simulate work by sleeping
@@ -365,6 +589,16 @@ bool UMcpAutomationBridgeSubsystem::HandleSystemControlAction(
     const FString ScriptTypeLower = ScriptType.ToLower();
     const double StartTime = FPlatformTime::Seconds();
 
+    // Console batches run sliced across ticks and reply when done.
+    if (ScriptTypeLower == TEXT("console_batch"))
+    {
+      bool bStopOnError = false;
+      Payload->TryGetBoolField(TEXT("stop_on_error"), bStopOnError);
+      StartConsoleBatch(this, RequestingSocket, RequestId, ScriptName,
+                        ScriptContent, TimeoutSeconds, bStopOnError);
+      return true;
+    }
+
     // ---- Capture output log during script execution ----
     // We use a custom FOutputDevice to capture log messages
     class FMcpScriptOutputDevice : public FOutputDevice
@@ -433,51 +667,6 @@ bool UMcpAutomationBridgeSubsystem::HandleSystemControlAction(
         }
       }
     }
-    else if (ScriptTypeLower == TEXT("console_batch"))
-    {
-      // Execute multiple console commands separated by newlines
-      if (GEngine && GEditor && GEditor->GetEditorWorldContext().World())
-      {
-        TArray<FString> Commands;
-        ScriptContent.ParseIntoArrayLines(Commands);
-
-        int32 ExecutedCount = 0;
-        int32 FailedCount = 0;
-
-        for (const FString& Cmd : Commands)
-        {
-          FString TrimmedCmd = Cmd.TrimStartAndEnd();
-
-          // Skip empty lines and comments
-          if (TrimmedCmd.IsEmpty() || TrimmedCmd.StartsWith(TEXT("//")) || TrimmedCmd.StartsWith(TEXT("#")))
-          {
-            continue;
-          }
-
-          // Check timeout
-          if (FPlatformTime::Seconds() - StartTime > TimeoutSeconds)
-          {
-            ErrorMessage = FString::Printf(TEXT("Timeout after %d/%d commands (%.1fs)"),
-                                           ExecutedCount, Commands.Num(), TimeoutSeconds);
-            break;
-          }
-
-          GEngine->Exec(GEditor->GetEditorWorldContext().World(), *TrimmedCmd);
-          ExecutedCount++;
-        }
-
-        bSuccess = ErrorMessage.IsEmpty();
-        if (bSuccess)
-        {
-          OutputCapture.CapturedOutput += FString::Printf(
-            TEXT("Executed %d console commands successfully.\n"), ExecutedCount);
-        }
-      }
-      else
-      {
-        ErrorMessage = TEXT("Editor world context not available for console command execution");
-      }
-    }
     else if (ScriptTypeLower == TEXT("editor_utility"))
     {
       // Run an Editor Utility Blueprint/Widget by asset path
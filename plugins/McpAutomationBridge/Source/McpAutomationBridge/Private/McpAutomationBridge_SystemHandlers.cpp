@@ -10,8 +10,13 @@
 //        understand the plugin's capabilities before issuing commands.
 
 #include "McpAutomationBridgeSubsystem.h"
+#include "McpActorChangeFeed.h"
 #include "McpAutomationBridgeGlobals.h"
+#include "McpAutomationBridgeHelpers.h"
 #include "McpAutomationBridgeSettings.h"
+#include "McpConnectionManager.h"
+#include "McpDependencyGraph.h"
+#include "McpJsonUtf8Writer.h"
 #include "Misc/EngineVersion.h"
 
 // Plugin version - update this when releasing new versions
@@ -65,6 +70,8 @@ bool UMcpAutomationBridgeSubsystem::HandleDescribeCapabilities(
     Actions.Add(MakeShared<FJsonValueString>(TEXT("execute_editor_function")));
     Actions.Add(MakeShared<FJsonValueString>(TEXT("set_object_property")));
     Actions.Add(MakeShared<FJsonValueString>(TEXT("get_object_property")));
+    Actions.Add(MakeShared<FJsonValueString>(TEXT("get_properties_bulk")));
+    Actions.Add(MakeShared<FJsonValueString>(TEXT("set_properties_bulk")));
 
     // Containers
     Actions.Add(MakeShared<FJsonValueString>(TEXT("array_append")));
@@ -155,6 +162,10 @@ bool UMcpAutomationBridgeSubsystem::HandleDescribeCapabilities(
     Actions.Add(MakeShared<FJsonValueString>(TEXT("inspect")));
     Actions.Add(MakeShared<FJsonValueString>(TEXT("system_control")));
     Actions.Add(MakeShared<FJsonValueString>(TEXT("describe_capabilities")));
+    Actions.Add(MakeShared<FJsonValueString>(TEXT("get_bridge_metrics")));
+    Actions.Add(MakeShared<FJsonValueString>(TEXT("bridge_echo")));
+    Actions.Add(MakeShared<FJsonValueString>(TEXT("subscribe_events")));
+    Actions.Add(MakeShared<FJsonValueString>(TEXT("unsubscribe_events")));
 
     // Blueprint
     Actions.Add(MakeShared<FJsonValueString>(TEXT("manage_blueprint")));
@@ -219,6 +230,12 @@ bool UMcpAutomationBridgeSubsystem::HandleDescribeCapabilities(
     Actions.Add(MakeShared<FJsonValueString>(TEXT("manage_insights")));
     Actions.Add(MakeShared<FJsonValueString>(TEXT("manage_asset_query")));
 
+    // Envelopes
+    Actions.Add(MakeShared<FJsonValueString>(TEXT("batch")));
+    Actions.Add(MakeShared<FJsonValueString>(TEXT("blueprint_edit_session")));
+    Actions.Add(MakeShared<FJsonValueString>(TEXT("compile_blueprints")));
+    Actions.Add(MakeShared<FJsonValueString>(TEXT("material_edit_session")));
+
     Caps->SetArrayField(TEXT("supportedActions"), Actions);
 
     // Allowlisted paths (for CI security) - these are template patterns
@@ -268,3 +285,253 @@ bool UMcpAutomationBridgeSubsystem::HandleDescribeCapabilities(
     return true;
 #endif
 }
+
+bool UMcpAutomationBridgeSubsystem::HandleGetBridgeMetrics(
+    const FString& RequestId,
+    const FString& Action,
+    const TSharedPtr<FJsonObject>& Payload,
+    TSharedPtr<FMcpBridgeWebSocket> RequestingSocket)
+{
+    if (!Action.Equals(TEXT("get_bridge_metrics"), ESearchCase::IgnoreCase))
+    {
+        return false;
+    }
+
+    if (!ConnectionManager.IsValid())
+    {
+        SendAutomationError(RequestingSocket, RequestId,
+            TEXT("Connection manager is not available"), TEXT("NOT_AVAILABLE"));
+        return true;
+    }
+
+    // "reset": true starts a new window after this snapshot, so callers can
+    // sample the latency of a specific workload.
+    const bool bReset = GetJsonBoolField(Payload, TEXT("reset"));
+    TSharedPtr<FJsonObject> Metrics = ConnectionManager->GetMetricsSnapshot(bReset);
+    Metrics->SetObjectField(TEXT("assetPathCache"), FMcpAssetPathCache::GetStats(bReset));
+    Metrics->SetObjectField(TEXT("dependencyGraph"), FMcpDependencyGraph::GetStats(bReset));
+    Metrics->SetObjectField(TEXT("assetScans"), FMcpAssetScanQueue::GetStats(bReset));
+    Metrics->SetObjectField(TEXT("assetSaves"), FMcpAssetSaveQueue::GetStats(bReset));
+    Metrics->SetObjectField(TEXT("blueprintCompiles"), FMcpBlueprintCompileQueue::GetStats(bReset));
+    Metrics->SetObjectField(TEXT("materialCompiles"), FMcpMaterialCompileQueue::GetStats(bReset));
+    // Startup timing is fixed once the first request has built the dispatch
+    // tables, so "reset" leaves it alone.
+    Metrics->SetObjectField(TEXT("startup"), GetStartupTimingJson());
+    SendAutomationResponse(RequestingSocket, RequestId, true,
+        TEXT("Bridge metrics"), Metrics);
+    return true;
+}
+
+bool UMcpAutomationBridgeSubsystem::HandleBridgeEcho(
+    const FString& RequestId,
+    const FString& Action,
+    const TSharedPtr<FJsonObject>& Payload,
+    TSharedPtr<FMcpBridgeWebSocket> RequestingSocket)
+{
+    if (!Action.Equals(TEXT("bridge_echo"), ESearchCase::IgnoreCase))
+    {
+        return false;
+    }
+
+    // Does no work of its own, so timing it against the client measures the
+    // bridge: receive, parse, queue, dispatch, serialize and send. Requests
+    // are capped by the inbound message limit; "responseBytes" lets a small
+    // request ask for a large reply to measure the outbound path alone.
+    // "data" is expected to be ASCII, so its length is its size on the wire.
+    static constexpr int32 MaxEchoResponseBytes = 64 * 1024 * 1024;
+
+    const FString Data = GetJsonStringField(Payload, TEXT("data"));
+    int32 ResponseBytes = Data.Len();
+    if (Payload.IsValid() && Payload->HasField(TEXT("responseBytes")))
+    {
+        ResponseBytes = GetJsonIntField(Payload, TEXT("responseBytes"));
+        if (ResponseBytes < 0 || ResponseBytes > MaxEchoResponseBytes)
+        {
+            SendAutomationError(RequestingSocket, RequestId,
+                FString::Printf(TEXT("responseBytes must be between 0 and %d."), MaxEchoResponseBytes),
+                TEXT("INVALID_ARGUMENT"));
+            return true;
+        }
+    }
+
+    // "binary": true returns the bytes as an attachment instead of a JSON
+    // string. Attachments are staged per request on the game thread only.
+    const bool bBinary = GetJsonBoolField(Payload, TEXT("binary"));
+    if (bBinary && !IsInGameThread())
+    {
+        SendAutomationError(RequestingSocket, RequestId,
+            TEXT("binary echo is not available on the worker lane."), TEXT("INVALID_ARGUMENT"));
+        return true;
+    }
+
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetNumberField(TEXT("receivedBytes"), Data.Len());
+    Result->SetNumberField(TEXT("returnedBytes"), ResponseBytes);
+    Result->SetStringField(TEXT("thread"), IsInGameThread() ? TEXT("game") : TEXT("worker"));
+    if (bBinary)
+    {
+        TArray<uint8> Bytes;
+        Bytes.Init(static_cast<uint8>('x'), ResponseBytes);
+        AttachBinaryPayload(RequestId, MoveTemp(Bytes), TEXT("application/octet-stream"), TEXT("data"));
+    }
+    else if (ResponseBytes == Data.Len())
+    {
+        Result->SetStringField(TEXT("data"), Data);
+    }
+    else
+    {
+        Result->SetStringField(TEXT("data"), FString::ChrN(ResponseBytes, TEXT('x')));
+    }
+    SendAutomationResponse(RequestingSocket, RequestId, true, TEXT("echo"), Result);
+    return true;
+}
+
+bool UMcpAutomationBridgeSubsystem::HandleSubscribeEvents(
+    const FString& RequestId,
+    const FString& Action,
+    const TSharedPtr<FJsonObject>& Payload,
+    TSharedPtr<FMcpBridgeWebSocket> RequestingSocket)
+{
+    const bool bSubscribe = Action.Equals(TEXT("subscribe_events"), ESearchCase::IgnoreCase);
+    if (!bSubscribe && !Action.Equals(TEXT("unsubscribe_events"), ESearchCase::IgnoreCase))
+    {
+        return false;
+    }
+
+    if (!ConnectionManager.IsValid())
+    {
+        SendAutomationError(RequestingSocket, RequestId,
+            TEXT("Connection manager is not available"), TEXT("NOT_AVAILABLE"));
+        return true;
+    }
+    if (!RequestingSocket.IsValid())
+    {
+        SendAutomationError(RequestingSocket, RequestId,
+            TEXT("Event topics belong to a connection; this request has none."), TEXT("NO_CONNECTION"));
+        return true;
+    }
+
+    // "topics" lists what to add or remove; unsubscribe_events without it
+    // mutes the connection entirely.
+    const TArray<FString>& Available = FMcpConnectionManager::GetEventTopics();
+    TSet<FString> Requested;
+    const TArray<TSharedPtr<FJsonValue>>* TopicValues = nullptr;
+    const bool bHasTopics = Payload.IsValid() && Payload->TryGetArrayField(TEXT("topics"), TopicValues);
+    if (bHasTopics)
+    {
+        for (const TSharedPtr<FJsonValue>& Value : *TopicValues)
+        {
+            FString Topic;
+            if (!Value.IsValid() || !Value->TryGetString(Topic) || !Available.Contains(Topic.ToLower()))
+            {
+                SendAutomationError(RequestingSocket, RequestId,
+                    FString::Printf(TEXT("Unknown event topic '%s' (expected %s)."), *Topic,
+                        *FString::Join(Available, TEXT(", "))),
+                    TEXT("INVALID_ARGUMENT"));
+                return true;
+            }
+            Requested.Add(Topic.ToLower());
+        }
+    }
+    if (bSubscribe && Requested.Num() == 0)
+    {
+        SendAutomationError(RequestingSocket, RequestId,
+            TEXT("topics must list at least one event topic."), TEXT("INVALID_ARGUMENT"));
+        return true;
+    }
+
+    TSet<FString> Topics = ConnectionManager->GetSubscribedTopics(RequestingSocket);
+    if (bSubscribe)
+    {
+        Topics.Append(Requested);
+    }
+    else if (!bHasTopics)
+    {
+        Topics.Reset();
+    }
+    else
+    {
+        for (const FString& Topic : Requested)
+        {
+            Topics.Remove(Topic);
+        }
+    }
+    ConnectionManager->SetSubscribedTopics(RequestingSocket, Topics);
+
+    // Start recording right away so nothing between this response and the
+    // next tick is missed.
+    if (Topics.Contains(TEXT("actors")) && !ActorChangeFeed.IsValid())
+    {
+        ActorChangeFeed = MakeShared<FMcpActorChangeFeed>();
+    }
+
+    FMcpJsonUtf8Writer Result;
+    Result.BeginObject();
+    Result.Key(TEXT("topics"));
+    Result.BeginArray();
+    for (const FString& Topic : Available)
+    {
+        if (Topics.Contains(Topic))
+        {
+            Result.String(Topic);
+        }
+    }
+    Result.EndArray();
+    Result.Key(TEXT("available"));
+    Result.BeginArray();
+    for (const FString& Topic : Available)
+    {
+        Result.String(Topic);
+    }
+    Result.EndArray();
+    // The baseline a scene mirror applies actor_changes batches on top of;
+    // batches with a higher seq than this one are newer.
+    bool bSnapshot = false;
+    if (bSubscribe && ActorChangeFeed.IsValid() && Topics.Contains(TEXT("actors")) &&
+        Payload->TryGetBoolField(TEXT("snapshot"), bSnapshot) && bSnapshot)
+    {
+        Result.Key(TEXT("scene"));
+        Result.BeginObject();
+        ActorChangeFeed->WriteSnapshot(Result);
+        Result.EndObject();
+    }
+    Result.EndObject();
+    SendAutomationResponse(RequestingSocket, RequestId, true,
+        bSubscribe ? TEXT("Subscribed to event topics") : TEXT("Unsubscribed from event topics"),
+        MoveTemp(Result));
+    return true;
+}
+
+void UMcpAutomationBridgeSubsystem::TickActorChangeFeed()
+{
+    // Hooked only while somebody listens, so editing without subscribers
+    // costs nothing.
+    if (!ConnectionManager.IsValid() || !ConnectionManager->HasTopicSubscribers(TEXT("actors")))
+    {
+        ActorChangeFeed.Reset();
+        return;
+    }
+    if (!ActorChangeFeed.IsValid())
+    {
+        ActorChangeFeed = MakeShared<FMcpActorChangeFeed>();
+        return;
+    }
+    // One batch per frame: a drag or a bulk spawn coalesces into it.
+    if (!ActorChangeFeed->HasPending())
+    {
+        return;
+    }
+
+    FMcpJsonUtf8Writer Writer;
+    Writer.BeginObject();
+    Writer.WriteString(TEXT("type"), TEXT("automation_event"));
+    Writer.WriteString(TEXT("event"), TEXT("actor_changes"));
+    Writer.Key(TEXT("payload"));
+    Writer.BeginObject();
+    ActorChangeFeed->WriteBatch(Writer);
+    Writer.EndObject();
+    Writer.EndObject();
+    // Not discardable: a lost batch would leave subscribers with a wrong
+    // picture of the level.
+    ConnectionManager->Publish(TEXT("actors"), TArray<uint8>(Writer.GetBuffer()), false);
+}
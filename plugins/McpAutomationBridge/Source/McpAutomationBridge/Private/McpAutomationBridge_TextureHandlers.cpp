@@ -22,6 +22,7 @@
 #include "Engine/TextureRenderTarget2D.h"
 #include "Kismet/KismetRenderingLibrary.h"
 #include "StaticMeshResources.h"
+#include "McpTextureKernels.h"
 
 // Helper macro for error responses
 #define TEXTURE_ERROR_RESPONSE(Msg) \
@@ -121,55 +122,363 @@ static UTexture2D* CreateEmptyTexture(const FString& PackagePath, const FString&
     return NewTexture;
 }
 
-// Simple Perlin noise implementation
-static float Noise2D(float X, float Y, int32 Seed)
+// Value noise (hashed lattice values, smoothstep-interpolated), evaluated a
+// row at a time: Out[i] += Amplitude * Noise(Xs[i] * Frequency, Ys[i] *
+// Frequency). The hash runs on uint32 so its wrap-around is well defined and
+// the loop carries no branches.
+static void AccumulateNoiseRow(const float* RESTRICT Xs, const float* RESTRICT Ys, int32 Count, float Frequency, int32 Seed, float Amplitude, float* RESTRICT Out)
 {
-    // Simple gradient noise approximation
-    int32 IntX = FMath::FloorToInt(X);
-    int32 IntY = FMath::FloorToInt(Y);
-    float FracX = X - IntX;
-    float FracY = Y - IntY;
-    
-    // Hash function
-    auto Hash = [Seed](int32 X, int32 Y) -> float {
-        int32 N = X + Y * 57 + Seed * 131;
+    const uint32 SeedTerm = static_cast<uint32>(Seed) * 131u;
+    auto Hash = [SeedTerm](int32 X, int32 Y) -> float
+    {
+        uint32 N = static_cast<uint32>(X) + static_cast<uint32>(Y) * 57u + SeedTerm;
         N = (N << 13) ^ N;
-        return (1.0f - ((N * (N * N * 15731 + 789221) + 1376312589) & 0x7fffffff) / 1073741824.0f);
+        return 1.0f - static_cast<float>((N * (N * N * 15731u + 789221u) + 1376312589u) & 0x7fffffffu) / 1073741824.0f;
     };
     
-    // Bilinear interpolation
-    float V00 = Hash(IntX, IntY);
-    float V10 = Hash(IntX + 1, IntY);
-    float V01 = Hash(IntX, IntY + 1);
-    float V11 = Hash(IntX + 1, IntY + 1);
+    for (int32 i = 0; i < Count; ++i)
+    {
+        const float X = Xs[i] * Frequency;
+        const float Y = Ys[i] * Frequency;
+        const int32 IntX = FMath::FloorToInt(X);
+        const int32 IntY = FMath::FloorToInt(Y);
+        const float FracX = X - IntX;
+        const float FracY = Y - IntY;
+        
+        const float V00 = Hash(IntX, IntY);
+        const float V10 = Hash(IntX + 1, IntY);
+        const float V01 = Hash(IntX, IntY + 1);
+        const float V11 = Hash(IntX + 1, IntY + 1);
+        
+        const float SmoothX = FracX * FracX * (3.0f - 2.0f * FracX);
+        const float SmoothY = FracY * FracY * (3.0f - 2.0f * FracY);
+        const float I0 = FMath::Lerp(V00, V10, SmoothX);
+        const float I1 = FMath::Lerp(V01, V11, SmoothX);
+        Out[i] += FMath::Lerp(I0, I1, SmoothY) * Amplitude;
+    }
+}
+
+// Generated textures are at most the largest size UE imports.
+static constexpr int32 MaxGeneratedTextureSize = 16384;
+
+static const TCHAR* const GeneratedTextureFormatNames[] = { TEXT("BGRA8"), TEXT("G8"), TEXT("G16"), TEXT("RGBA16F") };
+static constexpr int32 NumGeneratedTextureFormats = UE_ARRAY_COUNT(GeneratedTextureFormatNames);
+
+// "format" is BGRA8 (default), G8, G16 or RGBA16F; hdr=true, which predates
+// it, still selects RGBA16F.
+static bool ParseGeneratedTextureFormat(const TSharedPtr<FJsonObject>& Params, EMcpTextureFormat& OutFormat, FString& OutError)
+{
+    const FString Format = GetStringFieldTextAuth(Params, TEXT("format"), TEXT(""));
+    if (Format.IsEmpty())
+    {
+        OutFormat = GetBoolFieldTextAuth(Params, TEXT("hdr"), false) ? EMcpTextureFormat::RGBA16F : EMcpTextureFormat::BGRA8;
+    }
+    else
+    {
+        int32 Index = 0;
+        while (Index < NumGeneratedTextureFormats && !Format.Equals(GeneratedTextureFormatNames[Index], ESearchCase::IgnoreCase))
+        {
+            ++Index;
+        }
+        if (Index == NumGeneratedTextureFormats)
+        {
+            OutError = FString::Printf(TEXT("Unsupported format '%s' (BGRA8, G8, G16 or RGBA16F)"), *Format);
+            return false;
+        }
+        OutFormat = static_cast<EMcpTextureFormat>(Index);
+    }
+    return true;
+}
+
+// Re-initializes the source of Texture as Format, with a full mip chain when
+// bMips is set, fills mip 0 through EvalRow and box-filters each further mip
+// from the one above it, then rebuilds the texture once. Returns the number of
+// mips written, or 0 when the source could not be locked.
+static int32 FillGeneratedTexture(UTexture2D* Texture, int32 Width, int32 Height, EMcpTextureFormat Format, bool bMips, TFunctionRef<void(int32 Y, FLinearColor* OutRow)> EvalRow)
+{
+    static const ETextureSourceFormat SourceFormats[] = { TSF_BGRA8, TSF_G8, TSF_G16, TSF_RGBA16F };
+    const int32 NumMips = bMips ? FMath::FloorLog2(static_cast<uint32>(FMath::Max(Width, Height))) + 1 : 1;
     
-    // Smoothstep
-    float SmoothX = FracX * FracX * (3.0f - 2.0f * FracX);
-    float SmoothY = FracY * FracY * (3.0f - 2.0f * FracY);
+    // CRITICAL: Use PreEditChange/PostEditChange lifecycle for texture property modifications
+    Texture->PreEditChange(nullptr);
+    Texture->Source.Init(Width, Height, 1, NumMips, SourceFormats[static_cast<int32>(Format)]);
+    if (Format == EMcpTextureFormat::G8 || Format == EMcpTextureFormat::G16)
+    {
+        Texture->SRGB = false;
+        Texture->CompressionSettings = TC_Grayscale;
+    }
+    else if (Format == EMcpTextureFormat::RGBA16F)
+    {
+        Texture->SRGB = false;
+        Texture->CompressionSettings = TC_HDR;
+    }
+    if (bMips)
+    {
+        Texture->MipGenSettings = TMGS_LeaveExistingMips;
+    }
     
-    float I0 = FMath::Lerp(V00, V10, SmoothX);
-    float I1 = FMath::Lerp(V01, V11, SmoothX);
+    TArray<uint8*, TInlineAllocator<16>> MipData;
+    for (int32 Mip = 0; Mip < NumMips; ++Mip)
+    {
+        uint8* Data = Texture->Source.LockMip(Mip);
+        if (!Data)
+        {
+            break;
+        }
+        MipData.Add(Data);
+    }
     
-    return FMath::Lerp(I0, I1, SmoothY);
+    int32 Written = 0;
+    if (MipData.Num() == NumMips)
+    {
+        FMcpTextureKernels::Generate(MipData[0], Width, Height, Format, EvalRow);
+        int32 MipWidth = Width;
+        int32 MipHeight = Height;
+        for (int32 Mip = 1; Mip < NumMips; ++Mip)
+        {
+            FMcpTextureKernels::Downsample(MipData[Mip - 1], MipWidth, MipHeight, Format, MipData[Mip]);
+            MipWidth = FMath::Max(MipWidth / 2, 1);
+            MipHeight = FMath::Max(MipHeight / 2, 1);
+        }
+        Written = NumMips;
+    }
+    for (int32 Mip = MipData.Num() - 1; Mip >= 0; --Mip)
+    {
+        Texture->Source.UnlockMip(Mip);
+    }
+    
+    Texture->PostEditChange();
+    return Written;
 }
 
-// FBM noise for octaves
-static float FBMNoise(float X, float Y, int32 Octaves, float Persistence, float Lacunarity, int32 Seed)
+// Box and Gaussian blurs are separable, so the radius costs linearly.
+static constexpr int32 MaxTextureBlurRadius = 32;
+
+// Channel is "All", "Red", "Green", "Blue" or "Alpha"; alpha is only touched
+// when bInvertAlpha is set.
+static void SetInvertLuts(FMcpTextureKernels::FChannelLuts& Luts, const FString& Channel, bool bInvertAlpha)
 {
-    float Total = 0.0f;
-    float Amplitude = 1.0f;
-    float Frequency = 1.0f;
-    float MaxValue = 0.0f;
-    
-    for (int32 i = 0; i < Octaves; i++)
+    const bool bAll = Channel.Equals(TEXT("All"), ESearchCase::IgnoreCase);
+    uint8 Mask = 0;
+    if (bAll || Channel.Equals(TEXT("Blue"), ESearchCase::IgnoreCase)) Mask |= 1;
+    if (bAll || Channel.Equals(TEXT("Green"), ESearchCase::IgnoreCase)) Mask |= 2;
+    if (bAll || Channel.Equals(TEXT("Red"), ESearchCase::IgnoreCase)) Mask |= 4;
+    if (bInvertAlpha && (bAll || Channel.Equals(TEXT("Alpha"), ESearchCase::IgnoreCase))) Mask |= 8;
+
+    uint8 InvertLut[256];
+    FMcpTextureKernels::BuildInvertLut(InvertLut);
+    Luts.SetChannels(InvertLut, Mask);
+}
+
+// Curve points come as input/output arrays, per channel (inputR/outputR,
+// inputG/outputG, inputB/outputB) or as one master curve (input/output); a
+// missing curve is linear. Alpha is left unchanged.
+static void SetCurveLuts(FMcpTextureKernels::FChannelLuts& Luts, const TSharedPtr<FJsonObject>& Params)
+{
+    auto BuildCurve = [&Params](const TCHAR* InputKey, const TCHAR* OutputKey, uint8 (&OutLut)[256])
+    {
+        TArray<float> Input;
+        TArray<float> Output;
+        const TArray<TSharedPtr<FJsonValue>>* InputArray = nullptr;
+        const TArray<TSharedPtr<FJsonValue>>* OutputArray = nullptr;
+        if (Params->TryGetArrayField(InputKey, InputArray) && Params->TryGetArrayField(OutputKey, OutputArray))
+        {
+            for (const TSharedPtr<FJsonValue>& Val : *InputArray)
+            {
+                Input.Add(static_cast<float>(Val->AsNumber()));
+            }
+            for (const TSharedPtr<FJsonValue>& Val : *OutputArray)
+            {
+                Output.Add(static_cast<float>(Val->AsNumber()));
+            }
+        }
+        FMcpTextureKernels::BuildCurveLut(Input, Output, OutLut);
+    };
+
+    uint8 Lut[256];
+    if (Params->HasField(TEXT("inputR")))
     {
-        Total += Noise2D(X * Frequency, Y * Frequency, Seed + i) * Amplitude;
-        MaxValue += Amplitude;
-        Amplitude *= Persistence;
-        Frequency *= Lacunarity;
+        BuildCurve(TEXT("inputR"), TEXT("outputR"), Lut);
+        Luts.SetChannels(Lut, 4);
+        BuildCurve(TEXT("inputG"), TEXT("outputG"), Lut);
+        Luts.SetChannels(Lut, 2);
+        BuildCurve(TEXT("inputB"), TEXT("outputB"), Lut);
+        Luts.SetChannels(Lut, 1);
+    }
+    else
+    {
+        BuildCurve(TEXT("input"), TEXT("output"), Lut);
+        Luts.SetChannels(Lut, FMcpTextureKernels::ChannelMaskRGB);
+    }
+}
+
+static EMcpHeightChannel ParseHeightChannel(const FString& ChannelMode)
+{
+    if (ChannelMode.Equals(TEXT("red"), ESearchCase::IgnoreCase)) return EMcpHeightChannel::Red;
+    if (ChannelMode.Equals(TEXT("green"), ESearchCase::IgnoreCase)) return EMcpHeightChannel::Green;
+    if (ChannelMode.Equals(TEXT("blue"), ESearchCase::IgnoreCase)) return EMcpHeightChannel::Blue;
+    if (ChannelMode.Equals(TEXT("alpha"), ESearchCase::IgnoreCase)) return EMcpHeightChannel::Alpha;
+    if (ChannelMode.Equals(TEXT("average"), ESearchCase::IgnoreCase)) return EMcpHeightChannel::Average;
+    // Default: Rec. 709 luminance
+    return EMcpHeightChannel::Luminance;
+}
+
+static void ApplyTextureBlur(uint8* Pixels, int32 Width, int32 Height, int32 Radius, const FString& BlurType)
+{
+    if (BlurType.Equals(TEXT("Gaussian"), ESearchCase::IgnoreCase))
+    {
+        FMcpTextureKernels::GaussianBlur(Pixels, Width, Height, Radius);
+    }
+    else
+    {
+        FMcpTextureKernels::BoxBlur(Pixels, Width, Height, Radius);
+    }
+}
+
+// "mapping" lists, for output R, G, B and A in that order, the input channel
+// (R, G, B, A) or constant (0, 1) it takes, e.g. "BGRA" swaps red and blue.
+static bool ParseSwizzleMap(const FString& Mapping, int8 (&OutMap)[4])
+{
+    if (Mapping.Len() != 4)
+    {
+        return false;
+    }
+    // Output letters are RGBA; pixels are stored BGRA
+    static const int32 OutputChannel[4] = { 2, 1, 0, 3 };
+    for (int32 i = 0; i < 4; ++i)
+    {
+        int8 Source;
+        switch (FChar::ToUpper(Mapping[i]))
+        {
+        case TEXT('R'): Source = 2; break;
+        case TEXT('G'): Source = 1; break;
+        case TEXT('B'): Source = 0; break;
+        case TEXT('A'): Source = 3; break;
+        case TEXT('0'): Source = FMcpTextureKernels::SwizzleZero; break;
+        case TEXT('1'): Source = FMcpTextureKernels::SwizzleOne; break;
+        default: return false;
+        }
+        OutMap[OutputChannel[i]] = Source;
+    }
+    return true;
+}
+
+// One texture_pipeline pass. Adjacent lookup-table ops (invert, levels,
+// curves) are folded into a single Luts pass when the pipeline is parsed.
+struct FTexturePipelineStep
+{
+    enum class EKind : uint8 { Luts, Desaturate, Blur, Sharpen, Swizzle };
+    EKind Kind = EKind::Luts;
+    FMcpTextureKernels::FChannelLuts Luts;
+    float Amount = 1.0f;
+    int32 Radius = 2;
+    FString BlurType;
+    int8 Map[4] = { 0, 1, 2, 3 };
+};
+
+// Parses ops into Steps, folding lookup-table ops; returns false with
+// OutError on the first invalid op, before any pixel is touched.
+static bool ParseTexturePipeline(const TArray<TSharedPtr<FJsonValue>>& Ops, TArray<FTexturePipelineStep>& Steps, FString& OutError)
+{
+    for (int32 Index = 0; Index < Ops.Num(); ++Index)
+    {
+        const TSharedPtr<FJsonObject>* OpObj = nullptr;
+        if (!Ops[Index].IsValid() || !Ops[Index]->TryGetObject(OpObj) || !OpObj)
+        {
+            OutError = FString::Printf(TEXT("ops[%d] must be an object"), Index);
+            return false;
+        }
+        const TSharedPtr<FJsonObject>& Op = *OpObj;
+        const FString Name = GetStringFieldTextAuth(Op, TEXT("op"), TEXT("")).ToLower();
+
+        FTexturePipelineStep Step;
+        if (Name == TEXT("invert"))
+        {
+            SetInvertLuts(Step.Luts, GetStringFieldTextAuth(Op, TEXT("channel"), TEXT("All")), GetBoolFieldTextAuth(Op, TEXT("invertAlpha"), false));
+        }
+        else if (Name == TEXT("adjust_levels") || Name == TEXT("levels"))
+        {
+            uint8 LevelsLut[256];
+            FMcpTextureKernels::BuildLevelsLut(
+                static_cast<float>(GetNumberFieldTextAuth(Op, TEXT("inBlack"), 0.0)),
+                static_cast<float>(GetNumberFieldTextAuth(Op, TEXT("inWhite"), 1.0)),
+                static_cast<float>(GetNumberFieldTextAuth(Op, TEXT("gamma"), 1.0)),
+                static_cast<float>(GetNumberFieldTextAuth(Op, TEXT("outBlack"), 0.0)),
+                static_cast<float>(GetNumberFieldTextAuth(Op, TEXT("outWhite"), 1.0)),
+                LevelsLut);
+            Step.Luts.SetChannels(LevelsLut, FMcpTextureKernels::ChannelMaskRGB);
+        }
+        else if (Name == TEXT("adjust_curves") || Name == TEXT("curves"))
+        {
+            SetCurveLuts(Step.Luts, Op);
+        }
+        else if (Name == TEXT("desaturate"))
+        {
+            Step.Kind = FTexturePipelineStep::EKind::Desaturate;
+            Step.Amount = FMath::Clamp(static_cast<float>(GetNumberFieldTextAuth(Op, TEXT("amount"), 1.0)), 0.0f, 1.0f);
+        }
+        else if (Name == TEXT("blur"))
+        {
+            Step.Kind = FTexturePipelineStep::EKind::Blur;
+            Step.Radius = FMath::Clamp(static_cast<int32>(GetNumberFieldTextAuth(Op, TEXT("radius"), 2)), 1, MaxTextureBlurRadius);
+            Step.BlurType = GetStringFieldTextAuth(Op, TEXT("blurType"), TEXT("Box"));
+        }
+        else if (Name == TEXT("sharpen"))
+        {
+            Step.Kind = FTexturePipelineStep::EKind::Sharpen;
+            Step.Amount = FMath::Clamp(static_cast<float>(GetNumberFieldTextAuth(Op, TEXT("amount"), 1.0)), 0.0f, 5.0f);
+        }
+        else if (Name == TEXT("swizzle"))
+        {
+            Step.Kind = FTexturePipelineStep::EKind::Swizzle;
+            const FString Mapping = GetStringFieldTextAuth(Op, TEXT("mapping"), TEXT(""));
+            if (!ParseSwizzleMap(Mapping, Step.Map))
+            {
+                OutError = FString::Printf(TEXT("ops[%d]: mapping must be 4 of R, G, B, A, 0, 1 (got '%s')"), Index, *Mapping);
+                return false;
+            }
+        }
+        else
+        {
+            OutError = FString::Printf(TEXT("ops[%d]: unknown op '%s'"), Index, *Name);
+            return false;
+        }
+
+        if (Step.Kind == FTexturePipelineStep::EKind::Luts && Steps.Num() > 0 && Steps.Last().Kind == FTexturePipelineStep::EKind::Luts)
+        {
+            Steps.Last().Luts.Then(Step.Luts);
+        }
+        else
+        {
+            Steps.Add(MoveTemp(Step));
+        }
+    }
+    return true;
+}
+
+static void RunTexturePipeline(uint8* Pixels, int32 Width, int32 Height, const TArray<FTexturePipelineStep>& Steps)
+{
+    for (const FTexturePipelineStep& Step : Steps)
+    {
+        switch (Step.Kind)
+        {
+        case FTexturePipelineStep::EKind::Luts:
+            FMcpTextureKernels::ApplyLuts(Pixels, Width, Height, Step.Luts);
+            break;
+        case FTexturePipelineStep::EKind::Desaturate:
+            FMcpTextureKernels::Desaturate(Pixels, Width, Height, Step.Amount);
+            break;
+        case FTexturePipelineStep::EKind::Blur:
+            ApplyTextureBlur(Pixels, Width, Height, Step.Radius, Step.BlurType);
+            break;
+        case FTexturePipelineStep::EKind::Sharpen:
+            FMcpTextureKernels::Sharpen(Pixels, Width, Height, Step.Amount);
+            break;
+        case FTexturePipelineStep::EKind::Swizzle:
+            FMcpTextureKernels::Swizzle(Pixels, Width, Height, Step.Map);
+            break;
+        }
     }
-    
-    return Total / MaxValue;
 }
 
 TSharedPtr<FJsonObject> UMcpAutomationBridgeSubsystem::HandleManageTextureAction(const TSharedPtr<FJsonObject>& Params)
@@ -187,7 +496,8 @@ TSharedPtr<FJsonObject> UMcpAutomationBridgeSubsystem::HandleManageTextureAction
             TEXT("subAction"), TEXT("name"), TEXT("path"), TEXT("noiseType"),
             TEXT("width"), TEXT("height"), TEXT("scale"), TEXT("octaves"),
             TEXT("persistence"), TEXT("lacunarity"), TEXT("seed"),
-            TEXT("seamless"), TEXT("hdr"), TEXT("save")
+            TEXT("seamless"), TEXT("hdr"), TEXT("save"), TEXT("format"),
+            TEXT("generateMips")
         };
         for (const auto& Field : Params->Values)
         {
@@ -225,7 +535,6 @@ TSharedPtr<FJsonObject> UMcpAutomationBridgeSubsystem::HandleManageTextureAction
         float Lacunarity = static_cast<float>(GetNumberFieldTextAuth(Params, TEXT("lacunarity"), 2.0));
         int32 Seed = static_cast<int32>(GetNumberFieldTextAuth(Params, TEXT("seed"), 0));
         bool bSeamless = GetBoolFieldTextAuth(Params, TEXT("seamless"), false);
-        bool bHDR = GetBoolFieldTextAuth(Params, TEXT("hdr"), false);
         bool bSave = GetBoolFieldTextAuth(Params, TEXT("save"), true);
         
         if (Name.IsEmpty())
@@ -233,60 +542,78 @@ TSharedPtr<FJsonObject> UMcpAutomationBridgeSubsystem::HandleManageTextureAction
             TEXTURE_ERROR_RESPONSE(TEXT("Name is required"));
         }
         
-        // Create texture
-        UTexture2D* NewTexture = CreateEmptyTexture(Path, Name, Width, Height, bHDR);
-        if (!NewTexture)
+        EMcpTextureFormat Format;
+        FString FormatError;
+        if (!ParseGeneratedTextureFormat(Params, Format, FormatError))
         {
-            TEXTURE_ERROR_RESPONSE(TEXT("Failed to create texture"));
+            TEXTURE_ERROR_RESPONSE(FormatError);
+        }
+        bool bGenerateMips = GetBoolFieldTextAuth(Params, TEXT("generateMips"), false);
+        if (Width < 1 || Height < 1 || Width > MaxGeneratedTextureSize || Height > MaxGeneratedTextureSize)
+        {
+            TEXTURE_ERROR_RESPONSE(FString::Printf(TEXT("width and height must be between 1 and %d"), MaxGeneratedTextureSize));
         }
         
-        // Lock source data and fill with noise
-        uint8* MipData = NewTexture->Source.LockMip(0);
-        if (!MipData)
+        // Create texture
+        UTexture2D* NewTexture = CreateEmptyTexture(Path, Name, Width, Height, Format == EMcpTextureFormat::RGBA16F);
+        if (!NewTexture)
         {
-            TEXTURE_ERROR_RESPONSE(TEXT("Failed to lock texture mip data"));
+            TEXTURE_ERROR_RESPONSE(TEXT("Failed to create texture"));
         }
         
-        for (int32 Y = 0; Y < Height; Y++)
+        // Fill with FBM noise, a row and an octave at a time
+        Octaves = FMath::Max(Octaves, 1);
+        const int32 NumMips = FillGeneratedTexture(NewTexture, Width, Height, Format, bGenerateMips, [&](int32 Y, FLinearColor* OutRow)
         {
+            TArray<float> Xs, Ys, Total;
+            Xs.SetNumUninitialized(Width);
+            Ys.SetNumUninitialized(Width);
+            Total.SetNumZeroed(Width);
+            
+            const float NY = static_cast<float>(Y) / static_cast<float>(Height) * Scale;
             for (int32 X = 0; X < Width; X++)
             {
-                float NX = static_cast<float>(X) / static_cast<float>(Width) * Scale;
-                float NY = static_cast<float>(Y) / static_cast<float>(Height) * Scale;
-                
-                // Seamless tiling using domain wrapping
-                float NoiseValue;
+                const float NX = static_cast<float>(X) / static_cast<float>(Width) * Scale;
                 if (bSeamless)
                 {
-                    float Angle1 = NX * PI * 2.0f;
-                    float Angle2 = NY * PI * 2.0f;
-                    float NX3D = FMath::Cos(Angle1);
-                    float NY3D = FMath::Sin(Angle1);
-                    float NZ3D = FMath::Cos(Angle2);
-                    float NW3D = FMath::Sin(Angle2);
-                    NoiseValue = FBMNoise(NX3D + NZ3D, NY3D + NW3D, Octaves, Persistence, Lacunarity, Seed);
+                    // Seamless tiling using domain wrapping
+                    const float Angle1 = NX * PI * 2.0f;
+                    const float Angle2 = NY * PI * 2.0f;
+                    Xs[X] = FMath::Cos(Angle1) + FMath::Cos(Angle2);
+                    Ys[X] = FMath::Sin(Angle1) + FMath::Sin(Angle2);
                 }
                 else
                 {
-                    NoiseValue = FBMNoise(NX, NY, Octaves, Persistence, Lacunarity, Seed);
+                    Xs[X] = NX;
+                    Ys[X] = NY;
                 }
-                
-                // Normalize to 0-1 range
-                NoiseValue = (NoiseValue + 1.0f) * 0.5f;
-                NoiseValue = FMath::Clamp(NoiseValue, 0.0f, 1.0f);
-                
-                // Write pixel data (BGRA8 format)
-                int32 PixelIndex = (Y * Width + X) * 4;
-                uint8 ByteValue = static_cast<uint8>(NoiseValue * 255.0f);
-                MipData[PixelIndex + 0] = ByteValue; // B
-                MipData[PixelIndex + 1] = ByteValue; // G
-                MipData[PixelIndex + 2] = ByteValue; // R
-                MipData[PixelIndex + 3] = 255;       // A
             }
+            
+            float Amplitude = 1.0f;
+            float Frequency = 1.0f;
+            float MaxValue = 0.0f;
+            for (int32 i = 0; i < Octaves; i++)
+            {
+                AccumulateNoiseRow(Xs.GetData(), Ys.GetData(), Width, Frequency, Seed + i, Amplitude, Total.GetData());
+                MaxValue += Amplitude;
+                Amplitude *= Persistence;
+                Frequency *= Lacunarity;
+            }
+            
+            // Normalize to 0-1 range
+            const float Normalize = 0.5f / MaxValue;
+            for (int32 X = 0; X < Width; X++)
+            {
+                const float NoiseValue = FMath::Clamp(Total[X] * Normalize + 0.5f, 0.0f, 1.0f);
+                OutRow[X] = FLinearColor(NoiseValue, NoiseValue, NoiseValue, 1.0f);
+            }
+        });
+        if (NumMips == 0)
+        {
+            TEXTURE_ERROR_RESPONSE(TEXT("Failed to lock texture mip data"));
         }
-        
-        NewTexture->Source.UnlockMip(0);
-        NewTexture->UpdateResource();
+        Response->SetNumberField(TEXT("mipCount"), NumMips);
+        Response->SetStringField(TEXT("format"), GeneratedTextureFormatNames[static_cast<int32>(Format)]);
         
         if (bSave)
         {
@@ -307,7 +634,7 @@ Response->SetBoolField(TEXT("success"), true);
             TEXT("subAction"), TEXT("name"), TEXT("path"), TEXT("gradientType"),
             TEXT("width"), TEXT("height"), TEXT("angle"), TEXT("centerX"),
             TEXT("centerY"), TEXT("radius"), TEXT("hdr"), TEXT("save"),
-            TEXT("startColor"), TEXT("endColor")
+            TEXT("startColor"), TEXT("endColor"), TEXT("format"), TEXT("generateMips")
         };
         for (const auto& Field : Params->Values)
         {
@@ -343,7 +670,6 @@ Response->SetBoolField(TEXT("success"), true);
         float CenterX = static_cast<float>(GetNumberFieldTextAuth(Params, TEXT("centerX"), 0.5));
         float CenterY = static_cast<float>(GetNumberFieldTextAuth(Params, TEXT("centerY"), 0.5));
         float Radius = static_cast<float>(GetNumberFieldTextAuth(Params, TEXT("radius"), 0.5));
-        bool bHDR = GetBoolFieldTextAuth(Params, TEXT("hdr"), false);
         bool bSave = GetBoolFieldTextAuth(Params, TEXT("save"), true);
         
         // Get colors
@@ -374,72 +700,68 @@ Response->SetBoolField(TEXT("success"), true);
             }
         }
         
+        EMcpTextureFormat Format;
+        FString FormatError;
+        if (!ParseGeneratedTextureFormat(Params, Format, FormatError))
+        {
+            TEXTURE_ERROR_RESPONSE(FormatError);
+        }
+        bool bGenerateMips = GetBoolFieldTextAuth(Params, TEXT("generateMips"), false);
+        if (Width < 1 || Height < 1 || Width > MaxGeneratedTextureSize || Height > MaxGeneratedTextureSize)
+        {
+            TEXTURE_ERROR_RESPONSE(FString::Printf(TEXT("width and height must be between 1 and %d"), MaxGeneratedTextureSize));
+        }
+        
         if (Name.IsEmpty())
         {
             TEXTURE_ERROR_RESPONSE(TEXT("Name is required"));
         }
         
-        UTexture2D* NewTexture = CreateEmptyTexture(Path, Name, Width, Height, bHDR);
+        UTexture2D* NewTexture = CreateEmptyTexture(Path, Name, Width, Height, Format == EMcpTextureFormat::RGBA16F);
         if (!NewTexture)
         {
             TEXTURE_ERROR_RESPONSE(TEXT("Failed to create texture"));
         }
         
-        uint8* MipData = NewTexture->Source.LockMip(0);
-        if (!MipData)
-        {
-            TEXTURE_ERROR_RESPONSE(TEXT("Failed to lock texture mip data"));
-        }
-        
         // Convert angle to radians for linear gradient
         float AngleRad = FMath::DegreesToRadians(Angle);
         FVector2D GradientDir(FMath::Cos(AngleRad), FMath::Sin(AngleRad));
+        const bool bLinear = GradientType == TEXT("Linear");
+        const bool bRadial = GradientType == TEXT("Radial");
+        const bool bAngular = GradientType == TEXT("Angular");
         
-        for (int32 Y = 0; Y < Height; Y++)
+        const int32 NumMips = FillGeneratedTexture(NewTexture, Width, Height, Format, bGenerateMips, [&](int32 Y, FLinearColor* OutRow)
         {
+            const float NY = static_cast<float>(Y) / static_cast<float>(Height);
             for (int32 X = 0; X < Width; X++)
             {
-                float NX = static_cast<float>(X) / static_cast<float>(Width);
-                float NY = static_cast<float>(Y) / static_cast<float>(Height);
-                
+                const float NX = static_cast<float>(X) / static_cast<float>(Width);
                 float T = 0.0f;
-                
-                if (GradientType == TEXT("Linear"))
+                if (bLinear)
                 {
                     // Project onto gradient direction
-                    T = NX * GradientDir.X + NY * GradientDir.Y;
-                    T = FMath::Clamp(T, 0.0f, 1.0f);
+                    T = FMath::Clamp(static_cast<float>(NX * GradientDir.X + NY * GradientDir.Y), 0.0f, 1.0f);
                 }
-                else if (GradientType == TEXT("Radial"))
+                else if (bRadial)
                 {
-                    float DX = NX - CenterX;
-                    float DY = NY - CenterY;
-                    float Dist = FMath::Sqrt(DX * DX + DY * DY);
-                    T = FMath::Clamp(Dist / Radius, 0.0f, 1.0f);
+                    const float DX = NX - CenterX;
+                    const float DY = NY - CenterY;
+                    T = FMath::Clamp(FMath::Sqrt(DX * DX + DY * DY) / Radius, 0.0f, 1.0f);
                 }
-                else if (GradientType == TEXT("Angular"))
+                else if (bAngular)
                 {
-                    float DX = NX - CenterX;
-                    float DY = NY - CenterY;
-                    float AngleVal = FMath::Atan2(DY, DX);
-                    T = (AngleVal + PI) / (2.0f * PI);
-                    T = FMath::Clamp(T, 0.0f, 1.0f);
+                    const float AngleVal = FMath::Atan2(NY - CenterY, NX - CenterX);
+                    T = FMath::Clamp((AngleVal + PI) / (2.0f * PI), 0.0f, 1.0f);
                 }
-                
-                // Interpolate color
-                FLinearColor Color = FMath::Lerp(StartColor, EndColor, T);
-                
-                // Write pixel
-                int32 PixelIndex = (Y * Width + X) * 4;
-                MipData[PixelIndex + 0] = static_cast<uint8>(Color.B * 255.0f); // B
-                MipData[PixelIndex + 1] = static_cast<uint8>(Color.G * 255.0f); // G
-                MipData[PixelIndex + 2] = static_cast<uint8>(Color.R * 255.0f); // R
-                MipData[PixelIndex + 3] = static_cast<uint8>(Color.A * 255.0f); // A
+                OutRow[X] = FMath::Lerp(StartColor, EndColor, T);
             }
+        });
+        if (NumMips == 0)
+        {
+            TEXTURE_ERROR_RESPONSE(TEXT("Failed to lock texture mip data"));
         }
-        
-        NewTexture->Source.UnlockMip(0);
-        NewTexture->UpdateResource();
+        Response->SetNumberField(TEXT("mipCount"), NumMips);
+        Response->SetStringField(TEXT("format"), GeneratedTextureFormatNames[static_cast<int32>(Format)]);
         
         if (bSave)
         {
@@ -460,7 +782,8 @@ Response->SetBoolField(TEXT("success"), true);
             TEXT("subAction"), TEXT("name"), TEXT("path"), TEXT("patternType"),
             TEXT("width"), TEXT("height"), TEXT("tilesX"), TEXT("tilesY"),
             TEXT("lineWidth"), TEXT("brickRatio"), TEXT("offset"), TEXT("save"),
-            TEXT("primaryColor"), TEXT("secondaryColor")
+            TEXT("primaryColor"), TEXT("secondaryColor"), TEXT("hdr"), TEXT("format"),
+            TEXT("generateMips")
         };
         for (const auto& Field : Params->Values)
         {
@@ -527,24 +850,36 @@ Response->SetBoolField(TEXT("success"), true);
             }
         }
         
+        EMcpTextureFormat Format;
+        FString FormatError;
+        if (!ParseGeneratedTextureFormat(Params, Format, FormatError))
+        {
+            TEXTURE_ERROR_RESPONSE(FormatError);
+        }
+        bool bGenerateMips = GetBoolFieldTextAuth(Params, TEXT("generateMips"), false);
+        if (Width < 1 || Height < 1 || Width > MaxGeneratedTextureSize || Height > MaxGeneratedTextureSize)
+        {
+            TEXTURE_ERROR_RESPONSE(FString::Printf(TEXT("width and height must be between 1 and %d"), MaxGeneratedTextureSize));
+        }
+        
         if (Name.IsEmpty())
         {
             TEXTURE_ERROR_RESPONSE(TEXT("Name is required"));
         }
         
-        UTexture2D* NewTexture = CreateEmptyTexture(Path, Name, Width, Height, false);
+        UTexture2D* NewTexture = CreateEmptyTexture(Path, Name, Width, Height, Format == EMcpTextureFormat::RGBA16F);
         if (!NewTexture)
         {
             TEXTURE_ERROR_RESPONSE(TEXT("Failed to create texture"));
         }
         
-        uint8* MipData = NewTexture->Source.LockMip(0);
-        if (!MipData)
-        {
-            TEXTURE_ERROR_RESPONSE(TEXT("Failed to lock texture mip data"));
-        }
+        const bool bChecker = PatternType == TEXT("Checker");
+        const bool bGrid = PatternType == TEXT("Grid");
+        const bool bBrick = PatternType == TEXT("Brick");
+        const bool bStripes = PatternType == TEXT("Stripes");
+        const bool bDots = PatternType == TEXT("Dots");
         
-        for (int32 Y = 0; Y < Height; Y++)
+        const int32 NumMips = FillGeneratedTexture(NewTexture, Width, Height, Format, bGenerateMips, [&](int32 Y, FLinearColor* OutRow)
         {
             for (int32 X = 0; X < Width; X++)
             {
@@ -553,13 +888,13 @@ Response->SetBoolField(TEXT("success"), true);
                 
                 bool bUsePrimary = true;
                 
-                if (PatternType == TEXT("Checker"))
+                if (bChecker)
                 {
                     int32 CellX = static_cast<int32>(NX * TilesX);
                     int32 CellY = static_cast<int32>(NY * TilesY);
                     bUsePrimary = ((CellX + CellY) % 2) == 0;
                 }
-                else if (PatternType == TEXT("Grid"))
+                else if (bGrid)
                 {
                     float CellWidth = 1.0f / TilesX;
                     float CellHeight = 1.0f / TilesY;
@@ -568,7 +903,7 @@ Response->SetBoolField(TEXT("success"), true);
                     bUsePrimary = (LocalX > LineWidth && LocalX < (1.0f - LineWidth) &&
                                    LocalY > LineWidth && LocalY < (1.0f - LineWidth));
                 }
-                else if (PatternType == TEXT("Brick"))
+                else if (bBrick)
                 {
                     float BrickHeight = 1.0f / TilesY;
                     int32 Row = static_cast<int32>(NY * TilesY);
@@ -582,12 +917,12 @@ Response->SetBoolField(TEXT("success"), true);
                     bUsePrimary = (LocalX > LineWidth && LocalX < (1.0f - LineWidth) &&
                                    LocalY > LineWidth && LocalY < (1.0f - LineWidth));
                 }
-                else if (PatternType == TEXT("Stripes"))
+                else if (bStripes)
                 {
                     int32 StripeIndex = static_cast<int32>(NX * TilesX);
                     bUsePrimary = (StripeIndex % 2) == 0;
                 }
-                else if (PatternType == TEXT("Dots"))
+                else if (bDots)
                 {
                     float CellWidth = 1.0f / TilesX;
                     float CellHeight = 1.0f / TilesY;
@@ -597,18 +932,15 @@ Response->SetBoolField(TEXT("success"), true);
                     bUsePrimary = Dist < 0.3f;
                 }
                 
-                FLinearColor Color = bUsePrimary ? PrimaryColor : SecondaryColor;
-                
-                int32 PixelIndex = (Y * Width + X) * 4;
-                MipData[PixelIndex + 0] = static_cast<uint8>(Color.B * 255.0f);
-                MipData[PixelIndex + 1] = static_cast<uint8>(Color.G * 255.0f);
-                MipData[PixelIndex + 2] = static_cast<uint8>(Color.R * 255.0f);
-                MipData[PixelIndex + 3] = static_cast<uint8>(Color.A * 255.0f);
+                OutRow[X] = bUsePrimary ? PrimaryColor : SecondaryColor;
             }
+        });
+        if (NumMips == 0)
+        {
+            TEXTURE_ERROR_RESPONSE(TEXT("Failed to lock texture mip data"));
         }
-        
-        NewTexture->Source.UnlockMip(0);
-        NewTexture->UpdateResource();
+        Response->SetNumberField(TEXT("mipCount"), NumMips);
+        Response->SetStringField(TEXT("format"), GeneratedTextureFormatNames[static_cast<int32>(Format)]);
         
         if (bSave)
         {
@@ -739,98 +1071,16 @@ Response->SetBoolField(TEXT("success"), true);
         {
             TEXTURE_ERROR_RESPONSE(TEXT("Failed to lock height map pixel data - texture may be compressed or streaming"));
         }
-        for (int32 i = 0; i < Width * Height; i++)
-        {
-            float HeightValue = 0.0f;
-            // BGRA format: index 0=B, 1=G, 2=R, 3=A
-            uint8 B = HeightPixels[i * 4 + 0];
-            uint8 G = HeightPixels[i * 4 + 1];
-            uint8 R = HeightPixels[i * 4 + 2];
-            uint8 A = HeightPixels[i * 4 + 3];
-            if (ChannelMode.Equals(TEXT("red"), ESearchCase::IgnoreCase))
-            {
-                HeightValue = static_cast<float>(R) / 255.0f;
-            }
-            else if (ChannelMode.Equals(TEXT("green"), ESearchCase::IgnoreCase))
-            {
-                HeightValue = static_cast<float>(G) / 255.0f;
-            }
-            else if (ChannelMode.Equals(TEXT("blue"), ESearchCase::IgnoreCase))
-            {
-                HeightValue = static_cast<float>(B) / 255.0f;
-            }
-            else if (ChannelMode.Equals(TEXT("alpha"), ESearchCase::IgnoreCase))
-            {
-                HeightValue = static_cast<float>(A) / 255.0f;
-            }
-            else if (ChannelMode.Equals(TEXT("average"), ESearchCase::IgnoreCase))
-            {
-                HeightValue = (static_cast<float>(R) + static_cast<float>(G) + static_cast<float>(B)) / (255.0f * 3.0f);
-            }
-            else // Default: Rec. 709 luminance coefficients for proper grayscale
-            {
-                // Y = 0.2126*R + 0.7152*G + 0.0722*B (ITU-R BT.709 standard)
-                HeightValue = (0.2126f * static_cast<float>(R) + 
-                               0.7152f * static_cast<float>(G) + 
-                               0.0722f * static_cast<float>(B)) / 255.0f;
-            }
-            HeightData[i] = HeightValue;
-        }
+        FMcpTextureKernels::ExtractHeight(HeightPixels, Width, Height, ParseHeightChannel(ChannelMode), HeightData.GetData());
         HeightMap->Source.UnlockMip(0);
         
         // Generate normal map
         uint8* NormalData = NormalMap->Source.LockMip(0);
-        
-        for (int32 Y = 0; Y < Height; Y++)
+        if (!NormalData)
         {
-            for (int32 X = 0; X < Width; X++)
-            {
-                // Sample neighboring heights with wrap
-                auto SampleHeight = [&](int32 SX, int32 SY) -> float {
-                    SX = (SX + Width) % Width;
-                    SY = (SY + Height) % Height;
-                    return HeightData[SY * Width + SX];
-                };
-                
-                float DX, DY;
-                
-                if (Algorithm == TEXT("Sobel"))
-                {
-                    // Sobel operator
-                    DX = (SampleHeight(X - 1, Y - 1) * -1.0f + SampleHeight(X - 1, Y) * -2.0f + SampleHeight(X - 1, Y + 1) * -1.0f +
-                          SampleHeight(X + 1, Y - 1) * 1.0f + SampleHeight(X + 1, Y) * 2.0f + SampleHeight(X + 1, Y + 1) * 1.0f);
-                    DY = (SampleHeight(X - 1, Y - 1) * -1.0f + SampleHeight(X, Y - 1) * -2.0f + SampleHeight(X + 1, Y - 1) * -1.0f +
-                          SampleHeight(X - 1, Y + 1) * 1.0f + SampleHeight(X, Y + 1) * 2.0f + SampleHeight(X + 1, Y + 1) * 1.0f);
-                }
-                else
-                {
-                    // Simple finite difference
-                    DX = SampleHeight(X + 1, Y) - SampleHeight(X - 1, Y);
-                    DY = SampleHeight(X, Y + 1) - SampleHeight(X, Y - 1);
-                }
-                
-                // Apply strength
-                DX *= Strength;
-                DY *= Strength;
-                
-                // Flip Y if needed (DirectX vs OpenGL)
-                if (bFlipY)
-                {
-                    DY = -DY;
-                }
-                
-                // Create normal vector
-                FVector Normal(-DX, -DY, 1.0f);
-                Normal.Normalize();
-                
-                // Convert to 0-1 range
-                int32 PixelIndex = (Y * Width + X) * 4;
-                NormalData[PixelIndex + 0] = static_cast<uint8>((Normal.Z * 0.5f + 0.5f) * 255.0f); // B = Z
-                NormalData[PixelIndex + 1] = static_cast<uint8>((Normal.Y * 0.5f + 0.5f) * 255.0f); // G = Y
-                NormalData[PixelIndex + 2] = static_cast<uint8>((Normal.X * 0.5f + 0.5f) * 255.0f); // R = X
-                NormalData[PixelIndex + 3] = 255;
-            }
+            TEXTURE_ERROR_RESPONSE(TEXT("Failed to lock normal map data"));
         }
+        FMcpTextureKernels::NormalsFromHeight(HeightData.GetData(), Width, Height, Strength, Algorithm == TEXT("Sobel"), bFlipY, NormalData);
         
         NormalMap->Source.UnlockMip(0);
         NormalMap->UpdateResource();
@@ -1384,6 +1634,126 @@ Response->SetBoolField(TEXT("success"), true);
         return Response;
     }
     
+    // ===== PROCESSING PIPELINE =====
+    // Runs several processing ops on one locked mip, then rebuilds and saves
+    // the texture once instead of once per op.
+    if (SubAction == TEXT("texture_pipeline"))
+    {
+        FString AssetPath = GetStringFieldTextAuth(Params, TEXT("assetPath"), TEXT(""));
+        
+        // SECURITY: Validate assetPath
+        FString SanitizedAssetPath = SanitizeProjectRelativePath(AssetPath);
+        if (SanitizedAssetPath.IsEmpty())
+        {
+            TEXTURE_ERROR_RESPONSE(TEXT("Invalid assetPath: contains traversal or invalid characters"));
+        }
+        AssetPath = SanitizedAssetPath;
+        
+        bool bInPlace = GetBoolFieldTextAuth(Params, TEXT("inPlace"), true);
+        FString Name = GetStringFieldTextAuth(Params, TEXT("name"), TEXT(""));
+        FString Path = GetStringFieldTextAuth(Params, TEXT("path"), TEXT(""));
+        bool bSave = GetBoolFieldTextAuth(Params, TEXT("save"), true);
+        
+        const TArray<TSharedPtr<FJsonValue>>* Ops = nullptr;
+        if (!Params->TryGetArrayField(TEXT("ops"), Ops) || !Ops || Ops->Num() == 0)
+        {
+            TEXTURE_ERROR_RESPONSE(TEXT("ops array is required"));
+        }
+        
+        TArray<FTexturePipelineStep> Steps;
+        FString PipelineError;
+        if (!ParseTexturePipeline(*Ops, Steps, PipelineError))
+        {
+            TEXTURE_ERROR_RESPONSE(PipelineError);
+        }
+        
+        UTexture2D* SourceTexture = Cast<UTexture2D>(StaticLoadObject(UTexture2D::StaticClass(), nullptr, *AssetPath));
+        if (!SourceTexture)
+        {
+            TEXTURE_ERROR_RESPONSE(FString::Printf(TEXT("Failed to load texture: %s"), *AssetPath));
+        }
+        if (!SourceTexture->Source.IsValid() || SourceTexture->Source.GetFormat() != TSF_BGRA8)
+        {
+            TEXTURE_ERROR_RESPONSE(TEXT("texture_pipeline needs BGRA8 source data"));
+        }
+        
+        int32 Width = SourceTexture->Source.GetSizeX();
+        int32 Height = SourceTexture->Source.GetSizeY();
+        
+        UTexture2D* TargetTexture = SourceTexture;
+        if (!bInPlace)
+        {
+            if (Name.IsEmpty()) Name = FPaths::GetBaseFilename(AssetPath) + TEXT("_Processed");
+            if (Path.IsEmpty()) Path = FPaths::GetPath(AssetPath);
+            
+            // SECURITY: Validate output path
+            FString SanitizedPath = SanitizeProjectRelativePath(Path);
+            if (SanitizedPath.IsEmpty())
+            {
+                TEXTURE_ERROR_RESPONSE(TEXT("Invalid path: contains traversal or invalid characters"));
+            }
+            Path = SanitizedPath;
+            
+            // Validate name
+            FString SanitizedName = SanitizeAssetName(Name);
+            if (SanitizedName.IsEmpty())
+            {
+                TEXTURE_ERROR_RESPONSE(TEXT("Invalid name: contains invalid characters"));
+            }
+            Name = SanitizedName;
+            
+            TargetTexture = CreateEmptyTexture(Path, Name, Width, Height, false);
+            if (!TargetTexture)
+            {
+                TEXTURE_ERROR_RESPONSE(TEXT("Failed to create output texture"));
+            }
+        }
+        
+        uint8* MipData = TargetTexture->Source.LockMip(0);
+        if (!MipData)
+        {
+            TEXTURE_ERROR_RESPONSE(TEXT("Failed to lock texture mip data"));
+        }
+        
+        if (!bInPlace)
+        {
+            const uint8* SrcData = SourceTexture->Source.LockMipReadOnly(0);
+            if (!SrcData)
+            {
+                TargetTexture->Source.UnlockMip(0);
+                TEXTURE_ERROR_RESPONSE(TEXT("Failed to lock source texture mip data"));
+            }
+            FMemory::Memcpy(MipData, SrcData, static_cast<SIZE_T>(Width) * Height * 4);
+            SourceTexture->Source.UnlockMip(0);
+        }
+        
+        const double StartSeconds = FPlatformTime::Seconds();
+        RunTexturePipeline(MipData, Width, Height, Steps);
+        const double ProcessSeconds = FPlatformTime::Seconds() - StartSeconds;
+        
+        TargetTexture->Source.UnlockMip(0);
+        // A single rebuild for the whole pipeline
+        TargetTexture->PostEditChange();
+        TargetTexture->MarkPackageDirty();
+        
+        if (bSave)
+        {
+            if (!bInPlace)
+            {
+                FAssetRegistryModule::AssetCreated(TargetTexture);
+            }
+            McpSafeAssetSave(TargetTexture);
+        }
+        
+        Response->SetBoolField(TEXT("success"), true);
+        Response->SetStringField(TEXT("message"), FString::Printf(TEXT("Texture pipeline applied (%d ops in %d passes)"), Ops->Num(), Steps.Num()));
+        Response->SetStringField(TEXT("assetPath"), bInPlace ? AssetPath : (Path / Name));
+        Response->SetNumberField(TEXT("opCount"), Ops->Num());
+        Response->SetNumberField(TEXT("passCount"), Steps.Num());
+        Response->SetNumberField(TEXT("processMs"), ProcessSeconds * 1000.0);
+        return Response;
+    }
+    
     if (SubAction == TEXT("invert"))
     {
         // Validate that no unknown/invalid parameters are present
@@ -1476,20 +1846,9 @@ Response->SetBoolField(TEXT("success"), true);
         }
         
         // Invert selected channels
-        bool bInvertR = Channel.Equals(TEXT("All"), ESearchCase::IgnoreCase) || Channel.Equals(TEXT("Red"), ESearchCase::IgnoreCase);
-        bool bInvertG = Channel.Equals(TEXT("All"), ESearchCase::IgnoreCase) || Channel.Equals(TEXT("Green"), ESearchCase::IgnoreCase);
-        bool bInvertB = Channel.Equals(TEXT("All"), ESearchCase::IgnoreCase) || Channel.Equals(TEXT("Blue"), ESearchCase::IgnoreCase);
-        bool bInvertA = bInvertAlpha && (Channel.Equals(TEXT("All"), ESearchCase::IgnoreCase) || Channel.Equals(TEXT("Alpha"), ESearchCase::IgnoreCase));
-        
-        int32 NumPixels = Width * Height;
-        for (int32 i = 0; i < NumPixels; ++i)
-        {
-            int32 Idx = i * 4;
-            if (bInvertB) MipData[Idx + 0] = 255 - MipData[Idx + 0]; // B
-            if (bInvertG) MipData[Idx + 1] = 255 - MipData[Idx + 1]; // G
-            if (bInvertR) MipData[Idx + 2] = 255 - MipData[Idx + 2]; // R
-            if (bInvertA) MipData[Idx + 3] = 255 - MipData[Idx + 3]; // A
-        }
+        FMcpTextureKernels::FChannelLuts Luts;
+        SetInvertLuts(Luts, Channel, bInvertAlpha);
+        FMcpTextureKernels::ApplyLuts(MipData, Width, Height, Luts);
         
         TargetTexture->Source.UnlockMip(0);
         TargetTexture->UpdateResource();
@@ -1595,21 +1954,7 @@ Response->SetBoolField(TEXT("success"), true);
         }
         
         Amount = FMath::Clamp(Amount, 0.0f, 1.0f);
-        int32 NumPixels = Width * Height;
-        for (int32 i = 0; i < NumPixels; ++i)
-        {
-            int32 Idx = i * 4;
-            uint8 B = MipData[Idx + 0];
-            uint8 G = MipData[Idx + 1];
-            uint8 R = MipData[Idx + 2];
-            
-            // Rec. 709 luminance coefficients
-            uint8 Gray = static_cast<uint8>(0.2126f * R + 0.7152f * G + 0.0722f * B);
-            
-            MipData[Idx + 0] = static_cast<uint8>(FMath::Lerp((float)B, (float)Gray, Amount));
-            MipData[Idx + 1] = static_cast<uint8>(FMath::Lerp((float)G, (float)Gray, Amount));
-            MipData[Idx + 2] = static_cast<uint8>(FMath::Lerp((float)R, (float)Gray, Amount));
-        }
+        FMcpTextureKernels::Desaturate(MipData, Width, Height, Amount);
         
         TargetTexture->Source.UnlockMip(0);
         TargetTexture->UpdateResource();
@@ -1679,29 +2024,12 @@ Response->SetBoolField(TEXT("success"), true);
             TEXTURE_ERROR_RESPONSE(TEXT("Failed to lock texture mip data"));
         }
         
-        InBlack = FMath::Clamp(InBlack, 0.0f, 1.0f);
-        InWhite = FMath::Clamp(InWhite, 0.0f, 1.0f);
-        Gamma = FMath::Max(Gamma, 0.01f);
-        OutBlack = FMath::Clamp(OutBlack, 0.0f, 1.0f);
-        OutWhite = FMath::Clamp(OutWhite, 0.0f, 1.0f);
-        
-        float InRange = FMath::Max(InWhite - InBlack, 0.001f);
-        float OutRange = OutWhite - OutBlack;
-        float InvGamma = 1.0f / Gamma;
-        
-        int32 NumPixels = Width * Height;
-        for (int32 i = 0; i < NumPixels; ++i)
-        {
-            int32 Idx = i * 4;
-            for (int32 c = 0; c < 3; ++c)
-            {
-                float Val = MipData[Idx + c] / 255.0f;
-                Val = FMath::Clamp((Val - InBlack) / InRange, 0.0f, 1.0f);
-                Val = FMath::Pow(Val, InvGamma);
-                Val = OutBlack + Val * OutRange;
-                MipData[Idx + c] = static_cast<uint8>(FMath::Clamp(Val * 255.0f, 0.0f, 255.0f));
-            }
-        }
+        // One table for the whole mapping; alpha is left as is
+        uint8 LevelsLut[256];
+        FMcpTextureKernels::BuildLevelsLut(InBlack, InWhite, Gamma, OutBlack, OutWhite, LevelsLut);
+        FMcpTextureKernels::FChannelLuts Luts;
+        Luts.SetChannels(LevelsLut, FMcpTextureKernels::ChannelMaskRGB);
+        FMcpTextureKernels::ApplyLuts(MipData, Width, Height, Luts);
         
         Texture->Source.UnlockMip(0);
         Texture->UpdateResource();
@@ -1744,6 +2072,7 @@ Response->SetBoolField(TEXT("success"), true);
         AssetPath = SanitizedAssetPath;
         
         int32 Radius = static_cast<int32>(GetNumberFieldTextAuth(Params, TEXT("radius"), 2));
+        FString BlurType = GetStringFieldTextAuth(Params, TEXT("blurType"), TEXT("Box"));
         bool bSave = GetBoolFieldTextAuth(Params, TEXT("save"), true);
         
         if (AssetPath.IsEmpty())
@@ -1771,7 +2100,7 @@ Response->SetBoolField(TEXT("success"), true);
         
         int32 Width = Texture->GetSizeX();
         int32 Height = Texture->GetSizeY();
-        Radius = FMath::Clamp(Radius, 1, 10);
+        Radius = FMath::Clamp(Radius, 1, MaxTextureBlurRadius);
         
         uint8* MipData = Texture->Source.LockMip(0);
         if (!MipData)
@@ -1779,42 +2108,7 @@ Response->SetBoolField(TEXT("success"), true);
             TEXTURE_ERROR_RESPONSE(TEXT("Failed to lock texture mip data - texture may be compressed or streaming"));
         }
         
-        // Create copy of original data
-        TArray<uint8> OriginalData;
-        int32 DataSize = Width * Height * 4;
-        OriginalData.SetNumUninitialized(DataSize);
-        FMemory::Memcpy(OriginalData.GetData(), MipData, DataSize);
-        
-        // Box blur
-        int32 KernelSize = Radius * 2 + 1;
-        float KernelWeight = 1.0f / (KernelSize * KernelSize);
-        
-        for (int32 Y = 0; Y < Height; ++Y)
-        {
-            for (int32 X = 0; X < Width; ++X)
-            {
-                float SumR = 0, SumG = 0, SumB = 0;
-                
-                for (int32 KY = -Radius; KY <= Radius; ++KY)
-                {
-                    for (int32 KX = -Radius; KX <= Radius; ++KX)
-                    {
-                        int32 SampleX = FMath::Clamp(X + KX, 0, Width - 1);
-                        int32 SampleY = FMath::Clamp(Y + KY, 0, Height - 1);
-                        int32 SampleIdx = (SampleY * Width + SampleX) * 4;
-                        
-                        SumB += OriginalData[SampleIdx + 0];
-                        SumG += OriginalData[SampleIdx + 1];
-                        SumR += OriginalData[SampleIdx + 2];
-                    }
-                }
-                
-                int32 DstIdx = (Y * Width + X) * 4;
-                MipData[DstIdx + 0] = static_cast<uint8>(SumB * KernelWeight);
-                MipData[DstIdx + 1] = static_cast<uint8>(SumG * KernelWeight);
-                MipData[DstIdx + 2] = static_cast<uint8>(SumR * KernelWeight);
-            }
-        }
+        ApplyTextureBlur(MipData, Width, Height, Radius, BlurType);
         
         Texture->Source.UnlockMip(0);
         Texture->UpdateResource();
@@ -1878,37 +2172,8 @@ Response->SetBoolField(TEXT("success"), true);
             TEXTURE_ERROR_RESPONSE(TEXT("Failed to lock texture mip data - texture may be compressed or streaming"));
         }
         
-        // Create copy of original data
-        TArray<uint8> OriginalData;
-        int32 DataSize = Width * Height * 4;
-        OriginalData.SetNumUninitialized(DataSize);
-        FMemory::Memcpy(OriginalData.GetData(), MipData, DataSize);
-        
-        // Unsharp mask sharpening
         // Sharpen kernel: center = 1 + 4*amount, neighbors = -amount
-        for (int32 Y = 1; Y < Height - 1; ++Y)
-        {
-            for (int32 X = 1; X < Width - 1; ++X)
-            {
-                int32 CenterIdx = (Y * Width + X) * 4;
-                int32 LeftIdx = (Y * Width + X - 1) * 4;
-                int32 RightIdx = (Y * Width + X + 1) * 4;
-                int32 TopIdx = ((Y - 1) * Width + X) * 4;
-                int32 BottomIdx = ((Y + 1) * Width + X) * 4;
-                
-                for (int32 c = 0; c < 3; ++c)
-                {
-                    float Center = OriginalData[CenterIdx + c];
-                    float Left = OriginalData[LeftIdx + c];
-                    float Right = OriginalData[RightIdx + c];
-                    float Top = OriginalData[TopIdx + c];
-                    float Bottom = OriginalData[BottomIdx + c];
-                    
-                    float Sharpened = Center * (1.0f + 4.0f * Amount) - Amount * (Left + Right + Top + Bottom);
-                    MipData[CenterIdx + c] = static_cast<uint8>(FMath::Clamp(Sharpened, 0.0f, 255.0f));
-                }
-            }
-        }
+        FMcpTextureKernels::Sharpen(MipData, Width, Height, Amount);
         
         Texture->Source.UnlockMip(0);
         Texture->UpdateResource();
@@ -2037,48 +2302,32 @@ Response->SetBoolField(TEXT("success"), true);
             TEXTURE_ERROR_RESPONSE(TEXT("Failed to lock output texture data"));
         }
         
-        // Helper to get channel data from texture using Source API
-        auto GetChannelData = [](UTexture2D* Tex, int32 ChannelIdx) -> TArray<uint8> {
-            TArray<uint8> Data;
-            if (!Tex) return Data;
-            if (!Tex->Source.IsValid()) return Data;
-            
-            // Force mips resident if texture uses streaming
-            if (Tex->IsStreamable())
-            {
-                Tex->SetForceMipLevelsToBeResident(30.0f);
-            }
-            int32 W = Tex->GetSizeX();
-            int32 H = Tex->GetSizeY();
-            Data.SetNumUninitialized(W * H);
-            const uint8* MipData = Tex->Source.LockMipReadOnly(0);
-            if (!MipData)
-            {
-                Data.Empty();
-                return Data;
-            }
-            for (int32 i = 0; i < W * H; ++i)
+        // Copy each source channel straight from its locked mip; channels
+        // without a source (or past its last pixel) get 0, alpha 255
+        const int64 NumPixels = static_cast<int64>(Width) * Height;
+        auto PackChannel = [OutData, NumPixels](UTexture2D* Tex, int32 ChannelIdx, uint8 Default) {
+            int64 Copied = 0;
+            if (Tex && Tex->Source.IsValid())
             {
-                Data[i] = MipData[i * 4 + ChannelIdx];
+                // Force mips resident if texture uses streaming
+                if (Tex->IsStreamable())
+                {
+                    Tex->SetForceMipLevelsToBeResident(30.0f);
+                }
+                if (const uint8* MipData = Tex->Source.LockMipReadOnly(0))
+                {
+                    Copied = FMath::Min<int64>(NumPixels, static_cast<int64>(Tex->GetSizeX()) * Tex->GetSizeY());
+                    FMcpTextureKernels::CopyChannel(MipData, ChannelIdx, OutData, ChannelIdx, Copied);
+                    Tex->Source.UnlockMip(0);
+                }
             }
-            Tex->Source.UnlockMip(0);
-            return Data;
+            FMcpTextureKernels::FillChannel(OutData + Copied * 4, ChannelIdx, Default, NumPixels - Copied);
         };
         
-        TArray<uint8> RedData = GetChannelData(RedTex, 2); // R is at index 2 in BGRA
-        TArray<uint8> GreenData = GetChannelData(GreenTex, 1);
-        TArray<uint8> BlueData = GetChannelData(BlueTex, 0);
-        TArray<uint8> AlphaData = GetChannelData(AlphaTex, 3);
-        
-        int32 NumPixels = Width * Height;
-        for (int32 i = 0; i < NumPixels; ++i)
-        {
-            int32 Idx = i * 4;
-            OutData[Idx + 0] = BlueData.Num() > i ? BlueData[i] : 0; // B
-            OutData[Idx + 1] = GreenData.Num() > i ? GreenData[i] : 0; // G
-            OutData[Idx + 2] = RedData.Num() > i ? RedData[i] : 0; // R
-            OutData[Idx + 3] = AlphaData.Num() > i ? AlphaData[i] : 255; // A
-        }
+        PackChannel(BlueTex, 0, 0); // BGRA order
+        PackChannel(GreenTex, 1, 0);
+        PackChannel(RedTex, 2, 0);
+        PackChannel(AlphaTex, 3, 255);
         
         OutputTexture->Source.UnlockMip(0);
         OutputTexture->UpdateResource();
@@ -2250,110 +2499,9 @@ Response->SetBoolField(TEXT("success"), true);
         int32 Width = SourceTexture->GetSizeX();
         int32 Height = SourceTexture->GetSizeY();
         
-        // Parse curve control points
-        // Input/output arrays where input[i] maps to output[i]
-        // Default: linear curve (0->0, 0.25->0.25, 0.5->0.5, 0.75->0.75, 1->1)
-        TArray<float> InputPointsR, OutputPointsR;
-        TArray<float> InputPointsG, OutputPointsG;
-        TArray<float> InputPointsB, OutputPointsB;
-        
-        // Helper to parse curve points from JSON array
-        auto ParseCurvePoints = [&Params](const FString& InputKey, const FString& OutputKey, TArray<float>& InputArr, TArray<float>& OutputArr) {
-            const TArray<TSharedPtr<FJsonValue>>* InputArray;
-            const TArray<TSharedPtr<FJsonValue>>* OutputArray;
-            if (Params->TryGetArrayField(InputKey, InputArray) && Params->TryGetArrayField(OutputKey, OutputArray))
-            {
-                for (const auto& Val : *InputArray)
-                {
-                    InputArr.Add(static_cast<float>(Val->AsNumber()));
-                }
-                for (const auto& Val : *OutputArray)
-                {
-                    OutputArr.Add(static_cast<float>(Val->AsNumber()));
-                }
-            }
-            // If not provided or empty, set default linear
-            if (InputArr.Num() == 0 || OutputArr.Num() == 0)
-            {
-                InputArr = { 0.0f, 0.25f, 0.5f, 0.75f, 1.0f };
-                OutputArr = { 0.0f, 0.25f, 0.5f, 0.75f, 1.0f };
-            }
-        };
-        
-        // Check if separate RGB curves are provided, otherwise use master curve
-        if (Params->HasField(TEXT("inputR")))
-        {
-            ParseCurvePoints(TEXT("inputR"), TEXT("outputR"), InputPointsR, OutputPointsR);
-            ParseCurvePoints(TEXT("inputG"), TEXT("outputG"), InputPointsG, OutputPointsG);
-            ParseCurvePoints(TEXT("inputB"), TEXT("outputB"), InputPointsB, OutputPointsB);
-        }
-        else
-        {
-            // Use master curve for all channels
-            TArray<float> MasterInput, MasterOutput;
-            ParseCurvePoints(TEXT("input"), TEXT("output"), MasterInput, MasterOutput);
-            InputPointsR = MasterInput; OutputPointsR = MasterOutput;
-            InputPointsG = MasterInput; OutputPointsG = MasterOutput;
-            InputPointsB = MasterInput; OutputPointsB = MasterOutput;
-        }
-        
-        // Build 256-entry LUT via linear interpolation
-        auto BuildLUT = [](const TArray<float>& Input, const TArray<float>& Output) -> TArray<uint8> {
-            TArray<uint8> LUT;
-            LUT.SetNum(256);
-            
-            if (Input.Num() < 2 || Output.Num() < 2 || Input.Num() != Output.Num())
-            {
-                // Fallback: linear 1:1 mapping
-                for (int32 i = 0; i < 256; ++i)
-                {
-                    LUT[i] = static_cast<uint8>(i);
-                }
-                return LUT;
-            }
-            
-            for (int32 i = 0; i < 256; ++i)
-            {
-                float NormalizedInput = static_cast<float>(i) / 255.0f;
-                float Mapped = NormalizedInput;
-                
-                // Find segment in curve and interpolate
-                for (int32 j = 0; j < Input.Num() - 1; ++j)
-                {
-                    if (NormalizedInput >= Input[j] && NormalizedInput <= Input[j + 1])
-                    {
-                        float SegmentRange = Input[j + 1] - Input[j];
-                        if (SegmentRange > SMALL_NUMBER)
-                        {
-                            float T = (NormalizedInput - Input[j]) / SegmentRange;
-                            Mapped = FMath::Lerp(Output[j], Output[j + 1], T);
-                        }
-                        else
-                        {
-                            Mapped = Output[j];
-                        }
-                        break;
-                    }
-                }
-                
-                // Handle values outside the defined range
-                if (NormalizedInput < Input[0])
-                {
-                    Mapped = Output[0];
-                }
-                else if (NormalizedInput > Input[Input.Num() - 1])
-                {
-                    Mapped = Output[Output.Num() - 1];
-                }
-                
-                LUT[i] = static_cast<uint8>(FMath::Clamp(Mapped * 255.0f, 0.0f, 255.0f));
-            }
-            return LUT;
-        };
-        
-        TArray<uint8> LUT_R = BuildLUT(InputPointsR, OutputPointsR);
-        TArray<uint8> LUT_G = BuildLUT(InputPointsG, OutputPointsG);
-        TArray<uint8> LUT_B = BuildLUT(InputPointsB, OutputPointsB);
+        // Per-channel curves (inputR/outputR ...) or one master curve (input/output)
+        FMcpTextureKernels::FChannelLuts Luts;
+        SetCurveLuts(Luts, Params);
         
         UTexture2D* TargetTexture = SourceTexture;
         if (!bInPlace)
@@ -2382,16 +2530,8 @@ Response->SetBoolField(TEXT("success"), true);
             SrcMip.BulkData.Unlock();
         }
         
-        // Apply LUT to each pixel (BGRA format: B=0, G=1, R=2, A=3)
-        int32 NumPixels = Width * Height;
-        for (int32 i = 0; i < NumPixels; ++i)
-        {
-            int32 Idx = i * 4;
-            MipData[Idx + 0] = LUT_B[MipData[Idx + 0]]; // B
-            MipData[Idx + 1] = LUT_G[MipData[Idx + 1]]; // G
-            MipData[Idx + 2] = LUT_R[MipData[Idx + 2]]; // R
-            // Alpha unchanged
-        }
+        // Alpha keeps its identity table
+        FMcpTextureKernels::ApplyLuts(MipData, Width, Height, Luts);
         
         TargetTexture->Source.UnlockMip(0);
         TargetTexture->UpdateResource();
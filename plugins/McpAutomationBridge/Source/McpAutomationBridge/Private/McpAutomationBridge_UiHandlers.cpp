@@ -31,6 +31,7 @@
 #include "McpAutomationBridgeGlobals.h"
 #include "McpAutomationBridgeHelpers.h"
 #include "McpAutomationBridgeSubsystem.h"
+#include "McpViewportCapture.h"
 #if WITH_EDITOR
 #include "AssetToolsModule.h"
 #include "Blueprint/UserWidget.h"
@@ -211,9 +212,10 @@ bool UMcpAutomationBridgeSubsystem::HandleUiAction(
             ErrorCode = TEXT("ASSET_CREATION_FAILED");
             Resp->SetStringField(TEXT("error"), Message);
           } else {
-            // Force immediate save and registry scan
-            SaveLoadedAssetThrottled(WidgetBlueprint, -1.0, true);
-            ScanPathSynchronous(WidgetBlueprint->GetOutermost()->GetName());
+            // Force immediate save; the registry rescan runs once the
+            // dispatch ends
+            QueueAssetSave(WidgetBlueprint);
+            QueueAssetRegistryScan(WidgetBlueprint->GetOutermost()->GetName());
 
             bSuccess = true;
             Message = FString::Printf(TEXT("Widget blueprint created at %s"),
@@ -384,81 +386,60 @@ bool UMcpAutomationBridgeSubsystem::HandleUiAction(
         ErrorCode = TEXT("NO_VIEWPORT");
         Resp->SetStringField(TEXT("error"), Message);
       } else {
-        // Capture viewport pixels
-        TArray<FColor> Bitmap;
-        FIntVector Size(Viewport->GetSizeXY().X, Viewport->GetSizeXY().Y, 0);
-
-        bool bReadSuccess = Viewport->ReadPixels(Bitmap);
-
-        if (!bReadSuccess || Bitmap.Num() == 0) {
-          Message = TEXT("Failed to read viewport pixels");
-          ErrorCode = TEXT("CAPTURE_FAILED");
-          Resp->SetStringField(TEXT("error"), Message);
-        } else {
-          // Ensure we have the right size
-          const int32 Width = Size.X;
-          const int32 Height = Size.Y;
-
-          // Compress to PNG
-          // Note: ThumbnailCompressImageArray was introduced in UE 5.1
-          TArray<uint8> PngData;
-#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
-          FImageUtils::ThumbnailCompressImageArray(Width, Height, Bitmap,
-                                                   PngData);
-#else
-          // UE 5.0 fallback - use CompressImageArray
-          FImageUtils::CompressImageArray(Width, Height, Bitmap, PngData);
-#endif
-
-          if (PngData.Num() == 0) {
-            // Alternative: compress as PNG using IImageWrapper
-            IImageWrapperModule &ImageWrapperModule =
-                FModuleManager::LoadModuleChecked<IImageWrapperModule>(
-                    FName("ImageWrapper"));
-            TSharedPtr<IImageWrapper> ImageWrapper =
-                ImageWrapperModule.CreateImageWrapper(EImageFormat::PNG);
-
-            if (ImageWrapper.IsValid()) {
-              TArray<uint8> RawData;
-              RawData.SetNum(Width * Height * 4);
-              for (int32 i = 0; i < Bitmap.Num(); ++i) {
-                RawData[i * 4 + 0] = Bitmap[i].R;
-                RawData[i * 4 + 1] = Bitmap[i].G;
-                RawData[i * 4 + 2] = Bitmap[i].B;
-                RawData[i * 4 + 3] = Bitmap[i].A;
+        // Read back asynchronously (see FMcpViewportCapture) and answer once
+        // the PNG is written, instead of stalling on ReadPixels.
+        FMcpViewportCaptureRequest Request;
+        Request.Format = EImageFormat::PNG;
+
+        TWeakObjectPtr<UMcpAutomationBridgeSubsystem> WeakSubsystem(this);
+        FMcpViewportCapture::Capture(
+            Viewport, Request,
+            [WeakSubsystem, RequestingSocket, RequestId, Resp, ScreenshotPath,
+             Filename, bReturnBase64](FMcpViewportCaptureResult &&Result) {
+              UMcpAutomationBridgeSubsystem *Subsystem = WeakSubsystem.Get();
+              if (!Subsystem) {
+                return;
               }
-
-              if (ImageWrapper->SetRaw(RawData.GetData(), RawData.Num(), Width,
-                                       Height, ERGBFormat::RGBA, 8)) {
-                PngData = ImageWrapper->GetCompressed(100);
+              if (!Result.bSuccess) {
+                Resp->SetBoolField(TEXT("success"), false);
+                Resp->SetStringField(TEXT("error"), Result.Error);
+                Subsystem->SendAutomationResponse(RequestingSocket, RequestId,
+                                                  false, Result.Error, Resp,
+                                                  Result.ErrorCode);
+                return;
               }
-            }
-          }
-
-          FString FullPath =
-              FPaths::Combine(ScreenshotPath, Filename + TEXT(".png"));
-          FPaths::MakeStandardFilename(FullPath);
-
-          // Always save to disk
-          IFileManager::Get().MakeDirectory(*ScreenshotPath, true);
-          bool bSaved = FFileHelper::SaveArrayToFile(PngData, *FullPath);
 
-          bSuccess = true;
-          Message = FString::Printf(TEXT("Screenshot captured (%dx%d)"), Width,
-                                    Height);
-          Resp->SetStringField(TEXT("screenshotPath"), FullPath);
-          Resp->SetStringField(TEXT("filename"), Filename);
-          Resp->SetNumberField(TEXT("width"), Width);
-          Resp->SetNumberField(TEXT("height"), Height);
-          Resp->SetNumberField(TEXT("sizeBytes"), PngData.Num());
-
-          // Return base64 encoded image if requested
-          if (bReturnBase64 && PngData.Num() > 0) {
-            FString Base64Data = FBase64::Encode(PngData);
-            Resp->SetStringField(TEXT("imageBase64"), Base64Data);
-            Resp->SetStringField(TEXT("mimeType"), TEXT("image/png"));
-          }
-        }
+              FString FullPath =
+                  FPaths::Combine(ScreenshotPath, Filename + TEXT(".png"));
+              FPaths::MakeStandardFilename(FullPath);
+
+              // Always save to disk
+              IFileManager::Get().MakeDirectory(*ScreenshotPath, true);
+              FFileHelper::SaveArrayToFile(Result.Encoded, *FullPath);
+
+              Resp->SetBoolField(TEXT("success"), true);
+              Resp->SetStringField(TEXT("screenshotPath"), FullPath);
+              Resp->SetStringField(TEXT("filename"), Filename);
+              Resp->SetNumberField(TEXT("width"), Result.Width);
+              Resp->SetNumberField(TEXT("height"), Result.Height);
+              Resp->SetNumberField(TEXT("sizeBytes"), Result.Encoded.Num());
+              Resp->SetNumberField(TEXT("framesWaited"), Result.FramesWaited);
+
+              // Return base64 encoded image if requested
+              if (bReturnBase64) {
+                Subsystem->AttachBinaryPayload(RequestId,
+                                               MoveTemp(Result.Encoded),
+                                               TEXT("image/png"),
+                                               TEXT("imageBase64"));
+                Resp->SetStringField(TEXT("mimeType"), TEXT("image/png"));
+              }
+              Subsystem->SendAutomationResponse(
+                  RequestingSocket, RequestId, true,
+                  FString::Printf(TEXT("Screenshot captured (%dx%d)"),
+                                  Result.Width, Result.Height),
+                  Resp, FString());
+            });
+        return true;
       }
     }
   } else if (LowerSub == TEXT("play_in_editor")) {
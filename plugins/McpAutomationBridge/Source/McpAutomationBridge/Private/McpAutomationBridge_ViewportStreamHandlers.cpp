@@ -0,0 +1,311 @@
+#include "Dom/JsonObject.h"
+#include "McpAutomationBridgeGlobals.h"
+#include "McpAutomationBridgeHelpers.h"
+#include "McpAutomationBridgeSubsystem.h"
+#include "McpBridgeWebSocket.h"
+#include "McpConnectionManager.h"
+#include "McpJsonUtf8Writer.h"
+#include "McpViewportCapture.h"
+#include "Misc/Base64.h"
+
+#if WITH_EDITOR
+#include "Editor.h"
+#include "Engine/GameViewportClient.h"
+#include "IAssetViewport.h"
+#include "Modules/ModuleManager.h"
+#if __has_include("LevelEditor.h")
+#include "LevelEditor.h"
+#define MCP_VIEWPORT_STREAM_HAS_LEVEL_EDITOR 1
+#else
+#define MCP_VIEWPORT_STREAM_HAS_LEVEL_EDITOR 0
+#endif
+#endif
+
+#if WITH_EDITOR
+namespace {
+// The PIE viewport while a session is running, so agents watching gameplay
+// see the game; the active level editor viewport otherwise.
+FViewport *FindViewportStreamSource() {
+  if (GEditor && GEditor->PlayWorld && GEngine && GEngine->GameViewport &&
+      GEngine->GameViewport->Viewport) {
+    return GEngine->GameViewport->Viewport;
+  }
+  FViewport *Viewport = GEditor ? GEditor->GetActiveViewport() : nullptr;
+#if MCP_VIEWPORT_STREAM_HAS_LEVEL_EDITOR
+  if (!Viewport) {
+    if (FLevelEditorModule *LevelEditorModule =
+            FModuleManager::GetModulePtr<FLevelEditorModule>(
+                TEXT("LevelEditor"))) {
+      TSharedPtr<IAssetViewport> ActiveViewport =
+          LevelEditorModule->GetFirstActiveViewport();
+      if (ActiveViewport.IsValid()) {
+        Viewport = ActiveViewport->GetActiveViewport();
+      }
+    }
+  }
+#endif
+  return Viewport;
+}
+} // namespace
+#endif
+
+/**
+ * @brief Start a capture for every viewport stream that is due.
+ *
+ * A stream captures at most once per IntervalSeconds. When MaxInFlight
+ * captures are still pending, or the connection is backpressured, the frame
+ * is dropped rather than queued, so a slow reader sees fewer frames instead
+ * of older ones. Streams of closed connections are removed.
+ */
+void UMcpAutomationBridgeSubsystem::TickViewportStreams() {
+#if WITH_EDITOR
+  if (ViewportStreamSubscriptions.Num() == 0) {
+    return;
+  }
+  const double Now = FPlatformTime::Seconds();
+  FViewport *Viewport = nullptr;
+  bool bViewportResolved = false;
+
+  for (int32 Index = ViewportStreamSubscriptions.Num() - 1; Index >= 0;
+       --Index) {
+    FViewportStreamSubscription &Subscription =
+        ViewportStreamSubscriptions[Index];
+    const TSharedPtr<FMcpBridgeWebSocket> Socket = Subscription.Socket.Pin();
+    if (Subscription.bBoundToSocket &&
+        (!Socket.IsValid() || !Socket->IsConnected())) {
+      UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
+             TEXT("Dropping viewport stream of a closed connection."));
+      ViewportStreamSubscriptions.RemoveAtSwap(Index);
+      continue;
+    }
+    if (Now < Subscription.NextCaptureSeconds) {
+      continue;
+    }
+    // Keep the cadence even when a tick runs late.
+    Subscription.NextCaptureSeconds =
+        FMath::Max(Subscription.NextCaptureSeconds + Subscription.IntervalSeconds,
+                   Now);
+    if (Subscription.InFlight >= Subscription.MaxInFlight ||
+        (Socket.IsValid() && Socket->IsOutboundBackpressured())) {
+      ++Subscription.FramesDropped;
+      continue;
+    }
+
+    if (!bViewportResolved) {
+      Viewport = FindViewportStreamSource();
+      bViewportResolved = true;
+    }
+    if (!Viewport) {
+      continue;
+    }
+
+    FMcpViewportCaptureRequest Request;
+    Request.Width = Subscription.Width;
+    Request.Height = Subscription.Height;
+    Request.Format = Subscription.bPng ? EImageFormat::PNG : EImageFormat::JPEG;
+    Request.Quality = Subscription.Quality;
+    Request.bSkipUnchanged =
+        Subscription.bOnlyOnChange && Subscription.bHasLastHash;
+    Request.PreviousHash = Subscription.LastHash;
+
+    ++Subscription.InFlight;
+    const int32 SubscriptionId = Subscription.Id;
+    TWeakObjectPtr<UMcpAutomationBridgeSubsystem> WeakSubsystem(this);
+    FMcpViewportCapture::Capture(
+        Viewport, Request,
+        [WeakSubsystem, SubscriptionId](FMcpViewportCaptureResult &&Frame) {
+          if (UMcpAutomationBridgeSubsystem *Subsystem = WeakSubsystem.Get()) {
+            Subsystem->DeliverViewportStreamFrame(SubscriptionId,
+                                                  MoveTemp(Frame));
+          }
+        });
+  }
+#endif
+}
+
+/**
+ * @brief Push one captured frame as a viewport_frame automation_event.
+ *
+ * The frame is base64 in the event itself: binary attachments belong to a
+ * request's response, and a stream frame has none. Frames that hash the same
+ * as the last one sent are counted and skipped when the stream asked for
+ * changes only.
+ */
+void UMcpAutomationBridgeSubsystem::DeliverViewportStreamFrame(
+    int32 SubscriptionId, FMcpViewportCaptureResult &&Frame) {
+  FViewportStreamSubscription *Subscription =
+      ViewportStreamSubscriptions.FindByPredicate(
+          [SubscriptionId](const FViewportStreamSubscription &Existing) {
+            return Existing.Id == SubscriptionId;
+          });
+  if (!Subscription) {
+    return;
+  }
+  Subscription->InFlight = FMath::Max(0, Subscription->InFlight - 1);
+  if (!Frame.bSuccess) {
+    ++Subscription->FramesDropped;
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
+           TEXT("Viewport stream frame failed (%s): %s"), *Frame.ErrorCode,
+           *Frame.Error);
+    return;
+  }
+  if (Frame.bUnchanged ||
+      (Subscription->bOnlyOnChange && Subscription->bHasLastHash &&
+       Frame.PixelHash == Subscription->LastHash)) {
+    ++Subscription->FramesUnchanged;
+    return;
+  }
+
+  const int64 Sequence = Subscription->FramesSent + 1;
+  FMcpJsonUtf8Writer Writer;
+  Writer.BeginObject();
+  Writer.WriteString(TEXT("type"), TEXT("automation_event"));
+  Writer.WriteString(TEXT("event"), TEXT("viewport_frame"));
+  Writer.Key(TEXT("payload"));
+  Writer.BeginObject();
+  Writer.WriteInt(TEXT("subscriptionId"), Subscription->Id);
+  Writer.WriteInt(TEXT("seq"), Sequence);
+  Writer.WriteString(TEXT("timestamp"), FDateTime::UtcNow().ToIso8601());
+  Writer.WriteInt(TEXT("width"), Frame.Width);
+  Writer.WriteInt(TEXT("height"), Frame.Height);
+  Writer.WriteString(TEXT("format"),
+                     Subscription->bPng ? TEXT("png") : TEXT("jpeg"));
+  Writer.WriteString(TEXT("mimeType"), Subscription->bPng ? TEXT("image/png")
+                                                          : TEXT("image/jpeg"));
+  Writer.WriteInt(TEXT("sizeBytes"), Frame.Encoded.Num());
+  Writer.WriteNumber(TEXT("captureMs"), Frame.CaptureMs);
+  Writer.WriteInt(TEXT("dropped"), Subscription->FramesDropped);
+  Writer.WriteString(TEXT("imageBase64"), FBase64::Encode(Frame.Encoded));
+  Writer.EndObject();
+  Writer.EndObject();
+
+  bool bSent = false;
+  if (Subscription->bBoundToSocket) {
+    TArray<uint8> Bytes(Writer.GetBuffer());
+    bSent = ConnectionManager.IsValid() &&
+            ConnectionManager->SendDiscardableTo(Subscription->Socket.Pin(),
+                                                 MoveTemp(Bytes));
+  } else {
+    bSent = PublishEvent(TEXT("viewport"), TArray<uint8>(Writer.GetBuffer()));
+  }
+  if (bSent) {
+    Subscription->FramesSent = Sequence;
+    Subscription->LastHash = Frame.PixelHash;
+    Subscription->bHasLastHash = true;
+  } else {
+    ++Subscription->FramesDropped;
+  }
+}
+
+bool UMcpAutomationBridgeSubsystem::HandleControlEditorSubscribeViewportStream(
+    const FString &RequestId, const TSharedPtr<FJsonObject> &Payload,
+    TSharedPtr<FMcpBridgeWebSocket> Socket) {
+#if WITH_EDITOR
+  double Fps = 5.0;
+  int32 Width = 640;
+  int32 Height = 360;
+  FString FormatStr = TEXT("jpeg");
+  int32 Quality = 70;
+  bool bOnlyOnChange = true;
+  int32 MaxInFlight = 2;
+  Payload->TryGetNumberField(TEXT("fps"), Fps);
+  Payload->TryGetNumberField(TEXT("width"), Width);
+  Payload->TryGetNumberField(TEXT("height"), Height);
+  Payload->TryGetStringField(TEXT("format"), FormatStr);
+  Payload->TryGetNumberField(TEXT("quality"), Quality);
+  Payload->TryGetBoolField(TEXT("onlyOnChange"), bOnlyOnChange);
+  Payload->TryGetNumberField(TEXT("maxInFlight"), MaxInFlight);
+
+  Fps = FMath::Clamp(Fps, 0.1, 30.0);
+  Width = FMath::Clamp(Width, 64, 1920);
+  Height = FMath::Clamp(Height, 64, 1080);
+  Quality = FMath::Clamp(Quality, 1, 100);
+  MaxInFlight = FMath::Clamp(MaxInFlight, 1, 4);
+  const bool bPng = FormatStr.ToLower() == TEXT("png");
+
+  // One stream per connection; subscribing again replaces its settings.
+  const int32 ExistingIndex = ViewportStreamSubscriptions.IndexOfByPredicate(
+      [&Socket](const FViewportStreamSubscription &Existing) {
+        return Existing.bBoundToSocket == Socket.IsValid() &&
+               Existing.Socket.Pin() == Socket;
+      });
+  FViewportStreamSubscription &Subscription =
+      ExistingIndex != INDEX_NONE
+          ? ViewportStreamSubscriptions[ExistingIndex]
+          : ViewportStreamSubscriptions.AddDefaulted_GetRef();
+  // Captures still in flight for the old settings are dropped on arrival.
+  Subscription = FViewportStreamSubscription();
+  Subscription.Socket = Socket;
+  Subscription.bBoundToSocket = Socket.IsValid();
+  Subscription.Id = NextViewportStreamId++;
+  Subscription.Width = Width;
+  Subscription.Height = Height;
+  Subscription.bPng = bPng;
+  Subscription.Quality = Quality;
+  Subscription.IntervalSeconds = 1.0 / Fps;
+  Subscription.bOnlyOnChange = bOnlyOnChange;
+  Subscription.MaxInFlight = MaxInFlight;
+  Subscription.NextCaptureSeconds = FPlatformTime::Seconds();
+  if (ExistingIndex == INDEX_NONE) {
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Display,
+           TEXT("Viewport streaming enabled by client request (%d "
+                "subscriber(s))."),
+           ViewportStreamSubscriptions.Num());
+  }
+
+  TSharedPtr<FJsonObject> Resp = MakeShared<FJsonObject>();
+  Resp->SetBoolField(TEXT("success"), true);
+  Resp->SetBoolField(TEXT("subscribed"), true);
+  Resp->SetNumberField(TEXT("subscriptionId"), Subscription.Id);
+  Resp->SetNumberField(TEXT("fps"), Fps);
+  Resp->SetNumberField(TEXT("width"), Width);
+  Resp->SetNumberField(TEXT("height"), Height);
+  Resp->SetStringField(TEXT("format"), bPng ? TEXT("png") : TEXT("jpeg"));
+  Resp->SetNumberField(TEXT("quality"), Quality);
+  Resp->SetBoolField(TEXT("onlyOnChange"), bOnlyOnChange);
+  Resp->SetNumberField(TEXT("maxInFlight"), MaxInFlight);
+  Resp->SetStringField(TEXT("event"), TEXT("viewport_frame"));
+  SendAutomationResponse(Socket, RequestId, true,
+                         TEXT("Subscribed to viewport frames."), Resp,
+                         FString());
+  return true;
+#else
+  SendStandardErrorResponse(this, Socket, RequestId, TEXT("NOT_IMPLEMENTED"),
+                            TEXT("Viewport streaming requires editor build."),
+                            nullptr);
+  return true;
+#endif
+}
+
+bool UMcpAutomationBridgeSubsystem::HandleControlEditorUnsubscribeViewportStream(
+    const FString &RequestId, const TSharedPtr<FJsonObject> &Payload,
+    TSharedPtr<FMcpBridgeWebSocket> Socket) {
+  TSharedPtr<FJsonObject> Resp = MakeShared<FJsonObject>();
+  Resp->SetBoolField(TEXT("success"), true);
+  Resp->SetBoolField(TEXT("subscribed"), false);
+
+  const int32 ExistingIndex = ViewportStreamSubscriptions.IndexOfByPredicate(
+      [&Socket](const FViewportStreamSubscription &Existing) {
+        return Existing.bBoundToSocket == Socket.IsValid() &&
+               Existing.Socket.Pin() == Socket;
+      });
+  if (ExistingIndex != INDEX_NONE) {
+    const FViewportStreamSubscription &Subscription =
+        ViewportStreamSubscriptions[ExistingIndex];
+    TSharedPtr<FJsonObject> Stats = MakeShared<FJsonObject>();
+    Stats->SetNumberField(TEXT("framesSent"),
+                          static_cast<double>(Subscription.FramesSent));
+    Stats->SetNumberField(TEXT("framesDropped"),
+                          static_cast<double>(Subscription.FramesDropped));
+    Stats->SetNumberField(TEXT("framesUnchanged"),
+                          static_cast<double>(Subscription.FramesUnchanged));
+    Resp->SetObjectField(TEXT("stats"), Stats);
+    ViewportStreamSubscriptions.RemoveAtSwap(ExistingIndex);
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Display,
+           TEXT("Viewport streaming disabled by client request."));
+  }
+  SendAutomationResponse(Socket, RequestId, true,
+                         TEXT("Unsubscribed from viewport frames."), Resp,
+                         FString());
+  return true;
+}
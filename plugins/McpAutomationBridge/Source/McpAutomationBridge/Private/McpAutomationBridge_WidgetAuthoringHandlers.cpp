@@ -55,6 +55,7 @@
 #include "Animation/WidgetAnimation.h"
 #include "MovieScene.h"
 #include "McpAutomationBridgeHelpers.h"
+#include "McpWidgetTreeBuilder.h"
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "Kismet2/KismetEditorUtilities.h"
 #include "EditorAssetLibrary.h"
@@ -432,6 +433,80 @@ bool UMcpAutomationBridgeSubsystem::HandleManageWidgetAuthoringAction(
         return true;
     }
 
+    // Whole tree from one declarative spec, reconciled with the existing tree
+    // by widget name and compiled once; re-sending the same spec is a no-op.
+    if (SubAction.Equals(TEXT("build_widget_tree"), ESearchCase::IgnoreCase))
+    {
+        FString WidgetPath = GetJsonStringField(Payload, TEXT("widgetPath"));
+        if (WidgetPath.IsEmpty())
+        {
+            SendAutomationError(RequestingSocket, RequestId, TEXT("Missing required parameter: widgetPath"), TEXT("MISSING_PARAMETER"));
+            return true;
+        }
+
+        // SECURITY: Validate widget path
+        FString SanitizedWidgetPath = SanitizeProjectRelativePath(WidgetPath);
+        if (SanitizedWidgetPath.IsEmpty())
+        {
+            SendAutomationError(RequestingSocket, RequestId,
+                TEXT("Invalid widgetPath: path traversal or invalid characters detected"),
+                TEXT("SECURITY_VIOLATION"));
+            return true;
+        }
+        WidgetPath = SanitizedWidgetPath;
+
+        TSharedPtr<FJsonObject> RootSpec = GetObjectField(Payload, TEXT("root"));
+        if (!RootSpec.IsValid())
+        {
+            SendAutomationError(RequestingSocket, RequestId, TEXT("Missing required parameter: root (the widget spec)"), TEXT("MISSING_PARAMETER"));
+            return true;
+        }
+
+        UWidgetBlueprint* WidgetBP = LoadWidgetBlueprint(WidgetPath);
+        if (!WidgetBP || !WidgetBP->WidgetTree)
+        {
+            SendAutomationError(RequestingSocket, RequestId, TEXT("Widget blueprint not found"), TEXT("NOT_FOUND"));
+            return true;
+        }
+
+        FMcpWidgetTreeBuildOptions Options;
+        Options.bPrune = GetJsonBoolField(Payload, TEXT("prune"), true);
+        FMcpWidgetTreeBuildResult Build;
+        FString BuildError;
+        FString BuildErrorCode;
+        if (!FMcpWidgetTreeBuilder::Build(WidgetBP, RootSpec, Options, Build, BuildError, BuildErrorCode))
+        {
+            SendAutomationError(RequestingSocket, RequestId, BuildError, BuildErrorCode);
+            return true;
+        }
+
+        bool bCompiled = false;
+        bool bSaved = false;
+        if (Build.HasChanges())
+        {
+            FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(WidgetBP);
+            if (GetJsonBoolField(Payload, TEXT("compile"), true))
+            {
+                bCompiled = McpSafeCompileBlueprint(WidgetBP);
+            }
+            if (GetJsonBoolField(Payload, TEXT("save"), false))
+            {
+                bSaved = McpSafeAssetSave(WidgetBP);
+            }
+        }
+
+        ResultJson = Build.ToJson();
+        ResultJson->SetBoolField(TEXT("success"), true);
+        ResultJson->SetStringField(TEXT("widgetPath"), WidgetBP->GetPathName());
+        ResultJson->SetBoolField(TEXT("compiled"), bCompiled);
+        ResultJson->SetBoolField(TEXT("saved"), bSaved);
+
+        AddAssetVerification(ResultJson, WidgetBP);
+        SendAutomationResponse(RequestingSocket, RequestId, true,
+            Build.HasChanges() ? TEXT("Widget tree built") : TEXT("Widget tree already matches the spec"), ResultJson);
+        return true;
+    }
+
     // =========================================================================
     // 19.2 Layout Panels
     // =========================================================================
@@ -2,6 +2,7 @@
 #include "McpAutomationBridgeHelpers.h"
 #include "McpAutomationBridgeGlobals.h"
 #include "Dom/JsonObject.h"
+#include "McpWorldPartitionRegionLoader.h"
 
 
 #if WITH_EDITOR
@@ -13,33 +14,8 @@
 #include "WorldPartition/WorldPartition.h"
 #include "EngineUtils.h"  // TActorIterator for WP actor lookup
 
-// Check for WorldPartitionEditorSubsystem (UE 5.0-5.3)
-#if defined(__has_include)
-#  if __has_include("WorldPartition/WorldPartitionEditorSubsystem.h")
-#    include "WorldPartition/WorldPartitionEditorSubsystem.h"
-#    define MCP_HAS_WP_EDITOR_SUBSYSTEM 1
-#  elif __has_include("WorldPartitionEditor/WorldPartitionEditorSubsystem.h")
-#    include "WorldPartitionEditor/WorldPartitionEditorSubsystem.h"
-#    define MCP_HAS_WP_EDITOR_SUBSYSTEM 1
-#  else
-#    define MCP_HAS_WP_EDITOR_SUBSYSTEM 0
-#  endif
-#else
-#  define MCP_HAS_WP_EDITOR_SUBSYSTEM 0 
-#endif
-
-// Check for WorldPartitionEditorLoaderAdapter (UE 5.4+)
-#if defined(__has_include)
-#  if __has_include("WorldPartition/WorldPartitionEditorLoaderAdapter.h")
-#    include "WorldPartition/WorldPartitionEditorLoaderAdapter.h"
-#    include "WorldPartition/LoaderAdapter/LoaderAdapterShape.h"
-#    define MCP_HAS_WP_LOADER_ADAPTER 1
-#  else
-#    define MCP_HAS_WP_LOADER_ADAPTER 0
-#  endif
-#else
-#  define MCP_HAS_WP_LOADER_ADAPTER 0
-#endif
+// Region loading (loader adapters / editor subsystem) lives in
+// McpWorldPartitionRegionLoader.cpp.
 
 #include "WorldPartition/DataLayer/DataLayer.h"
 #include "WorldPartition/DataLayer/DataLayerSubsystem.h"
@@ -174,69 +150,138 @@ bool UMcpAutomationBridgeSubsystem::HandleWorldPartitionAction(const FString& Re
 
     if (SubAction == TEXT("load_cells"))
     {
-        // Default to a reasonable area if no bounds provided
-        FVector Origin = FVector::ZeroVector;
-        FVector Extent = FVector(25000.0f, 25000.0f, 25000.0f); // 500m box
+        // Regions in visiting order: "regions" for a sweep, or one region from
+        // origin/extent (min/max). Defaults to a 500m box around the origin.
+        auto ReadRegion = [](const TSharedPtr<FJsonObject>& Source, FMcpRegionRequest& OutRegion)
+        {
+            OutRegion.Name = GetJsonStringField(Source, TEXT("name"));
+            if (Source->HasField(TEXT("min")) && Source->HasField(TEXT("max")))
+            {
+                OutRegion.Bounds = FBox(ExtractVectorField(Source, TEXT("min"), FVector::ZeroVector),
+                                        ExtractVectorField(Source, TEXT("max"), FVector::ZeroVector));
+            }
+            else
+            {
+                const FVector Origin = ExtractVectorField(Source, TEXT("origin"), FVector::ZeroVector);
+                const FVector Extent = ExtractVectorField(Source, TEXT("extent"), FVector(25000.0, 25000.0, 25000.0));
+                OutRegion.Bounds = FBox(Origin - Extent, Origin + Extent);
+            }
+        };
 
-        const TArray<TSharedPtr<FJsonValue>>* OriginArr;
-        if (Payload->TryGetArrayField(TEXT("origin"), OriginArr) && OriginArr && OriginArr->Num() >= 3)
+        TArray<FMcpRegionRequest> Regions;
+        const TArray<TSharedPtr<FJsonValue>>* RegionsArr = nullptr;
+        if (Payload->TryGetArrayField(TEXT("regions"), RegionsArr) && RegionsArr)
         {
-            Origin.X = (*OriginArr)[0]->AsNumber();
-            Origin.Y = (*OriginArr)[1]->AsNumber();
-            Origin.Z = (*OriginArr)[2]->AsNumber();
+            for (const TSharedPtr<FJsonValue>& RegionVal : *RegionsArr)
+            {
+                if (RegionVal.IsValid() && RegionVal->Type == EJson::Object)
+                {
+                    ReadRegion(RegionVal->AsObject(), Regions.AddDefaulted_GetRef());
+                }
+            }
         }
-        
-        const TArray<TSharedPtr<FJsonValue>>* ExtentArr;
-        if (Payload->TryGetArrayField(TEXT("extent"), ExtentArr) && ExtentArr && ExtentArr->Num() >= 3)
+        else
         {
-            Extent.X = (*ExtentArr)[0]->AsNumber();
-            Extent.Y = (*ExtentArr)[1]->AsNumber();
-            Extent.Z = (*ExtentArr)[2]->AsNumber();
+            ReadRegion(Payload, Regions.AddDefaulted_GetRef());
         }
-        
-        FBox Bounds(Origin - Extent, Origin + Extent);
-
-#if MCP_HAS_WP_EDITOR_SUBSYSTEM
-        // Old method (UE 5.0-5.3)
-        UWorldPartitionEditorSubsystem* WPEditorSubsystem = GEditor->GetEditorSubsystem<UWorldPartitionEditorSubsystem>();
-        if (WPEditorSubsystem)
+        if (Regions.Num() == 0)
         {
-            WPEditorSubsystem->LoadRegion(Bounds);
-            TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-            Result->SetStringField(TEXT("action"), TEXT("manage_world_partition"));
-            Result->SetStringField(TEXT("subAction"), TEXT("load_cells"));
-            Result->SetStringField(TEXT("method"), TEXT("EditorSubsystem"));
-            Result->SetBoolField(TEXT("requested"), true);
-            SendAutomationResponse(RequestingSocket, RequestId, true, TEXT("Region load requested."), Result);
+            SendAutomationError(RequestingSocket, RequestId, TEXT("regions must hold at least one { origin, extent } or { min, max } object."), TEXT("INVALID_PARAMS"));
+            return true;
+        }
+        if (!FMcpWorldPartitionRegionLoader::IsSupported())
+        {
+            SendAutomationError(RequestingSocket, RequestId, TEXT("WorldPartition region loading not supported or failed in this engine version."), TEXT("NOT_SUPPORTED"));
             return true;
         }
-#endif
 
-#if MCP_HAS_WP_LOADER_ADAPTER
-        // New method (UE 5.4+)
-        if (WorldPartition)
+        FMcpRegionUnloadPolicy Policy;
+        double Number = 0.0;
+        if (Payload->TryGetNumberField(TEXT("keepBehind"), Number)) Policy.KeepBehind = FMath::Max(0, static_cast<int32>(Number));
+        if (Payload->TryGetNumberField(TEXT("maxLoadedRegions"), Number)) Policy.MaxLoadedRegions = FMath::Max(0, static_cast<int32>(Number));
+        if (Payload->TryGetNumberField(TEXT("maxMemoryMB"), Number)) Policy.MaxUsedMemoryMB = FMath::Max(0.0, Number);
+        double TimeoutSeconds = 0.0;
+        Payload->TryGetNumberField(TEXT("timeoutSeconds"), TimeoutSeconds);
+
+        // Each region loads on its own tick; the client gets a progress update
+        // per region and the response only once every region is resident.
+        TWeakObjectPtr<UMcpAutomationBridgeSubsystem> WeakSubsystem(this);
+        FMcpWorldPartitionRegionLoader::LoadRegions(World, MoveTemp(Regions), Policy, TimeoutSeconds,
+            [WeakSubsystem, RequestId](int32 Done, int32 Total, const FMcpRegionLoadResult& Region)
+            {
+                UMcpAutomationBridgeSubsystem* Subsystem = WeakSubsystem.Get();
+                return Subsystem && Subsystem->SendProgressUpdate(RequestId, 100.0f * Done / FMath::Max(1, Total),
+                    FString::Printf(TEXT("Region '%s' %s (%d/%d, %d actors)"), *Region.Name,
+                        Region.bLoaded ? TEXT("resident") : TEXT("failed"), Done, Total, Region.ResidentActors));
+            },
+            [WeakSubsystem, RequestId, RequestingSocket](const FMcpRegionPipelineResult& PipelineResult)
+            {
+                UMcpAutomationBridgeSubsystem* Subsystem = WeakSubsystem.Get();
+                if (!Subsystem)
+                {
+                    return;
+                }
+                int32 Failed = 0;
+                for (const FMcpRegionLoadResult& Region : PipelineResult.Regions)
+                {
+                    Failed += Region.bLoaded ? 0 : 1;
+                }
+                TSharedPtr<FJsonObject> Result = FMcpWorldPartitionRegionLoader::ToJson(PipelineResult);
+                Result->SetStringField(TEXT("action"), TEXT("manage_world_partition"));
+                Result->SetStringField(TEXT("subAction"), TEXT("load_cells"));
+                Result->SetNumberField(TEXT("failed"), Failed);
+                const bool bSuccess = !PipelineResult.bCancelled && !PipelineResult.bTimedOut && Failed == 0 && PipelineResult.Regions.Num() > 0;
+                const FString ErrorCode = bSuccess ? FString()
+                    : PipelineResult.bCancelled ? TEXT("CANCELLED")
+                    : PipelineResult.bTimedOut ? TEXT("TIMEOUT")
+                    : PipelineResult.Regions.Num() == 0 ? TEXT("NO_WORLD")
+                    : TEXT("LOAD_FAILED");
+                Subsystem->SendAutomationResponse(RequestingSocket, RequestId, bSuccess,
+                    FString::Printf(TEXT("%d region(s) resident, %d failed, %d unloaded."), PipelineResult.Regions.Num() - Failed, Failed, PipelineResult.Evicted.Num()),
+                    Result, ErrorCode);
+            });
+        return true;
+    }
+    else if (SubAction == TEXT("unload_cells"))
+    {
+        TArray<FString> Names;
+        const TArray<TSharedPtr<FJsonValue>>* NamesArr = nullptr;
+        if (Payload->TryGetArrayField(TEXT("regionNames"), NamesArr) && NamesArr)
         {
-             // Create a user-created loader adapter to load the region
-             UWorldPartitionEditorLoaderAdapter* EditorLoaderAdapter = WorldPartition->CreateEditorLoaderAdapter<FLoaderAdapterShape>(World, Bounds, TEXT("MCP Loaded Region"));
-             if (EditorLoaderAdapter && EditorLoaderAdapter->GetLoaderAdapter())
-             {
-                  EditorLoaderAdapter->GetLoaderAdapter()->SetUserCreated(true);
-                  EditorLoaderAdapter->GetLoaderAdapter()->Load();
-                  TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-                  Result->SetStringField(TEXT("action"), TEXT("manage_world_partition"));
-                  Result->SetStringField(TEXT("subAction"), TEXT("load_cells"));
-                  Result->SetStringField(TEXT("method"), TEXT("LoaderAdapter"));
-                  Result->SetBoolField(TEXT("requested"), true);
-                  SendAutomationResponse(RequestingSocket, RequestId, true, TEXT("Region load requested via LoaderAdapter."), Result);
-                 return true;
-             }
+            for (const TSharedPtr<FJsonValue>& NameVal : *NamesArr)
+            {
+                Names.Add(NameVal->AsString());
+            }
+        }
+        const TArray<FString> Unloaded = FMcpWorldPartitionRegionLoader::UnloadRegions(World, Names);
+        bool bCollect = true;
+        Payload->TryGetBoolField(TEXT("collectGarbage"), bCollect);
+        if (bCollect && Unloaded.Num() > 0)
+        {
+            CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
         }
-#endif
 
-        // If we reach here, neither subsystem nor adapter logic was available/successful
-        // But we should avoid sending error if it was just a fallback case; however if both failed it means not supported.
-        // Since we are refactoring to SUPPORT it, failure here is real failure.
-        SendAutomationError(RequestingSocket, RequestId, TEXT("WorldPartition region loading not supported or failed in this engine version."), TEXT("NOT_SUPPORTED"));
+        TArray<TSharedPtr<FJsonValue>> UnloadedJson;
+        for (const FString& Name : Unloaded)
+        {
+            UnloadedJson.Add(MakeShared<FJsonValueString>(Name));
+        }
+        TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+        Result->SetStringField(TEXT("action"), TEXT("manage_world_partition"));
+        Result->SetStringField(TEXT("subAction"), TEXT("unload_cells"));
+        Result->SetArrayField(TEXT("unloaded"), UnloadedJson);
+        Result->SetArrayField(TEXT("regions"), FMcpWorldPartitionRegionLoader::DescribeRegions(World));
+        SendAutomationResponse(RequestingSocket, RequestId, true, FString::Printf(TEXT("Unloaded %d region(s)."), Unloaded.Num()), Result);
+        return true;
+    }
+    else if (SubAction == TEXT("get_loaded_cells"))
+    {
+        TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+        Result->SetStringField(TEXT("action"), TEXT("manage_world_partition"));
+        Result->SetStringField(TEXT("subAction"), TEXT("get_loaded_cells"));
+        Result->SetArrayField(TEXT("regions"), FMcpWorldPartitionRegionLoader::DescribeRegions(World));
+        Result->SetNumberField(TEXT("usedMemoryMB"), static_cast<double>(FPlatformMemory::GetStats().UsedPhysical) / (1024.0 * 1024.0));
+        SendAutomationResponse(RequestingSocket, RequestId, true, TEXT("Loaded regions listed."), Result);
         return true;
     }
     else if (SubAction == TEXT("create_datalayer"))
@@ -0,0 +1,560 @@
+#include "McpBenchmark.h"
+
+#include "Camera/CameraActor.h"
+#include "Containers/Ticker.h"
+#include "CoreGlobals.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "LevelSequence.h"
+#include "LevelSequenceActor.h"
+#include "LevelSequencePlayer.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "RHI.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/Package.h"
+
+#if WITH_EDITOR
+#include "Editor.h"
+#include "EditorViewportClient.h"
+#include "IAssetViewport.h"
+#include "LevelEditor.h"
+#include "Modules/ModuleManager.h"
+#endif
+
+namespace {
+enum class EBenchmarkMetric : uint8 { Frame, Game, Render, Gpu, Rhi, Count };
+
+const TCHAR *BenchmarkMetricKey(int32 Metric) {
+  static const TCHAR *Keys[] = {TEXT("frameMs"), TEXT("gameMs"),
+                                TEXT("renderMs"), TEXT("gpuMs"),
+                                TEXT("rhiMs")};
+  return Keys[Metric];
+}
+
+constexpr int32 NumBenchmarkMetrics = static_cast<int32>(EBenchmarkMetric::Count);
+const TCHAR *BenchmarkPercentiles[] = {TEXT("p50"), TEXT("p95"), TEXT("p99")};
+
+struct FBenchmarkState {
+  TWeakObjectPtr<UWorld> World;
+  FMcpBenchmarkOptions Options;
+  bool bPlayWorld = false;
+  double StartSeconds = 0.0;
+  double MeasureStartSeconds = 0.0;
+  double LastProgressSeconds = 0.0;
+  bool bMeasuring = false;
+  bool bFinished = false;
+  bool bCancelled = false;
+  bool bRestoreRealtime = false;
+  TArray<float> Samples[NumBenchmarkMetrics];
+  TWeakObjectPtr<ACameraActor> Camera;
+  TWeakObjectPtr<AActor> PreviousViewTarget;
+  TWeakObjectPtr<ALevelSequenceActor> SequenceActor;
+  TFunction<bool(const FString &, float)> OnProgress;
+  TFunction<void(const TSharedPtr<FJsonObject> &)> OnFinished;
+};
+using FBenchmarkStateRef = TSharedRef<FBenchmarkState>;
+
+TWeakPtr<FBenchmarkState> GActiveBenchmark;
+
+#if WITH_EDITOR
+FEditorViewportClient *BenchmarkViewportClient() {
+  FLevelEditorModule *LevelEditor =
+      FModuleManager::GetModulePtr<FLevelEditorModule>(TEXT("LevelEditor"));
+  TSharedPtr<IAssetViewport> Viewport =
+      LevelEditor ? LevelEditor->GetFirstActiveViewport() : nullptr;
+  return Viewport.IsValid() ? &Viewport->GetAssetViewportClient() : nullptr;
+}
+#endif
+
+// Camera transform at PathTime along keys spread evenly over PathSeconds.
+FTransform SampleBenchmarkPath(const FMcpBenchmarkOptions &Options,
+                               double PathTime) {
+  const TArray<FTransform> &Keys = Options.CameraPath;
+  if (Keys.Num() == 1) {
+    return Keys[0];
+  }
+  const double PathSeconds = Options.PathSeconds > 0.0 ? Options.PathSeconds
+                                                       : Options.DurationSeconds;
+  double Alpha = PathSeconds > 0.0 ? PathTime / PathSeconds : 1.0;
+  Alpha = Options.bLoopPath ? FMath::Fmod(Alpha, 1.0) : FMath::Clamp(Alpha, 0.0, 1.0);
+  const double Position = Alpha * (Keys.Num() - 1);
+  const int32 Index = FMath::Min(FMath::FloorToInt(Position), Keys.Num() - 2);
+  const double Fraction = Position - Index;
+  FTransform Out;
+  Out.SetLocation(FMath::Lerp(Keys[Index].GetLocation(),
+                              Keys[Index + 1].GetLocation(), Fraction));
+  Out.SetRotation(FQuat::Slerp(Keys[Index].GetRotation(),
+                               Keys[Index + 1].GetRotation(), Fraction));
+  return Out;
+}
+
+void ApplyBenchmarkCamera(const FBenchmarkStateRef &State, double PathTime) {
+  if (State->Options.CameraPath.Num() == 0) {
+    return;
+  }
+  const FTransform Pose = SampleBenchmarkPath(State->Options, PathTime);
+  if (State->bPlayWorld) {
+    if (ACameraActor *Camera = State->Camera.Get()) {
+      Camera->SetActorLocationAndRotation(Pose.GetLocation(), Pose.GetRotation());
+    }
+    return;
+  }
+#if WITH_EDITOR
+  if (FEditorViewportClient *Client = BenchmarkViewportClient()) {
+    Client->SetViewLocation(Pose.GetLocation());
+    Client->SetViewRotation(Pose.Rotator());
+    Client->Invalidate();
+  }
+#endif
+}
+
+void SampleBenchmarkFrame(const FBenchmarkStateRef &State, float DeltaTime) {
+  const float Values[NumBenchmarkMetrics] = {
+      DeltaTime * 1000.0f,
+      static_cast<float>(FPlatformTime::ToMilliseconds(GGameThreadTime)),
+      static_cast<float>(FPlatformTime::ToMilliseconds(GRenderThreadTime)),
+      static_cast<float>(FPlatformTime::ToMilliseconds(RHIGetGPUFrameCycles(0))),
+      static_cast<float>(FPlatformTime::ToMilliseconds(GRHIThreadTime))};
+  for (int32 Metric = 0; Metric < NumBenchmarkMetrics; ++Metric) {
+    State->Samples[Metric].Add(Values[Metric]);
+  }
+}
+
+// Nearest-rank percentile of sorted samples.
+double BenchmarkPercentile(const TArray<float> &Sorted, double Percent) {
+  if (Sorted.Num() == 0) {
+    return 0.0;
+  }
+  const int32 Rank = FMath::CeilToInt(Percent / 100.0 * Sorted.Num()) - 1;
+  return Sorted[FMath::Clamp(Rank, 0, Sorted.Num() - 1)];
+}
+
+TSharedPtr<FJsonObject> BenchmarkMetricJson(TArray<float> Samples) {
+  TSharedPtr<FJsonObject> Obj = MakeShared<FJsonObject>();
+  Samples.Sort();
+  double Sum = 0.0;
+  for (float Value : Samples) {
+    Sum += Value;
+  }
+  const bool bAny = Samples.Num() > 0;
+  // The GPU counter reads zero where the RHI does not time frames.
+  Obj->SetBoolField(TEXT("available"), bAny && Samples.Last() > 0.0f);
+  Obj->SetNumberField(TEXT("mean"), bAny ? Sum / Samples.Num() : 0.0);
+  Obj->SetNumberField(TEXT("min"), bAny ? Samples[0] : 0.0);
+  Obj->SetNumberField(TEXT("max"), bAny ? Samples.Last() : 0.0);
+  Obj->SetNumberField(TEXT("p50"), BenchmarkPercentile(Samples, 50.0));
+  Obj->SetNumberField(TEXT("p95"), BenchmarkPercentile(Samples, 95.0));
+  Obj->SetNumberField(TEXT("p99"), BenchmarkPercentile(Samples, 99.0));
+  return Obj;
+}
+
+FString BenchmarkMapName(UWorld *World) {
+  FString Map = UWorld::RemovePIEPrefix(World->GetOutermost()->GetName());
+  Map.RemoveFromStart(TEXT("/"));
+  return Map.Replace(TEXT("/"), TEXT("_"));
+}
+
+TSharedPtr<FJsonObject> BuildBenchmarkSummary(const FBenchmarkState &State) {
+  TSharedPtr<FJsonObject> Summary = MakeShared<FJsonObject>();
+  UWorld *World = State.World.Get();
+  const TArray<float> &Frames =
+      State.Samples[static_cast<int32>(EBenchmarkMetric::Frame)];
+  Summary->SetStringField(TEXT("map"), World ? BenchmarkMapName(World) : FString());
+  Summary->SetStringField(TEXT("worldType"), State.bPlayWorld ? TEXT("pie") : TEXT("editor"));
+  Summary->SetStringField(TEXT("capturedAt"), FDateTime::UtcNow().ToIso8601());
+  Summary->SetNumberField(TEXT("frames"), Frames.Num());
+  const double Seconds =
+      State.bMeasuring ? FPlatformTime::Seconds() - State.MeasureStartSeconds : 0.0;
+  Summary->SetNumberField(TEXT("seconds"), Seconds);
+  Summary->SetNumberField(TEXT("warmupSeconds"), State.Options.WarmupSeconds);
+  Summary->SetStringField(TEXT("camera"), State.Options.Sequence.IsValid()
+                                              ? TEXT("sequence")
+                                          : State.Options.CameraPath.Num() > 0
+                                              ? TEXT("path")
+                                              : TEXT("static"));
+  Summary->SetBoolField(TEXT("cancelled"), State.bCancelled);
+
+  TSharedPtr<FJsonObject> Metrics = MakeShared<FJsonObject>();
+  for (int32 Metric = 0; Metric < NumBenchmarkMetrics; ++Metric) {
+    Metrics->SetObjectField(BenchmarkMetricKey(Metric),
+                            BenchmarkMetricJson(State.Samples[Metric]));
+  }
+  Summary->SetObjectField(TEXT("metrics"), Metrics);
+
+  int32 Hitches = 0;
+  float Longest = 0.0f;
+  const TArray<double> &Edges = State.Options.HistogramEdgesMs;
+  TArray<int32> Buckets;
+  Buckets.SetNumZeroed(Edges.Num() + 1);
+  for (float FrameMs : Frames) {
+    Hitches += FrameMs >= State.Options.HitchThresholdMs ? 1 : 0;
+    Longest = FMath::Max(Longest, FrameMs);
+    int32 Bucket = 0;
+    while (Bucket < Edges.Num() && FrameMs >= Edges[Bucket]) {
+      ++Bucket;
+    }
+    ++Buckets[Bucket];
+  }
+  TSharedPtr<FJsonObject> HitchObj = MakeShared<FJsonObject>();
+  HitchObj->SetNumberField(TEXT("thresholdMs"), State.Options.HitchThresholdMs);
+  HitchObj->SetNumberField(TEXT("count"), Hitches);
+  HitchObj->SetNumberField(TEXT("perMinute"), Seconds > 0.0 ? Hitches * 60.0 / Seconds : 0.0);
+  HitchObj->SetNumberField(TEXT("longestMs"), Longest);
+  Summary->SetObjectField(TEXT("hitches"), HitchObj);
+
+  TSharedPtr<FJsonObject> Histogram = MakeShared<FJsonObject>();
+  TArray<TSharedPtr<FJsonValue>> EdgeValues;
+  for (double Edge : Edges) {
+    EdgeValues.Add(MakeShared<FJsonValueNumber>(Edge));
+  }
+  TArray<TSharedPtr<FJsonValue>> CountValues;
+  for (int32 Count : Buckets) {
+    CountValues.Add(MakeShared<FJsonValueNumber>(Count));
+  }
+  Histogram->SetArrayField(TEXT("edgesMs"), EdgeValues);
+  Histogram->SetArrayField(TEXT("counts"), CountValues);
+  Summary->SetObjectField(TEXT("histogram"), Histogram);
+  if (State.Options.bCsvProfile) {
+    Summary->SetStringField(TEXT("csvDirectory"),
+                            FPaths::ConvertRelativePathToFull(FPaths::ProfilingDir() / TEXT("CSV")));
+  }
+  return Summary;
+}
+
+void BeginBenchmarkMeasuring(const FBenchmarkStateRef &State) {
+  State->bMeasuring = true;
+  State->MeasureStartSeconds = FPlatformTime::Seconds();
+  if (ALevelSequenceActor *SequenceActor = State->SequenceActor.Get()) {
+    if (ULevelSequencePlayer *Player = SequenceActor->GetSequencePlayer()) {
+      Player->Play();
+    }
+  }
+  if (State->Options.bCsvProfile && GEngine) {
+    GEngine->Exec(State->World.Get(), TEXT("CsvProfile Start"));
+  }
+}
+
+void EndBenchmark(const FBenchmarkStateRef &State) {
+  if (State->bFinished) {
+    return;
+  }
+  State->bFinished = true;
+  UWorld *World = State->World.Get();
+  if (State->Options.bCsvProfile && State->bMeasuring && GEngine) {
+    GEngine->Exec(World, TEXT("CsvProfile Stop"));
+  }
+  if (ALevelSequenceActor *SequenceActor = State->SequenceActor.Get()) {
+    if (ULevelSequencePlayer *Player = SequenceActor->GetSequencePlayer()) {
+      Player->Stop();
+    }
+    SequenceActor->Destroy();
+  }
+  if (ACameraActor *Camera = State->Camera.Get()) {
+    if (APlayerController *PC = World ? World->GetFirstPlayerController() : nullptr) {
+      PC->SetViewTarget(State->PreviousViewTarget.Get());
+    }
+    Camera->Destroy();
+  }
+#if WITH_EDITOR
+  if (State->bRestoreRealtime) {
+    if (FEditorViewportClient *Client = BenchmarkViewportClient()) {
+      Client->SetRealtime(false);
+    }
+  }
+#endif
+
+  const TSharedPtr<FJsonObject> Summary = BuildBenchmarkSummary(*State);
+  TFunction<void(const TSharedPtr<FJsonObject> &)> OnFinished =
+      MoveTemp(State->OnFinished);
+  State->OnProgress = nullptr;
+  if (OnFinished) {
+    OnFinished(Summary);
+  }
+}
+
+// Returns whether the run should tick again.
+bool TickBenchmark(const FBenchmarkStateRef &State, float DeltaTime) {
+  if (State->bFinished) {
+    return false;
+  }
+  if (!State->World.IsValid()) {
+    State->bCancelled = true;
+    EndBenchmark(State);
+    return false;
+  }
+  const double Now = FPlatformTime::Seconds();
+  const FMcpBenchmarkOptions &Options = State->Options;
+  if (!State->bMeasuring && Now - State->StartSeconds >= Options.WarmupSeconds) {
+    BeginBenchmarkMeasuring(State);
+  } else if (State->bMeasuring) {
+    // DeltaTime is the wall time since the previous engine frame.
+    SampleBenchmarkFrame(State, DeltaTime);
+    if (Now - State->MeasureStartSeconds >= Options.DurationSeconds) {
+      EndBenchmark(State);
+      return false;
+    }
+  }
+  ApplyBenchmarkCamera(State, State->bMeasuring ? Now - State->MeasureStartSeconds : 0.0);
+
+  // About eight updates a run: each moves the percent, and a client that
+  // extends its timeout per update never runs out of extensions.
+  const double Total = Options.WarmupSeconds + Options.DurationSeconds;
+  if (State->OnProgress &&
+      Now - State->LastProgressSeconds >= FMath::Max(2.0, Total / 8.0)) {
+    State->LastProgressSeconds = Now;
+    const float Percent =
+        static_cast<float>(FMath::Clamp((Now - State->StartSeconds) / Total, 0.0, 1.0) * 100.0);
+    if (!State->OnProgress(State->bMeasuring ? TEXT("measuring") : TEXT("warmup"), Percent)) {
+      State->bCancelled = true;
+      EndBenchmark(State);
+      return false;
+    }
+  }
+  return true;
+}
+
+double BenchmarkNumber(const TSharedPtr<FJsonObject> &Obj, const TCHAR *Field) {
+  double Value = 0.0;
+  if (Obj.IsValid()) {
+    Obj->TryGetNumberField(Field, Value);
+  }
+  return Value;
+}
+} // namespace
+
+bool FMcpBenchmark::IsRunning() {
+  const TSharedPtr<FBenchmarkState> Active = GActiveBenchmark.Pin();
+  return Active.IsValid() && !Active->bFinished;
+}
+
+bool FMcpBenchmark::Start(
+    UWorld *World, FMcpBenchmarkOptions Options,
+    TFunction<bool(const FString &Phase, float Percent)> OnProgress,
+    TFunction<void(const TSharedPtr<FJsonObject> &Summary)> OnFinished,
+    FString &OutError) {
+  check(IsInGameThread());
+  if (!World) {
+    OutError = TEXT("No world to benchmark");
+    return false;
+  }
+  if (IsRunning()) {
+    OutError = TEXT("A benchmark is already running");
+    return false;
+  }
+
+  FBenchmarkStateRef State = MakeShared<FBenchmarkState>();
+  State->World = World;
+  State->bPlayWorld = World->IsGameWorld();
+  Options.WarmupSeconds = FMath::Max(0.0, Options.WarmupSeconds);
+  Options.DurationSeconds = FMath::Max(0.1, Options.DurationSeconds);
+  if (Options.HistogramEdgesMs.Num() == 0) {
+    Options.HistogramEdgesMs = {8.33, 11.11, 16.67, 33.33, 50.0, 100.0};
+  }
+  Options.HistogramEdgesMs.Sort();
+
+  if (ULevelSequence *Sequence = Options.Sequence.Get()) {
+    if (!State->bPlayWorld) {
+      OutError = TEXT("sequencePath needs a play session; start PIE first or pass cameraPath");
+      return false;
+    }
+    FMovieSceneSequencePlaybackSettings Settings;
+    Settings.LoopCount.Value = -1;
+    ALevelSequenceActor *SequenceActor = nullptr;
+    if (!ULevelSequencePlayer::CreateLevelSequencePlayer(World, Sequence, Settings,
+                                                         SequenceActor) ||
+        !SequenceActor) {
+      OutError = TEXT("Could not create a player for the sequence");
+      return false;
+    }
+    State->SequenceActor = SequenceActor;
+  } else if (Options.CameraPath.Num() > 0 && State->bPlayWorld) {
+    APlayerController *PC = World->GetFirstPlayerController();
+    if (!PC) {
+      OutError = TEXT("The play world has no player controller to view through");
+      return false;
+    }
+    FActorSpawnParameters Params;
+    Params.SpawnCollisionHandlingOverride =
+        ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+    ACameraActor *Camera = World->SpawnActor<ACameraActor>(
+        Options.CameraPath[0].GetLocation(), Options.CameraPath[0].Rotator(), Params);
+    if (!Camera) {
+      OutError = TEXT("Could not spawn the benchmark camera");
+      return false;
+    }
+    State->PreviousViewTarget = PC->GetViewTarget();
+    PC->SetViewTarget(Camera);
+    State->Camera = Camera;
+  }
+#if WITH_EDITOR
+  if (!State->bPlayWorld) {
+    // A viewport that is not realtime does not render between edits.
+    FEditorViewportClient *Client = BenchmarkViewportClient();
+    if (!Client) {
+      OutError = TEXT("No level viewport to benchmark");
+      return false;
+    }
+    if (!Client->IsRealtime()) {
+      Client->SetRealtime(true);
+      State->bRestoreRealtime = true;
+    }
+  }
+#endif
+
+  State->Options = MoveTemp(Options);
+  State->StartSeconds = FPlatformTime::Seconds();
+  State->LastProgressSeconds = State->StartSeconds;
+  State->OnProgress = MoveTemp(OnProgress);
+  State->OnFinished = MoveTemp(OnFinished);
+  const int32 ExpectedFrames =
+      FMath::Min(FMath::CeilToInt(State->Options.DurationSeconds * 240.0), 1 << 20);
+  for (TArray<float> &Samples : State->Samples) {
+    Samples.Reserve(ExpectedFrames);
+  }
+  GActiveBenchmark = State;
+
+  if (State->Options.WarmupSeconds <= 0.0) {
+    BeginBenchmarkMeasuring(State);
+  }
+  ApplyBenchmarkCamera(State, 0.0);
+  FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+      [State](float DeltaTime) { return TickBenchmark(State, DeltaTime); }));
+  return true;
+}
+
+bool FMcpBenchmark::IsValidBaselineName(const FString &Name) {
+  if (Name.IsEmpty() || Name.Len() > 64 || Name.StartsWith(TEXT("."))) {
+    return false;
+  }
+  for (TCHAR C : Name) {
+    if (!FChar::IsAlnum(C) && C != TEXT('_') && C != TEXT('-') && C != TEXT('.')) {
+      return false;
+    }
+  }
+  return true;
+}
+
+FString FMcpBenchmark::BaselinePath(const FString &Map, const FString &Name) {
+  return FPaths::ProjectSavedDir() / TEXT("McpBenchmarks") / Map /
+         (Name + TEXT(".json"));
+}
+
+bool FMcpBenchmark::SaveBaseline(const TSharedPtr<FJsonObject> &Summary,
+                                 const FString &Name, FString &OutPath,
+                                 FString &OutError) {
+  FString Map;
+  if (!Summary.IsValid() || !Summary->TryGetStringField(TEXT("map"), Map) || Map.IsEmpty()) {
+    OutError = TEXT("Benchmark summary has no map");
+    return false;
+  }
+  FString Json;
+  const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+  FJsonSerializer::Serialize(Summary.ToSharedRef(), Writer);
+  OutPath = BaselinePath(Map, Name);
+  IFileManager::Get().MakeDirectory(*FPaths::GetPath(OutPath), /*Tree=*/true);
+  if (!FFileHelper::SaveStringToFile(Json, *OutPath)) {
+    OutError = FString::Printf(TEXT("Could not write %s"), *OutPath);
+    return false;
+  }
+  OutPath = FPaths::ConvertRelativePathToFull(OutPath);
+  return true;
+}
+
+bool FMcpBenchmark::LoadBaseline(const FString &Map, const FString &Name,
+                                 TSharedPtr<FJsonObject> &OutSummary,
+                                 FString &OutError) {
+  const FString Path = BaselinePath(Map, Name);
+  FString Json;
+  if (!FFileHelper::LoadFileToString(Json, *Path)) {
+    OutError = FString::Printf(TEXT("No baseline '%s' for map %s"), *Name, *Map);
+    return false;
+  }
+  const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Json);
+  if (!FJsonSerializer::Deserialize(Reader, OutSummary) || !OutSummary.IsValid()) {
+    OutError = FString::Printf(TEXT("Baseline %s is not valid JSON"), *Path);
+    return false;
+  }
+  return true;
+}
+
+TSharedPtr<FJsonObject> FMcpBenchmark::Compare(
+    const TSharedPtr<FJsonObject> &Current,
+    const TSharedPtr<FJsonObject> &Baseline, double ThresholdPct,
+    double MinDeltaMs) {
+  TSharedPtr<FJsonObject> Diff = MakeShared<FJsonObject>();
+  const TSharedPtr<FJsonObject> *CurMetrics = nullptr;
+  const TSharedPtr<FJsonObject> *BaseMetrics = nullptr;
+  Current->TryGetObjectField(TEXT("metrics"), CurMetrics);
+  Baseline->TryGetObjectField(TEXT("metrics"), BaseMetrics);
+
+  TSharedPtr<FJsonObject> Metrics = MakeShared<FJsonObject>();
+  TArray<TSharedPtr<FJsonValue>> Regressions;
+  for (int32 Metric = 0; Metric < NumBenchmarkMetrics; ++Metric) {
+    const TCHAR *Key = BenchmarkMetricKey(Metric);
+    const TSharedPtr<FJsonObject> *Cur = nullptr;
+    const TSharedPtr<FJsonObject> *Base = nullptr;
+    if (!CurMetrics || !BaseMetrics || !(*CurMetrics)->TryGetObjectField(Key, Cur) ||
+        !(*BaseMetrics)->TryGetObjectField(Key, Base)) {
+      continue;
+    }
+    bool bCurAvailable = true;
+    bool bBaseAvailable = true;
+    (*Cur)->TryGetBoolField(TEXT("available"), bCurAvailable);
+    (*Base)->TryGetBoolField(TEXT("available"), bBaseAvailable);
+    if (!bCurAvailable || !bBaseAvailable) {
+      continue;
+    }
+    TSharedPtr<FJsonObject> MetricDiff = MakeShared<FJsonObject>();
+    for (const TCHAR *Stat : BenchmarkPercentiles) {
+      const double Was = BenchmarkNumber(*Base, Stat);
+      const double Now = BenchmarkNumber(*Cur, Stat);
+      const double DeltaMs = Now - Was;
+      const double DeltaPct = Was > 0.0 ? DeltaMs / Was * 100.0 : 0.0;
+      TSharedPtr<FJsonObject> StatDiff = MakeShared<FJsonObject>();
+      StatDiff->SetNumberField(TEXT("baseline"), Was);
+      StatDiff->SetNumberField(TEXT("current"), Now);
+      StatDiff->SetNumberField(TEXT("deltaMs"), DeltaMs);
+      StatDiff->SetNumberField(TEXT("deltaPct"), DeltaPct);
+      const bool bRegressed = DeltaPct > ThresholdPct && DeltaMs >= MinDeltaMs;
+      StatDiff->SetBoolField(TEXT("regressed"), bRegressed);
+      MetricDiff->SetObjectField(Stat, StatDiff);
+      if (bRegressed) {
+        TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>(*StatDiff);
+        Entry->SetStringField(TEXT("metric"), Key);
+        Entry->SetStringField(TEXT("stat"), Stat);
+        Regressions.Add(MakeShared<FJsonValueObject>(Entry));
+      }
+    }
+    Metrics->SetObjectField(Key, MetricDiff);
+  }
+
+  const TSharedPtr<FJsonObject> *CurHitches = nullptr;
+  const TSharedPtr<FJsonObject> *BaseHitches = nullptr;
+  if (Current->TryGetObjectField(TEXT("hitches"), CurHitches) &&
+      Baseline->TryGetObjectField(TEXT("hitches"), BaseHitches)) {
+    TSharedPtr<FJsonObject> HitchDiff = MakeShared<FJsonObject>();
+    const double Was = BenchmarkNumber(*BaseHitches, TEXT("perMinute"));
+    const double Now = BenchmarkNumber(*CurHitches, TEXT("perMinute"));
+    HitchDiff->SetNumberField(TEXT("baselinePerMinute"), Was);
+    HitchDiff->SetNumberField(TEXT("currentPerMinute"), Now);
+    HitchDiff->SetNumberField(TEXT("deltaPerMinute"), Now - Was);
+    Diff->SetObjectField(TEXT("hitches"), HitchDiff);
+  }
+
+  FString BaselineAt;
+  Baseline->TryGetStringField(TEXT("capturedAt"), BaselineAt);
+  Diff->SetStringField(TEXT("baselineCapturedAt"), BaselineAt);
+  Diff->SetNumberField(TEXT("thresholdPct"), ThresholdPct);
+  Diff->SetNumberField(TEXT("minDeltaMs"), MinDeltaMs);
+  Diff->SetObjectField(TEXT("metrics"), Metrics);
+  Diff->SetBoolField(TEXT("regressed"), Regressions.Num() > 0);
+  Diff->SetArrayField(TEXT("regressions"), Regressions);
+  return Diff;
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "Templates/Function.h"
+#include "UObject/WeakObjectPtr.h"
+
+class ULevelSequence;
+class UWorld;
+
+/** How run_benchmark drives the camera and what it measures. */
+struct FMcpBenchmarkOptions
+{
+    /** Seconds played before sampling starts, so streaming and shader compiles settle. */
+    double WarmupSeconds = 2.0;
+    /** Seconds sampled. */
+    double DurationSeconds = 10.0;
+    /** Camera keys spread evenly over PathSeconds (0 = DurationSeconds); empty keeps the camera. */
+    TArray<FTransform> CameraPath;
+    double PathSeconds = 0.0;
+    bool bLoopPath = true;
+    /** Level Sequence played (looping) while sampling; needs a play world for its camera cuts. */
+    TWeakObjectPtr<ULevelSequence> Sequence;
+    /** Frames at least this long count as hitches. */
+    double HitchThresholdMs = 50.0;
+    /** Upper edges of the frame-time histogram buckets; one more bucket holds the rest. */
+    TArray<double> HistogramEdgesMs;
+    /** Also record a CSV profile (CsvProfile Start/Stop) over the sampled frames. */
+    bool bCsvProfile = false;
+};
+
+/**
+ * A timed camera run over an editor or play world that samples per-frame frame, game thread,
+ * render thread, GPU and RHI thread times (the same counters stat unit reads) and reduces them to
+ * percentiles, hitch counts and a histogram. The summary doubles as a stored baseline, kept per
+ * map under Saved/McpBenchmarks, that later runs are compared against. One run at a time;
+ * sampled from the core ticker. Game thread only.
+ */
+class FMcpBenchmark
+{
+public:
+    /**
+     * Starts a run in World (a play world when GEditor->PlayWorld, otherwise the active level
+     * viewport's world). OnProgress runs about every eighth of the run with the phase ("warmup",
+     * "measuring") and percent done, and cancels the run by returning false; OnFinished runs once
+     * with the summary: map, worldType, frames, seconds, metrics, hitches, histogram, and
+     * "cancelled" when it was cut short.
+     * Returns false with OutError, calling neither, when the run cannot start.
+     */
+    static bool Start(UWorld* World, FMcpBenchmarkOptions Options,
+        TFunction<bool(const FString& Phase, float Percent)> OnProgress,
+        TFunction<void(const TSharedPtr<FJsonObject>& Summary)> OnFinished, FString& OutError);
+
+    static bool IsRunning();
+
+    /** Whether Name is usable as a baseline name: letters, digits, '_', '-', '.'. */
+    static bool IsValidBaselineName(const FString& Name);
+
+    /** Saved/McpBenchmarks/<map>/<Name>.json for the map of Summary ("map" field). */
+    static FString BaselinePath(const FString& Map, const FString& Name);
+
+    static bool SaveBaseline(const TSharedPtr<FJsonObject>& Summary, const FString& Name, FString& OutPath,
+        FString& OutError);
+    static bool LoadBaseline(const FString& Map, const FString& Name, TSharedPtr<FJsonObject>& OutSummary,
+        FString& OutError);
+
+    /**
+     * Per-metric p50/p95/p99 deltas of Current against Baseline, plus hitches. A percentile counts
+     * as a regression when it is more than ThresholdPct slower and at least MinDeltaMs slower, so
+     * sub-millisecond noise on fast metrics does not fail CI. "regressed" says whether any did.
+     */
+    static TSharedPtr<FJsonObject> Compare(const TSharedPtr<FJsonObject>& Current,
+        const TSharedPtr<FJsonObject>& Baseline, double ThresholdPct, double MinDeltaMs);
+};
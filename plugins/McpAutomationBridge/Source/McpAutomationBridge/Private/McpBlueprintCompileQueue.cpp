@@ -0,0 +1,313 @@
+#include "McpBlueprintCompileQueue.h"
+
+#include "Engine/Blueprint.h"
+#include "HAL/PlatformTime.h"
+#include "McpAutomationBridgeSubsystem.h"
+
+#if WITH_EDITOR
+#include "BlueprintCompilationManager.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Kismet2/CompilerResultsLog.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "Logging/TokenizedMessage.h"
+#include "RenderingThread.h"
+#endif
+
+namespace {
+int32 GBlueprintCompileScopeDepth = 0;
+TArray<TWeakObjectPtr<UBlueprint>> GQueuedBlueprintCompiles;
+
+uint64 GBlueprintCompilesRequested = 0;
+uint64 GBlueprintCompilesDeferred = 0;
+uint64 GBlueprintCompilesRun = 0;
+uint64 GBlueprintCompilesFailed = 0;
+double GBlueprintCompileSeconds = 0.0;
+
+// Keeps a pathological graph from producing a megabyte-sized reply.
+constexpr int32 MaxCompileLogMessages = 256;
+
+// Kahn's algorithm over the dependencies within the set: parent Blueprints
+// and the Blueprints a graph or variable references come first. Ties keep the
+// given order, as do the Blueprints left over by a cycle.
+TArray<UBlueprint *>
+SortBlueprintsByDependency(const TArray<UBlueprint *> &Blueprints,
+                           int32 &OutNumInCycles) {
+  TArray<UBlueprint *> Unique;
+  TMap<UBlueprint *, int32> IndexOf;
+  for (UBlueprint *Blueprint : Blueprints) {
+    if (Blueprint && !IndexOf.Contains(Blueprint)) {
+      IndexOf.Add(Blueprint, Unique.Num());
+      Unique.Add(Blueprint);
+    }
+  }
+
+  const int32 Num = Unique.Num();
+  TArray<TArray<int32>> Dependents;
+  Dependents.SetNum(Num);
+  TArray<int32> PendingDependencies;
+  PendingDependencies.SetNumZeroed(Num);
+#if WITH_EDITOR
+  for (int32 Index = 0; Index < Num; ++Index) {
+    TSet<int32> Dependencies;
+    for (UClass *Parent = Unique[Index]->ParentClass; Parent;
+         Parent = Parent->GetSuperClass()) {
+      if (const int32 *Found =
+              IndexOf.Find(UBlueprint::GetBlueprintFromClass(Parent))) {
+        Dependencies.Add(*Found);
+      }
+    }
+    TSet<TWeakObjectPtr<UBlueprint>> Referenced;
+    TSet<TWeakObjectPtr<UStruct>> ReferencedStructs;
+    FBlueprintEditorUtils::GatherDependencies(Unique[Index], Referenced,
+                                              ReferencedStructs);
+    for (const TWeakObjectPtr<UBlueprint> &Weak : Referenced) {
+      if (const int32 *Found = IndexOf.Find(Weak.Get())) {
+        Dependencies.Add(*Found);
+      }
+    }
+    Dependencies.Remove(Index);
+    for (const int32 Dependency : Dependencies) {
+      Dependents[Dependency].Add(Index);
+      ++PendingDependencies[Index];
+    }
+  }
+#endif
+
+  TArray<int32> Ready;
+  Ready.Reserve(Num);
+  for (int32 Index = 0; Index < Num; ++Index) {
+    if (PendingDependencies[Index] == 0) {
+      Ready.Add(Index);
+    }
+  }
+  TArray<bool> Emitted;
+  Emitted.SetNumZeroed(Num);
+  TArray<UBlueprint *> Ordered;
+  Ordered.Reserve(Num);
+  for (int32 Head = 0; Head < Ready.Num(); ++Head) {
+    const int32 Index = Ready[Head];
+    Emitted[Index] = true;
+    Ordered.Add(Unique[Index]);
+    for (const int32 Dependent : Dependents[Index]) {
+      if (--PendingDependencies[Dependent] == 0) {
+        Ready.Add(Dependent);
+      }
+    }
+  }
+  OutNumInCycles = Num - Ordered.Num();
+  for (int32 Index = 0; Index < Num; ++Index) {
+    if (!Emitted[Index]) {
+      Ordered.Add(Unique[Index]);
+    }
+  }
+  return Ordered;
+}
+
+#if WITH_EDITOR
+const TCHAR *BlueprintStatusName(EBlueprintStatus Status) {
+  switch (Status) {
+  case BS_Dirty:
+    return TEXT("Dirty");
+  case BS_Error:
+    return TEXT("Error");
+  case BS_UpToDate:
+    return TEXT("UpToDate");
+  case BS_BeingCreated:
+    return TEXT("BeingCreated");
+  case BS_UpToDateWithWarnings:
+    return TEXT("UpToDateWithWarnings");
+  default:
+    return TEXT("Unknown");
+  }
+}
+
+const TCHAR *CompileSeverityName(EMessageSeverity::Type Severity) {
+  switch (Severity) {
+  case EMessageSeverity::Error:
+    return TEXT("error");
+  case EMessageSeverity::Warning:
+  case EMessageSeverity::PerformanceWarning:
+    return TEXT("warning");
+  default:
+    return TEXT("info");
+  }
+}
+
+bool CompileBlueprintNow(UBlueprint *Blueprint,
+                         FMcpBlueprintCompileResult &OutResult) {
+  OutResult.BlueprintPath = Blueprint->GetPathName();
+  const double StartSeconds = FPlatformTime::Seconds();
+
+  // Compiling can drive Slate (progress, compiler log); flushing first and
+  // after keeps it from racing the render thread, which faults the D3D12
+  // viewport on UE 5.7. Garbage collection is skipped for the same reason.
+  FlushRenderingCommands();
+  FCompilerResultsLog Log;
+  FKismetEditorUtilities::CompileBlueprint(
+      Blueprint, EBlueprintCompileOptions::SkipGarbageCollection, &Log);
+  FlushRenderingCommands();
+
+  OutResult.CompileMs = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+  OutResult.NumErrors = Log.NumErrors;
+  OutResult.NumWarnings = Log.NumWarnings;
+  OutResult.Status = BlueprintStatusName(Blueprint->Status);
+  OutResult.bCompiled = Log.NumErrors == 0 && Blueprint->Status != BS_Error;
+  for (const TSharedRef<FTokenizedMessage> &Message : Log.Messages) {
+    if (OutResult.Messages.Num() >= MaxCompileLogMessages) {
+      break;
+    }
+    FMcpBlueprintCompileMessage &Entry = OutResult.Messages.AddDefaulted_GetRef();
+    Entry.Severity = CompileSeverityName(Message->GetSeverity());
+    Entry.Message = Message->ToText().ToString();
+  }
+
+  ++GBlueprintCompilesRun;
+  GBlueprintCompileSeconds += OutResult.CompileMs / 1000.0;
+  if (!OutResult.bCompiled) {
+    ++GBlueprintCompilesFailed;
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
+           TEXT("FMcpBlueprintCompileQueue: '%s' compiled with %d error(s)"),
+           *OutResult.BlueprintPath, OutResult.NumErrors);
+  }
+  return OutResult.bCompiled;
+}
+#endif
+} // namespace
+
+FMcpBlueprintCompileQueue::FScope::FScope() { ++GBlueprintCompileScopeDepth; }
+
+FMcpBlueprintCompileQueue::FScope::~FScope() {
+  if (--GBlueprintCompileScopeDepth == 0) {
+    Flush();
+  }
+}
+
+bool FMcpBlueprintCompileQueue::Queue(UBlueprint *Blueprint) {
+  check(IsInGameThread());
+  if (!Blueprint) {
+    return false;
+  }
+  ++GBlueprintCompilesRequested;
+#if WITH_EDITOR
+  if (GBlueprintCompileScopeDepth > 0) {
+    ++GBlueprintCompilesDeferred;
+    FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+    GQueuedBlueprintCompiles.AddUnique(Blueprint);
+    return true;
+  }
+  FMcpBlueprintCompileResult Result;
+  return CompileBlueprintNow(Blueprint, Result);
+#else
+  return true;
+#endif
+}
+
+void FMcpBlueprintCompileQueue::Flush(
+    TArray<FMcpBlueprintCompileResult> *OutResults) {
+  check(IsInGameThread());
+  // Compiling one Blueprint can queue another (dependent Blueprints), which
+  // then waits for the next flush instead of invalidating this loop.
+  TArray<TWeakObjectPtr<UBlueprint>> Queued;
+  Swap(Queued, GQueuedBlueprintCompiles);
+  TArray<UBlueprint *> Blueprints;
+  for (const TWeakObjectPtr<UBlueprint> &Weak : Queued) {
+    if (UBlueprint *Blueprint = Weak.Get()) {
+      Blueprints.Add(Blueprint);
+    }
+  }
+  TArray<FMcpBlueprintCompileResult> Results;
+  CompileMany(Blueprints, Results);
+  if (OutResults) {
+    OutResults->Append(MoveTemp(Results));
+  }
+}
+
+void FMcpBlueprintCompileQueue::CompileMany(
+    const TArray<UBlueprint *> &Blueprints,
+    TArray<FMcpBlueprintCompileResult> &OutResults, int32 *OutNumInCycles) {
+  check(IsInGameThread());
+  int32 NumInCycles = 0;
+  const TArray<UBlueprint *> Ordered =
+      SortBlueprintsByDependency(Blueprints, NumInCycles);
+  if (OutNumInCycles) {
+    *OutNumInCycles = NumInCycles;
+  }
+#if WITH_EDITOR
+  if (Ordered.Num() == 1) {
+    CompileBlueprintNow(Ordered[0], OutResults.AddDefaulted_GetRef());
+    return;
+  }
+  if (Ordered.Num() == 0) {
+    return;
+  }
+
+  // One compilation-manager pass: every Blueprint is compiled, and every
+  // dependent relinked and reinstanced, once for the whole set.
+  const double StartSeconds = FPlatformTime::Seconds();
+  FlushRenderingCommands();
+  for (UBlueprint *Blueprint : Ordered) {
+    FBlueprintCompilationManager::QueueForCompilation(Blueprint);
+  }
+  FBlueprintCompilationManager::FlushCompilationQueueAndReinstance();
+  FlushRenderingCommands();
+  GBlueprintCompilesRun += Ordered.Num();
+  GBlueprintCompileSeconds += FPlatformTime::Seconds() - StartSeconds;
+
+  OutResults.Reserve(OutResults.Num() + Ordered.Num());
+  for (UBlueprint *Blueprint : Ordered) {
+    FMcpBlueprintCompileResult &Result = OutResults.AddDefaulted_GetRef();
+    if (Blueprint->Status == BS_Error) {
+      // The pass keeps no log per Blueprint; compiling a failure alone again
+      // is what recovers its messages.
+      CompileBlueprintNow(Blueprint, Result);
+      continue;
+    }
+    Result.BlueprintPath = Blueprint->GetPathName();
+    Result.Status = BlueprintStatusName(Blueprint->Status);
+    Result.bCompiled = true;
+  }
+#endif
+}
+
+TSharedPtr<FJsonObject>
+FMcpBlueprintCompileQueue::ToJson(const FMcpBlueprintCompileResult &Result) {
+  TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+  Json->SetStringField(TEXT("blueprintPath"), Result.BlueprintPath);
+  Json->SetBoolField(TEXT("compiled"), Result.bCompiled);
+  Json->SetStringField(TEXT("status"), Result.Status);
+  Json->SetNumberField(TEXT("errors"), Result.NumErrors);
+  Json->SetNumberField(TEXT("warnings"), Result.NumWarnings);
+  Json->SetNumberField(TEXT("compileMs"), Result.CompileMs);
+  TArray<TSharedPtr<FJsonValue>> Log;
+  Log.Reserve(Result.Messages.Num());
+  for (const FMcpBlueprintCompileMessage &Message : Result.Messages) {
+    TSharedPtr<FJsonObject> MessageJson = MakeShared<FJsonObject>();
+    MessageJson->SetStringField(TEXT("severity"), Message.Severity);
+    MessageJson->SetStringField(TEXT("message"), Message.Message);
+    Log.Add(MakeShared<FJsonValueObject>(MessageJson));
+  }
+  Json->SetArrayField(TEXT("log"), Log);
+  return Json;
+}
+
+TSharedPtr<FJsonObject> FMcpBlueprintCompileQueue::GetStats(bool bReset) {
+  TSharedPtr<FJsonObject> Stats = MakeShared<FJsonObject>();
+  Stats->SetNumberField(TEXT("requested"),
+                        static_cast<double>(GBlueprintCompilesRequested));
+  Stats->SetNumberField(TEXT("deferred"),
+                        static_cast<double>(GBlueprintCompilesDeferred));
+  Stats->SetNumberField(TEXT("compiled"),
+                        static_cast<double>(GBlueprintCompilesRun));
+  Stats->SetNumberField(TEXT("failed"),
+                        static_cast<double>(GBlueprintCompilesFailed));
+  Stats->SetNumberField(TEXT("compileMs"), GBlueprintCompileSeconds * 1000.0);
+  Stats->SetNumberField(TEXT("pending"), GQueuedBlueprintCompiles.Num());
+  if (bReset) {
+    GBlueprintCompilesRequested = 0;
+    GBlueprintCompilesDeferred = 0;
+    GBlueprintCompilesRun = 0;
+    GBlueprintCompilesFailed = 0;
+    GBlueprintCompileSeconds = 0.0;
+  }
+  return Stats;
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+class UBlueprint;
+
+/** One message of a Kismet compile log. */
+struct FMcpBlueprintCompileMessage
+{
+    /** "error", "warning" or "info". */
+    FString Severity;
+    FString Message;
+};
+
+/** Outcome of one Blueprint compiled by FMcpBlueprintCompileQueue. */
+struct FMcpBlueprintCompileResult
+{
+    FString BlueprintPath;
+    bool bCompiled = false;
+
+    /** EBlueprintStatus after the compile: "UpToDate", "UpToDateWithWarnings", "Error", ... */
+    FString Status;
+    int32 NumErrors = 0;
+    int32 NumWarnings = 0;
+
+    /** Zero for a Blueprint compiled as part of a multi-Blueprint pass, which is timed as a whole. */
+    double CompileMs = 0.0;
+
+    /**
+     * Compiler log, capped at the first few hundred entries. A multi-Blueprint pass keeps no
+     * per-Blueprint log, so only the Blueprints it left in error are recompiled alone for theirs.
+     */
+    TArray<FMcpBlueprintCompileMessage> Messages;
+};
+
+/**
+ * Blueprint compiles requested while an edit session is open, run once per Blueprint when the
+ * outermost scope closes (or the session commits), so N structural edits pay one Kismet compile
+ * instead of N. A deferred request only regenerates the skeleton class through
+ * FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified, which keeps new variables, functions
+ * and components visible to the edits that follow; the generated class and CDO are stale until the
+ * flush. Outside a scope a compile runs at once. Game thread only.
+ */
+class FMcpBlueprintCompileQueue
+{
+public:
+    /** Defers the compiles queued during its lifetime until the outermost scope closes. */
+    class FScope
+    {
+    public:
+        FScope();
+        ~FScope();
+
+        FScope(const FScope&) = delete;
+        FScope& operator=(const FScope&) = delete;
+    };
+
+    /**
+     * Compiles Blueprint, or queues it while a scope is open. Returns whether the compile succeeded
+     * when it ran at once, and true once queued.
+     */
+    static bool Queue(UBlueprint* Blueprint);
+
+    /** Compiles every queued Blueprint now, through CompileMany, and reports each one. */
+    static void Flush(TArray<FMcpBlueprintCompileResult>* OutResults = nullptr);
+
+    /**
+     * Compiles Blueprints in one FBlueprintCompilationManager pass, so each dependent is resolved
+     * and reinstanced once rather than once per compile. Results come back in dependency order
+     * (parents and referenced Blueprints first); OutNumInCycles counts the Blueprints caught in, or
+     * depending on, a reference cycle, which keep their given order after the rest.
+     */
+    static void CompileMany(const TArray<UBlueprint*>& Blueprints, TArray<FMcpBlueprintCompileResult>& OutResults, int32* OutNumInCycles = nullptr);
+
+    /** blueprintPath, compiled, status, errors, warnings, compileMs and log of Result. */
+    static TSharedPtr<FJsonObject> ToJson(const FMcpBlueprintCompileResult& Result);
+
+    /** Requested, deferred and compiled counts for get_bridge_metrics. */
+    static TSharedPtr<FJsonObject> GetStats(bool bReset);
+};
@@ -0,0 +1,199 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Platform socket calls for descriptors the bridge takes over from FSocket. FSocket only hands
+ * its descriptor out through ReleaseNativeSocket(), which arrived in UE 5.7; on older engines
+ * the reactor cannot wait on its sockets and falls back to polling them.
+ *
+ * Handles are carried as UPTRINT with 0 meaning "none", matching NativeSocketHandle.
+ */
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 7)
+#define MCP_BRIDGE_NATIVE_SOCKETS 1
+#else
+#define MCP_BRIDGE_NATIVE_SOCKETS 0
+#endif
+
+#if MCP_BRIDGE_NATIVE_SOCKETS
+
+#if PLATFORM_WINDOWS
+#include "Windows/AllowWindowsPlatformTypes.h"
+#include <winsock2.h>
+#include "Windows/HideWindowsPlatformTypes.h"
+#else
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace McpBridgeNativeSocket
+{
+#if PLATFORM_WINDOWS
+using FPollEntry = WSAPOLLFD;
+using FNativeHandle = SOCKET;
+#else
+using FPollEntry = pollfd;
+using FNativeHandle = int;
+#endif
+
+inline FNativeHandle ToNative(UPTRINT Handle) { return static_cast<FNativeHandle>(Handle); }
+
+/** Switches a handle to non-blocking mode and keeps writes to a dead peer from raising SIGPIPE. */
+inline bool ConfigureNonBlocking(UPTRINT Handle)
+{
+#if PLATFORM_WINDOWS
+    u_long NonBlocking = 1;
+    return ioctlsocket(ToNative(Handle), FIONBIO, &NonBlocking) == 0;
+#else
+#if defined(SO_NOSIGPIPE)
+    const int NoSigPipe = 1;
+    setsockopt(ToNative(Handle), SOL_SOCKET, SO_NOSIGPIPE, &NoSigPipe, sizeof(NoSigPipe));
+#endif
+    const int Flags = fcntl(ToNative(Handle), F_GETFL, 0);
+    return Flags >= 0 && fcntl(ToNative(Handle), F_SETFL, Flags | O_NONBLOCK) == 0;
+#endif
+}
+
+/** True when the last failed call only means "try again once the socket is ready". */
+inline bool LastErrorWouldBlock()
+{
+#if PLATFORM_WINDOWS
+    const int Error = WSAGetLastError();
+    return Error == WSAEWOULDBLOCK || Error == WSAEINTR;
+#else
+    return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+#endif
+}
+
+/** Returns the bytes written, 0 when the send buffer is full, or -1 on failure. */
+inline int32 Send(UPTRINT Handle, const uint8* Data, int32 Length)
+{
+#if PLATFORM_WINDOWS
+    const int Result = send(ToNative(Handle), reinterpret_cast<const char*>(Data), Length, 0);
+#elif defined(MSG_NOSIGNAL)
+    const ssize_t Result = send(ToNative(Handle), Data, static_cast<size_t>(Length), MSG_NOSIGNAL);
+#else
+    const ssize_t Result = send(ToNative(Handle), Data, static_cast<size_t>(Length), 0);
+#endif
+    if (Result >= 0)
+    {
+        return static_cast<int32>(Result);
+    }
+    return LastErrorWouldBlock() ? 0 : -1;
+}
+
+/** Returns the bytes read, 0 when nothing is pending, or -1 on failure or an orderly shutdown. */
+inline int32 Recv(UPTRINT Handle, uint8* Data, int32 Length)
+{
+#if PLATFORM_WINDOWS
+    const int Result = recv(ToNative(Handle), reinterpret_cast<char*>(Data), Length, 0);
+#else
+    const ssize_t Result = recv(ToNative(Handle), Data, static_cast<size_t>(Length), 0);
+#endif
+    if (Result > 0)
+    {
+        return static_cast<int32>(Result);
+    }
+    return Result < 0 && LastErrorWouldBlock() ? 0 : -1;
+}
+
+/** Accepts one pending connection; returns 0 when none is waiting or on failure. */
+inline UPTRINT Accept(UPTRINT ListenHandle)
+{
+#if PLATFORM_WINDOWS
+    const SOCKET Accepted = accept(ToNative(ListenHandle), nullptr, nullptr);
+    return Accepted == INVALID_SOCKET ? 0 : static_cast<UPTRINT>(Accepted);
+#else
+    const int Accepted = accept(ToNative(ListenHandle), nullptr, nullptr);
+    return Accepted < 0 ? 0 : static_cast<UPTRINT>(Accepted);
+#endif
+}
+
+inline void Close(UPTRINT Handle)
+{
+#if PLATFORM_WINDOWS
+    closesocket(ToNative(Handle));
+#else
+    close(ToNative(Handle));
+#endif
+}
+
+inline FPollEntry MakePollEntry(UPTRINT Handle, bool bRead, bool bWrite)
+{
+    FPollEntry Entry;
+    Entry.fd = ToNative(Handle);
+    Entry.events = static_cast<short>((bRead ? POLLIN : 0) | (bWrite ? POLLOUT : 0));
+    Entry.revents = 0;
+    return Entry;
+}
+
+/** poll() over the entries; returns the number with events or -1. Errors and hang-ups count as ready. */
+inline int32 Poll(FPollEntry* Entries, int32 NumEntries, int32 TimeoutMs)
+{
+#if PLATFORM_WINDOWS
+    return WSAPoll(Entries, static_cast<ULONG>(NumEntries), TimeoutMs);
+#else
+    return poll(Entries, static_cast<nfds_t>(NumEntries), TimeoutMs);
+#endif
+}
+
+/**
+ * Opens a non-blocking loopback UDP socket connected to itself. A byte sent on it makes the
+ * handle readable, which lets another thread interrupt a Poll() that includes it.
+ */
+inline UPTRINT OpenWakeSocket()
+{
+#if PLATFORM_WINDOWS
+    const SOCKET Handle = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (Handle == INVALID_SOCKET)
+    {
+        return 0;
+    }
+    int AddrLen = sizeof(sockaddr_in);
+#else
+    const int Handle = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (Handle < 0)
+    {
+        return 0;
+    }
+    socklen_t AddrLen = sizeof(sockaddr_in);
+#endif
+    sockaddr_in Addr;
+    FMemory::Memzero(Addr);
+    Addr.sin_family = AF_INET;
+    Addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    Addr.sin_port = 0;
+
+    const UPTRINT Result = static_cast<UPTRINT>(Handle);
+    if (bind(Handle, reinterpret_cast<sockaddr*>(&Addr), sizeof(Addr)) != 0 ||
+        getsockname(Handle, reinterpret_cast<sockaddr*>(&Addr), &AddrLen) != 0 ||
+        connect(Handle, reinterpret_cast<sockaddr*>(&Addr), sizeof(Addr)) != 0 ||
+        !ConfigureNonBlocking(Result))
+    {
+        Close(Result);
+        return 0;
+    }
+    return Result;
+}
+
+inline void SignalWakeSocket(UPTRINT Handle)
+{
+    // A full buffer already holds a pending wake-up, so a failed send is fine.
+    const uint8 Byte = 1;
+    Send(Handle, &Byte, 1);
+}
+
+inline void DrainWakeSocket(UPTRINT Handle)
+{
+    uint8 Buffer[64];
+    while (Recv(Handle, Buffer, sizeof(Buffer)) > 0)
+    {
+    }
+}
+} // namespace McpBridgeNativeSocket
+
+#endif // MCP_BRIDGE_NATIVE_SOCKETS
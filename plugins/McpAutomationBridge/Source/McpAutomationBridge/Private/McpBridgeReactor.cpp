@@ -0,0 +1,253 @@
+#include "McpBridgeReactor.h"
+#include "McpAutomationBridgeSubsystem.h"
+#include "McpBridgeNativeSocket.h"
+#include "McpBridgeWebSocket.h"
+
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/ScopeLock.h"
+
+namespace {
+// Fallback for sockets without a waitable handle: idle threads double their
+// wait from 1 ms up to this cap, and inbound data on those sockets is only
+// seen on the next pump.
+constexpr uint32 ReactorMaxIdleWaitMs = 16;
+// Longest a thread sleeps in poll() with nothing due. Readiness, deadlines
+// and Wake() all end the wait earlier; this only bounds a lost wake-up.
+constexpr double ReactorMaxPollWaitSeconds = 1.0;
+constexpr int32 ReactorMaxThreads = 16;
+} // namespace
+
+/** Runs one reactor slot on its own thread. */
+class FMcpBridgeReactor::FWorker final : public FRunnable {
+public:
+  FWorker(FMcpBridgeReactor &InOwner, int32 InSlotIndex)
+      : Owner(InOwner), SlotIndex(InSlotIndex) {}
+
+  virtual uint32 Run() override {
+    Owner.RunSlot(SlotIndex);
+    return 0;
+  }
+
+private:
+  FMcpBridgeReactor &Owner;
+  int32 SlotIndex;
+};
+
+FMcpBridgeReactor::FMcpBridgeReactor(int32 InNumThreads) {
+  const int32 NumThreads = FMath::Clamp(InNumThreads, 1, ReactorMaxThreads);
+  for (int32 Index = 0; Index < NumThreads; ++Index) {
+    Slots.Add(MakeUnique<FSlot>());
+  }
+}
+
+FMcpBridgeReactor::~FMcpBridgeReactor() { Stop(); }
+
+bool FMcpBridgeReactor::Start() {
+  if (bRunning) {
+    return true;
+  }
+
+  bStopping = false;
+  for (int32 Index = 0; Index < Slots.Num(); ++Index) {
+    FSlot &Slot = *Slots[Index];
+    if (!Slot.WakeEvent) {
+      Slot.WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+    }
+#if MCP_BRIDGE_NATIVE_SOCKETS
+    if (Slot.WakeSocket == 0) {
+      Slot.WakeSocket = McpBridgeNativeSocket::OpenWakeSocket();
+      if (Slot.WakeSocket == 0) {
+        UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
+               TEXT("MCP bridge I/O reactor thread %d could not open its "
+                    "wake socket; polling its sockets instead."),
+               Index);
+      }
+    }
+#endif
+    Slot.Worker = MakeUnique<FWorker>(*this, Index);
+    Slot.Thread = FRunnableThread::Create(
+        Slot.Worker.Get(),
+        *FString::Printf(TEXT("FMcpBridgeReactor%d"), Index), 0, TPri_Normal);
+    if (!Slot.Thread) {
+      UE_LOG(LogMcpAutomationBridgeSubsystem, Error,
+             TEXT("Failed to create MCP bridge I/O reactor thread %d."),
+             Index);
+      Stop();
+      return false;
+    }
+  }
+
+  bRunning = true;
+  UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
+         TEXT("MCP bridge I/O reactor started with %d thread(s)."),
+         Slots.Num());
+  return true;
+}
+
+void FMcpBridgeReactor::Stop() {
+  bStopping = true;
+  for (int32 Index = 0; Index < Slots.Num(); ++Index) {
+    Wake(Index);
+  }
+
+  for (const TUniquePtr<FSlot> &Slot : Slots) {
+    if (Slot->Thread) {
+      Slot->Thread->WaitForCompletion();
+      delete Slot->Thread;
+      Slot->Thread = nullptr;
+    }
+    Slot->Worker.Reset();
+    {
+      FScopeLock Lock(&Slot->IncomingMutex);
+      Slot->Incoming.Reset();
+    }
+    Slot->ConnectionCount = 0;
+    if (Slot->WakeEvent) {
+      FPlatformProcess::ReturnSynchEventToPool(Slot->WakeEvent);
+      Slot->WakeEvent = nullptr;
+    }
+#if MCP_BRIDGE_NATIVE_SOCKETS
+    if (Slot->WakeSocket != 0) {
+      McpBridgeNativeSocket::Close(Slot->WakeSocket);
+      Slot->WakeSocket = 0;
+    }
+#endif
+  }
+  bRunning = false;
+}
+
+void FMcpBridgeReactor::Register(
+    const TSharedPtr<FMcpBridgeWebSocket> &Connection) {
+  if (!Connection.IsValid() || bStopping || Slots.Num() == 0) {
+    return;
+  }
+
+  int32 Chosen = 0;
+  for (int32 Index = 1; Index < Slots.Num(); ++Index) {
+    if (Slots[Index]->ConnectionCount < Slots[Chosen]->ConnectionCount) {
+      Chosen = Index;
+    }
+  }
+
+  FSlot &Slot = *Slots[Chosen];
+  Connection->ReactorSlot = Chosen;
+  ++Slot.ConnectionCount;
+  {
+    FScopeLock Lock(&Slot.IncomingMutex);
+    Slot.Incoming.Add(Connection);
+  }
+  Wake(Chosen);
+}
+
+void FMcpBridgeReactor::Wake(int32 Slot) {
+  if (!Slots.IsValidIndex(Slot)) {
+    return;
+  }
+  if (Slots[Slot]->WakeEvent) {
+    Slots[Slot]->WakeEvent->Trigger();
+  }
+#if MCP_BRIDGE_NATIVE_SOCKETS
+  if (Slots[Slot]->WakeSocket != 0) {
+    McpBridgeNativeSocket::SignalWakeSocket(Slots[Slot]->WakeSocket);
+  }
+#endif
+}
+
+int32 FMcpBridgeReactor::GetConnectionCount() const {
+  int32 Total = 0;
+  for (const TUniquePtr<FSlot> &Slot : Slots) {
+    Total += Slot->ConnectionCount;
+  }
+  return Total;
+}
+
+void FMcpBridgeReactor::RunSlot(int32 SlotIndex) {
+  FSlot &Slot = *Slots[SlotIndex];
+  TArray<TSharedPtr<FMcpBridgeWebSocket>> Connections;
+  uint32 IdleWaitMs = 0;
+
+  while (!bStopping) {
+    {
+      FScopeLock Lock(&Slot.IncomingMutex);
+      Connections.Append(MoveTemp(Slot.Incoming));
+      Slot.Incoming.Reset();
+    }
+
+    bool bDidWork = false;
+    const double NowSeconds = FPlatformTime::Seconds();
+    for (int32 Index = Connections.Num() - 1; Index >= 0; --Index) {
+      bool bConnectionDidWork = false;
+      if (!Connections[Index]->PumpReactor(NowSeconds, bConnectionDidWork)) {
+        Connections.RemoveAtSwap(Index);
+        --Slot.ConnectionCount;
+      }
+      bDidWork |= bConnectionDidWork;
+    }
+
+    if (bDidWork) {
+      IdleWaitMs = 0;
+      continue;
+    }
+    IdleWaitMs = IdleWaitMs == 0
+                     ? 1
+                     : FMath::Min(IdleWaitMs * 2, ReactorMaxIdleWaitMs);
+    WaitForActivity(Slot, Connections, IdleWaitMs);
+  }
+}
+
+void FMcpBridgeReactor::WaitForActivity(
+    FSlot &Slot, const TArray<TSharedPtr<FMcpBridgeWebSocket>> &Connections,
+    uint32 FallbackWaitMs) {
+#if MCP_BRIDGE_NATIVE_SOCKETS
+  if (Slot.WakeSocket != 0) {
+    TArray<McpBridgeNativeSocket::FPollEntry, TInlineAllocator<16>> Entries;
+    Entries.Add(
+        McpBridgeNativeSocket::MakePollEntry(Slot.WakeSocket, true, false));
+
+    const double NowSeconds = FPlatformTime::Seconds();
+    double WakeAtSeconds = NowSeconds + ReactorMaxPollWaitSeconds;
+    bool bHasUnwaitableSocket = false;
+    for (const TSharedPtr<FMcpBridgeWebSocket> &Connection : Connections) {
+      FMcpBridgeWebSocket::FReactorInterest Interest;
+      Connection->GetReactorInterest(Interest);
+      if (Interest.bReady) {
+        return;
+      }
+      if (Interest.DeadlineSeconds > 0.0) {
+        WakeAtSeconds = FMath::Min(WakeAtSeconds, Interest.DeadlineSeconds);
+      }
+      if (Interest.Handle == 0) {
+        bHasUnwaitableSocket = true;
+      } else if (Interest.bRead || Interest.bWrite) {
+        Entries.Add(McpBridgeNativeSocket::MakePollEntry(
+            Interest.Handle, Interest.bRead, Interest.bWrite));
+      }
+    }
+
+    int32 TimeoutMs = FMath::Max(
+        0, FMath::CeilToInt(
+               static_cast<float>((WakeAtSeconds - NowSeconds) * 1000.0)));
+    if (bHasUnwaitableSocket) {
+      TimeoutMs = FMath::Min(TimeoutMs, static_cast<int32>(FallbackWaitMs));
+    }
+
+    const int32 Ready =
+        McpBridgeNativeSocket::Poll(Entries.GetData(), Entries.Num(), TimeoutMs);
+    if (Ready > 0) {
+      if (Entries[0].revents != 0) {
+        McpBridgeNativeSocket::DrainWakeSocket(Slot.WakeSocket);
+      }
+      return;
+    }
+    if (Ready == 0) {
+      return;
+    }
+    // poll() itself failed; fall through so a persistent error cannot spin.
+  }
+#endif
+  Slot.WakeEvent->Wait(FallbackWaitMs);
+}
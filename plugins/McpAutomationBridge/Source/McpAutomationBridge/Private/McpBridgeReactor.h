@@ -0,0 +1,59 @@
+#pragma once
+
+#include "Containers/Array.h"
+#include "HAL/CriticalSection.h"
+#include "Templates/Atomic.h"
+#include "Templates/SharedPointer.h"
+#include "Templates/UniquePtr.h"
+
+class FEvent;
+class FRunnableThread;
+class FMcpBridgeWebSocket;
+
+/**
+ * Small fixed pool of I/O threads shared by a listener and the connections it accepts.
+ * Each registered socket is pinned to the least loaded thread, which pumps it without
+ * blocking and then sleeps in poll() on the native handles of all its sockets plus a
+ * loopback wake socket that Wake() signals when a connection enqueues outbound data.
+ * Sockets whose handle cannot be waited on (engines before 5.7 keep it inside FSocket)
+ * are polled with a short exponential backoff instead.
+ */
+class FMcpBridgeReactor final : public TSharedFromThis<FMcpBridgeReactor>
+{
+public:
+    explicit FMcpBridgeReactor(int32 InNumThreads);
+    ~FMcpBridgeReactor();
+
+    bool Start();
+    /** Joins every I/O thread and drops the reactor's references to its sockets. */
+    void Stop();
+    bool IsRunning() const { return bRunning; }
+
+    void Register(const TSharedPtr<FMcpBridgeWebSocket>& Connection);
+    void Wake(int32 Slot);
+
+    int32 GetNumThreads() const { return Slots.Num(); }
+    int32 GetConnectionCount() const;
+
+private:
+    class FWorker;
+    struct FSlot
+    {
+        FCriticalSection IncomingMutex;
+        TArray<TSharedPtr<FMcpBridgeWebSocket>> Incoming;
+        TAtomic<int32> ConnectionCount{0};
+        FEvent* WakeEvent = nullptr;
+        /** Loopback UDP socket polled next to the connections; 0 when unavailable. */
+        UPTRINT WakeSocket = 0;
+        TUniquePtr<FWorker> Worker;
+        FRunnableThread* Thread = nullptr;
+    };
+
+    void RunSlot(int32 SlotIndex);
+    /** Sleeps until a socket in Connections is ready, a deadline passes or Wake() is called. */
+    void WaitForActivity(FSlot& Slot, const TArray<TSharedPtr<FMcpBridgeWebSocket>>& Connections, uint32 FallbackWaitMs);
+
+    TArray<TUniquePtr<FSlot>> Slots;
+    TAtomic<bool> bRunning{false};
+    TAtomic<bool> bStopping{false};
+};
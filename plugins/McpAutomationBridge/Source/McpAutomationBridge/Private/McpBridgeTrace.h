@@ -0,0 +1,24 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/MiscTrace.h"
+
+/**
+ * Unreal Insights instrumentation for the bridge. CPU scopes are named "McpBridge::<stage>"
+ * (socket receive, inbound parse, queue drain, handler, response send) plus one scope per
+ * handler named after its label, counters live under "McpBridge/", and every dispatch and
+ * completion drops a bookmark carrying the requestId so a hitch in the timing view can be
+ * matched to one MCP call. Everything compiles away when UE_TRACE_ENABLED is off and costs a
+ * channel check while no trace is recording.
+ */
+
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
+/** CPU scope named after a runtime string such as an action or handler label. */
+#define MCP_TRACE_LABEL_SCOPE(Label) TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(Label)
+#else
+// 5.0 only caches one name per call site, so a dynamic label would be wrong
+// after the first request; the bookmarks still carry the label there.
+#define MCP_TRACE_LABEL_SCOPE(Label) TRACE_CPUPROFILER_EVENT_SCOPE_STR("McpBridge::HandlerLabel")
+#endif
@@ -2,12 +2,17 @@
 #include "Dom/JsonObject.h"
 #include "McpAutomationBridgeSubsystem.h"
 #include "McpAutomationBridgeSettings.h"
+#include "McpBridgeNativeSocket.h"
+#include "McpBridgeReactor.h"
+#include "McpBridgeTrace.h"
 
 #include "Async/Async.h"
 #include "Containers/StringConv.h"
 #include "HAL/Event.h"
+#include "HAL/IConsoleManager.h"
 #include "HAL/PlatformAtomics.h"
 #include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
 #include "HAL/RunnableThread.h"
 #include "IPAddress.h"
 #include "Logging/LogMacros.h"
@@ -43,16 +48,19 @@
 #include "Windows/HideWindowsPlatformTypes.h"
 #endif
 
-#if PLATFORM_WINDOWS
-#include "Windows/AllowWindowsPlatformTypes.h"
-#include <winsock2.h>
-#include "Windows/HideWindowsPlatformTypes.h"
-#else
-#include <unistd.h>
-#endif
-
 #endif // WITH_SSL
 
+THIRD_PARTY_INCLUDES_START
+#include "zlib.h"
+THIRD_PARTY_INCLUDES_END
+
+#if PLATFORM_CPU_X86_FAMILY
+#include <emmintrin.h>
+#define MCP_WEBSOCKET_MASK_SSE2 1
+#elif PLATFORM_CPU_ARM_FAMILY && (defined(__ARM_NEON) || defined(_M_ARM64))
+#include <arm_neon.h>
+#define MCP_WEBSOCKET_MASK_NEON 1
+#endif
 
 namespace {
 constexpr const TCHAR *WebSocketGuid =
@@ -68,6 +76,104 @@ constexpr uint64 MaxWebSocketMessageBytes = 5ULL * 1024ULL * 1024ULL;
 constexpr uint64 MaxWebSocketFramePayloadBytes = MaxWebSocketMessageBytes;
 constexpr int32 WebSocketCloseCodeMessageTooBig = 1009;
 
+// Outbound data messages larger than this go out as continuation frames.
+constexpr SIZE_T MaxOutboundFragmentBytes = 1024 * 1024;
+// Staging buffer for coalescing a frame header with the start of its payload
+// and for masking client frames. Kept a multiple of four so chunked masking
+// never shifts the key phase.
+constexpr int32 SendScratchBytes = 64 * 1024;
+// Hard cap on bytes queued for one connection. A peer this far behind is
+// treated as stalled and further data messages are rejected.
+constexpr int64 MaxOutboundQueuedBytes = 256LL * 1024 * 1024;
+
+// Upper bound on a single readiness wait. Data wakes the receive loop
+// immediately; the timeout only bounds how long Stop()/Close() can go
+// unnoticed by a worker blocked on an idle connection.
+constexpr int32 ReceiveReadinessWaitMs = 100;
+
+// How long a server-accepted connection holds back inbound frames while the
+// game thread attaches its message handler.
+constexpr double HandlerRegistrationWaitSeconds = 0.5;
+
+// Reactor-driven connections: deadline for the HTTP upgrade request, the
+// largest upgrade request accepted, and how many outbound bytes one pump may
+// write before the thread moves on to its other sockets.
+constexpr double ReactorHandshakeTimeoutSeconds = 10.0;
+constexpr int32 ReactorMaxUpgradeRequestBytes = 16 * 1024;
+constexpr int64 ReactorOutboundBudgetBytes = 1024 * 1024;
+// How long a torn-down reactor connection keeps flushing staged bytes (e.g. a
+// served HTTP response) before the socket is closed regardless, and how much
+// staging capacity is kept for reuse once a flush completes.
+constexpr double ReactorCloseLingerSeconds = 2.0;
+constexpr int32 ReactorStagedWriteSlackBytes = 256 * 1024;
+
+// Process-wide wire byte counters for the metrics endpoint, bumped by every
+// SendRaw / RecvRaw regardless of which thread drives the socket.
+TAtomic<int64> WebSocketTotalBytesReceived{0};
+TAtomic<int64> WebSocketTotalBytesSent{0};
+TRACE_DECLARE_INT_COUNTER(McpBridgeBytesReceived,
+                          TEXT("McpBridge/BytesReceived"));
+TRACE_DECLARE_INT_COUNTER(McpBridgeBytesSent, TEXT("McpBridge/BytesSent"));
+
+const TCHAR *HttpStatusReason(int32 StatusCode) {
+  switch (StatusCode) {
+  case 200:
+    return TEXT("OK");
+  case 401:
+    return TEXT("Unauthorized");
+  case 403:
+    return TEXT("Forbidden");
+  case 404:
+    return TEXT("Not Found");
+  case 503:
+    return TEXT("Service Unavailable");
+  default:
+    return TEXT("Error");
+  }
+}
+
+// Sizes the frame at the front of Buffer from its header alone. Returns false
+// while the header is still incomplete. Oversized frames report only their
+// length fields so the parser can reject them without buffering the payload.
+bool PeekWebSocketFrameSize(const FMcpByteRingBuffer &Buffer,
+                            uint64 &OutFrameBytes) {
+  uint8 Header[14];
+  const uint64 Available =
+      static_cast<uint64>(Buffer.Peek(Header, sizeof(Header)));
+  if (Available < 2) {
+    return false;
+  }
+
+  uint64 HeaderBytes = 2;
+  uint64 PayloadLength = Header[1] & 0x7F;
+  if (PayloadLength == 126) {
+    HeaderBytes += 2;
+    if (Available < HeaderBytes) {
+      return false;
+    }
+    PayloadLength = (static_cast<uint64>(Header[2]) << 8) | Header[3];
+  } else if (PayloadLength == 127) {
+    HeaderBytes += 8;
+    if (Available < HeaderBytes) {
+      return false;
+    }
+    PayloadLength = 0;
+    for (int32 Index = 2; Index < 10; ++Index) {
+      PayloadLength = (PayloadLength << 8) | Header[Index];
+    }
+  }
+
+  if (PayloadLength > MaxWebSocketFramePayloadBytes) {
+    OutFrameBytes = HeaderBytes;
+    return true;
+  }
+  if ((Header[1] & 0x80) != 0) {
+    HeaderBytes += 4;
+  }
+  OutFrameBytes = HeaderBytes + PayloadLength;
+  return true;
+}
+
 struct FParsedWebSocketUrl {
   FString Host;
   int32 Port = 80;
@@ -226,6 +332,85 @@ void DispatchOnGameThread(TFunction<void()> &&Fn) {
   AsyncTask(ENamedThreads::GameThread, MoveTemp(Fn));
 }
 
+// RFC 7692 section 7.2.1: every compressed message ends with an empty
+// stored block that is stripped by the sender and re-added by the receiver.
+constexpr uint8 DeflateMessageTail[4] = {0x00, 0x00, 0xFF, 0xFF};
+constexpr int32 DeflateDefaultWindowBits = 15;
+constexpr int32 DeflateMinWindowBits = 9;
+
+struct FDeflateExtensionParams {
+  bool bServerNoContextTakeover = false;
+  bool bClientNoContextTakeover = false;
+  int32 ServerMaxWindowBits = DeflateDefaultWindowBits;
+  int32 ClientMaxWindowBits = DeflateDefaultWindowBits;
+  bool bClientMaxWindowBitsSet = false;
+};
+
+/**
+ * Parses one permessage-deflate offer/response out of a
+ * Sec-WebSocket-Extensions value. Returns false when no acceptable
+ * permessage-deflate entry exists (unknown parameters or window sizes
+ * zlib cannot honour reject the individual entry, per RFC 7692 5.1).
+ */
+bool ParseDeflateExtension(const FString &HeaderValue,
+                           FDeflateExtensionParams &OutParams) {
+  TArray<FString> Entries;
+  HeaderValue.ParseIntoArray(Entries, TEXT(","), true);
+  for (const FString &Entry : Entries) {
+    TArray<FString> Tokens;
+    Entry.ParseIntoArray(Tokens, TEXT(";"), true);
+    if (Tokens.Num() == 0 ||
+        !Tokens[0].TrimStartAndEnd().Equals(TEXT("permessage-deflate"),
+                                            ESearchCase::IgnoreCase)) {
+      continue;
+    }
+
+    FDeflateExtensionParams Params;
+    bool bAcceptable = true;
+    for (int32 Index = 1; Index < Tokens.Num() && bAcceptable; ++Index) {
+      FString Name;
+      FString Value;
+      if (!Tokens[Index].Split(TEXT("="), &Name, &Value)) {
+        Name = Tokens[Index];
+      }
+      Name = Name.TrimStartAndEnd();
+      Value = Value.TrimStartAndEnd().TrimQuotes();
+
+      int32 Bits = DeflateDefaultWindowBits;
+      const bool bHasBits = !Value.IsEmpty();
+      if (bHasBits && (!LexTryParseString(Bits, *Value) ||
+                       Bits < DeflateMinWindowBits ||
+                       Bits > DeflateDefaultWindowBits)) {
+        bAcceptable = false;
+        break;
+      }
+
+      if (Name.Equals(TEXT("server_no_context_takeover"),
+                      ESearchCase::IgnoreCase)) {
+        Params.bServerNoContextTakeover = true;
+      } else if (Name.Equals(TEXT("client_no_context_takeover"),
+                             ESearchCase::IgnoreCase)) {
+        Params.bClientNoContextTakeover = true;
+      } else if (Name.Equals(TEXT("server_max_window_bits"),
+                             ESearchCase::IgnoreCase)) {
+        Params.ServerMaxWindowBits = Bits;
+      } else if (Name.Equals(TEXT("client_max_window_bits"),
+                             ESearchCase::IgnoreCase)) {
+        Params.ClientMaxWindowBits = Bits;
+        Params.bClientMaxWindowBitsSet = bHasBits;
+      } else {
+        bAcceptable = false;
+      }
+    }
+
+    if (bAcceptable) {
+      OutParams = Params;
+      return true;
+    }
+  }
+  return false;
+}
+
 FString DescribeSocketError(ISocketSubsystem *SocketSubsystem,
                             const TCHAR *Context) {
   if (!SocketSubsystem) {
@@ -237,14 +422,387 @@ FString DescribeSocketError(ISocketSubsystem *SocketSubsystem,
   return FString::Printf(TEXT("%s (error=%d, %s)"), Context,
                          static_cast<int32>(LastErrorCode), *Description);
 }
+
+/**
+ * XOR a payload with a WebSocket masking key (RFC 6455 section 5.3).
+ * Src and Dst may alias for in-place unmasking. The key is replicated into a
+ * 128-bit lane (SSE2/NEON) and then a 64-bit word; every stride is a multiple
+ * of four so the key phase stays aligned and the scalar tail only handles the
+ * last 0-7 bytes.
+ */
+void ApplyWebSocketMask(const uint8 *Src, uint8 *Dst, SIZE_T Length,
+                        const uint8 (&MaskKey)[4]) {
+  uint32 Key32;
+  FMemory::Memcpy(&Key32, MaskKey, sizeof(Key32));
+  SIZE_T Index = 0;
+
+#if defined(MCP_WEBSOCKET_MASK_SSE2)
+  const __m128i Key128 = _mm_set1_epi32(static_cast<int32>(Key32));
+  for (; Index + 64 <= Length; Index += 64) {
+    const __m128i A = _mm_loadu_si128(reinterpret_cast<const __m128i *>(Src + Index));
+    const __m128i B = _mm_loadu_si128(reinterpret_cast<const __m128i *>(Src + Index + 16));
+    const __m128i C = _mm_loadu_si128(reinterpret_cast<const __m128i *>(Src + Index + 32));
+    const __m128i D = _mm_loadu_si128(reinterpret_cast<const __m128i *>(Src + Index + 48));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(Dst + Index), _mm_xor_si128(A, Key128));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(Dst + Index + 16), _mm_xor_si128(B, Key128));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(Dst + Index + 32), _mm_xor_si128(C, Key128));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(Dst + Index + 48), _mm_xor_si128(D, Key128));
+  }
+  for (; Index + 16 <= Length; Index += 16) {
+    const __m128i A = _mm_loadu_si128(reinterpret_cast<const __m128i *>(Src + Index));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(Dst + Index), _mm_xor_si128(A, Key128));
+  }
+#elif defined(MCP_WEBSOCKET_MASK_NEON)
+  const uint8x16_t Key128 = vreinterpretq_u8_u32(vdupq_n_u32(Key32));
+  for (; Index + 64 <= Length; Index += 64) {
+    const uint8x16_t A = vld1q_u8(Src + Index);
+    const uint8x16_t B = vld1q_u8(Src + Index + 16);
+    const uint8x16_t C = vld1q_u8(Src + Index + 32);
+    const uint8x16_t D = vld1q_u8(Src + Index + 48);
+    vst1q_u8(Dst + Index, veorq_u8(A, Key128));
+    vst1q_u8(Dst + Index + 16, veorq_u8(B, Key128));
+    vst1q_u8(Dst + Index + 32, veorq_u8(C, Key128));
+    vst1q_u8(Dst + Index + 48, veorq_u8(D, Key128));
+  }
+  for (; Index + 16 <= Length; Index += 16) {
+    vst1q_u8(Dst + Index, veorq_u8(vld1q_u8(Src + Index), Key128));
+  }
+#endif
+
+  const uint64 Key64 = (static_cast<uint64>(Key32) << 32) | Key32;
+  for (; Index + 8 <= Length; Index += 8) {
+    uint64 Word;
+    FMemory::Memcpy(&Word, Src + Index, sizeof(Word));
+    Word ^= Key64;
+    FMemory::Memcpy(Dst + Index, &Word, sizeof(Word));
+  }
+  for (; Index < Length; ++Index) {
+    Dst[Index] = Src[Index] ^ MaskKey[Index & 3];
+  }
+}
+
+void GenerateWebSocketMaskKey(uint8 (&OutMaskKey)[4]) {
+  for (uint8 &Byte : OutMaskKey) {
+    Byte = static_cast<uint8>(FMath::RandRange(0, 255));
+  }
+}
+
+#if !UE_BUILD_SHIPPING
+/**
+ * Console micro-benchmark for ApplyWebSocketMask against the byte-at-a-time
+ * loop it replaced. Usage: Mcp.Bridge.BenchmarkMasking [MaxMegabytes=16]
+ */
+void RunWebSocketMaskBenchmark(const TArray<FString> &Args) {
+  int32 MaxMegabytes = 16;
+  if (Args.Num() > 0) {
+    LexTryParseString(MaxMegabytes, *Args[0]);
+  }
+  MaxMegabytes = FMath::Clamp(MaxMegabytes, 1, 256);
+
+  const uint8 MaskKey[4] = {0x37, 0xFA, 0x21, 0x3D};
+  const SIZE_T MaxBytes = static_cast<SIZE_T>(MaxMegabytes) * 1024 * 1024;
+  TArray<uint8> Source;
+  Source.SetNumUninitialized(static_cast<int32>(MaxBytes));
+  for (int32 Index = 0; Index < Source.Num(); ++Index) {
+    Source[Index] = static_cast<uint8>(Index * 31 + 7);
+  }
+  TArray<uint8> Reference;
+  TArray<uint8> Vectorized;
+  Reference.SetNumUninitialized(Source.Num());
+  Vectorized.SetNumUninitialized(Source.Num());
+
+  // Odd sizes exercise the scalar tail; the loop count targets ~256 MB of
+  // traffic per size so small payloads are not dominated by timer noise.
+  const SIZE_T Sizes[] = {125, 1021, 64 * 1024 + 3, 1024 * 1024, MaxBytes};
+  for (const SIZE_T Size : Sizes) {
+    if (Size > MaxBytes) {
+      continue;
+    }
+    const int32 Iterations = static_cast<int32>(
+        FMath::Max<SIZE_T>(1, (256ULL * 1024 * 1024) / Size));
+
+    const uint8 *Src = Source.GetData();
+    uint8 *ReferenceDst = Reference.GetData();
+    const double ScalarStart = FPlatformTime::Seconds();
+    for (int32 Iter = 0; Iter < Iterations; ++Iter) {
+      for (SIZE_T Index = 0; Index < Size; ++Index) {
+        ReferenceDst[Index] = Src[Index] ^ MaskKey[Index % 4];
+      }
+    }
+    const double ScalarSeconds = FPlatformTime::Seconds() - ScalarStart;
+
+    const double VectorStart = FPlatformTime::Seconds();
+    for (int32 Iter = 0; Iter < Iterations; ++Iter) {
+      ApplyWebSocketMask(Src, Vectorized.GetData(), Size, MaskKey);
+    }
+    const double VectorSeconds = FPlatformTime::Seconds() - VectorStart;
+
+    const bool bMatches =
+        FMemory::Memcmp(Reference.GetData(), Vectorized.GetData(), Size) == 0;
+    const double TotalGigabytes =
+        static_cast<double>(Size) * Iterations / (1024.0 * 1024.0 * 1024.0);
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Display,
+           TEXT("WebSocket masking %llu bytes x%d: scalar %.2f GB/s, "
+                "vectorized %.2f GB/s (%.1fx)%s"),
+           static_cast<uint64>(Size), Iterations,
+           TotalGigabytes / FMath::Max(ScalarSeconds, 1e-9),
+           TotalGigabytes / FMath::Max(VectorSeconds, 1e-9),
+           ScalarSeconds / FMath::Max(VectorSeconds, 1e-9),
+           bMatches ? TEXT("") : TEXT(" MISMATCH"));
+  }
+}
+
+FAutoConsoleCommand WebSocketMaskBenchmarkCommand(
+    TEXT("Mcp.Bridge.BenchmarkMasking"),
+    TEXT("Measure WebSocket masking throughput (GB/s). Args: [MaxMegabytes=16]"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(&RunWebSocketMaskBenchmark));
+#endif // !UE_BUILD_SHIPPING
 } // namespace
 
+/** Runs the outbound half of a connection on its own thread. */
+class FMcpBridgeWebSocket::FOutboundWriter final : public FRunnable {
+public:
+  explicit FOutboundWriter(FMcpBridgeWebSocket &InOwner) : Owner(InOwner) {}
+
+  virtual uint32 Run() override {
+    Owner.RunOutboundWriter();
+    return 0;
+  }
+
+private:
+  FMcpBridgeWebSocket &Owner;
+};
+
+struct FMcpBridgeWebSocket::FPerMessageDeflateState {
+  z_stream Deflater;
+  z_stream Inflater;
+  bool bDeflaterReady = false;
+  bool bInflaterReady = false;
+
+  FPerMessageDeflateState() {
+    FMemory::Memzero(Deflater);
+    FMemory::Memzero(Inflater);
+  }
+
+  ~FPerMessageDeflateState() {
+    if (bDeflaterReady) {
+      deflateEnd(&Deflater);
+    }
+    if (bInflaterReady) {
+      inflateEnd(&Inflater);
+    }
+  }
+};
+
+void FMcpBridgeWebSocket::SetPerMessageDeflate(bool bEnable,
+                                               bool bContextTakeover,
+                                               int32 InThresholdBytes) {
+  bDeflateEnabled = bEnable;
+  bDeflateContextTakeover = bContextTakeover;
+  DeflateThresholdBytes = FMath::Max(0, InThresholdBytes);
+}
+
+void FMcpBridgeWebSocket::SetOutboundWatermarks(int64 InHighWatermarkBytes,
+                                                 int64 InLowWatermarkBytes) {
+  OutboundHighWatermarkBytes = FMath::Max<int64>(1, InHighWatermarkBytes);
+  OutboundLowWatermarkBytes = FMath::Clamp<int64>(InLowWatermarkBytes, 0,
+                                                  OutboundHighWatermarkBytes);
+}
+
+FString FMcpBridgeWebSocket::BuildDeflateOffer() const {
+  if (!bDeflateEnabled) {
+    return FString();
+  }
+  // client_max_window_bits without a value only advertises that we could
+  // honour a smaller window if the server asks for one.
+  FString Offer = TEXT("permessage-deflate; client_max_window_bits");
+  if (!bDeflateContextTakeover) {
+    Offer += TEXT("; client_no_context_takeover");
+  }
+  return Offer;
+}
+
+bool FMcpBridgeWebSocket::AcceptDeflateOffer(const FString &OfferHeader,
+                                             FString &OutResponseHeader) {
+  OutResponseHeader.Reset();
+  if (!bDeflateEnabled || OfferHeader.IsEmpty()) {
+    return false;
+  }
+
+  FDeflateExtensionParams Params;
+  if (!ParseDeflateExtension(OfferHeader, Params)) {
+    return false;
+  }
+
+  bDeflateLocalNoContextTakeover =
+      Params.bServerNoContextTakeover || !bDeflateContextTakeover;
+  bDeflatePeerNoContextTakeover = Params.bClientNoContextTakeover;
+  DeflateWindowBits = Params.ServerMaxWindowBits;
+
+  OutResponseHeader = TEXT("permessage-deflate");
+  if (bDeflateLocalNoContextTakeover) {
+    OutResponseHeader += TEXT("; server_no_context_takeover");
+  }
+  if (bDeflatePeerNoContextTakeover) {
+    OutResponseHeader += TEXT("; client_no_context_takeover");
+  }
+  if (DeflateWindowBits != DeflateDefaultWindowBits) {
+    OutResponseHeader +=
+        FString::Printf(TEXT("; server_max_window_bits=%d"), DeflateWindowBits);
+  }
+
+  // Created here, before any frame moves, because the writer and the reader
+  // use it from different threads without a common lock.
+  DeflateState = MakeUnique<FPerMessageDeflateState>();
+  bDeflateNegotiated = true;
+  return true;
+}
+
+bool FMcpBridgeWebSocket::ApplyDeflateResponse(const FString &ResponseHeader) {
+  FDeflateExtensionParams Params;
+  if (!ParseDeflateExtension(ResponseHeader, Params)) {
+    return false;
+  }
+
+  // Roles are mirrored on the client: our compressor is the "client" side.
+  bDeflateLocalNoContextTakeover =
+      Params.bClientNoContextTakeover || !bDeflateContextTakeover;
+  bDeflatePeerNoContextTakeover = Params.bServerNoContextTakeover;
+  DeflateWindowBits = Params.ClientMaxWindowBits;
+  DeflateState = MakeUnique<FPerMessageDeflateState>();
+  bDeflateNegotiated = true;
+  return true;
+}
+
+bool FMcpBridgeWebSocket::CompressMessage(const uint8 *Data, SIZE_T Length,
+                                          TArray<uint8> &OutCompressed) {
+  // Allocated once when the extension is negotiated.
+  if (!DeflateState) {
+    return false;
+  }
+  z_stream &Stream = DeflateState->Deflater;
+  if (!DeflateState->bDeflaterReady) {
+    // Negative window bits select a raw deflate stream (no zlib header).
+    if (deflateInit2(&Stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
+                     -DeflateWindowBits, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+      return false;
+    }
+    DeflateState->bDeflaterReady = true;
+  }
+
+  OutCompressed.Reset();
+  OutCompressed.SetNumUninitialized(static_cast<int32>(
+      deflateBound(&Stream, static_cast<uLong>(Length)) + 16));
+
+  Stream.next_in = const_cast<Bytef *>(reinterpret_cast<const Bytef *>(Data));
+  Stream.avail_in = static_cast<uInt>(Length);
+  int32 Produced = 0;
+  do {
+    if (Produced == OutCompressed.Num()) {
+      OutCompressed.AddUninitialized(FMath::Max(1024, Produced / 2));
+    }
+    Stream.next_out = OutCompressed.GetData() + Produced;
+    Stream.avail_out = static_cast<uInt>(OutCompressed.Num() - Produced);
+    const int Result = deflate(&Stream, Z_SYNC_FLUSH);
+    if (Result != Z_OK && Result != Z_BUF_ERROR) {
+      deflateReset(&Stream);
+      return false;
+    }
+    Produced = OutCompressed.Num() - static_cast<int32>(Stream.avail_out);
+  } while (Stream.avail_in > 0 || Stream.avail_out == 0);
+
+  if (Produced >= 4 &&
+      FMemory::Memcmp(OutCompressed.GetData() + Produced - 4,
+                      DeflateMessageTail, 4) == 0) {
+    Produced -= 4;
+  }
+  OutCompressed.SetNum(Produced
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4
+                       , EAllowShrinking::No
+#elif ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
+                       , false
+#endif
+  );
+
+  if (bDeflateLocalNoContextTakeover) {
+    deflateReset(&Stream);
+  }
+  return true;
+}
+
+bool FMcpBridgeWebSocket::DecompressMessage(const TArray<uint8> &Compressed,
+                                            TArray<uint8> &OutPayload) {
+  // Allocated once when the extension is negotiated.
+  if (!DeflateState) {
+    return false;
+  }
+  z_stream &Stream = DeflateState->Inflater;
+  if (!DeflateState->bInflaterReady) {
+    // Always inflate with the largest window; it can decode any smaller one.
+    if (inflateInit2(&Stream, -DeflateDefaultWindowBits) != Z_OK) {
+      return false;
+    }
+    DeflateState->bInflaterReady = true;
+  }
+
+  OutPayload.Reset();
+  OutPayload.SetNumUninitialized(
+      FMath::Min<int32>(FMath::Max(Compressed.Num() * 4, 4096),
+                        static_cast<int32>(MaxWebSocketMessageBytes)));
+
+  int32 Produced = 0;
+  const uint8 *Inputs[2] = {Compressed.GetData(), DeflateMessageTail};
+  const uInt InputSizes[2] = {static_cast<uInt>(Compressed.Num()), 4};
+  for (int32 Part = 0; Part < 2; ++Part) {
+    Stream.next_in = const_cast<Bytef *>(Inputs[Part]);
+    Stream.avail_in = InputSizes[Part];
+    // Keep going while input remains or the output window filled up, since
+    // zlib may still hold decoded bytes for a full buffer.
+    while (Stream.avail_in > 0 || Produced == OutPayload.Num()) {
+      if (Produced == OutPayload.Num()) {
+        if (static_cast<uint64>(Produced) >= MaxWebSocketMessageBytes) {
+          inflateReset(&Stream);
+          return false;
+        }
+        OutPayload.AddUninitialized(FMath::Min<int32>(
+            FMath::Max(Produced, 4096),
+            static_cast<int32>(MaxWebSocketMessageBytes) - Produced));
+      }
+      Stream.next_out = OutPayload.GetData() + Produced;
+      Stream.avail_out = static_cast<uInt>(OutPayload.Num() - Produced);
+      const int Result = inflate(&Stream, Z_SYNC_FLUSH);
+      Produced = OutPayload.Num() - static_cast<int32>(Stream.avail_out);
+      if (Result == Z_BUF_ERROR && Stream.avail_out > 0) {
+        break; // Input exhausted without further progress.
+      }
+      if (Result != Z_OK && Result != Z_BUF_ERROR &&
+          Result != Z_STREAM_END) {
+        inflateReset(&Stream);
+        return false;
+      }
+    }
+  }
+
+  OutPayload.SetNum(Produced
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4
+                    , EAllowShrinking::No
+#elif ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
+                    , false
+#endif
+  );
+
+  if (bDeflatePeerNoContextTakeover) {
+    inflateReset(&Stream);
+  }
+  return true;
+}
+
 FMcpBridgeWebSocket::FMcpBridgeWebSocket(
     const FString &InUrl, const FString &InProtocols,
     const TMap<FString, FString> &InHeaders, bool bInEnableTls,
     const FString &InTlsCertificatePath, const FString &InTlsPrivateKeyPath)
     : Url(InUrl), Socket(nullptr), Port(0), Protocols(InProtocols),
-      Headers(InHeaders), ListenHost(), PendingReceived(),
+      Headers(InHeaders), ListenHost(), ReceiveBuffer(),
       FragmentAccumulator(), bFragmentMessageActive(false), SelfWeakPtr(),
       bServerMode(false), bServerAcceptedConnection(false),
       ListenSocket(nullptr), Thread(nullptr), StopEvent(nullptr),
@@ -265,7 +823,7 @@ FMcpBridgeWebSocket::FMcpBridgeWebSocket(int32 InPort, const FString &InHost,
                                          const FString &InTlsCertificatePath,
                                          const FString &InTlsPrivateKeyPath)
     : Url(), Socket(nullptr), Port(InPort), Protocols(TEXT("mcp-automation")),
-      Headers(), ListenHost(InHost), PendingReceived(), FragmentAccumulator(),
+      Headers(), ListenHost(InHost), ReceiveBuffer(), FragmentAccumulator(),
       bFragmentMessageActive(false), SelfWeakPtr(), bServerMode(true),
       bServerAcceptedConnection(false), ListenSocket(nullptr), Thread(nullptr),
       StopEvent(nullptr), ClientSockets(), ListenBacklog(InListenBacklog),
@@ -285,7 +843,7 @@ FMcpBridgeWebSocket::FMcpBridgeWebSocket(FSocket *InClientSocket,
                                          const FString &InTlsCertificatePath,
                                          const FString &InTlsPrivateKeyPath)
     : Url(), Socket(InClientSocket), Port(0), Protocols(TEXT("mcp-automation")),
-      Headers(), ListenHost(), PendingReceived(), FragmentAccumulator(),
+      Headers(), ListenHost(), ReceiveBuffer(), FragmentAccumulator(),
       bFragmentMessageActive(false), SelfWeakPtr(), bServerMode(false),
       bServerAcceptedConnection(true), ListenSocket(nullptr), Thread(nullptr),
       StopEvent(nullptr), ClientSockets(), ListenBacklog(10),
@@ -322,6 +880,19 @@ FMcpBridgeWebSocket::~FMcpBridgeWebSocket() {
     StopEvent = nullptr;
   }
 
+  if (OutboundEvent) {
+    FPlatformProcess::ReturnSynchEventToPool(OutboundEvent);
+    OutboundEvent = nullptr;
+  }
+
+  // Normally destroyed by its server thread or reactor; this covers a
+  // reactor that stopped before pumping the listener again.
+  if (ListenSocket) {
+    ListenSocket->Close();
+    ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(ListenSocket);
+    ListenSocket = nullptr;
+  }
+
   if (FSocket *LocalSocket = DetachSocket()) {
     LocalSocket->Close();
     ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(LocalSocket);
@@ -428,13 +999,9 @@ bool FMcpBridgeWebSocket::InitializeTlsContext(bool bServer) {
   return true;
 }
 
-bool FMcpBridgeWebSocket::EstablishTls(bool bServer) {
-  if (!bUseTls) {
-    return true;
-  }
-
-#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 7
-  if (!Socket || bNativeSocketReleased) {
+bool FMcpBridgeWebSocket::BeginTls(bool bServer) {
+#if MCP_BRIDGE_NATIVE_SOCKETS
+  if (!bNativeSocketReleased && !Socket) {
     UE_LOG(LogMcpAutomationBridgeSubsystem, Error,
            TEXT("TLS requested without a valid socket."));
     return false;
@@ -444,11 +1011,10 @@ bool FMcpBridgeWebSocket::EstablishTls(bool bServer) {
     return false;
   }
 
-  NativeSocketHandle = Socket->ReleaseNativeSocket();
-  bNativeSocketReleased = true;
-  ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
-  Socket = nullptr;
-
+  // Reactor connections hand their descriptor over when they are accepted.
+  if (!bNativeSocketReleased) {
+    AdoptNativeSocket(Socket);
+  }
   if (NativeSocketHandle == 0) {
     UE_LOG(LogMcpAutomationBridgeSubsystem, Error,
            TEXT("Failed to obtain native socket handle for TLS."));
@@ -463,15 +1029,19 @@ bool FMcpBridgeWebSocket::EstablishTls(bool bServer) {
   }
 
   SSL_set_fd(SslHandle, static_cast<int>(NativeSocketHandle));
-  int Result = bServer ? SSL_accept(SslHandle) : SSL_connect(SslHandle);
-  if (Result <= 0) {
-    UE_LOG(LogMcpAutomationBridgeSubsystem, Error,
-           TEXT("TLS handshake failed (mode=%s)."),
-           bServer ? TEXT("server") : TEXT("client"));
-    return false;
+  // Staged writes are retried from a buffer that may have grown or moved
+  // since the attempt that returned SSL_ERROR_WANT_WRITE.
+  SSL_set_mode(SslHandle, SSL_MODE_ENABLE_PARTIAL_WRITE |
+                              SSL_MODE_ACCEPT_MOVING_WRITE_BUFFER);
+  if (bServer) {
+    SSL_set_accept_state(SslHandle);
+  } else {
+    SSL_set_connect_state(SslHandle);
   }
 
   bTlsServer = bServer;
+  bTlsHandshakePending = true;
+  bTlsWantsWrite = false;
   return true;
 #else
   UE_LOG(LogMcpAutomationBridgeSubsystem, Error,
@@ -481,12 +1051,67 @@ bool FMcpBridgeWebSocket::EstablishTls(bool bServer) {
 #endif
 }
 
+FMcpBridgeWebSocket::ETlsHandshakeStatus
+FMcpBridgeWebSocket::StepTlsHandshake() {
+  if (!SslHandle) {
+    return ETlsHandshakeStatus::Failed;
+  }
+  if (!bTlsHandshakePending) {
+    return ETlsHandshakeStatus::Complete;
+  }
+
+  const int Result = SSL_do_handshake(SslHandle);
+  if (Result == 1) {
+    bTlsHandshakePending = false;
+    bTlsWantsWrite = false;
+    return ETlsHandshakeStatus::Complete;
+  }
+
+  const int ErrorCode = SSL_get_error(SslHandle, Result);
+  if (ErrorCode == SSL_ERROR_WANT_READ || ErrorCode == SSL_ERROR_WANT_WRITE) {
+    bTlsWantsWrite = ErrorCode == SSL_ERROR_WANT_WRITE;
+    return ETlsHandshakeStatus::Pending;
+  }
+
+  UE_LOG(LogMcpAutomationBridgeSubsystem, Error,
+         TEXT("TLS handshake failed (mode=%s)."),
+         bTlsServer ? TEXT("server") : TEXT("client"));
+  return ETlsHandshakeStatus::Failed;
+}
+
+bool FMcpBridgeWebSocket::EstablishTls(bool bServer) {
+  if (!bUseTls) {
+    return true;
+  }
+  if (!BeginTls(bServer)) {
+    return false;
+  }
+
+  // On a blocking socket the first step runs the whole handshake; the wait
+  // only matters if the socket was left non-blocking.
+  const FTimespan WaitTimeout =
+      FTimespan::FromMilliseconds(ReceiveReadinessWaitMs);
+  while (!bStopping) {
+    switch (StepTlsHandshake()) {
+    case ETlsHandshakeStatus::Complete:
+      return true;
+    case ETlsHandshakeStatus::Failed:
+      return false;
+    default:
+      WaitForReadable(WaitTimeout);
+      break;
+    }
+  }
+  return false;
+}
+
 void FMcpBridgeWebSocket::ShutdownTls() {
   if (SslHandle) {
     SSL_shutdown(SslHandle);
     SSL_free(SslHandle);
     SslHandle = nullptr;
   }
+  bTlsHandshakePending = false;
 
   if (SslContext && bOwnsSslContext) {
     SSL_CTX_free(SslContext);
@@ -499,25 +1124,81 @@ void FMcpBridgeWebSocket::ShutdownTls() {
   }
 }
 
+#else // !WITH_SSL
+
+bool FMcpBridgeWebSocket::InitializeTlsContext(bool bServer) {
+  if (bUseTls) {
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
+           TEXT("TLS requested but WITH_SSL is not enabled."));
+  }
+  return !bUseTls;
+}
+
+bool FMcpBridgeWebSocket::BeginTls(bool bServer) {
+  UE_LOG(LogMcpAutomationBridgeSubsystem, Error,
+         TEXT("TLS requested but WITH_SSL is not enabled."));
+  return false;
+}
+
+FMcpBridgeWebSocket::ETlsHandshakeStatus
+FMcpBridgeWebSocket::StepTlsHandshake() {
+  return ETlsHandshakeStatus::Failed;
+}
+
+bool FMcpBridgeWebSocket::EstablishTls(bool bServer) {
+  if (bUseTls) {
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Error,
+           TEXT("TLS requested but WITH_SSL is not enabled."));
+    return false;
+  }
+  return true;
+}
+
+void FMcpBridgeWebSocket::ShutdownTls() {
+  // No-op when TLS is not available
+}
+
+#endif // WITH_SSL
+
+bool FMcpBridgeWebSocket::AdoptNativeSocket(FSocket *&InOutSocket) {
+#if MCP_BRIDGE_NATIVE_SOCKETS
+  if (!InOutSocket || bNativeSocketReleased) {
+    return false;
+  }
+  const UPTRINT Handle = InOutSocket->ReleaseNativeSocket();
+  if (Handle == 0) {
+    return false;
+  }
+  ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(InOutSocket);
+  InOutSocket = nullptr;
+  NativeSocketHandle = Handle;
+  bNativeSocketReleased = true;
+  return true;
+#else
+  return false;
+#endif
+}
+
 void FMcpBridgeWebSocket::CloseNativeSocket() {
+  // Only set once a descriptor was released from its FSocket.
+#if MCP_BRIDGE_NATIVE_SOCKETS
   if (NativeSocketHandle == 0) {
     return;
   }
-#if PLATFORM_WINDOWS
-  closesocket(static_cast<SOCKET>(NativeSocketHandle));
-#else
-  close(static_cast<int>(NativeSocketHandle));
-#endif
+  McpBridgeNativeSocket::Close(NativeSocketHandle);
   NativeSocketHandle = 0;
+#endif
 }
 
 bool FMcpBridgeWebSocket::SendRaw(const uint8 *Data, int32 Length,
                                  int32 &OutBytesSent) {
   OutBytesSent = 0;
+#if WITH_SSL
   if (bUseTls && SslHandle) {
     const int Result = SSL_write(SslHandle, Data, Length);
     if (Result > 0) {
       OutBytesSent = Result;
+      WebSocketTotalBytesSent += Result;
       return true;
     }
     const int ErrorCode = SSL_get_error(SslHandle, Result);
@@ -526,21 +1207,45 @@ bool FMcpBridgeWebSocket::SendRaw(const uint8 *Data, int32 Length,
     }
     return false;
   }
+#endif
+
+#if MCP_BRIDGE_NATIVE_SOCKETS
+  if (NativeSocketHandle != 0) {
+    const int32 Result =
+        McpBridgeNativeSocket::Send(NativeSocketHandle, Data, Length);
+    if (Result < 0) {
+      return false;
+    }
+    OutBytesSent = Result;
+    WebSocketTotalBytesSent += Result;
+    return true;
+  }
+#endif
 
   if (!Socket) {
     return false;
   }
 
-  return Socket->Send(Data, Length, OutBytesSent);
+  if (!Socket->Send(Data, Length, OutBytesSent)) {
+    // A full non-blocking socket is not an error; the caller retries once it
+    // drains.
+    OutBytesSent = 0;
+    return ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)
+               ->GetLastErrorCode() == SE_EWOULDBLOCK;
+  }
+  WebSocketTotalBytesSent += OutBytesSent;
+  return true;
 }
 
 bool FMcpBridgeWebSocket::RecvRaw(uint8 *Data, int32 Length,
                                  int32 &OutBytesRead) {
   OutBytesRead = 0;
+#if WITH_SSL
   if (bUseTls && SslHandle) {
     const int Result = SSL_read(SslHandle, Data, Length);
     if (Result > 0) {
       OutBytesRead = Result;
+      WebSocketTotalBytesReceived += Result;
       return true;
     }
     const int ErrorCode = SSL_get_error(SslHandle, Result);
@@ -549,78 +1254,39 @@ bool FMcpBridgeWebSocket::RecvRaw(uint8 *Data, int32 Length,
     }
     return false;
   }
+#endif
 
-  if (!Socket) {
-    return false;
-  }
-
-  return Socket->Recv(Data, Length, OutBytesRead);
-}
-
-#else // !WITH_SSL
-
-bool FMcpBridgeWebSocket::InitializeTlsContext(bool bServer) {
-  if (bUseTls) {
-    UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
-           TEXT("TLS requested but WITH_SSL is not enabled."));
-  }
-  return !bUseTls;
-}
-
-bool FMcpBridgeWebSocket::EstablishTls(bool bServer) {
-  if (bUseTls) {
-    UE_LOG(LogMcpAutomationBridgeSubsystem, Error,
-           TEXT("TLS requested but WITH_SSL is not enabled."));
-    return false;
-  }
-  return true;
-}
-
-void FMcpBridgeWebSocket::ShutdownTls() {
-  // No-op when TLS is not available
-}
-
-void FMcpBridgeWebSocket::CloseNativeSocket() {
-  // Native socket handle is only used when TLS/SSL is enabled.
-  // When WITH_SSL is disabled, this is a no-op.
-#if WITH_SSL
-  if (NativeSocketHandle == 0) {
-    return;
+#if MCP_BRIDGE_NATIVE_SOCKETS
+  if (NativeSocketHandle != 0) {
+    const int32 Result =
+        McpBridgeNativeSocket::Recv(NativeSocketHandle, Data, Length);
+    if (Result < 0) {
+      return false;
+    }
+    OutBytesRead = Result;
+    WebSocketTotalBytesReceived += Result;
+    return true;
   }
-#if PLATFORM_WINDOWS
-  closesocket(static_cast<SOCKET>(NativeSocketHandle));
-#else
-  close(static_cast<int>(NativeSocketHandle));
 #endif
-  NativeSocketHandle = 0;
-#endif // WITH_SSL
-}
 
-bool FMcpBridgeWebSocket::SendRaw(const uint8 *Data, int32 Length,
-                                 int32 &OutBytesSent) {
-  OutBytesSent = 0;
   if (!Socket) {
     return false;
   }
-  return Socket->Send(Data, Length, OutBytesSent);
-}
 
-bool FMcpBridgeWebSocket::RecvRaw(uint8 *Data, int32 Length,
-                                 int32 &OutBytesRead) {
-  OutBytesRead = 0;
-  if (!Socket) {
-    return false;
-  }
-  return Socket->Recv(Data, Length, OutBytesRead);
+  const bool bRead = Socket->Recv(Data, Length, OutBytesRead);
+  WebSocketTotalBytesReceived += OutBytesRead;
+  return bRead;
 }
 
-#endif // WITH_SSL
-
 void FMcpBridgeWebSocket::NotifyMessageHandlerRegistered() {
   bHandlerRegistered = true;
   if (HandlerReadyEvent) {
     HandlerReadyEvent->Trigger();
   }
+  // Reactor connections sit in AwaitHandler without waiting on their socket.
+  if (Reactor.IsValid()) {
+    Reactor->Wake(ReactorSlot);
+  }
 }
 
 void FMcpBridgeWebSocket::InitializeWeakSelf(
@@ -635,6 +1301,9 @@ void FMcpBridgeWebSocket::Connect() {
 
   bStopping = false;
   StopEvent = FPlatformProcess::GetSynchEventFromPool(true);
+  if (!OutboundEvent) {
+    OutboundEvent = FPlatformProcess::GetSynchEventFromPool(false);
+  }
   Thread = FRunnableThread::Create(this, TEXT("FMcpBridgeWebSocketWorker"), 0,
                                    TPri_Normal);
   if (!Thread) {
@@ -647,12 +1316,53 @@ void FMcpBridgeWebSocket::Connect() {
   }
 }
 
+void FMcpBridgeWebSocket::SetReactor(
+    const TSharedPtr<FMcpBridgeReactor> &InReactor) {
+  Reactor = InReactor;
+}
+
+void FMcpBridgeWebSocket::SetInboundTextHandler(FInboundTextHandler InHandler) {
+  InboundTextHandler = MoveTemp(InHandler);
+}
+
+void FMcpBridgeWebSocket::SetInboundBinaryHandler(
+    FInboundTextHandler InHandler) {
+  InboundBinaryHandler = MoveTemp(InHandler);
+}
+
+void FMcpBridgeWebSocket::SetHttpGetHandler(FHttpGetHandler InHandler) {
+  HttpGetHandler = MoveTemp(InHandler);
+}
+
+int64 FMcpBridgeWebSocket::GetTotalBytesReceived() {
+  return WebSocketTotalBytesReceived.Load();
+}
+
+int64 FMcpBridgeWebSocket::GetTotalBytesSent() {
+  return WebSocketTotalBytesSent.Load();
+}
+
 void FMcpBridgeWebSocket::Listen() {
-  if (Thread || !bServerMode) {
+  if (Thread || ListenSocket || NativeSocketHandle != 0 || !bServerMode) {
     return;
   }
 
   bStopping = false;
+  if (Reactor.IsValid()) {
+    // Binding is quick, so do it inline and let the reactor accept clients,
+    // polling the released descriptor where the engine allows it.
+    if (OpenListenSocket()) {
+      ListenSocket->SetNonBlocking(true);
+      AdoptNativeSocket(ListenSocket);
+      ReactorPhase = EReactorPhase::Listening;
+      Reactor->Register(SelfWeakPtr.Pin());
+    } else if (ListenSocket) {
+      ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(ListenSocket);
+      ListenSocket = nullptr;
+    }
+    return;
+  }
+
   StopEvent = FPlatformProcess::GetSynchEventFromPool(true);
   UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
          TEXT("Spawning MCP automation server thread for %s:%d"), *ListenHost,
@@ -699,6 +1409,22 @@ void FMcpBridgeWebSocket::Close(int32 StatusCode, const FString &Reason) {
     }
   }
 
+  // Reactor-driven sockets belong to their reactor thread: unblock any write
+  // in flight and let the next pump tear the connection down.
+  if (Reactor.IsValid() && Reactor->IsRunning() &&
+      ReactorPhase != EReactorPhase::None &&
+      ReactorPhase != EReactorPhase::Finished) {
+    InterruptTransport();
+    Reactor->Wake(ReactorSlot);
+    return;
+  }
+
+  // Unblock a writer stuck on a stalled peer before joining it.
+  if (WriterThread) {
+    InterruptTransport();
+  }
+  StopOutboundWriter();
+
   // Close the main socket (for client connections)
   if (FSocket *LocalSocket = DetachSocket()) {
     LocalSocket->Close();
@@ -715,18 +1441,212 @@ bool FMcpBridgeWebSocket::Send(const FString &Data) {
 }
 
 bool FMcpBridgeWebSocket::Send(const void *Data, SIZE_T Length) {
-  if (!IsConnected()) {
+  TArray<uint8> Payload(static_cast<const uint8 *>(Data),
+                        static_cast<int32>(Length));
+  return Send(MoveTemp(Payload));
+}
+
+bool FMcpBridgeWebSocket::Send(TArray<uint8> &&Utf8Payload) {
+  return EnqueueOutbound(OpCodeText, MoveTemp(Utf8Payload));
+}
+
+bool FMcpBridgeWebSocket::SendShared(
+    const TSharedRef<const TArray<uint8>, ESPMode::ThreadSafe> &Utf8Payload) {
+  return EnqueueOutbound(OpCodeText, TArray<uint8>(), Utf8Payload);
+}
+
+bool FMcpBridgeWebSocket::SendBinary(const void *Data, SIZE_T Length) {
+  TArray<uint8> Payload(static_cast<const uint8 *>(Data),
+                        static_cast<int32>(Length));
+  return SendBinary(MoveTemp(Payload));
+}
+
+bool FMcpBridgeWebSocket::SendBinary(TArray<uint8> &&Payload) {
+  return EnqueueOutbound(OpCodeBinary, MoveTemp(Payload));
+}
+
+bool FMcpBridgeWebSocket::EnqueueOutbound(uint8 OpCode,
+                                          TArray<uint8> &&Payload) {
+  return EnqueueOutbound(OpCode, MoveTemp(Payload), nullptr);
+}
+
+bool FMcpBridgeWebSocket::EnqueueOutbound(
+    uint8 OpCode, TArray<uint8> &&Payload,
+    TSharedPtr<const TArray<uint8>, ESPMode::ThreadSafe> SharedPayload) {
+  if (!IsConnected() || bStopping || bOutboundFailed) {
     return false;
   }
   if (bUseTls) {
     if (!SslHandle) {
       return false;
     }
-  } else if (!Socket) {
+  } else if (!HasTransport()) {
     return false;
   }
 
-  return SendTextFrame(Data, Length);
+  const bool bControl = OpCode >= OpCodeClose;
+  const int64 PayloadBytes =
+      SharedPayload.IsValid() ? SharedPayload->Num() : Payload.Num();
+  if (!bControl && QueuedOutboundBytes > 0 &&
+      QueuedOutboundBytes + PayloadBytes > MaxOutboundQueuedBytes) {
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
+           TEXT("Outbound queue full (%lld bytes queued); rejecting %lld-byte "
+                "message."),
+           static_cast<int64>(QueuedOutboundBytes), PayloadBytes);
+    return false;
+  }
+
+  // Count the bytes before publishing so the writer never drives the total
+  // negative.
+  const int64 Queued = (QueuedOutboundBytes += PayloadBytes);
+  FOutboundMessage Message;
+  Message.OpCode = OpCode;
+  Message.Payload = MoveTemp(Payload);
+  Message.SharedPayload = MoveTemp(SharedPayload);
+  if (bControl) {
+    OutboundControlQueue.Enqueue(MoveTemp(Message));
+  } else {
+    OutboundQueue.Enqueue(MoveTemp(Message));
+  }
+
+  if (!bOutboundBackpressured && Queued >= OutboundHighWatermarkBytes) {
+    bOutboundBackpressured = true;
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
+           TEXT("Outbound queue reached high watermark (%lld bytes queued); "
+                "pausing discardable traffic."),
+           Queued);
+    // The writer may have drained the queue between the enqueue and the
+    // latch, skipping its clear; nothing would be queued to clear it later.
+    if (QueuedOutboundBytes <= OutboundLowWatermarkBytes) {
+      bOutboundBackpressured = false;
+    }
+  }
+
+  if (OutboundEvent) {
+    OutboundEvent->Trigger();
+  }
+  if (Reactor.IsValid()) {
+    Reactor->Wake(ReactorSlot);
+  }
+  return true;
+}
+
+void FMcpBridgeWebSocket::StartOutboundWriter() {
+  if (WriterThread) {
+    return;
+  }
+  if (!OutboundEvent) {
+    OutboundEvent = FPlatformProcess::GetSynchEventFromPool(false);
+  }
+  bWriterStopping = false;
+  OutboundWriter = MakeUnique<FOutboundWriter>(*this);
+  WriterThread = FRunnableThread::Create(
+      OutboundWriter.Get(), TEXT("FMcpBridgeWebSocketWriter"), 0, TPri_Normal);
+  if (!WriterThread) {
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Error,
+           TEXT("Failed to create WebSocket writer thread."));
+    OutboundWriter.Reset();
+    bOutboundFailed = true;
+  }
+}
+
+void FMcpBridgeWebSocket::StopOutboundWriter() {
+  bWriterStopping = true;
+  if (OutboundEvent) {
+    OutboundEvent->Trigger();
+  }
+  if (WriterThread) {
+    WriterThread->WaitForCompletion();
+    delete WriterThread;
+    WriterThread = nullptr;
+  }
+  OutboundWriter.Reset();
+}
+
+void FMcpBridgeWebSocket::RunOutboundWriter() {
+  const FTimespan IdleWait =
+      FTimespan::FromMilliseconds(ReceiveReadinessWaitMs);
+
+  while (!bStopping && !bWriterStopping && bConnected) {
+    bool bDidWork = false;
+    if (!DrainOutboundQueue(MAX_int64, bDidWork)) {
+      // The reader notices on its next readiness wait and tears down.
+      bOutboundFailed = true;
+      break;
+    }
+    if (!bDidWork) {
+      OutboundEvent->Wait(IdleWait);
+    }
+  }
+
+  DiscardOutboundQueue();
+}
+
+bool FMcpBridgeWebSocket::DrainOutboundQueue(int64 ByteBudget,
+                                             bool &bOutDidWork) {
+  int64 WrittenBytes = 0;
+  FOutboundMessage Message;
+  // Bytes staged behind a full socket leave before the next message is
+  // encoded; the reactor resumes once the socket is writable again.
+  while (!bStopping && !bWriterStopping && WrittenBytes < ByteBudget &&
+         !HasStagedWrites() &&
+         (OutboundControlQueue.Dequeue(Message) ||
+          OutboundQueue.Dequeue(Message))) {
+    bOutDidWork = true;
+    TRACE_CPUPROFILER_EVENT_SCOPE_STR("McpBridge::SocketSend");
+
+    const TArray<uint8> &Payload = Message.GetPayload();
+    bool bWritten = false;
+    if (Message.OpCode >= OpCodeClose) {
+      bWritten = SendControlFrame(Message.OpCode, Payload);
+    } else if (Message.OpCode == OpCodeText) {
+      bWritten = SendTextFrame(Payload.GetData(),
+                               static_cast<SIZE_T>(Payload.Num()));
+    } else {
+      FScopeLock Guard(&SendMutex);
+      bWritten = SendDataMessage(Message.OpCode, false, Payload.GetData(),
+                                 static_cast<SIZE_T>(Payload.Num()));
+    }
+
+    const int64 Remaining = (QueuedOutboundBytes -= Payload.Num());
+    TRACE_COUNTER_SET(McpBridgeBytesSent, WebSocketTotalBytesSent.Load());
+    if (!bWritten) {
+      return false;
+    }
+    WrittenBytes += Payload.Num();
+    if (bOutboundBackpressured && Remaining <= OutboundLowWatermarkBytes) {
+      bOutboundBackpressured = false;
+      UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
+             TEXT("Outbound queue drained to %lld bytes; resuming discardable "
+                  "traffic."),
+             Remaining);
+    }
+  }
+  return true;
+}
+
+void FMcpBridgeWebSocket::DiscardOutboundQueue() {
+  // Whatever is left can no longer be delivered on this connection.
+  FOutboundMessage Dropped;
+  while (OutboundControlQueue.Dequeue(Dropped) || OutboundQueue.Dequeue(Dropped)) {
+    QueuedOutboundBytes -= Dropped.GetPayload().Num();
+  }
+  bOutboundBackpressured = false;
+}
+
+void FMcpBridgeWebSocket::InterruptTransport() {
+  if (Socket) {
+    Socket->Shutdown(ESocketShutdownMode::ReadWrite);
+  }
+#if MCP_BRIDGE_NATIVE_SOCKETS
+  if (NativeSocketHandle != 0) {
+#if PLATFORM_WINDOWS
+    shutdown(static_cast<SOCKET>(NativeSocketHandle), SD_BOTH);
+#else
+    shutdown(static_cast<int>(NativeSocketHandle), SHUT_RDWR);
+#endif
+  }
+#endif
 }
 
 bool FMcpBridgeWebSocket::IsConnected() const { return bConnected; }
@@ -734,7 +1654,7 @@ bool FMcpBridgeWebSocket::IsConnected() const { return bConnected; }
 bool FMcpBridgeWebSocket::IsListening() const { return bListening; }
 
 void FMcpBridgeWebSocket::SendHeartbeatPing() {
-  SendControlFrame(OpCodePing, TArray<uint8>());
+  EnqueueOutbound(OpCodePing, TArray<uint8>());
 }
 
 bool FMcpBridgeWebSocket::Init() { return true; }
@@ -758,16 +1678,7 @@ uint32 FMcpBridgeWebSocket::RunClient() {
     }
   }
 
-  bConnected = true;
-  UE_LOG(
-      LogMcpAutomationBridgeSubsystem, Log,
-      TEXT("FMcpBridgeWebSocket connection established (serverAccepted=%s)."),
-      bServerAcceptedConnection ? TEXT("true") : TEXT("false"));
-  DispatchOnGameThread([WeakThis = SelfWeakPtr] {
-    if (TSharedPtr<FMcpBridgeWebSocket> Pinned = WeakThis.Pin()) {
-      Pinned->ConnectedDelegate.Broadcast(Pinned);
-    }
-  });
+  OnConnectionEstablished();
 
   // If this connection was accepted by the server thread (i.e. a remote
   // client connected to the plugin), wait a short time for the game
@@ -784,12 +1695,12 @@ uint32 FMcpBridgeWebSocket::RunClient() {
       HandlerReadyEvent = FPlatformProcess::GetSynchEventFromPool(true);
     }
 
-    constexpr double MaxWaitSeconds = 0.5; // 500 ms
     UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
            TEXT("Awaiting message handler registration for new client "
                 "connection (max %.0f ms)."),
-           MaxWaitSeconds * 1000.0);
-    if (HandlerReadyEvent->Wait(FTimespan::FromSeconds(MaxWaitSeconds))) {
+           HandlerRegistrationWaitSeconds * 1000.0);
+    if (HandlerReadyEvent->Wait(
+            FTimespan::FromSeconds(HandlerRegistrationWaitSeconds))) {
       // Event triggered by game thread
     }
     if (!bHandlerRegistered) {
@@ -809,13 +1720,72 @@ uint32 FMcpBridgeWebSocket::RunClient() {
   return 0;
 }
 
+void FMcpBridgeWebSocket::OnConnectionEstablished() {
+  bConnected = true;
+  // Reactor-driven connections are written by their reactor thread.
+  if (!Reactor.IsValid()) {
+    StartOutboundWriter();
+  }
+  UE_LOG(
+      LogMcpAutomationBridgeSubsystem, Log,
+      TEXT("FMcpBridgeWebSocket connection established (serverAccepted=%s)."),
+      bServerAcceptedConnection ? TEXT("true") : TEXT("false"));
+  DispatchOnGameThread([WeakThis = SelfWeakPtr] {
+    if (TSharedPtr<FMcpBridgeWebSocket> Pinned = WeakThis.Pin()) {
+      Pinned->ConnectedDelegate.Broadcast(Pinned);
+    }
+  });
+}
+
 uint32 FMcpBridgeWebSocket::RunServer() {
+  if (!OpenListenSocket()) {
+    return 0;
+  }
+
+  ISocketSubsystem *SocketSubsystem =
+      ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+  while (!bStopping && ListenSocket) {
+    // Note: Accept() blocks until a connection arrives or the socket is closed.
+    // Close() calls ListenSocket->Close() to unblock this call during shutdown.
+    // This thread owns ListenSocket destruction (done after loop exits).
+    FSocket *ClientSocket =
+        ListenSocket->Accept(TEXT("McpAutomationBridgeClient"));
+    
+    // Check again after Accept() returns - socket may have been closed
+    if (bStopping || !ListenSocket) {
+      if (ClientSocket) {
+        // Clean up any socket we accepted during shutdown race
+        ClientSocket->Close();
+        SocketSubsystem->DestroySocket(ClientSocket);
+      }
+      break;
+    }
+    
+    if (ClientSocket) {
+      AcceptClient(ClientSocket);
+    } else {
+      // Sleep briefly to avoid busy waiting
+      FPlatformProcess::Sleep(AcceptSleepSeconds > 0.0f ? AcceptSleepSeconds
+                                                        : 0.01f);
+    }
+  }
+
+  if (ListenSocket) {
+    ListenSocket->Close();
+    SocketSubsystem->DestroySocket(ListenSocket);
+    ListenSocket = nullptr;
+  }
+
+  return 0;
+}
+
+bool FMcpBridgeWebSocket::OpenListenSocket() {
   // Determine if we need IPv6 socket based on host address
   const bool bIsIpv6Host = ListenHost.Contains(TEXT(":"));
   
   ISocketSubsystem *SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
   UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
-         TEXT("FMcpBridgeWebSocket::RunServer begin (host=%s, port=%d, IPv6=%s)"),
+         TEXT("FMcpBridgeWebSocket::OpenListenSocket begin (host=%s, port=%d, IPv6=%s)"),
          *ListenHost, Port, bIsIpv6Host ? TEXT("true") : TEXT("false"));
   
   // Create socket with proper protocol family for IPv6 support
@@ -832,7 +1802,7 @@ uint32 FMcpBridgeWebSocket::RunServer() {
         Pinned->ConnectionErrorDelegate.Broadcast(ErrorMessage);
       }
     });
-    return 0;
+    return false;
   }
 
   ListenSocket->SetReuseAddr(true);
@@ -874,7 +1844,7 @@ uint32 FMcpBridgeWebSocket::RunServer() {
           NAME_Stream, TEXT("McpAutomationBridgeListenSocket"), FName());
       if (!ListenSocket) {
         UE_LOG(LogMcpAutomationBridgeSubsystem, Error, TEXT("Failed to re-create IPv4 socket for fallback."));
-        return 0;
+        return false;
       }
       ListenSocket->SetReuseAddr(true);
       ListenSocket->SetNonBlocking(false);
@@ -933,7 +1903,7 @@ uint32 FMcpBridgeWebSocket::RunServer() {
           if (!ListenSocket) {
             UE_LOG(LogMcpAutomationBridgeSubsystem, Error, 
                    TEXT("Failed to re-create socket for resolved address family."));
-            return 0;
+            return false;
           }
           ListenSocket->SetReuseAddr(true);
           ListenSocket->SetNonBlocking(false);
@@ -961,7 +1931,7 @@ uint32 FMcpBridgeWebSocket::RunServer() {
           NAME_Stream, TEXT("McpAutomationBridgeListenSocket"), FName());
       if (!ListenSocket) {
         UE_LOG(LogMcpAutomationBridgeSubsystem, Error, TEXT("Failed to re-create IPv4 socket for fallback."));
-        return 0;
+        return false;
       }
       ListenSocket->SetReuseAddr(true);
       ListenSocket->SetNonBlocking(false);
@@ -984,128 +1954,442 @@ uint32 FMcpBridgeWebSocket::RunServer() {
         Pinned->ConnectionErrorDelegate.Broadcast(ErrorMessage);
       }
     });
-    return 0;
+    return false;
   }
   UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
          TEXT("Listen socket bound to %s."), *ListenAddr->ToString(false));
 
-  if (!ListenSocket->Listen(ListenBacklog > 0 ? ListenBacklog : 10)) {
-    const FString ErrorMessage = DescribeSocketError(
-        SocketSubsystem, TEXT("Failed to listen on socket"));
-    UE_LOG(LogMcpAutomationBridgeSubsystem, Error, TEXT("%s"), *ErrorMessage);
-    DispatchOnGameThread([WeakThis = SelfWeakPtr, ErrorMessage] {
-      if (TSharedPtr<FMcpBridgeWebSocket> Pinned = WeakThis.Pin()) {
-        Pinned->ConnectionErrorDelegate.Broadcast(ErrorMessage);
-      }
-    });
-    return 0;
+  if (!ListenSocket->Listen(ListenBacklog > 0 ? ListenBacklog : 10)) {
+    const FString ErrorMessage = DescribeSocketError(
+        SocketSubsystem, TEXT("Failed to listen on socket"));
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Error, TEXT("%s"), *ErrorMessage);
+    DispatchOnGameThread([WeakThis = SelfWeakPtr, ErrorMessage] {
+      if (TSharedPtr<FMcpBridgeWebSocket> Pinned = WeakThis.Pin()) {
+        Pinned->ConnectionErrorDelegate.Broadcast(ErrorMessage);
+      }
+    });
+    return false;
+  }
+
+  bListening = true;
+  const FString BoundAddress = ListenAddr->ToString(false);
+  UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
+         TEXT("MCP Automation Bridge listening on %s"), *BoundAddress);
+  DispatchOnGameThread([WeakThis = SelfWeakPtr, BoundAddress] {
+    if (TSharedPtr<FMcpBridgeWebSocket> Pinned = WeakThis.Pin()) {
+      Pinned->ConnectedDelegate.Broadcast(Pinned); // Server ready event
+    }
+  });
+
+  return true;
+}
+
+void FMcpBridgeWebSocket::AcceptClient(FSocket *ClientSocket,
+                                       UPTRINT NativeClientHandle) {
+  ISocketSubsystem *SocketSubsystem =
+      ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+  TSharedRef<FInternetAddr> PeerAddr = SocketSubsystem->CreateInternetAddr();
+  if (ClientSocket && ClientSocket->GetPeerAddress(*PeerAddr)) {
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
+           TEXT("Accepted automation client from %s"),
+           *PeerAddr->ToString(true));
+  } else if (!ClientSocket) {
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
+           TEXT("Accepted automation client."));
+  }
+  // Create a new WebSocket instance for this client connection
+  auto ClientWebSocket = MakeShared<FMcpBridgeWebSocket>(
+      ClientSocket, bUseTls, TlsCertificatePath, TlsPrivateKeyPath);
+  if (NativeClientHandle != 0) {
+    ClientWebSocket->NativeSocketHandle = NativeClientHandle;
+    ClientWebSocket->bNativeSocketReleased = true;
+  }
+  ClientWebSocket->InitializeWeakSelf(ClientWebSocket);
+  ClientWebSocket->SetPerMessageDeflate(
+      bDeflateEnabled, bDeflateContextTakeover, DeflateThresholdBytes);
+  ClientWebSocket->SetOutboundWatermarks(OutboundHighWatermarkBytes,
+                                         OutboundLowWatermarkBytes);
+  ClientWebSocket->SetInboundTextHandler(InboundTextHandler);
+  ClientWebSocket->SetInboundBinaryHandler(InboundBinaryHandler);
+  ClientWebSocket->SetHttpGetHandler(HttpGetHandler);
+  ClientWebSocket->bServerMode =
+      false; // Client connections are not in server mode
+  ClientWebSocket->bServerAcceptedConnection =
+      true; // This is a server-accepted connection
+  // Annotate the accepted client socket with the server listening port
+  // so diagnostic logs and handshake acknowledgements report a
+  // meaningful activePort instead of 0.
+  ClientWebSocket->Port = Port;
+
+  {
+    FScopeLock Lock(&ClientSocketsMutex);
+    ClientSockets.Add(ClientWebSocket);
+  }
+
+  TWeakPtr<FMcpBridgeWebSocket> LocalWeakThis = SelfWeakPtr;
+  auto RemoveFromClientList = [LocalWeakThis, ClientWebSocket] {
+    if (TSharedPtr<FMcpBridgeWebSocket> Pinned = LocalWeakThis.Pin()) {
+      FScopeLock Lock(&Pinned->ClientSocketsMutex);
+      UE_LOG(LogMcpAutomationBridgeSubsystem, VeryVerbose,
+             TEXT("Removing client socket from server tracking (remaining "
+                  "before remove: %d)."),
+             Pinned->ClientSockets.Num());
+      Pinned->ClientSockets.Remove(ClientWebSocket);
+    }
+  };
+
+  ClientWebSocket->OnConnected().AddLambda(
+      [LocalWeakThis, ClientWebSocket](TSharedPtr<FMcpBridgeWebSocket>) {
+        if (TSharedPtr<FMcpBridgeWebSocket> Pinned = LocalWeakThis.Pin()) {
+          DispatchOnGameThread(
+              [ParentWeak = LocalWeakThis, ClientSocket = ClientWebSocket] {
+                if (TSharedPtr<FMcpBridgeWebSocket> DispatchPinned =
+                        ParentWeak.Pin()) {
+                  UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
+                         TEXT("Broadcasting client connected delegate."));
+                  DispatchPinned->ClientConnectedDelegate.Broadcast(
+                      ClientSocket);
+                }
+              });
+        }
+      });
+
+  ClientWebSocket->OnClosed().AddLambda(
+      [RemoveFromClientList](TSharedPtr<FMcpBridgeWebSocket>, int32,
+                             const FString &,
+                             bool) { RemoveFromClientList(); });
+
+  ClientWebSocket->OnConnectionError().AddLambda(
+      [RemoveFromClientList](const FString &) { RemoveFromClientList(); });
+
+  // A reactor pumps the handshake and frames on one of its threads;
+  // otherwise the client gets its own worker thread.
+  if (Reactor.IsValid()) {
+    ClientWebSocket->Reactor = Reactor;
+    ClientWebSocket->PrepareReactorTransport();
+    ClientWebSocket->ReactorPhase = EReactorPhase::Handshake;
+    ClientWebSocket->ReactorDeadlineSeconds =
+        FPlatformTime::Seconds() + ReactorHandshakeTimeoutSeconds;
+    Reactor->Register(ClientWebSocket);
+  } else {
+    ClientWebSocket->Connect();
+  }
+}
+
+void FMcpBridgeWebSocket::PrepareReactorTransport() {
+  bStageReactorWrites = true;
+  if (Socket) {
+    // The mode is a property of the descriptor, so it carries over if the
+    // socket is released below.
+    Socket->SetNonBlocking(true);
+    AdoptNativeSocket(Socket);
+  }
+}
+
+void FMcpBridgeWebSocket::GetReactorInterest(
+    FReactorInterest &OutInterest) const {
+  OutInterest = FReactorInterest();
+  OutInterest.Handle = NativeSocketHandle;
+  switch (ReactorPhase) {
+  case EReactorPhase::Listening:
+    OutInterest.bRead = true;
+    break;
+  case EReactorPhase::Handshake:
+    OutInterest.bRead = !(bTlsHandshakePending && bTlsWantsWrite);
+    OutInterest.bWrite = bTlsHandshakePending && bTlsWantsWrite;
+    OutInterest.DeadlineSeconds = ReactorDeadlineSeconds;
+    break;
+  case EReactorPhase::AwaitHandler:
+    // Inbound frames stay unread until the handler is registered, which
+    // wakes the reactor, or the grace period runs out.
+    OutInterest.bWrite = HasStagedWrites();
+    OutInterest.DeadlineSeconds = ReactorDeadlineSeconds;
+    break;
+  case EReactorPhase::Open:
+    OutInterest.bRead = true;
+    OutInterest.bWrite = HasStagedWrites();
+    break;
+  case EReactorPhase::Closing:
+    OutInterest.bWrite = true;
+    OutInterest.DeadlineSeconds = ReactorDeadlineSeconds;
+    break;
+  default:
+    break;
+  }
+#if WITH_SSL
+  // Records already decrypted by OpenSSL are invisible to poll().
+  OutInterest.bReady = SslHandle && !bTlsHandshakePending &&
+                       SSL_pending(SslHandle) > 0;
+#endif
+}
+
+bool FMcpBridgeWebSocket::PumpReactor(double NowSeconds, bool &bOutDidWork) {
+  bOutDidWork = false;
+  switch (ReactorPhase) {
+  case EReactorPhase::Listening:
+    return PumpListener(bOutDidWork);
+  case EReactorPhase::Handshake:
+    return PumpServerHandshake(NowSeconds, bOutDidWork);
+  case EReactorPhase::AwaitHandler:
+    // The upgrade response may still be staged behind a full socket.
+    if (!FlushStagedWrites(bOutDidWork)) {
+      TearDown(TEXT("Failed to send WebSocket upgrade response."), false,
+               1006);
+      return FinishReactorConnection();
+    }
+    // Same grace period RunClient() gives the game thread before frames are
+    // parsed, so the client's bridge_hello is not dispatched to nobody.
+    if (!bStopping && !bHandlerRegistered &&
+        NowSeconds < ReactorDeadlineSeconds) {
+      return true;
+    }
+    if (!bHandlerRegistered) {
+      UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
+             TEXT("Message handler registration not observed in time; "
+                  "proceeding without explicit synchronization."));
+    }
+    ReactorPhase = EReactorPhase::Open;
+    return PumpOpenConnection(bOutDidWork);
+  case EReactorPhase::Open:
+    return PumpOpenConnection(bOutDidWork);
+  case EReactorPhase::Closing:
+    return PumpClosing(NowSeconds, bOutDidWork);
+  default:
+    return false;
+  }
+}
+
+bool FMcpBridgeWebSocket::PumpListener(bool &bOutDidWork) {
+  if (bStopping || (!ListenSocket && NativeSocketHandle == 0)) {
+    // Like RunServer(), the pumping thread owns listen socket destruction.
+    if (ListenSocket) {
+      ListenSocket->Close();
+      ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(ListenSocket);
+      ListenSocket = nullptr;
+    }
+    CloseNativeSocket();
+    ReactorPhase = EReactorPhase::Finished;
+    return false;
+  }
+
+#if MCP_BRIDGE_NATIVE_SOCKETS
+  if (NativeSocketHandle != 0) {
+    const UPTRINT ClientHandle =
+        McpBridgeNativeSocket::Accept(NativeSocketHandle);
+    if (ClientHandle != 0) {
+      bOutDidWork = true;
+      if (!McpBridgeNativeSocket::ConfigureNonBlocking(ClientHandle)) {
+        UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
+               TEXT("Failed to make accepted automation client socket "
+                    "non-blocking; dropping it."));
+        McpBridgeNativeSocket::Close(ClientHandle);
+        return true;
+      }
+      AcceptClient(nullptr, ClientHandle);
+    }
+    return true;
+  }
+#endif
+
+  bool bHasPendingConnection = false;
+  if (!ListenSocket->HasPendingConnection(bHasPendingConnection) ||
+      !bHasPendingConnection) {
+    return true;
+  }
+
+  if (FSocket *ClientSocket =
+          ListenSocket->Accept(TEXT("McpAutomationBridgeClient"))) {
+    bOutDidWork = true;
+    AcceptClient(ClientSocket);
+  }
+  return true;
+}
+
+bool FMcpBridgeWebSocket::PumpServerHandshake(double NowSeconds,
+                                              bool &bOutDidWork) {
+  if (bStopping) {
+    TearDown(TEXT("Socket loop finished."), true, 1000);
+    return FinishReactorConnection();
+  }
+  if (NowSeconds >= ReactorDeadlineSeconds) {
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
+           TEXT("Server handshake timed out awaiting upgrade request."));
+    TearDown(TEXT("Timed out waiting for WebSocket upgrade request."), false,
+             4000);
+    return FinishReactorConnection();
+  }
+
+  // The TLS handshake advances one non-blocking step per readiness event.
+  if (bUseTls && (!SslHandle || bTlsHandshakePending)) {
+    const ETlsHandshakeStatus Status =
+        SslHandle || BeginTls(true) ? StepTlsHandshake()
+                                    : ETlsHandshakeStatus::Failed;
+    if (Status == ETlsHandshakeStatus::Failed) {
+      TearDown(TEXT("TLS handshake failed."), false, 4000);
+      return FinishReactorConnection();
+    }
+    if (Status == ETlsHandshakeStatus::Pending) {
+      return true;
+    }
+    bOutDidWork = true;
+  }
+
+  if (!WaitForReadable(FTimespan::Zero())) {
+    return true;
+  }
+
+  bOutDidWork = true;
+
+  uint8 Temp[1024];
+  int32 BytesRead = 0;
+  if (!RecvRaw(Temp, sizeof(Temp), BytesRead)) {
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
+           TEXT("Server handshake recv failed while awaiting upgrade request "
+                "(benign or client closed)."));
+    TearDown(TEXT("Failed to read WebSocket upgrade request."), false, 4000);
+    return FinishReactorConnection();
+  }
+  if (BytesRead <= 0) {
+    return true;
+  }
+
+  // Only the bytes that just arrived (plus three for a split terminator)
+  // need to be searched for the end of the headers.
+  const int32 SearchFrom = FMath::Max(0, ReactorHandshakeBuffer.Num() - 3);
+  ReactorHandshakeBuffer.Append(Temp, BytesRead);
+  int32 HeaderEndIndex = -1;
+  for (int32 Idx = SearchFrom; Idx + 3 < ReactorHandshakeBuffer.Num(); ++Idx) {
+    if (ReactorHandshakeBuffer[Idx] == '\r' &&
+        ReactorHandshakeBuffer[Idx + 1] == '\n' &&
+        ReactorHandshakeBuffer[Idx + 2] == '\r' &&
+        ReactorHandshakeBuffer[Idx + 3] == '\n') {
+      HeaderEndIndex = Idx + 4;
+      break;
+    }
+  }
+
+  if (HeaderEndIndex < 0) {
+    if (ReactorHandshakeBuffer.Num() > ReactorMaxUpgradeRequestBytes) {
+      TearDown(TEXT("WebSocket upgrade request too large."), false, 4000);
+      return FinishReactorConnection();
+    }
+    return true;
+  }
+
+  const TArray<uint8> RequestBuffer = MoveTemp(ReactorHandshakeBuffer);
+  ReactorHandshakeBuffer.Empty();
+  if (!CompleteServerHandshake(RequestBuffer, HeaderEndIndex)) {
+    return FinishReactorConnection();
+  }
+
+  OnConnectionEstablished();
+  ReactorPhase = EReactorPhase::AwaitHandler;
+  ReactorDeadlineSeconds = NowSeconds + HandlerRegistrationWaitSeconds;
+  return true;
+}
+
+bool FMcpBridgeWebSocket::PumpOpenConnection(bool &bOutDidWork) {
+  if (bStopping) {
+    TearDown(TEXT("Socket loop finished."), true, 1000);
+    return FinishReactorConnection();
+  }
+
+  if (!FlushStagedWrites(bOutDidWork) ||
+      !DrainOutboundQueue(ReactorOutboundBudgetBytes, bOutDidWork)) {
+    TearDown(TEXT("Failed to write WebSocket frame."), false, 1006);
+    return FinishReactorConnection();
+  }
+
+  // Frames left over from the upgrade request or a previous read come first.
+  if (!DrainBufferedFrames(bOutDidWork)) {
+    return FinishReactorConnection();
+  }
+  if (!WaitForReadable(FTimespan::Zero())) {
+    return true;
   }
 
-  bListening = true;
-  const FString BoundAddress = ListenAddr->ToString(false);
-  UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
-         TEXT("MCP Automation Bridge listening on %s"), *BoundAddress);
-  DispatchOnGameThread([WeakThis = SelfWeakPtr, BoundAddress] {
-    if (TSharedPtr<FMcpBridgeWebSocket> Pinned = WeakThis.Pin()) {
-      Pinned->ConnectedDelegate.Broadcast(Pinned); // Server ready event
+  bOutDidWork = true;
+  bool bReadFailed = false;
+  {
+    FScopeLock Guard(&ReceiveMutex);
+    uint8 *WritePtr = nullptr;
+    int32 WritableBytes = ReceiveBuffer.GetWriteRegion(WritePtr);
+    if (WritableBytes <= 0) {
+      ReceiveBuffer.Reserve(ReceiveBuffer.Capacity() * 2);
+      WritableBytes = ReceiveBuffer.GetWriteRegion(WritePtr);
     }
-  });
-
-  while (!bStopping && ListenSocket) {
-    // Note: Accept() blocks until a connection arrives or the socket is closed.
-    // Close() calls ListenSocket->Close() to unblock this call during shutdown.
-    // This thread owns ListenSocket destruction (done after loop exits).
-    FSocket *ClientSocket =
-        ListenSocket->Accept(TEXT("McpAutomationBridgeClient"));
-    
-    // Check again after Accept() returns - socket may have been closed
-    if (bStopping || !ListenSocket) {
-      if (ClientSocket) {
-        // Clean up any socket we accepted during shutdown race
-        ClientSocket->Close();
-        SocketSubsystem->DestroySocket(ClientSocket);
-      }
-      break;
+    int32 BytesRead = 0;
+    if (RecvRaw(WritePtr, WritableBytes, BytesRead)) {
+      ReceiveBuffer.CommitWrite(BytesRead);
+    } else {
+      bReadFailed = true;
     }
-    
-    if (ClientSocket) {
-      TSharedRef<FInternetAddr> PeerAddr = SocketSubsystem->CreateInternetAddr();
-      if (ClientSocket->GetPeerAddress(*PeerAddr)) {
-        UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
-               TEXT("Accepted automation client from %s"),
-               *PeerAddr->ToString(true));
+  }
+  if (bReadFailed) {
+    TearDown(TEXT("Failed to read WebSocket frame."), false, 4001);
+    return FinishReactorConnection();
+  }
+
+  if (!DrainBufferedFrames(bOutDidWork)) {
+    return FinishReactorConnection();
+  }
+  return true;
+}
+
+bool FMcpBridgeWebSocket::DrainBufferedFrames(bool &bOutDidWork) {
+  while (!bStopping) {
+    {
+      FScopeLock Guard(&ReceiveMutex);
+      uint64 FrameBytes = 0;
+      if (!PeekWebSocketFrameSize(ReceiveBuffer, FrameBytes)) {
+        return true;
       }
-      // Create a new WebSocket instance for this client connection
-      auto ClientWebSocket = MakeShared<FMcpBridgeWebSocket>(
-          ClientSocket, bUseTls, TlsCertificatePath, TlsPrivateKeyPath);
-      ClientWebSocket->InitializeWeakSelf(ClientWebSocket);
-      ClientWebSocket->bServerMode =
-          false; // Client connections are not in server mode
-      ClientWebSocket->bServerAcceptedConnection =
-          true; // This is a server-accepted connection
-      // Annotate the accepted client socket with the server listening port
-      // so diagnostic logs and handshake acknowledgements report a
-      // meaningful activePort instead of 0.
-      ClientWebSocket->Port = Port;
-
-      {
-        FScopeLock Lock(&ClientSocketsMutex);
-        ClientSockets.Add(ClientWebSocket);
+      if (FrameBytes > static_cast<uint64>(ReceiveBuffer.Num())) {
+        // Make room for the whole frame so ReceiveFrame() never has to
+        // block on the socket for the remainder.
+        ReceiveBuffer.Reserve(static_cast<int32>(FrameBytes));
+        return true;
       }
+    }
 
-      TWeakPtr<FMcpBridgeWebSocket> LocalWeakThis = SelfWeakPtr;
-      auto RemoveFromClientList = [LocalWeakThis, ClientWebSocket] {
-        if (TSharedPtr<FMcpBridgeWebSocket> Pinned = LocalWeakThis.Pin()) {
-          FScopeLock Lock(&Pinned->ClientSocketsMutex);
-          UE_LOG(LogMcpAutomationBridgeSubsystem, VeryVerbose,
-                 TEXT("Removing client socket from server tracking (remaining "
-                      "before remove: %d)."),
-                 Pinned->ClientSockets.Num());
-          Pinned->ClientSockets.Remove(ClientWebSocket);
-        }
-      };
-
-      ClientWebSocket->OnConnected().AddLambda(
-          [LocalWeakThis, ClientWebSocket](TSharedPtr<FMcpBridgeWebSocket>) {
-            if (TSharedPtr<FMcpBridgeWebSocket> Pinned = LocalWeakThis.Pin()) {
-              DispatchOnGameThread(
-                  [ParentWeak = LocalWeakThis, ClientSocket = ClientWebSocket] {
-                    if (TSharedPtr<FMcpBridgeWebSocket> DispatchPinned =
-                            ParentWeak.Pin()) {
-                      UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
-                             TEXT("Broadcasting client connected delegate."));
-                      DispatchPinned->ClientConnectedDelegate.Broadcast(
-                          ClientSocket);
-                    }
-                  });
-            }
-          });
-
-      ClientWebSocket->OnClosed().AddLambda(
-          [RemoveFromClientList](TSharedPtr<FMcpBridgeWebSocket>, int32,
-                                 const FString &,
-                                 bool) { RemoveFromClientList(); });
-
-      ClientWebSocket->OnConnectionError().AddLambda(
-          [RemoveFromClientList](const FString &) { RemoveFromClientList(); });
-
-      // Start the client WebSocket thread to handle the handshake and
-      // communication
-      ClientWebSocket->Connect();
-    } else {
-      // Sleep briefly to avoid busy waiting
-      FPlatformProcess::Sleep(AcceptSleepSeconds > 0.0f ? AcceptSleepSeconds
-                                                        : 0.01f);
+    // The frame is fully buffered, so ReceiveFrame() only reads the ring.
+    bOutDidWork = true;
+    if (!ReceiveFrame()) {
+      return false;
     }
   }
+  return true;
+}
 
-  if (ListenSocket) {
-    ListenSocket->Close();
-    SocketSubsystem->DestroySocket(ListenSocket);
-    ListenSocket = nullptr;
+bool FMcpBridgeWebSocket::PumpClosing(double NowSeconds, bool &bOutDidWork) {
+  if (!bStopping && NowSeconds < ReactorDeadlineSeconds &&
+      FlushStagedWrites(bOutDidWork) && HasStagedWrites()) {
+    return true;
   }
+  return CloseReactorTransport();
+}
 
-  return 0;
+bool FMcpBridgeWebSocket::FinishReactorConnection() {
+  DiscardOutboundQueue();
+  if (HasStagedWrites() && !bStopping) {
+    // Let the peer read what was already written, e.g. a served HTTP
+    // response, before the socket closes.
+    ReactorPhase = EReactorPhase::Closing;
+    ReactorDeadlineSeconds = FPlatformTime::Seconds() + ReactorCloseLingerSeconds;
+    return true;
+  }
+  return CloseReactorTransport();
+}
+
+bool FMcpBridgeWebSocket::CloseReactorTransport() {
+  if (FSocket *LocalSocket = DetachSocket()) {
+    LocalSocket->Close();
+    ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(LocalSocket);
+  }
+  ShutdownTls();
+  CloseNativeSocket();
+  ReactorPhase = EReactorPhase::Finished;
+  return false;
 }
 
 void FMcpBridgeWebSocket::Stop() {
@@ -1117,9 +2401,13 @@ void FMcpBridgeWebSocket::Stop() {
 
 void FMcpBridgeWebSocket::TearDown(const FString &Reason, bool bWasClean,
                                    int32 StatusCode) {
-  if (FSocket *LocalSocket = DetachSocket()) {
-    LocalSocket->Close();
-    ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(LocalSocket);
+  // Reactor connections release their transport in CloseReactorTransport()
+  // once any staged bytes are flushed.
+  if (!bStageReactorWrites) {
+    if (FSocket *LocalSocket = DetachSocket()) {
+      LocalSocket->Close();
+      ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(LocalSocket);
+    }
   }
 
   const bool bWasConnected = bConnected;
@@ -1217,6 +2505,12 @@ bool FMcpBridgeWebSocket::PerformHandshake() {
                    << TEXT("\r\n");
   }
 
+  const FString DeflateOffer = BuildDeflateOffer();
+  if (!DeflateOffer.IsEmpty()) {
+    RequestBuilder << TEXT("Sec-WebSocket-Extensions: ") << DeflateOffer
+                   << TEXT("\r\n");
+  }
+
   for (const TPair<FString, FString> &HeaderPair : Headers) {
     RequestBuilder << HeaderPair.Key << TEXT(": ") << HeaderPair.Value
                    << TEXT("\r\n");
@@ -1297,6 +2591,7 @@ bool FMcpBridgeWebSocket::PerformHandshake() {
   }
 
   bool bAcceptValid = false;
+  FString AcceptedExtensions;
   for (int32 i = 1; i < HeaderLines.Num(); ++i) {
     FString Key;
     FString Value;
@@ -1305,6 +2600,11 @@ bool FMcpBridgeWebSocket::PerformHandshake() {
       Value = Value.TrimStartAndEnd();
       if (Key.Equals(TEXT("Sec-WebSocket-Accept"), ESearchCase::IgnoreCase)) {
         bAcceptValid = Value.Equals(ExpectedAccept, ESearchCase::CaseSensitive);
+      } else if (Key.Equals(TEXT("Sec-WebSocket-Extensions"),
+                            ESearchCase::IgnoreCase)) {
+        AcceptedExtensions = AcceptedExtensions.IsEmpty()
+                                 ? Value
+                                 : AcceptedExtensions + TEXT(", ") + Value;
       }
     }
   }
@@ -1314,10 +2614,19 @@ bool FMcpBridgeWebSocket::PerformHandshake() {
     return false;
   }
 
+  // A server may only enable extensions the client offered (RFC 6455 9.1).
+  if (!AcceptedExtensions.IsEmpty() &&
+      (DeflateOffer.IsEmpty() || !ApplyDeflateResponse(AcceptedExtensions))) {
+    TearDown(TEXT("WebSocket server negotiated an unsupported extension."),
+             false, 1010);
+    return false;
+  }
+
   if (!ExtraData.IsEmpty()) {
     const FTCHARToUTF8 ExtraUtf8(*ExtraData);
-    PendingReceived.Append(reinterpret_cast<const uint8 *>(ExtraUtf8.Get()),
-                           ExtraUtf8.Length());
+    FScopeLock Guard(&ReceiveMutex);
+    ReceiveBuffer.Append(reinterpret_cast<const uint8 *>(ExtraUtf8.Get()),
+                         ExtraUtf8.Length());
   }
 
   return true;
@@ -1330,7 +2639,6 @@ bool FMcpBridgeWebSocket::PerformServerHandshake() {
   constexpr int32 TempSize = 256;
   uint8 Temp[TempSize];
   bool bRequestComplete = false;
-  FString ClientKey;
 
   int32 HeaderEndIndex = -1;
   if (bUseTls) {
@@ -1367,7 +2675,7 @@ bool FMcpBridgeWebSocket::PerformServerHandshake() {
     // in the buffer. Clients may send additional bytes immediately after
     // the headers (for example, the first WebSocket frame), so search
     // the whole buffer and capture any trailing bytes beyond the header
-    // terminator into PendingReceived for the frame parser.
+    // terminator into ReceiveBuffer for the frame parser.
     if (RequestBuffer.Num() >= 4) {
       for (int32 Idx = 0; Idx + 3 < RequestBuffer.Num(); ++Idx) {
         if (RequestBuffer[Idx] == '\r' && RequestBuffer[Idx + 1] == '\n' &&
@@ -1380,6 +2688,11 @@ bool FMcpBridgeWebSocket::PerformServerHandshake() {
     }
   }
 
+  return CompleteServerHandshake(RequestBuffer, HeaderEndIndex);
+}
+
+bool FMcpBridgeWebSocket::CompleteServerHandshake(
+    const TArray<uint8> &RequestBuffer, int32 HeaderEndIndex) {
   FString RequestString = FString(
       ANSI_TO_TCHAR(reinterpret_cast<const char *>(RequestBuffer.GetData())));
   TArray<FString> RequestLines;
@@ -1399,8 +2712,8 @@ bool FMcpBridgeWebSocket::PerformServerHandshake() {
     const int32 ExtraCount = RequestBuffer.Num() - HeaderEndIndex;
     if (ExtraCount > 0) {
       FScopeLock Guard(&ReceiveMutex);
-      PendingReceived.Append(RequestBuffer.GetData() + HeaderEndIndex,
-                             ExtraCount);
+      ReceiveBuffer.Append(RequestBuffer.GetData() + HeaderEndIndex,
+                           ExtraCount);
       UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
              TEXT("Server handshake: preserved %d extra bytes after upgrade "
                   "request for subsequent frame parsing."),
@@ -1409,16 +2722,22 @@ bool FMcpBridgeWebSocket::PerformServerHandshake() {
   }
 
   // Parse the request
+  FString ClientKey;
   bool bValidUpgrade = false;
   bool bValidConnection = false;
   bool bValidVersion = false;
   FString RequestedProtocols;
+  FString RequestedExtensions;
+  TMap<FString, FString> RequestHeaders;
 
   for (int32 i = 1; i < RequestLines.Num(); ++i) {
     FString Key, Value;
     if (RequestLines[i].Split(TEXT(":"), &Key, &Value)) {
       Key = Key.TrimStartAndEnd();
       Value = Value.TrimStartAndEnd();
+      if (HttpGetHandler) {
+        RequestHeaders.Add(Key.ToLower(), Value);
+      }
 
       if (Key.Equals(TEXT("Upgrade"), ESearchCase::IgnoreCase) &&
           Value.Equals(TEXT("websocket"), ESearchCase::IgnoreCase)) {
@@ -1436,10 +2755,23 @@ bool FMcpBridgeWebSocket::PerformServerHandshake() {
       } else if (Key.Equals(TEXT("Sec-WebSocket-Protocol"),
                             ESearchCase::IgnoreCase)) {
         RequestedProtocols = Value;
+      } else if (Key.Equals(TEXT("Sec-WebSocket-Extensions"),
+                            ESearchCase::IgnoreCase)) {
+        RequestedExtensions = RequestedExtensions.IsEmpty()
+                                  ? Value
+                                  : RequestedExtensions + TEXT(", ") + Value;
       }
     }
   }
 
+  // Plain HTTP on the listen port (metrics scrapes). Never falls through to
+  // the upgrade path, so a scraper cannot end up holding a bridge session.
+  if (!bValidUpgrade && HttpGetHandler &&
+      RequestLines[0].StartsWith(TEXT("GET "), ESearchCase::CaseSensitive)) {
+    ServeHttpGetRequest(RequestLines[0], RequestHeaders);
+    return false;
+  }
+
   if (!bValidUpgrade || !bValidConnection || !bValidVersion ||
       ClientKey.IsEmpty()) {
     UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
@@ -1511,28 +2843,74 @@ bool FMcpBridgeWebSocket::PerformServerHandshake() {
                                 *SelectedProtocol);
   }
 
+  FString DeflateResponse;
+  if (AcceptDeflateOffer(RequestedExtensions, DeflateResponse)) {
+    Response += FString::Printf(TEXT("Sec-WebSocket-Extensions: %s\r\n"),
+                                *DeflateResponse);
+  }
+
   Response += TEXT("\r\n");
 
   FTCHARToUTF8 ResponseUtf8(*Response);
-  int32 BytesSent = 0;
-  if (!SendRaw(reinterpret_cast<const uint8 *>(ResponseUtf8.Get()),
-               ResponseUtf8.Length(), BytesSent) ||
-      BytesSent != ResponseUtf8.Length()) {
+  if (!SendAll(reinterpret_cast<const uint8 *>(ResponseUtf8.Get()),
+               static_cast<SIZE_T>(ResponseUtf8.Length()))) {
     UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
-           TEXT("Server handshake failed: unable to send upgrade response "
-                "(sent %d expected %d)."),
-           BytesSent, ResponseUtf8.Length());
+           TEXT("Server handshake failed: unable to send %d-byte upgrade "
+                "response."),
+           ResponseUtf8.Length());
     TearDown(TEXT("Failed to send WebSocket upgrade response."), false, 4000);
     return false;
   }
 
   UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
-         TEXT("Server handshake completed; subprotocol=%s"),
-         SelectedProtocol.IsEmpty() ? TEXT("(none)") : *SelectedProtocol);
+         TEXT("Server handshake completed; subprotocol=%s deflate=%s"),
+         SelectedProtocol.IsEmpty() ? TEXT("(none)") : *SelectedProtocol,
+         bDeflateNegotiated ? *DeflateResponse : TEXT("(off)"));
 
   return true;
 }
 
+void FMcpBridgeWebSocket::ServeHttpGetRequest(
+    const FString &RequestLine, const TMap<FString, FString> &Headers) {
+  TArray<FString> RequestParts;
+  RequestLine.ParseIntoArrayWS(RequestParts);
+  FString Path = RequestParts.Num() > 1 ? RequestParts[1] : TEXT("/");
+  int32 QueryIndex = INDEX_NONE;
+  if (Path.FindChar(TEXT('?'), QueryIndex)) {
+    Path.LeftInline(QueryIndex);
+  }
+
+  int32 StatusCode = 200;
+  FString ContentType = TEXT("text/plain; charset=utf-8");
+  FString Body;
+  if (!HttpGetHandler(Path, Headers, StatusCode, ContentType, Body)) {
+    StatusCode = 404;
+    ContentType = TEXT("text/plain; charset=utf-8");
+    Body = TEXT("Not Found\n");
+  }
+
+  FTCHARToUTF8 BodyUtf8(*Body);
+  const FString Head = FString::Printf(
+      TEXT("HTTP/1.1 %d %s\r\nContent-Type: %s\r\nContent-Length: %d\r\n"
+           "Cache-Control: no-store\r\nConnection: close\r\n\r\n"),
+      StatusCode, HttpStatusReason(StatusCode), *ContentType,
+      BodyUtf8.Length());
+  FTCHARToUTF8 HeadUtf8(*Head);
+
+  TArray<uint8> Response;
+  Response.Reserve(HeadUtf8.Length() + BodyUtf8.Length());
+  Response.Append(reinterpret_cast<const uint8 *>(HeadUtf8.Get()),
+                  HeadUtf8.Length());
+  Response.Append(reinterpret_cast<const uint8 *>(BodyUtf8.Get()),
+                  BodyUtf8.Length());
+  const bool bSent = SendAll(Response.GetData(), Response.Num());
+
+  UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
+         TEXT("Served HTTP GET %s -> %d (%d bytes%s)."), *Path, StatusCode,
+         BodyUtf8.Length(), bSent ? TEXT("") : TEXT(", send failed"));
+  TearDown(TEXT("HTTP request served."), bSent, 1000);
+}
+
 bool FMcpBridgeWebSocket::ResolveEndpoint(TSharedPtr<FInternetAddr> &OutAddr) {
   ISocketSubsystem *SocketSubsystem =
       ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
@@ -1555,21 +2933,23 @@ bool FMcpBridgeWebSocket::ResolveEndpoint(TSharedPtr<FInternetAddr> &OutAddr) {
   return OutAddr.IsValid();
 }
 
-bool FMcpBridgeWebSocket::SendFrame(const TArray<uint8> &Frame) {
-  if (!Socket && !(bUseTls && SslHandle)) {
+bool FMcpBridgeWebSocket::SendAll(const uint8 *Data, SIZE_T Length) {
+  if (!HasTransport()) {
     return false;
   }
+  if (bStageReactorWrites) {
+    return SendOrStage(Data, Length);
+  }
 
-  int32 TotalBytesSent = 0;
-  const int32 TotalBytesToSend = Frame.Num();
-
-  while (TotalBytesSent < TotalBytesToSend) {
+  SIZE_T TotalBytesSent = 0;
+  while (TotalBytesSent < Length) {
+    const int32 BytesToSend = static_cast<int32>(
+        FMath::Min<SIZE_T>(Length - TotalBytesSent, MAX_int32));
     int32 BytesSent = 0;
-    if (!SendRaw(Frame.GetData() + TotalBytesSent,
-                 TotalBytesToSend - TotalBytesSent, BytesSent)) {
+    if (!SendRaw(Data + TotalBytesSent, BytesToSend, BytesSent)) {
       UE_LOG(LogMcpAutomationBridgeSubsystem, Error,
-             TEXT("Socket Send failed after sending %d / %d bytes"),
-             TotalBytesSent, TotalBytesToSend);
+             TEXT("Socket Send failed after sending %llu / %llu bytes"),
+             static_cast<uint64>(TotalBytesSent), static_cast<uint64>(Length));
       return false;
     }
 
@@ -1581,9 +2961,75 @@ bool FMcpBridgeWebSocket::SendFrame(const TArray<uint8> &Frame) {
       return false;
     }
 
-    TotalBytesSent += BytesSent;
+    TotalBytesSent += static_cast<SIZE_T>(BytesSent);
+  }
+
+  return true;
+}
+
+bool FMcpBridgeWebSocket::SendOrStage(const uint8 *Data, SIZE_T Length) {
+  FScopeLock Guard(&SendMutex);
+
+  // Anything already staged has to reach the wire first.
+  SIZE_T TotalBytesSent = 0;
+  if (!HasStagedWrites()) {
+    while (TotalBytesSent < Length) {
+      const int32 BytesToSend = static_cast<int32>(
+          FMath::Min<SIZE_T>(Length - TotalBytesSent, MAX_int32));
+      int32 BytesSent = 0;
+      if (!SendRaw(Data + TotalBytesSent, BytesToSend, BytesSent)) {
+        UE_LOG(LogMcpAutomationBridgeSubsystem, Error,
+               TEXT("Socket Send failed after sending %llu / %llu bytes"),
+               static_cast<uint64>(TotalBytesSent),
+               static_cast<uint64>(Length));
+        return false;
+      }
+      if (BytesSent <= 0) {
+        break;
+      }
+      TotalBytesSent += static_cast<SIZE_T>(BytesSent);
+    }
+  }
+
+  const SIZE_T Remaining = Length - TotalBytesSent;
+  if (Remaining == 0) {
+    return true;
+  }
+  if (static_cast<uint64>(StagedWrites.Num()) + Remaining > MAX_int32) {
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Error,
+           TEXT("Cannot stage %llu more outbound bytes behind a full socket."),
+           static_cast<uint64>(Remaining));
+    return false;
+  }
+  StagedWrites.Append(Data + TotalBytesSent, static_cast<int32>(Remaining));
+  return true;
+}
+
+bool FMcpBridgeWebSocket::FlushStagedWrites(bool &bOutDidWork) {
+  FScopeLock Guard(&SendMutex);
+  while (HasStagedWrites()) {
+    int32 BytesSent = 0;
+    if (!SendRaw(StagedWrites.GetData() + StagedWriteOffset,
+                 StagedWrites.Num() - StagedWriteOffset, BytesSent)) {
+      UE_LOG(LogMcpAutomationBridgeSubsystem, Error,
+             TEXT("Socket Send failed with %d staged bytes left."),
+             StagedWrites.Num() - StagedWriteOffset);
+      return false;
+    }
+    if (BytesSent <= 0) {
+      // Still full; the reactor polls for writability before trying again.
+      return true;
+    }
+    bOutDidWork = true;
+    StagedWriteOffset += BytesSent;
   }
 
+  StagedWriteOffset = 0;
+  if (StagedWrites.Max() > ReactorStagedWriteSlackBytes) {
+    StagedWrites.Empty();
+  } else {
+    StagedWrites.Reset();
+  }
   return true;
 }
 
@@ -1607,50 +3053,122 @@ bool FMcpBridgeWebSocket::SendCloseFrame(int32 StatusCode,
   return SendControlFrame(OpCodeClose, Payload);
 }
 
-bool FMcpBridgeWebSocket::SendTextFrame(const void *Data, SIZE_T Length) {
-  const uint8 *Raw = static_cast<const uint8 *>(Data);
-  TArray<uint8> Frame;
-
-  const uint8 Header = 0x80 | OpCodeText;
-  Frame.Add(Header);
+bool FMcpBridgeWebSocket::SendFragment(uint8 FirstByte, const uint8 *Data,
+                                       SIZE_T Length) {
+  if (SendScratch.Num() < SendScratchBytes) {
+    SendScratch.SetNumUninitialized(SendScratchBytes);
+  }
+  uint8 *Scratch = SendScratch.GetData();
 
   const bool bMask = !bServerAcceptedConnection;
+  const uint8 MaskBit = bMask ? 0x80 : 0x00;
+  int32 HeaderBytes = 0;
+  Scratch[HeaderBytes++] = FirstByte;
 
   if (Length <= 125) {
-    Frame.Add((bMask ? 0x80 : 0x00) | static_cast<uint8>(Length));
+    Scratch[HeaderBytes++] = MaskBit | static_cast<uint8>(Length);
   } else if (Length <= 0xFFFF) {
-    Frame.Add((bMask ? 0x80 : 0x00) | 126);
+    Scratch[HeaderBytes++] = MaskBit | 126;
     const uint16 SizeShort = ToNetwork16(static_cast<uint16>(Length));
-    Frame.Append(reinterpret_cast<const uint8 *>(&SizeShort), sizeof(uint16));
+    FMemory::Memcpy(Scratch + HeaderBytes, &SizeShort, sizeof(uint16));
+    HeaderBytes += sizeof(uint16);
   } else {
-    Frame.Add((bMask ? 0x80 : 0x00) | 127);
+    Scratch[HeaderBytes++] = MaskBit | 127;
     const uint64 SizeLong = ToNetwork64(static_cast<uint64>(Length));
-    Frame.Append(reinterpret_cast<const uint8 *>(&SizeLong), sizeof(uint64));
+    FMemory::Memcpy(Scratch + HeaderBytes, &SizeLong, sizeof(uint64));
+    HeaderBytes += sizeof(uint64);
   }
 
+  uint8 MaskKey[4] = {0, 0, 0, 0};
   if (bMask) {
-    uint8 MaskKey[4];
-    for (uint8 &Byte : MaskKey) {
-      Byte = static_cast<uint8>(FMath::RandRange(0, 255));
-    }
-    Frame.Append(MaskKey, 4);
+    GenerateWebSocketMaskKey(MaskKey);
+    FMemory::Memcpy(Scratch + HeaderBytes, MaskKey, 4);
+    HeaderBytes += 4;
+  }
+
+  // Coalesce the header with the start of the payload so small frames leave
+  // in a single write. The split point is rounded down to a multiple of four
+  // so the chunks that follow keep the mask key phase.
+  SIZE_T Offset = FMath::Min<SIZE_T>(
+      Length, static_cast<SIZE_T>((SendScratchBytes - HeaderBytes) & ~3));
+  if (bMask) {
+    ApplyWebSocketMask(Data, Scratch + HeaderBytes, Offset, MaskKey);
+  } else if (Offset > 0) {
+    FMemory::Memcpy(Scratch + HeaderBytes, Data, Offset);
+  }
+  if (!SendAll(Scratch, static_cast<SIZE_T>(HeaderBytes) + Offset)) {
+    return false;
+  }
+
+  if (!bMask) {
+    // Server frames are unmasked, so the remainder is written straight from
+    // the caller's buffer without another copy.
+    return Offset == Length || SendAll(Data + Offset, Length - Offset);
+  }
 
-    const int64 Offset = Frame.Num();
-    Frame.AddUninitialized(Length);
-    for (SIZE_T Index = 0; Index < Length; ++Index) {
-      Frame[Offset + Index] = Raw[Index] ^ MaskKey[Index % 4];
+  while (Offset < Length) {
+    const SIZE_T ChunkBytes =
+        FMath::Min<SIZE_T>(SendScratchBytes, Length - Offset);
+    ApplyWebSocketMask(Data + Offset, Scratch, ChunkBytes, MaskKey);
+    if (!SendAll(Scratch, ChunkBytes)) {
+      return false;
     }
-  } else {
-    Frame.Append(Raw, static_cast<int32>(Length));
+    Offset += ChunkBytes;
   }
+  return true;
+}
 
+bool FMcpBridgeWebSocket::SendDataMessage(uint8 DataOpCode, bool bCompressed,
+                                          const uint8 *Data, SIZE_T Length) {
+  SIZE_T Offset = 0;
+  do {
+    const SIZE_T FragmentBytes =
+        FMath::Min(MaxOutboundFragmentBytes, Length - Offset);
+    const bool bFirst = Offset == 0;
+    const bool bFinal = Offset + FragmentBytes == Length;
+
+    uint8 FirstByte = bFinal ? 0x80 : 0x00;
+    FirstByte |= bFirst ? DataOpCode : OpCodeContinuation;
+    // RSV1 marks the first frame of a permessage-deflate compressed message.
+    if (bFirst && bCompressed) {
+      FirstByte |= 0x40;
+    }
+
+    if (!SendFragment(FirstByte, Data + Offset, FragmentBytes)) {
+      return false;
+    }
+    Offset += FragmentBytes;
+  } while (Offset < Length);
+  return true;
+}
+
+bool FMcpBridgeWebSocket::SendTextFrame(const void *Data, SIZE_T Length) {
+  const uint8 *Raw = static_cast<const uint8 *>(Data);
+
+  // With context takeover the compressor window spans messages, so the
+  // compression order must match the wire order: hold the send lock for
+  // both steps.
   FScopeLock Guard(&SendMutex);
-  return SendFrame(Frame);
+
+  if (bDeflateNegotiated &&
+      Length >= static_cast<SIZE_T>(DeflateThresholdBytes)) {
+    TArray<uint8> Compressed;
+    if (CompressMessage(Raw, Length, Compressed)) {
+      return SendDataMessage(OpCodeText, true, Compressed.GetData(),
+                             static_cast<SIZE_T>(Compressed.Num()));
+    }
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
+           TEXT("permessage-deflate compression failed; sending %llu bytes "
+                "uncompressed."),
+           static_cast<uint64>(Length));
+  }
+
+  return SendDataMessage(OpCodeText, false, Raw, Length);
 }
 
 bool FMcpBridgeWebSocket::SendControlFrame(const uint8 ControlOpCode,
                                            const TArray<uint8> &Payload) {
-  if (!Socket && !(bUseTls && SslHandle)) {
+  if (!HasTransport()) {
     return false;
   }
 
@@ -1659,33 +3177,18 @@ bool FMcpBridgeWebSocket::SendControlFrame(const uint8 ControlOpCode,
   }
 
   FScopeLock Guard(&SendMutex);
-
-  TArray<uint8> Frame;
-  Frame.Reserve(2 + 4 + Payload.Num());
-  Frame.Add(0x80 | (ControlOpCode & 0x0F));
-  const bool bMask = !bServerAcceptedConnection;
-  Frame.Add((bMask ? 0x80 : 0x00) | static_cast<uint8>(Payload.Num()));
-
-  if (bMask) {
-    uint8 MaskKey[4];
-    for (uint8 &Byte : MaskKey) {
-      Byte = static_cast<uint8>(FMath::RandRange(0, 255));
-    }
-
-    Frame.Append(MaskKey, 4);
-    const int32 PayloadOffset = Frame.Num();
-    Frame.AddUninitialized(Payload.Num());
-    for (int32 Index = 0; Index < Payload.Num(); ++Index) {
-      Frame[PayloadOffset + Index] = Payload[Index] ^ MaskKey[Index % 4];
-    }
-  } else if (Payload.Num() > 0) {
-    Frame.Append(Payload);
-  }
-
-  return SendFrame(Frame);
+  return SendFragment(0x80 | (ControlOpCode & 0x0F), Payload.GetData(),
+                      static_cast<SIZE_T>(Payload.Num()));
 }
 
 void FMcpBridgeWebSocket::HandleTextPayload(const TArray<uint8> &Payload) {
+  if (InboundTextHandler) {
+    // The owner decodes and validates on this thread and only posts work
+    // that is ready to dispatch to the game thread.
+    InboundTextHandler(SelfWeakPtr.Pin(), Payload);
+    return;
+  }
+
   const FString Message = BytesToStringView(Payload);
   // Dispatch message handling to the game thread.
   // Many automation handlers touch editor/world state and must run on the
@@ -1698,9 +3201,50 @@ void FMcpBridgeWebSocket::HandleTextPayload(const TArray<uint8> &Payload) {
   });
 }
 
+void FMcpBridgeWebSocket::HandleBinaryPayload(TArray<uint8> &&Payload) {
+  if (InboundBinaryHandler) {
+    InboundBinaryHandler(SelfWeakPtr.Pin(), Payload);
+    return;
+  }
+
+  DispatchOnGameThread(
+      [WeakThis = SelfWeakPtr, Data = MoveTemp(Payload)] {
+        if (TSharedPtr<FMcpBridgeWebSocket> Pinned = WeakThis.Pin()) {
+          Pinned->BinaryMessageDelegate.Broadcast(Pinned, Data);
+        }
+      });
+}
+
+bool FMcpBridgeWebSocket::DeliverDataMessage(uint8 DataOpCode,
+                                             bool bCompressed,
+                                             TArray<uint8> &&Payload) {
+  TRACE_CPUPROFILER_EVENT_SCOPE_STR("McpBridge::SocketReceive");
+  TRACE_COUNTER_SET(McpBridgeBytesReceived,
+                    WebSocketTotalBytesReceived.Load());
+  TArray<uint8> Message = MoveTemp(Payload);
+  if (bCompressed) {
+    TArray<uint8> Inflated;
+    if (!DecompressMessage(Message, Inflated)) {
+      TearDown(TEXT("Failed to inflate compressed WebSocket message."), false,
+               1007);
+      return false;
+    }
+    Message = MoveTemp(Inflated);
+  }
+
+  if (DataOpCode == OpCodeBinary) {
+    HandleBinaryPayload(MoveTemp(Message));
+  } else {
+    HandleTextPayload(Message);
+  }
+  return true;
+}
+
 void FMcpBridgeWebSocket::ResetFragmentState() {
   FragmentAccumulator.Reset();
   bFragmentMessageActive = false;
+  bFragmentCompressed = false;
+  FragmentOpCode = 0;
 }
 
 bool FMcpBridgeWebSocket::ReceiveFrame() {
@@ -1711,6 +3255,7 @@ bool FMcpBridgeWebSocket::ReceiveFrame() {
   }
 
   const bool bFinalFrame = (Header[0] & 0x80) != 0;
+  const bool bCompressedFrame = (Header[0] & 0x40) != 0;
   const uint8 OpCode = Header[0] & 0x0F;
   uint64 PayloadLength = Header[1] & 0x7F;
   const bool bMasked = (Header[1] & 0x80) != 0;
@@ -1720,6 +3265,17 @@ bool FMcpBridgeWebSocket::ReceiveFrame() {
     return false;
   }
 
+  // RSV2/RSV3 are never negotiated; RSV1 is only legal on the first frame
+  // of a data message once permessage-deflate is active.
+  if ((Header[0] & 0x30) != 0 ||
+      (bCompressedFrame &&
+       (!bDeflateNegotiated || (OpCode != OpCodeText &&
+                                OpCode != OpCodeBinary)))) {
+    TearDown(TEXT("Unexpected reserved bits in WebSocket frame."), false,
+             1002);
+    return false;
+  }
+
   if (PayloadLength == 126) {
     uint8 Extended[2];
     if (!ReceiveExact(Extended, sizeof(Extended))) {
@@ -1761,9 +3317,8 @@ bool FMcpBridgeWebSocket::ReceiveFrame() {
       return false;
     }
     if (bMasked) {
-      for (uint64 Index = 0; Index < PayloadLength; ++Index) {
-        Payload[Index] ^= MaskKey[Index % 4];
-      }
+      ApplyWebSocketMask(Payload.GetData(), Payload.GetData(),
+                         static_cast<SIZE_T>(PayloadLength), MaskKey);
     }
   }
 
@@ -1780,7 +3335,7 @@ bool FMcpBridgeWebSocket::ReceiveFrame() {
     }
 
     if (OpCode == OpCodePing) {
-      SendControlFrame(OpCodePong, Payload);
+      EnqueueOutbound(OpCodePong, MoveTemp(Payload));
       return true;
     }
 
@@ -1811,8 +3366,12 @@ bool FMcpBridgeWebSocket::ReceiveFrame() {
     FragmentAccumulator.Append(Payload);
 
     if (bFinalFrame) {
-      HandleTextPayload(FragmentAccumulator);
+      const uint8 MessageOpCode = FragmentOpCode;
+      const bool bMessageCompressed = bFragmentCompressed;
+      TArray<uint8> Message = MoveTemp(FragmentAccumulator);
       ResetFragmentState();
+      return DeliverDataMessage(MessageOpCode, bMessageCompressed,
+                                MoveTemp(Message));
     }
     return true;
   }
@@ -1824,9 +3383,9 @@ bool FMcpBridgeWebSocket::ReceiveFrame() {
     return false;
   }
 
-  if (OpCode == OpCodeText) {
+  if (OpCode == OpCodeText || OpCode == OpCodeBinary) {
     if (bFinalFrame) {
-      HandleTextPayload(Payload);
+      return DeliverDataMessage(OpCode, bCompressedFrame, MoveTemp(Payload));
     } else {
       if (static_cast<uint64>(Payload.Num()) > MaxWebSocketMessageBytes) {
         TearDown(TEXT("WebSocket message too large."), false, WebSocketCloseCodeMessageTooBig);
@@ -1834,98 +3393,99 @@ bool FMcpBridgeWebSocket::ReceiveFrame() {
       }
       FragmentAccumulator = Payload;
       bFragmentMessageActive = true;
+      bFragmentCompressed = bCompressedFrame;
+      FragmentOpCode = OpCode;
     }
     return true;
   }
 
-  if (OpCode == OpCodeBinary) {
-    TearDown(TEXT("Binary frames are not supported."), false, 4003);
-    return false;
-  }
-
   TearDown(TEXT("Unsupported WebSocket opcode."), false, 4003);
   return false;
 }
 
+bool FMcpBridgeWebSocket::WaitForReadable(const FTimespan &Timeout) {
+#if WITH_SSL
+  // Records already decrypted by OpenSSL are invisible to poll().
+  if (bUseTls && SslHandle && SSL_pending(SslHandle) > 0) {
+    return true;
+  }
+#endif
+
+#if MCP_BRIDGE_NATIVE_SOCKETS
+  if (NativeSocketHandle != 0) {
+    McpBridgeNativeSocket::FPollEntry Entry =
+        McpBridgeNativeSocket::MakePollEntry(NativeSocketHandle, true, false);
+    // Errors are reported as readable so the following read surfaces the
+    // failure through the normal teardown path.
+    return McpBridgeNativeSocket::Poll(
+               &Entry, 1,
+               static_cast<int32>(Timeout.GetTotalMilliseconds())) != 0;
+  }
+#endif
+
+  if (!Socket) {
+    return false;
+  }
+  return Socket->Wait(ESocketWaitConditions::WaitForRead, Timeout);
+}
+
 bool FMcpBridgeWebSocket::ReceiveExact(uint8 *Buffer, SIZE_T Length) {
   SIZE_T Collected = 0;
 
   {
     FScopeLock Guard(&ReceiveMutex);
-    const SIZE_T Existing =
-        FMath::Min(static_cast<SIZE_T>(PendingReceived.Num()), Length);
-    if (Existing > 0) {
-      FMemory::Memcpy(Buffer, PendingReceived.GetData(), Existing);
-      PendingReceived.RemoveAt(0, Existing
-#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4
-      // UE 5.4+: Uses EAllowShrinking enum
-      , EAllowShrinking::No
-#elif ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
-      // UE 5.1-5.3: Uses bool bAllowShrinking
-      , false
-#endif
-      );
-      Collected += Existing;
-    }
+    Collected = static_cast<SIZE_T>(ReceiveBuffer.Read(
+        Buffer, static_cast<int32>(FMath::Min<SIZE_T>(Length, MAX_int32))));
   }
 
-  if (bUseTls && SslHandle) {
-    while (Collected < Length) {
-      if (bStopping) {
-        return false;
-      }
-
-      const int32 Remaining = static_cast<int32>(Length - Collected);
-      int32 BytesRead = 0;
-      if (!RecvRaw(Buffer + Collected, Remaining, BytesRead)) {
-        return false;
-      }
-      if (BytesRead <= 0) {
-        if (StopEvent && StopEvent->Wait(FTimespan::FromMilliseconds(10))) {
-          return false;
-        }
-        continue;
-      }
-      Collected += static_cast<SIZE_T>(BytesRead);
-    }
-    return true;
-  }
+  const FTimespan WaitTimeout =
+      FTimespan::FromMilliseconds(ReceiveReadinessWaitMs);
 
   while (Collected < Length) {
-    if (bStopping) {
+    if (bStopping || bOutboundFailed) {
       return false;
     }
+    if (!HasTransport()) {
+      return false;
+    }
+
+    if (!WaitForReadable(WaitTimeout)) {
+      continue;
+    }
+
+    const SIZE_T Remaining = Length - Collected;
+    int32 BytesRead = 0;
 
-    uint32 PendingSize = 0;
-    if (!Socket->HasPendingData(PendingSize)) {
-      if (StopEvent && StopEvent->Wait(FTimespan::FromMilliseconds(50))) {
+    // Large payload remainders bypass the ring and land in the caller's
+    // buffer directly; everything else is read in bulk into the ring so
+    // the frames behind it are parsed without another syscall.
+    if (Remaining >= static_cast<SIZE_T>(ReceiveBuffer.Capacity() / 2)) {
+      const int32 ReadSize =
+          static_cast<int32>(FMath::Min<SIZE_T>(Remaining, MAX_int32));
+      if (!RecvRaw(Buffer + Collected, ReadSize, BytesRead)) {
         return false;
       }
+      Collected += static_cast<SIZE_T>(FMath::Max(BytesRead, 0));
       continue;
     }
 
-    const uint32 ReadSize = FMath::Min<uint32>(PendingSize, 4096);
-    TArray<uint8> Temp;
-    Temp.SetNumUninitialized(ReadSize);
-    int32 BytesRead = 0;
-    if (!RecvRaw(Temp.GetData(), ReadSize, BytesRead)) {
+    FScopeLock Guard(&ReceiveMutex);
+    uint8 *WritePtr = nullptr;
+    const int32 WritableBytes = ReceiveBuffer.GetWriteRegion(WritePtr);
+    if (WritableBytes <= 0) {
+      // The ring is drained before every read, so this only guards against
+      // spinning on a full ring.
+      return false;
+    }
+    if (!RecvRaw(WritePtr, WritableBytes, BytesRead)) {
       return false;
     }
-
     if (BytesRead <= 0) {
       continue;
     }
-
-    const uint32 CopyCount =
-        FMath::Min<uint32>(static_cast<uint32>(BytesRead),
-                           static_cast<uint32>(Length - Collected));
-    FMemory::Memcpy(Buffer + Collected, Temp.GetData(), CopyCount);
-    Collected += CopyCount;
-
-    if (static_cast<uint32>(BytesRead) > CopyCount) {
-      FScopeLock Guard(&ReceiveMutex);
-      PendingReceived.Append(Temp.GetData() + CopyCount, BytesRead - CopyCount);
-    }
+    ReceiveBuffer.CommitWrite(BytesRead);
+    Collected += static_cast<SIZE_T>(
+        ReceiveBuffer.Read(Buffer + Collected, static_cast<int32>(Remaining)));
   }
 
   return true;
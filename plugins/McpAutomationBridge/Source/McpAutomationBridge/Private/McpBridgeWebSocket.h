@@ -1,12 +1,18 @@
 #pragma once
 
 #include "Containers/Array.h"
+#include "Containers/Queue.h"
 #include "Containers/UnrealString.h"
 #include "Delegates/Delegate.h"
 #include "HAL/CriticalSection.h"
 #include "HAL/Runnable.h"
+#include "Math/UnrealMathUtility.h"
+#include "Misc/Timespan.h"
 #include "Templates/Atomic.h"
+#include "Templates/Function.h"
 #include "Templates/SharedPointer.h"
+#include "Templates/UniquePtr.h"
+#include "McpTokenBucket.h"
 
 class FSocket;
 class FInternetAddr;
@@ -21,17 +27,133 @@ typedef struct ssl_st SSL;
 #endif
 
 class FMcpBridgeWebSocket;
+class FMcpBridgeReactor;
+
+/**
+ * Fixed-capacity byte ring used by the WebSocket receive path.
+ * Socket reads land directly in the free region so one recv can carry several
+ * frames without per-read allocations or shifting consumed bytes out of the way.
+ * Capacity is always a power of two; Append grows the ring only when a caller
+ * pushes more than fits (e.g. bytes preserved from the HTTP upgrade).
+ */
+class FMcpByteRingBuffer
+{
+public:
+    explicit FMcpByteRingBuffer(int32 InCapacity = 64 * 1024)
+    {
+        Storage.SetNumUninitialized(static_cast<int32>(FMath::RoundUpToPowerOfTwo(static_cast<uint32>(FMath::Max(InCapacity, 16)))));
+    }
+
+    int32 Num() const { return Count; }
+    int32 Capacity() const { return Storage.Num(); }
+    int32 FreeSpace() const { return Storage.Num() - Count; }
+    bool IsEmpty() const { return Count == 0; }
+    void Reset() { Head = 0; Count = 0; }
+
+    /** Copies up to Length buffered bytes into Out without consuming them. */
+    int32 Peek(uint8* Out, int32 Length) const
+    {
+        const int32 ToCopy = FMath::Min(Length, Count);
+        const int32 First = FMath::Min(ToCopy, Storage.Num() - Head);
+        FMemory::Memcpy(Out, Storage.GetData() + Head, First);
+        if (ToCopy > First)
+        {
+            FMemory::Memcpy(Out + First, Storage.GetData(), ToCopy - First);
+        }
+        return ToCopy;
+    }
+
+    void Consume(int32 Length)
+    {
+        const int32 ToDrop = FMath::Min(Length, Count);
+        Head = (Head + ToDrop) & (Storage.Num() - 1);
+        Count -= ToDrop;
+        if (Count == 0)
+        {
+            // Rewind so the next socket read gets the largest contiguous span.
+            Head = 0;
+        }
+    }
+
+    int32 Read(uint8* Out, int32 Length)
+    {
+        const int32 Copied = Peek(Out, Length);
+        Consume(Copied);
+        return Copied;
+    }
+
+    void Append(const uint8* Data, int32 Length)
+    {
+        if (Length <= 0)
+        {
+            return;
+        }
+        if (Length > FreeSpace())
+        {
+            Grow(Count + Length);
+        }
+        const int32 Tail = (Head + Count) & (Storage.Num() - 1);
+        const int32 First = FMath::Min(Length, Storage.Num() - Tail);
+        FMemory::Memcpy(Storage.GetData() + Tail, Data, First);
+        if (Length > First)
+        {
+            FMemory::Memcpy(Storage.GetData(), Data + First, Length - First);
+        }
+        Count += Length;
+    }
+
+    /** Largest contiguous writable span at the tail; 0 when the ring is full. */
+    int32 GetWriteRegion(uint8*& OutData)
+    {
+        const int32 Tail = (Head + Count) & (Storage.Num() - 1);
+        const int32 Contiguous = (Tail >= Head && Count < Storage.Num())
+            ? Storage.Num() - Tail
+            : Head - Tail;
+        OutData = Storage.GetData() + Tail;
+        return FMath::Min(Contiguous, FreeSpace());
+    }
+
+    /** Marks Length bytes written through GetWriteRegion as readable. */
+    void CommitWrite(int32 Length)
+    {
+        Count += FMath::Clamp(Length, 0, FreeSpace());
+    }
+
+    /** Grows the ring so it can hold at least MinCapacity bytes; never shrinks. */
+    void Reserve(int32 MinCapacity)
+    {
+        if (MinCapacity > Storage.Num())
+        {
+            Grow(MinCapacity);
+        }
+    }
+
+private:
+    void Grow(int32 MinCapacity)
+    {
+        TArray<uint8> Resized;
+        Resized.SetNumUninitialized(static_cast<int32>(FMath::RoundUpToPowerOfTwo(static_cast<uint32>(MinCapacity))));
+        Peek(Resized.GetData(), Count);
+        Storage = MoveTemp(Resized);
+        Head = 0;
+    }
+
+    TArray<uint8> Storage;
+    int32 Head = 0;
+    int32 Count = 0;
+};
 
 DECLARE_MULTICAST_DELEGATE_OneParam(FMcpBridgeWebSocketConnectedEvent, TSharedPtr<FMcpBridgeWebSocket>);
 DECLARE_MULTICAST_DELEGATE_OneParam(FMcpBridgeWebSocketConnectionErrorEvent, const FString& /*Error*/);
 DECLARE_MULTICAST_DELEGATE_FourParams(FMcpBridgeWebSocketClosedEvent, TSharedPtr<FMcpBridgeWebSocket>, int32, const FString&, bool);
 DECLARE_MULTICAST_DELEGATE_TwoParams(FMcpBridgeWebSocketMessageEvent, TSharedPtr<FMcpBridgeWebSocket>, const FString& /*Message*/);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FMcpBridgeWebSocketBinaryMessageEvent, TSharedPtr<FMcpBridgeWebSocket>, const TArray<uint8>& /*Payload*/);
 DECLARE_MULTICAST_DELEGATE_OneParam(FMcpBridgeWebSocketHeartbeatEvent, TSharedPtr<FMcpBridgeWebSocket>);
 DECLARE_MULTICAST_DELEGATE_OneParam(FMcpBridgeWebSocketClientConnectedEvent, TSharedPtr<FMcpBridgeWebSocket>);
 
 /**
  * Minimal WebSocket client/server used by the MCP Automation Bridge subsystem.
- * Supports text frames over ws:// and optional wss:// transports for local automation traffic.
+ * Supports text and binary frames over ws:// and optional wss:// transports for local automation traffic.
  */
 class FMcpBridgeWebSocket final : public TSharedFromThis<FMcpBridgeWebSocket>, public FRunnable
 {
@@ -46,8 +168,22 @@ public:
     void Connect();
     void Listen();
     void Close(int32 StatusCode = 1000, const FString& Reason = FString());
+    /**
+     * Send and SendBinary only enqueue: a per-connection writer thread (or the shared reactor)
+     * puts the frames on the wire, so the calling (game) thread never blocks on a slow peer. The rvalue overloads take
+     * ownership of the payload on success and leave it untouched when the message is rejected.
+     */
     bool Send(const FString& Data);
     bool Send(const void* Data, SIZE_T Length);
+    bool Send(TArray<uint8>&& Utf8Payload);
+    /**
+     * Queues a text message whose encoded bytes are shared with other connections: the queue
+     * holds a reference, so fanning one event out to many sockets never copies it.
+     */
+    bool SendShared(const TSharedRef<const TArray<uint8>, ESPMode::ThreadSafe>& Utf8Payload);
+    /** Sends Data as a single binary (opcode 0x2) message. */
+    bool SendBinary(const void* Data, SIZE_T Length);
+    bool SendBinary(TArray<uint8>&& Payload);
     bool IsConnected() const;
     bool IsListening() const;
 
@@ -57,11 +193,75 @@ public:
 
     void SendHeartbeatPing();
 
+    /**
+     * Configures the permessage-deflate extension (RFC 7692). Call before Connect()/Listen();
+     * listeners hand the same configuration to every accepted connection. Compression is only
+     * active once both peers agree on it during the upgrade handshake.
+     */
+    void SetPerMessageDeflate(bool bEnable, bool bContextTakeover, int32 InThresholdBytes);
+    bool IsPerMessageDeflateNegotiated() const { return bDeflateNegotiated; }
+
+    /**
+     * Backpressure thresholds for the outbound queue. Once queued bytes reach the high watermark
+     * IsOutboundBackpressured() reports true until the writer drains the queue to the low
+     * watermark; callers use it to shed discardable traffic such as log streaming.
+     */
+    void SetOutboundWatermarks(int64 InHighWatermarkBytes, int64 InLowWatermarkBytes);
+    int64 GetQueuedOutboundBytes() const { return QueuedOutboundBytes; }
+    bool IsOutboundBackpressured() const { return bOutboundBackpressured; }
+
+    /**
+     * Hands this listener to a shared I/O reactor. Call before Listen(): the listen socket and
+     * every connection it accepts are then pumped by the reactor's threads instead of each
+     * getting dedicated reader and writer threads.
+     */
+    void SetReactor(const TSharedPtr<FMcpBridgeReactor>& InReactor);
+
+    /**
+     * Optional hook for inbound text messages, run on the socket's I/O thread with the raw UTF-8
+     * payload. When set it replaces the game-thread OnMessage broadcast so the owner can decode and
+     * validate messages off the game thread. Set before Connect()/Listen(); listeners hand it to
+     * every accepted connection.
+     */
+    using FInboundTextHandler = TFunction<void(const TSharedPtr<FMcpBridgeWebSocket>&, const TArray<uint8>&)>;
+    void SetInboundTextHandler(FInboundTextHandler InHandler);
+    /** Same contract for binary data messages; replaces the game-thread OnBinaryMessage broadcast. */
+    void SetInboundBinaryHandler(FInboundTextHandler InHandler);
+
+    /**
+     * Optional hook for plain HTTP GET requests that reach a listen port instead of a WebSocket
+     * upgrade, e.g. a metrics scraper. Run on the socket's I/O thread with the request path and
+     * lower-cased header names; returning false answers 404. The connection is closed after the
+     * response. Set before Listen(); listeners hand it to every accepted connection.
+     */
+    using FHttpGetHandler = TFunction<bool(const FString& Path, const TMap<FString, FString>& Headers, int32& OutStatusCode, FString& OutContentType, FString& OutBody)>;
+    void SetHttpGetHandler(FHttpGetHandler InHandler);
+
+    /**
+     * Per-connection token buckets for the owner's rate limits. The owner picks what each slot
+     * means and supplies the policy on every call; the socket only holds the lock-free state so
+     * it lives and dies with the connection.
+     */
+    static constexpr int32 NumRateLimitBuckets = 4;
+    FMcpTokenBucket& GetRateLimitBucket(int32 Slot) { return RateLimitBuckets[Slot]; }
+
+    /** Bytes read from / written to every bridge socket in this process, TLS records included. */
+    static int64 GetTotalBytesReceived();
+    static int64 GetTotalBytesSent();
+
+    /**
+     * Advances a reactor-driven socket without blocking on an idle peer. Returns false once the
+     * socket is finished and should be dropped by the reactor. bOutDidWork reports whether any
+     * bytes moved; once nothing did, the caller waits on GetReactorInterest() before pumping again.
+     */
+    bool PumpReactor(double NowSeconds, bool& bOutDidWork);
+
     // Delegates
     FMcpBridgeWebSocketConnectedEvent ConnectedDelegate;
     FMcpBridgeWebSocketConnectionErrorEvent ConnectionErrorDelegate;
     FMcpBridgeWebSocketClosedEvent ClosedDelegate;
     FMcpBridgeWebSocketMessageEvent MessageDelegate;
+    FMcpBridgeWebSocketBinaryMessageEvent BinaryMessageDelegate;
     FMcpBridgeWebSocketHeartbeatEvent HeartbeatDelegate;
     FMcpBridgeWebSocketClientConnectedEvent ClientConnectedDelegate;
 
@@ -73,6 +273,7 @@ public:
     FMcpBridgeWebSocketConnectionErrorEvent& OnConnectionError() { return ConnectionErrorDelegate; }
     FMcpBridgeWebSocketClosedEvent& OnClosed() { return ClosedDelegate; }
     FMcpBridgeWebSocketMessageEvent& OnMessage() { return MessageDelegate; }
+    FMcpBridgeWebSocketBinaryMessageEvent& OnBinaryMessage() { return BinaryMessageDelegate; }
     FMcpBridgeWebSocketHeartbeatEvent& OnHeartbeat() { return HeartbeatDelegate; }
     FMcpBridgeWebSocketClientConnectedEvent& OnClientConnected() { return ClientConnectedDelegate; }
 
@@ -95,21 +296,74 @@ private:
     void TearDown(const FString& Reason, bool bWasClean, int32 StatusCode);
     bool PerformHandshake();
     bool PerformServerHandshake();
+    bool CompleteServerHandshake(const TArray<uint8>& RequestBuffer, int32 HeaderEndIndex);
+    /** Answers a non-upgrade GET through HttpGetHandler and tears the connection down. */
+    void ServeHttpGetRequest(const FString& RequestLine, const TMap<FString, FString>& Headers);
+    void OnConnectionEstablished();
+    bool OpenListenSocket();
+    /** NativeClientHandle is set instead of ClientSocket for connections accepted on a released listen descriptor. */
+    void AcceptClient(FSocket* ClientSocket, UPTRINT NativeClientHandle = 0);
+    /** Makes an accepted connection non-blocking and hands its descriptor to the reactor where the engine allows it. */
+    void PrepareReactorTransport();
+    /** Takes over the descriptor behind InOutSocket and destroys the FSocket; false when the engine keeps it. */
+    bool AdoptNativeSocket(FSocket*& InOutSocket);
+    bool PumpListener(bool& bOutDidWork);
+    bool PumpServerHandshake(double NowSeconds, bool& bOutDidWork);
+    bool PumpOpenConnection(bool& bOutDidWork);
+    bool PumpClosing(double NowSeconds, bool& bOutDidWork);
+    bool DrainBufferedFrames(bool& bOutDidWork);
+    /** Drops queued messages and closes the transport, lingering first while staged bytes are still unsent. */
+    bool FinishReactorConnection();
+    bool CloseReactorTransport();
     bool ResolveEndpoint(TSharedPtr<FInternetAddr>& OutAddr);
-    bool SendFrame(const TArray<uint8>& Frame);
+    bool SendAll(const uint8* Data, SIZE_T Length);
+    bool SendOrStage(const uint8* Data, SIZE_T Length);
+    /** Writes staged bytes until the socket would block; false only on a transport error. */
+    bool FlushStagedWrites(bool& bOutDidWork);
+    bool HasStagedWrites() const { return StagedWriteOffset < StagedWrites.Num(); }
+    bool HasTransport() const { return Socket != nullptr || NativeSocketHandle != 0; }
     bool SendCloseFrame(int32 StatusCode, const FString& Reason);
     bool SendTextFrame(const void* Data, SIZE_T Length);
+    // Callers of SendDataMessage/SendFragment must hold SendMutex.
+    bool SendDataMessage(uint8 DataOpCode, bool bCompressed, const uint8* Data, SIZE_T Length);
+    bool SendFragment(uint8 FirstByte, const uint8* Data, SIZE_T Length);
     bool SendControlFrame(uint8 ControlOpCode, const TArray<uint8>& Payload);
+    bool EnqueueOutbound(uint8 OpCode, TArray<uint8>&& Payload);
+    bool EnqueueOutbound(uint8 OpCode, TArray<uint8>&& Payload,
+                         TSharedPtr<const TArray<uint8>, ESPMode::ThreadSafe> SharedPayload);
+    void StartOutboundWriter();
+    void StopOutboundWriter();
+    void RunOutboundWriter();
+    bool DrainOutboundQueue(int64 ByteBudget, bool& bOutDidWork);
+    void DiscardOutboundQueue();
+    void InterruptTransport();
     void HandleTextPayload(const TArray<uint8>& Payload);
+    void HandleBinaryPayload(TArray<uint8>&& Payload);
+    bool DeliverDataMessage(uint8 DataOpCode, bool bCompressed, TArray<uint8>&& Payload);
     void ResetFragmentState();
+    FString BuildDeflateOffer() const;
+    bool AcceptDeflateOffer(const FString& OfferHeader, FString& OutResponseHeader);
+    bool ApplyDeflateResponse(const FString& ResponseHeader);
+    bool CompressMessage(const uint8* Data, SIZE_T Length, TArray<uint8>& OutCompressed);
+    bool DecompressMessage(const TArray<uint8>& Compressed, TArray<uint8>& OutPayload);
     bool ReceiveFrame();
     bool ReceiveExact(uint8* Buffer, SIZE_T Length);
+    bool WaitForReadable(const FTimespan& Timeout);
     bool SendRaw(const uint8* Data, int32 Length, int32& OutBytesSent);
     bool RecvRaw(uint8* Data, int32 Length, int32& OutBytesRead);
-#if WITH_SSL
     bool InitializeTlsContext(bool bServer);
+    /** Blocking handshake for sockets that own their thread. */
     bool EstablishTls(bool bServer);
-#endif
+    // Non-blocking handshake: BeginTls() attaches the SSL state, then StepTlsHandshake() is
+    // retried whenever the socket is ready in the direction bTlsWantsWrite names.
+    enum class ETlsHandshakeStatus : uint8
+    {
+        Complete,
+        Pending,
+        Failed
+    };
+    bool BeginTls(bool bServer);
+    ETlsHandshakeStatus StepTlsHandshake();
     void ShutdownTls();
     void CloseNativeSocket();
     FSocket* DetachSocket();
@@ -123,11 +377,98 @@ private:
 
     // Server tuning (moved later to ensure proper initialization order)
 
-    TArray<uint8> PendingReceived;
+    // Bytes read from the transport but not yet consumed by the frame parser.
+    FMcpByteRingBuffer ReceiveBuffer;
+    // Reused header/masking staging buffer for outbound frames; guarded by SendMutex.
+    TArray<uint8> SendScratch;
+    // Reactor connections never block on a full socket: SendAll() writes what the socket takes
+    // and stages the rest, which the reactor flushes on the next writable event before it
+    // dequeues another message. Guarded by SendMutex.
+    bool bStageReactorWrites = false;
+    TArray<uint8> StagedWrites;
+    int32 StagedWriteOffset = 0;
     TArray<uint8> FragmentAccumulator;
     bool bFragmentMessageActive;
+    bool bFragmentCompressed = false;
+    uint8 FragmentOpCode = 0;
+
+    // permessage-deflate configuration and negotiated state
+    struct FPerMessageDeflateState;
+    // Set by the handshake once deflate is negotiated and never replaced afterwards: the writer
+    // uses its deflater and the reader its inflater without sharing a lock.
+    TUniquePtr<FPerMessageDeflateState> DeflateState;
+    bool bDeflateEnabled = false;
+    bool bDeflateContextTakeover = true;
+    int32 DeflateThresholdBytes = 1024;
+    bool bDeflateNegotiated = false;
+    // Reset our compressor after every message (we advertised or were asked for no_context_takeover).
+    bool bDeflateLocalNoContextTakeover = false;
+    // The peer resets its compressor per message, so our decompressor can drop its window too.
+    bool bDeflatePeerNoContextTakeover = false;
+    int32 DeflateWindowBits = 15;
+
+    // Outbound queue drained by the writer thread. Control frames (ping/pong) jump ahead of
+    // queued data so a large response cannot starve keepalives.
+    struct FOutboundMessage
+    {
+        uint8 OpCode = 0;
+        TArray<uint8> Payload;
+        /** Set instead of Payload for buffers fanned out to several sockets. */
+        TSharedPtr<const TArray<uint8>, ESPMode::ThreadSafe> SharedPayload;
+
+        const TArray<uint8>& GetPayload() const { return SharedPayload.IsValid() ? *SharedPayload : Payload; }
+    };
+    class FOutboundWriter;
+    TQueue<FOutboundMessage, EQueueMode::Mpsc> OutboundQueue;
+    TQueue<FOutboundMessage, EQueueMode::Mpsc> OutboundControlQueue;
+    TUniquePtr<FOutboundWriter> OutboundWriter;
+    FRunnableThread* WriterThread = nullptr;
+    FEvent* OutboundEvent = nullptr;
+    TAtomic<int64> QueuedOutboundBytes{0};
+    TAtomic<bool> bOutboundBackpressured{false};
+    TAtomic<bool> bOutboundFailed{false};
+    TAtomic<bool> bWriterStopping{false};
+    int64 OutboundHighWatermarkBytes = 8 * 1024 * 1024;
+    int64 OutboundLowWatermarkBytes = 2 * 1024 * 1024;
 
     TWeakPtr<FMcpBridgeWebSocket> SelfWeakPtr;
+    FInboundTextHandler InboundTextHandler;
+    FInboundTextHandler InboundBinaryHandler;
+    FHttpGetHandler HttpGetHandler;
+    FMcpTokenBucket RateLimitBuckets[NumRateLimitBuckets];
+
+    // Shared I/O reactor state. Only the owning reactor thread touches the phase, deadline and
+    // handshake buffer; ReactorSlot picks the thread Wake() signals when data is enqueued.
+    // Closing flushes staged bytes after TearDown() before the transport is released.
+    enum class EReactorPhase : uint8
+    {
+        None,
+        Listening,
+        Handshake,
+        AwaitHandler,
+        Open,
+        Closing,
+        Finished
+    };
+    /** What the reactor thread waits for before pumping this socket again. */
+    struct FReactorInterest
+    {
+        /** Native descriptor to poll, or 0 when the transport cannot be waited on. */
+        UPTRINT Handle = 0;
+        bool bRead = false;
+        bool bWrite = false;
+        /** Work is pending that no readiness event will announce, e.g. decrypted TLS records. */
+        bool bReady = false;
+        /** Phase deadline the wait must not sleep past, or 0 for none. */
+        double DeadlineSeconds = 0.0;
+    };
+    void GetReactorInterest(FReactorInterest& OutInterest) const;
+    friend class FMcpBridgeReactor;
+    TSharedPtr<FMcpBridgeReactor> Reactor;
+    int32 ReactorSlot = INDEX_NONE;
+    EReactorPhase ReactorPhase = EReactorPhase::None;
+    double ReactorDeadlineSeconds = 0.0;
+    TArray<uint8> ReactorHandshakeBuffer;
 
     // Server mode members
     bool bServerMode;
@@ -165,6 +506,8 @@ private:
 #endif
     UPTRINT NativeSocketHandle;
     bool bNativeSocketReleased;
+    bool bTlsHandshakePending = false;
+    bool bTlsWantsWrite = false;
     FString TlsCertificatePath;
     FString TlsPrivateKeyPath;
     
@@ -0,0 +1,188 @@
+#include "McpClassIndex.h"
+
+#include "Misc/ScopeLock.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/Class.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/UObjectIterator.h"
+
+#if WITH_EDITOR
+#include "Editor.h"
+#endif
+
+namespace {
+FMcpClassIndex *GMcpClassIndex = nullptr;
+
+bool IsNativeClassPackage(const UClass *Class) {
+  const UPackage *Package = Class->GetOutermost();
+  return Package && Package->GetName().StartsWith(TEXT("/Script/"));
+}
+
+// Short name a lookup is keyed by: the whole input, or what follows the last
+// dot for path-style input.
+FString ClassIndexShortName(const FString &Name) {
+  int32 Dot = INDEX_NONE;
+  return Name.FindLastChar(TEXT('.'), Dot) ? Name.Mid(Dot + 1) : Name;
+}
+
+bool MatchesClassName(const UClass *Class, const FString &Name,
+                      bool bPathStyle) {
+  return bPathStyle
+             ? Class->GetPathName().EndsWith(TEXT(".") + Name,
+                                             ESearchCase::IgnoreCase)
+             : Class->GetName().Equals(Name, ESearchCase::IgnoreCase);
+}
+} // namespace
+
+void FMcpClassIndex::Startup() {
+  if (!GMcpClassIndex) {
+    GMcpClassIndex = new FMcpClassIndex();
+  }
+}
+
+// Owned through a raw pointer: only members can reach the private destructor.
+void FMcpClassIndex::Shutdown() {
+  delete GMcpClassIndex;
+  GMcpClassIndex = nullptr;
+}
+
+UClass *FMcpClassIndex::FindLoadedClass(const FString &Name) {
+  if (Name.IsEmpty()) {
+    return nullptr;
+  }
+  return GMcpClassIndex ? GMcpClassIndex->Find(Name) : Scan(Name);
+}
+
+FMcpClassIndex::FMcpClassIndex() {
+  // Hot reload and Live Coding can rename or replace classes wholesale.
+  ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda(
+      [this](EReloadCompleteReason) { MarkStale(); });
+  // A module load registers its native classes.
+  ModulesChangedHandle = FModuleManager::Get().OnModulesChanged().AddLambda(
+      [this](FName, EModuleChangeReason) { MarkStale(); });
+#if WITH_EDITOR
+  // Loading a Blueprint asset brings its generated class in.
+  AssetLoadedHandle = FCoreUObjectDelegates::OnAssetLoaded.AddLambda(
+      [this](UObject *) { ForgetMisses(); });
+#endif
+}
+
+FMcpClassIndex::~FMcpClassIndex() {
+  FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+  FModuleManager::Get().OnModulesChanged().Remove(ModulesChangedHandle);
+#if WITH_EDITOR
+  FCoreUObjectDelegates::OnAssetLoaded.Remove(AssetLoadedHandle);
+  if (GEditor && BlueprintCompiledHandle.IsValid()) {
+    GEditor->OnBlueprintCompiled().Remove(BlueprintCompiledHandle);
+  }
+#endif
+}
+
+void FMcpClassIndex::BindEditorHooks() {
+#if WITH_EDITOR
+  // GEditor does not exist yet when the module starts; bind on first use.
+  // Compiling a new Blueprint creates its class without an asset load.
+  if (!BlueprintCompiledHandle.IsValid() && GEditor) {
+    BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddLambda(
+        [this]() { ForgetMisses(); });
+  }
+#endif
+}
+
+void FMcpClassIndex::MarkStale() {
+  FScopeLock Lock(&Mutex);
+  bBuilt = false;
+  Misses.Reset();
+}
+
+void FMcpClassIndex::ForgetMisses() {
+  FScopeLock Lock(&Mutex);
+  if (Misses.Num() > 0) {
+    Misses.Reset();
+  }
+}
+
+void FMcpClassIndex::Rebuild() {
+  ByShortName.Reset();
+  for (TObjectIterator<UClass> It; It; ++It) {
+    UClass *Class = *It;
+    if (Class) {
+      ByShortName.FindOrAdd(Class->GetFName())
+          .Add({Class, IsNativeClassPackage(Class)});
+    }
+  }
+  bBuilt = true;
+}
+
+UClass *FMcpClassIndex::FindInIndex(FName ShortName,
+                                    const FString &Name) const {
+  const TArray<FEntry, TInlineAllocator<1>> *Entries =
+      ByShortName.Find(ShortName);
+  if (!Entries) {
+    return nullptr;
+  }
+  const bool bPathStyle = Name.Contains(TEXT("."));
+  UClass *BestMatch = nullptr;
+  for (const FEntry &Entry : *Entries) {
+    UClass *Class = Entry.Class.Get();
+    // Entries can go stale through GC or a rename since the build.
+    if (!Class || Class->GetFName() != ShortName ||
+        (bPathStyle && !MatchesClassName(Class, Name, true))) {
+      continue;
+    }
+    if (Entry.bNative) {
+      return Class;
+    }
+    if (!BestMatch) {
+      BestMatch = Class;
+    }
+  }
+  return BestMatch;
+}
+
+UClass *FMcpClassIndex::Find(const FString &Name) {
+  BindEditorHooks();
+
+  // No FName with this text means no object, class or not, carries it.
+  const FName ShortName(*ClassIndexShortName(Name), FNAME_Find);
+  if (ShortName.IsNone()) {
+    return nullptr;
+  }
+
+  FScopeLock Lock(&Mutex);
+  if (!bBuilt) {
+    Rebuild();
+  } else if (UClass *Found = FindInIndex(ShortName, Name)) {
+    return Found;
+  } else if (Misses.Contains(ShortName)) {
+    return nullptr;
+  } else {
+    // Possibly a class created since the build; one rebuild settles it.
+    Rebuild();
+  }
+
+  if (UClass *Found = FindInIndex(ShortName, Name)) {
+    return Found;
+  }
+  Misses.Add(ShortName);
+  return nullptr;
+}
+
+UClass *FMcpClassIndex::Scan(const FString &Name) {
+  const bool bPathStyle = Name.Contains(TEXT("."));
+  UClass *BestMatch = nullptr;
+  for (TObjectIterator<UClass> It; It; ++It) {
+    UClass *Class = *It;
+    if (!Class || !MatchesClassName(Class, Name, bPathStyle)) {
+      continue;
+    }
+    if (IsNativeClassPackage(Class)) {
+      return Class;
+    }
+    if (!BestMatch) {
+      BestMatch = Class;
+    }
+  }
+  return BestMatch;
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "UObject/WeakObjectPtr.h"
+
+/**
+ * Short name -> loaded UClass index behind ResolveClassByName and ResolveUClass, replacing their
+ * TObjectIterator<UClass> scans. Built on first use from one pass over the loaded classes, keyed by
+ * FName so lookups neither allocate nor compare strings.
+ *
+ * A hit is re-checked (still alive, same name) before it is returned. A miss rebuilds the index
+ * once and remembers the name; that negative entry is forgotten whenever a new class may have
+ * appeared (module load, asset load, Blueprint compile, hot reload), so classes created after the
+ * build are still found.
+ */
+class FMcpClassIndex
+{
+public:
+    /** Called by the module; lookups before Startup or after Shutdown fall back to a plain scan. */
+    static void Startup();
+    static void Shutdown();
+
+    /**
+     * Finds a loaded class whose short name is Name, or, when Name contains dots, whose path ends
+     * with ".Name". Classes under /Script/ win over Blueprint and other content classes.
+     */
+    static UClass* FindLoadedClass(const FString& Name);
+
+private:
+    struct FEntry
+    {
+        TWeakObjectPtr<UClass> Class;
+        bool bNative = false;
+    };
+
+    FMcpClassIndex();
+    ~FMcpClassIndex();
+
+    UClass* Find(const FString& Name);
+    UClass* FindInIndex(FName ShortName, const FString& Name) const;
+    void Rebuild();
+    void MarkStale();
+    void ForgetMisses();
+    void BindEditorHooks();
+
+    static UClass* Scan(const FString& Name);
+
+    mutable FCriticalSection Mutex;
+    TMap<FName, TArray<FEntry, TInlineAllocator<1>>> ByShortName;
+    TSet<FName> Misses;
+    bool bBuilt = false;
+
+    FDelegateHandle ReloadCompleteHandle;
+    FDelegateHandle ModulesChangedHandle;
+    FDelegateHandle AssetLoadedHandle;
+    FDelegateHandle BlueprintCompiledHandle;
+};
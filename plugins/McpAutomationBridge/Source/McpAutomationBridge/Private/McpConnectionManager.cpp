@@ -1,18 +1,101 @@
 #include "McpConnectionManager.h"
+#include "Containers/StringConv.h"
 #include "Dom/JsonObject.h"
 #include "HAL/PlatformTime.h"
 #include "HAL/PlatformProcess.h"
 #include "HAL/PlatformMisc.h"
 #include "McpAutomationBridgeSettings.h"
 #include "McpAutomationBridgeSubsystem.h"
+#include "McpBridgeReactor.h"
+#include "McpBridgeTrace.h"
 #include "McpBridgeWebSocket.h"
+#include "McpJsonUtf8Writer.h"
+#include "McpMessagePack.h"
+#include "McpMpscQueue.h"
+#include "Misc/Base64.h"
 #include "Misc/Guid.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
+#include "Serialization/MemoryWriter.h"
 
 // Reuse the log category from the subsystem for consistency
 // (It is declared extern in McpAutomationBridgeSubsystem.h)
 
+// Binary attachment chunk layout (all integers big-endian):
+//   "MCPA" | u8 version | u8 idLength | id (UTF-8) | u32 offset | u32 total | bytes
+// Chunks stay well below the 5 MB WebSocket message cap enforced by both peers.
+static constexpr uint8 McpAttachmentMagic[4] = {'M', 'C', 'P', 'A'};
+static constexpr uint8 McpAttachmentVersion = 1;
+static constexpr int32 McpAttachmentChunkBytes = 1024 * 1024;
+// idLength is a single byte, so ids are capped in UTF-8 bytes, not characters.
+static constexpr int32 McpAttachmentMaxIdBytes = 255;
+
+TRACE_DECLARE_INT_COUNTER(McpBridgeRequestsInFlight,
+                          TEXT("McpBridge/RequestsInFlight"));
+TRACE_DECLARE_FLOAT_COUNTER(McpBridgeQueueWaitMs,
+                            TEXT("McpBridge/QueueWaitMs"));
+
+static inline void AppendBigEndian32(TArray<uint8> &Out, uint32 Value) {
+  Out.Add(static_cast<uint8>((Value >> 24) & 0xFF));
+  Out.Add(static_cast<uint8>((Value >> 16) & 0xFF));
+  Out.Add(static_cast<uint8>((Value >> 8) & 0xFF));
+  Out.Add(static_cast<uint8>(Value & 0xFF));
+}
+
+// Serialize straight to UTF-8 so large responses are not built as a TCHAR
+// string first and then converted again by FMcpBridgeWebSocket::Send.
+static void SerializeJsonToUtf8(const TSharedRef<FJsonObject> &Object,
+                                TArray<uint8> &OutUtf8) {
+  OutUtf8.Reset();
+  FMemoryWriter Archive(OutUtf8);
+  const TSharedRef<TJsonWriter<UTF8CHAR, TCondensedJsonPrintPolicy<UTF8CHAR>>>
+      Writer = TJsonWriterFactory<
+          UTF8CHAR, TCondensedJsonPrintPolicy<UTF8CHAR>>::Create(&Archive);
+  FJsonSerializer::Serialize(Object, Writer);
+}
+
+/** " (key=value ...)" summary of a result object for the response log line. */
+static FString BuildResultPreview(const TSharedPtr<FJsonObject> &Result) {
+  FString ResultPreview;
+  if (Result.IsValid() && Result->Values.Num() > 0) {
+    TArray<FString> Parts;
+    for (auto& Pair : Result->Values) {
+      FString Val;
+      if (Pair.Value->Type == EJson::String) {
+        Val = FString::Printf(TEXT("\"%s\""), *Pair.Value->AsString().Left(40));
+      } else if (Pair.Value->Type == EJson::Boolean) {
+        Val = Pair.Value->AsBool() ? TEXT("true") : TEXT("false");
+      } else if (Pair.Value->Type == EJson::Number) {
+        Val = FString::Printf(TEXT("%g"), Pair.Value->AsNumber());
+      } else if (Pair.Value->Type == EJson::Array) {
+        Val = FString::Printf(TEXT("[%d]"), Pair.Value->AsArray().Num());
+      } else if (Pair.Value->Type == EJson::Object) {
+        Val = TEXT("{...}");
+      } else {
+        Val = TEXT("?");
+      }
+      Parts.Add(FString::Printf(TEXT("%s=%s"), *Pair.Key, *Val));
+    }
+    ResultPreview = FString::Printf(TEXT(" (%s)"), *FString::Join(Parts, TEXT(" ")));
+  }
+  return ResultPreview;
+}
+
+static FString SerializeBridgeError(const FString &ErrorCode,
+                                    const FString &Message) {
+  TSharedRef<FJsonObject> Err = MakeShared<FJsonObject>();
+  Err->SetStringField(TEXT("type"), TEXT("bridge_error"));
+  Err->SetStringField(TEXT("error"), ErrorCode);
+  if (!Message.IsEmpty())
+    Err->SetStringField(TEXT("message"), Message);
+  FString Serialized;
+  const TSharedRef<TJsonWriter<>> Writer =
+      TJsonWriterFactory<>::Create(&Serialized);
+  FJsonSerializer::Serialize(Err, Writer);
+  return Serialized;
+}
+
 static inline FString SanitizeForLogConnMgr(const FString &In) {
   if (In.IsEmpty())
     return FString();
@@ -30,7 +113,18 @@ static inline FString SanitizeForLogConnMgr(const FString &In) {
   return Out;
 }
 
-FMcpConnectionManager::FMcpConnectionManager() {}
+class FMcpConnectionManager::FInboundQueue final
+    : public TMcpMpscQueue<FMcpConnectionManager::FQueuedInboundMessage> {};
+
+FMcpConnectionManager::FMcpConnectionManager()
+    : InboundQueue(MakeUnique<FInboundQueue>()) {
+  static_assert(static_cast<int32>(ERateLimitBucket::Count) <=
+                    FMcpBridgeWebSocket::NumRateLimitBuckets,
+                "Every rate-limit class needs a token bucket slot.");
+  for (TAtomic<int64> &Rejections : RateLimitRejections) {
+    Rejections = 0;
+  }
+}
 
 FMcpConnectionManager::~FMcpConnectionManager() { Stop(); }
 
@@ -56,12 +150,54 @@ void FMcpConnectionManager::Initialize(
       MaxMessagesPerMinute = Settings->MaxMessagesPerMinute;
     if (Settings->MaxAutomationRequestsPerMinute >= 0)
       MaxAutomationRequestsPerMinute = Settings->MaxAutomationRequestsPerMinute;
+    if (Settings->MaxReadRequestsPerMinute >= 0)
+      MaxReadRequestsPerMinute = Settings->MaxReadRequestsPerMinute;
+    if (Settings->MaxHeavyRequestsPerMinute >= 0)
+      MaxHeavyRequestsPerMinute = Settings->MaxHeavyRequestsPerMinute;
+    if (Settings->RateLimitBurstSeconds >= 0.0f)
+      RateLimitBurstSeconds = Settings->RateLimitBurstSeconds;
+    // Action classes follow the scheduler lanes: interactive actions are the
+    // cheap reads, background actions the heavy builds.
+    ReadRateLimitActions.Reset();
+    for (const FString &Name : Settings->InteractiveLaneActions) {
+      ReadRateLimitActions.Add(Name.ToLower());
+    }
+    HeavyRateLimitActions.Reset();
+    for (const FString &Name : Settings->BackgroundLaneActions) {
+      HeavyRateLimitActions.Add(Name.ToLower());
+    }
     bEnableTls = Settings->bEnableTls;
     if (!Settings->TlsCertificatePath.IsEmpty())
       TlsCertificatePath = Settings->TlsCertificatePath;
     if (!Settings->TlsPrivateKeyPath.IsEmpty())
       TlsPrivateKeyPath = Settings->TlsPrivateKeyPath;
+    bEnablePerMessageDeflate = Settings->bEnablePerMessageDeflate;
+    bPerMessageDeflateContextTakeover =
+        Settings->bPerMessageDeflateContextTakeover;
+    bAllowMessagePackEncoding = Settings->bAllowMessagePackEncoding;
+    if (Settings->PerMessageDeflateThresholdBytes >= 0)
+      PerMessageDeflateThresholdBytes =
+          Settings->PerMessageDeflateThresholdBytes;
+    if (Settings->OutboundQueueHighWatermarkBytes > 0)
+      OutboundQueueHighWatermarkBytes = Settings->OutboundQueueHighWatermarkBytes;
+    if (Settings->OutboundQueueLowWatermarkBytes >= 0)
+      OutboundQueueLowWatermarkBytes = Settings->OutboundQueueLowWatermarkBytes;
+    bUseSharedIoReactor = Settings->bUseSharedIoReactor;
+    if (Settings->IoReactorThreadCount > 0)
+      IoReactorThreadCount = Settings->IoReactorThreadCount;
+    if (Settings->ReplayCacheMaxEntries >= 0)
+      ReplayCacheMaxEntries = Settings->ReplayCacheMaxEntries;
+    if (Settings->ReplayCacheTtlSeconds > 0.0f)
+      ReplayCacheTtlSeconds = Settings->ReplayCacheTtlSeconds;
+    if (Settings->ReplayCacheMaxBytes >= 0)
+      ReplayCacheMaxBytes = Settings->ReplayCacheMaxBytes;
+    bEnableMetricsEndpoint = Settings->bEnableMetricsEndpoint;
+    if (!Settings->MetricsEndpointPath.IsEmpty())
+      MetricsEndpointPath = Settings->MetricsEndpointPath;
   }
+  ReplayCache.Empty(ReplayCacheMaxEntries);
+  ReplayCacheBytes = 0;
+  TelemetryWindowStartSeconds = FPlatformTime::Seconds();
 
   // Allow environment variable overrides for rate limiting (useful for tests)
   // Set MCP_MAX_MESSAGES_PER_MINUTE=0 or MCP_MAX_AUTOMATION_REQUESTS_PER_MINUTE=0 to disable
@@ -85,6 +221,19 @@ void FMcpConnectionManager::Initialize(
              MaxAutomationRequestsPerMinute);
     }
   }
+
+  RateLimitPolicies[static_cast<int32>(ERateLimitBucket::Message)] =
+      FMcpRateLimitPolicy::PerMinute(MaxMessagesPerMinute,
+                                     RateLimitBurstSeconds);
+  RateLimitPolicies[static_cast<int32>(ERateLimitBucket::Automation)] =
+      FMcpRateLimitPolicy::PerMinute(MaxAutomationRequestsPerMinute,
+                                     RateLimitBurstSeconds);
+  RateLimitPolicies[static_cast<int32>(ERateLimitBucket::Read)] =
+      FMcpRateLimitPolicy::PerMinute(MaxReadRequestsPerMinute,
+                                     RateLimitBurstSeconds);
+  RateLimitPolicies[static_cast<int32>(ERateLimitBucket::Heavy)] =
+      FMcpRateLimitPolicy::PerMinute(MaxHeavyRequestsPerMinute,
+                                     RateLimitBurstSeconds);
 }
 
 void FMcpConnectionManager::Start() {
@@ -137,15 +286,22 @@ void FMcpConnectionManager::Stop() {
     }
   }
   ActiveSockets.Empty();
+  StopIoReactor();
   AuthenticatedSockets.Empty();
-  {
-    FScopeLock Lock(&RateLimitMutex);
-    SocketRateLimits.Empty();
+  SocketTopics.Empty();
+  // Drop messages that arrived before the sockets closed.
+  FQueuedInboundMessage Discarded;
+  while (InboundQueue->Dequeue(Discarded)) {
   }
   {
     FScopeLock Lock(&PendingRequestsMutex);
     PendingRequestsToSockets.Empty();
+    CancelledRequestIds.Empty();
   }
+  // Reconnects keep the replay state; a full stop does not.
+  InFlightRequests.Empty();
+  ReplayCache.Empty(ReplayCacheMaxEntries);
+  ReplayCacheBytes = 0;
 
   UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
          TEXT("MCP connection manager stopped."));
@@ -164,7 +320,25 @@ void FMcpConnectionManager::SetOnMessageReceived(
   OnMessageReceived = InCallback;
 }
 
+void FMcpConnectionManager::SetOnCancelRequested(
+    FMcpCancelRequestedCallback InCallback) {
+  OnCancelRequested = InCallback;
+}
+
+void FMcpConnectionManager::SetQueueDepthProvider(
+    FMcpQueueDepthCallback InCallback) {
+  OnQueryQueueDepths = InCallback;
+}
+
+bool FMcpConnectionManager::IsRequestCancelled(
+    const FString &RequestId) const {
+  FScopeLock Lock(&PendingRequestsMutex);
+  return CancelledRequestIds.Contains(RequestId);
+}
+
 bool FMcpConnectionManager::Tick(float DeltaTime) {
+  const double TickStartSeconds = FPlatformTime::Seconds();
+
   // Handle reconnect countdown
   if (bReconnectEnabled && TimeUntilReconnect > 0.0f) {
     TimeUntilReconnect -= DeltaTime;
@@ -187,9 +361,24 @@ bool FMcpConnectionManager::Tick(float DeltaTime) {
     }
   }
 
+  // Requests that never responded would otherwise pin their ids forever.
+  if (InFlightRequests.Num() > FMath::Max(ReplayCacheMaxEntries, 64)) {
+    const double Now = FPlatformTime::Seconds();
+    for (auto It = InFlightRequests.CreateIterator(); It; ++It) {
+      if (Now - It.Value().DispatchedSeconds > ReplayCacheTtlSeconds) {
+        It.RemoveCurrent();
+      }
+    }
+  }
+
   // Telemetry summary
-  EmitAutomationTelemetrySummaryIfNeeded(FPlatformTime::Seconds());
+  const double NowSeconds = FPlatformTime::Seconds();
+  EmitAutomationTelemetrySummaryIfNeeded(NowSeconds);
+  if (bEnableMetricsEndpoint && NowSeconds - LastMetricsRefreshSeconds >= 1.0) {
+    RefreshMetricsText(NowSeconds);
+  }
 
+  GameThreadSeconds += FPlatformTime::Seconds() - TickStartSeconds;
   return true;
 }
 
@@ -230,6 +419,18 @@ void FMcpConnectionManager::AttemptConnection() {
         EnvListenHost.IsEmpty() ? Settings->ListenHost : EnvListenHost;
     TWeakPtr<FMcpConnectionManager> WeakSelf = AsShared();
 
+    if (bUseSharedIoReactor && !IoReactor.IsValid()) {
+      TSharedPtr<FMcpBridgeReactor> NewReactor =
+          MakeShared<FMcpBridgeReactor>(IoReactorThreadCount);
+      if (NewReactor->Start()) {
+        IoReactor = NewReactor;
+      } else {
+        UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
+               TEXT("Shared I/O reactor unavailable; listeners fall back to "
+                    "per-connection threads."));
+      }
+    }
+
     for (const FString &Token : PortTokens) {
       const FString Trimmed = Token.TrimStartAndEnd();
       if (Trimmed.IsEmpty())
@@ -260,6 +461,42 @@ void FMcpConnectionManager::AttemptConnection() {
                                           bEnableTls, TlsCertificatePath,
                                           TlsPrivateKeyPath);
       ServerSocket->InitializeWeakSelf(ServerSocket);
+      ServerSocket->SetPerMessageDeflate(bEnablePerMessageDeflate,
+                                         bPerMessageDeflateContextTakeover,
+                                         PerMessageDeflateThresholdBytes);
+      ServerSocket->SetOutboundWatermarks(OutboundQueueHighWatermarkBytes,
+                                          OutboundQueueLowWatermarkBytes);
+      if (IoReactor.IsValid()) {
+        ServerSocket->SetReactor(IoReactor);
+      }
+      // Accepted clients inherit this and decode on their own I/O thread.
+      ServerSocket->SetInboundTextHandler(
+          [WeakSelf](const TSharedPtr<FMcpBridgeWebSocket> &Sock,
+                     const TArray<uint8> &Utf8Payload) {
+            if (TSharedPtr<FMcpConnectionManager> StrongSelf = WeakSelf.Pin()) {
+              StrongSelf->HandleInboundText(Sock, Utf8Payload);
+            }
+          });
+      ServerSocket->SetInboundBinaryHandler(
+          [WeakSelf](const TSharedPtr<FMcpBridgeWebSocket> &Sock,
+                     const TArray<uint8> &Payload) {
+            if (TSharedPtr<FMcpConnectionManager> StrongSelf = WeakSelf.Pin()) {
+              StrongSelf->HandleInboundBinary(Sock, Payload);
+            }
+          });
+      if (bEnableMetricsEndpoint) {
+        ServerSocket->SetHttpGetHandler(
+            [WeakSelf](const FString &Path,
+                       const TMap<FString, FString> &Headers,
+                       int32 &OutStatusCode, FString &OutContentType,
+                       FString &OutBody) {
+              TSharedPtr<FMcpConnectionManager> StrongSelf = WeakSelf.Pin();
+              return StrongSelf.IsValid() &&
+                     StrongSelf->HandleMetricsHttpRequest(
+                         Path, Headers, OutStatusCode, OutContentType,
+                         OutBody);
+            });
+      }
 
       ServerSocket->OnConnected().AddLambda(
           [WeakSelf](TSharedPtr<FMcpBridgeWebSocket> Sock) {
@@ -312,6 +549,11 @@ void FMcpConnectionManager::AttemptConnection() {
                                           TlsCertificatePath,
                                           TlsPrivateKeyPath);
       ClientSocket->InitializeWeakSelf(ClientSocket);
+      ClientSocket->SetPerMessageDeflate(bEnablePerMessageDeflate,
+                                         bPerMessageDeflateContextTakeover,
+                                         PerMessageDeflateThresholdBytes);
+      ClientSocket->SetOutboundWatermarks(OutboundQueueHighWatermarkBytes,
+                                          OutboundQueueLowWatermarkBytes);
 
       TWeakPtr<FMcpConnectionManager> WeakSelf = AsShared();
 
@@ -327,11 +569,18 @@ void FMcpConnectionManager::AttemptConnection() {
               StrongSelf->HandleConnectionError(ClientSocket, Err);
             }
           });
-      ClientSocket->OnMessage().AddLambda(
-          [WeakSelf](TSharedPtr<FMcpBridgeWebSocket> Sock,
-                     const FString &Message) {
+      ClientSocket->SetInboundTextHandler(
+          [WeakSelf](const TSharedPtr<FMcpBridgeWebSocket> &Sock,
+                     const TArray<uint8> &Utf8Payload) {
+            if (TSharedPtr<FMcpConnectionManager> StrongSelf = WeakSelf.Pin()) {
+              StrongSelf->HandleInboundText(Sock, Utf8Payload);
+            }
+          });
+      ClientSocket->SetInboundBinaryHandler(
+          [WeakSelf](const TSharedPtr<FMcpBridgeWebSocket> &Sock,
+                     const TArray<uint8> &Payload) {
             if (TSharedPtr<FMcpConnectionManager> StrongSelf = WeakSelf.Pin()) {
-              StrongSelf->HandleMessage(Sock, Message);
+              StrongSelf->HandleInboundBinary(Sock, Payload);
             }
           });
 
@@ -341,6 +590,16 @@ void FMcpConnectionManager::AttemptConnection() {
   }
 }
 
+void FMcpConnectionManager::StopIoReactor() {
+  // Closed sockets are torn down by their reactor thread, so stop it only
+  // after every socket has been closed. Stop() joins the threads and releases
+  // whatever connections they still held.
+  if (IoReactor.IsValid()) {
+    IoReactor->Stop();
+    IoReactor.Reset();
+  }
+}
+
 void FMcpConnectionManager::ForceReconnect(const FString &Reason,
                                            float ReconnectDelayOverride) {
   UE_LOG(LogMcpAutomationBridgeSubsystem, Warning, TEXT("ForceReconnect: %s"),
@@ -352,13 +611,12 @@ void FMcpConnectionManager::ForceReconnect(const FString &Reason,
     }
   }
   ActiveSockets.Empty();
-  {
-    FScopeLock Lock(&RateLimitMutex);
-    SocketRateLimits.Empty();
-  }
+  StopIoReactor();
   {
     FScopeLock Lock(&PendingRequestsMutex);
     PendingRequestsToSockets.Empty();
+    StagedAttachments.Empty();
+    CancelledRequestIds.Empty();
   }
 
   bBridgeAvailable = false;
@@ -392,6 +650,9 @@ void FMcpConnectionManager::HandleClientConnected(
   if (!ClientSocket.IsValid())
     return;
   AuthenticatedSockets.Remove(ClientSocket.Get());
+  BinaryAttachmentSockets.Remove(ClientSocket.Get());
+  MessagePackSockets.Remove(ClientSocket.Get());
+  SocketTopics.Remove(ClientSocket.Get());
   UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
          TEXT("Client socket connected (port=%d)"), ClientSocket->GetPort());
 
@@ -402,12 +663,6 @@ void FMcpConnectionManager::HandleClientConnected(
 
   TWeakPtr<FMcpConnectionManager> WeakSelf = AsShared();
 
-  ClientSocket->OnMessage().AddLambda(
-      [WeakSelf](TSharedPtr<FMcpBridgeWebSocket> Sock, const FString &Msg) {
-        if (TSharedPtr<FMcpConnectionManager> StrongSelf = WeakSelf.Pin())
-          StrongSelf->HandleMessage(Sock, Msg);
-      });
-
   ClientSocket->OnClosed().AddLambda(
       [WeakSelf](TSharedPtr<FMcpBridgeWebSocket> Sock, int32 Code,
                  const FString &Reason, bool bClean) {
@@ -447,10 +702,9 @@ void FMcpConnectionManager::HandleConnectionError(
 
   if (Socket.IsValid()) {
     AuthenticatedSockets.Remove(Socket.Get());
-    {
-      FScopeLock Lock(&RateLimitMutex);
-      SocketRateLimits.Remove(Socket.Get());
-    }
+    BinaryAttachmentSockets.Remove(Socket.Get());
+    MessagePackSockets.Remove(Socket.Get());
+    SocketTopics.Remove(Socket.Get());
     Socket->OnMessage().RemoveAll(this);
     Socket->OnClosed().RemoveAll(this);
     Socket->OnConnectionError().RemoveAll(this);
@@ -484,10 +738,9 @@ void FMcpConnectionManager::HandleClosed(TSharedPtr<FMcpBridgeWebSocket> Socket,
          StatusCode, *Reason, bWasClean ? TEXT("true") : TEXT("false"));
   if (Socket.IsValid()) {
     AuthenticatedSockets.Remove(Socket.Get());
-    {
-      FScopeLock Lock(&RateLimitMutex);
-      SocketRateLimits.Remove(Socket.Get());
-    }
+    BinaryAttachmentSockets.Remove(Socket.Get());
+    MessagePackSockets.Remove(Socket.Get());
+    SocketTopics.Remove(Socket.Get());
     ActiveSockets.Remove(Socket);
   }
   if (ActiveSockets.Num() == 0 && bReconnectEnabled) {
@@ -505,29 +758,25 @@ void FMcpConnectionManager::HandleHeartbeat(
   }
 }
 
-void FMcpConnectionManager::HandleMessage(
-    TSharedPtr<FMcpBridgeWebSocket> Socket, const FString &Message) {
+void FMcpConnectionManager::HandleInboundText(
+    const TSharedPtr<FMcpBridgeWebSocket> &Socket,
+    const TArray<uint8> &Utf8Payload) {
+  // Runs on the socket's I/O thread. Decode, parse, validation and rate
+  // limiting happen here so large payloads do not eat into the game thread's
+  // frame budget; only state owned by the game thread (handshake, request
+  // routing) is left to HandleInboundMessage.
   if (!Socket.IsValid())
     return;
-  FMcpBridgeWebSocket *SocketPtr = Socket.Get();
-  FString RateLimitReason;
-  if (!UpdateRateLimit(SocketPtr, true, false, RateLimitReason)) {
-    UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
-           TEXT("Rate limit exceeded for incoming messages: %s"),
-           *RateLimitReason);
-    TSharedRef<FJsonObject> Err = MakeShared<FJsonObject>();
-    Err->SetStringField(TEXT("type"), TEXT("bridge_error"));
-    Err->SetStringField(TEXT("error"), TEXT("RATE_LIMIT_EXCEEDED"));
-    Err->SetStringField(TEXT("message"), RateLimitReason);
-    FString Serialized;
-    const TSharedRef<TJsonWriter<>> Writer =
-        TJsonWriterFactory<>::Create(&Serialized);
-    FJsonSerializer::Serialize(Err, Writer);
-    if (Socket.IsValid() && Socket->IsConnected()) {
-      Socket->Send(Serialized);
-      Socket->Close(4008, TEXT("Rate limit exceeded"));
-    }
+  TRACE_CPUPROFILER_EVENT_SCOPE_STR("McpBridge::ParseInbound");
+  if (!AdmitInboundMessage(Socket))
     return;
+
+  FString Message;
+  if (Utf8Payload.Num() > 0) {
+    const FUTF8ToTCHAR Converter(
+        reinterpret_cast<const ANSICHAR *>(Utf8Payload.GetData()),
+        Utf8Payload.Num());
+    Message = FString(Converter.Length(), Converter.Get());
   }
 
   TSharedPtr<FJsonObject> RootObj;
@@ -539,6 +788,73 @@ void FMcpConnectionManager::HandleMessage(
     return;
   }
 
+  RouteInboundObject(Socket, RootObj, Message);
+}
+
+void FMcpConnectionManager::HandleInboundBinary(
+    const TSharedPtr<FMcpBridgeWebSocket> &Socket,
+    const TArray<uint8> &Payload) {
+  // Runs on the socket's I/O thread, like HandleInboundText. Peers only send
+  // binary data messages after negotiating msgpack; anything else is dropped.
+  if (!Socket.IsValid())
+    return;
+  TRACE_CPUPROFILER_EVENT_SCOPE_STR("McpBridge::ParseInbound");
+  if (!AdmitInboundMessage(Socket))
+    return;
+
+  FString DecodeError;
+  const TSharedPtr<FJsonObject> RootObj =
+      bAllowMessagePackEncoding ? FMcpMessagePack::Decode(Payload, DecodeError)
+                                : nullptr;
+  if (!RootObj.IsValid()) {
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
+           TEXT("Dropped %d-byte binary message: %s"), Payload.Num(),
+           DecodeError.IsEmpty() ? TEXT("MessagePack is disabled")
+                                 : *DecodeError);
+    return;
+  }
+
+  // The handshake itself always travels as JSON text.
+  FString Type;
+  RootObj->TryGetStringField(TEXT("type"), Type);
+  if (Type.Equals(TEXT("bridge_hello"), ESearchCase::IgnoreCase)) {
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
+           TEXT("Ignoring bridge_hello sent as MessagePack."));
+    return;
+  }
+
+  RouteInboundObject(
+      Socket, RootObj,
+      FString::Printf(TEXT("<msgpack %d bytes>"), Payload.Num()));
+}
+
+bool FMcpConnectionManager::AdmitInboundMessage(
+    const TSharedPtr<FMcpBridgeWebSocket> &Socket) {
+  FString RateLimitReason;
+  if (ConsumeRateLimit(Socket.Get(), ERateLimitBucket::Message,
+                       RateLimitReason)) {
+    return true;
+  }
+  UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
+         TEXT("Rate limit exceeded for incoming messages: %s"),
+         *RateLimitReason);
+  FInboundMessage Inbound;
+  Inbound.Kind = FInboundMessage::EKind::Reject;
+  Inbound.RejectPayload =
+      SerializeBridgeError(TEXT("RATE_LIMIT_EXCEEDED"), RateLimitReason);
+  Inbound.CloseCode = 4008;
+  Inbound.CloseReason = TEXT("Rate limit exceeded");
+  PostInboundMessage(Socket, MoveTemp(Inbound));
+  return false;
+}
+
+void FMcpConnectionManager::RouteInboundObject(
+    const TSharedPtr<FMcpBridgeWebSocket> &Socket,
+    const TSharedPtr<FJsonObject> &RootObj, const FString &Message) {
+  FMcpBridgeWebSocket *SocketPtr = Socket.Get();
+  FInboundMessage Inbound;
+  FString RateLimitReason;
+
   FString Type;
   if (!RootObj->TryGetStringField(TEXT("type"), Type)) {
     UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
@@ -547,244 +863,495 @@ void FMcpConnectionManager::HandleMessage(
     return;
   }
 
-  if (Type.Equals(TEXT("automation_request"), ESearchCase::IgnoreCase)) {
-    if (!UpdateRateLimit(SocketPtr, false, true, RateLimitReason)) {
+  if (Type.Equals(TEXT("bridge_hello"), ESearchCase::IgnoreCase)) {
+    Inbound.Kind = FInboundMessage::EKind::BridgeHello;
+    Inbound.Payload = RootObj;
+    PostInboundMessage(Socket, MoveTemp(Inbound));
+    return;
+  }
+
+  if (Type.Equals(TEXT("cancel_request"), ESearchCase::IgnoreCase)) {
+    FString CancelId;
+    RootObj->TryGetStringField(TEXT("requestId"), CancelId);
+    if (CancelId.IsEmpty() || CancelId.Len() > 128) {
       UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
-             TEXT("Rate limit exceeded for automation requests: %s"),
-             *RateLimitReason);
-      TSharedRef<FJsonObject> Err = MakeShared<FJsonObject>();
-      Err->SetStringField(TEXT("type"), TEXT("bridge_error"));
-      Err->SetStringField(TEXT("error"), TEXT("RATE_LIMIT_EXCEEDED"));
-      Err->SetStringField(TEXT("message"), RateLimitReason);
-      FString Serialized;
-      const TSharedRef<TJsonWriter<>> Writer =
-          TJsonWriterFactory<>::Create(&Serialized);
-      FJsonSerializer::Serialize(Err, Writer);
-      if (Socket.IsValid() && Socket->IsConnected()) {
-        Socket->Send(Serialized);
-        Socket->Close(4008, TEXT("Rate limit exceeded"));
-      }
+             TEXT("cancel_request missing or oversized requestId."));
       return;
     }
+    // Raise the token here rather than on the game thread: a handler that is
+    // blocking the game thread is exactly the one being cancelled, and it
+    // would only see this message after it had finished.
+    {
+      FScopeLock Lock(&PendingRequestsMutex);
+      const TSharedPtr<FMcpBridgeWebSocket> *Owner =
+          PendingRequestsToSockets.Find(CancelId);
+      if (Owner && Owner->Get() == SocketPtr) {
+        CancelledRequestIds.Add(CancelId);
+      }
+    }
+    Inbound.Kind = FInboundMessage::EKind::CancelRequest;
+    Inbound.RequestId = MoveTemp(CancelId);
+    PostInboundMessage(Socket, MoveTemp(Inbound));
+    return;
+  }
 
-    FString RequestId;
-    FString Action;
-    RootObj->TryGetStringField(TEXT("requestId"), RequestId);
-    RootObj->TryGetStringField(TEXT("action"), Action);
-    TSharedPtr<FJsonObject> Payload = nullptr;
-    const TSharedPtr<FJsonValue> *PayloadVal =
-        RootObj->Values.Find(TEXT("payload"));
-    if (PayloadVal && (*PayloadVal)->Type == EJson::Object) {
-      Payload = (*PayloadVal)->AsObject();
-    } else if (PayloadVal) {
-      UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
-             TEXT("automation_request payload must be a JSON object."));
-      return;
+  if (!Type.Equals(TEXT("automation_request"), ESearchCase::IgnoreCase))
+    return;
+
+  FString RequestId;
+  FString Action;
+  RootObj->TryGetStringField(TEXT("requestId"), RequestId);
+  RootObj->TryGetStringField(TEXT("action"), Action);
+  TSharedPtr<FJsonObject> Payload = nullptr;
+  const TSharedPtr<FJsonValue> *PayloadVal =
+      RootObj->Values.Find(TEXT("payload"));
+  if (PayloadVal && (*PayloadVal)->Type == EJson::Object) {
+    Payload = (*PayloadVal)->AsObject();
+  } else if (PayloadVal) {
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
+           TEXT("automation_request payload must be a JSON object."));
+    return;
+  }
+
+  if (RequestId.IsEmpty() || Action.IsEmpty()) {
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
+           TEXT("automation_request missing requestId or action: %s"),
+           *SanitizeForLogConnMgr(Message));
+    return;
+  }
+
+  if (RequestId.Len() > 128 || Action.Len() > 128) {
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
+           TEXT("automation_request fields exceed expected size."));
+    return;
+  }
+
+  if (!ConsumeRateLimit(SocketPtr, ClassifyRateLimitBucket(Action, Payload),
+                        RateLimitReason)) {
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
+           TEXT("Rate limit exceeded for automation requests: %s"),
+           *RateLimitReason);
+    Inbound.Kind = FInboundMessage::EKind::Reject;
+    Inbound.RejectPayload = SerializeBridgeError(
+        TEXT("RATE_LIMIT_EXCEEDED"), RateLimitReason);
+    Inbound.CloseCode = 4008;
+    Inbound.CloseReason = TEXT("Rate limit exceeded");
+    PostInboundMessage(Socket, MoveTemp(Inbound));
+    return;
+  }
+
+  // Skip logging for console_command - Unreal already logs the command
+  const bool bSkipLogging = Action.Equals(TEXT("console_command"), ESearchCase::IgnoreCase);
+
+  // Log incoming request: action + filtered payload (exclude type/requestId)
+  if (!bSkipLogging) {
+    FString PayloadPreview;
+    if (Payload.IsValid()) {
+      TArray<FString> Parts;
+      for (auto& Pair : Payload->Values) {
+        if (Pair.Key != TEXT("type") && Pair.Key != TEXT("requestId")) {
+          FString Val;
+          if (Pair.Value->Type == EJson::String) {
+            Val = FString::Printf(TEXT("\"%s\""), *Pair.Value->AsString().Left(50));
+          } else if (Pair.Value->Type == EJson::Boolean) {
+            Val = Pair.Value->AsBool() ? TEXT("true") : TEXT("false");
+          } else if (Pair.Value->Type == EJson::Number) {
+            Val = FString::Printf(TEXT("%g"), Pair.Value->AsNumber());
+          } else {
+            Val = TEXT("...");
+          }
+          Parts.Add(FString::Printf(TEXT("%s=%s"), *Pair.Key, *Val));
+        }
+      }
+      PayloadPreview = Parts.Num() > 0 ? FString::Join(Parts, TEXT(" ")) : TEXT("{}");
     }
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
+           TEXT("Request: %s %s"),
+           *Action,
+           *PayloadPreview.Left(200));
+  }
 
-    if (RequestId.IsEmpty() || Action.IsEmpty()) {
-      UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
-             TEXT("automation_request missing requestId or action: %s"),
-             *SanitizeForLogConnMgr(Message));
-      return;
+  Inbound.Kind = FInboundMessage::EKind::AutomationRequest;
+  Inbound.RequestId = MoveTemp(RequestId);
+  Inbound.Action = MoveTemp(Action);
+  Inbound.Payload = MoveTemp(Payload);
+  PostInboundMessage(Socket, MoveTemp(Inbound));
+}
+
+void FMcpConnectionManager::PostInboundMessage(
+    const TSharedPtr<FMcpBridgeWebSocket> &Socket, FInboundMessage &&Inbound) {
+  // Lock-free handoff; no task-graph allocation per message. Everything goes
+  // through the queue, even from the game thread, to keep arrival order.
+  FQueuedInboundMessage Queued;
+  Queued.Socket = Socket;
+  Queued.Message = MoveTemp(Inbound);
+  InboundQueue->Enqueue(MoveTemp(Queued));
+}
+
+void FMcpConnectionManager::DrainInboundMessages(double MaxSeconds) {
+  check(IsInGameThread());
+  const double StartSeconds = FPlatformTime::Seconds();
+  FQueuedInboundMessage Queued;
+  while (InboundQueue->Dequeue(Queued)) {
+    HandleInboundMessage(MoveTemp(Queued.Socket), MoveTemp(Queued.Message));
+    Queued = FQueuedInboundMessage();
+    if (MaxSeconds > 0.0 &&
+        FPlatformTime::Seconds() - StartSeconds >= MaxSeconds) {
+      break;
     }
+  }
+}
 
-    if (RequestId.Len() > 128 || Action.Len() > 128) {
-      UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
-             TEXT("automation_request fields exceed expected size."));
-      return;
+void FMcpConnectionManager::HandleInboundMessage(
+    TSharedPtr<FMcpBridgeWebSocket> Socket, FInboundMessage &&Inbound) {
+  if (!Socket.IsValid())
+    return;
+  FMcpBridgeWebSocket *SocketPtr = Socket.Get();
+
+  if (Inbound.Kind == FInboundMessage::EKind::Reject) {
+    if (Socket->IsConnected()) {
+      Socket->Send(Inbound.RejectPayload);
+      Socket->Close(Inbound.CloseCode, Inbound.CloseReason);
     }
+    return;
+  }
 
-    if (!SocketPtr || !AuthenticatedSockets.Contains(SocketPtr)) {
+  if (Inbound.Kind == FInboundMessage::EKind::AutomationRequest) {
+    if (!AuthenticatedSockets.Contains(SocketPtr)) {
       UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
              TEXT("Automation request received before bridge_hello handshake."));
-      TSharedRef<FJsonObject> Err = MakeShared<FJsonObject>();
-      Err->SetStringField(TEXT("type"), TEXT("bridge_error"));
-      Err->SetStringField(TEXT("error"), TEXT("HANDSHAKE_REQUIRED"));
-      FString Serialized;
-      const TSharedRef<TJsonWriter<>> Writer =
-          TJsonWriterFactory<>::Create(&Serialized);
-      FJsonSerializer::Serialize(Err, Writer);
-      if (Socket.IsValid() && Socket->IsConnected()) {
-        Socket->Send(Serialized);
+      if (Socket->IsConnected()) {
+        Socket->Send(SerializeBridgeError(TEXT("HANDSHAKE_REQUIRED"), FString()));
         Socket->Close(4004, TEXT("Handshake required"));
       }
       return;
     }
 
-    // Skip logging for console_command - Unreal already logs the command
-    const bool bSkipLogging = Action.Equals(TEXT("console_command"), ESearchCase::IgnoreCase);
-
-    // Log incoming request: action + filtered payload (exclude type/requestId)
-    if (!bSkipLogging) {
-      FString PayloadPreview;
-      if (Payload.IsValid()) {
-        TArray<FString> Parts;
-        for (auto& Pair : Payload->Values) {
-          if (Pair.Key != TEXT("type") && Pair.Key != TEXT("requestId")) {
-            FString Val;
-            if (Pair.Value->Type == EJson::String) {
-              Val = FString::Printf(TEXT("\"%s\""), *Pair.Value->AsString().Left(50));
-            } else if (Pair.Value->Type == EJson::Boolean) {
-              Val = Pair.Value->AsBool() ? TEXT("true") : TEXT("false");
-            } else if (Pair.Value->Type == EJson::Number) {
-              Val = FString::Printf(TEXT("%g"), Pair.Value->AsNumber());
-            } else {
-              Val = TEXT("...");
-            }
-            Parts.Add(FString::Printf(TEXT("%s=%s"), *Pair.Key, *Val));
-          }
-        }
-        PayloadPreview = Parts.Num() > 0 ? FString::Join(Parts, TEXT(" ")) : TEXT("{}");
-      }
-      UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
-             TEXT("Request: %s %s"),
-             *Action,
-             *PayloadPreview.Left(200));
+    // Retries after a reconnect must not run the work a second time
+    if (TryReplayOrJoinRequest(Socket, Inbound.RequestId)) {
+      return;
     }
 
     // Map request to socket for response routing
     {
       FScopeLock Lock(&PendingRequestsMutex);
-      PendingRequestsToSockets.Add(RequestId, Socket);
+      PendingRequestsToSockets.Add(Inbound.RequestId, Socket);
     }
 
+    // Start the clock at arrival so time spent in the scheduler lanes shows
+    // up as queue wait.
+    StartRequestTelemetry(Inbound.RequestId, Inbound.Action);
+
     // Dispatch to subsystem via callback
     if (OnMessageReceived.IsBound()) {
-      OnMessageReceived.Execute(RequestId, Action, Payload, Socket);
+      OnMessageReceived.Execute(Inbound.RequestId, Inbound.Action,
+                                Inbound.Payload, Socket);
     }
     return;
   }
 
-  if (Type.Equals(TEXT("bridge_hello"), ESearchCase::IgnoreCase)) {
-    FString ReceivedToken;
-    RootObj->TryGetStringField(TEXT("capabilityToken"), ReceivedToken);
-    if (bRequireCapabilityToken &&
-        (ReceivedToken.IsEmpty() || ReceivedToken != CapabilityToken)) {
-      UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
-             TEXT("Capability token mismatch."));
-      if (SocketPtr) {
-        AuthenticatedSockets.Remove(SocketPtr);
-      }
-      TSharedRef<FJsonObject> Err = MakeShared<FJsonObject>();
-      Err->SetStringField(TEXT("type"), TEXT("bridge_error"));
-      Err->SetStringField(TEXT("error"), TEXT("INVALID_CAPABILITY_TOKEN"));
-      FString Serialized;
-      const TSharedRef<TJsonWriter<>> Writer =
-          TJsonWriterFactory<>::Create(&Serialized);
-      FJsonSerializer::Serialize(Err, Writer);
-      if (Socket.IsValid() && Socket->IsConnected()) {
-        Socket->Send(Serialized);
-        Socket->Close(4005, TEXT("Invalid capability token"));
-      }
+  if (Inbound.Kind == FInboundMessage::EKind::CancelRequest) {
+    const FString &CancelId = Inbound.RequestId;
+    if (!AuthenticatedSockets.Contains(SocketPtr)) {
+      FScopeLock Lock(&PendingRequestsMutex);
+      CancelledRequestIds.Remove(CancelId);
       return;
     }
 
-    if (SocketPtr) {
-      AuthenticatedSockets.Add(SocketPtr);
+    // A queued request is removed and answered with CANCELLED right away;
+    // one that is already running keeps the token raised on the socket
+    // thread until it responds.
+    const bool bDropped =
+        OnCancelRequested.IsBound() && OnCancelRequested.Execute(CancelId);
+    bool bSignalled = false;
+    if (!bDropped) {
+      FScopeLock Lock(&PendingRequestsMutex);
+      bSignalled = CancelledRequestIds.Contains(CancelId);
+    }
+    const TCHAR *State = bDropped     ? TEXT("dropped")
+                         : bSignalled ? TEXT("signalled")
+                         : ReplayCache.Contains(CancelId)
+                             ? TEXT("completed")
+                             : TEXT("not_found");
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
+           TEXT("cancel_request for RequestId=%s: %s"), *CancelId, State);
+
+    TSharedRef<FJsonObject> Reply = MakeShared<FJsonObject>();
+    Reply->SetStringField(TEXT("type"), TEXT("cancel_response"));
+    Reply->SetStringField(TEXT("requestId"), CancelId);
+    Reply->SetBoolField(TEXT("cancelled"), bDropped);
+    Reply->SetBoolField(TEXT("signalled"), bSignalled);
+    Reply->SetStringField(TEXT("state"), State);
+    TArray<uint8> Serialized;
+    SerializeJsonToUtf8(Reply, Serialized);
+    Socket->Send(MoveTemp(Serialized));
+    return;
+  }
+
+  const TSharedPtr<FJsonObject> &RootObj = Inbound.Payload;
+  FString ReceivedToken;
+  RootObj->TryGetStringField(TEXT("capabilityToken"), ReceivedToken);
+  if (bRequireCapabilityToken &&
+      (ReceivedToken.IsEmpty() || ReceivedToken != CapabilityToken)) {
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
+           TEXT("Capability token mismatch."));
+    AuthenticatedSockets.Remove(SocketPtr);
+    BinaryAttachmentSockets.Remove(SocketPtr);
+    MessagePackSockets.Remove(SocketPtr);
+    if (Socket->IsConnected()) {
+      Socket->Send(
+          SerializeBridgeError(TEXT("INVALID_CAPABILITY_TOKEN"), FString()));
+      Socket->Close(4005, TEXT("Invalid capability token"));
     }
+    return;
+  }
+
+  AuthenticatedSockets.Add(SocketPtr);
+  // A repeated hello renegotiates the encoding.
+  MessagePackSockets.Remove(SocketPtr);
+
+  const TArray<TSharedPtr<FJsonValue>> *ClientCaps = nullptr;
+  if (RootObj->TryGetArrayField(TEXT("capabilities"), ClientCaps) &&
+      ClientCaps) {
+    for (const TSharedPtr<FJsonValue> &Cap : *ClientCaps) {
+      if (Cap.IsValid() && Cap->Type == EJson::String &&
+          Cap->AsString().Equals(TEXT("binary_attachments"),
+                                 ESearchCase::IgnoreCase)) {
+        BinaryAttachmentSockets.Add(SocketPtr);
+      }
+      if (bAllowMessagePackEncoding && Cap.IsValid() &&
+          Cap->Type == EJson::String &&
+          Cap->AsString().Equals(TEXT("msgpack"), ESearchCase::IgnoreCase)) {
+        MessagePackSockets.Add(SocketPtr);
+      }
+    }
+  }
 
-    TSharedRef<FJsonObject> Ack = MakeShared<FJsonObject>();
-    Ack->SetStringField(TEXT("type"), TEXT("bridge_ack"));
-    Ack->SetStringField(TEXT("message"), TEXT("Automation bridge ready"));
-    Ack->SetStringField(TEXT("serverName"), !ServerName.IsEmpty()
-                                                ? ServerName
-                                                : TEXT("UnrealEditor"));
-    Ack->SetStringField(TEXT("serverVersion"), !ServerVersion.IsEmpty()
-                                                   ? ServerVersion
-                                                   : TEXT("unreal-engine"));
-
-    if (ActiveSessionId.IsEmpty())
-      ActiveSessionId = FGuid::NewGuid().ToString();
-    Ack->SetStringField(TEXT("sessionId"), ActiveSessionId);
-    Ack->SetNumberField(TEXT("protocolVersion"), 1);
-
-    TArray<TSharedPtr<FJsonValue>> SupportedOps;
-    SupportedOps.Add(MakeShared<FJsonValueString>(TEXT("automation_request")));
-    Ack->SetArrayField(TEXT("supportedOpcodes"), SupportedOps);
-
-    TArray<TSharedPtr<FJsonValue>> ExpectedOps;
-    ExpectedOps.Add(MakeShared<FJsonValueString>(TEXT("automation_response")));
-    Ack->SetArrayField(TEXT("expectedResponseOpcodes"), ExpectedOps);
-
-    TArray<TSharedPtr<FJsonValue>> Caps;
-    Caps.Add(MakeShared<FJsonValueString>(TEXT("console_commands")));
-    Caps.Add(MakeShared<FJsonValueString>(TEXT("native_plugin")));
-    Ack->SetArrayField(TEXT("capabilities"), Caps);
-
-    Ack->SetNumberField(TEXT("heartbeatIntervalMs"), 0);
-
-    FString Serialized;
-    const TSharedRef<TJsonWriter<>> Writer =
-        TJsonWriterFactory<>::Create(&Serialized);
-    FJsonSerializer::Serialize(Ack, Writer);
-    Socket->Send(Serialized);
-  }
-}
-
-bool FMcpConnectionManager::UpdateRateLimit(FMcpBridgeWebSocket* SocketPtr,
-                                           bool bIncrementMessage,
-                                           bool bIncrementAutomation,
-                                           FString& OutReason) {
-  if (!SocketPtr) {
+  TSharedRef<FJsonObject> Ack = MakeShared<FJsonObject>();
+  Ack->SetStringField(TEXT("type"), TEXT("bridge_ack"));
+  Ack->SetStringField(TEXT("message"), TEXT("Automation bridge ready"));
+  Ack->SetStringField(TEXT("serverName"), !ServerName.IsEmpty()
+                                              ? ServerName
+                                              : TEXT("UnrealEditor"));
+  Ack->SetStringField(TEXT("serverVersion"), !ServerVersion.IsEmpty()
+                                                 ? ServerVersion
+                                                 : TEXT("unreal-engine"));
+
+  if (ActiveSessionId.IsEmpty())
+    ActiveSessionId = FGuid::NewGuid().ToString();
+  Ack->SetStringField(TEXT("sessionId"), ActiveSessionId);
+  Ack->SetNumberField(TEXT("protocolVersion"), 1);
+
+  TArray<TSharedPtr<FJsonValue>> SupportedOps;
+  SupportedOps.Add(MakeShared<FJsonValueString>(TEXT("automation_request")));
+  SupportedOps.Add(MakeShared<FJsonValueString>(TEXT("cancel_request")));
+  Ack->SetArrayField(TEXT("supportedOpcodes"), SupportedOps);
+
+  TArray<TSharedPtr<FJsonValue>> ExpectedOps;
+  ExpectedOps.Add(MakeShared<FJsonValueString>(TEXT("automation_response")));
+  ExpectedOps.Add(MakeShared<FJsonValueString>(TEXT("cancel_response")));
+  Ack->SetArrayField(TEXT("expectedResponseOpcodes"), ExpectedOps);
+
+  TArray<TSharedPtr<FJsonValue>> Caps;
+  Caps.Add(MakeShared<FJsonValueString>(TEXT("console_commands")));
+  Caps.Add(MakeShared<FJsonValueString>(TEXT("native_plugin")));
+  Caps.Add(MakeShared<FJsonValueString>(TEXT("binary_attachments")));
+  if (bAllowMessagePackEncoding)
+    Caps.Add(MakeShared<FJsonValueString>(TEXT("msgpack")));
+  Ack->SetArrayField(TEXT("capabilities"), Caps);
+  // Encoding of automation_request / automation_response on this socket.
+  Ack->SetStringField(TEXT("encoding"), MessagePackSockets.Contains(SocketPtr)
+                                            ? TEXT("msgpack")
+                                            : TEXT("json"));
+
+  Ack->SetNumberField(TEXT("heartbeatIntervalMs"), 0);
+
+  FString Serialized;
+  const TSharedRef<TJsonWriter<>> Writer =
+      TJsonWriterFactory<>::Create(&Serialized);
+  FJsonSerializer::Serialize(Ack, Writer);
+  Socket->Send(Serialized);
+}
+
+bool FMcpConnectionManager::ConsumeRateLimit(FMcpBridgeWebSocket *SocketPtr,
+                                             ERateLimitBucket Bucket,
+                                             FString &OutReason) {
+  const int32 Slot = static_cast<int32>(Bucket);
+  const FMcpRateLimitPolicy &Policy = RateLimitPolicies[Slot];
+  if (!SocketPtr || !Policy.IsEnabled()) {
     return true;
   }
 
-  if (MaxMessagesPerMinute <= 0 && MaxAutomationRequestsPerMinute <= 0) {
+  const int64 NowMicros =
+      static_cast<int64>(FPlatformTime::Seconds() * 1000000.0);
+  if (SocketPtr->GetRateLimitBucket(Slot).TryConsume(Policy, NowMicros)) {
     return true;
   }
 
-  FScopeLock Lock(&RateLimitMutex);
+  ++RateLimitRejections[Slot];
+  static const TCHAR *const BucketNames[] = {TEXT("message"),
+                                             TEXT("automation request"),
+                                             TEXT("read request"),
+                                             TEXT("heavy request")};
+  OutReason = FString::Printf(TEXT("%s rate above %d per minute"),
+                              BucketNames[Slot], Policy.RatePerMinute);
+  return false;
+}
 
-  const double NowSeconds = FPlatformTime::Seconds();
-  FSocketRateState& State = SocketRateLimits.FindOrAdd(SocketPtr);
-  if (State.WindowStartSeconds <= 0.0) {
-    State.WindowStartSeconds = NowSeconds;
+FMcpConnectionManager::ERateLimitBucket
+FMcpConnectionManager::ClassifyRateLimitBucket(
+    const FString &Action, const TSharedPtr<FJsonObject> &Payload) const {
+  const bool bReadLimited =
+      RateLimitPolicies[static_cast<int32>(ERateLimitBucket::Read)].IsEnabled();
+  const bool bHeavyLimited =
+      RateLimitPolicies[static_cast<int32>(ERateLimitBucket::Heavy)]
+          .IsEnabled();
+  if (!bReadLimited && !bHeavyLimited) {
+    return ERateLimitBucket::Automation;
   }
 
-  if ((NowSeconds - State.WindowStartSeconds) >= 60.0) {
-    State.WindowStartSeconds = NowSeconds;
-    State.MessageCount = 0;
-    State.AutomationRequestCount = 0;
+  // Same keys as the scheduler's lane lookup, minus the client-chosen lane
+  // override, which must not let a build spend the read quota.
+  TArray<FString, TInlineAllocator<2>> Keys;
+  Keys.Add(Action.ToLower());
+  if (Payload.IsValid()) {
+    FString SubAction;
+    if (Payload->TryGetStringField(TEXT("subAction"), SubAction) ||
+        Payload->TryGetStringField(TEXT("action"), SubAction)) {
+      Keys.Add(SubAction.ToLower());
+    }
   }
-
-  if (bIncrementMessage) {
-    ++State.MessageCount;
+  for (const FString &Key : Keys) {
+    if (bHeavyLimited && HeavyRateLimitActions.Contains(Key)) {
+      return ERateLimitBucket::Heavy;
+    }
   }
-  if (bIncrementAutomation) {
-    ++State.AutomationRequestCount;
+  for (const FString &Key : Keys) {
+    if (bReadLimited && ReadRateLimitActions.Contains(Key)) {
+      return ERateLimitBucket::Read;
+    }
   }
+  return ERateLimitBucket::Automation;
+}
 
-  if (MaxMessagesPerMinute > 0 && State.MessageCount >= MaxMessagesPerMinute) {
-    OutReason = FString::Printf(TEXT("message rate %d/%d per minute"),
-                                State.MessageCount, MaxMessagesPerMinute);
+bool FMcpConnectionManager::SendRawMessage(const FString &Message,
+                                           bool bDiscardable) {
+  if (Message.IsEmpty())
     return false;
+  const FTCHARToUTF8 Utf8(*Message);
+  TArray<uint8> Bytes(reinterpret_cast<const uint8 *>(Utf8.Get()),
+                      Utf8.Length());
+  return Publish(TEXT("events"), MoveTemp(Bytes), bDiscardable) > 0;
+}
+
+namespace {
+// Topics a socket receives until it picks its own with subscribe_events.
+const TCHAR *const OptInEventTopics[] = {TEXT("progress"), TEXT("actors")};
+} // namespace
+
+const TArray<FString> &FMcpConnectionManager::GetEventTopics() {
+  static const TArray<FString> Topics = {TEXT("events"),   TEXT("logs"),
+                                         TEXT("telemetry"), TEXT("viewport"),
+                                         TEXT("progress"), TEXT("actors")};
+  return Topics;
+}
+
+bool FMcpConnectionManager::IsDefaultEventTopic(const FString &Topic) {
+  for (const TCHAR *OptIn : OptInEventTopics) {
+    if (Topic == OptIn) {
+      return false;
+    }
   }
+  return GetEventTopics().Contains(Topic);
+}
 
-  if (bIncrementAutomation && MaxAutomationRequestsPerMinute > 0 &&
-      State.AutomationRequestCount >= MaxAutomationRequestsPerMinute) {
-    OutReason = FString::Printf(TEXT("automation request rate %d/%d per minute"),
-                                State.AutomationRequestCount,
-                                MaxAutomationRequestsPerMinute);
-    return false;
+void FMcpConnectionManager::SetSubscribedTopics(
+    const TSharedPtr<FMcpBridgeWebSocket> &Socket, const TSet<FString> &Topics) {
+  if (Socket.IsValid()) {
+    SocketTopics.Add(Socket.Get(), Topics);
   }
+}
 
-  return true;
+TSet<FString> FMcpConnectionManager::GetSubscribedTopics(
+    const TSharedPtr<FMcpBridgeWebSocket> &Socket) const {
+  if (const TSet<FString> *Topics = SocketTopics.Find(Socket.Get())) {
+    return *Topics;
+  }
+  TSet<FString> Defaults;
+  for (const FString &Topic : GetEventTopics()) {
+    if (IsDefaultEventTopic(Topic)) {
+      Defaults.Add(Topic);
+    }
+  }
+  return Defaults;
 }
 
-bool FMcpConnectionManager::SendRawMessage(const FString &Message) {
-  if (Message.IsEmpty())
-    return false;
-  bool bSent = false;
+bool FMcpConnectionManager::IsSubscribedToTopic(
+    const FMcpBridgeWebSocket *Socket, const FString &Topic) const {
+  const TSet<FString> *Topics = SocketTopics.Find(Socket);
+  return Topics ? Topics->Contains(Topic) : IsDefaultEventTopic(Topic);
+}
+
+bool FMcpConnectionManager::HasTopicSubscribers(const FString &Topic) const {
   for (const TSharedPtr<FMcpBridgeWebSocket> &Sock : ActiveSockets) {
-    if (!Sock.IsValid() || !Sock->IsConnected())
+    if (Sock.IsValid() && Sock->IsConnected() &&
+        AuthenticatedSockets.Contains(Sock.Get()) &&
+        IsSubscribedToTopic(Sock.Get(), Topic)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+int32 FMcpConnectionManager::Publish(const FString &Topic,
+                                     TArray<uint8> &&Utf8Payload,
+                                     bool bDiscardable,
+                                     const FMcpBridgeWebSocket *ExcludeSocket) {
+  if (Utf8Payload.Num() == 0)
+    return 0;
+  return PublishShared(Topic,
+                       MakeShared<TArray<uint8>, ESPMode::ThreadSafe>(
+                           MoveTemp(Utf8Payload)),
+                       bDiscardable, ExcludeSocket);
+}
+
+int32 FMcpConnectionManager::PublishShared(
+    const FString &Topic,
+    const TSharedRef<const TArray<uint8>, ESPMode::ThreadSafe> &Utf8Payload,
+    bool bDiscardable, const FMcpBridgeWebSocket *ExcludeSocket) {
+  FTopicStats &Stats = TopicTelemetry.FindOrAdd(Topic);
+  ++Stats.Published;
+  int32 Delivered = 0;
+  for (const TSharedPtr<FMcpBridgeWebSocket> &Sock : ActiveSockets) {
+    // Only peers that finished bridge_hello; an unauthenticated socket must
+    // not see another client's traffic.
+    if (!Sock.IsValid() || Sock.Get() == ExcludeSocket ||
+        !Sock->IsConnected() || !AuthenticatedSockets.Contains(Sock.Get()) ||
+        !IsSubscribedToTopic(Sock.Get(), Topic))
+      continue;
+    if ((bDiscardable && Sock->IsOutboundBackpressured()) ||
+        !Sock->SendShared(Utf8Payload)) {
+      ++Stats.Dropped;
+      if (bDiscardable)
+        ++DroppedDiscardableMessages;
       continue;
-    if (Sock->Send(Message)) {
-      bSent = true;
-      break;
     }
+    ++Delivered;
+  }
+  Stats.Delivered += Delivered;
+  return Delivered;
+}
+
+bool FMcpConnectionManager::SendDiscardableTo(
+    const TSharedPtr<FMcpBridgeWebSocket> &Socket, TArray<uint8> &&Utf8Payload) {
+  if (!Socket.IsValid() || !Socket->IsConnected() || Utf8Payload.Num() == 0)
+    return false;
+  if (Socket->IsOutboundBackpressured() ||
+      !Socket->Send(MoveTemp(Utf8Payload))) {
+    ++DroppedDiscardableMessages;
+    return false;
   }
-  return bSent;
+  return true;
 }
 
 void FMcpConnectionManager::SendControlMessage(
@@ -802,6 +1369,8 @@ void FMcpConnectionManager::SendAutomationResponse(
     TSharedPtr<FMcpBridgeWebSocket> TargetSocket, const FString &RequestId,
     bool bSuccess, const FString &Message,
     const TSharedPtr<FJsonObject> &Result, const FString &ErrorCode) {
+  TRACE_CPUPROFILER_EVENT_SCOPE_STR("McpBridge::SendResponse");
+  const double ResponseStartSeconds = FPlatformTime::Seconds();
   TSharedRef<FJsonObject> Response = MakeShared<FJsonObject>();
   Response->SetStringField(TEXT("type"), TEXT("automation_response"));
   Response->SetStringField(TEXT("requestId"), RequestId);
@@ -813,10 +1382,203 @@ void FMcpConnectionManager::SendAutomationResponse(
   if (Result.IsValid())
     Response->SetObjectField(TEXT("result"), Result.ToSharedRef());
 
-  FString Serialized;
-  const TSharedRef<TJsonWriter<>> Writer =
-      TJsonWriterFactory<>::Create(&Serialized);
-  FJsonSerializer::Serialize(Response, Writer);
+  TArray<FMcpAutomationAttachment> Attachments;
+  {
+    FScopeLock Lock(&PendingRequestsMutex);
+    StagedAttachments.RemoveAndCopyValue(RequestId, Attachments);
+  }
+
+  // Peers that negotiated binary_attachments get descriptors plus binary
+  // frames; the base64 form for everyone else is only built if a peer that
+  // needs it is chosen, and never touches the caller's Result.
+  TArray<uint8> Serialized;
+  if (Attachments.Num() > 0) {
+    TArray<TSharedPtr<FJsonValue>> Descriptors;
+    for (const FMcpAutomationAttachment &Attachment : Attachments) {
+      TSharedPtr<FJsonObject> Descriptor = MakeShared<FJsonObject>();
+      Descriptor->SetStringField(TEXT("id"), Attachment.Id);
+      Descriptor->SetNumberField(TEXT("size"), Attachment.Data.Num());
+      if (!Attachment.MimeType.IsEmpty())
+        Descriptor->SetStringField(TEXT("mimeType"), Attachment.MimeType);
+      if (!Attachment.ResultField.IsEmpty())
+        Descriptor->SetStringField(TEXT("field"), Attachment.ResultField);
+      Descriptors.Add(MakeShared<FJsonValueObject>(Descriptor));
+    }
+    Response->SetArrayField(TEXT("attachments"), Descriptors);
+    SerializeJsonToUtf8(Response, Serialized);
+    Response->RemoveField(TEXT("attachments"));
+  } else {
+    SerializeJsonToUtf8(Response, Serialized);
+  }
+  // Responses with attachments stay JSON so the descriptor and inline
+  // fallbacks keep a single format.
+  TArray<uint8> SerializedMessagePack;
+  if (MessagePackSockets.Num() > 0 && Attachments.Num() == 0) {
+    FMcpMessagePack::Encode(Response, SerializedMessagePack);
+  }
+  const double SerializationSeconds =
+      FPlatformTime::Seconds() - ResponseStartSeconds;
+
+  DeliverAutomationResponse(
+      TargetSocket, RequestId, bSuccess, Message, ErrorCode,
+      MoveTemp(Serialized), MoveTemp(SerializedMessagePack), Attachments,
+      [&](TArray<uint8> &OutInline) {
+        // Shallow copy: the caller's object keeps its fields unchanged.
+        TSharedRef<FJsonObject> InlineResult = MakeShared<FJsonObject>();
+        if (Result.IsValid()) {
+          InlineResult->Values = Result->Values;
+        }
+        for (const FMcpAutomationAttachment &Attachment : Attachments) {
+          if (!Attachment.ResultField.IsEmpty()) {
+            InlineResult->SetStringField(Attachment.ResultField,
+                                         FBase64::Encode(Attachment.Data));
+          }
+        }
+        Response->SetObjectField(TEXT("result"), InlineResult);
+        SerializeJsonToUtf8(Response, OutInline);
+      },
+      ResponseStartSeconds, SerializationSeconds,
+      [&Result]() { return BuildResultPreview(Result); },
+      [&Result]() { return Result; });
+}
+
+void FMcpConnectionManager::SendAutomationResponse(
+    TSharedPtr<FMcpBridgeWebSocket> TargetSocket, const FString &RequestId,
+    bool bSuccess, const FString &Message, const FMcpJsonUtf8Writer &Result,
+    const FString &ErrorCode) {
+  TRACE_CPUPROFILER_EVENT_SCOPE_STR("McpBridge::SendResponse");
+  const double ResponseStartSeconds = FPlatformTime::Seconds();
+  if (!Result.IsCompleteObject()) {
+    SendAutomationResponse(
+        TargetSocket, RequestId, false,
+        TEXT("Handler produced an incomplete streamed result."), nullptr,
+        TEXT("INTERNAL_ERROR"));
+    return;
+  }
+
+  TArray<FMcpAutomationAttachment> Attachments;
+  {
+    FScopeLock Lock(&PendingRequestsMutex);
+    StagedAttachments.RemoveAndCopyValue(RequestId, Attachments);
+  }
+
+  // Same envelope and field order as the DOM path; the result bytes are
+  // copied in once instead of being re-serialized.
+  auto WriteEnvelope = [&](FMcpJsonUtf8Writer &Envelope, bool bDescriptors,
+                           bool bInlineAttachments) {
+    Envelope.BeginObject();
+    Envelope.WriteString(TEXT("type"), TEXT("automation_response"));
+    Envelope.WriteString(TEXT("requestId"), RequestId);
+    Envelope.WriteBool(TEXT("success"), bSuccess);
+    if (!Message.IsEmpty())
+      Envelope.WriteString(TEXT("message"), Message);
+    Envelope.WriteString(TEXT("error"), ErrorCode);
+    if (bDescriptors) {
+      Envelope.Key(TEXT("attachments"));
+      Envelope.BeginArray();
+      for (const FMcpAutomationAttachment &Attachment : Attachments) {
+        Envelope.BeginObject();
+        Envelope.WriteString(TEXT("id"), Attachment.Id);
+        Envelope.WriteInt(TEXT("size"), Attachment.Data.Num());
+        if (!Attachment.MimeType.IsEmpty())
+          Envelope.WriteString(TEXT("mimeType"), Attachment.MimeType);
+        if (!Attachment.ResultField.IsEmpty())
+          Envelope.WriteString(TEXT("field"), Attachment.ResultField);
+        Envelope.EndObject();
+      }
+      Envelope.EndArray();
+    }
+    Envelope.Key(TEXT("result"));
+    if (bInlineAttachments) {
+      Envelope.ReopenObject(Result.GetBuffer());
+      for (const FMcpAutomationAttachment &Attachment : Attachments) {
+        if (!Attachment.ResultField.IsEmpty()) {
+          Envelope.WriteString(Attachment.ResultField,
+                               FBase64::Encode(Attachment.Data));
+        }
+      }
+      Envelope.EndObject();
+    } else {
+      Envelope.RawValue(Result.GetBuffer());
+    }
+    Envelope.EndObject();
+  };
+
+  // The socket keeps what it is handed, so the envelope is copied out of the
+  // pooled writer at its final size. With attachments this is the descriptor
+  // form; the base64 form is only written for a peer that needs it.
+  TArray<uint8> Serialized;
+  {
+    FMcpJsonUtf8Writer Envelope;
+    WriteEnvelope(Envelope, Attachments.Num() > 0, false);
+    Serialized = Envelope.GetBuffer();
+  }
+  const double SerializationSeconds =
+      FPlatformTime::Seconds() - ResponseStartSeconds;
+
+  // Already UTF-8 JSON; msgpack peers accept text frames too, so streamed
+  // results are not transcoded.
+  DeliverAutomationResponse(
+      TargetSocket, RequestId, bSuccess, Message, ErrorCode,
+      MoveTemp(Serialized), TArray<uint8>(), Attachments,
+      [&](TArray<uint8> &OutInline) {
+        FMcpJsonUtf8Writer Envelope;
+        WriteEnvelope(Envelope, false, true);
+        OutInline = Envelope.GetBuffer();
+      },
+      ResponseStartSeconds, SerializationSeconds,
+      [&Result]() {
+        return FString::Printf(TEXT(" (streamed %d bytes)"), Result.Num());
+      },
+      [&Result]() { return Result.ParseAsJsonObject(); });
+}
+
+void FMcpConnectionManager::DeliverAutomationResponse(
+    TSharedPtr<FMcpBridgeWebSocket> TargetSocket, const FString &RequestId,
+    bool bSuccess, const FString &Message, const FString &ErrorCode,
+    TArray<uint8> &&Serialized, TArray<uint8> &&SerializedMessagePack,
+    const TArray<FMcpAutomationAttachment> &Attachments,
+    TFunctionRef<void(TArray<uint8> &)> SerializeInlineAttachments,
+    double ResponseStartSeconds, double SerializationSeconds,
+    TFunctionRef<FString()> GetResultPreview,
+    TFunctionRef<TSharedPtr<FJsonObject>()> GetFallbackPayload) {
+  // With attachments, Serialized carries descriptors for peers that take
+  // binary frames; the base64-inlined form is built once, on first need.
+  TArray<uint8> InlineSerialized;
+  bool bInlineSerialized = false;
+  auto GetInlineSerialized = [&]() -> TArray<uint8> & {
+    if (!bInlineSerialized) {
+      SerializeInlineAttachments(InlineSerialized);
+      bInlineSerialized = true;
+    }
+    return InlineSerialized;
+  };
+
+  // Keep a replayable copy for requests that came off the wire, and collect
+  // the sockets that retried while this one was running. Replays are plain
+  // JSON, so a response with attachments caches its inline form, built only
+  // when the cache could hold it or a joined socket is waiting for it.
+  TSharedPtr<TArray<uint8>, ESPMode::ThreadSafe> ReplayCopy;
+  TArray<TSharedPtr<FMcpBridgeWebSocket>> JoinedSockets;
+  FInFlightRequest InFlight;
+  if (InFlightRequests.RemoveAndCopyValue(RequestId, InFlight)) {
+    JoinedSockets = MoveTemp(InFlight.JoinedSockets);
+    if (Attachments.Num() == 0) {
+      ReplayCopy = MakeShared<TArray<uint8>, ESPMode::ThreadSafe>(Serialized);
+    } else {
+      int64 InlineBytes = Serialized.Num();
+      for (const FMcpAutomationAttachment &Attachment : Attachments) {
+        InlineBytes += 4 * ((static_cast<int64>(Attachment.Data.Num()) + 2) / 3);
+      }
+      const bool bCacheable =
+          ReplayCacheMaxEntries > 0 && InlineBytes <= ReplayCacheMaxBytes;
+      if (bCacheable || JoinedSockets.Num() > 0) {
+        ReplayCopy = MakeShared<TArray<uint8>, ESPMode::ThreadSafe>(
+            GetInlineSerialized());
+      }
+    }
+    RememberCompletedResponse(RequestId, ReplayCopy);
+  }
 
   // Get action from telemetry for better logging context
   FString ActionName = TEXT("unknown");
@@ -829,37 +1591,16 @@ void FMcpConnectionManager::SendAutomationResponse(
 
   // Log result with actual values for verification
   if (!bSkipLogging) {
-    FString ResultPreview;
-    if (Result.IsValid() && Result->Values.Num() > 0) {
-      TArray<FString> Parts;
-      for (auto& Pair : Result->Values) {
-        FString Val;
-        if (Pair.Value->Type == EJson::String) {
-          Val = FString::Printf(TEXT("\"%s\""), *Pair.Value->AsString().Left(40));
-        } else if (Pair.Value->Type == EJson::Boolean) {
-          Val = Pair.Value->AsBool() ? TEXT("true") : TEXT("false");
-        } else if (Pair.Value->Type == EJson::Number) {
-          Val = FString::Printf(TEXT("%g"), Pair.Value->AsNumber());
-        } else if (Pair.Value->Type == EJson::Array) {
-          Val = FString::Printf(TEXT("[%d]"), Pair.Value->AsArray().Num());
-        } else if (Pair.Value->Type == EJson::Object) {
-          Val = TEXT("{...}");
-        } else {
-          Val = TEXT("?");
-        }
-        Parts.Add(FString::Printf(TEXT("%s=%s"), *Pair.Key, *Val));
-      }
-      ResultPreview = FString::Printf(TEXT(" (%s)"), *FString::Join(Parts, TEXT(" ")));
-    }
     UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
            TEXT("Response: %s %s%s%s"),
            *ActionName,
            bSuccess ? TEXT("OK") : TEXT("FAILED"),
            !Message.IsEmpty() ? *FString::Printf(TEXT(" \"%s\""), *Message.Left(80)) : TEXT(""),
-           *ResultPreview);
+           *GetResultPreview());
   }
 
-  RecordAutomationTelemetry(RequestId, bSuccess, Message, ErrorCode);
+  RecordAutomationTelemetry(RequestId, bSuccess, Message, ErrorCode,
+                            ResponseStartSeconds, SerializationSeconds);
 
   bool bSent = false;
   TArray<FString> AttemptDetails;
@@ -874,16 +1615,43 @@ void FMcpConnectionManager::SendAutomationResponse(
     }
   }
 
+  TSharedPtr<FMcpBridgeWebSocket> DeliveredTo;
+  bool bAttachmentFramesFailed = false;
+  // The socket only takes a buffer once it is queued, so a rejected attempt
+  // can still be retried on another socket.
+  auto SendTo = [&](const TSharedPtr<FMcpBridgeWebSocket> &Sock) -> bool {
+    bool bQueued = false;
+    if (Attachments.Num() > 0 && SupportsBinaryAttachments(Sock)) {
+      bQueued = Sock->Send(MoveTemp(Serialized));
+      // The descriptors are already out, so a retry elsewhere would answer
+      // twice; this counts as delivered and the loss is reported below.
+      if (bQueued && !SendAttachmentFrames(Sock, Attachments)) {
+        bAttachmentFramesFailed = true;
+      }
+    } else if (Attachments.Num() > 0) {
+      bQueued = Sock->Send(MoveTemp(GetInlineSerialized()));
+    } else if (SerializedMessagePack.Num() > 0 &&
+               MessagePackSockets.Contains(Sock.Get())) {
+      bQueued = Sock->SendBinary(MoveTemp(SerializedMessagePack));
+    } else {
+      bQueued = Sock->Send(MoveTemp(Serialized));
+    }
+    if (bQueued) {
+      DeliveredTo = Sock;
+    }
+    return bQueued;
+  };
+
   for (int Attempt = 1; Attempt <= MaxAttempts && !bSent; ++Attempt) {
     if (TargetSocket.IsValid() && TargetSocket->IsConnected()) {
-      if (TargetSocket->Send(Serialized)) {
+      if (SendTo(TargetSocket)) {
         bSent = true;
         break;
       }
     }
 
     if (!bSent && MappedSocket.IsValid() && MappedSocket->IsConnected()) {
-      if (MappedSocket->Send(Serialized)) {
+      if (SendTo(MappedSocket)) {
         bSent = true;
         break;
       }
@@ -897,7 +1665,7 @@ void FMcpConnectionManager::SendAutomationResponse(
           continue;
         if (MappedSocket == Sock)
           continue;
-        if (Sock->Send(Serialized)) {
+        if (SendTo(Sock)) {
           bSent = true;
           break;
         }
@@ -905,6 +1673,35 @@ void FMcpConnectionManager::SendAutomationResponse(
     }
   }
 
+  for (const TSharedPtr<FMcpBridgeWebSocket> &Joined : JoinedSockets) {
+    if (ReplayCopy.IsValid() && Joined.IsValid() && Joined != DeliveredTo &&
+        Joined->IsConnected()) {
+      TArray<uint8> Copy = *ReplayCopy;
+      bSent |= Joined->Send(MoveTemp(Copy));
+    }
+  }
+
+  if (bAttachmentFramesFailed) {
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
+           TEXT("automation_response for RequestId=%s was delivered but its "
+                "attachment frames were not."),
+           *RequestId);
+
+    TSharedPtr<FJsonObject> FailedEvent = MakeShared<FJsonObject>();
+    FailedEvent->SetStringField(TEXT("type"), TEXT("automation_event"));
+    FailedEvent->SetStringField(TEXT("event"), TEXT("attachments_failed"));
+    FailedEvent->SetStringField(TEXT("requestId"), RequestId);
+    TSharedPtr<FJsonObject> EventResult = MakeShared<FJsonObject>();
+    EventResult->SetBoolField(TEXT("success"), false);
+    EventResult->SetStringField(
+        TEXT("message"),
+        TEXT("The response's attachment frames could not be sent; retry the "
+             "request."));
+    EventResult->SetStringField(TEXT("error"), TEXT("ATTACHMENTS_FAILED"));
+    FailedEvent->SetObjectField(TEXT("result"), EventResult);
+    SendControlMessage(FailedEvent);
+  }
+
   if (!bSent) {
     UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
            TEXT("Failed to deliver automation_response for RequestId=%s"),
@@ -921,8 +1718,8 @@ void FMcpConnectionManager::SendAutomationResponse(
       EventResult->SetStringField(TEXT("message"), Message);
     if (!ErrorCode.IsEmpty())
       EventResult->SetStringField(TEXT("error"), ErrorCode);
-    if (Result.IsValid())
-      EventResult->SetObjectField(TEXT("payload"), Result.ToSharedRef());
+    if (const TSharedPtr<FJsonObject> Payload = GetFallbackPayload())
+      EventResult->SetObjectField(TEXT("payload"), Payload.ToSharedRef());
     FallbackEvent->SetObjectField(TEXT("result"), EventResult);
 
     SendControlMessage(FallbackEvent);
@@ -931,7 +1728,132 @@ void FMcpConnectionManager::SendAutomationResponse(
   {
     FScopeLock Lock(&PendingRequestsMutex);
     PendingRequestsToSockets.Remove(RequestId);
+    CancelledRequestIds.Remove(RequestId);
+  }
+}
+
+bool FMcpConnectionManager::TryReplayOrJoinRequest(
+    const TSharedPtr<FMcpBridgeWebSocket> &Socket, const FString &RequestId) {
+  if (ReplayCacheMaxEntries <= 0) {
+    return false;
+  }
+  const double NowSeconds = FPlatformTime::Seconds();
+
+  if (const FReplayEntry *Cached = ReplayCache.FindAndTouch(RequestId)) {
+    if (NowSeconds - Cached->CompletedSeconds <= ReplayCacheTtlSeconds) {
+      UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
+             TEXT("Replaying cached automation_response for RequestId=%s"),
+             *RequestId);
+      TArray<uint8> Copy = *Cached->Response;
+      Socket->Send(MoveTemp(Copy));
+      return true;
+    }
+    ReplayCacheBytes -= Cached->Response->Num();
+    ReplayCache.Remove(RequestId);
+  }
+
+  if (FInFlightRequest *InFlight = InFlightRequests.Find(RequestId)) {
+    if (NowSeconds - InFlight->DispatchedSeconds <= ReplayCacheTtlSeconds) {
+      UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
+             TEXT("RequestId=%s is still running; the retry joins it."),
+             *RequestId);
+      InFlight->JoinedSockets.AddUnique(Socket);
+      FScopeLock Lock(&PendingRequestsMutex);
+      PendingRequestsToSockets.Add(RequestId, Socket);
+      return true;
+    }
+    // Never answered within the TTL; let the retry run it again.
+    InFlightRequests.Remove(RequestId);
+  }
+
+  InFlightRequests.Add(RequestId).DispatchedSeconds = NowSeconds;
+  return false;
+}
+
+void FMcpConnectionManager::RememberCompletedResponse(
+    const FString &RequestId,
+    const TSharedPtr<TArray<uint8>, ESPMode::ThreadSafe> &Serialized) {
+  if (ReplayCacheMaxEntries <= 0 || !Serialized.IsValid() ||
+      Serialized->Num() > ReplayCacheMaxBytes) {
+    return;
+  }
+
+  if (const FReplayEntry *Existing = ReplayCache.Find(RequestId)) {
+    ReplayCacheBytes -= Existing->Response->Num();
+    ReplayCache.Remove(RequestId);
+  }
+  while (ReplayCache.Num() > 0 &&
+         (ReplayCache.Num() >= ReplayCache.Max() ||
+          ReplayCacheBytes + Serialized->Num() > ReplayCacheMaxBytes)) {
+    const FReplayEntry Evicted = ReplayCache.RemoveLeastRecent();
+    ReplayCacheBytes -= Evicted.Response->Num();
+  }
+
+  FReplayEntry Entry;
+  Entry.Response = Serialized;
+  Entry.CompletedSeconds = FPlatformTime::Seconds();
+  ReplayCache.Add(RequestId, Entry);
+  ReplayCacheBytes += Serialized->Num();
+}
+
+FString FMcpConnectionManager::StageAttachment(
+    const FString &RequestId, FMcpAutomationAttachment &&Attachment) {
+  FScopeLock Lock(&PendingRequestsMutex);
+  TArray<FMcpAutomationAttachment> &Staged =
+      StagedAttachments.FindOrAdd(RequestId);
+  if (Attachment.Id.IsEmpty()) {
+    Attachment.Id = FString::Printf(TEXT("%s/%d"), *RequestId, Staged.Num());
+  }
+  // The descriptor and every chunk header must carry the same id bytes; an
+  // id too long for the header's length byte gets a short generated one.
+  if (FTCHARToUTF8(*Attachment.Id).Length() > McpAttachmentMaxIdBytes) {
+    Attachment.Id = FString::Printf(
+        TEXT("%s/%d"), *FGuid::NewGuid().ToString(EGuidFormats::Digits),
+        Staged.Num());
+  }
+  const FString Id = Attachment.Id;
+  Staged.Add(MoveTemp(Attachment));
+  return Id;
+}
+
+bool FMcpConnectionManager::SupportsBinaryAttachments(
+    const TSharedPtr<FMcpBridgeWebSocket> &Socket) const {
+  return Socket.IsValid() && BinaryAttachmentSockets.Contains(Socket.Get());
+}
+
+bool FMcpConnectionManager::SendAttachmentFrames(
+    const TSharedPtr<FMcpBridgeWebSocket> &Socket,
+    const TArray<FMcpAutomationAttachment> &Attachments) {
+  for (const FMcpAutomationAttachment &Attachment : Attachments) {
+    const FTCHARToUTF8 IdUtf8(*Attachment.Id);
+    // StageAttachment() keeps ids within the header's length byte.
+    const int32 IdLength = FMath::Min(IdUtf8.Length(), McpAttachmentMaxIdBytes);
+    const int32 Total = Attachment.Data.Num();
+
+    int32 Offset = 0;
+    do {
+      const int32 ChunkBytes = FMath::Min(McpAttachmentChunkBytes, Total - Offset);
+      // Each chunk is handed to the socket's outbound queue.
+      TArray<uint8> Chunk;
+      Chunk.Reserve(4 + 2 + IdLength + 8 + ChunkBytes);
+      Chunk.Append(McpAttachmentMagic, 4);
+      Chunk.Add(McpAttachmentVersion);
+      Chunk.Add(static_cast<uint8>(IdLength));
+      Chunk.Append(reinterpret_cast<const uint8 *>(IdUtf8.Get()), IdLength);
+      AppendBigEndian32(Chunk, static_cast<uint32>(Offset));
+      AppendBigEndian32(Chunk, static_cast<uint32>(Total));
+      Chunk.Append(Attachment.Data.GetData() + Offset, ChunkBytes);
+
+      if (!Socket->SendBinary(MoveTemp(Chunk))) {
+        UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
+               TEXT("Failed to send attachment %s (%d/%d bytes delivered)."),
+               *Attachment.Id, Offset, Total);
+        return false;
+      }
+      Offset += ChunkBytes;
+    } while (Offset < Total);
   }
+  return true;
 }
 
 void FMcpConnectionManager::SendProgressUpdate(
@@ -972,8 +1894,28 @@ void FMcpConnectionManager::SendProgressUpdate(
     }
   }
   
+  const bool bObserved = HasTopicSubscribers(TEXT("progress"));
+  if (!bObserved && !(TargetSocket.IsValid() && TargetSocket->IsConnected())) {
+    return;
+  }
+  // Encoded once; the requester and any observers queue the same buffer.
+  const FTCHARToUTF8 Utf8(*Serialized);
+  const TSharedRef<TArray<uint8>, ESPMode::ThreadSafe> Bytes =
+      MakeShared<TArray<uint8>, ESPMode::ThreadSafe>(
+          reinterpret_cast<const uint8 *>(Utf8.Get()), Utf8.Length());
+  if (bObserved) {
+    PublishShared(TEXT("progress"), Bytes, true, TargetSocket.Get());
+  }
+
+  if (TargetSocket.IsValid() && TargetSocket->IsOutboundBackpressured()) {
+    // Progress updates are advisory; the queued response data already keeps
+    // the request alive once it drains.
+    ++DroppedDiscardableMessages;
+    return;
+  }
+
   if (TargetSocket.IsValid() && TargetSocket->IsConnected()) {
-    if (!TargetSocket->Send(Serialized)) {
+    if (!TargetSocket->SendShared(Bytes)) {
       UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
              TEXT("Failed to send progress update for RequestId=%s"),
              *RequestId);
@@ -988,31 +1930,387 @@ void FMcpConnectionManager::SendProgressUpdate(
 
 void FMcpConnectionManager::RecordAutomationTelemetry(
     const FString &RequestId, bool bSuccess, const FString &Message,
-    const FString &ErrorCode) {
+    const FString &ErrorCode, double ResponseStartSeconds,
+    double SerializationSeconds) {
   const double NowSeconds = FPlatformTime::Seconds();
 
   FAutomationRequestTelemetry Entry;
   if (!ActiveRequestTelemetry.RemoveAndCopyValue(RequestId, Entry)) {
     return;
   }
+  TRACE_COUNTER_SET(McpBridgeRequestsInFlight, ActiveRequestTelemetry.Num());
 
   const FString ActionKey =
       Entry.Action.IsEmpty() ? TEXT("unknown") : Entry.Action;
-  FAutomationActionStats &Stats =
-      AutomationActionTelemetry.FindOrAdd(ActionKey);
-
   const double DurationSeconds =
       FMath::Max(0.0, NowSeconds - Entry.StartTimeSeconds);
-  if (bSuccess) {
-    ++Stats.SuccessCount;
-    Stats.TotalSuccessDurationSeconds += DurationSeconds;
-  } else {
-    ++Stats.FailureCount;
-    Stats.TotalFailureDurationSeconds += DurationSeconds;
+  const double DispatchStartSeconds = Entry.DispatchStartSeconds > 0.0
+                                          ? Entry.DispatchStartSeconds
+                                          : Entry.StartTimeSeconds;
+  const double DispatchEndSeconds =
+      ResponseStartSeconds > 0.0 ? ResponseStartSeconds : NowSeconds;
+
+  auto Accumulate = [&](FAutomationActionStats &Stats) {
+    if (bSuccess) {
+      ++Stats.SuccessCount;
+      Stats.TotalSuccessDurationSeconds += DurationSeconds;
+    } else {
+      ++Stats.FailureCount;
+      Stats.TotalFailureDurationSeconds += DurationSeconds;
+    }
+
+    Stats.LastDurationSeconds = DurationSeconds;
+    Stats.LastUpdatedSeconds = NowSeconds;
+    Stats.QueueWait.Record(DispatchStartSeconds - Entry.StartTimeSeconds);
+    Stats.Dispatch.Record(DispatchEndSeconds - DispatchStartSeconds);
+    if (ResponseStartSeconds > 0.0) {
+      Stats.Serialization.Record(SerializationSeconds);
+    }
+  };
+  Accumulate(AutomationActionTelemetry.FindOrAdd(ActionKey));
+  if (bEnableMetricsEndpoint) {
+    Accumulate(LifetimeActionTelemetry.FindOrAdd(ActionKey));
+  }
+}
+
+namespace {
+TSharedPtr<FJsonObject> LatencyHistogramToJson(
+    const FMcpLatencyHistogram &Histogram) {
+  TSharedPtr<FJsonObject> Obj = MakeShared<FJsonObject>();
+  Obj->SetNumberField(TEXT("count"), static_cast<double>(Histogram.GetCount()));
+  Obj->SetNumberField(TEXT("p50Ms"), Histogram.GetPercentile(50.0) * 1000.0);
+  Obj->SetNumberField(TEXT("p90Ms"), Histogram.GetPercentile(90.0) * 1000.0);
+  Obj->SetNumberField(TEXT("p99Ms"), Histogram.GetPercentile(99.0) * 1000.0);
+  Obj->SetNumberField(TEXT("maxMs"), Histogram.GetMax() * 1000.0);
+  return Obj;
+}
+} // namespace
+
+TSharedPtr<FJsonObject>
+FMcpConnectionManager::GetMetricsSnapshot(bool bResetWindow) {
+  const double NowSeconds = FPlatformTime::Seconds();
+  TSharedPtr<FJsonObject> Actions = MakeShared<FJsonObject>();
+  for (const TPair<FString, FAutomationActionStats> &Pair :
+       AutomationActionTelemetry) {
+    const FAutomationActionStats &Stats = Pair.Value;
+    TSharedPtr<FJsonObject> ActionObj = MakeShared<FJsonObject>();
+    ActionObj->SetNumberField(TEXT("success"), Stats.SuccessCount);
+    ActionObj->SetNumberField(TEXT("failure"), Stats.FailureCount);
+    ActionObj->SetNumberField(TEXT("lastMs"),
+                              Stats.LastDurationSeconds * 1000.0);
+    ActionObj->SetObjectField(TEXT("queueWait"),
+                              LatencyHistogramToJson(Stats.QueueWait));
+    ActionObj->SetObjectField(TEXT("dispatch"),
+                              LatencyHistogramToJson(Stats.Dispatch));
+    ActionObj->SetObjectField(TEXT("serialization"),
+                              LatencyHistogramToJson(Stats.Serialization));
+    Actions->SetObjectField(Pair.Key, ActionObj);
+  }
+
+  TSharedPtr<FJsonObject> Snapshot = MakeShared<FJsonObject>();
+  Snapshot->SetNumberField(TEXT("windowSeconds"),
+                           NowSeconds - TelemetryWindowStartSeconds);
+  Snapshot->SetNumberField(TEXT("inFlight"), ActiveRequestTelemetry.Num());
+  Snapshot->SetObjectField(TEXT("actions"), Actions);
+
+  // Event fan-out since the editor started; not windowed.
+  TSharedPtr<FJsonObject> Topics = MakeShared<FJsonObject>();
+  for (const FString &Topic : GetEventTopics()) {
+    int32 Subscribers = 0;
+    for (const TSharedPtr<FMcpBridgeWebSocket> &Sock : ActiveSockets) {
+      if (Sock.IsValid() && AuthenticatedSockets.Contains(Sock.Get()) &&
+          IsSubscribedToTopic(Sock.Get(), Topic)) {
+        ++Subscribers;
+      }
+    }
+    const FTopicStats *Stats = TopicTelemetry.Find(Topic);
+    TSharedPtr<FJsonObject> TopicObj = MakeShared<FJsonObject>();
+    TopicObj->SetNumberField(TEXT("subscribers"), Subscribers);
+    TopicObj->SetNumberField(TEXT("published"), Stats ? static_cast<double>(Stats->Published) : 0.0);
+    TopicObj->SetNumberField(TEXT("delivered"), Stats ? static_cast<double>(Stats->Delivered) : 0.0);
+    TopicObj->SetNumberField(TEXT("dropped"), Stats ? static_cast<double>(Stats->Dropped) : 0.0);
+    Topics->SetObjectField(Topic, TopicObj);
+  }
+  Snapshot->SetObjectField(TEXT("topics"), Topics);
+  Snapshot->SetBoolField(TEXT("reset"), bResetWindow);
+
+  if (bResetWindow) {
+    AutomationActionTelemetry.Reset();
+    TelemetryWindowStartSeconds = NowSeconds;
+  }
+  return Snapshot;
+}
+
+void FMcpConnectionManager::RecordQueueTelemetry(const FString &Lane,
+                                                 double WaitSeconds,
+                                                 int32 QueueDepth) {
+  FQueueLaneStats &Stats = QueueLaneTelemetry.FindOrAdd(Lane);
+  ++Stats.DequeuedCount;
+  Stats.TotalWaitSeconds += FMath::Max(0.0, WaitSeconds);
+  Stats.MaxWaitSeconds = FMath::Max(Stats.MaxWaitSeconds, WaitSeconds);
+  Stats.MaxQueueDepth = FMath::Max(Stats.MaxQueueDepth, QueueDepth);
+  if (bEnableMetricsEndpoint) {
+    FQueueLaneStats &Lifetime = LifetimeQueueLaneTelemetry.FindOrAdd(Lane);
+    ++Lifetime.DequeuedCount;
+    Lifetime.TotalWaitSeconds += FMath::Max(0.0, WaitSeconds);
+    Lifetime.MaxWaitSeconds = FMath::Max(Lifetime.MaxWaitSeconds, WaitSeconds);
+    Lifetime.MaxQueueDepth = FMath::Max(Lifetime.MaxQueueDepth, QueueDepth);
+  }
+}
+
+void FMcpConnectionManager::RecordDeferralTelemetry(const FString &Reason,
+                                                    const FString &Trigger,
+                                                    int32 Requests,
+                                                    double DeferredSeconds) {
+  FDeferralStats &Stats = DeferralTelemetry.FindOrAdd(Reason);
+  ++Stats.EpisodeCount;
+  Stats.RequestCount += Requests;
+  Stats.TotalSeconds += FMath::Max(0.0, DeferredSeconds);
+  Stats.MaxSeconds = FMath::Max(Stats.MaxSeconds, DeferredSeconds);
+  ++Stats.Triggers.FindOrAdd(Trigger);
+}
+
+void FMcpConnectionManager::AddGameThreadTime(double Seconds) {
+  GameThreadSeconds += FMath::Max(0.0, Seconds);
+}
+
+namespace {
+// Histogram bucket bounds for the metrics endpoint, in seconds, with the
+// label text each one is exposed under.
+struct FOpenMetricsBound {
+  double Seconds;
+  const TCHAR *Label;
+};
+constexpr FOpenMetricsBound OpenMetricsLatencyBounds[] = {
+    {0.001, TEXT("0.001")}, {0.005, TEXT("0.005")}, {0.01, TEXT("0.01")},
+    {0.025, TEXT("0.025")}, {0.05, TEXT("0.05")},   {0.1, TEXT("0.1")},
+    {0.25, TEXT("0.25")},   {0.5, TEXT("0.5")},     {1.0, TEXT("1.0")},
+    {2.5, TEXT("2.5")},     {5.0, TEXT("5.0")},     {10.0, TEXT("10.0")},
+    {30.0, TEXT("30.0")},   {60.0, TEXT("60.0")},   {300.0, TEXT("300.0")}};
+
+FString EscapeOpenMetricsLabel(const FString &Value) {
+  return Value.Replace(TEXT("\\"), TEXT("\\\\"))
+      .Replace(TEXT("\""), TEXT("\\\""))
+      .Replace(TEXT("\n"), TEXT("\\n"));
+}
+
+void AppendOpenMetricsFamily(FString &Out, const TCHAR *Name,
+                             const TCHAR *Type, const TCHAR *Help,
+                             const TCHAR *Unit = nullptr) {
+  Out += FString::Printf(TEXT("# TYPE %s %s\n"), Name, Type);
+  if (Unit) {
+    Out += FString::Printf(TEXT("# UNIT %s %s\n"), Name, Unit);
   }
+  Out += FString::Printf(TEXT("# HELP %s %s\n"), Name, Help);
+}
 
-  Stats.LastDurationSeconds = DurationSeconds;
-  Stats.LastUpdatedSeconds = NowSeconds;
+void AppendOpenMetricsHistogram(FString &Out, const TCHAR *Name,
+                                const FString &Labels,
+                                const FMcpLatencyHistogram &Histogram) {
+  for (const FOpenMetricsBound &Bound : OpenMetricsLatencyBounds) {
+    Out += FString::Printf(TEXT("%s_bucket{%s,le=\"%s\"} %llu\n"), Name,
+                           *Labels, Bound.Label,
+                           Histogram.GetCountAtOrBelow(Bound.Seconds));
+  }
+  Out += FString::Printf(TEXT("%s_bucket{%s,le=\"+Inf\"} %llu\n"), Name,
+                         *Labels, Histogram.GetCount());
+  Out += FString::Printf(TEXT("%s_count{%s} %llu\n"), Name, *Labels,
+                         Histogram.GetCount());
+  Out += FString::Printf(TEXT("%s_sum{%s} %.6f\n"), Name, *Labels,
+                         Histogram.GetSum());
+}
+} // namespace
+
+FString FMcpConnectionManager::BuildOpenMetricsText() {
+  TArray<FString> ActionKeys;
+  LifetimeActionTelemetry.GetKeys(ActionKeys);
+  ActionKeys.Sort();
+
+  FString Out;
+  Out.Reserve(4096 + ActionKeys.Num() * 4096);
+
+  AppendOpenMetricsFamily(Out, TEXT("mcp_bridge_requests"), TEXT("counter"),
+                          TEXT("Automation requests answered, by action and "
+                               "outcome."));
+  for (const FString &Action : ActionKeys) {
+    const FAutomationActionStats &Stats = LifetimeActionTelemetry[Action];
+    const FString Label = EscapeOpenMetricsLabel(Action);
+    Out += FString::Printf(
+        TEXT("mcp_bridge_requests_total{action=\"%s\",outcome=\"success\"} "
+             "%d\n"),
+        *Label, Stats.SuccessCount);
+    Out += FString::Printf(
+        TEXT("mcp_bridge_requests_total{action=\"%s\",outcome=\"failure\"} "
+             "%d\n"),
+        *Label, Stats.FailureCount);
+  }
+
+  struct FHistogramFamily {
+    const TCHAR *Name;
+    const TCHAR *Help;
+    FMcpLatencyHistogram FAutomationActionStats::*Member;
+  };
+  const FHistogramFamily HistogramFamilies[] = {
+      {TEXT("mcp_bridge_request_queue_wait_seconds"),
+       TEXT("Time from arrival until a handler started running."),
+       &FAutomationActionStats::QueueWait},
+      {TEXT("mcp_bridge_request_dispatch_seconds"),
+       TEXT("Time from handler start until the response was ready."),
+       &FAutomationActionStats::Dispatch},
+      {TEXT("mcp_bridge_response_serialization_seconds"),
+       TEXT("Time spent serializing and queueing the response."),
+       &FAutomationActionStats::Serialization},
+  };
+  for (const FHistogramFamily &Family : HistogramFamilies) {
+    AppendOpenMetricsFamily(Out, Family.Name, TEXT("histogram"), Family.Help,
+                            TEXT("seconds"));
+    for (const FString &Action : ActionKeys) {
+      AppendOpenMetricsHistogram(
+          Out, Family.Name,
+          FString::Printf(TEXT("action=\"%s\""),
+                          *EscapeOpenMetricsLabel(Action)),
+          LifetimeActionTelemetry[Action].*Family.Member);
+    }
+  }
+
+  AppendOpenMetricsFamily(Out, TEXT("mcp_bridge_requests_in_flight"),
+                          TEXT("gauge"),
+                          TEXT("Requests received but not answered yet."));
+  Out += FString::Printf(TEXT("mcp_bridge_requests_in_flight %d\n"),
+                         ActiveRequestTelemetry.Num());
+
+  TMap<FString, int32> QueueDepths;
+  OnQueryQueueDepths.ExecuteIfBound(QueueDepths);
+  for (const TPair<FString, FQueueLaneStats> &Pair :
+       LifetimeQueueLaneTelemetry) {
+    QueueDepths.FindOrAdd(Pair.Key);
+  }
+  TArray<FString> Lanes;
+  QueueDepths.GetKeys(Lanes);
+  Lanes.Sort();
+  AppendOpenMetricsFamily(Out, TEXT("mcp_bridge_queue_depth"), TEXT("gauge"),
+                          TEXT("Deferred requests waiting, by scheduler "
+                               "lane."));
+  for (const FString &Lane : Lanes) {
+    Out += FString::Printf(TEXT("mcp_bridge_queue_depth{lane=\"%s\"} %d\n"),
+                           *EscapeOpenMetricsLabel(Lane), QueueDepths[Lane]);
+  }
+  AppendOpenMetricsFamily(Out, TEXT("mcp_bridge_queue_dequeued"),
+                          TEXT("counter"),
+                          TEXT("Deferred requests taken off a scheduler "
+                               "lane."));
+  for (const FString &Lane : Lanes) {
+    const FQueueLaneStats *Stats = LifetimeQueueLaneTelemetry.Find(Lane);
+    Out += FString::Printf(
+        TEXT("mcp_bridge_queue_dequeued_total{lane=\"%s\"} %d\n"),
+        *EscapeOpenMetricsLabel(Lane), Stats ? Stats->DequeuedCount : 0);
+  }
+  AppendOpenMetricsFamily(Out, TEXT("mcp_bridge_queue_wait_seconds"),
+                          TEXT("counter"),
+                          TEXT("Total time deferred requests spent queued, by "
+                               "lane."),
+                          TEXT("seconds"));
+  for (const FString &Lane : Lanes) {
+    const FQueueLaneStats *Stats = LifetimeQueueLaneTelemetry.Find(Lane);
+    Out += FString::Printf(
+        TEXT("mcp_bridge_queue_wait_seconds_total{lane=\"%s\"} %.6f\n"),
+        *EscapeOpenMetricsLabel(Lane), Stats ? Stats->TotalWaitSeconds : 0.0);
+  }
+
+  AppendOpenMetricsFamily(Out, TEXT("mcp_bridge_rate_limit_rejections"),
+                          TEXT("counter"),
+                          TEXT("Messages rejected by the per-socket rate "
+                               "limits."));
+  static const TCHAR *const RateLimitLabels[] = {
+      TEXT("message"), TEXT("automation"), TEXT("read"), TEXT("heavy")};
+  for (int32 Slot = 0; Slot < static_cast<int32>(ERateLimitBucket::Count);
+       ++Slot) {
+    Out += FString::Printf(
+        TEXT("mcp_bridge_rate_limit_rejections_total{limit=\"%s\"} %lld\n"),
+        RateLimitLabels[Slot], RateLimitRejections[Slot].Load());
+  }
+
+  int32 ConnectedSockets = 0;
+  for (const TSharedPtr<FMcpBridgeWebSocket> &Sock : ActiveSockets) {
+    if (Sock.IsValid() && !Sock->IsListening() && Sock->IsConnected()) {
+      ++ConnectedSockets;
+    }
+  }
+  AppendOpenMetricsFamily(Out, TEXT("mcp_bridge_active_sockets"),
+                          TEXT("gauge"),
+                          TEXT("Connected automation clients."));
+  Out += FString::Printf(TEXT("mcp_bridge_active_sockets %d\n"),
+                         ConnectedSockets);
+  AppendOpenMetricsFamily(Out, TEXT("mcp_bridge_outbound_queued_bytes"),
+                          TEXT("gauge"),
+                          TEXT("Bytes waiting in outbound socket queues."),
+                          TEXT("bytes"));
+  Out += FString::Printf(TEXT("mcp_bridge_outbound_queued_bytes %lld\n"),
+                         GetQueuedOutboundBytes());
+  AppendOpenMetricsFamily(Out, TEXT("mcp_bridge_received_bytes"),
+                          TEXT("counter"),
+                          TEXT("Bytes read from bridge sockets."),
+                          TEXT("bytes"));
+  Out += FString::Printf(TEXT("mcp_bridge_received_bytes_total %lld\n"),
+                         FMcpBridgeWebSocket::GetTotalBytesReceived());
+  AppendOpenMetricsFamily(Out, TEXT("mcp_bridge_sent_bytes"), TEXT("counter"),
+                          TEXT("Bytes written to bridge sockets."),
+                          TEXT("bytes"));
+  Out += FString::Printf(TEXT("mcp_bridge_sent_bytes_total %lld\n"),
+                         FMcpBridgeWebSocket::GetTotalBytesSent());
+
+  AppendOpenMetricsFamily(Out, TEXT("mcp_bridge_game_thread_seconds"),
+                          TEXT("counter"),
+                          TEXT("Game-thread time spent in bridge ticks, "
+                               "message draining and handlers."),
+                          TEXT("seconds"));
+  Out += FString::Printf(TEXT("mcp_bridge_game_thread_seconds_total %.6f\n"),
+                         GameThreadSeconds);
+
+  Out += TEXT("# EOF\n");
+  return Out;
+}
+
+void FMcpConnectionManager::RefreshMetricsText(double NowSeconds) {
+  LastMetricsRefreshSeconds = NowSeconds;
+  FString Text = BuildOpenMetricsText();
+  FScopeLock Lock(&MetricsTextMutex);
+  CachedMetricsText = MoveTemp(Text);
+}
+
+bool FMcpConnectionManager::HandleMetricsHttpRequest(
+    const FString &Path, const TMap<FString, FString> &Headers,
+    int32 &OutStatusCode, FString &OutContentType, FString &OutBody) const {
+  if (!Path.Equals(MetricsEndpointPath, ESearchCase::CaseSensitive)) {
+    return false;
+  }
+
+  OutContentType = TEXT("text/plain; charset=utf-8");
+  if (bRequireCapabilityToken && !CapabilityToken.IsEmpty()) {
+    const FString *Authorization = Headers.Find(TEXT("authorization"));
+    const FString *TokenHeader = Headers.Find(TEXT("x-mcp-capability-token"));
+    const bool bAuthorized =
+        (Authorization &&
+         *Authorization == FString(TEXT("Bearer ")) + CapabilityToken) ||
+        (TokenHeader && *TokenHeader == CapabilityToken);
+    if (!bAuthorized) {
+      OutStatusCode = 401;
+      OutBody = TEXT("Capability token required.\n");
+      return true;
+    }
+  }
+
+  FScopeLock Lock(&MetricsTextMutex);
+  if (CachedMetricsText.IsEmpty()) {
+    OutStatusCode = 503;
+    OutBody = TEXT("Metrics not collected yet.\n");
+    return true;
+  }
+  OutStatusCode = 200;
+  OutContentType =
+      TEXT("application/openmetrics-text; version=1.0.0; charset=utf-8");
+  OutBody = CachedMetricsText;
+  return true;
 }
 
 void FMcpConnectionManager::EmitAutomationTelemetrySummaryIfNeeded(
@@ -1024,6 +2322,66 @@ void FMcpConnectionManager::EmitAutomationTelemetrySummaryIfNeeded(
     return;
 
   LastTelemetrySummaryLogSeconds = NowSeconds;
+
+  const int64 QueuedBytes = GetQueuedOutboundBytes();
+  if (QueuedBytes > 0 || DroppedDiscardableMessages > 0) {
+    TArray<FString> SocketLines;
+    for (const TSharedPtr<FMcpBridgeWebSocket> &Sock : ActiveSockets) {
+      if (Sock.IsValid()) {
+        SocketLines.Add(FString::Printf(
+            TEXT("port=%d queued=%lld backpressured=%s"), Sock->GetPort(),
+            Sock->GetQueuedOutboundBytes(),
+            Sock->IsOutboundBackpressured() ? TEXT("true") : TEXT("false")));
+      }
+    }
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
+           TEXT("Outbound queue summary (%lld bytes queued, %d discardable "
+                "messages dropped since last summary):\n%s"),
+           QueuedBytes, DroppedDiscardableMessages,
+           *FString::Join(SocketLines, TEXT("\n")));
+    DroppedDiscardableMessages = 0;
+  }
+
+  if (QueueLaneTelemetry.Num() > 0) {
+    TArray<FString> LaneLines;
+    for (const TPair<FString, FQueueLaneStats> &Pair : QueueLaneTelemetry) {
+      const FQueueLaneStats &Stats = Pair.Value;
+      LaneLines.Add(FString::Printf(
+          TEXT("%s dequeued=%d avgWait=%.3fs maxWait=%.3fs maxDepth=%d"),
+          *Pair.Key, Stats.DequeuedCount,
+          Stats.TotalWaitSeconds / FMath::Max(1, Stats.DequeuedCount),
+          Stats.MaxWaitSeconds, Stats.MaxQueueDepth));
+    }
+    LaneLines.Sort();
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
+           TEXT("Deferred request queue summary since last summary:\n%s"),
+           *FString::Join(LaneLines, TEXT("\n")));
+    QueueLaneTelemetry.Reset();
+  }
+
+  if (DeferralTelemetry.Num() > 0) {
+    TArray<FString> ReasonLines;
+    for (const TPair<FString, FDeferralStats> &Pair : DeferralTelemetry) {
+      const FDeferralStats &Stats = Pair.Value;
+      TArray<FString> TriggerParts;
+      for (const TPair<FString, int32> &Trigger : Stats.Triggers) {
+        TriggerParts.Add(
+            FString::Printf(TEXT("%s=%d"), *Trigger.Key, Trigger.Value));
+      }
+      TriggerParts.Sort();
+      ReasonLines.Add(FString::Printf(
+          TEXT("%s episodes=%d requests=%d avg=%.3fs max=%.3fs resumedBy[%s]"),
+          *Pair.Key, Stats.EpisodeCount, Stats.RequestCount,
+          Stats.TotalSeconds / FMath::Max(1, Stats.EpisodeCount),
+          Stats.MaxSeconds, *FString::Join(TriggerParts, TEXT(" "))));
+    }
+    ReasonLines.Sort();
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
+           TEXT("Engine-state deferral summary since last summary:\n%s"),
+           *FString::Join(ReasonLines, TEXT("\n")));
+    DeferralTelemetry.Reset();
+  }
+
   if (AutomationActionTelemetry.Num() == 0)
     return;
 
@@ -1042,11 +2400,14 @@ void FMcpConnectionManager::EmitAutomationTelemetrySummaryIfNeeded(
         Stats.FailureCount > 0
             ? (Stats.TotalFailureDurationSeconds / Stats.FailureCount)
             : 0.0;
-    Lines.Add(FString::Printf(TEXT("%s success=%d failure=%d last=%.3fs "
-                                   "avgSuccess=%.3fs avgFailure=%.3fs"),
-                              *ActionKey, Stats.SuccessCount,
-                              Stats.FailureCount, Stats.LastDurationSeconds,
-                              AvgSuccess, AvgFailure));
+    Lines.Add(FString::Printf(
+        TEXT("%s success=%d failure=%d last=%.3fs avgSuccess=%.3fs "
+             "avgFailure=%.3fs dispatch p50=%.3fs p99=%.3fs max=%.3fs "
+             "queueWait p99=%.3fs"),
+        *ActionKey, Stats.SuccessCount, Stats.FailureCount,
+        Stats.LastDurationSeconds, AvgSuccess, AvgFailure,
+        Stats.Dispatch.GetPercentile(50.0), Stats.Dispatch.GetPercentile(99.0),
+        Stats.Dispatch.GetMax(), Stats.QueueWait.GetPercentile(99.0)));
   }
   Lines.Sort();
   UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
@@ -1058,6 +2419,15 @@ int32 FMcpConnectionManager::GetActiveSocketCount() const {
   return ActiveSockets.Num();
 }
 
+int64 FMcpConnectionManager::GetQueuedOutboundBytes() const {
+  int64 Total = 0;
+  for (const TSharedPtr<FMcpBridgeWebSocket> &Sock : ActiveSockets) {
+    if (Sock.IsValid())
+      Total += Sock->GetQueuedOutboundBytes();
+  }
+  return Total;
+}
+
 void FMcpConnectionManager::RegisterRequestSocket(
     const FString &RequestId, TSharedPtr<FMcpBridgeWebSocket> Socket) {
   if (!RequestId.IsEmpty() && Socket.IsValid()) {
@@ -1076,5 +2446,17 @@ void FMcpConnectionManager::StartRequestTelemetry(const FString &RequestId,
     Entry.Action = LowerAction.IsEmpty() ? Action : LowerAction;
     Entry.StartTimeSeconds = FPlatformTime::Seconds();
     ActiveRequestTelemetry.Add(RequestId, Entry);
+    TRACE_COUNTER_SET(McpBridgeRequestsInFlight, ActiveRequestTelemetry.Num());
+  }
+}
+
+void FMcpConnectionManager::MarkRequestDispatched(const FString &RequestId) {
+  if (FAutomationRequestTelemetry *Entry =
+          ActiveRequestTelemetry.Find(RequestId)) {
+    Entry->DispatchStartSeconds = FPlatformTime::Seconds();
+    TRACE_COUNTER_SET(McpBridgeQueueWaitMs,
+                      (Entry->DispatchStartSeconds - Entry->StartTimeSeconds) *
+                          1000.0);
+    TRACE_BOOKMARK(TEXT("MCP %s [%s]"), *Entry->Action, *RequestId);
   }
 }
@@ -0,0 +1,368 @@
+#include "McpDependencyGraph.h"
+
+#include "Async/ParallelFor.h"
+#include "AssetRegistry/AssetData.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/PackageName.h"
+#include "Misc/ScopeLock.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/Package.h"
+
+namespace {
+FMcpDependencyGraph *GMcpDependencyGraph = nullptr;
+
+IAssetRegistry *GetDependencyGraphRegistry() {
+  FAssetRegistryModule *Module =
+      FModuleManager::GetModulePtr<FAssetRegistryModule>(TEXT("AssetRegistry"));
+  return Module ? &Module->Get() : nullptr;
+}
+
+bool IsInDependencyScope(FName Package, const FString &PathPrefix) {
+  if (PathPrefix.IsEmpty()) {
+    return true;
+  }
+  TStringBuilder<256> Name;
+  Package.AppendString(Name);
+  return FStringView(Name).StartsWith(PathPrefix, ESearchCase::IgnoreCase);
+}
+} // namespace
+
+void FMcpDependencyGraph::Startup() {
+  if (!GMcpDependencyGraph) {
+    GMcpDependencyGraph = new FMcpDependencyGraph();
+  }
+}
+
+void FMcpDependencyGraph::Shutdown() {
+  delete GMcpDependencyGraph;
+  GMcpDependencyGraph = nullptr;
+}
+
+FMcpDependencyGraph::~FMcpDependencyGraph() {
+  if (!bBound) {
+    return;
+  }
+  if (IAssetRegistry *Registry = GetDependencyGraphRegistry()) {
+    Registry->OnAssetAdded().Remove(AssetAddedHandle);
+    Registry->OnAssetRemoved().Remove(AssetRemovedHandle);
+    Registry->OnAssetRenamed().Remove(AssetRenamedHandle);
+    Registry->OnAssetUpdated().Remove(AssetUpdatedHandle);
+    Registry->OnInMemoryAssetCreated().Remove(InMemoryCreatedHandle);
+    Registry->OnInMemoryAssetDeleted().Remove(InMemoryDeletedHandle);
+    Registry->OnFilesLoaded().Remove(FilesLoadedHandle);
+  }
+}
+
+bool FMcpDependencyGraph::EnsureBound() {
+  FScopeLock Lock(&DirtyMutex);
+  if (bBound) {
+    return true;
+  }
+  // Changes made before the events are bound would never reach the graph.
+  if (!IsInGameThread()) {
+    return false;
+  }
+  IAssetRegistry *Registry = GetDependencyGraphRegistry();
+  if (!Registry) {
+    return false;
+  }
+  AssetAddedHandle = Registry->OnAssetAdded().AddLambda(
+      [this](const FAssetData &Data) { MarkDirty(Data.PackageName); });
+  AssetRemovedHandle = Registry->OnAssetRemoved().AddLambda(
+      [this](const FAssetData &Data) { MarkDirty(Data.PackageName); });
+  AssetRenamedHandle = Registry->OnAssetRenamed().AddLambda(
+      [this](const FAssetData &Data, const FString &OldObjectPath) {
+        MarkDirty(Data.PackageName);
+        MarkDirty(FName(*FPackageName::ObjectPathToPackageName(OldObjectPath)));
+      });
+  AssetUpdatedHandle = Registry->OnAssetUpdated().AddLambda(
+      [this](const FAssetData &Data) { MarkDirty(Data.PackageName); });
+  InMemoryCreatedHandle =
+      Registry->OnInMemoryAssetCreated().AddLambda([this](UObject *Object) {
+        if (Object) {
+          MarkDirty(Object->GetOutermost()->GetFName());
+        }
+      });
+  InMemoryDeletedHandle =
+      Registry->OnInMemoryAssetDeleted().AddLambda([this](UObject *Object) {
+        if (Object) {
+          MarkDirty(Object->GetOutermost()->GetFName());
+        }
+      });
+  FilesLoadedHandle =
+      Registry->OnFilesLoaded().AddLambda([this]() { MarkAllDirty(); });
+  bBound = true;
+  return true;
+}
+
+void FMcpDependencyGraph::MarkDirty(FName Package) {
+  FScopeLock Lock(&DirtyMutex);
+  if (bAllDirty || Package.IsNone()) {
+    return;
+  }
+  DirtyPackages.Add(Package);
+  // The initial registry scan alone raises one event per asset.
+  if (DirtyPackages.Num() > MaxIncrementalPackages) {
+    bAllDirty = true;
+    DirtyPackages.Reset();
+  }
+}
+
+void FMcpDependencyGraph::MarkAllDirty() {
+  FScopeLock Lock(&DirtyMutex);
+  bAllDirty = true;
+  DirtyPackages.Reset();
+}
+
+bool FMcpDependencyGraph::Walk(const FMcpDependencyQuery &Query,
+                               FMcpDependencyWalk &Out) {
+  Out = FMcpDependencyWalk();
+  if (!GMcpDependencyGraph || Query.Root.IsNone()) {
+    return false;
+  }
+  FMcpDependencyGraph &Graph = *GMcpDependencyGraph;
+  if (!Graph.EnsureBound()) {
+    return false;
+  }
+  {
+    FWriteScopeLock WriteLock(Graph.GraphLock);
+    if (!Graph.RefreshLocked()) {
+      return false;
+    }
+  }
+
+  FReadScopeLock ReadLock(Graph.GraphLock);
+  const bool bForward = Query.Direction == EMcpDependencyDirection::Dependencies;
+  const TArray<int32> &Offsets =
+      bForward ? Graph.ForwardOffsets : Graph.ReverseOffsets;
+  const TArray<FEdge> &Edges = bForward ? Graph.ForwardEdges : Graph.ReverseEdges;
+
+  Out.Packages.Add(Query.Root);
+  Out.Depths.Add(0);
+  const int32 *RootId = Graph.IdByPackage.Find(Query.Root);
+  if (!RootId) {
+    if (Query.bCollectEdges) {
+      Out.NeighbourOffsets.Add(0);
+      Out.NeighbourOffsets.Add(0);
+    }
+    return true;
+  }
+
+  TBitArray<> Visited(false, Graph.Packages.Num());
+  Visited[*RootId] = true;
+  TArray<int32> Queue;
+  Queue.Add(*RootId);
+  if (Query.bCollectEdges) {
+    Out.NeighbourOffsets.Add(0);
+  }
+
+  for (int32 Head = 0; Head < Queue.Num(); ++Head) {
+    const int32 Id = Queue[Head];
+    const int32 Depth = Out.Depths[Head];
+    const bool bExpand = Query.MaxDepth < 0 || Depth < Query.MaxDepth;
+    if (bExpand || Query.bCollectEdges) {
+      for (int32 EdgeIndex = Offsets[Id]; EdgeIndex < Offsets[Id + 1];
+           ++EdgeIndex) {
+        const FEdge &Edge = Edges[EdgeIndex];
+        if ((Query.Strength == EMcpDependencyStrength::Hard && !Edge.bHard) ||
+            (Query.Strength == EMcpDependencyStrength::Soft && Edge.bHard)) {
+          continue;
+        }
+        const FName Target = Graph.Packages[Edge.Target];
+        if (!IsInDependencyScope(Target, Query.PathPrefix)) {
+          continue;
+        }
+        if (Query.bCollectEdges) {
+          Out.Neighbours.Add(Target);
+        }
+        if (bExpand && !Visited[Edge.Target]) {
+          Visited[Edge.Target] = true;
+          Queue.Add(Edge.Target);
+          Out.Packages.Add(Target);
+          Out.Depths.Add(Depth + 1);
+        }
+      }
+    }
+    if (Query.bCollectEdges) {
+      Out.NeighbourOffsets.Add(Out.Neighbours.Num());
+    }
+  }
+  return true;
+}
+
+bool FMcpDependencyGraph::RefreshLocked() {
+  TSet<FName> Dirty;
+  bool bRebuild = false;
+  {
+    FScopeLock Lock(&DirtyMutex);
+    bRebuild = bAllDirty || !bBuilt;
+    if (!bRebuild && DirtyPackages.Num() == 0) {
+      return true;
+    }
+    Dirty = MoveTemp(DirtyPackages);
+    DirtyPackages.Reset();
+    bAllDirty = false;
+  }
+  if (!GetDependencyGraphRegistry()) {
+    MarkAllDirty();
+    return false;
+  }
+
+  const double StartSeconds = FPlatformTime::Seconds();
+  if (bRebuild) {
+    BuildFullLocked();
+    ++FullBuilds;
+  } else {
+    ApplyDirtyLocked(Dirty);
+    ++IncrementalUpdates;
+  }
+  LastBuildSeconds = FPlatformTime::Seconds() - StartSeconds;
+  bBuilt = true;
+  return true;
+}
+
+void FMcpDependencyGraph::BuildFullLocked() {
+  Packages.Reset();
+  IdByPackage.Reset();
+
+  // In-memory objects may only be enumerated on the game thread.
+  TArray<FAssetData> Assets;
+  GetDependencyGraphRegistry()->GetAllAssets(Assets, !IsInGameThread());
+  TArray<FName> Roots;
+  Roots.Reserve(Assets.Num());
+  for (const FAssetData &Data : Assets) {
+    if (!IdByPackage.Contains(Data.PackageName)) {
+      FindOrAddPackageLocked(Data.PackageName);
+      Roots.Add(Data.PackageName);
+    }
+  }
+  Assets.Empty();
+
+  PackLocked(QueryEdgesLocked(Roots));
+}
+
+void FMcpDependencyGraph::ApplyDirtyLocked(const TSet<FName> &Dirty) {
+  TArray<FName> Roots = Dirty.Array();
+  for (const FName &Package : Roots) {
+    FindOrAddPackageLocked(Package);
+  }
+  TArray<TArray<FEdge>> Changed = QueryEdgesLocked(Roots);
+
+  // Only forward edges are stored per package; everything else is re-packed
+  // from the current arrays.
+  TArray<TArray<FEdge>> Lists;
+  Lists.SetNum(Packages.Num());
+  const int32 PackedCount = ForwardOffsets.Num() - 1;
+  for (int32 Id = 0; Id < PackedCount; ++Id) {
+    Lists[Id].Append(ForwardEdges.GetData() + ForwardOffsets[Id],
+                     ForwardOffsets[Id + 1] - ForwardOffsets[Id]);
+  }
+  for (int32 Index = 0; Index < Roots.Num(); ++Index) {
+    Lists[IdByPackage[Roots[Index]]] = MoveTemp(Changed[Index]);
+  }
+  PackLocked(Lists);
+}
+
+int32 FMcpDependencyGraph::FindOrAddPackageLocked(FName Package) {
+  if (const int32 *Existing = IdByPackage.Find(Package)) {
+    return *Existing;
+  }
+  const int32 Id = Packages.Add(Package);
+  IdByPackage.Add(Package, Id);
+  return Id;
+}
+
+TArray<TArray<FMcpDependencyGraph::FEdge>>
+FMcpDependencyGraph::QueryEdgesLocked(const TArray<FName> &Roots) {
+  IAssetRegistry &Registry = *GetDependencyGraphRegistry();
+  TArray<TArray<FAssetDependency>> Raw;
+  Raw.SetNum(Roots.Num());
+  ParallelFor(Roots.Num(), [&Registry, &Roots, &Raw](int32 Index) {
+    Registry.GetDependencies(FAssetIdentifier(Roots[Index]), Raw[Index],
+                             UE::AssetRegistry::EDependencyCategory::Package);
+  });
+
+  // Ids are handed out afterwards, on this thread, so they stay stable for
+  // the packages already in the graph.
+  TArray<TArray<FEdge>> Lists;
+  Lists.SetNum(Roots.Num());
+  for (int32 Index = 0; Index < Roots.Num(); ++Index) {
+    const int32 SourceId = IdByPackage[Roots[Index]];
+    TArray<FEdge> &List = Lists[Index];
+    List.Reserve(Raw[Index].Num());
+    for (const FAssetDependency &Dependency : Raw[Index]) {
+      const FName Target = Dependency.AssetId.PackageName;
+      if (Target.IsNone()) {
+        continue;
+      }
+      FEdge Edge;
+      Edge.Target = FindOrAddPackageLocked(Target);
+      Edge.bHard = EnumHasAnyFlags(Dependency.Properties,
+                                   UE::AssetRegistry::EDependencyProperty::Hard);
+      if (Edge.Target != SourceId) {
+        List.Add(Edge);
+      }
+    }
+  }
+  return Lists;
+}
+
+void FMcpDependencyGraph::PackLocked(const TArray<TArray<FEdge>> &Lists) {
+  const int32 Count = Packages.Num();
+  ForwardOffsets.Reset(Count + 1);
+  ForwardEdges.Reset();
+  TArray<int32> ReverseCounts;
+  ReverseCounts.SetNumZeroed(Count);
+  ForwardOffsets.Add(0);
+  for (int32 Id = 0; Id < Count; ++Id) {
+    if (Lists.IsValidIndex(Id)) {
+      ForwardEdges.Append(Lists[Id]);
+      for (const FEdge &Edge : Lists[Id]) {
+        ++ReverseCounts[Edge.Target];
+      }
+    }
+    ForwardOffsets.Add(ForwardEdges.Num());
+  }
+
+  ReverseOffsets.Reset(Count + 1);
+  ReverseOffsets.Add(0);
+  for (int32 Id = 0; Id < Count; ++Id) {
+    ReverseOffsets.Add(ReverseOffsets[Id] + ReverseCounts[Id]);
+  }
+  ReverseEdges.SetNumUninitialized(ForwardEdges.Num());
+  TArray<int32> Cursor(ReverseOffsets.GetData(), Count);
+  for (int32 Id = 0; Id < Count; ++Id) {
+    for (int32 EdgeIndex = ForwardOffsets[Id];
+         EdgeIndex < ForwardOffsets[Id + 1]; ++EdgeIndex) {
+      const FEdge &Edge = ForwardEdges[EdgeIndex];
+      FEdge &Reverse = ReverseEdges[Cursor[Edge.Target]++];
+      Reverse.Target = Id;
+      Reverse.bHard = Edge.bHard;
+    }
+  }
+}
+
+TSharedPtr<FJsonObject> FMcpDependencyGraph::GetStats(bool bReset) {
+  TSharedPtr<FJsonObject> Stats = MakeShared<FJsonObject>();
+  if (!GMcpDependencyGraph) {
+    Stats->SetBoolField(TEXT("enabled"), false);
+    return Stats;
+  }
+  FMcpDependencyGraph &Graph = *GMcpDependencyGraph;
+  FWriteScopeLock WriteLock(Graph.GraphLock);
+  Stats->SetBoolField(TEXT("enabled"), Graph.bBound);
+  Stats->SetBoolField(TEXT("built"), Graph.bBuilt);
+  Stats->SetNumberField(TEXT("packages"), Graph.Packages.Num());
+  Stats->SetNumberField(TEXT("edges"), Graph.ForwardEdges.Num());
+  Stats->SetNumberField(TEXT("fullBuilds"),
+                        static_cast<double>(Graph.FullBuilds));
+  Stats->SetNumberField(TEXT("incrementalUpdates"),
+                        static_cast<double>(Graph.IncrementalUpdates));
+  Stats->SetNumberField(TEXT("lastBuildMs"), Graph.LastBuildSeconds * 1000.0);
+  if (bReset) {
+    Graph.FullBuilds = 0;
+    Graph.IncrementalUpdates = 0;
+  }
+  return Stats;
+}
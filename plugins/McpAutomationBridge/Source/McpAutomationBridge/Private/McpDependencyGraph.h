@@ -0,0 +1,120 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "HAL/CriticalSection.h"
+#include "Misc/ScopeRWLock.h"
+
+/** Which way a dependency walk follows the package graph. */
+enum class EMcpDependencyDirection : uint8
+{
+    Dependencies,  // packages the root uses
+    Referencers    // packages that use the root
+};
+
+/** Which package dependencies a walk may follow. */
+enum class EMcpDependencyStrength : uint8
+{
+    All,
+    Hard,
+    Soft
+};
+
+struct FMcpDependencyQuery
+{
+    FName Root;
+    EMcpDependencyDirection Direction = EMcpDependencyDirection::Dependencies;
+    EMcpDependencyStrength Strength = EMcpDependencyStrength::All;
+    /** Levels to follow from the root; negative walks the whole closure. */
+    int32 MaxDepth = 1;
+    /** Packages outside this path are neither listed nor walked through; empty for all. */
+    FString PathPrefix;
+    /** Also report the direct neighbours of every visited package, the last level included. */
+    bool bCollectEdges = false;
+};
+
+struct FMcpDependencyWalk
+{
+    /** Visited packages in breadth-first order, the root first, with their distance from it. */
+    TArray<FName> Packages;
+    TArray<int32> Depths;
+    /** With bCollectEdges, Packages[i] links to Neighbours[NeighbourOffsets[i] .. NeighbourOffsets[i + 1]). */
+    TArray<int32> NeighbourOffsets;
+    TArray<FName> Neighbours;
+};
+
+/**
+ * Package dependency graph of the whole Asset Registry in compressed sparse row form, forward and
+ * reverse, so transitive dependency and referencer queries walk flat arrays instead of asking the
+ * registry once per visited package.
+ *
+ * Built on first use with the per-package registry queries spread over worker threads. Registry
+ * events mark single packages dirty; the next walk re-queries only those and re-packs the arrays,
+ * and falls back to a full build after the initial scan or when too many packages changed at once.
+ * Thread-safe; the first walk must come from the game thread, where the registry events are bound.
+ */
+class FMcpDependencyGraph
+{
+public:
+    static void Startup();
+    static void Shutdown();
+
+    /** False while the graph cannot be used yet; callers then ask the registry directly. */
+    static bool Walk(const FMcpDependencyQuery& Query, FMcpDependencyWalk& Out);
+
+    /** Graph size and build counts for get_bridge_metrics. */
+    static TSharedPtr<FJsonObject> GetStats(bool bReset);
+
+private:
+    struct FEdge
+    {
+        int32 Target = INDEX_NONE;
+        bool bHard = false;
+    };
+
+    FMcpDependencyGraph() = default;
+    ~FMcpDependencyGraph();
+
+    bool EnsureBound();
+    void MarkDirty(FName Package);
+    void MarkAllDirty();
+
+    /** Brings the arrays up to date with the registry; caller holds the write lock. */
+    bool RefreshLocked();
+    void BuildFullLocked();
+    void ApplyDirtyLocked(const TSet<FName>& Dirty);
+    int32 FindOrAddPackageLocked(FName Package);
+    /** Asks the registry for the package dependencies of Roots, in parallel. */
+    TArray<TArray<FEdge>> QueryEdgesLocked(const TArray<FName>& Roots);
+    /** Replaces the arrays with Lists, one per package id. */
+    void PackLocked(const TArray<TArray<FEdge>>& Lists);
+
+    /** More dirty packages than this are cheaper to rebuild from scratch. */
+    static constexpr int32 MaxIncrementalPackages = 1024;
+
+    FRWLock GraphLock;
+    TArray<FName> Packages;
+    TMap<FName, int32> IdByPackage;
+    TArray<int32> ForwardOffsets;
+    TArray<FEdge> ForwardEdges;
+    TArray<int32> ReverseOffsets;
+    TArray<FEdge> ReverseEdges;
+    bool bBuilt = false;
+
+    FCriticalSection DirtyMutex;
+    TSet<FName> DirtyPackages;
+    bool bAllDirty = true;
+    bool bBound = false;
+
+    uint64 FullBuilds = 0;
+    uint64 IncrementalUpdates = 0;
+    double LastBuildSeconds = 0.0;
+
+    FDelegateHandle AssetAddedHandle;
+    FDelegateHandle AssetRemovedHandle;
+    FDelegateHandle AssetRenamedHandle;
+    FDelegateHandle AssetUpdatedHandle;
+    FDelegateHandle InMemoryCreatedHandle;
+    FDelegateHandle InMemoryDeletedHandle;
+    FDelegateHandle FilesLoadedHandle;
+};
@@ -0,0 +1,269 @@
+#include "McpJsonUtf8Writer.h"
+
+#include "Containers/StringConv.h"
+#include "Dom/JsonObject.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace {
+// Buffers kept for reuse. Anything that grew past the retain cap is freed
+// instead so one huge listing does not pin its storage for the session.
+constexpr int32 JsonWriterPoolSize = 8;
+constexpr int32 JsonWriterRetainBytes = 8 * 1024 * 1024;
+constexpr int32 JsonWriterInitialBytes = 4 * 1024;
+
+struct FJsonWriterBufferPool {
+  FCriticalSection Mutex;
+  TArray<TArray<uint8>, TInlineAllocator<JsonWriterPoolSize>> Free;
+};
+
+FJsonWriterBufferPool &GetJsonWriterBufferPool() {
+  static FJsonWriterBufferPool Pool;
+  return Pool;
+}
+
+TArray<uint8> AcquireJsonWriterBuffer() {
+  FJsonWriterBufferPool &Pool = GetJsonWriterBufferPool();
+  {
+    FScopeLock Lock(&Pool.Mutex);
+    if (Pool.Free.Num() > 0) {
+      TArray<uint8> Reused = MoveTemp(Pool.Free.Last());
+      Pool.Free.RemoveAt(Pool.Free.Num() - 1);
+      return Reused;
+    }
+  }
+  TArray<uint8> Fresh;
+  Fresh.Reserve(JsonWriterInitialBytes);
+  return Fresh;
+}
+
+void ReleaseJsonWriterBuffer(TArray<uint8> &&Buffer) {
+  if (Buffer.Max() == 0 || Buffer.Max() > JsonWriterRetainBytes) {
+    return;
+  }
+  Buffer.Reset();
+  FJsonWriterBufferPool &Pool = GetJsonWriterBufferPool();
+  FScopeLock Lock(&Pool.Mutex);
+  if (Pool.Free.Num() < JsonWriterPoolSize) {
+    Pool.Free.Add(MoveTemp(Buffer));
+  }
+}
+
+bool IsJsonHighSurrogate(uint32 Code) { return Code >= 0xD800 && Code <= 0xDBFF; }
+bool IsJsonLowSurrogate(uint32 Code) { return Code >= 0xDC00 && Code <= 0xDFFF; }
+} // namespace
+
+FMcpJsonUtf8Writer::FMcpJsonUtf8Writer() : Buffer(AcquireJsonWriterBuffer()) {}
+
+FMcpJsonUtf8Writer::~FMcpJsonUtf8Writer() {
+  ReleaseJsonWriterBuffer(MoveTemp(Buffer));
+}
+
+FMcpJsonUtf8Writer::FMcpJsonUtf8Writer(FMcpJsonUtf8Writer &&Other)
+    : Buffer(MoveTemp(Other.Buffer)), Scopes(MoveTemp(Other.Scopes)),
+      bAfterKey(Other.bAfterKey) {
+  Other.Scopes.Reset();
+  Other.bAfterKey = false;
+}
+
+FMcpJsonUtf8Writer &FMcpJsonUtf8Writer::operator=(FMcpJsonUtf8Writer &&Other) {
+  if (this != &Other) {
+    ReleaseJsonWriterBuffer(MoveTemp(Buffer));
+    Buffer = MoveTemp(Other.Buffer);
+    Scopes = MoveTemp(Other.Scopes);
+    bAfterKey = Other.bAfterKey;
+    Other.Scopes.Reset();
+    Other.bAfterKey = false;
+  }
+  return *this;
+}
+
+void FMcpJsonUtf8Writer::BeforeValue() {
+  if (bAfterKey) {
+    bAfterKey = false;
+    return;
+  }
+  if (Scopes.Num() > 0) {
+    if (Scopes.Last()) {
+      Buffer.Add(',');
+    }
+    Scopes.Last() = true;
+  }
+}
+
+void FMcpJsonUtf8Writer::OpenScope(uint8 Bracket) {
+  BeforeValue();
+  Buffer.Add(Bracket);
+  Scopes.Add(false);
+}
+
+void FMcpJsonUtf8Writer::CloseScope(uint8 Bracket) {
+  checkf(Scopes.Num() > 0 && !bAfterKey,
+         TEXT("Unbalanced JSON scope in FMcpJsonUtf8Writer"));
+  Scopes.RemoveAt(Scopes.Num() - 1);
+  Buffer.Add(Bracket);
+}
+
+void FMcpJsonUtf8Writer::Key(FStringView Name) {
+  checkf(!bAfterKey, TEXT("FMcpJsonUtf8Writer key written without a value"));
+  BeforeValue();
+  AppendEscaped(Name);
+  Buffer.Add(':');
+  bAfterKey = true;
+}
+
+void FMcpJsonUtf8Writer::String(FStringView Value) {
+  BeforeValue();
+  AppendEscaped(Value);
+}
+
+void FMcpJsonUtf8Writer::Number(double Value) {
+  BeforeValue();
+  if (!FMath::IsFinite(Value)) {
+    AppendAscii("null", 4);
+    return;
+  }
+  // Same precision FJsonSerializer uses, so integers round-trip exactly.
+  ANSICHAR Text[40];
+  const int32 Len = FCStringAnsi::Snprintf(Text, sizeof(Text), "%.17g", Value);
+  AppendAscii(Text, FMath::Clamp(Len, 0, static_cast<int32>(sizeof(Text)) - 1));
+}
+
+void FMcpJsonUtf8Writer::Int(int64 Value) {
+  BeforeValue();
+  ANSICHAR Text[24];
+  const int32 Len = FCStringAnsi::Snprintf(Text, sizeof(Text), "%lld",
+                                           static_cast<long long>(Value));
+  AppendAscii(Text, FMath::Clamp(Len, 0, static_cast<int32>(sizeof(Text)) - 1));
+}
+
+void FMcpJsonUtf8Writer::Bool(bool Value) {
+  BeforeValue();
+  if (Value) {
+    AppendAscii("true", 4);
+  } else {
+    AppendAscii("false", 5);
+  }
+}
+
+void FMcpJsonUtf8Writer::Null() {
+  BeforeValue();
+  AppendAscii("null", 4);
+}
+
+void FMcpJsonUtf8Writer::RawValue(TArrayView<const uint8> Json) {
+  BeforeValue();
+  if (Json.Num() == 0) {
+    AppendAscii("null", 4);
+    return;
+  }
+  Buffer.Append(Json.GetData(), Json.Num());
+}
+
+void FMcpJsonUtf8Writer::ReopenObject(TArrayView<const uint8> ObjectJson) {
+  BeforeValue();
+  const bool bIsObject = ObjectJson.Num() >= 2 && ObjectJson[0] == '{' &&
+                         ObjectJson.Last() == '}';
+  if (!bIsObject) {
+    Buffer.Add('{');
+    Scopes.Add(false);
+    return;
+  }
+  // Everything up to the closing brace; the object has members unless the
+  // bytes between the braces are only whitespace.
+  Buffer.Append(ObjectJson.GetData(), ObjectJson.Num() - 1);
+  bool bHasMembers = false;
+  for (int32 Index = 1; Index < ObjectJson.Num() - 1 && !bHasMembers; ++Index) {
+    const uint8 Byte = ObjectJson[Index];
+    bHasMembers = Byte != ' ' && Byte != '\t' && Byte != '\r' && Byte != '\n';
+  }
+  Scopes.Add(bHasMembers);
+}
+
+void FMcpJsonUtf8Writer::AppendEscaped(FStringView Value) {
+  static const ANSICHAR HexDigits[] = "0123456789abcdef";
+  Buffer.Reserve(Buffer.Num() + Value.Len() + 2);
+  Buffer.Add('"');
+  const int32 Len = Value.Len();
+  for (int32 Index = 0; Index < Len; ++Index) {
+    uint32 Code = static_cast<uint32>(Value[Index]);
+    if (Code < 0x80) {
+      switch (Code) {
+      case '"':
+        AppendAscii("\\\"", 2);
+        break;
+      case '\\':
+        AppendAscii("\\\\", 2);
+        break;
+      case '\n':
+        AppendAscii("\\n", 2);
+        break;
+      case '\r':
+        AppendAscii("\\r", 2);
+        break;
+      case '\t':
+        AppendAscii("\\t", 2);
+        break;
+      case '\b':
+        AppendAscii("\\b", 2);
+        break;
+      case '\f':
+        AppendAscii("\\f", 2);
+        break;
+      default:
+        if (Code < 0x20) {
+          const ANSICHAR Escape[6] = {'\\', 'u', '0', '0',
+                                      HexDigits[Code >> 4],
+                                      HexDigits[Code & 0xF]};
+          AppendAscii(Escape, 6);
+        } else {
+          Buffer.Add(static_cast<uint8>(Code));
+        }
+        break;
+      }
+      continue;
+    }
+
+    // TCHAR is UTF-16 on Windows and UTF-32 elsewhere; pair surrogates when
+    // they show up and replace strays so the output stays valid UTF-8.
+    if (IsJsonHighSurrogate(Code) && Index + 1 < Len &&
+        IsJsonLowSurrogate(static_cast<uint32>(Value[Index + 1]))) {
+      const uint32 Low = static_cast<uint32>(Value[++Index]);
+      Code = 0x10000 + ((Code - 0xD800) << 10) + (Low - 0xDC00);
+    } else if (IsJsonHighSurrogate(Code) || IsJsonLowSurrogate(Code) ||
+               Code > 0x10FFFF) {
+      Code = 0xFFFD;
+    }
+
+    if (Code < 0x800) {
+      Buffer.Add(static_cast<uint8>(0xC0 | (Code >> 6)));
+      Buffer.Add(static_cast<uint8>(0x80 | (Code & 0x3F)));
+    } else if (Code < 0x10000) {
+      Buffer.Add(static_cast<uint8>(0xE0 | (Code >> 12)));
+      Buffer.Add(static_cast<uint8>(0x80 | ((Code >> 6) & 0x3F)));
+      Buffer.Add(static_cast<uint8>(0x80 | (Code & 0x3F)));
+    } else {
+      Buffer.Add(static_cast<uint8>(0xF0 | (Code >> 18)));
+      Buffer.Add(static_cast<uint8>(0x80 | ((Code >> 12) & 0x3F)));
+      Buffer.Add(static_cast<uint8>(0x80 | ((Code >> 6) & 0x3F)));
+      Buffer.Add(static_cast<uint8>(0x80 | (Code & 0x3F)));
+    }
+  }
+  Buffer.Add('"');
+}
+
+TSharedPtr<FJsonObject> FMcpJsonUtf8Writer::ParseAsJsonObject() const {
+  if (!IsCompleteObject()) {
+    return nullptr;
+  }
+  const FUTF8ToTCHAR Converted(
+      reinterpret_cast<const ANSICHAR *>(Buffer.GetData()), Buffer.Num());
+  const FString Json(Converted.Length(), Converted.Get());
+  TSharedPtr<FJsonObject> Parsed;
+  const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Json);
+  if (!FJsonSerializer::Deserialize(Reader, Parsed)) {
+    return nullptr;
+  }
+  return Parsed;
+}
@@ -0,0 +1,336 @@
+#include "McpLightingBuild.h"
+
+#include "Containers/Ticker.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "Logging/MessageLog.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectHash.h"
+
+#if WITH_EDITOR
+#include "Editor.h"
+#include "Engine/LightMapTexture2D.h"
+#include "Engine/MapBuildDataRegistry.h"
+#include "Engine/ShadowMapTexture2D.h"
+#if __has_include("Subsystems/LevelEditorSubsystem.h")
+#include "Subsystems/LevelEditorSubsystem.h"
+#elif __has_include("LevelEditorSubsystem.h")
+#include "LevelEditorSubsystem.h"
+#endif
+#endif
+
+#if WITH_EDITOR
+namespace {
+// Heartbeat within a stage; Lightmass itself reports no progress we can read.
+constexpr double LightingProgressIntervalSeconds = 5.0;
+// A build the editor reports as not running this long after the request
+// never started (nothing to build) or ended without a delegate.
+constexpr double LightingStartGraceSeconds = 1.0;
+
+enum class ELightingBuildStage : uint8 { Exporting, Lightmass, Applying };
+
+struct FLightingBuildState {
+  TWeakObjectPtr<UWorld> World;
+  FMcpLightingBuildResult Result;
+  bool bWithReflectionCaptures = false;
+  double StartSeconds = 0.0;
+  double StageStartSeconds = 0.0;
+  double LastProgressSeconds = 0.0;
+  double TimeoutSeconds = 0.0;
+  ELightingBuildStage Stage = ELightingBuildStage::Exporting;
+  bool bSucceeded = false;
+  bool bFailed = false;
+  bool bKept = false;
+  bool bFinished = false;
+  FDelegateHandle SucceededHandle;
+  FDelegateHandle FailedHandle;
+  FDelegateHandle KeptHandle;
+  TFunction<bool(const FString &, float, double)> OnProgress;
+  TFunction<void(const FMcpLightingBuildResult &)> OnFinished;
+};
+using FLightingBuildStateRef = TSharedRef<FLightingBuildState>;
+
+TWeakPtr<FLightingBuildState> GActiveLightingBuild;
+
+const TCHAR *LightingStageName(ELightingBuildStage Stage) {
+  switch (Stage) {
+  case ELightingBuildStage::Exporting:
+    return TEXT("exporting");
+  case ELightingBuildStage::Lightmass:
+    return TEXT("lightmass");
+  default:
+    return TEXT("applying");
+  }
+}
+
+float LightingStagePercent(ELightingBuildStage Stage) {
+  switch (Stage) {
+  case ELightingBuildStage::Exporting:
+    return 0.0f;
+  case ELightingBuildStage::Lightmass:
+    return 10.0f;
+  default:
+    return 90.0f;
+  }
+}
+
+void AddLightingStageSeconds(FMcpLightingBuildResult &Result,
+                             ELightingBuildStage Stage, double Seconds) {
+  switch (Stage) {
+  case ELightingBuildStage::Exporting:
+    Result.ExportSeconds += Seconds;
+    break;
+  case ELightingBuildStage::Lightmass:
+    Result.LightmassSeconds += Seconds;
+    break;
+  default:
+    Result.ApplySeconds += Seconds;
+    break;
+  }
+}
+
+// Counts the lightmap and shadowmap textures of every loaded level's build
+// data; a registry stored in its map package is counted once like the rest.
+void CollectLightingBuildData(UWorld *World, FMcpLightingBuildResult &Result) {
+  TSet<UPackage *> Seen;
+  for (ULevel *Level : World->GetLevels()) {
+    UMapBuildDataRegistry *Registry = Level ? Level->MapBuildData : nullptr;
+    UPackage *Package = Registry ? Registry->GetOutermost() : nullptr;
+    if (!Package || Seen.Contains(Package)) {
+      continue;
+    }
+    Seen.Add(Package);
+    ForEachObjectWithPackage(Package, [&Result](UObject *Object) {
+      if (Object->IsA<ULightMapTexture2D>()) {
+        ++Result.LightmapTextures;
+      } else if (Object->IsA<UShadowMapTexture2D>()) {
+        ++Result.ShadowmapTextures;
+      } else {
+        return true;
+      }
+      Result.TextureBytes +=
+          Object->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
+      return true;
+    });
+  }
+}
+
+void FinishLightingBuild(const FLightingBuildStateRef &State) {
+  if (State->bFinished) {
+    return;
+  }
+  State->bFinished = true;
+  FEditorDelegates::OnLightingBuildSucceeded.Remove(State->SucceededHandle);
+  FEditorDelegates::OnLightingBuildFailed.Remove(State->FailedHandle);
+  FEditorDelegates::OnLightingBuildKept.Remove(State->KeptHandle);
+
+  const double Now = FPlatformTime::Seconds();
+  FMcpLightingBuildResult &Result = State->Result;
+  AddLightingStageSeconds(Result, State->Stage, Now - State->StageStartSeconds);
+  Result.WallMs = (Now - State->StartSeconds) * 1000.0;
+  if (!Result.bTimedOut && !Result.bCancelled) {
+    Result.Outcome = State->bFailed                       ? TEXT("failed")
+                     : (State->bSucceeded || State->bKept) ? TEXT("succeeded")
+                                                          : TEXT("stopped");
+  }
+
+  if (UWorld *World = State->World.Get()) {
+    if (Result.Outcome == TEXT("succeeded")) {
+      if (State->bWithReflectionCaptures && GEditor) {
+        GEditor->BuildReflectionCaptures(World);
+        Result.bReflectionCapturesBuilt = true;
+      }
+    }
+    Result.UnbuiltObjectsAfter = World->NumLightingUnbuiltObjects;
+    CollectLightingBuildData(World, Result);
+  }
+  FMessageLog LightingResults(TEXT("LightingResults"));
+  Result.Errors = LightingResults.NumMessages(EMessageSeverity::Error);
+  Result.Warnings =
+      LightingResults.NumMessages(EMessageSeverity::Warning) - Result.Errors;
+
+  TFunction<void(const FMcpLightingBuildResult &)> OnFinished =
+      MoveTemp(State->OnFinished);
+  State->OnProgress = nullptr;
+  if (OnFinished) {
+    OnFinished(Result);
+  }
+}
+
+// Returns whether the build should be polled again.
+bool TickLightingBuild(const FLightingBuildStateRef &State) {
+  if (State->bFinished) {
+    return false;
+  }
+  const double Now = FPlatformTime::Seconds();
+  const double Elapsed = Now - State->StartSeconds;
+  if (!State->World.IsValid() || !GEditor) {
+    State->bFailed = true;
+    FinishLightingBuild(State);
+    return false;
+  }
+
+  const bool bRunning = GEditor->IsLightingBuildCurrentlyRunning();
+  if (State->bFailed || State->bKept ||
+      (!bRunning && (State->bSucceeded || Elapsed >= LightingStartGraceSeconds))) {
+    FinishLightingBuild(State);
+    return false;
+  }
+  if (State->TimeoutSeconds > 0.0 && Elapsed >= State->TimeoutSeconds) {
+    State->Result.bTimedOut = true;
+    State->Result.Outcome = TEXT("timeout");
+    FinishLightingBuild(State);
+    return false;
+  }
+
+  const ELightingBuildStage Stage =
+      GEditor->IsLightingBuildCurrentlyExporting() ? ELightingBuildStage::Exporting
+      : State->bSucceeded                          ? ELightingBuildStage::Applying
+                                                   : ELightingBuildStage::Lightmass;
+  float Percent = -1.0f;
+  if (Stage != State->Stage) {
+    AddLightingStageSeconds(State->Result, State->Stage,
+                            Now - State->StageStartSeconds);
+    State->Stage = Stage;
+    State->StageStartSeconds = Now;
+    Percent = LightingStagePercent(Stage);
+  } else if (Now - State->LastProgressSeconds < LightingProgressIntervalSeconds) {
+    return true;
+  }
+  State->LastProgressSeconds = Now;
+  if (State->OnProgress &&
+      !State->OnProgress(LightingStageName(Stage), Percent, Elapsed)) {
+    State->Result.bCancelled = true;
+    State->Result.Outcome = TEXT("cancelled");
+    FinishLightingBuild(State);
+    return false;
+  }
+  return true;
+}
+} // namespace
+#endif
+
+TSharedPtr<FJsonObject> FMcpLightingBuildResult::ToJson() const {
+  TSharedPtr<FJsonObject> Obj = MakeShared<FJsonObject>();
+  Obj->SetStringField(TEXT("quality"), FMcpLightingBuild::QualityName(Quality));
+  Obj->SetStringField(TEXT("outcome"), Outcome);
+  Obj->SetNumberField(TEXT("exportSeconds"), ExportSeconds);
+  Obj->SetNumberField(TEXT("lightmassSeconds"), LightmassSeconds);
+  Obj->SetNumberField(TEXT("applySeconds"), ApplySeconds);
+  Obj->SetNumberField(TEXT("wallMs"), WallMs);
+  Obj->SetNumberField(TEXT("unbuiltObjectsBefore"), UnbuiltObjectsBefore);
+  Obj->SetNumberField(TEXT("unbuiltObjectsAfter"), UnbuiltObjectsAfter);
+  Obj->SetNumberField(TEXT("lightmapTextures"), LightmapTextures);
+  Obj->SetNumberField(TEXT("shadowmapTextures"), ShadowmapTextures);
+  Obj->SetNumberField(TEXT("textureBytes"), static_cast<double>(TextureBytes));
+  Obj->SetNumberField(TEXT("warnings"), Warnings);
+  Obj->SetNumberField(TEXT("errors"), Errors);
+  Obj->SetBoolField(TEXT("reflectionCapturesBuilt"), bReflectionCapturesBuilt);
+  Obj->SetBoolField(TEXT("timedOut"), bTimedOut);
+  Obj->SetBoolField(TEXT("cancelled"), bCancelled);
+  return Obj;
+}
+
+FString FMcpLightingBuild::QualityName(ELightingBuildQuality Quality) {
+  switch (Quality) {
+  case ELightingBuildQuality::Quality_Preview:
+    return TEXT("preview");
+  case ELightingBuildQuality::Quality_Medium:
+    return TEXT("medium");
+  case ELightingBuildQuality::Quality_High:
+    return TEXT("high");
+  default:
+    return TEXT("production");
+  }
+}
+
+bool FMcpLightingBuild::ParseQuality(const FString &Name,
+                                     ELightingBuildQuality &OutQuality) {
+  const FString Lower = Name.ToLower();
+  if (Lower == TEXT("preview") || Lower == TEXT("0")) {
+    OutQuality = ELightingBuildQuality::Quality_Preview;
+  } else if (Lower == TEXT("medium") || Lower == TEXT("1")) {
+    OutQuality = ELightingBuildQuality::Quality_Medium;
+  } else if (Lower == TEXT("high") || Lower == TEXT("2")) {
+    OutQuality = ELightingBuildQuality::Quality_High;
+  } else if (Lower == TEXT("production") || Lower == TEXT("3")) {
+    OutQuality = ELightingBuildQuality::Quality_Production;
+  } else {
+    return false;
+  }
+  return true;
+}
+bool FMcpLightingBuild::IsTracking() {
+#if WITH_EDITOR
+  const TSharedPtr<FLightingBuildState> Active = GActiveLightingBuild.Pin();
+  return Active.IsValid() && !Active->bFinished;
+#else
+  return false;
+#endif
+}
+
+bool FMcpLightingBuild::Start(
+    UWorld *World, ELightingBuildQuality Quality, bool bWithReflectionCaptures,
+    double TimeoutSeconds,
+    TFunction<bool(const FString &Stage, float Percent, double Seconds)> OnProgress,
+    TFunction<void(const FMcpLightingBuildResult &)> OnFinished,
+    FString &OutError) {
+#if WITH_EDITOR
+  check(IsInGameThread());
+  if (!GEditor || !World) {
+    OutError = TEXT("Editor world not available");
+    return false;
+  }
+  if (IsTracking() || GEditor->IsLightingBuildCurrentlyRunning()) {
+    OutError = TEXT("A lighting build is already running");
+    return false;
+  }
+
+  FLightingBuildStateRef State = MakeShared<FLightingBuildState>();
+  State->World = World;
+  State->Result.Quality = Quality;
+  State->Result.UnbuiltObjectsBefore = World->NumLightingUnbuiltObjects;
+  State->bWithReflectionCaptures = bWithReflectionCaptures;
+  State->StartSeconds = FPlatformTime::Seconds();
+  State->StageStartSeconds = State->StartSeconds;
+  State->LastProgressSeconds = State->StartSeconds;
+  State->TimeoutSeconds = FMath::Max(0.0, TimeoutSeconds);
+  State->OnProgress = MoveTemp(OnProgress);
+  State->OnFinished = MoveTemp(OnFinished);
+
+  // Raw captures: the state outlives its delegates, which Finish removes.
+  FLightingBuildState *Raw = &State.Get();
+  State->SucceededHandle = FEditorDelegates::OnLightingBuildSucceeded.AddLambda(
+      [Raw]() { Raw->bSucceeded = true; });
+  State->FailedHandle = FEditorDelegates::OnLightingBuildFailed.AddLambda(
+      [Raw]() { Raw->bFailed = true; });
+  State->KeptHandle = FEditorDelegates::OnLightingBuildKept.AddLambda(
+      [Raw]() { Raw->bKept = true; });
+  GActiveLightingBuild = State;
+
+  // Reflection captures are rebuilt after the lighting is applied, on success.
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
+  ULevelEditorSubsystem *LES = GEditor->GetEditorSubsystem<ULevelEditorSubsystem>();
+  if (LES) {
+    LES->BuildLightMaps(Quality, /*bWithReflectionCaptures*/ false);
+  } else
+#endif
+  {
+    FString QualityArg = QualityName(Quality);
+    QualityArg[0] = FChar::ToUpper(QualityArg[0]);
+    const FString Command =
+        FString::Printf(TEXT("BuildLighting %s"), *QualityArg);
+    GEditor->Exec(World, *Command);
+  }
+
+  if (TickLightingBuild(State)) {
+    FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+        [State](float) { return TickLightingBuild(State); }));
+  }
+  return true;
+#else
+  OutError = TEXT("Lighting builds require the editor");
+  return false;
+#endif
+}
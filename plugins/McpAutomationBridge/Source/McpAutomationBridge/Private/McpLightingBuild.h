@@ -0,0 +1,69 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "Engine/EngineTypes.h"
+#include "Templates/Function.h"
+
+class UWorld;
+
+/** What one tracked lighting build did, handed to its completion callback. */
+struct FMcpLightingBuildResult
+{
+    ELightingBuildQuality Quality = ELightingBuildQuality::Quality_Production;
+    /**
+     * "succeeded", "failed", "stopped" (the editor stopped without reporting either, e.g. a
+     * cancel in the editor or nothing to build), "timeout" or "cancelled".
+     */
+    FString Outcome;
+    /** Seconds spent exporting the scene, in Lightmass, and applying the results. */
+    double ExportSeconds = 0.0;
+    double LightmassSeconds = 0.0;
+    double ApplySeconds = 0.0;
+    double WallMs = 0.0;
+    /** World->NumLightingUnbuiltObjects when the build started and ended. */
+    int32 UnbuiltObjectsBefore = 0;
+    int32 UnbuiltObjectsAfter = 0;
+    /** Lightmap and shadowmap textures in the levels' build data, and their estimated size. */
+    int32 LightmapTextures = 0;
+    int32 ShadowmapTextures = 0;
+    int64 TextureBytes = 0;
+    /** Messages the build left in the LightingResults log. */
+    int32 Warnings = 0;
+    int32 Errors = 0;
+    bool bReflectionCapturesBuilt = false;
+    bool bTimedOut = false;
+    bool bCancelled = false;
+
+    TSharedPtr<FJsonObject> ToJson() const;
+};
+
+/**
+ * Starts a static lighting build in an editor world and follows it without blocking the game
+ * thread: the stage (exporting, lightmass, applying) is read from the editor once per core-ticker
+ * tick and the editor's lighting-build delegates mark the end. Only one build is tracked at a
+ * time. Game thread only.
+ */
+class FMcpLightingBuild
+{
+public:
+    /**
+     * Starts the build. OnProgress runs when the stage changes, with a stage-weighted percent, and
+     * every few seconds within a stage with -1, plus the stage name and seconds so far; returning
+     * false stops following the build (the editor keeps building) and finishes it as cancelled.
+     * OnFinished runs exactly once, also when the world goes away or TimeoutSeconds (0 = none)
+     * pass first. Returns false with OutError, calling neither, when no build could start.
+     */
+    static bool Start(UWorld* World, ELightingBuildQuality Quality, bool bWithReflectionCaptures,
+        double TimeoutSeconds, TFunction<bool(const FString& Stage, float Percent, double Seconds)> OnProgress,
+        TFunction<void(const FMcpLightingBuildResult&)> OnFinished, FString& OutError);
+
+    /** Whether a build started by Start is still being followed. */
+    static bool IsTracking();
+
+    /** Lower-case name of Quality, as accepted in requests ("preview" ... "production"). */
+    static FString QualityName(ELightingBuildQuality Quality);
+
+    /** Parses a quality name or its index ("0" preview ... "3" production), case-insensitively. */
+    static bool ParseQuality(const FString& Name, ELightingBuildQuality& OutQuality);
+};
@@ -0,0 +1,149 @@
+#include "McpLogFilter.h"
+
+#include "Containers/StringConv.h"
+#include "Dom/JsonValue.h"
+
+namespace {
+ANSICHAR FoldLogAscii(ANSICHAR C) {
+  return (C >= 'A' && C <= 'Z') ? static_cast<ANSICHAR>(C - 'A' + 'a') : C;
+}
+
+// Accepts a string or an array of strings.
+void ReadLogCategoryNames(const TSharedPtr<FJsonObject> &Payload,
+                          const TCHAR *Field, TSet<FName> &Out) {
+  const TSharedPtr<FJsonValue> Value = Payload->TryGetField(Field);
+  if (!Value.IsValid()) {
+    return;
+  }
+  FString Single;
+  if (Value->TryGetString(Single)) {
+    if (!Single.IsEmpty()) {
+      Out.Add(FName(*Single));
+    }
+    return;
+  }
+  const TArray<TSharedPtr<FJsonValue>> *Items = nullptr;
+  if (Value->TryGetArray(Items) && Items) {
+    for (const TSharedPtr<FJsonValue> &Item : *Items) {
+      FString Name;
+      if (Item.IsValid() && Item->TryGetString(Name) && !Name.IsEmpty()) {
+        Out.Add(FName(*Name));
+      }
+    }
+  }
+}
+} // namespace
+
+bool FMcpLogFilter::Compile(const TSharedPtr<FJsonObject> &Payload,
+                            FMcpLogFilter &Out, FString &OutError) {
+  Out = FMcpLogFilter();
+  if (!Payload.IsValid()) {
+    return true;
+  }
+
+  FMcpLogFilter Filter;
+  ReadLogCategoryNames(Payload, TEXT("categories"), Filter.AllowCategories);
+  ReadLogCategoryNames(Payload, TEXT("category"), Filter.AllowCategories);
+  ReadLogCategoryNames(Payload, TEXT("excludeCategories"),
+                       Filter.DenyCategories);
+
+  FString Severity;
+  if (!Payload->TryGetStringField(TEXT("minVerbosity"), Severity)) {
+    Payload->TryGetStringField(TEXT("severity"), Severity);
+  }
+  if (!Severity.IsEmpty()) {
+    if (Severity.Equals(TEXT("info"), ESearchCase::IgnoreCase)) {
+      Filter.MaxVerbosity = ELogVerbosity::Log;
+    } else {
+      const ELogVerbosity::Type Parsed = ParseLogVerbosityFromString(Severity);
+      if (Parsed == ELogVerbosity::NoLogging &&
+          !Severity.Equals(TEXT("NoLogging"), ESearchCase::IgnoreCase)) {
+        OutError = FString::Printf(TEXT("Unknown verbosity '%s'."), *Severity);
+        return false;
+      }
+      Filter.MaxVerbosity = Parsed;
+    }
+  }
+
+  Payload->TryGetBoolField(TEXT("caseSensitive"), Filter.bCaseSensitive);
+  FString Contains;
+  if (Payload->TryGetStringField(TEXT("contains"), Contains) &&
+      !Contains.IsEmpty()) {
+    const FTCHARToUTF8 Utf8(*Contains);
+    Filter.Contains.Append(Utf8.Get(), Utf8.Length());
+    if (!Filter.bCaseSensitive) {
+      for (ANSICHAR &C : Filter.Contains) {
+        C = FoldLogAscii(C);
+      }
+    }
+  }
+
+  FString Regex;
+  if (Payload->TryGetStringField(TEXT("regex"), Regex) && !Regex.IsEmpty()) {
+    Filter.Pattern.Emplace(Regex);
+    Filter.PatternSource = Regex;
+  }
+
+  Out = MoveTemp(Filter);
+  return true;
+}
+
+bool FMcpLogFilter::PassesUtf8(const ANSICHAR *Message, int32 Len) const {
+  const int32 NeedleLen = Contains.Num();
+  if (NeedleLen == 0) {
+    return true;
+  }
+  const ANSICHAR *Needle = Contains.GetData();
+  for (int32 Start = 0; Start + NeedleLen <= Len; ++Start) {
+    int32 Index = 0;
+    if (bCaseSensitive) {
+      while (Index < NeedleLen && Message[Start + Index] == Needle[Index]) {
+        ++Index;
+      }
+    } else {
+      while (Index < NeedleLen &&
+             FoldLogAscii(Message[Start + Index]) == Needle[Index]) {
+        ++Index;
+      }
+    }
+    if (Index == NeedleLen) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool FMcpLogFilter::PassesPattern(const FString &Message) const {
+  if (!Pattern.IsSet()) {
+    return true;
+  }
+  FRegexMatcher Matcher(Pattern.GetValue(), Message);
+  return Matcher.FindNext();
+}
+
+TSharedPtr<FJsonObject> FMcpLogFilter::Describe() const {
+  TSharedPtr<FJsonObject> Out = MakeShared<FJsonObject>();
+  auto NamesToJson = [](const TSet<FName> &Names) {
+    TArray<TSharedPtr<FJsonValue>> Values;
+    for (const FName &Name : Names) {
+      Values.Add(MakeShared<FJsonValueString>(Name.ToString()));
+    }
+    return Values;
+  };
+  if (AllowCategories.Num() > 0) {
+    Out->SetArrayField(TEXT("categories"), NamesToJson(AllowCategories));
+  }
+  if (DenyCategories.Num() > 0) {
+    Out->SetArrayField(TEXT("excludeCategories"), NamesToJson(DenyCategories));
+  }
+  Out->SetStringField(TEXT("minVerbosity"), ToString(MaxVerbosity));
+  if (Contains.Num() > 0) {
+    const FUTF8ToTCHAR Needle(Contains.GetData(), Contains.Num());
+    Out->SetStringField(TEXT("contains"), FString(Needle.Length(), Needle.Get()));
+    Out->SetBoolField(TEXT("caseSensitive"), bCaseSensitive);
+  }
+  if (!PatternSource.IsEmpty()) {
+    Out->SetStringField(TEXT("regex"), PatternSource);
+  }
+  return Out;
+}
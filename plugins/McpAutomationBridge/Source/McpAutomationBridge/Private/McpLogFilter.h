@@ -0,0 +1,69 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "Internationalization/Regex.h"
+#include "Logging/LogVerbosity.h"
+
+/**
+ * Log line filter compiled once from a manage_logs subscribe (or get_recent_logs) payload.
+ * Category and verbosity checks run on the FName and enum stored in each ring slot before any
+ * text is copied; the substring check runs on the slot's UTF-8 bytes, and only lines that pass
+ * both are decoded for the optional regex.
+ *
+ * Payload fields, all optional:
+ *   categories / category        allow list of category names (empty = all)
+ *   excludeCategories            deny list, applied after the allow list
+ *   minVerbosity / severity      least severe level kept: Fatal, Error, Warning, Display, Log,
+ *                                Verbose, VeryVerbose ("info" = Log)
+ *   contains, caseSensitive      plain substring; ASCII case-insensitive unless caseSensitive
+ *   regex                        ICU regular expression matched against the message
+ */
+class FMcpLogFilter
+{
+public:
+    /** Returns false and fills OutError when a field is malformed; Out is left pass-all. */
+    static bool Compile(const TSharedPtr<FJsonObject>& Payload, FMcpLogFilter& Out, FString& OutError);
+
+    bool IsPassAll() const
+    {
+        return AllowCategories.Num() == 0 && DenyCategories.Num() == 0 && MaxVerbosity == ELogVerbosity::All &&
+               Contains.Num() == 0 && !Pattern.IsSet();
+    }
+
+    /** Cheap check on the slot metadata. */
+    bool PassesCategory(FName Category, ELogVerbosity::Type Verbosity) const
+    {
+        if (Verbosity > MaxVerbosity)
+        {
+            return false;
+        }
+        if (AllowCategories.Num() > 0 && !AllowCategories.Contains(Category))
+        {
+            return false;
+        }
+        return DenyCategories.Num() == 0 || !DenyCategories.Contains(Category);
+    }
+
+    /** Substring check on the raw UTF-8 message bytes. */
+    bool PassesUtf8(const ANSICHAR* Message, int32 Len) const;
+
+    bool HasPattern() const { return Pattern.IsSet(); }
+
+    /** Regex check on the decoded message; only called when HasPattern(). */
+    bool PassesPattern(const FString& Message) const;
+
+    /** Echo of the compiled filter for subscribe responses. */
+    TSharedPtr<FJsonObject> Describe() const;
+
+private:
+    TSet<FName> AllowCategories;
+    TSet<FName> DenyCategories;
+    /** Lines less severe than this (higher enum value) are dropped. */
+    ELogVerbosity::Type MaxVerbosity = ELogVerbosity::All;
+    /** UTF-8 needle, lower-cased when !bCaseSensitive. */
+    TArray<ANSICHAR> Contains;
+    bool bCaseSensitive = false;
+    TOptional<FRegexPattern> Pattern;
+    FString PatternSource;
+};
@@ -0,0 +1,227 @@
+#include "McpLogRingBuffer.h"
+
+#include "McpLogFilter.h"
+
+#include "Containers/StringConv.h"
+#include "HAL/PlatformMisc.h"
+#include "HAL/PlatformProcess.h"
+
+namespace {
+bool IsLogHighSurrogate(uint32 Code) { return Code >= 0xD800 && Code <= 0xDBFF; }
+bool IsLogLowSurrogate(uint32 Code) { return Code >= 0xDC00 && Code <= 0xDFFF; }
+
+// Encodes Text as UTF-8 into Out without allocating. Stops before the first
+// character that does not fit whole, so the bytes never end mid-sequence.
+int32 EncodeLogUtf8(const TCHAR *Text, ANSICHAR *Out, int32 Capacity,
+                    bool &bOutTruncated) {
+  bOutTruncated = false;
+  int32 Len = 0;
+  if (!Text) {
+    return 0;
+  }
+  for (const TCHAR *Cursor = Text; *Cursor; ++Cursor) {
+    uint32 Code = static_cast<uint32>(*Cursor);
+    if (IsLogHighSurrogate(Code) && IsLogLowSurrogate(static_cast<uint32>(Cursor[1]))) {
+      Code = 0x10000 + ((Code - 0xD800) << 10) +
+             (static_cast<uint32>(*++Cursor) - 0xDC00);
+    } else if (IsLogHighSurrogate(Code) || IsLogLowSurrogate(Code) ||
+               Code > 0x10FFFF) {
+      Code = 0xFFFD;
+    }
+
+    const int32 Needed =
+        Code < 0x80 ? 1 : Code < 0x800 ? 2 : Code < 0x10000 ? 3 : 4;
+    if (Len + Needed > Capacity) {
+      bOutTruncated = true;
+      break;
+    }
+    uint8 *Bytes = reinterpret_cast<uint8 *>(Out + Len);
+    switch (Needed) {
+    case 1:
+      Bytes[0] = static_cast<uint8>(Code);
+      break;
+    case 2:
+      Bytes[0] = static_cast<uint8>(0xC0 | (Code >> 6));
+      Bytes[1] = static_cast<uint8>(0x80 | (Code & 0x3F));
+      break;
+    case 3:
+      Bytes[0] = static_cast<uint8>(0xE0 | (Code >> 12));
+      Bytes[1] = static_cast<uint8>(0x80 | ((Code >> 6) & 0x3F));
+      Bytes[2] = static_cast<uint8>(0x80 | (Code & 0x3F));
+      break;
+    default:
+      Bytes[0] = static_cast<uint8>(0xF0 | (Code >> 18));
+      Bytes[1] = static_cast<uint8>(0x80 | ((Code >> 12) & 0x3F));
+      Bytes[2] = static_cast<uint8>(0x80 | ((Code >> 6) & 0x3F));
+      Bytes[3] = static_cast<uint8>(0x80 | (Code & 0x3F));
+      break;
+    }
+    Len += Needed;
+  }
+  // Log lines routinely end in a newline; the consumer adds its own framing.
+  while (Len > 0 && (Out[Len - 1] == '\n' || Out[Len - 1] == '\r')) {
+    --Len;
+  }
+  return Len;
+}
+
+FString DecodeLogUtf8(const ANSICHAR *Bytes, int32 Len) {
+  if (Len <= 0) {
+    return FString();
+  }
+  const FUTF8ToTCHAR Converted(Bytes, Len);
+  return FString(Converted.Length(), Converted.Get());
+}
+} // namespace
+
+FMcpLogRingBuffer::FMcpLogRingBuffer(int32 InCapacity) {
+  Capacity = static_cast<int32>(
+      FMath::RoundUpToPowerOfTwo(static_cast<uint32>(FMath::Max(64, InCapacity))));
+  Mask = static_cast<uint64>(Capacity) - 1;
+  Slots = static_cast<FSlot *>(
+      FMemory::Malloc(sizeof(FSlot) * Capacity, alignof(FSlot)));
+  for (int32 Index = 0; Index < Capacity; ++Index) {
+    new (&Slots[Index]) FSlot();
+  }
+}
+
+FMcpLogRingBuffer::~FMcpLogRingBuffer() {
+  for (int32 Index = 0; Index < Capacity; ++Index) {
+    Slots[Index].~FSlot();
+  }
+  FMemory::Free(Slots);
+}
+
+void FMcpLogRingBuffer::Write(const TCHAR *Message,
+                              ELogVerbosity::Type Verbosity,
+                              const FName &Category) {
+  const uint64 Sequence = NextSequence.AddExchange(1);
+  FSlot &Slot = Slots[Sequence & Mask];
+  const uint64 Writing = CommittedState(Sequence) + 1;
+
+  // Claim the slot. It normally holds a line from a previous lap; if the
+  // writer from the previous lap is still copying (the ring wrapped while it
+  // was preempted), wait for it rather than interleave bytes. A newer lap
+  // having landed already means this line would be overwritten anyway.
+  uint64 Current = Slot.State.Load();
+  for (;;) {
+    if (Current > Writing) {
+      return;
+    }
+    if (Current & 1) {
+      FPlatformProcess::Yield();
+      Current = Slot.State.Load();
+      continue;
+    }
+    if (Slot.State.CompareExchange(Current, Writing)) {
+      break;
+    }
+  }
+
+  Slot.TimestampTicks = FDateTime::UtcNow().GetTicks();
+  Slot.CategoryName = Category;
+  Slot.Verbosity = static_cast<uint8>(Verbosity & ELogVerbosity::VerbosityMask);
+
+  // FName::ToString allocates; the display-string buffer does not.
+  TCHAR CategoryText[NAME_SIZE];
+  Category.GetPlainNameString(CategoryText);
+  bool bCategoryTruncated = false;
+  Slot.CategoryLen = static_cast<uint8>(
+      EncodeLogUtf8(CategoryText, Slot.Category, CategoryBytes, bCategoryTruncated));
+
+  bool bMessageTruncated = false;
+  Slot.MessageLen = static_cast<uint16>(
+      EncodeLogUtf8(Message, Slot.Message, MessageBytes, bMessageTruncated));
+  Slot.bTruncated = bMessageTruncated ? 1 : 0;
+
+  Slot.State.Store(CommittedState(Sequence));
+}
+
+uint64 FMcpLogRingBuffer::Read(uint64 Cursor, int32 MaxRecords,
+                               TArray<FMcpLogRecord> &OutRecords,
+                               uint64 &OutSkipped,
+                               const FMcpLogFilter *Filter) const {
+  if (Filter && Filter->IsPassAll()) {
+    Filter = nullptr;
+  }
+
+  const uint64 Next = GetNextSequence();
+  const uint64 Oldest = Next > static_cast<uint64>(Capacity) ? Next - Capacity : 0;
+  if (Cursor < Oldest) {
+    OutSkipped += Oldest - Cursor;
+    Cursor = Oldest;
+  }
+
+  // Scratch copy of one slot; the bytes are only trusted once the state
+  // word reads the same before and after the copy.
+  ANSICHAR Category[CategoryBytes];
+  ANSICHAR Message[MessageBytes];
+
+  int32 Added = 0;
+  while (Cursor < Next && Added < MaxRecords) {
+    const FSlot &Slot = Slots[Cursor & Mask];
+    const uint64 Expected = CommittedState(Cursor);
+    const uint64 Before = Slot.State.Load();
+    if (Before > Expected + 1) {
+      // A later lap already reused the slot.
+      ++OutSkipped;
+      ++Cursor;
+      continue;
+    }
+    if (Before != Expected) {
+      // Writer for this sequence has not finished; resume here next time.
+      break;
+    }
+
+    const int64 Ticks = Slot.TimestampTicks;
+    const uint8 Verbosity = Slot.Verbosity;
+    const uint8 bTruncated = Slot.bTruncated;
+    const int32 CategoryLen = FMath::Min<int32>(Slot.CategoryLen, CategoryBytes);
+    const int32 MessageLen = FMath::Min<int32>(Slot.MessageLen, MessageBytes);
+
+    // Category and verbosity are decided on the slot itself; a torn read can
+    // only produce a wrong verdict, which the state check below discards.
+    if (Filter && !Filter->PassesCategory(
+                      Slot.CategoryName,
+                      static_cast<ELogVerbosity::Type>(Verbosity))) {
+      FPlatformMisc::MemoryBarrier();
+      if (Slot.State.Load() != Expected) {
+        ++OutSkipped;
+      }
+      ++Cursor;
+      continue;
+    }
+
+    FMemory::Memcpy(Category, Slot.Category, CategoryLen);
+    FMemory::Memcpy(Message, Slot.Message, MessageLen);
+
+    FPlatformMisc::MemoryBarrier();
+    if (Slot.State.Load() != Expected) {
+      ++OutSkipped;
+      ++Cursor;
+      continue;
+    }
+
+    if (Filter && !Filter->PassesUtf8(Message, MessageLen)) {
+      ++Cursor;
+      continue;
+    }
+    FString DecodedMessage = DecodeLogUtf8(Message, MessageLen);
+    if (Filter && Filter->HasPattern() &&
+        !Filter->PassesPattern(DecodedMessage)) {
+      ++Cursor;
+      continue;
+    }
+
+    FMcpLogRecord &Record = OutRecords.AddDefaulted_GetRef();
+    Record.Sequence = Cursor;
+    Record.Timestamp = FDateTime(Ticks);
+    Record.Verbosity = static_cast<ELogVerbosity::Type>(Verbosity);
+    Record.Category = DecodeLogUtf8(Category, CategoryLen);
+    Record.Message = MoveTemp(DecodedMessage);
+    Record.bTruncated = bTruncated != 0;
+    ++Added;
+    ++Cursor;
+  }
+  return Cursor;
+}
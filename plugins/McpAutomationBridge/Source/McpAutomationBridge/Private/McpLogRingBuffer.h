@@ -0,0 +1,88 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Logging/LogVerbosity.h"
+#include "Templates/Atomic.h"
+
+class FMcpLogFilter;
+
+/** One log line copied out of the ring, with the sequence number it was written under. */
+struct FMcpLogRecord
+{
+    uint64 Sequence = 0;
+    FDateTime Timestamp;
+    ELogVerbosity::Type Verbosity = ELogVerbosity::Log;
+    FString Category;
+    FString Message;
+    /** The message was longer than a slot and was cut at a character boundary. */
+    bool bTruncated = false;
+};
+
+/**
+ * Fixed-size ring of recent log lines that any thread can write without a lock or an allocation.
+ * A writer claims the next sequence number with one atomic add and encodes the line as UTF-8
+ * straight into that slot; the slot's state word works as a seqlock, so readers copy a slot
+ * optimistically and keep it only if the state did not change underneath them. Old lines are
+ * overwritten once the ring wraps, which readers see as skipped sequence numbers.
+ */
+class FMcpLogRingBuffer
+{
+public:
+    /** Capacity is rounded up to a power of two, at least 64 slots. */
+    explicit FMcpLogRingBuffer(int32 InCapacity);
+    ~FMcpLogRingBuffer();
+
+    FMcpLogRingBuffer(const FMcpLogRingBuffer&) = delete;
+    FMcpLogRingBuffer& operator=(const FMcpLogRingBuffer&) = delete;
+
+    /** Safe from any thread, including inside an output device's Serialize. */
+    void Write(const TCHAR* Message, ELogVerbosity::Type Verbosity, const FName& Category);
+
+    /**
+     * Appends up to MaxRecords committed lines with Sequence >= Cursor, in order, and returns
+     * the cursor to continue from. Lines already overwritten are added to OutSkipped. Reading
+     * stops at the first line whose writer has not finished, so no line is reported twice.
+     * Lines Filter rejects are consumed without being copied out of their slot.
+     */
+    uint64 Read(uint64 Cursor, int32 MaxRecords, TArray<FMcpLogRecord>& OutRecords, uint64& OutSkipped,
+                const FMcpLogFilter* Filter = nullptr) const;
+
+    /** Sequence number the next write will get; doubles as the "live tail" cursor. */
+    uint64 GetNextSequence() const { return NextSequence.Load(EMemoryOrder::Relaxed); }
+
+    /** Oldest sequence number that can still be in the ring. */
+    uint64 GetOldestSequence() const
+    {
+        const uint64 Next = GetNextSequence();
+        return Next > static_cast<uint64>(Capacity) ? Next - Capacity : 0;
+    }
+
+    int32 GetCapacity() const { return Capacity; }
+
+private:
+    static constexpr int32 CategoryBytes = 64;
+    static constexpr int32 MessageBytes = 912;
+
+    /** One cache-line aligned kilobyte per line. */
+    struct alignas(64) FSlot
+    {
+        /** 0 empty, (Sequence + 1) * 2 committed, that plus one while a writer owns the slot. */
+        TAtomic<uint64> State{0};
+        int64 TimestampTicks = 0;
+        /** Only compared and hashed by filters, never resolved; the text copy below is what readers decode. */
+        FName CategoryName;
+        uint16 MessageLen = 0;
+        uint8 CategoryLen = 0;
+        uint8 Verbosity = 0;
+        uint8 bTruncated = 0;
+        ANSICHAR Category[CategoryBytes];
+        ANSICHAR Message[MessageBytes];
+    };
+
+    static uint64 CommittedState(uint64 Sequence) { return (Sequence + 1) * 2; }
+
+    FSlot* Slots = nullptr;
+    int32 Capacity = 0;
+    uint64 Mask = 0;
+    TAtomic<uint64> NextSequence{0};
+};
@@ -0,0 +1,219 @@
+#include "McpMaterialCompileQueue.h"
+
+#include "Containers/Ticker.h"
+#include "HAL/PlatformTime.h"
+#include "Materials/Material.h"
+
+#if WITH_EDITOR
+#include "MaterialGraph/MaterialGraph.h"
+#include "MaterialShared.h"
+#include "RHI.h"
+#include "ShaderCompiler.h"
+#endif
+
+namespace {
+int32 GMaterialCompileScopeDepth = 0;
+TArray<TWeakObjectPtr<UMaterial>> GQueuedMaterialCompiles;
+
+uint64 GMaterialCompilesRequested = 0;
+uint64 GMaterialCompilesDeferred = 0;
+uint64 GMaterialCompilesRun = 0;
+uint64 GMaterialShaderWatches = 0;
+double GMaterialCompileSeconds = 0.0;
+
+// Often enough for a progress bar, rare enough that a long shader compile
+// does not flood the socket.
+constexpr float ShaderWatchIntervalSeconds = 0.5f;
+
+#if WITH_EDITOR
+void RecompileMaterialNow(UMaterial *Material) {
+  const double StartSeconds = FPlatformTime::Seconds();
+  // PostEditChange resubmits the shader map; with asynchronous shader
+  // compilation (the editor default) it returns once the jobs are queued.
+  Material->PreEditChange(nullptr);
+  Material->PostEditChange();
+  // Syncs the EdGraph so connections persist across save/load.
+  if (Material->MaterialGraph) {
+    Material->MaterialGraph->RebuildGraph();
+  }
+  Material->MarkPackageDirty();
+  ++GMaterialCompilesRun;
+  GMaterialCompileSeconds += FPlatformTime::Seconds() - StartSeconds;
+}
+
+const FMaterialResource *GetRunningMaterialResource(UMaterial *Material) {
+  return Material ? Material->GetMaterialResource(GMaxRHIFeatureLevel)
+                  : nullptr;
+}
+#endif
+
+struct FShaderWatch {
+  TWeakObjectPtr<UMaterial> Material;
+  FMcpMaterialShaderStatus Status;
+  double StartSeconds = 0.0;
+  double TimeoutSeconds = 0.0;
+  TFunction<bool(int32)> OnProgress;
+  TFunction<void(const FMcpMaterialShaderStatus &)> OnFinished;
+};
+using FShaderWatchRef = TSharedRef<FShaderWatch>;
+
+void FinishShaderWatch(const FShaderWatchRef &Watch) {
+  Watch->Status.RemainingJobs =
+      FMcpMaterialCompileQueue::GetNumRemainingShaderJobs();
+  Watch->Status.WaitMs =
+      (FPlatformTime::Seconds() - Watch->StartSeconds) * 1000.0;
+#if WITH_EDITOR
+  if (const FMaterialResource *Resource =
+          GetRunningMaterialResource(Watch->Material.Get())) {
+    Watch->Status.bFinished = Resource->IsCompilationFinished();
+    if (Watch->Status.bFinished) {
+      Watch->Status.Errors = Resource->GetCompileErrors();
+    }
+  }
+#endif
+  Watch->OnFinished(Watch->Status);
+}
+
+// Returns false once the watch is over, which removes the ticker.
+bool TickShaderWatch(const FShaderWatchRef &Watch) {
+  UMaterial *Material = Watch->Material.Get();
+  if (!Material) {
+    FinishShaderWatch(Watch);
+    return false;
+  }
+#if WITH_EDITOR
+  const FMaterialResource *Resource = GetRunningMaterialResource(Material);
+  if (!Resource || Resource->IsCompilationFinished()) {
+    FinishShaderWatch(Watch);
+    return false;
+  }
+#endif
+  if (FPlatformTime::Seconds() - Watch->StartSeconds >= Watch->TimeoutSeconds) {
+    Watch->Status.bTimedOut = true;
+    FinishShaderWatch(Watch);
+    return false;
+  }
+  if (Watch->OnProgress &&
+      !Watch->OnProgress(FMcpMaterialCompileQueue::GetNumRemainingShaderJobs())) {
+    Watch->Status.bCancelled = true;
+    FinishShaderWatch(Watch);
+    return false;
+  }
+  return true;
+}
+} // namespace
+
+FMcpMaterialCompileQueue::FScope::FScope() { ++GMaterialCompileScopeDepth; }
+
+FMcpMaterialCompileQueue::FScope::~FScope() {
+  if (--GMaterialCompileScopeDepth == 0) {
+    Flush();
+  }
+}
+
+void FMcpMaterialCompileQueue::Queue(UMaterial *Material) {
+  check(IsInGameThread());
+  if (!Material) {
+    return;
+  }
+  ++GMaterialCompilesRequested;
+#if WITH_EDITOR
+  if (GMaterialCompileScopeDepth > 0) {
+    ++GMaterialCompilesDeferred;
+    Material->MarkPackageDirty();
+    GQueuedMaterialCompiles.AddUnique(Material);
+    return;
+  }
+  RecompileMaterialNow(Material);
+#endif
+}
+
+void FMcpMaterialCompileQueue::Flush(TArray<FString> *OutMaterialPaths) {
+  check(IsInGameThread());
+  TArray<TWeakObjectPtr<UMaterial>> Queued;
+  Swap(Queued, GQueuedMaterialCompiles);
+#if WITH_EDITOR
+  for (const TWeakObjectPtr<UMaterial> &Weak : Queued) {
+    if (UMaterial *Material = Weak.Get()) {
+      RecompileMaterialNow(Material);
+      if (OutMaterialPaths) {
+        OutMaterialPaths->Add(Material->GetPathName());
+      }
+    }
+  }
+#endif
+}
+
+int32 FMcpMaterialCompileQueue::GetNumRemainingShaderJobs() {
+#if WITH_EDITOR
+  return GShaderCompilingManager ? GShaderCompilingManager->GetNumRemainingJobs()
+                                 : 0;
+#else
+  return 0;
+#endif
+}
+
+void FMcpMaterialCompileQueue::WatchShaders(
+    UMaterial *Material, double TimeoutSeconds,
+    TFunction<bool(int32 RemainingJobs)> OnProgress,
+    TFunction<void(const FMcpMaterialShaderStatus &)> OnFinished) {
+  check(IsInGameThread());
+  ++GMaterialShaderWatches;
+  FShaderWatchRef Watch = MakeShared<FShaderWatch>();
+  Watch->Material = Material;
+  Watch->Status.MaterialPath = Material ? Material->GetPathName() : FString();
+  Watch->StartSeconds = FPlatformTime::Seconds();
+  Watch->TimeoutSeconds = FMath::Max(0.0, TimeoutSeconds);
+  Watch->OnProgress = MoveTemp(OnProgress);
+  Watch->OnFinished = MoveTemp(OnFinished);
+
+  // A material whose shaders were cached answers without waiting a tick.
+  if (TickShaderWatch(Watch)) {
+    FTSTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateLambda(
+            [Watch](float) { return TickShaderWatch(Watch); }),
+        ShaderWatchIntervalSeconds);
+  }
+}
+
+TSharedPtr<FJsonObject>
+FMcpMaterialCompileQueue::ToJson(const FMcpMaterialShaderStatus &Status) {
+  TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+  Json->SetStringField(TEXT("materialPath"), Status.MaterialPath);
+  Json->SetBoolField(TEXT("finished"), Status.bFinished);
+  Json->SetBoolField(TEXT("timedOut"), Status.bTimedOut);
+  Json->SetBoolField(TEXT("cancelled"), Status.bCancelled);
+  Json->SetNumberField(TEXT("remainingJobs"), Status.RemainingJobs);
+  Json->SetNumberField(TEXT("waitMs"), Status.WaitMs);
+  TArray<TSharedPtr<FJsonValue>> Errors;
+  Errors.Reserve(Status.Errors.Num());
+  for (const FString &Error : Status.Errors) {
+    Errors.Add(MakeShared<FJsonValueString>(Error));
+  }
+  Json->SetArrayField(TEXT("errors"), Errors);
+  return Json;
+}
+
+TSharedPtr<FJsonObject> FMcpMaterialCompileQueue::GetStats(bool bReset) {
+  TSharedPtr<FJsonObject> Stats = MakeShared<FJsonObject>();
+  Stats->SetNumberField(TEXT("requested"),
+                        static_cast<double>(GMaterialCompilesRequested));
+  Stats->SetNumberField(TEXT("deferred"),
+                        static_cast<double>(GMaterialCompilesDeferred));
+  Stats->SetNumberField(TEXT("recompiled"),
+                        static_cast<double>(GMaterialCompilesRun));
+  Stats->SetNumberField(TEXT("shaderWatches"),
+                        static_cast<double>(GMaterialShaderWatches));
+  Stats->SetNumberField(TEXT("recompileMs"), GMaterialCompileSeconds * 1000.0);
+  Stats->SetNumberField(TEXT("pending"), GQueuedMaterialCompiles.Num());
+  Stats->SetNumberField(TEXT("remainingShaderJobs"),
+                        GetNumRemainingShaderJobs());
+  if (bReset) {
+    GMaterialCompilesRequested = 0;
+    GMaterialCompilesDeferred = 0;
+    GMaterialCompilesRun = 0;
+    GMaterialShaderWatches = 0;
+    GMaterialCompileSeconds = 0.0;
+  }
+  return Stats;
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "Templates/Function.h"
+
+class UMaterial;
+
+/** Where the shaders of one material stand, as reported by FMcpMaterialCompileQueue::WatchShaders. */
+struct FMcpMaterialShaderStatus
+{
+    FString MaterialPath;
+
+    /** The material's shader map for the running feature level finished compiling. */
+    bool bFinished = false;
+    bool bTimedOut = false;
+    bool bCancelled = false;
+
+    /** Shader jobs still outstanding across the editor, not only this material's. */
+    int32 RemainingJobs = 0;
+    double WaitMs = 0.0;
+
+    /** Compile errors of the material's shader map, once it finished. */
+    TArray<FString> Errors;
+};
+
+/**
+ * Material recompiles requested while a material edit session is open, run once per material when
+ * the outermost scope closes, so a graph built from N expression edits submits one set of shader
+ * jobs instead of N sets that are obsolete as soon as the next edit lands. A deferred request only
+ * marks the package dirty: the expression list is already current for the edits that follow, and
+ * the editor graph and shader map are rebuilt at the flush. Outside a scope a recompile runs at once.
+ * Game thread only.
+ */
+class FMcpMaterialCompileQueue
+{
+public:
+    /** Defers the recompiles queued during its lifetime until the outermost scope closes. */
+    class FScope
+    {
+    public:
+        FScope();
+        ~FScope();
+
+        FScope(const FScope&) = delete;
+        FScope& operator=(const FScope&) = delete;
+    };
+
+    /** Recompiles Material (PreEditChange/PostEditChange and a graph rebuild), or queues it while a scope is open. */
+    static void Queue(UMaterial* Material);
+
+    /** Recompiles every queued material now; OutMaterialPaths receives the ones that were. */
+    static void Flush(TArray<FString>* OutMaterialPaths = nullptr);
+
+    /** Shader jobs the shader compiling manager has not finished yet. */
+    static int32 GetNumRemainingShaderJobs();
+
+    /**
+     * Polls from the core ticker, without blocking the game thread, until the shaders of Material
+     * finish compiling or TimeoutSeconds pass. OnProgress runs about twice a second with the
+     * remaining job count and stops the watch, marked cancelled, by returning false; OnFinished runs
+     * exactly once, also when the material is destroyed in the meantime.
+     */
+    static void WatchShaders(UMaterial* Material, double TimeoutSeconds, TFunction<bool(int32 RemainingJobs)> OnProgress,
+        TFunction<void(const FMcpMaterialShaderStatus&)> OnFinished);
+
+    /** materialPath, finished, timedOut, cancelled, remainingJobs, waitMs and errors of Status. */
+    static TSharedPtr<FJsonObject> ToJson(const FMcpMaterialShaderStatus& Status);
+
+    /** Requested, deferred and recompiled counts for get_bridge_metrics. */
+    static TSharedPtr<FJsonObject> GetStats(bool bReset);
+};
@@ -0,0 +1,395 @@
+#include "McpMemorySnapshot.h"
+
+#include "ContentStreaming.h"
+#include "Containers/Ticker.h"
+#include "Engine/SkeletalMesh.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/Texture.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+#include "RHI.h"
+#include "UObject/UObjectArray.h"
+#include "UObject/UObjectGlobals.h"
+
+#if __has_include("DynamicRHI.h")
+#include "DynamicRHI.h"
+#endif
+
+namespace {
+constexpr int32 MaxStoredMemorySnapshots = 16;
+constexpr int32 MemorySnapshotObjectsPerTimeCheck = 256;
+constexpr double MemorySnapshotProgressSeconds = 0.5;
+
+struct FMemoryTotals {
+  int64 Count = 0;
+  int64 Bytes = 0;
+  int64 SystemBytes = 0;
+  int64 VideoBytes = 0;
+
+  void Add(const FResourceSizeEx &Size) {
+    ++Count;
+    Bytes += static_cast<int64>(Size.GetTotalMemoryBytes());
+    SystemBytes += static_cast<int64>(Size.GetDedicatedSystemMemoryBytes());
+    VideoBytes += static_cast<int64>(Size.GetDedicatedVideoMemoryBytes());
+  }
+};
+
+struct FStoredMemorySnapshot {
+  FString Id;
+  double CapturedSeconds = 0.0;
+  FMemoryTotals Totals;
+  TMap<FString, FMemoryTotals> Classes;
+};
+
+struct FMemorySnapshotState {
+  FMcpMemorySnapshotOptions Options;
+  int32 NextIndex = 0;
+  int32 EndIndex = 0;
+  // Class pointer -> slot in Classes. Dropped after every GC pass so a class
+  // freed mid-scan can never lend its address to a new one.
+  TMap<const UClass *, int32> ClassSlots;
+  TMap<FString, int32> ClassSlotsByName;
+  TArray<TPair<FString, FMemoryTotals>> Classes;
+  FMemoryTotals Totals;
+  FMemoryTotals Textures;
+  FMemoryTotals StaticMeshes;
+  FMemoryTotals SkeletalMeshes;
+  double StartSeconds = 0.0;
+  double WorkSeconds = 0.0;
+  double LastProgressSeconds = 0.0;
+  int32 Frames = 0;
+  int32 GcPasses = 0;
+  FDelegateHandle GcHandle;
+  bool bFinished = false;
+  TFunction<bool(float)> OnProgress;
+  TFunction<void(const TSharedPtr<FJsonObject> &)> OnFinished;
+};
+using FMemorySnapshotStateRef = TSharedRef<FMemorySnapshotState>;
+
+TWeakPtr<FMemorySnapshotState> GActiveMemorySnapshot;
+TArray<FStoredMemorySnapshot> GStoredMemorySnapshots;
+int32 GNextMemorySnapshotId = 1;
+
+const FStoredMemorySnapshot *FindStoredMemorySnapshot(const FString &Id) {
+  return GStoredMemorySnapshots.FindByPredicate(
+      [&Id](const FStoredMemorySnapshot &Stored) { return Stored.Id == Id; });
+}
+
+FMemoryTotals &MemorySnapshotClassTotals(FMemorySnapshotState &State,
+                                         const UClass *Class) {
+  if (const int32 *Slot = State.ClassSlots.Find(Class)) {
+    return State.Classes[*Slot].Value;
+  }
+  const FString Name = Class->GetPathName();
+  int32 Slot = INDEX_NONE;
+  if (const int32 *Existing = State.ClassSlotsByName.Find(Name)) {
+    Slot = *Existing;
+  } else {
+    Slot = State.Classes.Emplace(Name, FMemoryTotals());
+    State.ClassSlotsByName.Add(Name, Slot);
+  }
+  State.ClassSlots.Add(Class, Slot);
+  return State.Classes[Slot].Value;
+}
+
+void ScanMemorySnapshotObject(FMemorySnapshotState &State, UObject *Object) {
+  const EResourceSizeMode::Type Mode = State.Options.bEstimatedTotal
+                                           ? EResourceSizeMode::EstimatedTotal
+                                           : EResourceSizeMode::Exclusive;
+  FResourceSizeEx Size(Mode);
+  Object->GetResourceSizeEx(Size);
+  const UClass *Class = Object->GetClass();
+  MemorySnapshotClassTotals(State, Class).Add(Size);
+  State.Totals.Add(Size);
+  if (Class->IsChildOf(UTexture::StaticClass())) {
+    State.Textures.Add(Size);
+  } else if (Class->IsChildOf(UStaticMesh::StaticClass())) {
+    State.StaticMeshes.Add(Size);
+  } else if (Class->IsChildOf(USkeletalMesh::StaticClass())) {
+    State.SkeletalMeshes.Add(Size);
+  }
+}
+
+TSharedPtr<FJsonObject> MemoryTotalsJson(const FMemoryTotals &Totals) {
+  TSharedPtr<FJsonObject> Obj = MakeShared<FJsonObject>();
+  Obj->SetNumberField(TEXT("count"), static_cast<double>(Totals.Count));
+  Obj->SetNumberField(TEXT("bytes"), static_cast<double>(Totals.Bytes));
+  Obj->SetNumberField(TEXT("systemBytes"), static_cast<double>(Totals.SystemBytes));
+  Obj->SetNumberField(TEXT("videoBytes"), static_cast<double>(Totals.VideoBytes));
+  return Obj;
+}
+
+TSharedPtr<FJsonObject> MemoryDeltaJson(const FString &Class,
+                                        const FMemoryTotals &Current,
+                                        const FMemoryTotals &Previous) {
+  TSharedPtr<FJsonObject> Obj = MakeShared<FJsonObject>();
+  if (!Class.IsEmpty()) {
+    Obj->SetStringField(TEXT("class"), Class);
+  }
+  Obj->SetNumberField(TEXT("count"), static_cast<double>(Current.Count));
+  Obj->SetNumberField(TEXT("countDelta"), static_cast<double>(Current.Count - Previous.Count));
+  Obj->SetNumberField(TEXT("bytes"), static_cast<double>(Current.Bytes));
+  Obj->SetNumberField(TEXT("bytesDelta"), static_cast<double>(Current.Bytes - Previous.Bytes));
+  return Obj;
+}
+
+TSharedPtr<FJsonObject> MemorySnapshotDiff(const FMemorySnapshotState &State,
+                                           const FStoredMemorySnapshot &Current,
+                                           const FStoredMemorySnapshot &Baseline) {
+  struct FClassDelta {
+    const FString *Class = nullptr;
+    FMemoryTotals Current;
+    FMemoryTotals Previous;
+  };
+  TArray<FClassDelta> Deltas;
+  int32 NewClasses = 0;
+  int32 GoneClasses = 0;
+  for (const TPair<FString, FMemoryTotals> &Entry : Current.Classes) {
+    const FMemoryTotals *Previous = Baseline.Classes.Find(Entry.Key);
+    NewClasses += Previous ? 0 : 1;
+    const FMemoryTotals Before = Previous ? *Previous : FMemoryTotals();
+    if (Entry.Value.Count != Before.Count || Entry.Value.Bytes != Before.Bytes) {
+      Deltas.Add({&Entry.Key, Entry.Value, Before});
+    }
+  }
+  for (const TPair<FString, FMemoryTotals> &Entry : Baseline.Classes) {
+    if (!Current.Classes.Contains(Entry.Key)) {
+      ++GoneClasses;
+      Deltas.Add({&Entry.Key, FMemoryTotals(), Entry.Value});
+    }
+  }
+  const bool bByCount = State.Options.bSortByCount;
+  Deltas.Sort([bByCount](const FClassDelta &A, const FClassDelta &B) {
+    const int64 DeltaA = bByCount ? A.Current.Count - A.Previous.Count
+                                  : A.Current.Bytes - A.Previous.Bytes;
+    const int64 DeltaB = bByCount ? B.Current.Count - B.Previous.Count
+                                  : B.Current.Bytes - B.Previous.Bytes;
+    return FMath::Abs(DeltaA) > FMath::Abs(DeltaB);
+  });
+
+  TSharedPtr<FJsonObject> Diff = MakeShared<FJsonObject>();
+  Diff->SetStringField(TEXT("baselineId"), Baseline.Id);
+  Diff->SetNumberField(TEXT("secondsSinceBaseline"),
+                       Current.CapturedSeconds - Baseline.CapturedSeconds);
+  Diff->SetObjectField(TEXT("totals"),
+                       MemoryDeltaJson(FString(), Current.Totals, Baseline.Totals));
+  Diff->SetNumberField(TEXT("changedClasses"), Deltas.Num());
+  Diff->SetNumberField(TEXT("newClasses"), NewClasses);
+  Diff->SetNumberField(TEXT("goneClasses"), GoneClasses);
+  TArray<TSharedPtr<FJsonValue>> Classes;
+  for (int32 Index = 0; Index < FMath::Min(Deltas.Num(), State.Options.TopN); ++Index) {
+    const FClassDelta &Delta = Deltas[Index];
+    Classes.Add(MakeShared<FJsonValueObject>(
+        MemoryDeltaJson(*Delta.Class, Delta.Current, Delta.Previous)));
+  }
+  Diff->SetArrayField(TEXT("classes"), Classes);
+  return Diff;
+}
+
+TSharedPtr<FJsonObject> MemorySnapshotStreamingJson() {
+  TSharedPtr<FJsonObject> Obj = MakeShared<FJsonObject>();
+  IRenderAssetStreamingManager &Streaming =
+      IStreamingManager::Get().GetRenderAssetStreamingManager();
+  Obj->SetNumberField(TEXT("poolBytes"), static_cast<double>(Streaming.GetPoolSize()));
+  Obj->SetNumberField(TEXT("overBudgetBytes"),
+                      static_cast<double>(Streaming.GetMemoryOverBudget()));
+  Obj->SetNumberField(TEXT("maxEverRequiredBytes"),
+                      static_cast<double>(Streaming.GetMaxEverRequired()));
+  if (IConsoleVariable *NanitePool = IConsoleManager::Get().FindConsoleVariable(
+          TEXT("r.Nanite.Streaming.StreamingPoolSize"))) {
+    Obj->SetNumberField(TEXT("nanitePoolMb"), NanitePool->GetInt());
+  }
+  return Obj;
+}
+
+TSharedPtr<FJsonObject> MemorySnapshotRhiJson() {
+  FTextureMemoryStats Stats;
+  RHIGetTextureMemoryStats(Stats);
+  TSharedPtr<FJsonObject> Obj = MakeShared<FJsonObject>();
+  Obj->SetBoolField(TEXT("hardwareStatsValid"), Stats.AreHardwareStatsValid());
+  Obj->SetNumberField(TEXT("dedicatedVideoBytes"), static_cast<double>(Stats.DedicatedVideoMemory));
+  Obj->SetNumberField(TEXT("dedicatedSystemBytes"), static_cast<double>(Stats.DedicatedSystemMemory));
+  Obj->SetNumberField(TEXT("sharedSystemBytes"), static_cast<double>(Stats.SharedSystemMemory));
+  Obj->SetNumberField(TEXT("totalGraphicsBytes"), static_cast<double>(Stats.TotalGraphicsMemory));
+  Obj->SetNumberField(TEXT("streamingBytes"), static_cast<double>(Stats.StreamingMemorySize));
+  Obj->SetNumberField(TEXT("nonStreamingBytes"), static_cast<double>(Stats.NonStreamingMemorySize));
+  Obj->SetNumberField(TEXT("texturePoolBytes"), static_cast<double>(Stats.TexturePoolSize));
+  Obj->SetBoolField(TEXT("limitedPool"), Stats.IsUsingLimitedPoolSize());
+  return Obj;
+}
+
+TSharedPtr<FJsonObject> MemorySnapshotProcessJson() {
+  const FPlatformMemoryStats Memory = FPlatformMemory::GetStats();
+  TSharedPtr<FJsonObject> Obj = MakeShared<FJsonObject>();
+  Obj->SetNumberField(TEXT("usedPhysicalBytes"), static_cast<double>(Memory.UsedPhysical));
+  Obj->SetNumberField(TEXT("peakUsedPhysicalBytes"), static_cast<double>(Memory.PeakUsedPhysical));
+  Obj->SetNumberField(TEXT("usedVirtualBytes"), static_cast<double>(Memory.UsedVirtual));
+  Obj->SetNumberField(TEXT("availablePhysicalBytes"), static_cast<double>(Memory.AvailablePhysical));
+  return Obj;
+}
+
+void FinishMemorySnapshot(const FMemorySnapshotStateRef &State, bool bCancelled) {
+  State->bFinished = true;
+  FCoreUObjectDelegates::GetPostGarbageCollect().Remove(State->GcHandle);
+
+  TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+  Result->SetNumberField(TEXT("frames"), State->Frames);
+  Result->SetNumberField(TEXT("scanMs"), State->WorkSeconds * 1000.0);
+  Result->SetNumberField(TEXT("elapsedMs"),
+                         (FPlatformTime::Seconds() - State->StartSeconds) * 1000.0);
+  if (bCancelled) {
+    Result->SetBoolField(TEXT("cancelled"), true);
+    Result->SetNumberField(TEXT("objectsWalked"), State->NextIndex);
+    State->OnFinished(Result);
+    return;
+  }
+
+  FStoredMemorySnapshot Stored;
+  Stored.Id = FString::Printf(TEXT("mem-%d"), GNextMemorySnapshotId++);
+  Stored.CapturedSeconds = FPlatformTime::Seconds();
+  Stored.Totals = State->Totals;
+  Stored.Classes.Reserve(State->Classes.Num());
+  for (const TPair<FString, FMemoryTotals> &Entry : State->Classes) {
+    Stored.Classes.Add(Entry.Key, Entry.Value);
+  }
+
+  const bool bByCount = State->Options.bSortByCount;
+  TArray<TPair<FString, FMemoryTotals>> &Sorted = State->Classes;
+  Sorted.Sort([bByCount](const TPair<FString, FMemoryTotals> &A,
+                         const TPair<FString, FMemoryTotals> &B) {
+    return bByCount ? A.Value.Count > B.Value.Count : A.Value.Bytes > B.Value.Bytes;
+  });
+  TArray<TSharedPtr<FJsonValue>> Top;
+  for (int32 Index = 0; Index < FMath::Min(Sorted.Num(), State->Options.TopN); ++Index) {
+    TSharedPtr<FJsonObject> Entry = MemoryTotalsJson(Sorted[Index].Value);
+    Entry->SetStringField(TEXT("class"), Sorted[Index].Key);
+    Top.Add(MakeShared<FJsonValueObject>(Entry));
+  }
+
+  Result->SetStringField(TEXT("id"), Stored.Id);
+  Result->SetNumberField(TEXT("objects"), static_cast<double>(State->Totals.Count));
+  Result->SetNumberField(TEXT("classes"), Sorted.Num());
+  Result->SetStringField(TEXT("sortBy"), bByCount ? TEXT("count") : TEXT("bytes"));
+  Result->SetStringField(TEXT("resourceSizeMode"),
+                         State->Options.bEstimatedTotal ? TEXT("estimatedTotal") : TEXT("exclusive"));
+  Result->SetObjectField(TEXT("totals"), MemoryTotalsJson(State->Totals));
+  Result->SetArrayField(TEXT("top"), Top);
+  Result->SetObjectField(TEXT("textures"), MemoryTotalsJson(State->Textures));
+  TSharedPtr<FJsonObject> Meshes = MakeShared<FJsonObject>();
+  Meshes->SetObjectField(TEXT("static"), MemoryTotalsJson(State->StaticMeshes));
+  Meshes->SetObjectField(TEXT("skeletal"), MemoryTotalsJson(State->SkeletalMeshes));
+  Result->SetObjectField(TEXT("meshes"), Meshes);
+  Result->SetObjectField(TEXT("streaming"), MemorySnapshotStreamingJson());
+  Result->SetObjectField(TEXT("rhi"), MemorySnapshotRhiJson());
+  Result->SetObjectField(TEXT("process"), MemorySnapshotProcessJson());
+  // Objects created or freed by a GC between slices shift the walk; totals
+  // are then approximate, which is what a leak hunt needs anyway.
+  Result->SetNumberField(TEXT("gcDuringScan"), State->GcPasses);
+  if (!State->Options.DiffWith.IsEmpty()) {
+    if (const FStoredMemorySnapshot *Baseline =
+            FindStoredMemorySnapshot(State->Options.DiffWith)) {
+      Result->SetObjectField(TEXT("diff"), MemorySnapshotDiff(*State, Stored, *Baseline));
+    } else {
+      Result->SetStringField(TEXT("diffError"),
+                             FString::Printf(TEXT("Snapshot '%s' is no longer stored"),
+                                             *State->Options.DiffWith));
+    }
+  }
+
+  if (GStoredMemorySnapshots.Num() >= MaxStoredMemorySnapshots) {
+    GStoredMemorySnapshots.RemoveAt(0);
+  }
+  GStoredMemorySnapshots.Add(MoveTemp(Stored));
+  State->OnFinished(Result);
+}
+
+bool TickMemorySnapshot(const FMemorySnapshotStateRef &State, float) {
+  if (State->bFinished) {
+    return false;
+  }
+  const double SliceStart = FPlatformTime::Seconds();
+  const double SliceEnd = SliceStart + State->Options.BudgetMs / 1000.0;
+  const int32 EndIndex = FMath::Min(State->EndIndex, GUObjectArray.GetObjectArrayNum());
+  while (State->NextIndex < EndIndex) {
+    const int32 ChunkEnd =
+        FMath::Min(State->NextIndex + MemorySnapshotObjectsPerTimeCheck, EndIndex);
+    for (; State->NextIndex < ChunkEnd; ++State->NextIndex) {
+      FUObjectItem *Item = GUObjectArray.IndexToObject(State->NextIndex);
+      if (!Item || !Item->Object || Item->IsUnreachable()) {
+        continue;
+      }
+      UObject *Object = static_cast<UObject *>(Item->Object);
+      if (IsValid(Object)) {
+        ScanMemorySnapshotObject(*State, Object);
+      }
+    }
+    if (FPlatformTime::Seconds() >= SliceEnd) {
+      break;
+    }
+  }
+  const double Now = FPlatformTime::Seconds();
+  State->WorkSeconds += Now - SliceStart;
+  ++State->Frames;
+
+  if (State->NextIndex >= EndIndex) {
+    FinishMemorySnapshot(State, /*bCancelled=*/false);
+    return false;
+  }
+  if (State->OnProgress && Now - State->LastProgressSeconds >= MemorySnapshotProgressSeconds) {
+    State->LastProgressSeconds = Now;
+    const float Percent = 100.0f * State->NextIndex / FMath::Max(1, EndIndex);
+    if (!State->OnProgress(Percent)) {
+      FinishMemorySnapshot(State, /*bCancelled=*/true);
+      return false;
+    }
+  }
+  return true;
+}
+} // namespace
+
+bool FMcpMemorySnapshot::IsRunning() {
+  const TSharedPtr<FMemorySnapshotState> Active = GActiveMemorySnapshot.Pin();
+  return Active.IsValid() && !Active->bFinished;
+}
+
+bool FMcpMemorySnapshot::HasSnapshot(const FString &Id) {
+  return FindStoredMemorySnapshot(Id) != nullptr;
+}
+
+bool FMcpMemorySnapshot::Start(
+    FMcpMemorySnapshotOptions Options, TFunction<bool(float Percent)> OnProgress,
+    TFunction<void(const TSharedPtr<FJsonObject> &Result)> OnFinished,
+    FString &OutError) {
+  check(IsInGameThread());
+  if (IsRunning()) {
+    OutError = TEXT("A memory snapshot is already running");
+    return false;
+  }
+  if (!Options.DiffWith.IsEmpty() && !HasSnapshot(Options.DiffWith)) {
+    OutError = FString::Printf(TEXT("No stored memory snapshot '%s'"), *Options.DiffWith);
+    return false;
+  }
+
+  FMemorySnapshotStateRef State = MakeShared<FMemorySnapshotState>();
+  Options.TopN = FMath::Clamp(Options.TopN, 1, 1000);
+  Options.BudgetMs = FMath::Clamp(Options.BudgetMs, 0.5, 100.0);
+  State->Options = MoveTemp(Options);
+  State->EndIndex = GUObjectArray.GetObjectArrayNum();
+  State->StartSeconds = FPlatformTime::Seconds();
+  State->LastProgressSeconds = State->StartSeconds;
+  State->OnProgress = MoveTemp(OnProgress);
+  State->OnFinished = MoveTemp(OnFinished);
+  TWeakPtr<FMemorySnapshotState> WeakState = State;
+  State->GcHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddLambda([WeakState]() {
+    if (const TSharedPtr<FMemorySnapshotState> Pinned = WeakState.Pin()) {
+      ++Pinned->GcPasses;
+      Pinned->ClassSlots.Reset();
+    }
+  });
+  GActiveMemorySnapshot = State;
+
+  FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+      [State](float DeltaTime) { return TickMemorySnapshot(State, DeltaTime); }));
+  return true;
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "Templates/Function.h"
+
+/** What memory_snapshot measures and how much of each frame it may spend doing so. */
+struct FMcpMemorySnapshotOptions
+{
+    /** Classes listed in "top" (and in "diff.classes"). */
+    int32 TopN = 50;
+    /** Order by object count instead of resource bytes. */
+    bool bSortByCount = false;
+    /** Game-thread milliseconds spent walking objects per frame. */
+    double BudgetMs = 4.0;
+    /** GetResourceSizeEx in EstimatedTotal mode (includes referenced sub-objects; can double count). */
+    bool bEstimatedTotal = false;
+    /** Id of an earlier snapshot to diff against; empty for none. */
+    FString DiffWith;
+};
+
+/**
+ * A structured replacement for memreport: walks every live UObject a slice per frame, summing
+ * object counts and GetResourceSizeEx bytes (system and video) per class, with texture and mesh
+ * totals, the render-asset streaming pool and the RHI texture memory stats on top. The per-class
+ * totals of the last few snapshots are kept in memory under their id so a later snapshot can be
+ * diffed against one to find what grew. One snapshot at a time; game thread only.
+ */
+class FMcpMemorySnapshot
+{
+public:
+    /**
+     * Starts a snapshot. OnProgress runs about twice a second with the percent of objects walked
+     * and cancels the snapshot by returning false; OnFinished runs once with the result: id,
+     * objects, classes, totals, top, textures, meshes, streaming, rhi, process, frames, scanMs,
+     * gcDuringScan, diff when DiffWith was set, and "cancelled" when it was cut short (a cancelled
+     * snapshot is not stored).
+     * Returns false with OutError, calling neither, when it cannot start.
+     */
+    static bool Start(FMcpMemorySnapshotOptions Options, TFunction<bool(float Percent)> OnProgress,
+        TFunction<void(const TSharedPtr<FJsonObject>& Result)> OnFinished, FString& OutError);
+
+    static bool IsRunning();
+
+    /** Whether a snapshot with this id is still stored. */
+    static bool HasSnapshot(const FString& Id);
+};
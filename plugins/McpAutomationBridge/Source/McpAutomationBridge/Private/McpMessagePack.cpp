@@ -0,0 +1,541 @@
+#include "McpMessagePack.h"
+
+#include "Containers/StringConv.h"
+#include "Misc/Base64.h"
+
+namespace {
+// Nesting limit for decode; the recursion depth grows with it.
+constexpr int32 MsgPackMaxDepth = 64;
+
+class FMsgPackWriter {
+public:
+  explicit FMsgPackWriter(TArray<uint8> &InOut) : Out(InOut) {}
+
+  void WriteValue(const TSharedPtr<FJsonValue> &Value) {
+    if (!Value.IsValid()) {
+      Out.Add(0xc0);
+      return;
+    }
+    switch (Value->Type) {
+    case EJson::Null:
+    case EJson::None:
+      Out.Add(0xc0);
+      break;
+    case EJson::Boolean:
+      Out.Add(Value->AsBool() ? 0xc3 : 0xc2);
+      break;
+    case EJson::Number:
+      WriteNumber(Value->AsNumber());
+      break;
+    case EJson::String:
+      WriteString(Value->AsString());
+      break;
+    case EJson::Array: {
+      const TArray<TSharedPtr<FJsonValue>> &Items = Value->AsArray();
+      WriteLength(Items.Num(), 0x90, 15, 0xdc, 0xdd);
+      for (const TSharedPtr<FJsonValue> &Item : Items) {
+        WriteValue(Item);
+      }
+      break;
+    }
+    case EJson::Object:
+      WriteObject(Value->AsObject());
+      break;
+    }
+  }
+
+  void WriteObject(const TSharedPtr<FJsonObject> &Object) {
+    if (!Object.IsValid()) {
+      Out.Add(0xc0);
+      return;
+    }
+    if (TryWriteExtension(*Object)) {
+      return;
+    }
+    WriteLength(Object->Values.Num(), 0x80, 15, 0xde, 0xdf);
+    for (const TPair<FString, TSharedPtr<FJsonValue>> &Pair : Object->Values) {
+      WriteString(Pair.Key);
+      WriteValue(Pair.Value);
+    }
+  }
+
+private:
+  static bool ReadComponents(const FJsonObject &Object, const TCHAR *A,
+                             const TCHAR *B, const TCHAR *C, double *OutValues) {
+    if (Object.Values.Num() != 3) {
+      return false;
+    }
+    const TCHAR *Names[3] = {A, B, C};
+    for (int32 Index = 0; Index < 3; ++Index) {
+      const TSharedPtr<FJsonValue> *Found = Object.Values.Find(Names[Index]);
+      if (!Found || !Found->IsValid() || (*Found)->Type != EJson::Number) {
+        return false;
+      }
+      OutValues[Index] = (*Found)->AsNumber();
+    }
+    return true;
+  }
+
+  static bool ReadNestedComponents(const FJsonObject &Object,
+                                   const TCHAR *Field, const TCHAR *A,
+                                   const TCHAR *B, const TCHAR *C,
+                                   double *OutValues) {
+    const TSharedPtr<FJsonValue> *Found = Object.Values.Find(Field);
+    return Found && Found->IsValid() && (*Found)->Type == EJson::Object &&
+           ReadComponents(*(*Found)->AsObject(), A, B, C, OutValues);
+  }
+
+  bool TryWriteExtension(const FJsonObject &Object) {
+    double Values[9];
+    if (ReadComponents(Object, TEXT("x"), TEXT("y"), TEXT("z"), Values)) {
+      WriteExtension(FMcpMessagePack::ExtVector, Values, 3);
+      return true;
+    }
+    if (ReadComponents(Object, TEXT("pitch"), TEXT("yaw"), TEXT("roll"),
+                       Values)) {
+      WriteExtension(FMcpMessagePack::ExtRotator, Values, 3);
+      return true;
+    }
+    if (Object.Values.Num() == 3 &&
+        ReadNestedComponents(Object, TEXT("location"), TEXT("x"), TEXT("y"),
+                             TEXT("z"), Values) &&
+        ReadNestedComponents(Object, TEXT("rotation"), TEXT("pitch"),
+                             TEXT("yaw"), TEXT("roll"), Values + 3) &&
+        ReadNestedComponents(Object, TEXT("scale"), TEXT("x"), TEXT("y"),
+                             TEXT("z"), Values + 6)) {
+      WriteExtension(FMcpMessagePack::ExtTransform, Values, 9);
+      return true;
+    }
+    return false;
+  }
+
+  void WriteExtension(int8 Type, const double *Values, int32 Count) {
+    // ext 8: c7 <len> <type> <payload>
+    Out.Add(0xc7);
+    Out.Add(static_cast<uint8>(Count * 8));
+    Out.Add(static_cast<uint8>(Type));
+    for (int32 Index = 0; Index < Count; ++Index) {
+      WriteDouble(Values[Index]);
+    }
+  }
+
+  void WriteNumber(double Value) {
+    // Integral values take the compact integer forms; JSON has no separate
+    // integer type, so the decoder turns both back into doubles.
+    if (FMath::IsFinite(Value) && Value == FMath::FloorToDouble(Value) &&
+        Value >= -9.2233720368547758e18 && Value < 9.2233720368547758e18) {
+      WriteInteger(static_cast<int64>(Value));
+      return;
+    }
+    Out.Add(0xcb);
+    WriteDouble(Value);
+  }
+
+  void WriteInteger(int64 Value) {
+    if (Value >= 0) {
+      if (Value <= 0x7f) {
+        Out.Add(static_cast<uint8>(Value));
+      } else if (Value <= 0xff) {
+        Out.Add(0xcc);
+        WriteBigEndian(static_cast<uint64>(Value), 1);
+      } else if (Value <= 0xffff) {
+        Out.Add(0xcd);
+        WriteBigEndian(static_cast<uint64>(Value), 2);
+      } else if (Value <= 0xffffffffll) {
+        Out.Add(0xce);
+        WriteBigEndian(static_cast<uint64>(Value), 4);
+      } else {
+        Out.Add(0xcf);
+        WriteBigEndian(static_cast<uint64>(Value), 8);
+      }
+      return;
+    }
+    if (Value >= -32) {
+      Out.Add(static_cast<uint8>(static_cast<int8>(Value)));
+    } else if (Value >= -128) {
+      Out.Add(0xd0);
+      WriteBigEndian(static_cast<uint64>(Value), 1);
+    } else if (Value >= -32768) {
+      Out.Add(0xd1);
+      WriteBigEndian(static_cast<uint64>(Value), 2);
+    } else if (Value >= -2147483648ll) {
+      Out.Add(0xd2);
+      WriteBigEndian(static_cast<uint64>(Value), 4);
+    } else {
+      Out.Add(0xd3);
+      WriteBigEndian(static_cast<uint64>(Value), 8);
+    }
+  }
+
+  void WriteDouble(double Value) {
+    uint64 Bits = 0;
+    FMemory::Memcpy(&Bits, &Value, sizeof(Bits));
+    WriteBigEndian(Bits, 8);
+  }
+
+  void WriteString(const FString &Value) {
+    const FTCHARToUTF8 Utf8(*Value, Value.Len());
+    const int32 Len = Utf8.Length();
+    if (Len <= 31) {
+      Out.Add(static_cast<uint8>(0xa0 | Len));
+    } else {
+      WriteLength(Len, 0, 0, 0xda, 0xdb, 0xd9);
+    }
+    Out.Append(reinterpret_cast<const uint8 *>(Utf8.Get()), Len);
+  }
+
+  /** fix form when Len <= FixMax, else the 8 (if any) / 16 / 32-bit forms. */
+  void WriteLength(int32 Len, uint8 FixBase, int32 FixMax, uint8 Marker16,
+                   uint8 Marker32, uint8 Marker8 = 0) {
+    if (FixBase != 0 && Len <= FixMax) {
+      Out.Add(static_cast<uint8>(FixBase | Len));
+    } else if (Marker8 != 0 && Len <= 0xff) {
+      Out.Add(Marker8);
+      WriteBigEndian(static_cast<uint64>(Len), 1);
+    } else if (Len <= 0xffff) {
+      Out.Add(Marker16);
+      WriteBigEndian(static_cast<uint64>(Len), 2);
+    } else {
+      Out.Add(Marker32);
+      WriteBigEndian(static_cast<uint64>(Len), 4);
+    }
+  }
+
+  void WriteBigEndian(uint64 Value, int32 Bytes) {
+    for (int32 Shift = (Bytes - 1) * 8; Shift >= 0; Shift -= 8) {
+      Out.Add(static_cast<uint8>(Value >> Shift));
+    }
+  }
+
+  TArray<uint8> &Out;
+};
+
+class FMsgPackReader {
+public:
+  explicit FMsgPackReader(TArrayView<const uint8> InData) : Data(InData) {}
+
+  TSharedPtr<FJsonValue> ReadValue(int32 Depth) {
+    if (Depth > MsgPackMaxDepth) {
+      return Fail(TEXT("nesting too deep"));
+    }
+    uint8 Marker = 0;
+    if (!ReadByte(Marker)) {
+      return nullptr;
+    }
+
+    if (Marker <= 0x7f) {
+      return MakeShared<FJsonValueNumber>(Marker);
+    }
+    if (Marker >= 0xe0) {
+      return MakeShared<FJsonValueNumber>(static_cast<int8>(Marker));
+    }
+    if (Marker >= 0xa0 && Marker <= 0xbf) {
+      return ReadString(Marker & 0x1f);
+    }
+    if (Marker >= 0x90 && Marker <= 0x9f) {
+      return ReadArray(Marker & 0x0f, Depth);
+    }
+    if (Marker >= 0x80 && Marker <= 0x8f) {
+      return ReadMap(Marker & 0x0f, Depth);
+    }
+
+    uint64 Raw = 0;
+    switch (Marker) {
+    case 0xc0:
+      return MakeShared<FJsonValueNull>();
+    case 0xc2:
+      return MakeShared<FJsonValueBoolean>(false);
+    case 0xc3:
+      return MakeShared<FJsonValueBoolean>(true);
+    case 0xcc:
+    case 0xcd:
+    case 0xce:
+    case 0xcf:
+      if (!ReadBigEndian(1 << (Marker - 0xcc), Raw)) {
+        return nullptr;
+      }
+      return MakeShared<FJsonValueNumber>(static_cast<double>(Raw));
+    case 0xd0:
+    case 0xd1:
+    case 0xd2:
+    case 0xd3: {
+      const int32 Bytes = 1 << (Marker - 0xd0);
+      if (!ReadBigEndian(Bytes, Raw)) {
+        return nullptr;
+      }
+      // Sign-extend from the encoded width.
+      const int32 Unused = 64 - Bytes * 8;
+      const int64 Signed = static_cast<int64>(Raw << Unused) >> Unused;
+      return MakeShared<FJsonValueNumber>(static_cast<double>(Signed));
+    }
+    case 0xca: {
+      if (!ReadBigEndian(4, Raw)) {
+        return nullptr;
+      }
+      const uint32 Bits = static_cast<uint32>(Raw);
+      float Value = 0.0f;
+      FMemory::Memcpy(&Value, &Bits, sizeof(Value));
+      return MakeShared<FJsonValueNumber>(Value);
+    }
+    case 0xcb: {
+      double Value = 0.0;
+      if (!ReadDouble(Value)) {
+        return nullptr;
+      }
+      return MakeShared<FJsonValueNumber>(Value);
+    }
+    case 0xd9:
+    case 0xda:
+    case 0xdb:
+      if (!ReadBigEndian(1 << (Marker - 0xd9), Raw)) {
+        return nullptr;
+      }
+      return ReadString(Raw);
+    case 0xc4:
+    case 0xc5:
+    case 0xc6:
+      if (!ReadBigEndian(1 << (Marker - 0xc4), Raw)) {
+        return nullptr;
+      }
+      return ReadBinary(Raw);
+    case 0xdc:
+    case 0xdd:
+      if (!ReadBigEndian(Marker == 0xdc ? 2 : 4, Raw)) {
+        return nullptr;
+      }
+      return ReadArray(Raw, Depth);
+    case 0xde:
+    case 0xdf:
+      if (!ReadBigEndian(Marker == 0xde ? 2 : 4, Raw)) {
+        return nullptr;
+      }
+      return ReadMap(Raw, Depth);
+    case 0xd4:
+    case 0xd5:
+    case 0xd6:
+    case 0xd7:
+    case 0xd8:
+      return ReadExtension(1ull << (Marker - 0xd4));
+    case 0xc7:
+    case 0xc8:
+    case 0xc9:
+      if (!ReadBigEndian(1 << (Marker - 0xc7), Raw)) {
+        return nullptr;
+      }
+      return ReadExtension(Raw);
+    default:
+      return Fail(TEXT("unsupported type marker"));
+    }
+  }
+
+  bool IsAtEnd() const { return Pos == Data.Num(); }
+
+  FString Error;
+
+private:
+  TSharedPtr<FJsonValue> Fail(const TCHAR *Reason) {
+    if (Error.IsEmpty()) {
+      Error = FString::Printf(TEXT("%s at byte %d"), Reason, Pos);
+    }
+    return nullptr;
+  }
+
+  int64 Remaining() const { return Data.Num() - Pos; }
+
+  bool ReadByte(uint8 &Out) {
+    if (Remaining() < 1) {
+      Fail(TEXT("truncated input"));
+      return false;
+    }
+    Out = Data[Pos++];
+    return true;
+  }
+
+  bool ReadBigEndian(int32 Bytes, uint64 &Out) {
+    if (Remaining() < Bytes) {
+      Fail(TEXT("truncated input"));
+      return false;
+    }
+    Out = 0;
+    for (int32 Index = 0; Index < Bytes; ++Index) {
+      Out = (Out << 8) | Data[Pos++];
+    }
+    return true;
+  }
+
+  bool ReadDouble(double &Out) {
+    uint64 Bits = 0;
+    if (!ReadBigEndian(8, Bits)) {
+      return false;
+    }
+    FMemory::Memcpy(&Out, &Bits, sizeof(Out));
+    return true;
+  }
+
+  bool ReadStringBytes(uint64 Len, FString &Out) {
+    if (static_cast<uint64>(Remaining()) < Len) {
+      Fail(TEXT("truncated string"));
+      return false;
+    }
+    const FUTF8ToTCHAR Converted(
+        reinterpret_cast<const ANSICHAR *>(Data.GetData() + Pos),
+        static_cast<int32>(Len));
+    Out = FString(Converted.Length(), Converted.Get());
+    Pos += static_cast<int32>(Len);
+    return true;
+  }
+
+  TSharedPtr<FJsonValue> ReadString(uint64 Len) {
+    FString Value;
+    if (!ReadStringBytes(Len, Value)) {
+      return nullptr;
+    }
+    return MakeShared<FJsonValueString>(MoveTemp(Value));
+  }
+
+  // JSON has no byte type; binary becomes base64 text, matching how
+  // attachments are inlined for clients without the binary channel.
+  TSharedPtr<FJsonValue> ReadBinary(uint64 Len) {
+    if (static_cast<uint64>(Remaining()) < Len) {
+      return Fail(TEXT("truncated binary"));
+    }
+    TArray<uint8> Bytes(Data.GetData() + Pos, static_cast<int32>(Len));
+    Pos += static_cast<int32>(Len);
+    return MakeShared<FJsonValueString>(FBase64::Encode(Bytes));
+  }
+
+  TSharedPtr<FJsonValue> ReadArray(uint64 Count, int32 Depth) {
+    // Every element takes at least one byte, which bounds the reservation.
+    if (Count > static_cast<uint64>(Remaining())) {
+      return Fail(TEXT("array longer than input"));
+    }
+    TArray<TSharedPtr<FJsonValue>> Items;
+    Items.Reserve(static_cast<int32>(Count));
+    for (uint64 Index = 0; Index < Count; ++Index) {
+      TSharedPtr<FJsonValue> Item = ReadValue(Depth + 1);
+      if (!Item.IsValid()) {
+        return nullptr;
+      }
+      Items.Add(MoveTemp(Item));
+    }
+    return MakeShared<FJsonValueArray>(Items);
+  }
+
+  TSharedPtr<FJsonValue> ReadMap(uint64 Count, int32 Depth) {
+    if (Count * 2 > static_cast<uint64>(Remaining())) {
+      return Fail(TEXT("map longer than input"));
+    }
+    TSharedPtr<FJsonObject> Object = MakeShared<FJsonObject>();
+    for (uint64 Index = 0; Index < Count; ++Index) {
+      uint8 KeyMarker = 0;
+      if (!ReadByte(KeyMarker)) {
+        return nullptr;
+      }
+      uint64 KeyLen = 0;
+      if (KeyMarker >= 0xa0 && KeyMarker <= 0xbf) {
+        KeyLen = KeyMarker & 0x1f;
+      } else if (KeyMarker >= 0xd9 && KeyMarker <= 0xdb) {
+        if (!ReadBigEndian(1 << (KeyMarker - 0xd9), KeyLen)) {
+          return nullptr;
+        }
+      } else {
+        return Fail(TEXT("map key is not a string"));
+      }
+      FString Key;
+      if (!ReadStringBytes(KeyLen, Key)) {
+        return nullptr;
+      }
+      TSharedPtr<FJsonValue> Value = ReadValue(Depth + 1);
+      if (!Value.IsValid()) {
+        return nullptr;
+      }
+      Object->Values.Add(MoveTemp(Key), MoveTemp(Value));
+    }
+    return MakeShared<FJsonValueObject>(Object);
+  }
+
+  TSharedPtr<FJsonValue> ReadExtension(uint64 Len) {
+    uint8 Type = 0;
+    if (!ReadByte(Type)) {
+      return nullptr;
+    }
+    if (static_cast<uint64>(Remaining()) < Len) {
+      return Fail(TEXT("truncated extension"));
+    }
+    const int8 ExtType = static_cast<int8>(Type);
+    const int32 Expected = ExtType == FMcpMessagePack::ExtTransform ? 72 : 24;
+    if ((ExtType != FMcpMessagePack::ExtVector &&
+         ExtType != FMcpMessagePack::ExtRotator &&
+         ExtType != FMcpMessagePack::ExtTransform) ||
+        Len != static_cast<uint64>(Expected)) {
+      return Fail(TEXT("unknown extension type"));
+    }
+
+    double Values[9];
+    for (int32 Index = 0; Index < Expected / 8; ++Index) {
+      ReadDouble(Values[Index]);
+    }
+    if (ExtType == FMcpMessagePack::ExtVector) {
+      return MakeShared<FJsonValueObject>(
+          MakeComponents(TEXT("x"), TEXT("y"), TEXT("z"), Values));
+    }
+    if (ExtType == FMcpMessagePack::ExtRotator) {
+      return MakeShared<FJsonValueObject>(
+          MakeComponents(TEXT("pitch"), TEXT("yaw"), TEXT("roll"), Values));
+    }
+    TSharedPtr<FJsonObject> Transform = MakeShared<FJsonObject>();
+    Transform->SetObjectField(
+        TEXT("location"), MakeComponents(TEXT("x"), TEXT("y"), TEXT("z"), Values));
+    Transform->SetObjectField(TEXT("rotation"),
+                              MakeComponents(TEXT("pitch"), TEXT("yaw"),
+                                             TEXT("roll"), Values + 3));
+    Transform->SetObjectField(
+        TEXT("scale"),
+        MakeComponents(TEXT("x"), TEXT("y"), TEXT("z"), Values + 6));
+    return MakeShared<FJsonValueObject>(Transform);
+  }
+
+  static TSharedPtr<FJsonObject> MakeComponents(const TCHAR *A, const TCHAR *B,
+                                                const TCHAR *C,
+                                                const double *Values) {
+    TSharedPtr<FJsonObject> Object = MakeShared<FJsonObject>();
+    Object->SetNumberField(A, Values[0]);
+    Object->SetNumberField(B, Values[1]);
+    Object->SetNumberField(C, Values[2]);
+    return Object;
+  }
+
+  TArrayView<const uint8> Data;
+  int32 Pos = 0;
+};
+} // namespace
+
+void FMcpMessagePack::Encode(const TSharedRef<FJsonObject> &Object,
+                             TArray<uint8> &Out) {
+  Out.Reset();
+  FMsgPackWriter Writer(Out);
+  Writer.WriteObject(Object);
+}
+
+TSharedPtr<FJsonObject>
+FMcpMessagePack::Decode(TArrayView<const uint8> Data, FString &OutError) {
+  if (!LooksLikeMessage(Data)) {
+    OutError = TEXT("message is not a MessagePack map");
+    return nullptr;
+  }
+  FMsgPackReader Reader(Data);
+  const TSharedPtr<FJsonValue> Root = Reader.ReadValue(0);
+  if (!Root.IsValid()) {
+    OutError = Reader.Error;
+    return nullptr;
+  }
+  if (!Reader.IsAtEnd()) {
+    OutError = TEXT("trailing bytes after message");
+    return nullptr;
+  }
+  if (Root->Type != EJson::Object) {
+    OutError = TEXT("message is not a map");
+    return nullptr;
+  }
+  return Root->AsObject();
+}
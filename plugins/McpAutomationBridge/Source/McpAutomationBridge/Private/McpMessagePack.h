@@ -0,0 +1,39 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+/**
+ * MessagePack codec for automation_request / automation_response bodies on sockets that
+ * negotiated the "msgpack" capability in bridge_hello. Converts to and from the same FJsonObject
+ * tree the JSON path uses, so handlers are unaware of the wire format. Vector-shaped objects use
+ * extension types holding raw float64 components instead of keyed maps of numbers:
+ *   ext 1  {x, y, z}                      3 x float64, big-endian
+ *   ext 2  {pitch, yaw, roll}             3 x float64
+ *   ext 3  {location, rotation, scale}    9 x float64 (vector, rotator, vector)
+ * The server's src/automation/msgpack.ts implements the same mapping.
+ */
+class FMcpMessagePack
+{
+public:
+    static constexpr int8 ExtVector = 1;
+    static constexpr int8 ExtRotator = 2;
+    static constexpr int8 ExtTransform = 3;
+
+    /** Appends the encoding of Object to Out (Out is reset first). */
+    static void Encode(const TSharedRef<FJsonObject>& Object, TArray<uint8>& Out);
+
+    /** Decodes one top-level map; returns null and fills OutError on malformed or truncated input. */
+    static TSharedPtr<FJsonObject> Decode(TArrayView<const uint8> Data, FString& OutError);
+
+    /** True when the first byte opens a map, which every bridge message is; attachment chunks start with "MCPA". */
+    static bool LooksLikeMessage(TArrayView<const uint8> Data)
+    {
+        if (Data.Num() == 0)
+        {
+            return false;
+        }
+        const uint8 First = Data[0];
+        return (First >= 0x80 && First <= 0x8f) || First == 0xde || First == 0xdf;
+    }
+};
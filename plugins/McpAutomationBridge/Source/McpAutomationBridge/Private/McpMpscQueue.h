@@ -0,0 +1,89 @@
+#pragma once
+
+#include "Containers/LockFreeFixedSizeAllocator.h"
+#include "HAL/PlatformMisc.h"
+#include "Templates/Atomic.h"
+#include "Templates/UnrealTemplate.h"
+
+/**
+ * Unbounded multi-producer / single-consumer FIFO after Dmitry Vyukov's node-based design.
+ * Producers enqueue with a single atomic exchange and never take a lock; nodes come from a
+ * lock-free fixed-size pool so steady-state traffic does not touch the general allocator.
+ * Dequeue and IsEmpty must only be called from one consumer thread at a time.
+ */
+template <typename ItemType>
+class TMcpMpscQueue
+{
+public:
+    TMcpMpscQueue()
+    {
+        Tail = NewNode();
+        Head = Tail;
+    }
+
+    ~TMcpMpscQueue()
+    {
+        ItemType Discarded;
+        while (Dequeue(Discarded))
+        {
+        }
+        FreeNode(Tail);
+    }
+
+    TMcpMpscQueue(const TMcpMpscQueue&) = delete;
+    TMcpMpscQueue& operator=(const TMcpMpscQueue&) = delete;
+
+    /** Safe from any thread. */
+    void Enqueue(ItemType&& Item)
+    {
+        FNode* Node = NewNode();
+        Node->Item = MoveTemp(Item);
+        FNode* Previous = Head.Exchange(Node);
+        Previous->Next = Node;
+    }
+
+    /**
+     * Consumer only. An item whose producer is still between its exchange and its link
+     * store is not visible yet; it is returned by a later call.
+     */
+    bool Dequeue(ItemType& OutItem)
+    {
+        FNode* Next = Tail->Next;
+        if (!Next)
+        {
+            return false;
+        }
+
+        // Next becomes the new stub; move its payload out so the stub holds no references.
+        OutItem = MoveTemp(Next->Item);
+        Next->Item = ItemType();
+        FNode* OldTail = Tail;
+        Tail = Next;
+        FreeNode(OldTail);
+        return true;
+    }
+
+    /** Consumer only. */
+    bool IsEmpty() const { return Tail->Next.Load() == nullptr; }
+
+private:
+    struct FNode
+    {
+        TAtomic<FNode*> Next{nullptr};
+        ItemType Item;
+    };
+
+    FNode* NewNode() { return new (Pool.Allocate()) FNode(); }
+
+    void FreeNode(FNode* Node)
+    {
+        Node->~FNode();
+        Pool.Free(Node);
+    }
+
+    /** Most recently enqueued node; shared by producers. */
+    TAtomic<FNode*> Head{nullptr};
+    /** Stub node owned by the consumer; its successor is the oldest item. */
+    FNode* Tail = nullptr;
+    TLockFreeFixedSizeAllocator<sizeof(FNode), PLATFORM_CACHE_LINE_SIZE> Pool;
+};
@@ -0,0 +1,319 @@
+#include "McpNavigationRebuild.h"
+
+#include "Containers/Ticker.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/Actor.h"
+#include "HAL/PlatformTime.h"
+#include "NavMesh/RecastNavMesh.h"
+#include "NavigationData.h"
+#include "NavigationSystem.h"
+#include "UObject/UObjectGlobals.h"
+#if __has_include("NavigationDirtyArea.h")
+#include "NavigationDirtyArea.h"
+#endif
+
+#if WITH_EDITOR
+#include "Editor.h"
+#endif
+
+namespace {
+// Past this many recorded actors their boxes collapse into one, so a
+// scripted sweep that touches everything still yields a bounded rebuild.
+constexpr int32 MaxNavDirtyActors = 4096;
+
+bool IsNavDirtyCandidate(const AActor *Actor) {
+  return Actor && !Actor->IsA<ANavigationData>() && !Actor->IsTemplate() &&
+         Actor->GetWorld() &&
+         Actor->GetWorld()->WorldType == EWorldType::Editor;
+}
+
+FBox NavDirtyBoundsOf(const AActor *Actor) {
+  return Actor->GetComponentsBoundingBox(/*bNonColliding=*/false);
+}
+
+// Greedily merges boxes until none overlap.
+TArray<FBox> MergeNavDirtyBoxes(TArray<FBox> Boxes) {
+  bool bMerged = true;
+  while (bMerged) {
+    bMerged = false;
+    for (int32 A = 0; A < Boxes.Num() && !bMerged; ++A) {
+      for (int32 B = A + 1; B < Boxes.Num(); ++B) {
+        if (Boxes[A].Intersect(Boxes[B])) {
+          Boxes[A] += Boxes[B];
+          Boxes.RemoveAtSwap(B);
+          bMerged = true;
+          break;
+        }
+      }
+    }
+  }
+  return Boxes;
+}
+
+struct FNavRebuildState {
+  TWeakObjectPtr<UWorld> World;
+  bool bFullBuild = false;
+  double StartSeconds = 0.0;
+  double TimeoutSeconds = 0.0;
+  TFunction<bool(int32, int32)> OnProgress;
+  TFunction<void(const FMcpNavRebuildResult &)> OnFinished;
+  FMcpNavRebuildResult Result;
+};
+using FNavRebuildStateRef = TSharedRef<FNavRebuildState>;
+
+int32 CountRemainingNavBuildTasks(UWorld *World) {
+  int32 Remaining = 0;
+  for (TActorIterator<ANavigationData> It(World); It; ++It) {
+    Remaining += It->GetNumRemainingBuildTasks();
+  }
+  return Remaining;
+}
+
+void FinishNavRebuild(const FNavRebuildStateRef &State, UWorld *World) {
+  FMcpNavRebuildResult &Result = State->Result;
+  Result.WallMs = (FPlatformTime::Seconds() - State->StartSeconds) * 1000.0;
+  if (World) {
+    Result.RemainingBuildTasks = CountRemainingNavBuildTasks(World);
+    for (TActorIterator<ARecastNavMesh> It(World); It; ++It) {
+      Result.TotalTiles += It->GetNavMeshTilesCount();
+    }
+  }
+  State->OnFinished(Result);
+}
+
+// Polls the generators once; returns true while the rebuild is running.
+bool TickNavRebuild(const FNavRebuildStateRef &State) {
+  UWorld *World = State->World.Get();
+  if (!World) {
+    FinishNavRebuild(State, nullptr);
+    return false;
+  }
+  const int32 Remaining = CountRemainingNavBuildTasks(World);
+  UNavigationSystemV1 *NavSys =
+      FNavigationSystem::GetCurrent<UNavigationSystemV1>(World);
+  const bool bSystemBusy =
+      State->bFullBuild && NavSys && NavSys->IsNavigationBuildInProgress();
+  State->Result.PeakBuildTasks =
+      FMath::Max(State->Result.PeakBuildTasks, Remaining);
+  if (Remaining == 0 && !bSystemBusy) {
+    FinishNavRebuild(State, World);
+    return false;
+  }
+  if (State->TimeoutSeconds > 0.0 &&
+      FPlatformTime::Seconds() - State->StartSeconds > State->TimeoutSeconds) {
+    State->Result.bTimedOut = true;
+    FinishNavRebuild(State, World);
+    return false;
+  }
+  if (State->OnProgress &&
+      !State->OnProgress(Remaining, State->Result.PeakBuildTasks)) {
+    State->Result.bCancelled = true;
+    FinishNavRebuild(State, World);
+    return false;
+  }
+  return true;
+}
+
+int32 CountNavTilesTouched(UWorld *World, const TArray<FBox> &Areas) {
+  TSet<FIntPoint> Tiles;
+  for (TActorIterator<ARecastNavMesh> It(World); It; ++It) {
+    const double TileSize = FMath::Max(1.0, static_cast<double>(It->TileSizeUU));
+    for (const FBox &Area : Areas) {
+      const int32 MinX = FMath::FloorToInt(Area.Min.X / TileSize);
+      const int32 MaxX = FMath::FloorToInt(Area.Max.X / TileSize);
+      const int32 MinY = FMath::FloorToInt(Area.Min.Y / TileSize);
+      const int32 MaxY = FMath::FloorToInt(Area.Max.Y / TileSize);
+      for (int32 X = MinX; X <= MaxX && Tiles.Num() < 1000000; ++X) {
+        for (int32 Y = MinY; Y <= MaxY; ++Y) {
+          Tiles.Add(FIntPoint(X, Y));
+        }
+      }
+    }
+    // Tile grids of several agents differ; the default navmesh is the one
+    // reported.
+    break;
+  }
+  return Tiles.Num();
+}
+
+TSharedPtr<FJsonValue> NavBoxToJson(const FBox &Box) {
+  TSharedPtr<FJsonObject> Obj = MakeShared<FJsonObject>();
+  auto Vec = [](const FVector &V) {
+    TArray<TSharedPtr<FJsonValue>> Arr;
+    Arr.Add(MakeShared<FJsonValueNumber>(V.X));
+    Arr.Add(MakeShared<FJsonValueNumber>(V.Y));
+    Arr.Add(MakeShared<FJsonValueNumber>(V.Z));
+    return Arr;
+  };
+  Obj->SetArrayField(TEXT("min"), Vec(Box.Min));
+  Obj->SetArrayField(TEXT("max"), Vec(Box.Max));
+  return MakeShared<FJsonValueObject>(Obj);
+}
+} // namespace
+
+FMcpNavDirtyTracker::FMcpNavDirtyTracker() {
+#if WITH_EDITOR
+  ModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddRaw(
+      this, &FMcpNavDirtyTracker::OnObjectModified);
+  PropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(
+      this, &FMcpNavDirtyTracker::OnObjectPropertyChanged);
+  if (GEngine) {
+    ActorMovedHandle = GEngine->OnActorMoved().AddRaw(
+        this, &FMcpNavDirtyTracker::Record);
+    ActorAddedHandle = GEngine->OnLevelActorAdded().AddRaw(
+        this, &FMcpNavDirtyTracker::Record);
+    ActorDeletedHandle = GEngine->OnLevelActorDeleted().AddRaw(
+        this, &FMcpNavDirtyTracker::Record);
+  }
+#endif
+}
+
+FMcpNavDirtyTracker::~FMcpNavDirtyTracker() {
+#if WITH_EDITOR
+  FCoreUObjectDelegates::OnObjectModified.Remove(ModifiedHandle);
+  FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(PropertyChangedHandle);
+  if (GEngine) {
+    GEngine->OnActorMoved().Remove(ActorMovedHandle);
+    GEngine->OnLevelActorAdded().Remove(ActorAddedHandle);
+    GEngine->OnLevelActorDeleted().Remove(ActorDeletedHandle);
+  }
+#endif
+}
+
+void FMcpNavDirtyTracker::Record(AActor *Actor) {
+  if (!IsNavDirtyCandidate(Actor)) {
+    return;
+  }
+  UWorld *World = Actor->GetWorld();
+  if (RecordedWorld.Get() != World) {
+    Recorded.Reset();
+    RecordedWorld = World;
+  }
+  const FBox Bounds = NavDirtyBoundsOf(Actor);
+  FBox &Entry = Recorded.FindOrAdd(Actor, FBox(ForceInit));
+  if (Bounds.IsValid) {
+    Entry += Bounds;
+  }
+  if (Recorded.Num() > MaxNavDirtyActors) {
+    FBox Union(ForceInit);
+    for (const TPair<TWeakObjectPtr<AActor>, FBox> &Pair : Recorded) {
+      if (Pair.Value.IsValid) {
+        Union += Pair.Value;
+      }
+    }
+    Recorded.Reset();
+    Recorded.Add(Actor, Union);
+  }
+}
+
+void FMcpNavDirtyTracker::OnObjectModified(UObject *Object) {
+  if (AActor *Actor = Cast<AActor>(Object)) {
+    Record(Actor);
+  } else if (UActorComponent *Component = Cast<UActorComponent>(Object)) {
+    Record(Component->GetOwner());
+  }
+}
+
+void FMcpNavDirtyTracker::OnObjectPropertyChanged(UObject *Object,
+                                                  FPropertyChangedEvent &) {
+  OnObjectModified(Object);
+}
+
+TArray<FBox> FMcpNavDirtyTracker::Consume(UWorld *World, double Padding) {
+  TArray<FBox> Boxes;
+  if (RecordedWorld.Get() == World) {
+    for (const TPair<TWeakObjectPtr<AActor>, FBox> &Pair : Recorded) {
+      FBox Box = Pair.Value;
+      if (const AActor *Actor = Pair.Key.Get()) {
+        const FBox Current = NavDirtyBoundsOf(Actor);
+        if (Current.IsValid) {
+          Box += Current;
+        }
+      }
+      if (Box.IsValid) {
+        Boxes.Add(Box.ExpandBy(Padding));
+      }
+    }
+  }
+  Recorded.Reset();
+  return MergeNavDirtyBoxes(MoveTemp(Boxes));
+}
+
+TSharedPtr<FJsonObject> FMcpNavRebuildResult::ToJson() const {
+  TSharedPtr<FJsonObject> Obj = MakeShared<FJsonObject>();
+  Obj->SetBoolField(TEXT("incremental"), Areas.Num() > 0);
+  Obj->SetNumberField(TEXT("dirtyAreas"), Areas.Num());
+  TArray<TSharedPtr<FJsonValue>> AreaValues;
+  for (int32 Index = 0; Index < Areas.Num() && Index < 64; ++Index) {
+    AreaValues.Add(NavBoxToJson(Areas[Index]));
+  }
+  Obj->SetArrayField(TEXT("areas"), AreaValues);
+  Obj->SetNumberField(TEXT("tilesTouched"), TilesTouched);
+  Obj->SetNumberField(TEXT("tilesBuilt"), PeakBuildTasks);
+  Obj->SetNumberField(TEXT("remainingBuildTasks"), RemainingBuildTasks);
+  Obj->SetNumberField(TEXT("totalTiles"), TotalTiles);
+  Obj->SetNumberField(TEXT("navDataCount"), NavDataCount);
+  Obj->SetBoolField(TEXT("builtSynchronously"), bBuiltSynchronously);
+  Obj->SetBoolField(TEXT("timedOut"), bTimedOut);
+  Obj->SetBoolField(TEXT("cancelled"), bCancelled);
+  Obj->SetNumberField(TEXT("wallMs"), WallMs);
+  return Obj;
+}
+
+bool FMcpNavigationRebuild::Run(
+    UWorld *World, TArray<FBox> Areas, double TimeoutSeconds,
+    TFunction<bool(int32 Remaining, int32 Peak)> OnProgress,
+    TFunction<void(const FMcpNavRebuildResult &)> OnFinished,
+    FString &OutError) {
+  check(IsInGameThread());
+  UNavigationSystemV1 *NavSys =
+      World ? FNavigationSystem::GetCurrent<UNavigationSystemV1>(World)
+            : nullptr;
+  if (!NavSys) {
+    OutError = TEXT("Navigation system not available");
+    return false;
+  }
+
+  FNavRebuildStateRef State = MakeShared<FNavRebuildState>();
+  State->World = World;
+  State->bFullBuild = Areas.Num() == 0;
+  State->StartSeconds = FPlatformTime::Seconds();
+  State->TimeoutSeconds = FMath::Max(0.0, TimeoutSeconds);
+  State->OnProgress = MoveTemp(OnProgress);
+  State->OnFinished = MoveTemp(OnFinished);
+
+  if (State->bFullBuild) {
+    NavSys->Build();
+    for (TActorIterator<ANavigationData> It(World); It; ++It) {
+      ++State->Result.NavDataCount;
+    }
+  } else {
+    TArray<FNavigationDirtyArea> DirtyAreas;
+    DirtyAreas.Reserve(Areas.Num());
+    for (const FBox &Area : Areas) {
+      DirtyAreas.Add(FNavigationDirtyArea(Area, ENavigationDirtyFlag::All));
+    }
+    // With building locked (navigation auto-update off in the editor) the
+    // generators would not tick, so the queued tiles are finished here.
+    const bool bLocked = NavSys->IsNavigationBuildingLocked();
+    for (TActorIterator<ANavigationData> It(World); It; ++It) {
+      ++State->Result.NavDataCount;
+      It->RebuildDirtyAreas(DirtyAreas);
+      State->Result.PeakBuildTasks += It->GetNumRemainingBuildTasks();
+      if (bLocked) {
+        It->EnsureBuildCompletion();
+      }
+    }
+    State->Result.bBuiltSynchronously = bLocked;
+    State->Result.TilesTouched = CountNavTilesTouched(World, Areas);
+    State->Result.Areas = MoveTemp(Areas);
+  }
+
+  if (TickNavRebuild(State)) {
+    FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+        [State](float) { return TickNavRebuild(State); }));
+  }
+  return true;
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "Templates/Function.h"
+#include "UObject/WeakObjectPtr.h"
+
+class AActor;
+class UObject;
+class UWorld;
+struct FPropertyChangedEvent;
+
+/**
+ * Bounds of editor-world actors edited since rebuild_navigation last asked, so a "recent"
+ * rebuild covers what the edits touched without the caller naming it. An actor is recorded
+ * where it was when first modified (Modify, deletion) and, when consumed, where it is now, so a
+ * moved building dirties both its old and new footprint. Owned by the subsystem; game thread only.
+ */
+class FMcpNavDirtyTracker
+{
+public:
+    FMcpNavDirtyTracker();
+    ~FMcpNavDirtyTracker();
+
+    FMcpNavDirtyTracker(const FMcpNavDirtyTracker&) = delete;
+    FMcpNavDirtyTracker& operator=(const FMcpNavDirtyTracker&) = delete;
+
+    /** Boxes recorded in World, each grown by Padding and merged where they overlap; clears them. */
+    TArray<FBox> Consume(UWorld* World, double Padding);
+
+    /** Actors recorded since the last Consume. */
+    int32 Num() const { return Recorded.Num(); }
+
+private:
+    void Record(AActor* Actor);
+    void OnObjectModified(UObject* Object);
+    void OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event);
+
+    TWeakObjectPtr<UWorld> RecordedWorld;
+    /** Union of each actor's bounds at the events seen; removed actors keep their last box. */
+    TMap<TWeakObjectPtr<AActor>, FBox> Recorded;
+    FDelegateHandle ModifiedHandle;
+    FDelegateHandle PropertyChangedHandle;
+    FDelegateHandle ActorMovedHandle;
+    FDelegateHandle ActorAddedHandle;
+    FDelegateHandle ActorDeletedHandle;
+};
+
+/** What one navigation rebuild did, handed to its completion callback. */
+struct FMcpNavRebuildResult
+{
+    /** Areas handed to the generators; empty for a full build. */
+    TArray<FBox> Areas;
+    /** Recast tiles (x, y) the areas overlap; a tile with several layers builds more than once. */
+    int32 TilesTouched = 0;
+    /** Most build tasks seen queued at once, i.e. the tiles the generators had to build. */
+    int32 PeakBuildTasks = 0;
+    int32 RemainingBuildTasks = 0;
+    /** Tiles of every Recast navmesh once the build ended. */
+    int32 TotalTiles = 0;
+    int32 NavDataCount = 0;
+    /** Navigation building was locked (auto-update off), so the tiles were built synchronously. */
+    bool bBuiltSynchronously = false;
+    bool bTimedOut = false;
+    bool bCancelled = false;
+    double WallMs = 0.0;
+
+    TSharedPtr<FJsonObject> ToJson() const;
+};
+
+/**
+ * Rebuilds navigation in an editor world and reports when the generators are idle. Areas, when
+ * given, are queued as dirty areas on every navigation data instance, so only the tiles they
+ * overlap are rebuilt; no areas runs a full UNavigationSystemV1::Build. Completion is polled once
+ * per core-ticker tick. Game thread only.
+ */
+class FMcpNavigationRebuild
+{
+public:
+    /**
+     * Starts the rebuild. OnProgress runs each tick while tasks remain with the queued count and
+     * the peak so far, and stops waiting, marked cancelled, by returning false; OnFinished runs
+     * exactly once, also when the world goes away or TimeoutSeconds (0 = none) pass first. Returns
+     * false with OutError, without calling either, when World has no navigation system.
+     */
+    static bool Run(UWorld* World, TArray<FBox> Areas, double TimeoutSeconds,
+        TFunction<bool(int32 Remaining, int32 Peak)> OnProgress,
+        TFunction<void(const FMcpNavRebuildResult&)> OnFinished, FString& OutError);
+};
@@ -0,0 +1,853 @@
+#include "McpNiagaraSystemBuilder.h"
+
+#include "Dom/JsonValue.h"
+
+#if WITH_EDITOR
+#include "Containers/Ticker.h"
+#include "Engine/StaticMesh.h"
+#include "HAL/PlatformTime.h"
+#include "Materials/MaterialInterface.h"
+#include "McpAutomationBridgeHelpers.h"
+#include "NiagaraDataInterface.h"
+#include "NiagaraEmitter.h"
+#include "NiagaraEmitterHandle.h"
+#include "NiagaraGraph.h"
+#include "NiagaraLightRendererProperties.h"
+#include "NiagaraMeshRendererProperties.h"
+#include "NiagaraNodeFunctionCall.h"
+#include "NiagaraNodeOutput.h"
+#include "NiagaraParameterStore.h"
+#include "NiagaraRibbonRendererProperties.h"
+#include "NiagaraScript.h"
+#include "NiagaraScriptSource.h"
+#include "NiagaraSpriteRendererProperties.h"
+#include "NiagaraSystem.h"
+#include "NiagaraTypes.h"
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
+#include "ViewModels/Stack/NiagaraStackGraphUtilities.h"
+#endif
+#endif
+
+TSharedPtr<FJsonObject> FMcpNiagaraSystemBuildResult::ToJson() const {
+  TSharedPtr<FJsonObject> Obj = MakeShared<FJsonObject>();
+  Obj->SetNumberField(TEXT("emittersAdded"), EmittersAdded);
+  Obj->SetNumberField(TEXT("emittersToggled"), EmittersToggled);
+  Obj->SetNumberField(TEXT("modulesAdded"), ModulesAdded);
+  Obj->SetNumberField(TEXT("modulesExisting"), ModulesExisting);
+  Obj->SetNumberField(TEXT("renderersAdded"), RenderersAdded);
+  Obj->SetNumberField(TEXT("renderersUpdated"), RenderersUpdated);
+  Obj->SetNumberField(TEXT("userParametersSet"), UserParametersSet);
+  Obj->SetNumberField(TEXT("dataInterfacesSet"), DataInterfacesSet);
+  TArray<TSharedPtr<FJsonValue>> WarningValues;
+  for (const FString &Warning : Warnings) {
+    WarningValues.Add(MakeShared<FJsonValueString>(Warning));
+  }
+  Obj->SetArrayField(TEXT("warnings"), WarningValues);
+  return Obj;
+}
+
+#if WITH_EDITOR
+namespace {
+constexpr double NiagaraCompileProgressSeconds = 0.5;
+
+// UE 5.0 keeps emitter data on the UNiagaraEmitter itself; 5.1 moved it into
+// versioned data owned by the emitter.
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
+using FNiagaraBuildEmitterData = FVersionedNiagaraEmitterData;
+#else
+using FNiagaraBuildEmitterData = UNiagaraEmitter;
+#endif
+
+FNiagaraBuildEmitterData *GetNiagaraBuildEmitterData(const FNiagaraEmitterHandle &Handle) {
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
+  return Handle.GetEmitterData();
+#else
+  return Handle.GetInstance();
+#endif
+}
+
+UNiagaraEmitter *GetNiagaraBuildEmitter(const FNiagaraEmitterHandle &Handle) {
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
+  return Handle.GetInstance().Emitter;
+#else
+  return Handle.GetInstance();
+#endif
+}
+
+FNiagaraEmitterHandle *FindNiagaraBuildHandle(UNiagaraSystem *System, const FString &Name) {
+  for (FNiagaraEmitterHandle &Handle : System->GetEmitterHandles()) {
+    if (Handle.GetName().ToString() == Name) {
+      return &Handle;
+    }
+  }
+  return nullptr;
+}
+
+// Stock modules the single-module actions already use, by the name a spec can
+// give as "preset" instead of a script path.
+struct FNiagaraModulePreset {
+  const TCHAR *Name;
+  const TCHAR *Path;
+  ENiagaraScriptUsage Usage;
+};
+
+const FNiagaraModulePreset NiagaraModulePresets[] = {
+    {TEXT("SpawnRate"), TEXT("/Niagara/Modules/Emitter/SpawnRate.SpawnRate"), ENiagaraScriptUsage::EmitterUpdateScript},
+    {TEXT("SpawnBurst"), TEXT("/Niagara/Modules/Emitter/SpawnBurst_Instantaneous.SpawnBurst_Instantaneous"), ENiagaraScriptUsage::EmitterSpawnScript},
+    {TEXT("SpawnPerUnit"), TEXT("/Niagara/Modules/Emitter/SpawnPerUnit.SpawnPerUnit"), ENiagaraScriptUsage::EmitterUpdateScript},
+    {TEXT("InitializeParticle"), TEXT("/Niagara/Modules/Spawn/Initialization/InitializeParticle.InitializeParticle"), ENiagaraScriptUsage::ParticleSpawnScript},
+    {TEXT("ParticleState"), TEXT("/Niagara/Modules/Update/Lifetime/ParticleState.ParticleState"), ENiagaraScriptUsage::ParticleUpdateScript},
+    {TEXT("AddVelocity"), TEXT("/Niagara/Modules/Spawn/Velocity/AddVelocity.AddVelocity"), ENiagaraScriptUsage::ParticleSpawnScript},
+    {TEXT("AddVelocityInCone"), TEXT("/Niagara/Modules/Spawn/Velocity/AddVelocityInCone.AddVelocityInCone"), ENiagaraScriptUsage::ParticleSpawnScript},
+    {TEXT("AddVelocityFromPoint"), TEXT("/Niagara/Modules/Spawn/Velocity/AddVelocityFromPoint.AddVelocityFromPoint"), ENiagaraScriptUsage::ParticleSpawnScript},
+    {TEXT("GravityForce"), TEXT("/Niagara/Modules/Update/Forces/GravityForce.GravityForce"), ENiagaraScriptUsage::ParticleUpdateScript},
+    {TEXT("DragForce"), TEXT("/Niagara/Modules/Update/Forces/DragForce.DragForce"), ENiagaraScriptUsage::ParticleUpdateScript},
+    {TEXT("WindForce"), TEXT("/Niagara/Modules/Update/Forces/WindForce.WindForce"), ENiagaraScriptUsage::ParticleUpdateScript},
+    {TEXT("CurlNoiseForce"), TEXT("/Niagara/Modules/Update/Forces/CurlNoiseForce.CurlNoiseForce"), ENiagaraScriptUsage::ParticleUpdateScript},
+    {TEXT("VortexForce"), TEXT("/Niagara/Modules/Update/Forces/VortexForce.VortexForce"), ENiagaraScriptUsage::ParticleUpdateScript},
+    {TEXT("PointAttractionForce"), TEXT("/Niagara/Modules/Update/Forces/PointAttractionForce.PointAttractionForce"), ENiagaraScriptUsage::ParticleUpdateScript},
+};
+
+bool ParseNiagaraStage(const FString &Stage, ENiagaraScriptUsage &OutUsage) {
+  if (Stage.Equals(TEXT("emitterSpawn"), ESearchCase::IgnoreCase)) {
+    OutUsage = ENiagaraScriptUsage::EmitterSpawnScript;
+  } else if (Stage.Equals(TEXT("emitterUpdate"), ESearchCase::IgnoreCase)) {
+    OutUsage = ENiagaraScriptUsage::EmitterUpdateScript;
+  } else if (Stage.Equals(TEXT("particleSpawn"), ESearchCase::IgnoreCase) ||
+             Stage.Equals(TEXT("spawn"), ESearchCase::IgnoreCase)) {
+    OutUsage = ENiagaraScriptUsage::ParticleSpawnScript;
+  } else if (Stage.Equals(TEXT("particleUpdate"), ESearchCase::IgnoreCase) ||
+             Stage.Equals(TEXT("update"), ESearchCase::IgnoreCase)) {
+    OutUsage = ENiagaraScriptUsage::ParticleUpdateScript;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+struct FNiagaraSpecModule {
+  UNiagaraScript *Script = nullptr;
+  ENiagaraScriptUsage Usage = ENiagaraScriptUsage::ParticleUpdateScript;
+  FString Name;
+};
+
+struct FNiagaraSpecRenderer {
+  UClass *Class = nullptr;
+  UMaterialInterface *Material = nullptr;
+  UStaticMesh *Mesh = nullptr;
+  TSharedPtr<FJsonObject> Properties;
+};
+
+struct FNiagaraSpecEmitter {
+  FString Name;
+  /** Asset to add the emitter from when the system does not have it yet. */
+  UNiagaraEmitter *Source = nullptr;
+  bool bSetEnabled = false;
+  bool bEnabled = true;
+  TArray<FNiagaraSpecModule> Modules;
+  TArray<FNiagaraSpecRenderer> Renderers;
+};
+
+struct FNiagaraSpecParameter {
+  FNiagaraVariable Variable;
+  TSharedPtr<FJsonValue> Value;
+  UClass *DataInterfaceClass = nullptr;
+  TSharedPtr<FJsonObject> Properties;
+};
+
+const TArray<TSharedPtr<FJsonValue>> *GetNiagaraSpecArray(const TSharedPtr<FJsonObject> &Obj,
+                                                          const TCHAR *Field) {
+  const TArray<TSharedPtr<FJsonValue>> *Array = nullptr;
+  return Obj->TryGetArrayField(Field, Array) ? Array : nullptr;
+}
+
+FName MakeNiagaraUserParameterName(const FString &Name) {
+  return FName(*(Name.StartsWith(TEXT("User.")) ? Name : TEXT("User.") + Name));
+}
+
+bool ParseNiagaraSpecModule(const TSharedPtr<FJsonObject> &Obj, const FString &Emitter,
+                            FNiagaraSpecModule &Out, FString &OutError) {
+  FString ScriptPath;
+  Obj->TryGetStringField(TEXT("script"), ScriptPath);
+  FString Preset;
+  Obj->TryGetStringField(TEXT("preset"), Preset);
+  bool bHasUsage = false;
+  if (ScriptPath.IsEmpty() && !Preset.IsEmpty()) {
+    for (const FNiagaraModulePreset &Entry : NiagaraModulePresets) {
+      if (Preset.Equals(Entry.Name, ESearchCase::IgnoreCase)) {
+        ScriptPath = Entry.Path;
+        Out.Usage = Entry.Usage;
+        bHasUsage = true;
+        break;
+      }
+    }
+    if (ScriptPath.IsEmpty()) {
+      OutError = FString::Printf(TEXT("Emitter '%s': unknown module preset '%s'"), *Emitter, *Preset);
+      return false;
+    }
+  }
+  if (ScriptPath.IsEmpty()) {
+    OutError = FString::Printf(TEXT("Emitter '%s': every module needs 'script' or 'preset'"), *Emitter);
+    return false;
+  }
+  FString Stage;
+  if (Obj->TryGetStringField(TEXT("stage"), Stage)) {
+    if (!ParseNiagaraStage(Stage, Out.Usage)) {
+      OutError = FString::Printf(
+          TEXT("Emitter '%s': stage '%s' is not emitterSpawn, emitterUpdate, particleSpawn or particleUpdate"),
+          *Emitter, *Stage);
+      return false;
+    }
+    bHasUsage = true;
+  }
+  if (!bHasUsage) {
+    OutError = FString::Printf(TEXT("Emitter '%s': module '%s' needs a 'stage'"), *Emitter, *ScriptPath);
+    return false;
+  }
+  Out.Script = Cast<UNiagaraScript>(FSoftObjectPath(ScriptPath).TryLoad());
+  if (!Out.Script) {
+    OutError = FString::Printf(TEXT("Emitter '%s': could not load module script '%s'"), *Emitter, *ScriptPath);
+    return false;
+  }
+  Obj->TryGetStringField(TEXT("name"), Out.Name);
+  if (Out.Name.IsEmpty()) {
+    Out.Name = Out.Script->GetName();
+  }
+  return true;
+}
+
+bool ParseNiagaraSpecRenderer(const TSharedPtr<FJsonObject> &Obj, const FString &Emitter,
+                              FNiagaraSpecRenderer &Out, FString &OutError) {
+  FString Type;
+  Obj->TryGetStringField(TEXT("type"), Type);
+  if (Type.Equals(TEXT("sprite"), ESearchCase::IgnoreCase)) {
+    Out.Class = UNiagaraSpriteRendererProperties::StaticClass();
+  } else if (Type.Equals(TEXT("mesh"), ESearchCase::IgnoreCase)) {
+    Out.Class = UNiagaraMeshRendererProperties::StaticClass();
+  } else if (Type.Equals(TEXT("ribbon"), ESearchCase::IgnoreCase)) {
+    Out.Class = UNiagaraRibbonRendererProperties::StaticClass();
+  } else if (Type.Equals(TEXT("light"), ESearchCase::IgnoreCase)) {
+    Out.Class = UNiagaraLightRendererProperties::StaticClass();
+  } else {
+    OutError = FString::Printf(TEXT("Emitter '%s': renderer type '%s' is not sprite, mesh, ribbon or light"),
+                               *Emitter, *Type);
+    return false;
+  }
+  FString MaterialPath;
+  if (Obj->TryGetStringField(TEXT("materialPath"), MaterialPath) && !MaterialPath.IsEmpty()) {
+    if (Out.Class != UNiagaraSpriteRendererProperties::StaticClass() &&
+        Out.Class != UNiagaraRibbonRendererProperties::StaticClass()) {
+      OutError = FString::Printf(
+          TEXT("Emitter '%s': materialPath applies to sprite and ribbon renderers; set mesh materials through properties"),
+          *Emitter);
+      return false;
+    }
+    Out.Material = LoadObject<UMaterialInterface>(nullptr, *MaterialPath);
+    if (!Out.Material) {
+      OutError = FString::Printf(TEXT("Emitter '%s': could not load material '%s'"), *Emitter, *MaterialPath);
+      return false;
+    }
+  }
+  FString MeshPath;
+  if (Obj->TryGetStringField(TEXT("meshPath"), MeshPath) && !MeshPath.IsEmpty()) {
+    if (Out.Class != UNiagaraMeshRendererProperties::StaticClass()) {
+      OutError = FString::Printf(TEXT("Emitter '%s': meshPath applies to mesh renderers"), *Emitter);
+      return false;
+    }
+    Out.Mesh = LoadObject<UStaticMesh>(nullptr, *MeshPath);
+    if (!Out.Mesh) {
+      OutError = FString::Printf(TEXT("Emitter '%s': could not load static mesh '%s'"), *Emitter, *MeshPath);
+      return false;
+    }
+  }
+  const TSharedPtr<FJsonObject> *Properties = nullptr;
+  if (Obj->TryGetObjectField(TEXT("properties"), Properties)) {
+    Out.Properties = *Properties;
+  }
+  return true;
+}
+
+bool ParseNiagaraSpecParameter(const TSharedPtr<FJsonObject> &Obj, bool bDataInterface,
+                               FNiagaraSpecParameter &Out, FString &OutError) {
+  FString Name;
+  Obj->TryGetStringField(TEXT("name"), Name);
+  FString Type;
+  Obj->TryGetStringField(TEXT("type"), Type);
+  if (Name.IsEmpty() || Type.IsEmpty()) {
+    OutError = bDataInterface ? TEXT("Every data interface needs 'name' and 'type'")
+                              : TEXT("Every user parameter needs 'name' and 'type'");
+    return false;
+  }
+  FNiagaraTypeDefinition TypeDef;
+  if (bDataInterface) {
+    UClass *Class = ResolveClassByName(Type.StartsWith(TEXT("NiagaraDataInterface"))
+                                           ? Type
+                                           : TEXT("NiagaraDataInterface") + Type);
+    if (!Class || !Class->IsChildOf(UNiagaraDataInterface::StaticClass()) ||
+        Class->HasAnyClassFlags(CLASS_Abstract)) {
+      OutError = FString::Printf(TEXT("Data interface '%s': '%s' is not a Niagara data interface class"),
+                                 *Name, *Type);
+      return false;
+    }
+    Out.DataInterfaceClass = Class;
+    TypeDef = FNiagaraTypeDefinition(Class);
+    const TSharedPtr<FJsonObject> *Properties = nullptr;
+    if (Obj->TryGetObjectField(TEXT("properties"), Properties)) {
+      Out.Properties = *Properties;
+    }
+  } else if (Type.Equals(TEXT("Float"), ESearchCase::IgnoreCase)) {
+    TypeDef = FNiagaraTypeDefinition::GetFloatDef();
+  } else if (Type.Equals(TEXT("Int"), ESearchCase::IgnoreCase)) {
+    TypeDef = FNiagaraTypeDefinition::GetIntDef();
+  } else if (Type.Equals(TEXT("Bool"), ESearchCase::IgnoreCase)) {
+    TypeDef = FNiagaraTypeDefinition::GetBoolDef();
+  } else if (Type.Equals(TEXT("Vector"), ESearchCase::IgnoreCase)) {
+    TypeDef = FNiagaraTypeDefinition::GetVec3Def();
+  } else if (Type.Equals(TEXT("LinearColor"), ESearchCase::IgnoreCase)) {
+    TypeDef = FNiagaraTypeDefinition::GetColorDef();
+  } else {
+    OutError = FString::Printf(TEXT("User parameter '%s': type '%s' is not Float, Int, Bool, Vector or LinearColor"),
+                               *Name, *Type);
+    return false;
+  }
+  Out.Variable = FNiagaraVariable(TypeDef, MakeNiagaraUserParameterName(Name));
+  Out.Value = Obj->TryGetField(TEXT("value"));
+  return true;
+}
+
+// Reads [a, b, c(, d)] or an object with the given component keys.
+bool ReadNiagaraSpecComponents(const TSharedPtr<FJsonValue> &Value, const TCHAR *const *Keys,
+                               int32 Count, float *Out) {
+  const TArray<TSharedPtr<FJsonValue>> *Array = nullptr;
+  if (Value->TryGetArray(Array)) {
+    if (Array->Num() < Count) {
+      return false;
+    }
+    for (int32 Index = 0; Index < Count; ++Index) {
+      double Component = 0.0;
+      if (!(*Array)[Index]->TryGetNumber(Component)) {
+        return false;
+      }
+      Out[Index] = static_cast<float>(Component);
+    }
+    return true;
+  }
+  const TSharedPtr<FJsonObject> *Obj = nullptr;
+  if (!Value->TryGetObject(Obj)) {
+    return false;
+  }
+  for (int32 Index = 0; Index < Count; ++Index) {
+    double Component = 0.0;
+    if ((*Obj)->TryGetNumberField(Keys[Index], Component)) {
+      Out[Index] = static_cast<float>(Component);
+    }
+  }
+  return true;
+}
+
+// FNiagaraParameterStore::SetParameterValue checks the value is exactly the
+// parameter's size, so bools go in as FNiagaraBool and vectors as FVector3f.
+bool SetNiagaraUserParameterValue(FNiagaraUserRedirectionParameterStore &Store,
+                                  const FNiagaraVariable &Variable,
+                                  const TSharedPtr<FJsonValue> &Value) {
+  const FNiagaraTypeDefinition &Type = Variable.GetType();
+  if (Type == FNiagaraTypeDefinition::GetBoolDef()) {
+    bool bValue = false;
+    if (!Value->TryGetBool(bValue)) {
+      return false;
+    }
+    Store.SetParameterValue(FNiagaraBool(bValue), Variable);
+    return true;
+  }
+  if (Type == FNiagaraTypeDefinition::GetVec3Def()) {
+    static const TCHAR *const Keys[] = {TEXT("x"), TEXT("y"), TEXT("z")};
+    float Components[3] = {0.f, 0.f, 0.f};
+    if (!ReadNiagaraSpecComponents(Value, Keys, 3, Components)) {
+      return false;
+    }
+    Store.SetParameterValue(FVector3f(Components[0], Components[1], Components[2]), Variable);
+    return true;
+  }
+  if (Type == FNiagaraTypeDefinition::GetColorDef()) {
+    static const TCHAR *const Keys[] = {TEXT("r"), TEXT("g"), TEXT("b"), TEXT("a")};
+    float Components[4] = {1.f, 1.f, 1.f, 1.f};
+    if (!ReadNiagaraSpecComponents(Value, Keys, 4, Components)) {
+      return false;
+    }
+    Store.SetParameterValue(FLinearColor(Components[0], Components[1], Components[2], Components[3]),
+                            Variable);
+    return true;
+  }
+  double Number = 0.0;
+  if (!Value->TryGetNumber(Number)) {
+    return false;
+  }
+  if (Type == FNiagaraTypeDefinition::GetIntDef()) {
+    Store.SetParameterValue(static_cast<int32>(Number), Variable);
+  } else {
+    Store.SetParameterValue(static_cast<float>(Number), Variable);
+  }
+  return true;
+}
+
+void ApplyNiagaraSpecProperties(UObject *Target, const FString &Label,
+                                const TSharedPtr<FJsonObject> &Properties,
+                                TArray<FString> &Warnings) {
+  for (const TPair<FString, TSharedPtr<FJsonValue>> &Pair : Properties->Values) {
+    FString Error;
+    void *Container = nullptr;
+    FProperty *Property = ResolveNestedPropertyPath(Target, Pair.Key, Container, Error);
+    if (!Property || !Container || !ApplyJsonValueToProperty(Container, Property, Pair.Value, Error)) {
+      Warnings.Add(FString::Printf(TEXT("%s: property '%s': %s"), *Label, *Pair.Key, *Error));
+    }
+  }
+}
+
+bool HasNiagaraStackOutput(UNiagaraGraph *Graph, ENiagaraScriptUsage Usage,
+                           UNiagaraNodeOutput *&OutOutput) {
+  for (UEdGraphNode *Node : Graph->Nodes) {
+    UNiagaraNodeOutput *Output = Cast<UNiagaraNodeOutput>(Node);
+    if (Output && Output->GetUsage() == Usage) {
+      OutOutput = Output;
+      return true;
+    }
+  }
+  return false;
+}
+
+void ApplyNiagaraSpecModules(const FNiagaraEmitterHandle &Handle, const FNiagaraSpecEmitter &Spec,
+                             FMcpNiagaraSystemBuildResult &Result) {
+  if (Spec.Modules.Num() == 0) {
+    return;
+  }
+  FNiagaraBuildEmitterData *Data = GetNiagaraBuildEmitterData(Handle);
+  UNiagaraScriptSource *Source = Data ? Cast<UNiagaraScriptSource>(Data->GraphSource) : nullptr;
+  UNiagaraGraph *Graph = Source ? Source->NodeGraph : nullptr;
+  if (!Graph) {
+    Result.Warnings.Add(FString::Printf(TEXT("Emitter '%s' has no script graph; its modules were skipped"),
+                                        *Spec.Name));
+    return;
+  }
+  for (const FNiagaraSpecModule &Module : Spec.Modules) {
+    // Niagara keeps module names unique per emitter graph, so a call to the
+    // same script under the same name is the module a previous build added.
+    bool bExists = false;
+    for (UEdGraphNode *Node : Graph->Nodes) {
+      const UNiagaraNodeFunctionCall *Call = Cast<UNiagaraNodeFunctionCall>(Node);
+      if (Call && Call->FunctionScript == Module.Script && Call->GetFunctionName() == Module.Name) {
+        bExists = true;
+        break;
+      }
+    }
+    if (bExists) {
+      ++Result.ModulesExisting;
+      continue;
+    }
+    UNiagaraNodeOutput *Output = nullptr;
+    if (!HasNiagaraStackOutput(Graph, Module.Usage, Output)) {
+      Result.Warnings.Add(FString::Printf(TEXT("Emitter '%s' has no %s stage for module '%s'"), *Spec.Name,
+                                          *StaticEnum<ENiagaraScriptUsage>()->GetNameStringByValue(
+                                              static_cast<int64>(Module.Usage)),
+                                          *Module.Name));
+      continue;
+    }
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
+    if (FNiagaraStackGraphUtilities::AddScriptModuleToStack(Module.Script, *Output, INDEX_NONE, Module.Name)) {
+      ++Result.ModulesAdded;
+    } else {
+      Result.Warnings.Add(FString::Printf(TEXT("Emitter '%s': could not add module '%s'"), *Spec.Name, *Module.Name));
+    }
+#else
+    Result.Warnings.Add(FString::Printf(TEXT("Emitter '%s': adding module '%s' needs UE 5.1 or later"),
+                                        *Spec.Name, *Module.Name));
+#endif
+  }
+}
+
+void ApplyNiagaraSpecRenderers(const FNiagaraEmitterHandle &Handle, const FNiagaraSpecEmitter &Spec,
+                               FMcpNiagaraSystemBuildResult &Result) {
+  if (Spec.Renderers.Num() == 0) {
+    return;
+  }
+  FNiagaraBuildEmitterData *Data = GetNiagaraBuildEmitterData(Handle);
+  UNiagaraEmitter *Emitter = GetNiagaraBuildEmitter(Handle);
+  if (!Data || !Emitter) {
+    Result.Warnings.Add(FString::Printf(TEXT("Emitter '%s' has no emitter data; its renderers were skipped"),
+                                        *Spec.Name));
+    return;
+  }
+  // The Nth renderer of a type in the spec is the Nth one of that class the
+  // emitter already has, so a re-sent spec edits rather than duplicates.
+  TMap<UClass *, int32> SeenOfClass;
+  for (const FNiagaraSpecRenderer &Renderer : Spec.Renderers) {
+    int32 &Ordinal = SeenOfClass.FindOrAdd(Renderer.Class);
+    UNiagaraRendererProperties *Target = nullptr;
+    int32 Matched = 0;
+    for (UNiagaraRendererProperties *Existing : Data->GetRenderers()) {
+      if (Existing && Existing->GetClass() == Renderer.Class && Matched++ == Ordinal) {
+        Target = Existing;
+        break;
+      }
+    }
+    ++Ordinal;
+    const bool bEdits = Renderer.Material || Renderer.Mesh || Renderer.Properties.IsValid();
+    if (!Target) {
+      Target = NewObject<UNiagaraRendererProperties>(Emitter, Renderer.Class, NAME_None, RF_Transactional);
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
+      Emitter->AddRenderer(Target, Handle.GetInstance().Version);
+#else
+      Emitter->AddRenderer(Target);
+#endif
+      ++Result.RenderersAdded;
+    } else if (bEdits) {
+      Target->Modify();
+      ++Result.RenderersUpdated;
+    }
+    if (Renderer.Material) {
+      if (UNiagaraSpriteRendererProperties *Sprite = Cast<UNiagaraSpriteRendererProperties>(Target)) {
+        Sprite->Material = Renderer.Material;
+      } else if (UNiagaraRibbonRendererProperties *Ribbon = Cast<UNiagaraRibbonRendererProperties>(Target)) {
+        Ribbon->Material = Renderer.Material;
+      }
+    }
+    if (Renderer.Mesh) {
+      if (UNiagaraMeshRendererProperties *MeshRenderer = Cast<UNiagaraMeshRendererProperties>(Target)) {
+        FNiagaraMeshRendererMeshProperties MeshProps;
+        MeshProps.Mesh = Renderer.Mesh;
+        MeshRenderer->Meshes.Empty();
+        MeshRenderer->Meshes.Add(MeshProps);
+      }
+    }
+    if (Renderer.Properties.IsValid()) {
+      ApplyNiagaraSpecProperties(Target,
+                                 FString::Printf(TEXT("Emitter '%s' %s"), *Spec.Name, *Renderer.Class->GetName()),
+                                 Renderer.Properties, Result.Warnings);
+    }
+  }
+}
+
+struct FNiagaraCompileWatch {
+  TWeakObjectPtr<UNiagaraSystem> System;
+  double StartSeconds = 0.0;
+  double TimeoutSeconds = 0.0;
+  double LastProgressSeconds = 0.0;
+  int32 Frames = 0;
+  bool bFinished = false;
+  TFunction<bool(float)> OnProgress;
+  TFunction<void(const TSharedPtr<FJsonObject> &)> OnFinished;
+};
+using FNiagaraCompileWatchRef = TSharedRef<FNiagaraCompileWatch>;
+
+TArray<TWeakPtr<FNiagaraCompileWatch>> GNiagaraCompileWatches;
+
+// The system scripts plus every enabled emitter's compilable scripts, each
+// with the emitter it belongs to ("" for the system's own).
+void CollectNiagaraCompileScripts(UNiagaraSystem *System,
+                                  TArray<TPair<FString, UNiagaraScript *>> &Out) {
+  Out.Emplace(FString(), System->GetSystemSpawnScript());
+  Out.Emplace(FString(), System->GetSystemUpdateScript());
+  for (const FNiagaraEmitterHandle &Handle : System->GetEmitterHandles()) {
+    FNiagaraBuildEmitterData *Data = Handle.GetIsEnabled() ? GetNiagaraBuildEmitterData(Handle) : nullptr;
+    if (!Data) {
+      continue;
+    }
+    TArray<UNiagaraScript *> Scripts;
+    Data->GetScripts(Scripts);
+    for (UNiagaraScript *Script : Scripts) {
+      Out.Emplace(Handle.GetName().ToString(), Script);
+    }
+  }
+  Out.RemoveAll([](const TPair<FString, UNiagaraScript *> &Entry) { return Entry.Value == nullptr; });
+}
+
+void FinishNiagaraCompileWatch(const FNiagaraCompileWatchRef &State, bool bTimedOut, bool bCancelled) {
+  State->bFinished = true;
+  TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+  TArray<TSharedPtr<FJsonValue>> Errors;
+  TArray<TSharedPtr<FJsonValue>> Warnings;
+  int32 ScriptCount = 0;
+  if (UNiagaraSystem *System = State->System.Get()) {
+    TArray<TPair<FString, UNiagaraScript *>> Scripts;
+    CollectNiagaraCompileScripts(System, Scripts);
+    ScriptCount = Scripts.Num();
+    const UEnum *StatusEnum = StaticEnum<ENiagaraScriptCompileStatus>();
+    const UEnum *UsageEnum = StaticEnum<ENiagaraScriptUsage>();
+    for (const TPair<FString, UNiagaraScript *> &Entry : Scripts) {
+      const ENiagaraScriptCompileStatus Status = Entry.Value->GetLastCompileStatus();
+      const bool bError = Status == ENiagaraScriptCompileStatus::NCS_Error;
+      if (!bError && Status != ENiagaraScriptCompileStatus::NCS_UpToDateWithWarnings) {
+        continue;
+      }
+      TSharedPtr<FJsonObject> Item = MakeShared<FJsonObject>();
+      Item->SetStringField(TEXT("emitter"), Entry.Key);
+      Item->SetStringField(TEXT("usage"),
+                           UsageEnum->GetNameStringByValue(static_cast<int64>(Entry.Value->GetUsage())));
+      Item->SetStringField(TEXT("status"), StatusEnum->GetNameStringByValue(static_cast<int64>(Status)));
+      (bError ? Errors : Warnings).Add(MakeShared<FJsonValueObject>(Item));
+    }
+  } else {
+    Result->SetStringField(TEXT("error"), TEXT("The system was unloaded while compiling"));
+  }
+  Result->SetBoolField(TEXT("compiled"),
+                       State->System.IsValid() && !bTimedOut && !bCancelled && Errors.Num() == 0);
+  Result->SetNumberField(TEXT("scripts"), ScriptCount);
+  Result->SetArrayField(TEXT("errors"), Errors);
+  Result->SetArrayField(TEXT("warnings"), Warnings);
+  Result->SetNumberField(TEXT("compileMs"), (FPlatformTime::Seconds() - State->StartSeconds) * 1000.0);
+  Result->SetNumberField(TEXT("frames"), State->Frames);
+  if (bTimedOut) {
+    Result->SetBoolField(TEXT("timedOut"), true);
+  }
+  if (bCancelled) {
+    Result->SetBoolField(TEXT("cancelled"), true);
+  }
+  GNiagaraCompileWatches.RemoveAll([&State](const TWeakPtr<FNiagaraCompileWatch> &Watch) {
+    return !Watch.IsValid() || Watch.Pin() == State;
+  });
+  if (State->OnFinished) {
+    State->OnFinished(Result);
+  }
+}
+
+bool TickNiagaraCompileWatch(const FNiagaraCompileWatchRef &State) {
+  UNiagaraSystem *System = State->System.Get();
+  if (!System) {
+    FinishNiagaraCompileWatch(State, /*bTimedOut=*/false, /*bCancelled=*/false);
+    return false;
+  }
+  ++State->Frames;
+  // Polling applies the results of compile jobs that have finished; it never
+  // waits on the ones still running.
+  if (System->PollForCompilationComplete() || !System->HasOutstandingCompilationRequests()) {
+    FinishNiagaraCompileWatch(State, /*bTimedOut=*/false, /*bCancelled=*/false);
+    return false;
+  }
+  const double Now = FPlatformTime::Seconds();
+  if (Now - State->StartSeconds >= State->TimeoutSeconds) {
+    FinishNiagaraCompileWatch(State, /*bTimedOut=*/true, /*bCancelled=*/false);
+    return false;
+  }
+  if (State->OnProgress && Now - State->LastProgressSeconds >= NiagaraCompileProgressSeconds) {
+    State->LastProgressSeconds = Now;
+    TArray<TPair<FString, UNiagaraScript *>> Scripts;
+    CollectNiagaraCompileScripts(System, Scripts);
+    int32 Synchronized = 0;
+    for (const TPair<FString, UNiagaraScript *> &Entry : Scripts) {
+      Synchronized += Entry.Value->AreScriptAndSourceSynchronized() ? 1 : 0;
+    }
+    const float Percent = 100.0f * Synchronized / FMath::Max(1, Scripts.Num());
+    if (!State->OnProgress(Percent)) {
+      FinishNiagaraCompileWatch(State, /*bTimedOut=*/false, /*bCancelled=*/true);
+      return false;
+    }
+  }
+  return true;
+}
+} // namespace
+
+bool FMcpNiagaraSystemBuilder::Apply(UNiagaraSystem *System, const TSharedPtr<FJsonObject> &Spec,
+                                      FMcpNiagaraSystemBuildResult &OutResult, FString &OutError,
+                                      FString &OutErrorCode) {
+  check(System && Spec.IsValid());
+  OutErrorCode = TEXT("INVALID_ARGUMENT");
+
+  // Parse and load everything first so a bad entry leaves the system alone.
+  TArray<FNiagaraSpecEmitter> Emitters;
+  if (const TArray<TSharedPtr<FJsonValue>> *Array = GetNiagaraSpecArray(Spec, TEXT("emitters"))) {
+    TSet<FString> Names;
+    for (const TSharedPtr<FJsonValue> &Value : *Array) {
+      const TSharedPtr<FJsonObject> *Obj = nullptr;
+      if (!Value.IsValid() || !Value->TryGetObject(Obj)) {
+        OutError = TEXT("'emitters' entries must be objects");
+        return false;
+      }
+      FNiagaraSpecEmitter &Emitter = Emitters.AddDefaulted_GetRef();
+      (*Obj)->TryGetStringField(TEXT("name"), Emitter.Name);
+      if (Emitter.Name.IsEmpty()) {
+        OutError = TEXT("Every emitter needs a 'name'");
+        return false;
+      }
+      bool bDuplicate = false;
+      Names.Add(Emitter.Name, &bDuplicate);
+      if (bDuplicate) {
+        OutError = FString::Printf(TEXT("Emitter '%s' is listed twice"), *Emitter.Name);
+        return false;
+      }
+      Emitter.bSetEnabled = (*Obj)->TryGetBoolField(TEXT("enabled"), Emitter.bEnabled);
+      if (!FindNiagaraBuildHandle(System, Emitter.Name)) {
+        FString EmitterPath;
+        (*Obj)->TryGetStringField(TEXT("emitterPath"), EmitterPath);
+        if (EmitterPath.IsEmpty()) {
+          OutError = FString::Printf(TEXT("Emitter '%s' is not in the system; give 'emitterPath' to add it"),
+                                     *Emitter.Name);
+          OutErrorCode = TEXT("EMITTER_NOT_FOUND");
+          return false;
+        }
+        Emitter.Source = LoadObject<UNiagaraEmitter>(nullptr, *EmitterPath);
+        if (!Emitter.Source) {
+          OutError = FString::Printf(TEXT("Could not load Niagara Emitter '%s'"), *EmitterPath);
+          OutErrorCode = TEXT("ASSET_NOT_FOUND");
+          return false;
+        }
+      }
+      for (const TCHAR *Field : {TEXT("modules"), TEXT("renderers")}) {
+        const TArray<TSharedPtr<FJsonValue>> *Entries = GetNiagaraSpecArray(*Obj, Field);
+        if (!Entries) {
+          continue;
+        }
+        for (const TSharedPtr<FJsonValue> &Entry : *Entries) {
+          const TSharedPtr<FJsonObject> *EntryObj = nullptr;
+          if (!Entry.IsValid() || !Entry->TryGetObject(EntryObj)) {
+            OutError = FString::Printf(TEXT("Emitter '%s': '%s' entries must be objects"), *Emitter.Name, Field);
+            return false;
+          }
+          const bool bParsed =
+              FCString::Strcmp(Field, TEXT("modules")) == 0
+                  ? ParseNiagaraSpecModule(*EntryObj, Emitter.Name, Emitter.Modules.AddDefaulted_GetRef(), OutError)
+                  : ParseNiagaraSpecRenderer(*EntryObj, Emitter.Name, Emitter.Renderers.AddDefaulted_GetRef(),
+                                             OutError);
+          if (!bParsed) {
+            OutErrorCode = OutError.Contains(TEXT("could not load")) ? TEXT("ASSET_NOT_FOUND")
+                                                                     : TEXT("INVALID_ARGUMENT");
+            return false;
+          }
+        }
+      }
+    }
+  }
+
+  TArray<FNiagaraSpecParameter> Parameters;
+  for (const TCHAR *Field : {TEXT("userParameters"), TEXT("dataInterfaces")}) {
+    const TArray<TSharedPtr<FJsonValue>> *Array = GetNiagaraSpecArray(Spec, Field);
+    if (!Array) {
+      continue;
+    }
+    const bool bDataInterface = FCString::Strcmp(Field, TEXT("dataInterfaces")) == 0;
+    for (const TSharedPtr<FJsonValue> &Value : *Array) {
+      const TSharedPtr<FJsonObject> *Obj = nullptr;
+      if (!Value.IsValid() || !Value->TryGetObject(Obj)) {
+        OutError = FString::Printf(TEXT("'%s' entries must be objects"), Field);
+        return false;
+      }
+      if (!ParseNiagaraSpecParameter(*Obj, bDataInterface, Parameters.AddDefaulted_GetRef(), OutError)) {
+        return false;
+      }
+    }
+  }
+
+  System->Modify();
+
+  // Add every missing emitter before resolving handles: adding one can
+  // reallocate the handle array.
+  for (const FNiagaraSpecEmitter &Emitter : Emitters) {
+    if (!Emitter.Source) {
+      continue;
+    }
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
+    System->AddEmitterHandle(*Emitter.Source, FName(*Emitter.Name), Emitter.Source->GetExposedVersion().VersionGuid);
+#else
+    System->AddEmitterHandle(*Emitter.Source, FName(*Emitter.Name));
+#endif
+    ++OutResult.EmittersAdded;
+  }
+
+  for (const FNiagaraSpecEmitter &Emitter : Emitters) {
+    FNiagaraEmitterHandle *Handle = FindNiagaraBuildHandle(System, Emitter.Name);
+    if (!Handle) {
+      OutResult.Warnings.Add(FString::Printf(TEXT("Emitter '%s' was not added"), *Emitter.Name));
+      continue;
+    }
+    // Never recompile here; the caller compiles the whole system once.
+    if (Emitter.bSetEnabled && Handle->GetIsEnabled() != Emitter.bEnabled &&
+        Handle->SetIsEnabled(Emitter.bEnabled, *System, /*bRecompileIfChanged=*/false)) {
+      ++OutResult.EmittersToggled;
+    }
+    ApplyNiagaraSpecModules(*Handle, Emitter, OutResult);
+    ApplyNiagaraSpecRenderers(*Handle, Emitter, OutResult);
+  }
+
+  FNiagaraUserRedirectionParameterStore &UserStore = System->GetExposedParameters();
+  for (const FNiagaraSpecParameter &Parameter : Parameters) {
+    const FString Label = Parameter.Variable.GetName().ToString();
+    const bool bAdded = UserStore.AddParameter(Parameter.Variable, /*bInitInterfaces=*/true);
+    if (Parameter.DataInterfaceClass) {
+      UNiagaraDataInterface *DataInterface = UserStore.GetDataInterface(Parameter.Variable);
+      const bool bCreate = !DataInterface || DataInterface->GetClass() != Parameter.DataInterfaceClass;
+      if (bCreate) {
+        DataInterface = NewObject<UNiagaraDataInterface>(System, Parameter.DataInterfaceClass, NAME_None,
+                                                         RF_Transactional | RF_Public);
+      } else if (Parameter.Properties.IsValid()) {
+        DataInterface->Modify();
+      }
+      if (Parameter.Properties.IsValid()) {
+        ApplyNiagaraSpecProperties(DataInterface, Label, Parameter.Properties, OutResult.Warnings);
+      }
+      if (bCreate) {
+        UserStore.SetDataInterface(DataInterface, Parameter.Variable);
+      }
+      OutResult.DataInterfacesSet += (bAdded || bCreate || Parameter.Properties.IsValid()) ? 1 : 0;
+      continue;
+    }
+    bool bValueSet = false;
+    if (Parameter.Value.IsValid()) {
+      bValueSet = SetNiagaraUserParameterValue(UserStore, Parameter.Variable, Parameter.Value);
+      if (!bValueSet) {
+        OutResult.Warnings.Add(FString::Printf(TEXT("%s: value does not match its type"), *Label));
+      }
+    }
+    OutResult.UserParametersSet += (bAdded || bValueSet) ? 1 : 0;
+  }
+  return true;
+}
+
+bool FMcpNiagaraSystemBuilder::IsCompiling(const UNiagaraSystem *System) {
+  for (const TWeakPtr<FNiagaraCompileWatch> &Watch : GNiagaraCompileWatches) {
+    const TSharedPtr<FNiagaraCompileWatch> Pinned = Watch.Pin();
+    if (Pinned.IsValid() && !Pinned->bFinished && Pinned->System.Get() == System) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool FMcpNiagaraSystemBuilder::StartCompile(
+    UNiagaraSystem *System, double TimeoutSeconds, TFunction<bool(float Percent)> OnProgress,
+    TFunction<void(const TSharedPtr<FJsonObject> &Result)> OnFinished, FString &OutError) {
+  check(IsInGameThread() && System);
+  if (IsCompiling(System)) {
+    OutError = FString::Printf(TEXT("Already waiting on a compile of %s"), *System->GetPathName());
+    return false;
+  }
+
+  FNiagaraCompileWatchRef State = MakeShared<FNiagaraCompileWatch>();
+  State->System = System;
+  State->TimeoutSeconds = FMath::Clamp(TimeoutSeconds, 1.0, 3600.0);
+  State->StartSeconds = FPlatformTime::Seconds();
+  State->LastProgressSeconds = State->StartSeconds;
+  State->OnProgress = MoveTemp(OnProgress);
+  State->OnFinished = MoveTemp(OnFinished);
+  GNiagaraCompileWatches.Add(State);
+
+  System->RequestCompile(/*bForce=*/false);
+  FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+      [State](float) { return TickNiagaraCompileWatch(State); }));
+  return true;
+}
+#else
+bool FMcpNiagaraSystemBuilder::Apply(UNiagaraSystem *System, const TSharedPtr<FJsonObject> &Spec,
+                                      FMcpNiagaraSystemBuildResult &OutResult, FString &OutError,
+                                      FString &OutErrorCode) {
+  OutError = TEXT("build_niagara_system requires the editor");
+  OutErrorCode = TEXT("NOT_AVAILABLE");
+  return false;
+}
+
+bool FMcpNiagaraSystemBuilder::IsCompiling(const UNiagaraSystem *System) { return false; }
+
+bool FMcpNiagaraSystemBuilder::StartCompile(
+    UNiagaraSystem *System, double TimeoutSeconds, TFunction<bool(float Percent)> OnProgress,
+    TFunction<void(const TSharedPtr<FJsonObject> &Result)> OnFinished, FString &OutError) {
+  OutError = TEXT("build_niagara_system requires the editor");
+  return false;
+}
+#endif
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "Templates/Function.h"
+
+class UNiagaraSystem;
+
+/** What one build_niagara_system pass changed. */
+struct FMcpNiagaraSystemBuildResult
+{
+    int32 EmittersAdded = 0;
+    int32 ModulesAdded = 0;
+    /** Modules the spec names that the stage already had (same script and module name), so were left alone. */
+    int32 ModulesExisting = 0;
+    int32 RenderersAdded = 0;
+    /** Existing renderers the spec matched (Nth renderer of that type) and edited in place. */
+    int32 RenderersUpdated = 0;
+    int32 UserParametersSet = 0;
+    int32 DataInterfacesSet = 0;
+    /** Emitters whose enabled state changed. */
+    int32 EmittersToggled = 0;
+    /** Modules, renderer properties and parameter values that could not be applied; the rest of the build went ahead. */
+    TArray<FString> Warnings;
+
+    bool HasChanges() const
+    {
+        return EmittersAdded > 0 || ModulesAdded > 0 || RenderersAdded > 0 || RenderersUpdated > 0 ||
+            UserParametersSet > 0 || DataInterfacesSet > 0 || EmittersToggled > 0;
+    }
+
+    TSharedPtr<FJsonObject> ToJson() const;
+};
+
+/**
+ * Assembles a Niagara system from one declarative spec instead of one add_* request per module,
+ * each of which leaves the system dirty for its own recompile. The spec is
+ * { emitters: [{ name, emitterPath?, enabled?, modules?, renderers? }], userParameters?,
+ * dataInterfaces? }: an emitter not yet in the system is added from emitterPath; modules are
+ * [{ script | preset, stage?, name? }] appended to the emitterSpawn, emitterUpdate, particleSpawn
+ * or particleUpdate stack; renderers are [{ type: sprite|mesh|ribbon|light, materialPath?,
+ * meshPath?, properties? }]; userParameters are [{ name, type, value? }]; dataInterfaces are
+ * [{ name, type, properties? }] exposed as user parameters (type is the class name without the
+ * NiagaraDataInterface prefix, e.g. "Spline" or "CurlNoise").
+ *
+ * Every asset the spec references is loaded and checked before the system is touched, and all
+ * edits go through calls that do not request a compile, so the caller compiles once with
+ * StartCompile. Modules and renderers the system already has are matched rather than added
+ * again, so re-sending a spec is cheap. Editor only; game thread only.
+ */
+class FMcpNiagaraSystemBuilder
+{
+public:
+    /**
+     * Applies Spec to System. Returns false with OutError and OutErrorCode, leaving the system as
+     * it was, when the spec is invalid or references an asset that does not load.
+     */
+    static bool Apply(UNiagaraSystem* System, const TSharedPtr<FJsonObject>& Spec,
+        FMcpNiagaraSystemBuildResult& OutResult, FString& OutError, FString& OutErrorCode);
+
+    /**
+     * Requests one compile of System and its emitters' scripts and polls it once per core-ticker
+     * tick, so the editor stays responsive while the shaders and VM scripts build. OnProgress runs
+     * about twice a second with the percent of scripts whose compiled data matches their graph and
+     * cancels the wait (not the compile) by returning false; OnFinished runs once with compiled,
+     * scripts, errors [{ emitter, usage, status }], compileMs, frames, and timedOut or cancelled
+     * when the wait was cut short. Returns false with OutError, calling neither, when System is
+     * already being waited on.
+     */
+    static bool StartCompile(UNiagaraSystem* System, double TimeoutSeconds,
+        TFunction<bool(float Percent)> OnProgress,
+        TFunction<void(const TSharedPtr<FJsonObject>& Result)> OnFinished, FString& OutError);
+
+    static bool IsCompiling(const UNiagaraSystem* System);
+};
@@ -0,0 +1,307 @@
+#include "McpPackedArray.h"
+
+#include "Dom/JsonValue.h"
+#include "Misc/Base64.h"
+#include "UObject/Class.h"
+
+namespace {
+enum class EPackedArrayCodec : uint8 { None, Memcpy, Transform };
+
+struct FPackedArrayLayout {
+  EPackedArrayCodec Codec = EPackedArrayCodec::None;
+  /** Bytes per element on the wire. */
+  int32 WireSize = 0;
+  FString Layout;
+  FString ElementType;
+};
+
+struct FPackedLeaf {
+  int32 Offset = 0;
+  int32 Size = 0;
+  const TCHAR *Token = nullptr;
+};
+
+const TCHAR *PackedNumericToken(const FProperty *Property) {
+  if (CastField<FFloatProperty>(Property))
+    return TEXT("f32");
+  if (CastField<FDoubleProperty>(Property))
+    return TEXT("f64");
+  if (CastField<FInt8Property>(Property))
+    return TEXT("i8");
+  if (CastField<FInt16Property>(Property))
+    return TEXT("i16");
+  if (CastField<FIntProperty>(Property))
+    return TEXT("i32");
+  if (CastField<FInt64Property>(Property))
+    return TEXT("i64");
+  if (CastField<FByteProperty>(Property))
+    return TEXT("u8");
+  if (CastField<FUInt16Property>(Property))
+    return TEXT("u16");
+  if (CastField<FUInt32Property>(Property))
+    return TEXT("u32");
+  if (CastField<FUInt64Property>(Property))
+    return TEXT("u64");
+  return nullptr;
+}
+
+// Gathers the numeric leaves of Struct; false as soon as a member is anything
+// other than a single number or a nested struct of them.
+bool CollectPackedLeaves(const UStruct *Struct, int32 BaseOffset,
+                         TArray<FPackedLeaf> &OutLeaves) {
+  for (TFieldIterator<FProperty> It(Struct); It; ++It) {
+    const FProperty *Member = *It;
+    if (Member->ArrayDim != 1) {
+      return false;
+    }
+    const int32 Offset = BaseOffset + Member->GetOffset_ForInternal();
+    if (const FStructProperty *Nested = CastField<FStructProperty>(Member)) {
+      if (!CollectPackedLeaves(Nested->Struct, Offset, OutLeaves)) {
+        return false;
+      }
+      continue;
+    }
+    const TCHAR *Token = PackedNumericToken(Member);
+    if (!Token) {
+      return false;
+    }
+    OutLeaves.Add({Offset, Member->GetSize(), Token});
+  }
+  return true;
+}
+
+// "f64x3" for uniform leaves, "f32,i32" otherwise.
+FString JoinPackedTokens(const TArray<const TCHAR *> &Tokens) {
+  bool bUniform = true;
+  for (const TCHAR *Token : Tokens) {
+    bUniform = bUniform && FCString::Strcmp(Token, Tokens[0]) == 0;
+  }
+  if (bUniform) {
+    return Tokens.Num() == 1
+               ? FString(Tokens[0])
+               : FString::Printf(TEXT("%sx%d"), Tokens[0], Tokens.Num());
+  }
+  return FString::Join(Tokens, TEXT(","));
+}
+
+FPackedArrayLayout ResolvePackedLayout(const FProperty *Inner) {
+  FPackedArrayLayout Out;
+#if PLATFORM_LITTLE_ENDIAN
+  if (!Inner || Inner->ArrayDim != 1) {
+    return Out;
+  }
+  if (const TCHAR *Token = PackedNumericToken(Inner)) {
+    Out.Codec = EPackedArrayCodec::Memcpy;
+    Out.WireSize = Inner->GetSize();
+    Out.Layout = Token;
+    Out.ElementType = Token;
+    return Out;
+  }
+  const FStructProperty *StructInner = CastField<FStructProperty>(Inner);
+  if (!StructInner || !StructInner->Struct) {
+    return Out;
+  }
+  UScriptStruct *Struct = StructInner->Struct;
+  if (Struct == TBaseStructure<FTransform>::Get()) {
+    Out.Codec = EPackedArrayCodec::Transform;
+    Out.WireSize = 10 * sizeof(double);
+    Out.Layout = TEXT("f64x10");
+    Out.ElementType = Struct->GetName();
+    return Out;
+  }
+
+  // Copyable as raw bytes only if the leaves tile the struct with no gaps,
+  // i.e. there is no padding and no unreflected member.
+  TArray<FPackedLeaf> Leaves;
+  if (!CollectPackedLeaves(Struct, 0, Leaves) || Leaves.Num() == 0) {
+    return Out;
+  }
+  Leaves.Sort([](const FPackedLeaf &A, const FPackedLeaf &B) {
+    return A.Offset < B.Offset;
+  });
+  int32 Cursor = 0;
+  TArray<const TCHAR *> Tokens;
+  for (const FPackedLeaf &Leaf : Leaves) {
+    if (Leaf.Offset != Cursor) {
+      return Out;
+    }
+    Cursor += Leaf.Size;
+    Tokens.Add(Leaf.Token);
+  }
+  if (Cursor != Struct->GetStructureSize() || Cursor != Inner->GetSize()) {
+    return Out;
+  }
+  Out.Codec = EPackedArrayCodec::Memcpy;
+  Out.WireSize = Cursor;
+  Out.Layout = JoinPackedTokens(Tokens);
+  Out.ElementType = Struct->GetName();
+#endif
+  return Out;
+}
+} // namespace
+
+bool FMcpPackedArray::IsPackedValue(const TSharedPtr<FJsonValue> &Value) {
+  if (!Value.IsValid() || Value->Type != EJson::Object) {
+    return false;
+  }
+  const TSharedPtr<FJsonObject> Object = Value->AsObject();
+  FString Encoding;
+  return Object.IsValid() &&
+         Object->TryGetStringField(TEXT("encoding"), Encoding) &&
+         Encoding.Equals(TEXT("base64"), ESearchCase::IgnoreCase);
+}
+
+FString FMcpPackedArray::DescribeLayout(const FProperty *Inner) {
+  return ResolvePackedLayout(Inner).Layout;
+}
+
+TSharedPtr<FJsonValue> FMcpPackedArray::Export(const FArrayProperty *Property,
+                                               const void *ArrayPtr) {
+  if (!Property || !ArrayPtr) {
+    return nullptr;
+  }
+  const FPackedArrayLayout Layout = ResolvePackedLayout(Property->Inner);
+  if (Layout.Codec == EPackedArrayCodec::None) {
+    return nullptr;
+  }
+
+  FScriptArrayHelper Helper(Property, ArrayPtr);
+  const int32 Count = Helper.Num();
+  FString Data;
+  if (Count > 0) {
+    if (Layout.Codec == EPackedArrayCodec::Memcpy) {
+      Data = FBase64::Encode(Helper.GetRawPtr(0),
+                             static_cast<uint32>(Count * Layout.WireSize));
+    } else {
+      TArray<double> Doubles;
+      Doubles.Reserve(Count * 10);
+      for (int32 Index = 0; Index < Count; ++Index) {
+        const FTransform &Transform =
+            *reinterpret_cast<const FTransform *>(Helper.GetRawPtr(Index));
+        const FQuat Rotation = Transform.GetRotation();
+        const FVector Translation = Transform.GetTranslation();
+        const FVector Scale = Transform.GetScale3D();
+        Doubles.Append({Rotation.X, Rotation.Y, Rotation.Z, Rotation.W,
+                        Translation.X, Translation.Y, Translation.Z, Scale.X,
+                        Scale.Y, Scale.Z});
+      }
+      Data = FBase64::Encode(reinterpret_cast<const uint8 *>(Doubles.GetData()),
+                             static_cast<uint32>(Doubles.Num() * sizeof(double)));
+    }
+  }
+
+  TSharedPtr<FJsonObject> Out = MakeShared<FJsonObject>();
+  Out->SetStringField(TEXT("encoding"), TEXT("base64"));
+  Out->SetStringField(TEXT("elementType"), Layout.ElementType);
+  Out->SetStringField(TEXT("layout"), Layout.Layout);
+  Out->SetNumberField(TEXT("count"), Count);
+  Out->SetStringField(TEXT("data"), Data);
+  return MakeShared<FJsonValueObject>(Out);
+}
+
+bool FMcpPackedArray::Apply(const FArrayProperty *Property, void *ArrayPtr,
+                            const FJsonObject &Packed, FString &OutError) {
+  const FPackedArrayLayout Layout =
+      ResolvePackedLayout(Property ? Property->Inner : nullptr);
+  if (!ArrayPtr || Layout.Codec == EPackedArrayCodec::None) {
+    OutError = TEXT("Packed arrays are only supported for numeric elements "
+                    "and plain numeric structs");
+    return false;
+  }
+
+  FString ExpectedLayout;
+  if (Packed.TryGetStringField(TEXT("layout"), ExpectedLayout) &&
+      !ExpectedLayout.Equals(Layout.Layout, ESearchCase::IgnoreCase)) {
+    OutError =
+        FString::Printf(TEXT("Packed layout '%s' does not match the "
+                             "property's element layout '%s'"),
+                        *ExpectedLayout, *Layout.Layout);
+    return false;
+  }
+
+  FString Data;
+  Packed.TryGetStringField(TEXT("data"), Data);
+  const uint32 ByteCount = FBase64::GetDecodedDataSize(*Data, Data.Len());
+  if (ByteCount % Layout.WireSize != 0) {
+    OutError = FString::Printf(
+        TEXT("Packed data is %u bytes, not a whole number of %d-byte "
+             "elements"),
+        ByteCount, Layout.WireSize);
+    return false;
+  }
+  const int32 Count = static_cast<int32>(ByteCount / Layout.WireSize);
+  double DeclaredCount = 0.0;
+  if (Packed.TryGetNumberField(TEXT("count"), DeclaredCount) &&
+      static_cast<int32>(DeclaredCount) != Count) {
+    OutError = FString::Printf(
+        TEXT("Packed count %d does not match the %d elements in data"),
+        static_cast<int32>(DeclaredCount), Count);
+    return false;
+  }
+
+  FScriptArrayHelper Helper(Property, ArrayPtr);
+  if (Count == 0) {
+    Helper.EmptyValues();
+    return true;
+  }
+
+  if (Layout.Codec == EPackedArrayCodec::Memcpy) {
+    // Elements are plain numbers, so the decoder can write straight into the
+    // array's storage.
+    Helper.Resize(Count);
+    if (!FBase64::Decode(*Data, Data.Len(), Helper.GetRawPtr(0))) {
+      Helper.EmptyValues();
+      OutError = TEXT("Packed data is not valid base64");
+      return false;
+    }
+    return true;
+  }
+
+  TArray<double> Doubles;
+  Doubles.SetNumUninitialized(Count * 10);
+  if (!FBase64::Decode(*Data, Data.Len(),
+                       reinterpret_cast<uint8 *>(Doubles.GetData()))) {
+    OutError = TEXT("Packed data is not valid base64");
+    return false;
+  }
+  Helper.Resize(Count);
+  for (int32 Index = 0; Index < Count; ++Index) {
+    const double *D = &Doubles[Index * 10];
+    *reinterpret_cast<FTransform *>(Helper.GetRawPtr(Index)) =
+        FTransform(FQuat(D[0], D[1], D[2], D[3]), FVector(D[4], D[5], D[6]),
+                   FVector(D[7], D[8], D[9]));
+  }
+  return true;
+}
+
+bool FMcpPackedArray::DecodeRaw(const FJsonObject &Packed, int32 ElementSize,
+                                TArray<uint8> &OutBytes, int32 &OutCount,
+                                FString &OutError) {
+  check(ElementSize > 0);
+  FString Data;
+  Packed.TryGetStringField(TEXT("data"), Data);
+  const uint32 ByteCount = FBase64::GetDecodedDataSize(*Data, Data.Len());
+  if (ByteCount % ElementSize != 0) {
+    OutError = FString::Printf(
+        TEXT("Packed data is %u bytes, not a whole number of %d-byte "
+             "elements"),
+        ByteCount, ElementSize);
+    return false;
+  }
+  OutCount = static_cast<int32>(ByteCount / ElementSize);
+  double DeclaredCount = 0.0;
+  if (Packed.TryGetNumberField(TEXT("count"), DeclaredCount) &&
+      static_cast<int32>(DeclaredCount) != OutCount) {
+    OutError = FString::Printf(
+        TEXT("Packed count %d does not match the %d elements in data"),
+        static_cast<int32>(DeclaredCount), OutCount);
+    return false;
+  }
+  OutBytes.SetNumUninitialized(ByteCount);
+  if (ByteCount > 0 && !FBase64::Decode(*Data, Data.Len(), OutBytes.GetData())) {
+    OutBytes.Reset();
+    OutError = TEXT("Packed data is not valid base64");
+    return false;
+  }
+  return true;
+}
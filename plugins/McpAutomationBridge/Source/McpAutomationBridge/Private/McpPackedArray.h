@@ -0,0 +1,44 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "UObject/UnrealType.h"
+
+/**
+ * Packed wire form for arrays of plain numbers or plain-number structs, so a spline point list or
+ * curve crosses the bridge as one base64 string instead of one FJsonValue per component:
+ *
+ *   { "encoding": "base64", "elementType": "Vector", "layout": "f64x3", "count": 2, "data": "..." }
+ *
+ * data is the elements back to back, little-endian, as the layout lists them (f32, f64, i8..i64,
+ * u8..u64). Element types whose reflected members are all numbers and fill the struct exactly
+ * (FVector, FVector2D, FLinearColor, FColor, FIntPoint, plain numeric arrays) are copied straight
+ * between the wire bytes and the array storage. FTransform has SIMD padding, so it is packed as ten
+ * doubles: rotation x y z w, translation x y z, scale x y z.
+ */
+class FMcpPackedArray
+{
+public:
+    /** True for a JSON object carrying "encoding": "base64". */
+    static bool IsPackedValue(const TSharedPtr<FJsonValue>& Value);
+
+    /** Element layout ("f32", "f64x3", "f32,i32", ...); empty when Inner cannot be packed. */
+    static FString DescribeLayout(const FProperty* Inner);
+
+    /** Packed form of the array at ArrayPtr, or null when its element type cannot be packed. */
+    static TSharedPtr<FJsonValue> Export(const FArrayProperty* Property, const void* ArrayPtr);
+
+    /**
+     * Replaces the array at ArrayPtr with the decoded elements. A "layout" in the payload is
+     * optional but, when present, has to match the property's; that catches float/double mixups.
+     */
+    static bool Apply(const FArrayProperty* Property, void* ArrayPtr, const FJsonObject& Packed,
+                      FString& OutError);
+
+    /**
+     * Decodes "data" as ElementSize-byte elements for callers that unpack the bytes themselves
+     * (no reflected property to copy into). Checks "count" when present; "layout" is the caller's.
+     */
+    static bool DecodeRaw(const FJsonObject& Packed, int32 ElementSize, TArray<uint8>& OutBytes,
+                          int32& OutCount, FString& OutError);
+};
@@ -0,0 +1,282 @@
+#include "McpPropertyAccessPlan.h"
+
+#include "UObject/UObjectGlobals.h"
+
+#if WITH_EDITOR
+#include "Editor.h"
+#endif
+
+namespace {
+// Typed accessors. Conversions mirror ExportPropertyToJsonValue and
+// ApplyJsonValueToProperty for the same kinds, including their error text.
+TSharedPtr<FJsonValue> PlanExportBool(const FProperty *Property,
+                                      const void *ValuePtr) {
+  return MakeShared<FJsonValueBoolean>(
+      static_cast<const FBoolProperty *>(Property)->GetPropertyValue(ValuePtr));
+}
+
+TSharedPtr<FJsonValue> PlanExportStr(const FProperty *, const void *ValuePtr) {
+  return MakeShared<FJsonValueString>(*static_cast<const FString *>(ValuePtr));
+}
+
+TSharedPtr<FJsonValue> PlanExportName(const FProperty *, const void *ValuePtr) {
+  return MakeShared<FJsonValueString>(
+      static_cast<const FName *>(ValuePtr)->ToString());
+}
+
+template <typename T>
+TSharedPtr<FJsonValue> PlanExportNumber(const FProperty *,
+                                        const void *ValuePtr) {
+  return MakeShared<FJsonValueNumber>(
+      static_cast<double>(*static_cast<const T *>(ValuePtr)));
+}
+
+bool PlanApplyBool(const FProperty *Property, void *ValuePtr,
+                   const FJsonValue &Value, FString &OutError) {
+  const FBoolProperty *BoolProp = static_cast<const FBoolProperty *>(Property);
+  if (Value.Type == EJson::Boolean) {
+    BoolProp->SetPropertyValue(ValuePtr, Value.AsBool());
+    return true;
+  }
+  if (Value.Type == EJson::Number) {
+    BoolProp->SetPropertyValue(ValuePtr, Value.AsNumber() != 0.0);
+    return true;
+  }
+  if (Value.Type == EJson::String) {
+    BoolProp->SetPropertyValue(
+        ValuePtr, Value.AsString().Equals(TEXT("true"), ESearchCase::IgnoreCase));
+    return true;
+  }
+  OutError = TEXT("Unsupported JSON type for bool property");
+  return false;
+}
+
+bool PlanApplyStr(const FProperty *, void *ValuePtr, const FJsonValue &Value,
+                  FString &OutError) {
+  if (Value.Type != EJson::String) {
+    OutError = TEXT("Expected string for string property");
+    return false;
+  }
+  *static_cast<FString *>(ValuePtr) = Value.AsString();
+  return true;
+}
+
+bool PlanApplyName(const FProperty *, void *ValuePtr, const FJsonValue &Value,
+                   FString &OutError) {
+  if (Value.Type != EJson::String) {
+    OutError = TEXT("Expected string for name property");
+    return false;
+  }
+  *static_cast<FName *>(ValuePtr) = FName(*Value.AsString());
+  return true;
+}
+
+template <typename T>
+bool PlanApplyReal(const FProperty *, void *ValuePtr, const FJsonValue &Value,
+                   FString &OutError) {
+  double Parsed = 0.0;
+  if (Value.Type == EJson::Number) {
+    Parsed = Value.AsNumber();
+  } else if (Value.Type == EJson::String) {
+    Parsed = FCString::Atod(*Value.AsString());
+  } else {
+    OutError = sizeof(T) == sizeof(float)
+                   ? TEXT("Unsupported JSON type for float property")
+                   : TEXT("Unsupported JSON type for double property");
+    return false;
+  }
+  *static_cast<T *>(ValuePtr) = static_cast<T>(Parsed);
+  return true;
+}
+
+template <typename T>
+bool PlanApplyInteger(const FProperty *, void *ValuePtr, const FJsonValue &Value,
+                      FString &OutError) {
+  int64 Parsed = 0;
+  if (Value.Type == EJson::Number) {
+    Parsed = static_cast<int64>(Value.AsNumber());
+  } else if (Value.Type == EJson::String) {
+    Parsed = FCString::Atoi64(*Value.AsString());
+  } else {
+    OutError = sizeof(T) == sizeof(int32)
+                   ? TEXT("Unsupported JSON type for int property")
+                   : TEXT("Unsupported JSON type for int64 property");
+    return false;
+  }
+  *static_cast<T *>(ValuePtr) = static_cast<T>(Parsed);
+  return true;
+}
+
+void BindPlanAccessors(FMcpPropertyAccessPlan &Plan) {
+  const FProperty *Property = Plan.Property;
+  if (CastField<FBoolProperty>(Property)) {
+    Plan.Export = &PlanExportBool;
+    Plan.Apply = &PlanApplyBool;
+  } else if (CastField<FStrProperty>(Property)) {
+    Plan.Export = &PlanExportStr;
+    Plan.Apply = &PlanApplyStr;
+  } else if (CastField<FNameProperty>(Property)) {
+    Plan.Export = &PlanExportName;
+    Plan.Apply = &PlanApplyName;
+  } else if (CastField<FFloatProperty>(Property)) {
+    Plan.Export = &PlanExportNumber<float>;
+    Plan.Apply = &PlanApplyReal<float>;
+  } else if (CastField<FDoubleProperty>(Property)) {
+    Plan.Export = &PlanExportNumber<double>;
+    Plan.Apply = &PlanApplyReal<double>;
+  } else if (CastField<FIntProperty>(Property)) {
+    Plan.Export = &PlanExportNumber<int32>;
+    Plan.Apply = &PlanApplyInteger<int32>;
+  } else if (CastField<FInt64Property>(Property)) {
+    Plan.Export = &PlanExportNumber<int64>;
+    Plan.Apply = &PlanApplyInteger<int64>;
+  }
+}
+} // namespace
+
+FMcpPropertyAccessCache::FMcpPropertyAccessCache() {
+  // Hot reload and Live Coding patch classes in place.
+  ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda(
+      [this](EReloadCompleteReason) { Invalidate(); });
+#if WITH_EDITOR
+  // A recompile regenerates the class's properties, reusing the class.
+  if (GEditor) {
+    BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddRaw(
+        this, &FMcpPropertyAccessCache::Invalidate);
+  }
+#endif
+}
+
+FMcpPropertyAccessCache::~FMcpPropertyAccessCache() {
+  FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+#if WITH_EDITOR
+  if (GEditor) {
+    GEditor->OnBlueprintCompiled().Remove(BlueprintCompiledHandle);
+  }
+#endif
+}
+
+void FMcpPropertyAccessCache::Invalidate() {
+  Plans.Reset();
+  NumPlans = 0;
+}
+
+TSharedPtr<const FMcpPropertyAccessPlan>
+FMcpPropertyAccessCache::Resolve(UObject *Root, const FString &Path,
+                                 void *&OutContainer, FString &OutError) {
+  OutError.Empty();
+  OutContainer = nullptr;
+
+  if (!Root) {
+    OutError = TEXT("Root object is null");
+    return nullptr;
+  }
+  if (Path.IsEmpty()) {
+    OutError = TEXT("Property path is empty");
+    return nullptr;
+  }
+
+  UObject *Object = Root;
+  const FString *Remaining = &Path;
+  // Holds the plan Remaining points into, in case compiling the next segment
+  // hits MaxPlans and drops the map.
+  TSharedPtr<const FMcpPropertyAccessPlan> Plan;
+  for (;;) {
+    TSharedPtr<const FMcpPropertyAccessPlan> Next =
+        FindOrCompile(Object->GetClass(), *Remaining, OutError);
+    if (!Next.IsValid()) {
+      return nullptr;
+    }
+    Plan = MoveTemp(Next);
+    void *Container = Plan->GetContainer(Object);
+    if (!Plan->ObjectHop) {
+      OutContainer = Container;
+      return Plan;
+    }
+    Object = Plan->ObjectHop->GetObjectPropertyValue_InContainer(Container);
+    if (!Object) {
+      OutError = FString::Printf(TEXT("Object property '%s' is null"),
+                                 *Plan->ObjectHop->GetName());
+      return nullptr;
+    }
+    Remaining = &Plan->Remainder;
+  }
+}
+
+TSharedPtr<const FMcpPropertyAccessPlan>
+FMcpPropertyAccessCache::FindOrCompile(UClass *Class, const FString &Path,
+                                       FString &OutError) {
+  FClassPlans *ClassPlans = Plans.Find(Class);
+  if (ClassPlans && !ClassPlans->Class.IsValid()) {
+    // The class was collected and its address reused.
+    NumPlans -= ClassPlans->ByPath.Num();
+    Plans.Remove(Class);
+    ClassPlans = nullptr;
+  }
+  if (ClassPlans) {
+    if (const TSharedRef<const FMcpPropertyAccessPlan> *Found =
+            ClassPlans->ByPath.Find(Path)) {
+      return *Found;
+    }
+  }
+
+  TArray<FString> Segments;
+  Path.ParseIntoArray(Segments, TEXT("."), true);
+  if (Segments.Num() == 0) {
+    OutError = TEXT("Invalid property path format");
+    return nullptr;
+  }
+
+  TSharedRef<FMcpPropertyAccessPlan> Plan =
+      MakeShared<FMcpPropertyAccessPlan>();
+  UStruct *Scope = Class;
+  for (int32 Index = 0; Index < Segments.Num(); ++Index) {
+    const FString &Segment = Segments[Index];
+    FProperty *Property = FindFProperty<FProperty>(Scope, FName(*Segment));
+    if (!Property) {
+      OutError = FString::Printf(
+          TEXT("Property '%s' not found in scope '%s' (segment %d of %d)"),
+          *Segment, *Scope->GetName(), Index + 1, Segments.Num());
+      return nullptr;
+    }
+
+    if (Index == Segments.Num() - 1) {
+      Plan->Property = Property;
+      BindPlanAccessors(*Plan);
+      break;
+    }
+
+    if (FObjectProperty *ObjectProp = CastField<FObjectProperty>(Property)) {
+      // The referenced object's runtime class decides how the rest resolves.
+      Plan->ObjectHop = ObjectProp;
+      for (int32 Rest = Index + 1; Rest < Segments.Num(); ++Rest) {
+        if (Rest > Index + 1) {
+          Plan->Remainder += TEXT(".");
+        }
+        Plan->Remainder += Segments[Rest];
+      }
+      break;
+    }
+    if (FStructProperty *StructProp = CastField<FStructProperty>(Property)) {
+      Plan->ContainerOffset += StructProp->GetOffset_ForInternal();
+      Scope = StructProp->Struct;
+      continue;
+    }
+    OutError = FString::Printf(
+        TEXT("Cannot traverse into property '%s' of type '%s'"), *Segment,
+        *Property->GetClass()->GetName());
+    return nullptr;
+  }
+
+  if (NumPlans >= MaxPlans) {
+    Invalidate();
+    ClassPlans = nullptr;
+  }
+  if (!ClassPlans) {
+    ClassPlans = &Plans.Add(Class);
+    ClassPlans->Class = Class;
+  }
+  ++NumPlans;
+  ClassPlans->ByPath.Add(Path, Plan);
+  return Plan;
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonValue.h"
+#include "UObject/UnrealType.h"
+#include "UObject/WeakObjectPtr.h"
+
+/**
+ * A property path resolved once against a class: the byte offset from the object to the container
+ * that holds the leaf (struct hops folded in), the leaf property, and typed accessors for the
+ * scalar kinds. A path that crosses an object reference ends its plan at that reference; the rest
+ * of the path gets its own plan keyed by the referenced object's class.
+ */
+struct FMcpPropertyAccessPlan
+{
+    using FExportFn = TSharedPtr<FJsonValue> (*)(const FProperty* Property, const void* ValuePtr);
+    using FApplyFn = bool (*)(const FProperty* Property, void* ValuePtr, const FJsonValue& Value,
+                              FString& OutError);
+
+    /** Offset from the object to the container holding Property (or ObjectHop). */
+    int32 ContainerOffset = 0;
+    /** Terminal property; null while ObjectHop is set. */
+    FProperty* Property = nullptr;
+    /** Object reference the path continues through, with the remaining segments. */
+    FObjectProperty* ObjectHop = nullptr;
+    FString Remainder;
+    /** Set for bool, numeric, string and name leaves; others go through the generic converters. */
+    FExportFn Export = nullptr;
+    FApplyFn Apply = nullptr;
+
+    void* GetContainer(UObject* Object) const
+    {
+        return reinterpret_cast<uint8*>(Object) + ContainerOffset;
+    }
+};
+
+/**
+ * Game-thread cache of FMcpPropertyAccessPlan keyed by (class, path), for get/set_object_property.
+ * Entries hold raw FProperty pointers, so the whole cache is dropped whenever classes can change
+ * layout: hot reload / Live Coding and Blueprint compiles. Classes that were garbage collected are
+ * detected through a weak pointer and recompiled.
+ */
+class FMcpPropertyAccessCache
+{
+public:
+    FMcpPropertyAccessCache();
+    ~FMcpPropertyAccessCache();
+
+    FMcpPropertyAccessCache(const FMcpPropertyAccessCache&) = delete;
+    FMcpPropertyAccessCache& operator=(const FMcpPropertyAccessCache&) = delete;
+
+    /**
+     * Resolves a dotted path against Root, following object references, and returns the plan for
+     * the terminal property with OutContainer pointing at its container. On failure returns null
+     * and fills OutError in the wording ResolveNestedPropertyPath uses. The returned plan
+     * outlives an invalidation, but its property pointer does not outlive a recompile.
+     */
+    TSharedPtr<const FMcpPropertyAccessPlan> Resolve(UObject* Root, const FString& Path, void*& OutContainer,
+                                          FString& OutError);
+
+    void Invalidate();
+
+    int32 Num() const { return NumPlans; }
+
+private:
+    struct FClassPlans
+    {
+        TWeakObjectPtr<UClass> Class;
+        TMap<FString, TSharedRef<const FMcpPropertyAccessPlan>> ByPath;
+    };
+
+    TSharedPtr<const FMcpPropertyAccessPlan> FindOrCompile(UClass* Class, const FString& Path, FString& OutError);
+
+    /** Bound on cached plans; the cache starts over rather than tracking recency. */
+    static constexpr int32 MaxPlans = 4096;
+
+    TMap<const UClass*, FClassPlans> Plans;
+    int32 NumPlans = 0;
+    FDelegateHandle ReloadCompleteHandle;
+    FDelegateHandle BlueprintCompiledHandle;
+};
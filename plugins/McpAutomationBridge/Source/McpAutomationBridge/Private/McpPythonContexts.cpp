@@ -0,0 +1,383 @@
+#include "McpPythonContexts.h"
+
+#include "Misc/Base64.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+#if WITH_EDITOR && __has_include("IPythonScriptPlugin.h")
+#include "IPythonScriptPlugin.h"
+#define MCP_PYTHON_CONTEXTS_HAS_PLUGIN 1
+#else
+#define MCP_PYTHON_CONTEXTS_HAS_PLUGIN 0
+#endif
+
+namespace {
+// Installed once as sys.modules['_mcp_bridge']. Every entry point returns its
+// reply as base64-encoded JSON so the result survives the interpreter's string
+// repr unchanged whatever the script printed or returned.
+const TCHAR *McpPyBridgeModuleSource = TEXT(R"PY(
+import base64
+import builtins
+import itertools
+import json
+import sys
+import time
+import traceback
+import types
+
+_contexts = {}
+_scripts = {}
+_sources = {}
+_runs = {}
+_run_ids = itertools.count(1)
+
+
+class _Capture(object):
+    def __init__(self):
+        self.parts = []
+
+    def write(self, text):
+        self.parts.append(text)
+
+    def flush(self):
+        pass
+
+    def text(self):
+        return ''.join(self.parts)
+
+
+class _Redirect(object):
+    def __enter__(self):
+        self.capture = _Capture()
+        self.saved = (sys.stdout, sys.stderr)
+        sys.stdout = sys.stderr = self.capture
+        return self.capture
+
+    def __exit__(self, *exc):
+        sys.stdout, sys.stderr = self.saved
+        return False
+
+
+def _reply(**members):
+    try:
+        text = json.dumps(members, default=str, allow_nan=False)
+    except (TypeError, ValueError):
+        members['result'] = repr(members.get('result'))
+        text = json.dumps(members, default=str)
+    return base64.b64encode(text.encode('utf-8')).decode('ascii')
+
+
+def _text(encoded):
+    return base64.b64decode(encoded).decode('utf-8') if encoded else ''
+
+
+def _exception():
+    kind, value = sys.exc_info()[:2]
+    return '%s: %s' % (kind.__name__, value)
+
+
+def _globals(name):
+    scope = _contexts.get(name)
+    if scope is None:
+        scope = {'__name__': '__mcp_%s__' % name.replace('.', '_').replace('-', '_'),
+                 '__builtins__': builtins}
+        _contexts[name] = scope
+    return scope
+
+
+def _compile(source, filename):
+    try:
+        return compile(source, filename, 'exec'), None
+    except SyntaxError as error:
+        return None, 'SyntaxError: %s (line %s)' % (error.msg, error.lineno)
+
+
+def register(handle, source):
+    source = _text(source)
+    code, error = _compile(source, '<mcp:%s>' % handle)
+    if code is None:
+        return _reply(ok=False, error=error, code='PYTHON_SYNTAX_ERROR')
+    _scripts[handle] = code
+    _sources[handle] = len(source)
+    return _reply(ok=True, handle=handle)
+
+
+def unregister(handle):
+    _sources.pop(handle, None)
+    return _reply(ok=True, removed=_scripts.pop(handle, None) is not None)
+
+
+def invoke(handle, context, args, source):
+    if handle:
+        code = _scripts.get(handle)
+        if code is None:
+            return _reply(ok=False, error='No script registered as %s' % handle, code='UNKNOWN_SCRIPT')
+    else:
+        code, error = _compile(_text(source), '<mcp:inline>')
+        if code is None:
+            return _reply(ok=False, error=error, code='PYTHON_SYNTAX_ERROR')
+    scope = _globals(context)
+    scope['args'] = json.loads(_text(args)) if args else {}
+    scope.pop('result', None)
+    started = time.perf_counter()
+    with _Redirect() as capture:
+        try:
+            exec(code, scope)
+        except BaseException:
+            return _reply(ok=False, error=_exception(), traceback=traceback.format_exc(),
+                          output=capture.text(), code='PYTHON_EXECUTION_FAILED')
+    result = scope.pop('result', None)
+    elapsed = (time.perf_counter() - started) * 1000.0
+    if isinstance(result, types.GeneratorType):
+        run_id = 'run-%d' % next(_run_ids)
+        _runs[run_id] = result
+        return _reply(ok=True, running=run_id, output=capture.text(), ms=elapsed)
+    return _reply(ok=True, result=result, output=capture.text(), ms=elapsed)
+
+
+def step(run_id, budget_ms):
+    generator = _runs.get(run_id)
+    if generator is None:
+        return _reply(ok=False, error='No active run %s' % run_id, code='UNKNOWN_RUN')
+    deadline = time.perf_counter() + max(budget_ms, 0.0) / 1000.0
+    progress = None
+    message = None
+    with _Redirect() as capture:
+        try:
+            while True:
+                value = next(generator)
+                if isinstance(value, str):
+                    message = value
+                elif isinstance(value, dict):
+                    progress = value.get('progress', progress)
+                    message = value.get('message', message)
+                elif isinstance(value, (int, float)) and not isinstance(value, bool):
+                    progress = float(value)
+                if time.perf_counter() >= deadline:
+                    break
+        except StopIteration as stop:
+            _runs.pop(run_id, None)
+            return _reply(ok=True, done=True, result=stop.value, output=capture.text())
+        except BaseException:
+            _runs.pop(run_id, None)
+            return _reply(ok=False, done=True, error=_exception(), traceback=traceback.format_exc(),
+                          output=capture.text(), code='PYTHON_EXECUTION_FAILED')
+    return _reply(ok=True, done=False, progress=progress, message=message, output=capture.text())
+
+
+def cancel(run_id):
+    generator = _runs.pop(run_id, None)
+    if generator is not None:
+        with _Redirect():
+            try:
+                generator.close()
+            except BaseException:
+                pass
+    return _reply(ok=True)
+
+
+def reset(context):
+    if context:
+        _contexts.pop(context, None)
+    else:
+        _contexts.clear()
+    return _reply(ok=True)
+
+
+def describe():
+    return _reply(ok=True,
+                  contexts=[{'name': name, 'globals': len(scope)} for name, scope in sorted(_contexts.items())],
+                  scripts=[{'handle': handle, 'sourceLength': length} for handle, length in sorted(_sources.items())],
+                  runs=sorted(_runs))
+)PY");
+
+FString McpPyEncode(const FString &Text) {
+  const FTCHARToUTF8 Utf8(*Text);
+  return FBase64::Encode(reinterpret_cast<const uint8 *>(Utf8.Get()),
+                         Utf8.Length());
+}
+
+#if MCP_PYTHON_CONTEXTS_HAS_PLUGIN
+bool McpPyExec(EPythonCommandExecutionMode Mode, const FString &Command,
+               FString &OutResult) {
+  IPythonScriptPlugin *Python = IPythonScriptPlugin::Get();
+  if (!Python || !Python->IsPythonAvailable()) {
+    OutResult = TEXT("Python scripting plugin not available. Ensure "
+                     "PythonScriptPlugin is enabled in your project.");
+    return false;
+  }
+  FPythonCommandEx PythonCommand;
+  PythonCommand.ExecutionMode = Mode;
+  PythonCommand.Flags |= EPythonCommandFlags::Unattended;
+  PythonCommand.Command = Command;
+  const bool bOk = Python->ExecPythonCommandEx(PythonCommand);
+  OutResult = MoveTemp(PythonCommand.CommandResult);
+  return bOk;
+}
+
+bool McpPyEnsureBridgeModule(FString &OutError) {
+  static bool bInstalled = false;
+  if (bInstalled) {
+    return true;
+  }
+  // The module body travels base64-encoded so none of its quoting has to
+  // survive a Python string literal.
+  const FString Bootstrap = FString::Printf(
+      TEXT("import base64, sys, types\n"
+           "if '_mcp_bridge' not in sys.modules:\n"
+           "    _module = types.ModuleType('_mcp_bridge')\n"
+           "    exec(compile(base64.b64decode('%s').decode('utf-8'), "
+           "'<mcp_bridge>', 'exec'), _module.__dict__)\n"
+           "    sys.modules['_mcp_bridge'] = _module\n"),
+      *McpPyEncode(McpPyBridgeModuleSource));
+  FString Result;
+  if (!McpPyExec(EPythonCommandExecutionMode::ExecuteFile, Bootstrap, Result)) {
+    OutError = FString::Printf(TEXT("Failed to install the Python bridge "
+                                    "module: %s"),
+                               *Result);
+    return false;
+  }
+  bInstalled = true;
+  return true;
+}
+#endif
+
+// Evaluates one _mcp_bridge call, e.g. "invoke('h', 'ctx', '', '')", and
+// decodes its JSON reply.
+bool McpPyCallBridge(const FString &Call, TSharedPtr<FJsonObject> &OutReply,
+                     FString &OutError) {
+#if MCP_PYTHON_CONTEXTS_HAS_PLUGIN
+  if (!McpPyEnsureBridgeModule(OutError)) {
+    return false;
+  }
+  FString Result;
+  if (!McpPyExec(EPythonCommandExecutionMode::EvaluateStatement,
+                 TEXT("__import__('_mcp_bridge').") + Call, Result)) {
+    OutError = Result.IsEmpty() ? TEXT("Python bridge call failed") : Result;
+    return false;
+  }
+  // The evaluated str may come back as its repr.
+  FString Encoded = Result.TrimStartAndEnd();
+  if (Encoded.Len() >= 2 && (Encoded[0] == TEXT('\'') || Encoded[0] == TEXT('"'))) {
+    Encoded = Encoded.Mid(1, Encoded.Len() - 2);
+  }
+  TArray<uint8> Bytes;
+  if (!FBase64::Decode(Encoded, Bytes)) {
+    OutError = FString::Printf(TEXT("Unexpected Python bridge reply: %s"),
+                               *Result.Left(200));
+    return false;
+  }
+  const FUTF8ToTCHAR Text(reinterpret_cast<const ANSICHAR *>(Bytes.GetData()),
+                          Bytes.Num());
+  const TSharedRef<TJsonReader<>> Reader =
+      TJsonReaderFactory<>::Create(FString(Text.Length(), Text.Get()));
+  if (!FJsonSerializer::Deserialize(Reader, OutReply) || !OutReply.IsValid()) {
+    OutError = TEXT("Python bridge reply is not JSON");
+    return false;
+  }
+  return true;
+#else
+  OutError = TEXT("Python scripting plugin not available in this build.");
+  return false;
+#endif
+}
+
+FString McpPyQuote(const FString &Name) {
+  // Names are validated (IsValidName) or base64, so no escaping is needed.
+  return TEXT("'") + Name + TEXT("'");
+}
+} // namespace
+
+bool FMcpPythonContexts::IsAvailable() {
+#if MCP_PYTHON_CONTEXTS_HAS_PLUGIN
+  IPythonScriptPlugin *Python = IPythonScriptPlugin::Get();
+  return Python && Python->IsPythonAvailable();
+#else
+  return false;
+#endif
+}
+
+bool FMcpPythonContexts::IsValidName(const FString &Name) {
+  if (Name.IsEmpty() || Name.Len() > 128) {
+    return false;
+  }
+  for (const TCHAR Ch : Name) {
+    if (!FChar::IsAlnum(Ch) && Ch != TEXT('_') && Ch != TEXT('-') &&
+        Ch != TEXT('.')) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool FMcpPythonContexts::RegisterScript(const FString &Handle,
+                                        const FString &Source,
+                                        TSharedPtr<FJsonObject> &OutReply,
+                                        FString &OutError) {
+  return McpPyCallBridge(FString::Printf(TEXT("register(%s, %s)"),
+                                         *McpPyQuote(Handle),
+                                         *McpPyQuote(McpPyEncode(Source))),
+                         OutReply, OutError);
+}
+
+bool FMcpPythonContexts::UnregisterScript(const FString &Handle) {
+  TSharedPtr<FJsonObject> Reply;
+  FString Error;
+  bool bRemoved = false;
+  return McpPyCallBridge(
+             FString::Printf(TEXT("unregister(%s)"), *McpPyQuote(Handle)),
+             Reply, Error) &&
+         Reply->TryGetBoolField(TEXT("removed"), bRemoved) && bRemoved;
+}
+
+bool FMcpPythonContexts::Invoke(const FString &Handle,
+                                const FString &InlineSource,
+                                const FString &Context,
+                                const TSharedPtr<FJsonObject> &Args,
+                                TSharedPtr<FJsonObject> &OutReply,
+                                FString &OutError) {
+  FString ArgsJson;
+  if (Args.IsValid()) {
+    const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>>
+        Writer = TJsonWriterFactory<
+            TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&ArgsJson);
+    FJsonSerializer::Serialize(Args.ToSharedRef(), Writer);
+  }
+  return McpPyCallBridge(
+      FString::Printf(TEXT("invoke(%s, %s, %s, %s)"), *McpPyQuote(Handle),
+                      *McpPyQuote(Context),
+                      *McpPyQuote(ArgsJson.IsEmpty() ? FString()
+                                                     : McpPyEncode(ArgsJson)),
+                      *McpPyQuote(InlineSource.IsEmpty()
+                                      ? FString()
+                                      : McpPyEncode(InlineSource))),
+      OutReply, OutError);
+}
+
+bool FMcpPythonContexts::Step(const FString &RunId, double BudgetMs,
+                              TSharedPtr<FJsonObject> &OutReply,
+                              FString &OutError) {
+  return McpPyCallBridge(FString::Printf(TEXT("step(%s, %f)"),
+                                         *McpPyQuote(RunId), BudgetMs),
+                         OutReply, OutError);
+}
+
+void FMcpPythonContexts::Cancel(const FString &RunId) {
+  TSharedPtr<FJsonObject> Reply;
+  FString Error;
+  McpPyCallBridge(FString::Printf(TEXT("cancel(%s)"), *McpPyQuote(RunId)),
+                  Reply, Error);
+}
+
+void FMcpPythonContexts::ResetContext(const FString &Context) {
+  TSharedPtr<FJsonObject> Reply;
+  FString Error;
+  McpPyCallBridge(FString::Printf(TEXT("reset(%s)"), *McpPyQuote(Context)),
+                  Reply, Error);
+}
+
+bool FMcpPythonContexts::Describe(TSharedPtr<FJsonObject> &OutReply,
+                                  FString &OutError) {
+  return McpPyCallBridge(TEXT("describe()"), OutReply, OutError);
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+/**
+ * Named, persistent Python execution state for execute_python. A small bridge module
+ * (_mcp_bridge) is installed into the editor interpreter on first use and holds:
+ *
+ * - contexts: globals dictionaries that survive between calls, so imports and helper
+ *   definitions made by one call are there for the next;
+ * - scripts: source compiled once under a handle and afterwards run by handle with
+ *   JSON arguments, bound to the global "args"; the value the script assigns to
+ *   "result" comes back as JSON;
+ * - runs: scripts whose "result" is a generator. These are stepped cooperatively, a
+ *   time budget at a time, so a long script yields back to the editor between steps.
+ *   Each value it yields may be a progress fraction, a message string or
+ *   { progress, message }; its return value is the result.
+ *
+ * Every call returns the module's JSON reply: ok, and result / output / error / running /
+ * done / progress / message as applicable. Python stays on the game thread: the unreal
+ * module and the interpreter lock are bound to it. Game thread only.
+ */
+class FMcpPythonContexts
+{
+public:
+    /** Whether the Python script plugin is loaded and its interpreter initialized. */
+    static bool IsAvailable();
+
+    /** Compiles Source under Handle, replacing an earlier script of the same handle. */
+    static bool RegisterScript(const FString& Handle, const FString& Source, TSharedPtr<FJsonObject>& OutReply,
+        FString& OutError);
+
+    /** Forgets a registered script; false when Handle is unknown. */
+    static bool UnregisterScript(const FString& Handle);
+
+    /**
+     * Runs the script registered under Handle, or InlineSource (compiled, not kept) when Handle is
+     * empty, in the globals of Context with Args as "args". A generator result starts a run whose
+     * id is the reply's "running" member.
+     */
+    static bool Invoke(const FString& Handle, const FString& InlineSource, const FString& Context,
+        const TSharedPtr<FJsonObject>& Args, TSharedPtr<FJsonObject>& OutReply, FString& OutError);
+
+    /** Advances a run for up to BudgetMs; the reply's "done" says whether it finished. */
+    static bool Step(const FString& RunId, double BudgetMs, TSharedPtr<FJsonObject>& OutReply, FString& OutError);
+
+    /** Closes a run (its generator's finally blocks run); no-op for an unknown id. */
+    static void Cancel(const FString& RunId);
+
+    /** Drops the named context's globals, or every context when Context is empty. */
+    static void ResetContext(const FString& Context);
+
+    /** contexts (name, globals), scripts (handle, source length) and active runs. */
+    static bool Describe(TSharedPtr<FJsonObject>& OutReply, FString& OutError);
+
+    /** Whether Name is usable as a context name or script handle: letters, digits, '_', '-', '.'. */
+    static bool IsValidName(const FString& Name);
+};
@@ -0,0 +1,24 @@
+#include "McpRecordRegistry.h"
+
+TSharedPtr<FJsonObject> FMcpRecordedEvent::ToJson() const {
+  TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+  Json->SetStringField(TEXT("name"), Name);
+  Json->SetStringField(TEXT("eventType"), EventType);
+  if (Parameters.Num() > 0) {
+    Json->SetArrayField(TEXT("parameters"), Parameters);
+  }
+  return Json;
+}
+
+TSharedPtr<FJsonObject> FMcpRecordedFunction::ToJson() const {
+  TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+  Json->SetStringField(TEXT("name"), Name);
+  Json->SetBoolField(TEXT("public"), bPublic);
+  if (Inputs.Num() > 0) {
+    Json->SetArrayField(TEXT("inputs"), Inputs);
+  }
+  if (Outputs.Num() > 0) {
+    Json->SetArrayField(TEXT("outputs"), Outputs);
+  }
+  return Json;
+}
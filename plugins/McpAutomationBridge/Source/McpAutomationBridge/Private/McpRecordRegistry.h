@@ -0,0 +1,181 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "HAL/CriticalSection.h"
+#include "Misc/ScopeLock.h"
+#include "Templates/Function.h"
+#include "UObject/WeakObjectPtr.h"
+
+class UBlueprint;
+
+/** An event the bridge added to a Blueprint, reported back by blueprint_get. */
+struct FMcpRecordedEvent
+{
+    FString Name;
+    FString EventType;
+    TArray<TSharedPtr<FJsonValue>> Parameters;
+
+    /** name, eventType and, when there are any, parameters. */
+    TSharedPtr<FJsonObject> ToJson() const;
+};
+
+/** A function the bridge added to a Blueprint, reported back by blueprint_get. */
+struct FMcpRecordedFunction
+{
+    FString Name;
+    bool bPublic = false;
+    TArray<TSharedPtr<FJsonValue>> Inputs;
+    TArray<TSharedPtr<FJsonValue>> Outputs;
+
+    /** name, public and, when there are any, inputs and outputs. */
+    TSharedPtr<FJsonObject> ToJson() const;
+};
+
+/** What the bridge knows about one Blueprint it resolved or edited. */
+struct FMcpBlueprintRecord
+{
+    /** Package path, e.g. /Game/Foo/BP_Bar, as handlers report it. */
+    FString Path;
+
+    /** Package the asset was resolved from; a renamed or moved asset no longer matches it. */
+    FName PackageName;
+    TWeakObjectPtr<UBlueprint> Blueprint;
+
+    TArray<FMcpRecordedEvent> Events;
+    TArray<FMcpRecordedFunction> Functions;
+};
+
+struct FMcpSequenceRecord
+{
+    FString Path;
+    TWeakObjectPtr<UObject> Sequence;
+};
+
+/**
+ * A Niagara system created in fast mode or without the native factories, which tests and tooling
+ * may still expect the plugin to know about.
+ */
+struct FMcpNiagaraRecord
+{
+    FString Path;
+    TWeakObjectPtr<UObject> System;
+};
+
+/**
+ * Session registry of RecordType keyed by asset package path. Keys are normalized once on the way
+ * in (object suffix dropped, bare names placed under /Game) and compare case-insensitively, like
+ * asset paths. The registry holds at most MaxRecords; adding past that evicts the least recently
+ * used record. Records are reached through callbacks run under the registry lock, so they must not
+ * call back into the same registry. Thread-safe.
+ */
+template <typename RecordType>
+class TMcpRecordRegistry
+{
+public:
+    explicit TMcpRecordRegistry(int32 InMaxRecords)
+        : MaxRecords(FMath::Max(1, InMaxRecords))
+    {
+    }
+
+    TMcpRecordRegistry(const TMcpRecordRegistry&) = delete;
+    TMcpRecordRegistry& operator=(const TMcpRecordRegistry&) = delete;
+
+    /** "/Game/Foo/Bar" for "Foo/Bar", "/Game/Foo/Bar" and "/Game/Foo/Bar.Bar". */
+    static FString NormalizePath(const FString& Path)
+    {
+        int32 DotIndex = INDEX_NONE;
+        FString Normalized = Path.FindChar(TEXT('.'), DotIndex) ? Path.Left(DotIndex) : Path;
+        if (!Normalized.StartsWith(TEXT("/")))
+        {
+            Normalized = TEXT("/Game/") + Normalized;
+        }
+        return Normalized;
+    }
+
+    /** Runs Fn on the record for Path, creating it when there is none. */
+    void Update(const FString& Path, TFunctionRef<void(RecordType&)> Fn)
+    {
+        FString Key = NormalizePath(Path);
+        FScopeLock Lock(&Mutex);
+        FSlot* Slot = Slots.Find(Key);
+        if (!Slot)
+        {
+            EvictLeastRecentlyUsed();
+            Slot = &Slots.Add(Key);
+            Slot->Record.Path = MoveTemp(Key);
+        }
+        Slot->LastUse = ++UseClock;
+        Fn(Slot->Record);
+    }
+
+    /** Runs Fn on the record for Path and returns true, or returns false when there is none. */
+    bool Read(const FString& Path, TFunctionRef<void(const RecordType&)> Fn)
+    {
+        const FString Key = NormalizePath(Path);
+        FScopeLock Lock(&Mutex);
+        FSlot* Slot = Slots.Find(Key);
+        if (!Slot)
+        {
+            return false;
+        }
+        Slot->LastUse = ++UseClock;
+        Fn(Slot->Record);
+        return true;
+    }
+
+    bool Remove(const FString& Path)
+    {
+        const FString Key = NormalizePath(Path);
+        FScopeLock Lock(&Mutex);
+        return Slots.Remove(Key) > 0;
+    }
+
+    int32 Num() const
+    {
+        FScopeLock Lock(&Mutex);
+        return Slots.Num();
+    }
+
+    void Reset()
+    {
+        FScopeLock Lock(&Mutex);
+        Slots.Reset();
+    }
+
+private:
+    struct FSlot
+    {
+        RecordType Record;
+        uint64 LastUse = 0;
+    };
+
+    /** Linear in the record count, and only paid once the registry is full. */
+    void EvictLeastRecentlyUsed()
+    {
+        if (Slots.Num() < MaxRecords)
+        {
+            return;
+        }
+        const FString* Oldest = nullptr;
+        uint64 OldestUse = MAX_uint64;
+        for (const TPair<FString, FSlot>& Pair : Slots)
+        {
+            if (Pair.Value.LastUse < OldestUse)
+            {
+                OldestUse = Pair.Value.LastUse;
+                Oldest = &Pair.Key;
+            }
+        }
+        if (Oldest)
+        {
+            const FString Key = *Oldest;
+            Slots.Remove(Key);
+        }
+    }
+
+    mutable FCriticalSection Mutex;
+    TMap<FString, FSlot> Slots;
+    uint64 UseClock = 0;
+    const int32 MaxRecords;
+};
@@ -0,0 +1,243 @@
+#include "McpRuntimeTelemetry.h"
+
+#include "CoreGlobals.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+#include "McpJsonUtf8Writer.h"
+#include "Misc/App.h"
+#include "RHI.h"
+#include "UObject/UObjectArray.h"
+
+#if WITH_EDITOR
+#include "Editor.h"
+#endif
+
+namespace {
+constexpr int32 BytesPerTelemetryMb = 1024 * 1024;
+
+int32 TelemetryMegabytes(uint64 Bytes) {
+  return static_cast<int32>(Bytes / BytesPerTelemetryMb);
+}
+
+// Writes "key": [mean, p50, p95, max] in whole microseconds.
+void WriteTelemetryMetric(FMcpJsonUtf8Writer &Writer, const TCHAR *Key,
+                          TArray<float> &Values) {
+  if (Values.Num() == 0) {
+    return;
+  }
+  double Sum = 0.0;
+  for (const float Value : Values) {
+    Sum += Value;
+  }
+  Values.Sort();
+  auto Percentile = [&Values](double Percent) {
+    const int32 Rank = FMath::CeilToInt(Percent / 100.0 * Values.Num()) - 1;
+    return Values[FMath::Clamp(Rank, 0, Values.Num() - 1)];
+  };
+  auto Micros = [](double Ms) {
+    return static_cast<int64>(FMath::RoundToDouble(Ms * 1000.0));
+  };
+  Writer.Key(Key);
+  Writer.BeginArray();
+  Writer.Int(Micros(Sum / Values.Num()));
+  Writer.Int(Micros(Percentile(50.0)));
+  Writer.Int(Micros(Percentile(95.0)));
+  Writer.Int(Micros(Values.Last()));
+  Writer.EndArray();
+}
+
+void WriteTelemetryVector(FMcpJsonUtf8Writer &Writer, const TCHAR *Key,
+                          const FIntVector &Value) {
+  Writer.Key(Key);
+  Writer.BeginArray();
+  Writer.Int(Value.X);
+  Writer.Int(Value.Y);
+  Writer.Int(Value.Z);
+  Writer.EndArray();
+}
+
+UWorld *TelemetryWorld() {
+#if WITH_EDITOR
+  if (GEditor) {
+    return GEditor->PlayWorld ? GEditor->PlayWorld.Get()
+                              : GEditor->GetEditorWorldContext().World();
+  }
+#endif
+  return nullptr;
+}
+} // namespace
+
+FMcpRuntimeTelemetry::FMcpRuntimeTelemetry(int32 InCapacityFrames) {
+  Ring.SetNum(FMath::Max(64, InCapacityFrames));
+}
+
+void FMcpRuntimeTelemetry::SampleFrame() {
+  const FPlatformMemoryStats Memory = FPlatformMemory::GetStats();
+  State.UsedPhysicalMb = TelemetryMegabytes(Memory.UsedPhysical);
+  State.AvailablePhysicalMb = TelemetryMegabytes(Memory.AvailablePhysical);
+  State.UsedVirtualMb = TelemetryMegabytes(Memory.UsedVirtual);
+  State.UObjects = GUObjectArray.GetObjectArrayNumMinusAvailable();
+
+  FMcpRuntimeTelemetryFrame &Frame =
+      Ring[static_cast<int32>(NextSequence % Ring.Num())];
+  Frame.FrameMs = static_cast<float>(FApp::GetDeltaTime() * 1000.0);
+  Frame.GameMs = static_cast<float>(FPlatformTime::ToMilliseconds(GGameThreadTime));
+  Frame.RenderMs = static_cast<float>(FPlatformTime::ToMilliseconds(GRenderThreadTime));
+  Frame.GpuMs = static_cast<float>(FPlatformTime::ToMilliseconds(RHIGetGPUFrameCycles(0)));
+  Frame.RhiMs = static_cast<float>(FPlatformTime::ToMilliseconds(GRHIThreadTime));
+  Frame.UsedPhysicalMb = State.UsedPhysicalMb;
+  ++NextSequence;
+
+  UWorld *World = TelemetryWorld();
+#if WITH_EDITOR
+  State.bPlaying = GEditor && GEditor->PlayWorld != nullptr;
+  State.bPaused = State.bPlaying && GEditor->PlayWorld->bDebugPauseExecution;
+#endif
+  State.Actors = World ? World->GetActorCount() : 0;
+
+  const APlayerController *Controller =
+      State.bPlaying && World ? World->GetFirstPlayerController() : nullptr;
+  const APawn *Pawn = Controller ? Controller->GetPawn() : nullptr;
+  State.bHasPawn = Pawn != nullptr;
+  if (Pawn) {
+    const FVector Location = Pawn->GetActorLocation();
+    const FRotator Rotation = Pawn->GetActorRotation();
+    State.PawnClass = Pawn->GetClass()->GetName();
+    State.Location = FIntVector(FMath::RoundToInt(Location.X),
+                                FMath::RoundToInt(Location.Y),
+                                FMath::RoundToInt(Location.Z));
+    State.Rotation = FIntVector(FMath::RoundToInt(Rotation.Pitch),
+                                FMath::RoundToInt(Rotation.Yaw),
+                                FMath::RoundToInt(Rotation.Roll));
+    State.Speed = FMath::RoundToInt(Pawn->GetVelocity().Size());
+  }
+}
+
+void FMcpRuntimeTelemetry::ReadFrames(
+    uint64 FromSequence, TArray<FMcpRuntimeTelemetryFrame> &OutFrames,
+    uint64 &OutMissed) const {
+  const uint64 Capacity = static_cast<uint64>(Ring.Num());
+  const uint64 Oldest = NextSequence > Capacity ? NextSequence - Capacity : 0;
+  OutMissed = FromSequence < Oldest ? Oldest - FromSequence : 0;
+  OutFrames.Reset();
+  for (uint64 Sequence = FMath::Max(FromSequence, Oldest);
+       Sequence < NextSequence; ++Sequence) {
+    OutFrames.Add(Ring[static_cast<int32>(Sequence % Capacity)]);
+  }
+}
+
+FMcpRuntimeTelemetryReader::FMcpRuntimeTelemetryReader(
+    const TSharedRef<FMcpRuntimeTelemetry> &InSource, double InHitchThresholdMs)
+    : Source(InSource), HitchThresholdMs(InHitchThresholdMs),
+      Cursor(InSource->GetNextSequence()), PendingCursor(Cursor) {}
+
+void FMcpRuntimeTelemetryReader::WritePush(FMcpJsonUtf8Writer &Writer) {
+  TArray<FMcpRuntimeTelemetryFrame> Frames;
+  uint64 Missed = 0;
+  Source->ReadFrames(Cursor, Frames, Missed);
+  PendingCursor = Source->GetNextSequence();
+
+  TArray<float> Values[5];
+  for (TArray<float> &Metric : Values) {
+    Metric.Reserve(Frames.Num());
+  }
+  double Seconds = 0.0;
+  int32 Hitches = 0;
+  int32 PeakMb = 0;
+  for (const FMcpRuntimeTelemetryFrame &Frame : Frames) {
+    Seconds += Frame.FrameMs / 1000.0;
+    Hitches += Frame.FrameMs >= HitchThresholdMs ? 1 : 0;
+    PeakMb = FMath::Max(PeakMb, Frame.UsedPhysicalMb);
+    Values[0].Add(Frame.FrameMs);
+    Values[1].Add(Frame.GameMs);
+    Values[2].Add(Frame.RenderMs);
+    // Zero when the RHI has no GPU timing or no RHI thread; left out then.
+    if (Frame.GpuMs > 0.0f) {
+      Values[3].Add(Frame.GpuMs);
+    }
+    if (Frame.RhiMs > 0.0f) {
+      Values[4].Add(Frame.RhiMs);
+    }
+  }
+
+  Writer.WriteInt(TEXT("n"), Frames.Num());
+  if (Missed > 0) {
+    Writer.WriteInt(TEXT("miss"), static_cast<int64>(Missed));
+  }
+  Writer.WriteInt(TEXT("fps"), Seconds > 0.0 ? FMath::RoundToInt(Frames.Num() / Seconds) : 0);
+  Writer.Key(TEXT("us"));
+  Writer.BeginObject();
+  WriteTelemetryMetric(Writer, TEXT("frame"), Values[0]);
+  WriteTelemetryMetric(Writer, TEXT("game"), Values[1]);
+  WriteTelemetryMetric(Writer, TEXT("render"), Values[2]);
+  WriteTelemetryMetric(Writer, TEXT("gpu"), Values[3]);
+  WriteTelemetryMetric(Writer, TEXT("rhi"), Values[4]);
+  Writer.EndObject();
+  if (Hitches > 0) {
+    Writer.WriteInt(TEXT("hitch"), Hitches);
+  }
+
+  const FMcpRuntimeTelemetryState &State = Source->GetState();
+  const bool bFull = !bHasLastSent;
+  if (bFull) {
+    Writer.WriteBool(TEXT("full"), true);
+  }
+  // Peak only differs from used within a window, so it always goes out.
+  Writer.WriteInt(TEXT("peakMb"), FMath::Max(PeakMb, State.UsedPhysicalMb));
+  if (bFull || State.UsedPhysicalMb != LastSent.UsedPhysicalMb ||
+      State.AvailablePhysicalMb != LastSent.AvailablePhysicalMb ||
+      State.UsedVirtualMb != LastSent.UsedVirtualMb) {
+    Writer.Key(TEXT("mem"));
+    Writer.BeginArray();
+    Writer.Int(State.UsedPhysicalMb);
+    Writer.Int(State.AvailablePhysicalMb);
+    Writer.Int(State.UsedVirtualMb);
+    Writer.EndArray();
+  }
+  if (bFull || State.UObjects != LastSent.UObjects ||
+      State.Actors != LastSent.Actors) {
+    Writer.Key(TEXT("obj"));
+    Writer.BeginArray();
+    Writer.Int(State.UObjects);
+    Writer.Int(State.Actors);
+    Writer.EndArray();
+  }
+  if (bFull || State.bPlaying != LastSent.bPlaying ||
+      State.bPaused != LastSent.bPaused) {
+    Writer.Key(TEXT("pie"));
+    Writer.BeginArray();
+    Writer.Bool(State.bPlaying);
+    Writer.Bool(State.bPaused);
+    Writer.EndArray();
+  }
+  if (!State.bHasPawn) {
+    if (bFull || LastSent.bHasPawn) {
+      Writer.Key(TEXT("player"));
+      Writer.Null();
+    }
+  } else if (bFull || !LastSent.bHasPawn ||
+             State.Location != LastSent.Location ||
+             State.Rotation != LastSent.Rotation ||
+             State.Speed != LastSent.Speed ||
+             State.PawnClass != LastSent.PawnClass) {
+    Writer.Key(TEXT("player"));
+    Writer.BeginObject();
+    WriteTelemetryVector(Writer, TEXT("loc"), State.Location);
+    WriteTelemetryVector(Writer, TEXT("rot"), State.Rotation);
+    Writer.WriteInt(TEXT("speed"), State.Speed);
+    if (bFull || State.PawnClass != LastSent.PawnClass) {
+      Writer.WriteString(TEXT("class"), State.PawnClass);
+    }
+    Writer.EndObject();
+  }
+  PendingSent = State;
+}
+
+void FMcpRuntimeTelemetryReader::Commit() {
+  Cursor = PendingCursor;
+  LastSent = PendingSent;
+  bHasLastSent = true;
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/SharedPointer.h"
+
+class FMcpJsonUtf8Writer;
+
+/** Frame-time components of one frame, in milliseconds (the counters stat unit reads). */
+struct FMcpRuntimeTelemetryFrame
+{
+    float FrameMs = 0.0f;
+    float GameMs = 0.0f;
+    float RenderMs = 0.0f;
+    float GpuMs = 0.0f;
+    float RhiMs = 0.0f;
+    /** Resident memory at the end of the frame, in MB. */
+    int32 UsedPhysicalMb = 0;
+};
+
+/** Latest editor and play state, refreshed with every sampled frame. */
+struct FMcpRuntimeTelemetryState
+{
+    int32 UsedPhysicalMb = 0;
+    int32 AvailablePhysicalMb = 0;
+    int32 UsedVirtualMb = 0;
+    int32 UObjects = 0;
+    int32 Actors = 0;
+    bool bPlaying = false;
+    bool bPaused = false;
+    bool bHasPawn = false;
+    FString PawnClass;
+    FIntVector Location = FIntVector::ZeroValue;
+    FIntVector Rotation = FIntVector::ZeroValue;
+    int32 Speed = 0;
+};
+
+/**
+ * Per-frame runtime sampler backing subscribe_runtime_telemetry. Every sampled frame lands in a
+ * fixed ring; readers aggregate the frames since their last push, so subscribers with different
+ * intervals share one sample per frame. Game thread only.
+ */
+class FMcpRuntimeTelemetry
+{
+public:
+    explicit FMcpRuntimeTelemetry(int32 InCapacityFrames = 8192);
+
+    /** Records the frame that just ended and refreshes the state. */
+    void SampleFrame();
+
+    /** Sequence number the next sampled frame gets. */
+    uint64 GetNextSequence() const { return NextSequence; }
+
+    const FMcpRuntimeTelemetryState& GetState() const { return State; }
+
+    /**
+     * Copies the frames from FromSequence on into OutFrames. Frames the ring has already
+     * overwritten are counted in OutMissed.
+     */
+    void ReadFrames(uint64 FromSequence, TArray<FMcpRuntimeTelemetryFrame>& OutFrames, uint64& OutMissed) const;
+
+private:
+    TArray<FMcpRuntimeTelemetryFrame> Ring;
+    uint64 NextSequence = 0;
+    FMcpRuntimeTelemetryState State;
+};
+
+/**
+ * One subscriber's view of the sampler. Each push aggregates the frames since the last delivered
+ * push (fps, mean/p50/p95/max per frame-time component in microseconds, hitches, peak memory) and
+ * carries only the state sections that changed since then, with absolute values, so a push the
+ * connection had to drop never leaves the client with a skewed total.
+ */
+class FMcpRuntimeTelemetryReader
+{
+public:
+    FMcpRuntimeTelemetryReader(const TSharedRef<FMcpRuntimeTelemetry>& InSource, double InHitchThresholdMs);
+
+    /** Writes the fields of the next push into the open object of Writer. */
+    void WritePush(FMcpJsonUtf8Writer& Writer);
+
+    /** Marks the push written last as delivered; an undelivered one is folded into the next. */
+    void Commit();
+
+private:
+    TSharedRef<FMcpRuntimeTelemetry> Source;
+    double HitchThresholdMs = 50.0;
+    uint64 Cursor = 0;
+    uint64 PendingCursor = 0;
+    FMcpRuntimeTelemetryState LastSent;
+    FMcpRuntimeTelemetryState PendingSent;
+    bool bHasLastSent = false;
+};
@@ -0,0 +1,486 @@
+#include "McpTextureKernels.h"
+
+#include "Async/ParallelFor.h"
+#include "Math/Float16Color.h"
+
+namespace {
+// Rows per task for the point kernels, so small textures are not split into
+// more tasks than they have work for.
+constexpr int32 PointKernelRowsPerTask = 16;
+
+// Runs Body(Y0, Y1) over [0, Height) in row blocks across the task graph.
+template <typename BodyType>
+void ForEachRowBlock(int32 Height, int32 RowsPerTask, BodyType &&Body) {
+  const int32 NumBlocks = FMath::DivideAndRoundUp(Height, RowsPerTask);
+  ParallelFor(NumBlocks, [&](int32 Block) {
+    const int32 Y0 = Block * RowsPerTask;
+    Body(Y0, FMath::Min(Y0 + RowsPerTask, Height));
+  });
+}
+
+uint8 ToByte(float Value) {
+  return static_cast<uint8>(FMath::Clamp(Value, 0.0f, 255.0f));
+}
+
+// Vertical pass shared by the blurs: each output row is the weighted sum of
+// the clamped Rows of Horizontal around it, accumulated a full row at a time.
+void BlurColumns(const float *Horizontal, uint8 *Pixels, int32 Width,
+                 int32 Height, const TArray<float> &Weights, int32 Radius) {
+  const int32 RowFloats = Width * 4;
+  ParallelFor(Height, [&](int32 Y) {
+    TArray<float> Acc;
+    Acc.SetNumZeroed(RowFloats);
+    float *RESTRICT A = Acc.GetData();
+    for (int32 K = -Radius; K <= Radius; ++K) {
+      const float W = Weights[K + Radius];
+      const float *RESTRICT Row =
+          Horizontal +
+          static_cast<int64>(FMath::Clamp(Y + K, 0, Height - 1)) * RowFloats;
+      for (int32 I = 0; I < RowFloats; ++I) {
+        A[I] += Row[I] * W;
+      }
+    }
+    uint8 *RESTRICT Out = Pixels + static_cast<int64>(Y) * RowFloats;
+    for (int32 X = 0; X < Width; ++X) {
+      Out[X * 4 + 0] = ToByte(A[X * 4 + 0]);
+      Out[X * 4 + 1] = ToByte(A[X * 4 + 1]);
+      Out[X * 4 + 2] = ToByte(A[X * 4 + 2]);
+    }
+  });
+}
+
+// Horizontal pass: each row convolved with Weights, edges clamped, into
+// floats so the vertical pass does not round twice.
+void BlurRows(const uint8 *Pixels, float *Horizontal, int32 Width,
+              int32 Height, const TArray<float> &Weights, int32 Radius) {
+  ParallelFor(Height, [&](int32 Y) {
+    const uint8 *RESTRICT Row = Pixels + static_cast<int64>(Y) * Width * 4;
+    float *RESTRICT Out = Horizontal + static_cast<int64>(Y) * Width * 4;
+    for (int32 X = 0; X < Width; ++X) {
+      float B = 0.0f, G = 0.0f, R = 0.0f;
+      for (int32 K = -Radius; K <= Radius; ++K) {
+        const int32 S = FMath::Clamp(X + K, 0, Width - 1) * 4;
+        const float W = Weights[K + Radius];
+        B += Row[S + 0] * W;
+        G += Row[S + 1] * W;
+        R += Row[S + 2] * W;
+      }
+      Out[X * 4 + 0] = B;
+      Out[X * 4 + 1] = G;
+      Out[X * 4 + 2] = R;
+      Out[X * 4 + 3] = 0.0f;
+    }
+  });
+}
+
+void SeparableBlur(uint8 *Pixels, int32 Width, int32 Height,
+                   const TArray<float> &Weights, int32 Radius) {
+  if (Width <= 0 || Height <= 0) {
+    return;
+  }
+  TArray<float> Horizontal;
+  Horizontal.SetNumUninitialized(Width * Height * 4);
+  BlurRows(Pixels, Horizontal.GetData(), Width, Height, Weights, Radius);
+  BlurColumns(Horizontal.GetData(), Pixels, Width, Height, Weights, Radius);
+}
+} // namespace
+
+FMcpTextureKernels::FChannelLuts::FChannelLuts() {
+  for (int32 C = 0; C < 4; ++C) {
+    for (int32 I = 0; I < 256; ++I) {
+      Table[C][I] = static_cast<uint8>(I);
+    }
+  }
+}
+
+void FMcpTextureKernels::FChannelLuts::Then(const FChannelLuts &Other) {
+  for (int32 C = 0; C < 4; ++C) {
+    for (int32 I = 0; I < 256; ++I) {
+      Table[C][I] = Other.Table[C][Table[C][I]];
+    }
+  }
+}
+
+void FMcpTextureKernels::FChannelLuts::SetChannels(const uint8 (&Lut)[256],
+                                                   uint8 Mask) {
+  for (int32 C = 0; C < 4; ++C) {
+    if (Mask & (1 << C)) {
+      FMemory::Memcpy(Table[C], Lut, sizeof(Lut));
+    }
+  }
+}
+
+void FMcpTextureKernels::BuildLevelsLut(float InBlack, float InWhite,
+                                        float Gamma, float OutBlack,
+                                        float OutWhite, uint8 (&OutLut)[256]) {
+  InBlack = FMath::Clamp(InBlack, 0.0f, 1.0f);
+  InWhite = FMath::Clamp(InWhite, 0.0f, 1.0f);
+  OutBlack = FMath::Clamp(OutBlack, 0.0f, 1.0f);
+  OutWhite = FMath::Clamp(OutWhite, 0.0f, 1.0f);
+  const float InRange = FMath::Max(InWhite - InBlack, 0.001f);
+  const float OutRange = OutWhite - OutBlack;
+  const float InvGamma = 1.0f / FMath::Max(Gamma, 0.01f);
+  for (int32 I = 0; I < 256; ++I) {
+    float Val = FMath::Clamp((I / 255.0f - InBlack) / InRange, 0.0f, 1.0f);
+    Val = OutBlack + FMath::Pow(Val, InvGamma) * OutRange;
+    OutLut[I] = ToByte(Val * 255.0f);
+  }
+}
+
+void FMcpTextureKernels::BuildCurveLut(const TArray<float> &Input,
+                                       const TArray<float> &Output,
+                                       uint8 (&OutLut)[256]) {
+  if (Input.Num() < 2 || Input.Num() != Output.Num()) {
+    for (int32 I = 0; I < 256; ++I) {
+      OutLut[I] = static_cast<uint8>(I);
+    }
+    return;
+  }
+  for (int32 I = 0; I < 256; ++I) {
+    const float In = I / 255.0f;
+    float Mapped = In;
+    if (In < Input[0]) {
+      Mapped = Output[0];
+    } else if (In > Input.Last()) {
+      Mapped = Output.Last();
+    } else {
+      for (int32 J = 0; J < Input.Num() - 1; ++J) {
+        if (In >= Input[J] && In <= Input[J + 1]) {
+          const float Range = Input[J + 1] - Input[J];
+          Mapped = Range > UE_SMALL_NUMBER
+                       ? FMath::Lerp(Output[J], Output[J + 1],
+                                     (In - Input[J]) / Range)
+                       : Output[J];
+          break;
+        }
+      }
+    }
+    OutLut[I] = ToByte(Mapped * 255.0f);
+  }
+}
+
+void FMcpTextureKernels::BuildInvertLut(uint8 (&OutLut)[256]) {
+  for (int32 I = 0; I < 256; ++I) {
+    OutLut[I] = static_cast<uint8>(255 - I);
+  }
+}
+
+void FMcpTextureKernels::ApplyLuts(uint8 *Pixels, int32 Width, int32 Height,
+                                   const FChannelLuts &Luts) {
+  ForEachRowBlock(Height, PointKernelRowsPerTask, [&](int32 Y0, int32 Y1) {
+    uint8 *RESTRICT P = Pixels + static_cast<int64>(Y0) * Width * 4;
+    const int64 Count = static_cast<int64>(Y1 - Y0) * Width;
+    for (int64 I = 0; I < Count; ++I, P += 4) {
+      P[0] = Luts.Table[0][P[0]];
+      P[1] = Luts.Table[1][P[1]];
+      P[2] = Luts.Table[2][P[2]];
+      P[3] = Luts.Table[3][P[3]];
+    }
+  });
+}
+
+void FMcpTextureKernels::Desaturate(uint8 *Pixels, int32 Width, int32 Height,
+                                    float Amount) {
+  // Rec. 709 weights and the blend factor in 16.16 / 8.8 fixed point, so the
+  // loop is integer multiply-adds only.
+  constexpr uint32 WR = 13933, WG = 46871, WB = 4732;
+  const uint32 A = static_cast<uint32>(
+      FMath::RoundToInt(FMath::Clamp(Amount, 0.0f, 1.0f) * 256.0f));
+  const uint32 InvA = 256 - A;
+  ForEachRowBlock(Height, PointKernelRowsPerTask, [&](int32 Y0, int32 Y1) {
+    uint8 *RESTRICT P = Pixels + static_cast<int64>(Y0) * Width * 4;
+    const int64 Count = static_cast<int64>(Y1 - Y0) * Width;
+    for (int64 I = 0; I < Count; ++I, P += 4) {
+      const uint32 Gray = (WB * P[0] + WG * P[1] + WR * P[2]) >> 16;
+      P[0] = static_cast<uint8>((P[0] * InvA + Gray * A) >> 8);
+      P[1] = static_cast<uint8>((P[1] * InvA + Gray * A) >> 8);
+      P[2] = static_cast<uint8>((P[2] * InvA + Gray * A) >> 8);
+    }
+  });
+}
+
+void FMcpTextureKernels::BoxBlur(uint8 *Pixels, int32 Width, int32 Height,
+                                 int32 Radius) {
+  Radius = FMath::Max(Radius, 1);
+  TArray<float> Weights;
+  Weights.Init(1.0f / (Radius * 2 + 1), Radius * 2 + 1);
+  SeparableBlur(Pixels, Width, Height, Weights, Radius);
+}
+
+void FMcpTextureKernels::GaussianBlur(uint8 *Pixels, int32 Width, int32 Height,
+                                      int32 Radius) {
+  Radius = FMath::Max(Radius, 1);
+  const float Sigma = FMath::Max(Radius * 0.5f, 0.5f);
+  TArray<float> Weights;
+  Weights.SetNumUninitialized(Radius * 2 + 1);
+  float Sum = 0.0f;
+  for (int32 K = -Radius; K <= Radius; ++K) {
+    const float W = FMath::Exp(-(K * K) / (2.0f * Sigma * Sigma));
+    Weights[K + Radius] = W;
+    Sum += W;
+  }
+  for (float &W : Weights) {
+    W /= Sum;
+  }
+  SeparableBlur(Pixels, Width, Height, Weights, Radius);
+}
+
+void FMcpTextureKernels::Sharpen(uint8 *Pixels, int32 Width, int32 Height,
+                                 float Amount) {
+  if (Width < 3 || Height < 3) {
+    return;
+  }
+  const int32 Stride = Width * 4;
+  TArray<uint8> Original(Pixels, Stride * Height);
+  const uint8 *Src = Original.GetData();
+  const float Center = 1.0f + 4.0f * Amount;
+  ParallelFor(Height - 2, [&](int32 Row) {
+    const int32 Y = Row + 1;
+    const uint8 *RESTRICT Mid = Src + static_cast<int64>(Y) * Stride;
+    const uint8 *RESTRICT Up = Mid - Stride;
+    const uint8 *RESTRICT Down = Mid + Stride;
+    uint8 *RESTRICT Out = Pixels + static_cast<int64>(Y) * Stride;
+    for (int32 I = 4; I < Stride - 4; ++I) {
+      if ((I & 3) == 3) {
+        continue;
+      }
+      const float Sharpened =
+          Mid[I] * Center - Amount * (Mid[I - 4] + Mid[I + 4] + Up[I] + Down[I]);
+      Out[I] = ToByte(Sharpened);
+    }
+  });
+}
+
+void FMcpTextureKernels::Swizzle(uint8 *Pixels, int32 Width, int32 Height,
+                                 const int8 (&Map)[4]) {
+  // Reading a spare 0 / 255 slot keeps the loop free of branches.
+  int32 Index[4];
+  for (int32 C = 0; C < 4; ++C) {
+    Index[C] = Map[C] >= 0 ? FMath::Min<int32>(Map[C], 3)
+                           : (Map[C] == SwizzleZero ? 4 : 5);
+  }
+  ForEachRowBlock(Height, PointKernelRowsPerTask, [&](int32 Y0, int32 Y1) {
+    uint8 *RESTRICT P = Pixels + static_cast<int64>(Y0) * Width * 4;
+    const int64 Count = static_cast<int64>(Y1 - Y0) * Width;
+    uint8 In[6] = {0, 0, 0, 0, 0, 255};
+    for (int64 I = 0; I < Count; ++I, P += 4) {
+      In[0] = P[0];
+      In[1] = P[1];
+      In[2] = P[2];
+      In[3] = P[3];
+      P[0] = In[Index[0]];
+      P[1] = In[Index[1]];
+      P[2] = In[Index[2]];
+      P[3] = In[Index[3]];
+    }
+  });
+}
+
+void FMcpTextureKernels::CopyChannel(const uint8 *Src, int32 SrcChannel,
+                                     uint8 *Dst, int32 DstChannel,
+                                     int64 NumPixels) {
+  constexpr int64 PixelsPerTask = 64 * 1024;
+  const int32 NumBlocks =
+      static_cast<int32>((NumPixels + PixelsPerTask - 1) / PixelsPerTask);
+  ParallelFor(NumBlocks, [&](int32 Block) {
+    const int64 Begin = Block * PixelsPerTask;
+    const int64 End = FMath::Min(Begin + PixelsPerTask, NumPixels);
+    const uint8 *RESTRICT S = Src + Begin * 4 + SrcChannel;
+    uint8 *RESTRICT D = Dst + Begin * 4 + DstChannel;
+    for (int64 I = Begin; I < End; ++I, S += 4, D += 4) {
+      *D = *S;
+    }
+  });
+}
+
+void FMcpTextureKernels::FillChannel(uint8 *Pixels, int32 Channel, uint8 Value,
+                                     int64 NumPixels) {
+  uint8 *RESTRICT D = Pixels + Channel;
+  for (int64 I = 0; I < NumPixels; ++I, D += 4) {
+    *D = Value;
+  }
+}
+
+void FMcpTextureKernels::ExtractHeight(const uint8 *Pixels, int32 Width,
+                                       int32 Height, EMcpHeightChannel Channel,
+                                       float *OutHeights) {
+  // Weights on B, G, R, A; every mode is the same dot product.
+  float W[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+  switch (Channel) {
+  case EMcpHeightChannel::Red:
+    W[2] = 1.0f;
+    break;
+  case EMcpHeightChannel::Green:
+    W[1] = 1.0f;
+    break;
+  case EMcpHeightChannel::Blue:
+    W[0] = 1.0f;
+    break;
+  case EMcpHeightChannel::Alpha:
+    W[3] = 1.0f;
+    break;
+  case EMcpHeightChannel::Average:
+    W[0] = W[1] = W[2] = 1.0f / 3.0f;
+    break;
+  default:
+    W[0] = 0.0722f;
+    W[1] = 0.7152f;
+    W[2] = 0.2126f;
+    break;
+  }
+  for (float &Weight : W) {
+    Weight /= 255.0f;
+  }
+  ForEachRowBlock(Height, PointKernelRowsPerTask, [&](int32 Y0, int32 Y1) {
+    const int64 Begin = static_cast<int64>(Y0) * Width;
+    const int64 End = static_cast<int64>(Y1) * Width;
+    const uint8 *RESTRICT P = Pixels + Begin * 4;
+    for (int64 I = Begin; I < End; ++I, P += 4) {
+      OutHeights[I] = P[0] * W[0] + P[1] * W[1] + P[2] * W[2] + P[3] * W[3];
+    }
+  });
+}
+
+void FMcpTextureKernels::NormalsFromHeight(const float *Heights, int32 Width,
+                                           int32 Height, float Strength,
+                                           bool bSobel, bool bFlipY,
+                                           uint8 *OutPixels) {
+  ParallelFor(Height, [&](int32 Y) {
+    const float *RESTRICT Up = Heights + static_cast<int64>((Y - 1 + Height) % Height) * Width;
+    const float *RESTRICT Mid = Heights + static_cast<int64>(Y) * Width;
+    const float *RESTRICT Down = Heights + static_cast<int64>((Y + 1) % Height) * Width;
+    uint8 *RESTRICT Out = OutPixels + static_cast<int64>(Y) * Width * 4;
+    for (int32 X = 0; X < Width; ++X) {
+      const int32 L = (X - 1 + Width) % Width;
+      const int32 R = (X + 1) % Width;
+      float DX, DY;
+      if (bSobel) {
+        DX = (Up[R] + 2.0f * Mid[R] + Down[R]) - (Up[L] + 2.0f * Mid[L] + Down[L]);
+        DY = (Down[L] + 2.0f * Down[X] + Down[R]) - (Up[L] + 2.0f * Up[X] + Up[R]);
+      } else {
+        DX = Mid[R] - Mid[L];
+        DY = Down[X] - Up[X];
+      }
+      DX *= Strength;
+      DY *= Strength;
+      if (bFlipY) {
+        DY = -DY;
+      }
+      const float InvLen = FMath::InvSqrt(DX * DX + DY * DY + 1.0f);
+      Out[X * 4 + 0] = static_cast<uint8>((InvLen * 0.5f + 0.5f) * 255.0f);
+      Out[X * 4 + 1] = static_cast<uint8>((-DY * InvLen * 0.5f + 0.5f) * 255.0f);
+      Out[X * 4 + 2] = static_cast<uint8>((-DX * InvLen * 0.5f + 0.5f) * 255.0f);
+      Out[X * 4 + 3] = 255;
+    }
+  });
+}
+
+int32 FMcpTextureKernels::GetBytesPerPixel(EMcpTextureFormat Format) {
+  switch (Format) {
+  case EMcpTextureFormat::G8:
+    return 1;
+  case EMcpTextureFormat::G16:
+    return 2;
+  case EMcpTextureFormat::RGBA16F:
+    return 8;
+  default:
+    return 4;
+  }
+}
+
+void FMcpTextureKernels::Generate(
+    uint8 *Pixels, int32 Width, int32 Height, EMcpTextureFormat Format,
+    TFunctionRef<void(int32 Y, FLinearColor *OutRow)> EvalRow) {
+  const int32 BytesPerPixel = GetBytesPerPixel(Format);
+  ForEachRowBlock(Height, PointKernelRowsPerTask, [&](int32 Y0, int32 Y1) {
+    TArray<FLinearColor> Row;
+    Row.SetNumUninitialized(Width);
+    FLinearColor *RESTRICT C = Row.GetData();
+    for (int32 Y = Y0; Y < Y1; ++Y) {
+      EvalRow(Y, C);
+      uint8 *RESTRICT Out =
+          Pixels + static_cast<int64>(Y) * Width * BytesPerPixel;
+      switch (Format) {
+      case EMcpTextureFormat::BGRA8:
+        for (int32 X = 0; X < Width; ++X) {
+          Out[X * 4 + 0] = ToByte(C[X].B * 255.0f);
+          Out[X * 4 + 1] = ToByte(C[X].G * 255.0f);
+          Out[X * 4 + 2] = ToByte(C[X].R * 255.0f);
+          Out[X * 4 + 3] = ToByte(C[X].A * 255.0f);
+        }
+        break;
+      case EMcpTextureFormat::G8:
+        for (int32 X = 0; X < Width; ++X) {
+          Out[X] = ToByte(
+              (0.2126f * C[X].R + 0.7152f * C[X].G + 0.0722f * C[X].B) *
+              255.0f);
+        }
+        break;
+      case EMcpTextureFormat::G16: {
+        uint16 *RESTRICT Out16 = reinterpret_cast<uint16 *>(Out);
+        for (int32 X = 0; X < Width; ++X) {
+          const float Gray =
+              0.2126f * C[X].R + 0.7152f * C[X].G + 0.0722f * C[X].B;
+          Out16[X] = static_cast<uint16>(
+              FMath::Clamp(Gray, 0.0f, 1.0f) * 65535.0f + 0.5f);
+        }
+        break;
+      }
+      case EMcpTextureFormat::RGBA16F: {
+        FFloat16Color *RESTRICT OutHalf = reinterpret_cast<FFloat16Color *>(Out);
+        for (int32 X = 0; X < Width; ++X) {
+          OutHalf[X] = FFloat16Color(C[X]);
+        }
+        break;
+      }
+      }
+    }
+  });
+}
+
+void FMcpTextureKernels::Downsample(const uint8 *Src, int32 Width,
+                                    int32 Height, EMcpTextureFormat Format,
+                                    uint8 *Dst) {
+  const int32 DstW = FMath::Max(Width / 2, 1);
+  const int32 DstH = FMath::Max(Height / 2, 1);
+  const int32 BytesPerPixel = GetBytesPerPixel(Format);
+  ParallelFor(DstH, [&](int32 Y) {
+    // A 1-pixel-wide source axis averages the pixel with itself.
+    const int32 SY0 = FMath::Min(Y * 2, Height - 1);
+    const int32 SY1 = FMath::Min(Y * 2 + 1, Height - 1);
+    const uint8 *Row0 = Src + static_cast<int64>(SY0) * Width * BytesPerPixel;
+    const uint8 *Row1 = Src + static_cast<int64>(SY1) * Width * BytesPerPixel;
+    uint8 *Out = Dst + static_cast<int64>(Y) * DstW * BytesPerPixel;
+    for (int32 X = 0; X < DstW; ++X) {
+      const int32 SX0 = FMath::Min(X * 2, Width - 1);
+      const int32 SX1 = FMath::Min(X * 2 + 1, Width - 1);
+      switch (Format) {
+      case EMcpTextureFormat::BGRA8:
+      case EMcpTextureFormat::G8:
+        for (int32 C = 0; C < BytesPerPixel; ++C) {
+          const uint32 Sum = Row0[SX0 * BytesPerPixel + C] +
+                             Row0[SX1 * BytesPerPixel + C] +
+                             Row1[SX0 * BytesPerPixel + C] +
+                             Row1[SX1 * BytesPerPixel + C];
+          Out[X * BytesPerPixel + C] = static_cast<uint8>((Sum + 2) >> 2);
+        }
+        break;
+      case EMcpTextureFormat::G16: {
+        const uint16 *In0 = reinterpret_cast<const uint16 *>(Row0);
+        const uint16 *In1 = reinterpret_cast<const uint16 *>(Row1);
+        const uint32 Sum = In0[SX0] + In0[SX1] + In1[SX0] + In1[SX1];
+        reinterpret_cast<uint16 *>(Out)[X] = static_cast<uint16>((Sum + 2) >> 2);
+        break;
+      }
+      case EMcpTextureFormat::RGBA16F: {
+        const FFloat16Color *In0 = reinterpret_cast<const FFloat16Color *>(Row0);
+        const FFloat16Color *In1 = reinterpret_cast<const FFloat16Color *>(Row1);
+        const FLinearColor Sum = FLinearColor(In0[SX0]) + FLinearColor(In0[SX1]) +
+                                 FLinearColor(In1[SX0]) + FLinearColor(In1[SX1]);
+        reinterpret_cast<FFloat16Color *>(Out)[X] = FFloat16Color(Sum * 0.25f);
+        break;
+      }
+      }
+    }
+  });
+}
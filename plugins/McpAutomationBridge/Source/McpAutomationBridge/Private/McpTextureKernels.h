@@ -0,0 +1,114 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Channel a height value is read from by FMcpTextureKernels::ExtractHeight. */
+enum class EMcpHeightChannel : uint8
+{
+    Luminance,
+    Red,
+    Green,
+    Blue,
+    Alpha,
+    Average
+};
+
+/** Pixel layouts the generators write, matching TSF_BGRA8, TSF_G8, TSF_G16 and TSF_RGBA16F. */
+enum class EMcpTextureFormat : uint8
+{
+    BGRA8,
+    G8,
+    G16,
+    RGBA16F
+};
+
+/**
+ * Pixel kernels for the texture handlers, over BGRA8 source mips (the layout Source.LockMip(0)
+ * returns for TSF_BGRA8). Each kernel splits its work by rows across the task graph and keeps the
+ * inner loops to straight-line arithmetic over contiguous rows so the compiler can vectorize them.
+ * Point operations go through 256-entry per-channel tables, so levels, curves and invert chained
+ * together cost a single pass. Pixels are modified in place; a kernel needing its neighbours keeps
+ * its own copy of the rows it reads.
+ */
+class FMcpTextureKernels
+{
+public:
+    /** Per-channel lookup tables indexed B, G, R, A, matching the byte order of a pixel. */
+    struct FChannelLuts
+    {
+        uint8 Table[4][256];
+
+        /** Identity tables. */
+        FChannelLuts();
+
+        /** Applies Other after this table set, so one pass does the work of both. */
+        void Then(const FChannelLuts& Other);
+
+        /** Sets the tables of the channels in Mask (bit 0 = B ... bit 3 = A) to Lut. */
+        void SetChannels(const uint8 (&Lut)[256], uint8 Mask);
+    };
+
+    static constexpr uint8 ChannelMaskRGB = 0x7;
+    static constexpr uint8 ChannelMaskAll = 0xF;
+
+    /** Photoshop-style levels on normalized inputs: input range, gamma, then output range. */
+    static void BuildLevelsLut(float InBlack, float InWhite, float Gamma, float OutBlack, float OutWhite, uint8 (&OutLut)[256]);
+
+    /** Piecewise-linear curve through (Input[i], Output[i]); identity when the points are unusable. */
+    static void BuildCurveLut(const TArray<float>& Input, const TArray<float>& Output, uint8 (&OutLut)[256]);
+
+    /** 255 - value. */
+    static void BuildInvertLut(uint8 (&OutLut)[256]);
+
+    /** Maps every channel of every pixel through its table. */
+    static void ApplyLuts(uint8* Pixels, int32 Width, int32 Height, const FChannelLuts& Luts);
+
+    /** Blends RGB toward Rec. 709 luminance by Amount (0..1); alpha is kept. */
+    static void Desaturate(uint8* Pixels, int32 Width, int32 Height, float Amount);
+
+    /** Separable box blur of RGB with edge clamping; alpha is kept. */
+    static void BoxBlur(uint8* Pixels, int32 Width, int32 Height, int32 Radius);
+
+    /** Separable Gaussian blur of RGB (sigma = Radius / 2) with edge clamping; alpha is kept. */
+    static void GaussianBlur(uint8* Pixels, int32 Width, int32 Height, int32 Radius);
+
+    /** 4-neighbour sharpen of RGB; the one-pixel border is left as is. */
+    static void Sharpen(uint8* Pixels, int32 Width, int32 Height, float Amount);
+
+    static constexpr int8 SwizzleZero = -1;
+    static constexpr int8 SwizzleOne = -2;
+
+    /**
+     * Rebuilds every pixel from its own channels: output channel C (B, G, R, A order) takes input
+     * channel Map[C], or 0 / 255 for SwizzleZero / SwizzleOne.
+     */
+    static void Swizzle(uint8* Pixels, int32 Width, int32 Height, const int8 (&Map)[4]);
+
+    /** Copies channel SrcChannel of Src into channel DstChannel of Dst for NumPixels pixels. */
+    static void CopyChannel(const uint8* Src, int32 SrcChannel, uint8* Dst, int32 DstChannel, int64 NumPixels);
+
+    /** Sets channel Channel of NumPixels pixels to Value. */
+    static void FillChannel(uint8* Pixels, int32 Channel, uint8 Value, int64 NumPixels);
+
+    /** Reads a 0..1 height per pixel. */
+    static void ExtractHeight(const uint8* Pixels, int32 Width, int32 Height, EMcpHeightChannel Channel, float* OutHeights);
+
+    /**
+     * Tangent-space normals from heights, sampled with wrapping: Sobel or central differences
+     * scaled by Strength, written as BGRA with X in R, Y in G, Z in B and alpha 255.
+     */
+    static void NormalsFromHeight(const float* Heights, int32 Width, int32 Height, float Strength, bool bSobel, bool bFlipY, uint8* OutPixels);
+
+    /** Bytes per pixel of Format. */
+    static int32 GetBytesPerPixel(EMcpTextureFormat Format);
+
+    /**
+     * Evaluates EvalRow for every row of a Width x Height image, in bands of rows across the task
+     * graph, and converts the colors to Format into Pixels (tightly packed rows). Gray formats take
+     * Rec. 709 luminance. EvalRow must fill all Width entries and be safe to call concurrently.
+     */
+    static void Generate(uint8* Pixels, int32 Width, int32 Height, EMcpTextureFormat Format, TFunctionRef<void(int32 Y, FLinearColor* OutRow)> EvalRow);
+
+    /** 2x2 box-filters a Width x Height image into the next mip, max(1, Width / 2) x max(1, Height / 2). */
+    static void Downsample(const uint8* Src, int32 Width, int32 Height, EMcpTextureFormat Format, uint8* Dst);
+};
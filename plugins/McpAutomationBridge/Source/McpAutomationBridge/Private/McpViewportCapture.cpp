@@ -0,0 +1,307 @@
+#include "McpViewportCapture.h"
+
+#include "Async/Async.h"
+#include "Containers/Ticker.h"
+#include "GlobalShader.h"
+#include "HAL/PlatformTime.h"
+#include "IImageWrapperModule.h"
+#include "Misc/Crc.h"
+#include "Modules/ModuleManager.h"
+#include "PixelShaderUtils.h"
+#include "RHIGPUReadback.h"
+#include "RHIStaticStates.h"
+#include "RenderingThread.h"
+#include "ScreenRendering.h"
+#include "UnrealClient.h"
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+#include "ShaderParameterUtils.h"
+#endif
+
+#include <atomic>
+
+namespace {
+// A viewport that stops drawing (minimized, or not realtime) never lets the
+// readback land; give up instead of polling forever.
+constexpr double ViewportCaptureTimeoutSeconds = 5.0;
+
+enum class EViewportCaptureState : uint8 { Pending, Ready, Failed };
+
+struct FViewportCaptureJob {
+  FMcpViewportCaptureRequest Request;
+  FMcpViewportCapture::FOnCaptured OnCaptured;
+  IImageWrapperModule *ImageWrappers = nullptr;
+  double StartSeconds = 0.0;
+  int32 Frames = 0;
+
+  // Render thread only.
+  TUniquePtr<FRHIGPUTextureReadback> Readback;
+  FTextureRHIRef Target;
+
+  // Written on the render thread before State leaves Pending.
+  TArray<uint8> Pixels; // Width * Height BGRA8, tightly packed
+  FString Error;
+  std::atomic<EViewportCaptureState> State{EViewportCaptureState::Pending};
+  // A readiness check is queued on the render thread.
+  std::atomic<bool> bPollQueued{false};
+};
+
+using FViewportCaptureJobRef =
+    TSharedRef<FViewportCaptureJob, ESPMode::ThreadSafe>;
+
+void FailOnRenderThread(FViewportCaptureJob &Job, const TCHAR *Error) {
+  Job.Readback.Reset();
+  Job.Target.SafeRelease();
+  Job.Error = Error;
+  Job.State = EViewportCaptureState::Failed;
+}
+
+// Draws the viewport's last frame into Job.Target with a bilinear full-screen
+// pass, which scales it and converts whatever the viewport format is to BGRA8,
+// then queues the copy to a staging buffer.
+void StartCaptureOnRenderThread(FRHICommandListImmediate &RHICmdList,
+                                FViewport *Viewport, FViewportCaptureJob &Job) {
+  FRHITexture *Source = Viewport->GetRenderTargetTexture();
+  if (!Source) {
+    FailOnRenderThread(Job, TEXT("Viewport has no render target to read"));
+    return;
+  }
+  const int32 Width = Job.Request.Width;
+  const int32 Height = Job.Request.Height;
+
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
+  const FRHITextureCreateDesc Desc =
+      FRHITextureCreateDesc::Create2D(TEXT("McpViewportCapture"), Width,
+                                      Height, PF_B8G8R8A8)
+          .SetFlags(ETextureCreateFlags::RenderTargetable)
+          .SetInitialState(ERHIAccess::RTV);
+  Job.Target = RHICreateTexture(Desc);
+#else
+  FRHIResourceCreateInfo CreateInfo(TEXT("McpViewportCapture"));
+  FTexture2DRHIRef Created =
+      RHICreateTexture2D(Width, Height, PF_B8G8R8A8, 1, 1,
+                         TexCreate_RenderTargetable, ERHIAccess::RTV,
+                         CreateInfo);
+  Job.Target = Created.GetReference();
+#endif
+  if (!Job.Target.IsValid()) {
+    FailOnRenderThread(Job, TEXT("Failed to create the capture target"));
+    return;
+  }
+
+  RHICmdList.Transition(FRHITransitionInfo(Source, ERHIAccess::Unknown,
+                                           ERHIAccess::SRVGraphics));
+  FRHIRenderPassInfo PassInfo(Job.Target, ERenderTargetActions::DontLoad_Store);
+  RHICmdList.BeginRenderPass(PassInfo, TEXT("McpViewportCapture"));
+  RHICmdList.SetViewport(0, 0, 0.0f, Width, Height, 1.0f);
+
+  FGlobalShaderMap *ShaderMap = GetGlobalShaderMap(GMaxRHIFeatureLevel);
+  TShaderMapRef<FScreenPS> PixelShader(ShaderMap);
+  FGraphicsPipelineStateInitializer PSOInit;
+  FPixelShaderUtils::InitFullscreenPipelineState(RHICmdList, ShaderMap,
+                                                 PixelShader, PSOInit);
+  SetGraphicsPipelineState(RHICmdList, PSOInit, 0);
+  FRHISamplerState *Sampler = TStaticSamplerState<SF_Bilinear>::GetRHI();
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+  SetShaderParametersLegacyPS(RHICmdList, PixelShader, Sampler, Source);
+#else
+  PixelShader->SetParameters(RHICmdList, Sampler, Source);
+#endif
+  FPixelShaderUtils::DrawFullscreenTriangle(RHICmdList);
+  RHICmdList.EndRenderPass();
+
+  RHICmdList.Transition(
+      FRHITransitionInfo(Job.Target, ERHIAccess::RTV, ERHIAccess::CopySrc));
+  Job.Readback = MakeUnique<FRHIGPUTextureReadback>(TEXT("McpViewportCapture"));
+  Job.Readback->EnqueueCopy(RHICmdList, Job.Target);
+}
+
+// Copies the staging buffer out once the GPU has written it; until then the
+// game thread queues another check next tick.
+void PollCaptureOnRenderThread(FRHICommandListImmediate &RHICmdList,
+                               FViewportCaptureJob &Job) {
+  if (!Job.Readback.IsValid() || !Job.Readback->IsReady()) {
+    Job.bPollQueued = false;
+    return;
+  }
+  int32 RowPitchInPixels = 0;
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
+  const void *Data = Job.Readback->Lock(RowPitchInPixels);
+#else
+  void *Data = nullptr;
+  Job.Readback->LockTexture(RHICmdList, Data, RowPitchInPixels);
+#endif
+  if (!Data) {
+    FailOnRenderThread(Job, TEXT("Failed to map the capture readback"));
+    return;
+  }
+
+  const int32 Width = Job.Request.Width;
+  const int32 Height = Job.Request.Height;
+  const int32 RowBytes = Width * 4;
+  Job.Pixels.SetNumUninitialized(RowBytes * Height);
+  const uint8 *Src = static_cast<const uint8 *>(Data);
+  for (int32 Y = 0; Y < Height; ++Y) {
+    FMemory::Memcpy(Job.Pixels.GetData() + Y * RowBytes,
+                    Src + static_cast<int64>(Y) * RowPitchInPixels * 4,
+                    RowBytes);
+  }
+  Job.Readback->Unlock();
+  Job.Readback.Reset();
+  Job.Target.SafeRelease();
+  Job.State = EViewportCaptureState::Ready;
+}
+
+void FinishCapture(const FViewportCaptureJobRef &Job,
+                   FMcpViewportCaptureResult &&Result) {
+  Result.FramesWaited = Job->Frames;
+  Result.CaptureMs = (FPlatformTime::Seconds() - Job->StartSeconds) * 1000.0;
+  FMcpViewportCapture::FOnCaptured OnCaptured = MoveTemp(Job->OnCaptured);
+  if (OnCaptured) {
+    OnCaptured(MoveTemp(Result));
+  }
+}
+
+void FailCapture(const FViewportCaptureJobRef &Job, const TCHAR *ErrorCode,
+                 const FString &Error) {
+  FMcpViewportCaptureResult Result;
+  Result.ErrorCode = ErrorCode;
+  Result.Error = Error;
+  FinishCapture(Job, MoveTemp(Result));
+}
+
+// Row by row so the masked copy stays small.
+uint32 HashCapturePixels(const TArray<uint8> &Pixels, int32 Width,
+                         int32 Height) {
+  TArray<uint32> Row;
+  Row.SetNumUninitialized(Width);
+  const uint32 *Src = reinterpret_cast<const uint32 *>(Pixels.GetData());
+  uint32 Crc = 0;
+  for (int32 Y = 0; Y < Height; ++Y) {
+    for (int32 X = 0; X < Width; ++X) {
+      Row[X] = Src[static_cast<int64>(Y) * Width + X] & 0xFCFCFCFCu;
+    }
+    Crc = FCrc::MemCrc32(Row.GetData(), Width * sizeof(uint32), Crc);
+  }
+  return Crc;
+}
+
+// Encodes the pixels on a worker and reports back on the game thread.
+void EncodeCapture(const FViewportCaptureJobRef &Job) {
+  AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [Job]() {
+    FMcpViewportCaptureResult Result;
+    Result.Width = Job->Request.Width;
+    Result.Height = Job->Request.Height;
+
+    // Viewport alpha is not coverage; keep PNG captures opaque.
+    TArray<uint8> &Pixels = Job->Pixels;
+    for (int32 Index = 3; Index < Pixels.Num(); Index += 4) {
+      Pixels[Index] = 255;
+    }
+
+    Result.PixelHash = HashCapturePixels(Pixels, Result.Width, Result.Height);
+    if (Job->Request.bSkipUnchanged &&
+        Result.PixelHash == Job->Request.PreviousHash) {
+      Result.bSuccess = true;
+      Result.bUnchanged = true;
+      Pixels.Empty();
+      AsyncTask(ENamedThreads::GameThread,
+                [Job, Result = MoveTemp(Result)]() mutable {
+                  FinishCapture(Job, MoveTemp(Result));
+                });
+      return;
+    }
+
+    const bool bPng = Job->Request.Format == EImageFormat::PNG;
+    TSharedPtr<IImageWrapper> Wrapper =
+        Job->ImageWrappers->CreateImageWrapper(Job->Request.Format);
+    if (!Wrapper.IsValid() ||
+        !Wrapper->SetRaw(Pixels.GetData(), Pixels.Num(), Result.Width,
+                         Result.Height, ERGBFormat::BGRA, 8)) {
+      Result.ErrorCode = TEXT("ENCODE_FAILED");
+      Result.Error = TEXT("Failed to create image encoder");
+    } else {
+      TArray<uint8> Encoded =
+          Wrapper->GetCompressed(bPng ? 100 : Job->Request.Quality);
+      Result.Encoded = MoveTemp(Encoded);
+      Result.bSuccess = Result.Encoded.Num() > 0;
+      if (!Result.bSuccess) {
+        Result.ErrorCode = TEXT("ENCODE_FAILED");
+        Result.Error = TEXT("Failed to compress image");
+      }
+    }
+    Pixels.Empty();
+
+    AsyncTask(ENamedThreads::GameThread,
+              [Job, Result = MoveTemp(Result)]() mutable {
+                FinishCapture(Job, MoveTemp(Result));
+              });
+  });
+}
+
+// Game thread, once per tick until the capture resolves.
+bool TickCapture(const FViewportCaptureJobRef &Job) {
+  ++Job->Frames;
+  switch (Job->State.load()) {
+  case EViewportCaptureState::Ready:
+    EncodeCapture(Job);
+    return false;
+  case EViewportCaptureState::Failed:
+    FailCapture(Job, TEXT("CAPTURE_FAILED"), Job->Error);
+    return false;
+  default:
+    break;
+  }
+
+  if (FPlatformTime::Seconds() - Job->StartSeconds >
+      ViewportCaptureTimeoutSeconds) {
+    // Queued after any pending check, so the readback is released last.
+    ENQUEUE_RENDER_COMMAND(McpViewportCaptureRelease)
+    ([Job](FRHICommandListImmediate &) {
+      Job->Readback.Reset();
+      Job->Target.SafeRelease();
+    });
+    FailCapture(Job, TEXT("CAPTURE_TIMEOUT"),
+                TEXT("Viewport readback did not complete; is the viewport "
+                     "rendering?"));
+    return false;
+  }
+  if (!Job->bPollQueued.exchange(true)) {
+    ENQUEUE_RENDER_COMMAND(McpViewportCapturePoll)
+    ([Job](FRHICommandListImmediate &RHICmdList) {
+      PollCaptureOnRenderThread(RHICmdList, *Job);
+    });
+  }
+  return true;
+}
+} // namespace
+
+void FMcpViewportCapture::Capture(FViewport *Viewport,
+                                  const FMcpViewportCaptureRequest &Request,
+                                  FOnCaptured &&OnCaptured) {
+  check(IsInGameThread());
+  FViewportCaptureJobRef Job =
+      MakeShared<FViewportCaptureJob, ESPMode::ThreadSafe>();
+  Job->Request = Request;
+  Job->OnCaptured = MoveTemp(OnCaptured);
+  Job->StartSeconds = FPlatformTime::Seconds();
+
+  const FIntPoint Size = Viewport ? Viewport->GetSizeXY() : FIntPoint(0, 0);
+  if (Size.X <= 0 || Size.Y <= 0) {
+    FailCapture(Job, TEXT("VIEWPORT_NOT_AVAILABLE"),
+                TEXT("Viewport has no size to capture"));
+    return;
+  }
+  if (Job->Request.Width <= 0 || Job->Request.Height <= 0) {
+    Job->Request.Width = Size.X;
+    Job->Request.Height = Size.Y;
+  }
+  Job->ImageWrappers = &FModuleManager::LoadModuleChecked<IImageWrapperModule>(
+      FName("ImageWrapper"));
+
+  ENQUEUE_RENDER_COMMAND(McpViewportCaptureStart)
+  ([Viewport, Job](FRHICommandListImmediate &RHICmdList) {
+    StartCaptureOnRenderThread(RHICmdList, Viewport, *Job);
+  });
+  FTSTicker::GetCoreTicker().AddTicker(
+      FTickerDelegate::CreateLambda([Job](float) { return TickCapture(Job); }));
+}
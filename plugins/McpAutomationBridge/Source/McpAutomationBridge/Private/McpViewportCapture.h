@@ -0,0 +1,67 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IImageWrapper.h"
+
+class FViewport;
+
+/** What FMcpViewportCapture reads back and how it encodes it. */
+struct FMcpViewportCaptureRequest
+{
+    /** Output size; the viewport is scaled to it on the GPU. Zero keeps the viewport size. */
+    int32 Width = 0;
+    int32 Height = 0;
+
+    /** EImageFormat::PNG or EImageFormat::JPEG. */
+    EImageFormat Format = EImageFormat::JPEG;
+
+    /** JPEG quality, 1..100; PNG is always lossless. */
+    int32 Quality = 85;
+
+    /** Skip encoding when the frame hashes to PreviousHash (see FMcpViewportCaptureResult::PixelHash). */
+    bool bSkipUnchanged = false;
+    uint32 PreviousHash = 0;
+};
+
+/** The encoded image, or why there is none. */
+struct FMcpViewportCaptureResult
+{
+    bool bSuccess = false;
+    FString ErrorCode;
+    FString Error;
+    int32 Width = 0;
+    int32 Height = 0;
+    TArray<uint8> Encoded;
+
+    /**
+     * CRC of the pixels with the two low bits of each channel masked, so dithering and temporal
+     * noise do not count as a change.
+     */
+    uint32 PixelHash = 0;
+
+    /** The hash matched PreviousHash and nothing was encoded; bSuccess is still set. */
+    bool bUnchanged = false;
+
+    /** Game thread ticks between the request and the readback landing. */
+    int32 FramesWaited = 0;
+    double CaptureMs = 0.0;
+};
+
+/**
+ * Viewport capture that never stalls the game thread. The last frame rendered into the viewport is
+ * drawn, scaled, into a BGRA8 target on the render thread and copied to a staging buffer through
+ * FRHIGPUTextureReadback; the game thread then polls the readback once per tick instead of
+ * flushing rendering the way FViewport::ReadPixels does, and the image is encoded on a worker
+ * thread. The result usually lands one or two frames after the request.
+ */
+class FMcpViewportCapture
+{
+public:
+    using FOnCaptured = TFunction<void(FMcpViewportCaptureResult&& Result)>;
+
+    /**
+     * Starts a capture of Viewport. OnCaptured runs exactly once on the game thread, before Capture
+     * returns when the viewport cannot be read at all. Game thread only.
+     */
+    static void Capture(FViewport* Viewport, const FMcpViewportCaptureRequest& Request, FOnCaptured&& OnCaptured);
+};
@@ -0,0 +1,648 @@
+#include "McpWidgetTreeBuilder.h"
+
+#include "Dom/JsonValue.h"
+
+#if WITH_EDITOR
+#include "Blueprint/WidgetBlueprintGeneratedClass.h"
+#include "Blueprint/WidgetTree.h"
+#include "Components/CanvasPanelSlot.h"
+#include "Components/PanelSlot.h"
+#include "Components/PanelWidget.h"
+#include "Components/Widget.h"
+#include "EdGraph/EdGraph.h"
+#include "McpAutomationBridgeHelpers.h"
+#include "UObject/Package.h"
+#include "WidgetBlueprint.h"
+#endif
+
+TSharedPtr<FJsonObject> FMcpWidgetTreeBuildResult::ToJson() const {
+  TSharedPtr<FJsonObject> Obj = MakeShared<FJsonObject>();
+  Obj->SetNumberField(TEXT("created"), Created);
+  Obj->SetNumberField(TEXT("replaced"), Replaced);
+  Obj->SetNumberField(TEXT("moved"), Moved);
+  Obj->SetNumberField(TEXT("updated"), Updated);
+  Obj->SetNumberField(TEXT("unchanged"), Unchanged);
+  Obj->SetNumberField(TEXT("bindingsChanged"), BindingsChanged);
+  TArray<TSharedPtr<FJsonValue>> Removed;
+  for (const FString &Name : RemovedWidgets) {
+    Removed.Add(MakeShared<FJsonValueString>(Name));
+  }
+  Obj->SetArrayField(TEXT("removed"), Removed);
+  TArray<TSharedPtr<FJsonValue>> ChangeValues;
+  for (const TPair<FString, FString> &Change : Changes) {
+    TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
+    Entry->SetStringField(TEXT("name"), Change.Key);
+    Entry->SetStringField(TEXT("op"), Change.Value);
+    ChangeValues.Add(MakeShared<FJsonValueObject>(Entry));
+  }
+  Obj->SetArrayField(TEXT("changes"), ChangeValues);
+  TArray<TSharedPtr<FJsonValue>> WarningValues;
+  for (const FString &Warning : Warnings) {
+    WarningValues.Add(MakeShared<FJsonValueString>(Warning));
+  }
+  Obj->SetArrayField(TEXT("warnings"), WarningValues);
+  return Obj;
+}
+
+#if WITH_EDITOR
+namespace {
+// A spec deeper or larger than this is a runaway generator, not a UI.
+constexpr int32 MaxWidgetSpecDepth = 64;
+constexpr int32 MaxWidgetSpecNodes = 10000;
+
+struct FWidgetSpecNode {
+  FName Name;
+  UClass *Class = nullptr;
+  int32 Parent = INDEX_NONE;
+  TSharedPtr<FJsonObject> Properties;
+  TSharedPtr<FJsonObject> Slot;
+  const TArray<TSharedPtr<FJsonValue>> *Bindings = nullptr;
+  UWidget *Widget = nullptr;
+  bool bReplacing = false;
+  // Index of the last child placed under this node, while building.
+  int32 LastPlacedChild = INDEX_NONE;
+};
+
+bool ParseWidgetSpec(const UWidgetBlueprint *WidgetBP,
+                     const TSharedPtr<FJsonObject> &Spec, int32 Parent,
+                     int32 Depth, TArray<FWidgetSpecNode> &Nodes,
+                     TSet<FName> &Names, FString &OutError,
+                     FString &OutErrorCode) {
+  OutErrorCode = TEXT("INVALID_ARGUMENT");
+  if (!Spec.IsValid()) {
+    OutError = TEXT("Widget spec nodes must be objects");
+    return false;
+  }
+  if (Depth > MaxWidgetSpecDepth || Nodes.Num() >= MaxWidgetSpecNodes) {
+    OutError = FString::Printf(
+        TEXT("Widget spec exceeds %d levels or %d widgets"),
+        MaxWidgetSpecDepth, MaxWidgetSpecNodes);
+    return false;
+  }
+
+  FString Name;
+  Spec->TryGetStringField(TEXT("name"), Name);
+  if (Name.IsEmpty()) {
+    OutError = TEXT("Every widget in the spec needs a name");
+    return false;
+  }
+  if (Names.Contains(FName(*Name))) {
+    OutError = FString::Printf(TEXT("Widget name '%s' appears twice in the spec"),
+                               *Name);
+    return false;
+  }
+  FString TypeName;
+  if (!Spec->TryGetStringField(TEXT("type"), TypeName)) {
+    Spec->TryGetStringField(TEXT("class"), TypeName);
+  }
+  UClass *Class = TypeName.IsEmpty() ? nullptr : ResolveClassByName(TypeName);
+  if (!Class || !Class->IsChildOf(UWidget::StaticClass()) ||
+      Class->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated)) {
+    OutError = FString::Printf(
+        TEXT("Widget '%s': '%s' is not a widget class"), *Name, *TypeName);
+    OutErrorCode = TEXT("WIDGET_CLASS_NOT_FOUND");
+    return false;
+  }
+  if (Class->ClassGeneratedBy == WidgetBP) {
+    OutError = FString::Printf(
+        TEXT("Widget '%s': a Widget Blueprint cannot contain itself"), *Name);
+    return false;
+  }
+
+  const TArray<TSharedPtr<FJsonValue>> *Children = nullptr;
+  Spec->TryGetArrayField(TEXT("children"), Children);
+  if (Children && Children->Num() > 0) {
+    const UPanelWidget *Panel =
+        Cast<UPanelWidget>(Class->GetDefaultObject());
+    if (!Panel) {
+      OutError = FString::Printf(
+          TEXT("Widget '%s' (%s) cannot have children"), *Name,
+          *Class->GetName());
+      return false;
+    }
+    if (Children->Num() > 1 && !Panel->CanHaveMultipleChildren()) {
+      OutError = FString::Printf(
+          TEXT("Widget '%s' (%s) holds a single child; the spec lists %d"),
+          *Name, *Class->GetName(), Children->Num());
+      return false;
+    }
+  }
+
+  Names.Add(FName(*Name));
+  const int32 Index = Nodes.AddDefaulted();
+  {
+    FWidgetSpecNode &Node = Nodes[Index];
+    Node.Name = FName(*Name);
+    Node.Class = Class;
+    Node.Parent = Parent;
+    const TSharedPtr<FJsonObject> *Object = nullptr;
+    if (Spec->TryGetObjectField(TEXT("properties"), Object)) {
+      Node.Properties = *Object;
+    }
+    if (Spec->TryGetObjectField(TEXT("slot"), Object)) {
+      Node.Slot = *Object;
+    }
+    Spec->TryGetArrayField(TEXT("bindings"), Node.Bindings);
+  }
+  if (Children) {
+    for (const TSharedPtr<FJsonValue> &Child : *Children) {
+      const TSharedPtr<FJsonObject> *ChildObject = nullptr;
+      if (!Child.IsValid() || !Child->TryGetObject(ChildObject) ||
+          !ParseWidgetSpec(WidgetBP, *ChildObject, Index, Depth + 1, Nodes,
+                           Names, OutError, OutErrorCode)) {
+        if (OutError.IsEmpty()) {
+          OutError = TEXT("Widget spec children must be objects");
+        }
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Editable property values of Object, concatenated: compared before and after
+// a pass to tell an updated widget from an unchanged one.
+FString ExportWidgetState(UObject *Object) {
+  FString State;
+  if (!Object) {
+    return State;
+  }
+  for (TFieldIterator<FProperty> It(Object->GetClass()); It; ++It) {
+    if (It->HasAnyPropertyFlags(CPF_Edit) &&
+        !It->HasAnyPropertyFlags(CPF_Transient)) {
+      MCP_PROPERTY_EXPORT_TEXT(*It, State,
+                               It->ContainerPtrToValuePtr<void>(Object),
+                               nullptr, Object, PPF_None);
+      State += TEXT('|');
+    }
+  }
+  return State;
+}
+
+bool ReadWidgetSpecVector(const TSharedPtr<FJsonValue> &Value,
+                          FVector2D &Out) {
+  const TSharedPtr<FJsonObject> *Object = nullptr;
+  const TArray<TSharedPtr<FJsonValue>> *Array = nullptr;
+  if (Value->TryGetObject(Object)) {
+    double X = Out.X;
+    double Y = Out.Y;
+    (*Object)->TryGetNumberField(TEXT("x"), X);
+    (*Object)->TryGetNumberField(TEXT("y"), Y);
+    Out = FVector2D(X, Y);
+    return true;
+  }
+  if (Value->TryGetArray(Array) && Array->Num() == 2) {
+    Out = FVector2D((*Array)[0]->AsNumber(), (*Array)[1]->AsNumber());
+    return true;
+  }
+  return false;
+}
+
+bool ReadWidgetSpecAnchors(const TSharedPtr<FJsonValue> &Value,
+                           FAnchors &Out) {
+  FString Preset;
+  if (Value->TryGetString(Preset)) {
+    struct FAnchorPreset {
+      const TCHAR *Name;
+      FAnchors Anchors;
+    };
+    static const FAnchorPreset Presets[] = {
+        {TEXT("TopLeft"), FAnchors(0.0f, 0.0f)},
+        {TEXT("TopCenter"), FAnchors(0.5f, 0.0f)},
+        {TEXT("TopRight"), FAnchors(1.0f, 0.0f)},
+        {TEXT("CenterLeft"), FAnchors(0.0f, 0.5f)},
+        {TEXT("Center"), FAnchors(0.5f, 0.5f)},
+        {TEXT("CenterRight"), FAnchors(1.0f, 0.5f)},
+        {TEXT("BottomLeft"), FAnchors(0.0f, 1.0f)},
+        {TEXT("BottomCenter"), FAnchors(0.5f, 1.0f)},
+        {TEXT("BottomRight"), FAnchors(1.0f, 1.0f)},
+        {TEXT("StretchHorizontal"), FAnchors(0.0f, 0.5f, 1.0f, 0.5f)},
+        {TEXT("StretchVertical"), FAnchors(0.5f, 0.0f, 0.5f, 1.0f)},
+        {TEXT("StretchAll"), FAnchors(0.0f, 0.0f, 1.0f, 1.0f)},
+    };
+    for (const FAnchorPreset &Entry : Presets) {
+      if (Preset.Equals(Entry.Name, ESearchCase::IgnoreCase)) {
+        Out = Entry.Anchors;
+        return true;
+      }
+    }
+    return false;
+  }
+  const TSharedPtr<FJsonObject> *Object = nullptr;
+  if (!Value->TryGetObject(Object)) {
+    return false;
+  }
+  FVector2D Min(Out.Minimum);
+  FVector2D Max(Out.Maximum);
+  const TSharedPtr<FJsonValue> MinValue = (*Object)->TryGetField(TEXT("min"));
+  const TSharedPtr<FJsonValue> MaxValue = (*Object)->TryGetField(TEXT("max"));
+  if ((MinValue.IsValid() && !ReadWidgetSpecVector(MinValue, Min)) ||
+      (MaxValue.IsValid() && !ReadWidgetSpecVector(MaxValue, Max))) {
+    return false;
+  }
+  Out.Minimum = Min;
+  Out.Maximum = Max;
+  return true;
+}
+
+bool ApplyWidgetSpecValue(UObject *Target, const FString &Path,
+                          const TSharedPtr<FJsonValue> &Value,
+                          FString &OutError) {
+  void *Container = nullptr;
+  FProperty *Property =
+      ResolveNestedPropertyPath(Target, Path, Container, OutError);
+  if (!Property || !Container) {
+    return false;
+  }
+  // ApplyJsonValueToProperty has no FText case; widget text is the common one.
+  if (FTextProperty *TextProperty = CastField<FTextProperty>(Property)) {
+    FString Text;
+    if (!Value->TryGetString(Text)) {
+      OutError = TEXT("expected a string");
+      return false;
+    }
+    TextProperty->SetPropertyValue_InContainer(Container,
+                                               FText::FromString(Text));
+    return true;
+  }
+  return ApplyJsonValueToProperty(Container, Property, Value, OutError);
+}
+
+void ApplyWidgetSpecSlot(UPanelSlot *Slot, const FString &WidgetName,
+                         const TSharedPtr<FJsonObject> &Spec,
+                         TArray<FString> &Warnings) {
+  UCanvasPanelSlot *CanvasSlot = Cast<UCanvasPanelSlot>(Slot);
+  for (const TPair<FString, TSharedPtr<FJsonValue>> &Pair : Spec->Values) {
+    const FString &Key = Pair.Key;
+    const TSharedPtr<FJsonValue> &Value = Pair.Value;
+    FString Error;
+    bool bApplied = false;
+    if (CanvasSlot && Key.Equals(TEXT("anchors"), ESearchCase::IgnoreCase)) {
+      FAnchors Anchors = CanvasSlot->GetAnchors();
+      bApplied = ReadWidgetSpecAnchors(Value, Anchors);
+      if (bApplied) {
+        CanvasSlot->SetAnchors(Anchors);
+      } else {
+        Error = TEXT("expected a preset name or { min, max }");
+      }
+    } else if (CanvasSlot &&
+               (Key.Equals(TEXT("position"), ESearchCase::IgnoreCase) ||
+                Key.Equals(TEXT("size"), ESearchCase::IgnoreCase) ||
+                Key.Equals(TEXT("alignment"), ESearchCase::IgnoreCase))) {
+      FVector2D Vector = FVector2D::ZeroVector;
+      bApplied = ReadWidgetSpecVector(Value, Vector);
+      if (!bApplied) {
+        Error = TEXT("expected { x, y } or [x, y]");
+      } else if (Key.Equals(TEXT("position"), ESearchCase::IgnoreCase)) {
+        CanvasSlot->SetPosition(Vector);
+      } else if (Key.Equals(TEXT("size"), ESearchCase::IgnoreCase)) {
+        CanvasSlot->SetSize(Vector);
+      } else {
+        CanvasSlot->SetAlignment(Vector);
+      }
+    } else if (CanvasSlot &&
+               Key.Equals(TEXT("autoSize"), ESearchCase::IgnoreCase)) {
+      bool bAutoSize = false;
+      bApplied = Value->TryGetBool(bAutoSize);
+      if (bApplied) {
+        CanvasSlot->SetAutoSize(bAutoSize);
+      } else {
+        Error = TEXT("expected a boolean");
+      }
+    } else if (CanvasSlot &&
+               Key.Equals(TEXT("zOrder"), ESearchCase::IgnoreCase)) {
+      double ZOrder = 0.0;
+      bApplied = Value->TryGetNumber(ZOrder);
+      if (bApplied) {
+        CanvasSlot->SetZOrder(static_cast<int32>(ZOrder));
+      } else {
+        Error = TEXT("expected a number");
+      }
+    } else if (Key.Equals(TEXT("padding"), ESearchCase::IgnoreCase)) {
+      // Every box-like slot has an FMargin Padding; most have no shared
+      // setter, so it goes through reflection.
+      FStructProperty *PaddingProperty = CastField<FStructProperty>(
+          Slot->GetClass()->FindPropertyByName(TEXT("Padding")));
+      FMargin *Padding =
+          PaddingProperty && PaddingProperty->Struct == TBaseStructure<FMargin>::Get()
+              ? PaddingProperty->ContainerPtrToValuePtr<FMargin>(Slot)
+              : nullptr;
+      double Uniform = 0.0;
+      const TSharedPtr<FJsonObject> *Sides = nullptr;
+      if (!Padding) {
+        Error = TEXT("this slot has no padding");
+      } else if (Value->TryGetNumber(Uniform)) {
+        *Padding = FMargin(static_cast<float>(Uniform));
+        bApplied = true;
+      } else if (Value->TryGetObject(Sides)) {
+        double Left = Padding->Left;
+        double Top = Padding->Top;
+        double Right = Padding->Right;
+        double Bottom = Padding->Bottom;
+        (*Sides)->TryGetNumberField(TEXT("left"), Left);
+        (*Sides)->TryGetNumberField(TEXT("top"), Top);
+        (*Sides)->TryGetNumberField(TEXT("right"), Right);
+        (*Sides)->TryGetNumberField(TEXT("bottom"), Bottom);
+        *Padding = FMargin(static_cast<float>(Left), static_cast<float>(Top),
+                           static_cast<float>(Right),
+                           static_cast<float>(Bottom));
+        bApplied = true;
+      } else {
+        Error = TEXT("expected a number or { left, top, right, bottom }");
+      }
+    } else {
+      bApplied = ApplyWidgetSpecValue(Slot, Key, Value, Error);
+    }
+    if (!bApplied) {
+      Warnings.Add(FString::Printf(TEXT("%s: slot.%s: %s"), *WidgetName,
+                                   *Key, *Error));
+    }
+  }
+}
+
+// Replaces the property bindings of one widget with the spec's list; true
+// when they differ from what the Blueprint had.
+bool ApplyWidgetSpecBindings(UWidgetBlueprint *WidgetBP,
+                             const FWidgetSpecNode &Node,
+                             TArray<FString> &Warnings) {
+  const FString ObjectName = Node.Name.ToString();
+  TArray<FDelegateEditorBinding> Wanted;
+  for (const TSharedPtr<FJsonValue> &Value : *Node.Bindings) {
+    const TSharedPtr<FJsonObject> *Object = nullptr;
+    FString PropertyName;
+    FString FunctionName;
+    if (!Value.IsValid() || !Value->TryGetObject(Object) ||
+        !(*Object)->TryGetStringField(TEXT("property"), PropertyName) ||
+        !(*Object)->TryGetStringField(TEXT("function"), FunctionName)) {
+      Warnings.Add(FString::Printf(
+          TEXT("%s: bindings entries need property and function"),
+          *ObjectName));
+      continue;
+    }
+    // UMG binds "Text" through the TextDelegate property, and so on.
+    if (!FindFProperty<FDelegateProperty>(Node.Class,
+                                          *(PropertyName + TEXT("Delegate")))) {
+      Warnings.Add(FString::Printf(TEXT("%s: %s is not bindable on %s"),
+                                   *ObjectName, *PropertyName,
+                                   *Node.Class->GetName()));
+      continue;
+    }
+    UEdGraph *const *Graph = WidgetBP->FunctionGraphs.FindByPredicate(
+        [&FunctionName](const UEdGraph *Candidate) {
+          return Candidate &&
+                 Candidate->GetName().Equals(FunctionName, ESearchCase::IgnoreCase);
+        });
+    if (!Graph) {
+      Warnings.Add(FString::Printf(
+          TEXT("%s: no function graph named %s to bind %s to"), *ObjectName,
+          *FunctionName, *PropertyName));
+      continue;
+    }
+    FDelegateEditorBinding &Binding = Wanted.AddDefaulted_GetRef();
+    Binding.ObjectName = ObjectName;
+    Binding.PropertyName = FName(*PropertyName);
+    Binding.FunctionName = (*Graph)->GetFName();
+    Binding.MemberGuid = (*Graph)->GraphGuid;
+    Binding.Kind = EBindingKind::Function;
+  }
+
+  TArray<FDelegateEditorBinding> Current;
+  for (const FDelegateEditorBinding &Binding : WidgetBP->Bindings) {
+    if (Binding.ObjectName == ObjectName) {
+      Current.Add(Binding);
+    }
+  }
+  bool bSame = Current.Num() == Wanted.Num();
+  for (int32 Index = 0; bSame && Index < Wanted.Num(); ++Index) {
+    bSame = Current[Index].PropertyName == Wanted[Index].PropertyName &&
+            Current[Index].FunctionName == Wanted[Index].FunctionName &&
+            Current[Index].Kind == Wanted[Index].Kind;
+  }
+  if (bSame) {
+    return false;
+  }
+  WidgetBP->Bindings.RemoveAll([&ObjectName](const FDelegateEditorBinding &Binding) {
+    return Binding.ObjectName == ObjectName;
+  });
+  WidgetBP->Bindings.Append(Wanted);
+  return true;
+}
+
+// Takes the widget out of the tree and out of the WidgetTree's namespace, so a
+// replacement can be constructed under the same name.
+void DiscardWidget(UWidgetTree *Tree, UWidget *Widget) {
+  Tree->RemoveWidget(Widget);
+  Widget->Rename(nullptr, GetTransientPackage(), REN_DontCreateRedirectors);
+}
+} // namespace
+#endif
+
+bool FMcpWidgetTreeBuilder::Build(UWidgetBlueprint *WidgetBP,
+                                  const TSharedPtr<FJsonObject> &RootSpec,
+                                  const FMcpWidgetTreeBuildOptions &Options,
+                                  FMcpWidgetTreeBuildResult &OutResult,
+                                  FString &OutError, FString &OutErrorCode) {
+#if WITH_EDITOR
+  OutResult = FMcpWidgetTreeBuildResult();
+  if (!WidgetBP || !WidgetBP->WidgetTree) {
+    OutError = TEXT("Widget blueprint has no widget tree");
+    OutErrorCode = TEXT("NOT_FOUND");
+    return false;
+  }
+  TArray<FWidgetSpecNode> Nodes;
+  TSet<FName> Names;
+  if (!ParseWidgetSpec(WidgetBP, RootSpec, INDEX_NONE, 0, Nodes, Names,
+                       OutError, OutErrorCode)) {
+    return false;
+  }
+
+  UWidgetTree *Tree = WidgetBP->WidgetTree;
+  WidgetBP->Modify();
+  Tree->SetFlags(RF_Transactional);
+  Tree->Modify();
+
+  TArray<UWidget *> Existing;
+  Tree->GetAllWidgets(Existing);
+  TMap<FName, UWidget *> ExistingByName;
+  for (UWidget *Widget : Existing) {
+    ExistingByName.Add(Widget->GetFName(), Widget);
+  }
+
+  // Keep what matches by name and type; everything else the spec displaces
+  // (or, when pruning, does not name) goes before anything is built, so the
+  // names are free and sibling positions compare cleanly.
+  TSet<UWidget *> Kept;
+  TArray<UWidget *> Discard;
+  for (FWidgetSpecNode &Node : Nodes) {
+    UWidget *Found = ExistingByName.FindRef(Node.Name);
+    if (Found && Found->GetClass() == Node.Class) {
+      Node.Widget = Found;
+      Kept.Add(Found);
+    } else if (Found) {
+      Node.bReplacing = true;
+      Discard.Add(Found);
+    }
+  }
+  if (Options.bPrune) {
+    for (UWidget *Widget : Existing) {
+      if (!Kept.Contains(Widget) && !Discard.Contains(Widget)) {
+        Discard.Add(Widget);
+      }
+    }
+  } else {
+    // A replaced panel takes the children the spec does not claim with it.
+    for (int32 Index = 0; Index < Discard.Num(); ++Index) {
+      TArray<UWidget *> Descendants;
+      UWidgetTree::GetChildWidgets(Discard[Index], Descendants);
+      for (UWidget *Descendant : Descendants) {
+        if (!Kept.Contains(Descendant)) {
+          Discard.AddUnique(Descendant);
+        }
+      }
+    }
+    // The tree has one root; an unnamed old one cannot stay.
+    UWidget *OldRoot = Tree->RootWidget;
+    if (OldRoot && !Kept.Contains(OldRoot) && !Discard.Contains(OldRoot) &&
+        OldRoot->GetFName() != Nodes[0].Name) {
+      Discard.Add(OldRoot);
+      TArray<UWidget *> Descendants;
+      UWidgetTree::GetChildWidgets(OldRoot, Descendants);
+      for (UWidget *Descendant : Descendants) {
+        if (!Kept.Contains(Descendant)) {
+          Discard.AddUnique(Descendant);
+        }
+      }
+    }
+  }
+  for (UWidget *Widget : Discard) {
+    if (!Names.Contains(Widget->GetFName())) {
+      OutResult.RemovedWidgets.Add(Widget->GetName());
+    }
+    DiscardWidget(Tree, Widget);
+  }
+  if (Options.bPrune) {
+    const int32 Before = WidgetBP->Bindings.Num();
+    WidgetBP->Bindings.RemoveAll([&Names](const FDelegateEditorBinding &Binding) {
+      return !Names.Contains(FName(*Binding.ObjectName));
+    });
+    OutResult.BindingsChanged += Before - WidgetBP->Bindings.Num();
+  }
+
+  // Nodes are in pre-order, so every parent exists before its children.
+  for (int32 Index = 0; Index < Nodes.Num(); ++Index) {
+    FWidgetSpecNode &Node = Nodes[Index];
+    const FString WidgetName = Node.Name.ToString();
+    const bool bNew = Node.Widget == nullptr;
+    FString StateBefore;
+    if (bNew) {
+      Node.Widget = Tree->ConstructWidget<UWidget>(Node.Class, Node.Name);
+      if (!Node.Widget) {
+        OutResult.Warnings.Add(FString::Printf(
+            TEXT("%s: could not construct %s"), *WidgetName,
+            *Node.Class->GetName()));
+        continue;
+      }
+    } else {
+      Node.Widget->Modify();
+      StateBefore = ExportWidgetState(Node.Widget);
+    }
+    UWidget *Widget = Node.Widget;
+
+    bool bMoved = false;
+    if (Node.Parent == INDEX_NONE) {
+      if (Tree->RootWidget != Widget) {
+        if (UPanelWidget *OldParent = Widget->GetParent()) {
+          OldParent->RemoveChild(Widget);
+        }
+        Tree->RootWidget = Widget;
+        bMoved = true;
+      }
+    } else {
+      FWidgetSpecNode &ParentNode = Nodes[Node.Parent];
+      UPanelWidget *Panel = Cast<UPanelWidget>(ParentNode.Widget);
+      if (!Panel) {
+        OutResult.Warnings.Add(FString::Printf(
+            TEXT("%s: parent %s was not built"), *WidgetName,
+            *ParentNode.Name.ToString()));
+        continue;
+      }
+      // Siblings the spec does not list (prune off) may sit in between;
+      // only order relative to the listed ones matters.
+      int32 Position =
+          Widget->GetParent() == Panel ? Panel->GetChildIndex(Widget) : INDEX_NONE;
+      if (Position == INDEX_NONE || Position <= ParentNode.LastPlacedChild) {
+        if (UPanelWidget *OldParent = Widget->GetParent()) {
+          OldParent->RemoveChild(Widget);
+        }
+        Position = ParentNode.LastPlacedChild + 1;
+        if (!Panel->InsertChildAt(Position, Widget)) {
+          OutResult.Warnings.Add(FString::Printf(
+              TEXT("%s: %s would not take it as a child"), *WidgetName,
+              *ParentNode.Name.ToString()));
+          continue;
+        }
+        bMoved = true;
+      }
+      ParentNode.LastPlacedChild = Position;
+    }
+
+    const FString SlotBefore = bNew || bMoved ? FString() : ExportWidgetState(Widget->Slot);
+    if (Node.Properties.IsValid()) {
+      for (const TPair<FString, TSharedPtr<FJsonValue>> &Pair :
+           Node.Properties->Values) {
+        FString Error;
+        if (!ApplyWidgetSpecValue(Widget, Pair.Key, Pair.Value, Error)) {
+          OutResult.Warnings.Add(FString::Printf(TEXT("%s: %s: %s"),
+                                                 *WidgetName, *Pair.Key, *Error));
+        }
+      }
+    }
+    if (Node.Slot.IsValid()) {
+      if (Widget->Slot) {
+        if (!bNew) {
+          Widget->Slot->Modify();
+        }
+        ApplyWidgetSpecSlot(Widget->Slot, WidgetName, Node.Slot,
+                            OutResult.Warnings);
+      } else {
+        OutResult.Warnings.Add(FString::Printf(
+            TEXT("%s: the root widget has no slot"), *WidgetName));
+      }
+    }
+    bool bBindingsChanged = false;
+    if (Node.Bindings) {
+      bBindingsChanged =
+          ApplyWidgetSpecBindings(WidgetBP, Node, OutResult.Warnings);
+      OutResult.BindingsChanged += bBindingsChanged ? 1 : 0;
+    }
+
+    const TCHAR *Op = nullptr;
+    if (bNew) {
+      if (Node.bReplacing) {
+        Op = TEXT("replaced");
+        ++OutResult.Replaced;
+      } else {
+        Op = TEXT("created");
+        ++OutResult.Created;
+      }
+    } else if (bMoved) {
+      Op = TEXT("moved");
+      ++OutResult.Moved;
+    } else if (bBindingsChanged || ExportWidgetState(Widget) != StateBefore ||
+               ExportWidgetState(Widget->Slot) != SlotBefore) {
+      Op = TEXT("updated");
+      ++OutResult.Updated;
+    } else {
+      ++OutResult.Unchanged;
+    }
+    if (Op) {
+      OutResult.Changes.Emplace(WidgetName, Op);
+    }
+  }
+  return true;
+#else
+  OutError = TEXT("build_widget_tree requires the editor");
+  OutErrorCode = TEXT("NOT_AVAILABLE");
+  return false;
+#endif
+}
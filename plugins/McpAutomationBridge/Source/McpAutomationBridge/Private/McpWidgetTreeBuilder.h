@@ -0,0 +1,66 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+class UWidgetBlueprint;
+
+/** How build_widget_tree reconciles the spec with the tree already in the Widget Blueprint. */
+struct FMcpWidgetTreeBuildOptions
+{
+    /** Remove widgets (and their property bindings) the spec does not name; off keeps them in place. */
+    bool bPrune = true;
+};
+
+/** What one build_widget_tree pass changed. */
+struct FMcpWidgetTreeBuildResult
+{
+    int32 Created = 0;
+    /** Widgets that kept their name but changed type, so were rebuilt. */
+    int32 Replaced = 0;
+    /** Existing widgets that changed parent or position among their siblings. */
+    int32 Moved = 0;
+    /** Existing widgets left in place whose properties, slot or bindings changed. */
+    int32 Updated = 0;
+    int32 Unchanged = 0;
+    TArray<FString> RemovedWidgets;
+    int32 BindingsChanged = 0;
+    /** Name and outcome (created, replaced, moved, updated) of every widget that changed. */
+    TArray<TPair<FString, FString>> Changes;
+    /** Properties, slot settings and bindings that could not be applied; the rest of the build went ahead. */
+    TArray<FString> Warnings;
+
+    bool HasChanges() const
+    {
+        return Created > 0 || Replaced > 0 || Moved > 0 || Updated > 0 || RemovedWidgets.Num() > 0 ||
+            BindingsChanged > 0;
+    }
+
+    TSharedPtr<FJsonObject> ToJson() const;
+};
+
+/**
+ * Builds a whole UMG widget tree from one nested declarative spec, so a HUD is one request and
+ * one compile instead of an add_* request per widget. Each spec node is
+ * { name, type, properties?, slot?, bindings?, children? }: type is a widget class (short name
+ * such as "CanvasPanel", a class path, or a Widget Blueprint), properties and slot are reflected
+ * property values on the widget and on the slot its parent gives it (canvas slots also take
+ * anchors, position, size, alignment, autoSize and zOrder; any slot takes padding), and bindings
+ * is [{ property, function }] binding e.g. Text to an existing function graph.
+ *
+ * The spec is reconciled with the existing tree by widget name: widgets that match name and type
+ * are kept (so variable references in the graphs survive) and only moved or edited where the spec
+ * differs, so re-sending an unchanged spec changes nothing. The whole spec is validated before
+ * the tree is touched. The caller marks the Blueprint modified and compiles it. Editor only.
+ */
+class FMcpWidgetTreeBuilder
+{
+public:
+    /**
+     * Applies RootSpec to WidgetBP's widget tree. Returns false with OutError and OutErrorCode,
+     * leaving the tree as it was, when the spec is invalid.
+     */
+    static bool Build(UWidgetBlueprint* WidgetBP, const TSharedPtr<FJsonObject>& RootSpec,
+        const FMcpWidgetTreeBuildOptions& Options, FMcpWidgetTreeBuildResult& OutResult, FString& OutError,
+        FString& OutErrorCode);
+};
@@ -0,0 +1,392 @@
+#include "McpWorldPartitionRegionLoader.h"
+
+#include "Algo/AnyOf.h"
+#include "Containers/Ticker.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+#include "UObject/UObjectGlobals.h"
+
+#if WITH_EDITOR
+#include "Editor.h"
+#include "WorldPartition/WorldPartition.h"
+#if __has_include("WorldPartition/WorldPartitionEditorLoaderAdapter.h")
+#include "WorldPartition/LoaderAdapter/LoaderAdapterShape.h"
+#include "WorldPartition/WorldPartitionEditorLoaderAdapter.h"
+#define MCP_REGION_LOADER_HAS_ADAPTER 1
+#else
+#define MCP_REGION_LOADER_HAS_ADAPTER 0
+#endif
+#if __has_include("WorldPartition/WorldPartitionEditorSubsystem.h")
+#include "WorldPartition/WorldPartitionEditorSubsystem.h"
+#define MCP_REGION_LOADER_HAS_SUBSYSTEM 1
+#elif __has_include("WorldPartitionEditor/WorldPartitionEditorSubsystem.h")
+#include "WorldPartitionEditor/WorldPartitionEditorSubsystem.h"
+#define MCP_REGION_LOADER_HAS_SUBSYSTEM 1
+#else
+#define MCP_REGION_LOADER_HAS_SUBSYSTEM 0
+#endif
+#else
+#define MCP_REGION_LOADER_HAS_ADAPTER 0
+#define MCP_REGION_LOADER_HAS_SUBSYSTEM 0
+#endif
+
+namespace {
+struct FLoadedRegion {
+  FString Name;
+  FBox Bounds = FBox(ForceInit);
+  TWeakObjectPtr<UWorld> World;
+  /** UWorldPartitionEditorLoaderAdapter; null for subsystem-loaded regions. */
+  TWeakObjectPtr<UObject> Adapter;
+  bool bUnloadable = false;
+  int32 ResidentActors = 0;
+  double LastUseSeconds = 0.0;
+};
+
+TArray<FLoadedRegion> GLoadedRegions;
+int32 GRegionNameCounter = 0;
+
+double GetUsedMemoryMB() {
+  return static_cast<double>(FPlatformMemory::GetStats().UsedPhysical) /
+         (1024.0 * 1024.0);
+}
+
+TArray<TSharedPtr<FJsonValue>> RegionVectorToJson(const FVector &Vector) {
+  return {MakeShared<FJsonValueNumber>(Vector.X),
+          MakeShared<FJsonValueNumber>(Vector.Y),
+          MakeShared<FJsonValueNumber>(Vector.Z)};
+}
+
+// Regions of a world that was closed, or of any world but the current one,
+// went away with it.
+void ForgetStaleRegions(UWorld *World) {
+  GLoadedRegions.RemoveAll([World](const FLoadedRegion &Region) {
+    return !Region.World.IsValid() || Region.World.Get() != World ||
+           (Region.bUnloadable && !Region.Adapter.IsValid());
+  });
+}
+
+int32 CountResidentActors(UWorld *World, const FBox &Bounds) {
+  int32 Count = 0;
+  for (TActorIterator<AActor> It(World); It; ++It) {
+    if (Bounds.IsInsideOrOn(It->GetActorLocation())) {
+      ++Count;
+    }
+  }
+  return Count;
+}
+
+void UnloadRegion(FLoadedRegion &Region) {
+#if MCP_REGION_LOADER_HAS_ADAPTER
+  UWorldPartitionEditorLoaderAdapter *Adapter =
+      Cast<UWorldPartitionEditorLoaderAdapter>(Region.Adapter.Get());
+  UWorld *World = Region.World.Get();
+  UWorldPartition *WorldPartition = World ? World->GetWorldPartition() : nullptr;
+  if (Adapter && WorldPartition) {
+    if (Adapter->GetLoaderAdapter()) {
+      Adapter->GetLoaderAdapter()->Unload();
+    }
+    WorldPartition->ReleaseEditorLoaderAdapter(Adapter);
+  }
+#endif
+  Region.Adapter.Reset();
+}
+
+// Loads one region now; the editor resolves actor references synchronously,
+// so the region is resident when this returns.
+FMcpRegionLoadResult LoadRegionNow(UWorld *World,
+                                   const FMcpRegionRequest &Request) {
+  FMcpRegionLoadResult Result;
+  Result.Name = Request.Name;
+  Result.Bounds = Request.Bounds;
+  const double StartSeconds = FPlatformTime::Seconds();
+
+  FLoadedRegion *Existing = GLoadedRegions.FindByPredicate(
+      [&Request](const FLoadedRegion &Region) {
+        return Region.Name.Equals(Request.Name, ESearchCase::IgnoreCase);
+      });
+  if (Existing && Existing->Bounds.Equals(Request.Bounds)) {
+    Existing->LastUseSeconds = StartSeconds;
+    Existing->ResidentActors = CountResidentActors(World, Request.Bounds);
+    Result.bLoaded = true;
+    Result.bAlreadyLoaded = true;
+    Result.ResidentActors = Existing->ResidentActors;
+    return Result;
+  }
+  if (Existing) {
+    // Same name, new bounds: the region moved.
+    UnloadRegion(*Existing);
+    GLoadedRegions.RemoveAll([&Request](const FLoadedRegion &Region) {
+      return Region.Name.Equals(Request.Name, ESearchCase::IgnoreCase);
+    });
+  }
+
+  FLoadedRegion Region;
+  Region.Name = Request.Name;
+  Region.Bounds = Request.Bounds;
+  Region.World = World;
+#if MCP_REGION_LOADER_HAS_ADAPTER
+  if (UWorldPartition *WorldPartition = World->GetWorldPartition()) {
+    UWorldPartitionEditorLoaderAdapter *Adapter =
+        WorldPartition->CreateEditorLoaderAdapter<FLoaderAdapterShape>(
+            World, Request.Bounds, *FString::Printf(TEXT("MCP %s"), *Request.Name));
+    if (Adapter && Adapter->GetLoaderAdapter()) {
+      Adapter->GetLoaderAdapter()->SetUserCreated(true);
+      Adapter->GetLoaderAdapter()->Load();
+      Region.Adapter = Adapter;
+      Region.bUnloadable = true;
+      Result.bLoaded = true;
+    }
+  }
+#endif
+#if MCP_REGION_LOADER_HAS_SUBSYSTEM
+  if (!Result.bLoaded) {
+    if (UWorldPartitionEditorSubsystem *Subsystem =
+            GEditor ? GEditor->GetEditorSubsystem<UWorldPartitionEditorSubsystem>()
+                    : nullptr) {
+      Subsystem->LoadRegion(Request.Bounds);
+      Result.bLoaded = true;
+    }
+  }
+#endif
+  if (!Result.bLoaded) {
+    Result.Error = TEXT("WorldPartition region loading not supported or failed "
+                        "in this engine version.");
+    return Result;
+  }
+  Region.ResidentActors = CountResidentActors(World, Request.Bounds);
+  Region.LastUseSeconds = FPlatformTime::Seconds();
+  Result.ResidentActors = Region.ResidentActors;
+  Result.LoadMs = (Region.LastUseSeconds - StartSeconds) * 1000.0;
+  GLoadedRegions.Add(MoveTemp(Region));
+  return Result;
+}
+
+struct FRegionPipeline {
+  TWeakObjectPtr<UWorld> World;
+  TArray<FMcpRegionRequest> Requests;
+  FMcpRegionUnloadPolicy Policy;
+  int32 Next = 0;
+  double StartSeconds = 0.0;
+  double TimeoutSeconds = 0.0;
+  FMcpRegionPipelineResult Result;
+  TFunction<bool(int32, int32, const FMcpRegionLoadResult &)> OnProgress;
+  TFunction<void(const FMcpRegionPipelineResult &)> OnFinished;
+};
+using FRegionPipelineRef = TSharedRef<FRegionPipeline>;
+
+// Unloads least recently used regions the pipeline no longer protects until
+// the policy holds. Regions the pipeline visited and left more than
+// KeepBehind regions ago go first, as a moving streaming source would drop
+// them.
+void ApplyUnloadPolicy(const FRegionPipelineRef &Pipeline) {
+  const FMcpRegionUnloadPolicy &Policy = Pipeline->Policy;
+  TSet<FString> Protected;
+  const int32 Current = Pipeline->Next - 1;
+  const int32 FirstKept =
+      Policy.KeepBehind > 0 ? FMath::Max(0, Current - Policy.KeepBehind)
+                            : Current;
+  for (int32 Index = FirstKept; Index <= Current; ++Index) {
+    Protected.Add(Pipeline->Requests[Index].Name.ToLower());
+  }
+
+  const TArrayView<const FMcpRegionRequest> LeftBehind(
+      Pipeline->Requests.GetData(), FirstKept);
+
+  auto EvictOne = [&Pipeline, &Protected, LeftBehind](bool bOnlyLeftBehind) {
+    int32 Oldest = INDEX_NONE;
+    for (int32 Index = 0; Index < GLoadedRegions.Num(); ++Index) {
+      const FLoadedRegion &Region = GLoadedRegions[Index];
+      if (!Region.bUnloadable || Protected.Contains(Region.Name.ToLower())) {
+        continue;
+      }
+      if (bOnlyLeftBehind &&
+          !Algo::AnyOf(LeftBehind, [&Region](const FMcpRegionRequest &Request) {
+            return Request.Name.Equals(Region.Name, ESearchCase::IgnoreCase);
+          })) {
+        continue;
+      }
+      if (Oldest == INDEX_NONE ||
+          Region.LastUseSeconds < GLoadedRegions[Oldest].LastUseSeconds) {
+        Oldest = Index;
+      }
+    }
+    if (Oldest == INDEX_NONE) {
+      return false;
+    }
+    Pipeline->Result.Evicted.Add(GLoadedRegions[Oldest].Name);
+    UnloadRegion(GLoadedRegions[Oldest]);
+    GLoadedRegions.RemoveAt(Oldest);
+    return true;
+  };
+
+  if (Policy.KeepBehind > 0) {
+    while (EvictOne(true)) {
+    }
+  }
+  if (Policy.MaxLoadedRegions > 0) {
+    while (GLoadedRegions.Num() > Policy.MaxLoadedRegions && EvictOne(false)) {
+    }
+  }
+  if (Policy.MaxUsedMemoryMB > 0.0) {
+    // Unloaded actors are only freed by a collection, so each eviction is
+    // followed by one before memory is measured again.
+    while (GetUsedMemoryMB() > Policy.MaxUsedMemoryMB && EvictOne(false)) {
+      CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+    }
+  }
+}
+
+void FinishRegionPipeline(const FRegionPipelineRef &Pipeline) {
+  Pipeline->Result.TotalMs =
+      (FPlatformTime::Seconds() - Pipeline->StartSeconds) * 1000.0;
+  Pipeline->Result.UsedMemoryMB = GetUsedMemoryMB();
+  Pipeline->OnFinished(Pipeline->Result);
+}
+
+// Returns false once the pipeline is over, which removes the ticker.
+bool TickRegionPipeline(const FRegionPipelineRef &Pipeline) {
+  UWorld *World = Pipeline->World.Get();
+  if (!World || Pipeline->Next >= Pipeline->Requests.Num()) {
+    FinishRegionPipeline(Pipeline);
+    return false;
+  }
+  if (Pipeline->TimeoutSeconds > 0.0 &&
+      FPlatformTime::Seconds() - Pipeline->StartSeconds >=
+          Pipeline->TimeoutSeconds) {
+    Pipeline->Result.bTimedOut = true;
+    FinishRegionPipeline(Pipeline);
+    return false;
+  }
+
+  ForgetStaleRegions(World);
+  const FMcpRegionLoadResult &Loaded = Pipeline->Result.Regions.Add_GetRef(
+      LoadRegionNow(World, Pipeline->Requests[Pipeline->Next++]));
+  ApplyUnloadPolicy(Pipeline);
+
+  if (Pipeline->OnProgress &&
+      !Pipeline->OnProgress(Pipeline->Next, Pipeline->Requests.Num(), Loaded)) {
+    Pipeline->Result.bCancelled = true;
+    FinishRegionPipeline(Pipeline);
+    return false;
+  }
+  if (Pipeline->Next >= Pipeline->Requests.Num()) {
+    FinishRegionPipeline(Pipeline);
+    return false;
+  }
+  return true;
+}
+} // namespace
+
+TSharedPtr<FJsonObject> FMcpRegionLoadResult::ToJson() const {
+  TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+  Json->SetStringField(TEXT("name"), Name);
+  Json->SetArrayField(TEXT("min"), RegionVectorToJson(Bounds.Min));
+  Json->SetArrayField(TEXT("max"), RegionVectorToJson(Bounds.Max));
+  Json->SetBoolField(TEXT("loaded"), bLoaded);
+  Json->SetBoolField(TEXT("alreadyLoaded"), bAlreadyLoaded);
+  Json->SetNumberField(TEXT("residentActors"), ResidentActors);
+  Json->SetNumberField(TEXT("loadMs"), LoadMs);
+  if (!Error.IsEmpty()) {
+    Json->SetStringField(TEXT("error"), Error);
+  }
+  return Json;
+}
+
+bool FMcpWorldPartitionRegionLoader::IsSupported() {
+  return MCP_REGION_LOADER_HAS_ADAPTER || MCP_REGION_LOADER_HAS_SUBSYSTEM;
+}
+
+void FMcpWorldPartitionRegionLoader::LoadRegions(
+    UWorld *World, TArray<FMcpRegionRequest> Requests,
+    const FMcpRegionUnloadPolicy &Policy, double TimeoutSeconds,
+    TFunction<bool(int32 Done, int32 Total, const FMcpRegionLoadResult &)>
+        OnProgress,
+    TFunction<void(const FMcpRegionPipelineResult &)> OnFinished) {
+  check(IsInGameThread());
+  for (FMcpRegionRequest &Request : Requests) {
+    if (Request.Name.IsEmpty()) {
+      Request.Name = FString::Printf(TEXT("Region %d"), ++GRegionNameCounter);
+    }
+  }
+  FRegionPipelineRef Pipeline = MakeShared<FRegionPipeline>();
+  Pipeline->World = World;
+  Pipeline->Requests = MoveTemp(Requests);
+  Pipeline->Policy = Policy;
+  Pipeline->StartSeconds = FPlatformTime::Seconds();
+  Pipeline->TimeoutSeconds = FMath::Max(0.0, TimeoutSeconds);
+  Pipeline->OnProgress = MoveTemp(OnProgress);
+  Pipeline->OnFinished = MoveTemp(OnFinished);
+  Pipeline->Result.Regions.Reserve(Pipeline->Requests.Num());
+
+  // The first region loads right away; the rest one per tick.
+  if (TickRegionPipeline(Pipeline)) {
+    FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+        [Pipeline](float) { return TickRegionPipeline(Pipeline); }));
+  }
+}
+
+TArray<FString>
+FMcpWorldPartitionRegionLoader::UnloadRegions(UWorld *World,
+                                              const TArray<FString> &Names) {
+  check(IsInGameThread());
+  ForgetStaleRegions(World);
+  TArray<FString> Unloaded;
+  for (int32 Index = GLoadedRegions.Num() - 1; Index >= 0; --Index) {
+    FLoadedRegion &Region = GLoadedRegions[Index];
+    const bool bNamed =
+        Names.Num() == 0 ||
+        Names.ContainsByPredicate([&Region](const FString &Name) {
+          return Name.Equals(Region.Name, ESearchCase::IgnoreCase);
+        });
+    if (!bNamed || !Region.bUnloadable) {
+      continue;
+    }
+    Unloaded.Add(Region.Name);
+    UnloadRegion(Region);
+    GLoadedRegions.RemoveAt(Index);
+  }
+  return Unloaded;
+}
+
+TArray<TSharedPtr<FJsonValue>>
+FMcpWorldPartitionRegionLoader::DescribeRegions(UWorld *World) {
+  check(IsInGameThread());
+  ForgetStaleRegions(World);
+  const double NowSeconds = FPlatformTime::Seconds();
+  TArray<TSharedPtr<FJsonValue>> Regions;
+  Regions.Reserve(GLoadedRegions.Num());
+  for (const FLoadedRegion &Region : GLoadedRegions) {
+    TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+    Json->SetStringField(TEXT("name"), Region.Name);
+    Json->SetArrayField(TEXT("min"), RegionVectorToJson(Region.Bounds.Min));
+    Json->SetArrayField(TEXT("max"), RegionVectorToJson(Region.Bounds.Max));
+    Json->SetBoolField(TEXT("unloadable"), Region.bUnloadable);
+    Json->SetNumberField(TEXT("residentActors"), Region.ResidentActors);
+    Json->SetNumberField(TEXT("idleSeconds"), NowSeconds - Region.LastUseSeconds);
+    Regions.Add(MakeShared<FJsonValueObject>(Json));
+  }
+  return Regions;
+}
+
+TSharedPtr<FJsonObject>
+FMcpWorldPartitionRegionLoader::ToJson(const FMcpRegionPipelineResult &Result) {
+  TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+  TArray<TSharedPtr<FJsonValue>> Regions;
+  Regions.Reserve(Result.Regions.Num());
+  for (const FMcpRegionLoadResult &Region : Result.Regions) {
+    Regions.Add(MakeShared<FJsonValueObject>(Region.ToJson()));
+  }
+  Json->SetArrayField(TEXT("regions"), Regions);
+  TArray<TSharedPtr<FJsonValue>> Evicted;
+  for (const FString &Name : Result.Evicted) {
+    Evicted.Add(MakeShared<FJsonValueString>(Name));
+  }
+  Json->SetArrayField(TEXT("evicted"), Evicted);
+  Json->SetBoolField(TEXT("cancelled"), Result.bCancelled);
+  Json->SetBoolField(TEXT("timedOut"), Result.bTimedOut);
+  Json->SetNumberField(TEXT("totalMs"), Result.TotalMs);
+  Json->SetNumberField(TEXT("usedMemoryMB"), Result.UsedMemoryMB);
+  return Json;
+}
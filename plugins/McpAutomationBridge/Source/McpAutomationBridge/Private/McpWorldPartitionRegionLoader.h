@@ -0,0 +1,92 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "Templates/Function.h"
+
+class UWorld;
+
+/** One editor region to load, in the order a pipeline visits them. */
+struct FMcpRegionRequest
+{
+    /** Key the region is remembered under; a request with the same name and bounds is already loaded. */
+    FString Name;
+    FBox Bounds = FBox(ForceInit);
+};
+
+/** What loading one region did. */
+struct FMcpRegionLoadResult
+{
+    FString Name;
+    FBox Bounds = FBox(ForceInit);
+    bool bLoaded = false;
+    bool bAlreadyLoaded = false;
+
+    /** Actors of the world whose location lies inside Bounds once the region is resident. */
+    int32 ResidentActors = 0;
+    double LoadMs = 0.0;
+    FString Error;
+
+    TSharedPtr<FJsonObject> ToJson() const;
+};
+
+/**
+ * Bounds on what the bridge keeps loaded while a caller sweeps across a large map. Regions are
+ * evicted least recently used first; the region being loaded and the trailing window are never
+ * evicted by the same pipeline. Zero disables a limit.
+ */
+struct FMcpRegionUnloadPolicy
+{
+    /** Regions of this pipeline kept behind the current one; older ones are unloaded as it moves, like a streaming source. */
+    int32 KeepBehind = 0;
+
+    /** Regions the bridge keeps loaded across all requests. */
+    int32 MaxLoadedRegions = 0;
+
+    /** Used physical memory above which regions are unloaded (with a garbage collection) until it drops below. */
+    double MaxUsedMemoryMB = 0.0;
+};
+
+/** Outcome of a whole pipeline, handed to the completion callback. */
+struct FMcpRegionPipelineResult
+{
+    TArray<FMcpRegionLoadResult> Regions;
+    TArray<FString> Evicted;
+    bool bCancelled = false;
+    bool bTimedOut = false;
+    double TotalMs = 0.0;
+    double UsedMemoryMB = 0.0;
+};
+
+/**
+ * Editor World Partition regions loaded on behalf of clients. A pipeline loads one region per
+ * core-ticker tick, so the editor keeps running and the client receives progress between regions,
+ * then reports the whole sweep once to a completion callback. Each region is loaded through a
+ * user-created loader adapter (UE 5.1+, unloadable) or, where only the older editor subsystem
+ * exists, through UWorldPartitionEditorSubsystem::LoadRegion (not unloadable). Regions are
+ * forgotten when the editor world changes. Game thread only.
+ */
+class FMcpWorldPartitionRegionLoader
+{
+public:
+    /** Whether this engine build can load editor regions at all. */
+    static bool IsSupported();
+
+    /**
+     * Loads Requests in order in World. OnProgress runs after each region with the number done so
+     * far and stops the pipeline, marked cancelled, by returning false; OnFinished runs exactly
+     * once, also when the world goes away or TimeoutSeconds (0 = none) pass first.
+     */
+    static void LoadRegions(UWorld* World, TArray<FMcpRegionRequest> Requests, const FMcpRegionUnloadPolicy& Policy,
+        double TimeoutSeconds, TFunction<bool(int32 Done, int32 Total, const FMcpRegionLoadResult&)> OnProgress,
+        TFunction<void(const FMcpRegionPipelineResult&)> OnFinished);
+
+    /** Unloads the named regions of World (all of them when Names is empty); returns the names unloaded. */
+    static TArray<FString> UnloadRegions(UWorld* World, const TArray<FString>& Names);
+
+    /** name, min, max, unloadable, residentActors and idleSeconds of every region loaded in World. */
+    static TArray<TSharedPtr<FJsonValue>> DescribeRegions(UWorld* World);
+
+    /** regions, evicted, cancelled, timedOut, totalMs and usedMemoryMB of Result. */
+    static TSharedPtr<FJsonObject> ToJson(const FMcpRegionPipelineResult& Result);
+};
@@ -86,6 +86,18 @@ public:
     UPROPERTY(config, EditAnywhere, Category = "Security", meta = (ClampMin = "0"))
     int32 MaxAutomationRequestsPerMinute;
 
+    /** Separate per-minute limit for cheap reads (actions listed in InteractiveLaneActions). 0 = they count against MaxAutomationRequestsPerMinute. */
+    UPROPERTY(config, EditAnywhere, Category = "Security", meta = (ClampMin = "0"))
+    int32 MaxReadRequestsPerMinute;
+
+    /** Separate per-minute limit for heavy builds (actions listed in BackgroundLaneActions). 0 = they count against MaxAutomationRequestsPerMinute. */
+    UPROPERTY(config, EditAnywhere, Category = "Security", meta = (ClampMin = "0"))
+    int32 MaxHeavyRequestsPerMinute;
+
+    /** Seconds of quota a client may spend in one burst; rate limits refill continuously rather than per minute window. */
+    UPROPERTY(config, EditAnywhere, Category = "Security", meta = (ClampMin = "0.0"))
+    float RateLimitBurstSeconds;
+
     /** Optional runtime log verbosity override exposed via Project Settings. */
 
     UPROPERTY(config, EditAnywhere, Category = "Debug")
@@ -117,6 +129,19 @@ public:
     UPROPERTY(config, EditAnywhere, Category = "Heartbeat", meta = (ClampMin = "0.0"))
     float HeartbeatTimeoutSeconds;
 
+    // Replay of completed requests after reconnects
+    /** Completed responses kept per requestId so a retried request is answered from cache instead of running again. 0 disables the replay cache. */
+    UPROPERTY(config, EditAnywhere, Category = "Replay", meta = (ClampMin = "0"))
+    int32 ReplayCacheMaxEntries;
+
+    /** Seconds a completed response stays replayable. */
+    UPROPERTY(config, EditAnywhere, Category = "Replay", meta = (ClampMin = "1.0"))
+    float ReplayCacheTtlSeconds;
+
+    /** Upper bound, in bytes, on serialized responses held by the replay cache. Larger responses are not cached. */
+    UPROPERTY(config, EditAnywhere, Category = "Replay", meta = (ClampMin = "0"))
+    int32 ReplayCacheMaxBytes;
+
     // Server socket tuning
     /** Backlog parameter passed to listen() when creating the listening socket. If <= 0, engine default will be used. */
     UPROPERTY(config, EditAnywhere, Category = "Connection")
@@ -126,6 +151,84 @@ public:
     UPROPERTY(config, EditAnywhere, Category = "Connection", meta = (ClampMin = "0.0"))
     float AcceptSleepSeconds;
 
+    /** When true, listen sockets and the clients they accept are serviced by a small shared pool of I/O threads instead of dedicated reader/writer threads per connection. Takes effect the next time the listeners start. */
+    UPROPERTY(config, EditAnywhere, Category = "Connection")
+    bool bUseSharedIoReactor;
+
+    /** Number of I/O threads in the shared reactor. */
+    UPROPERTY(config, EditAnywhere, Category = "Connection", meta = (ClampMin = "1", ClampMax = "16", EditCondition = "bUseSharedIoReactor"))
+    int32 IoReactorThreadCount;
+
+    // WebSocket compression
+    /** Negotiate the permessage-deflate extension (RFC 7692) when the peer offers or accepts it. Large JSON responses typically shrink 5-10x on the wire. */
+    UPROPERTY(config, EditAnywhere, Category = "Compression")
+    bool bEnablePerMessageDeflate;
+
+    /** Keep the deflate dictionary between messages (context takeover). Better ratios for repetitive JSON at the cost of ~300KB of zlib state per connection. */
+    UPROPERTY(config, EditAnywhere, Category = "Compression", meta = (EditCondition = "bEnablePerMessageDeflate"))
+    bool bPerMessageDeflateContextTakeover;
+
+    /** Text messages smaller than this many bytes are sent uncompressed. */
+    UPROPERTY(config, EditAnywhere, Category = "Compression", meta = (ClampMin = "0", EditCondition = "bEnablePerMessageDeflate"))
+    int32 PerMessageDeflateThresholdBytes;
+
+    /** Let peers that offer "msgpack" in bridge_hello exchange automation requests and responses as MessagePack binary frames. Vectors, rotators and transforms travel as packed doubles. JSON stays the default for everyone else. */
+    UPROPERTY(config, EditAnywhere, Category = "Compression")
+    bool bAllowMessagePackEncoding;
+
+    // Outbound queue backpressure
+    /** Once a connection has this many bytes waiting to be written, discardable traffic (log streaming, progress updates) is paused. */
+    UPROPERTY(config, EditAnywhere, Category = "Backpressure", meta = (ClampMin = "1"))
+    int32 OutboundQueueHighWatermarkBytes;
+
+    /** Discardable traffic resumes once the connection's queue drains to this many bytes. */
+    UPROPERTY(config, EditAnywhere, Category = "Backpressure", meta = (ClampMin = "0"))
+    int32 OutboundQueueLowWatermarkBytes;
+
+    // Deferred request scheduling
+    /** Game-thread time, in milliseconds per frame, spent draining requests that were queued behind a running request or an unsafe engine state (GC, saving, async loading). Leftovers resume next frame. 0 drains everything at once. */
+    UPROPERTY(config, EditAnywhere, Category = "Scheduling", meta = (ClampMin = "0.0"))
+    float PendingRequestFrameBudgetMs;
+
+    /** Actions (or subActions) queued on the interactive lane, which is always drained before bulk and background work. */
+    UPROPERTY(config, EditAnywhere, Category = "Scheduling")
+    TArray<FString> InteractiveLaneActions;
+
+    /** Long-running actions (or subActions) queued on the background lane, drained only when the interactive and bulk lanes are empty. Everything unlisted is bulk. */
+    UPROPERTY(config, EditAnywhere, Category = "Scheduling")
+    TArray<FString> BackgroundLaneActions;
+
+    /** Run read-only actions whose handlers are registered as thread-safe (asset registry queries, static listings) on a task-graph worker instead of the game thread. */
+    UPROPERTY(config, EditAnywhere, Category = "Scheduling")
+    bool bRunThreadSafeActionsOffGameThread;
+
+    // Asset saving
+    /** Write the packages saved at the end of a dispatch with async file writes instead of through the editor save path. Faster for large batches, but skips the source control checkout prompt. */
+    UPROPERTY(config, EditAnywhere, Category = "Saving")
+    bool bAsyncAssetSaves;
+
+    // Metrics scrape endpoint
+    /** Answer plain HTTP GET requests for MetricsEndpointPath on the listen ports with OpenMetrics (Prometheus) text: request rates and latency histograms, queue depths, rate-limit rejections, sockets, bytes in/out and bridge game-thread time. When a capability token is required, scrapers must send it as a Bearer token. */
+    UPROPERTY(config, EditAnywhere, Category = "Metrics")
+    bool bEnableMetricsEndpoint;
+
+    /** HTTP path served by the metrics endpoint. */
+    UPROPERTY(config, EditAnywhere, Category = "Metrics", meta = (EditCondition = "bEnableMetricsEndpoint"))
+    FString MetricsEndpointPath;
+
+    // Log capture
+    /** Recent log lines kept in memory for get_recent_logs and manage_logs streaming, about 1 KB each. Rounded up to a power of two. */
+    UPROPERTY(config, EditAnywhere, Category = "Logging", meta = (ClampMin = "64"))
+    int32 LogRingBufferCapacity;
+
+    /** Seconds between streamed log batches while a client is subscribed through manage_logs. 0 flushes every frame. */
+    UPROPERTY(config, EditAnywhere, Category = "Logging", meta = (ClampMin = "0.0"))
+    float LogStreamFlushIntervalSeconds;
+
+    /** Most log lines sent in one streamed batch; the rest follow on the next flush. */
+    UPROPERTY(config, EditAnywhere, Category = "Logging", meta = (ClampMin = "1"))
+    int32 LogStreamMaxBatchEntries;
+
     /** Frequency, in seconds, for the subsystem ticker. If <= 0, engine default will be used. */
     UPROPERTY(config, EditAnywhere, Category = "Debug", meta = (ClampMin = "0.0"))
     float TickerIntervalSeconds;
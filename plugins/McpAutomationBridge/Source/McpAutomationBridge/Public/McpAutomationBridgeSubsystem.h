@@ -5,6 +5,7 @@
 #include "Dom/JsonObject.h"
 #include "EditorSubsystem.h"
 #include "HAL/CriticalSection.h"
+#include "Templates/Atomic.h"
 #include "Templates/SharedPointer.h"
 #include "Engine/DataAsset.h"
 #include "McpAutomationBridgeSubsystem.generated.h"
@@ -24,6 +25,16 @@
 
 // Forward declare USkeleton to avoid including heavy animation headers
 class USkeleton;
+class FMcpLogRingBuffer;
+class FMcpLogFilter;
+class FMcpPropertyAccessCache;
+class FMcpActorIndex;
+class FMcpAssetSearchCursors;
+class FMcpNavDirtyTracker;
+struct FMcpViewportCaptureResult;
+class FMcpRuntimeTelemetry;
+class FMcpRuntimeTelemetryReader;
+class FMcpActorChangeFeed;
 
 /**
  * Concrete data asset class for MCP inventory/item operations.
@@ -74,6 +85,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FMcpAutomationMessageReceived,
                                             Message);
 
 class FMcpBridgeWebSocket;
+class FMcpJsonUtf8Writer;
 DECLARE_LOG_CATEGORY_EXTERN(LogMcpAutomationBridgeSubsystem, Log, All);
 
 UCLASS()
@@ -94,6 +106,15 @@ public:
   UFUNCTION(BlueprintCallable, Category = "MCP Automation")
   bool SendRawMessage(const FString &Message);
 
+  /** Like SendRawMessage, but dropped while the connection is under outbound backpressure. */
+  bool SendDiscardableMessage(const FString &Message);
+
+  /**
+   * Fans pre-encoded UTF-8 text out to every socket subscribed to Topic (see
+   * subscribe_events), skipping sockets under backpressure. True if any took it.
+   */
+  bool PublishEvent(const FString &Topic, TArray<uint8> &&Utf8Payload);
+
   UPROPERTY(BlueprintAssignable, Category = "MCP Automation")
   FMcpAutomationMessageReceived OnMessageReceived;
 
@@ -107,6 +128,16 @@ public:
                               const FString &Message,
                               const TSharedPtr<FJsonObject> &Result = nullptr,
                               const FString &ErrorCode = FString());
+  /**
+   * Streamed variant for large results: Result holds a complete JSON object
+   * written by the handler and is spliced into the response without building
+   * a DOM. The writer is moved from; it may be handed over on any thread.
+   */
+  void SendAutomationResponse(TSharedPtr<FMcpBridgeWebSocket> TargetSocket,
+                              const FString &RequestId, bool bSuccess,
+                              const FString &Message,
+                              FMcpJsonUtf8Writer &&Result,
+                              const FString &ErrorCode = FString());
   void SendAutomationError(TSharedPtr<FMcpBridgeWebSocket> TargetSocket,
                            const FString &RequestId, const FString &Message,
                            const FString &ErrorCode);
@@ -119,10 +150,60 @@ public:
    * @param Percent Optional progress percent (0-100), negative to omit
    * @param Message Optional status message
    * @param bStillWorking True if operation is still in progress (prevents stale detection)
+   * @return false once the client has cancelled the request; loops should stop and reply CANCELLED
    */
-  void SendProgressUpdate(const FString &RequestId, float Percent = -1.0f, 
+  bool SendProgressUpdate(const FString &RequestId, float Percent = -1.0f, 
                           const FString &Message = TEXT(""), bool bStillWorking = true);
 
+  /**
+   * Thread-safe. True once the client sent cancel_request for a request that
+   * is still running. Long-running handlers should poll this between steps
+   * and answer with the CANCELLED error code.
+   */
+  bool IsAutomationRequestCancelled(const FString &RequestId) const;
+
+  /**
+   * Run Work on a task-graph worker for a request that answers later, such
+   * as a heavy mesh operation on a detached copy. Deinitialize waits for it
+   * as it does for the thread-safe lane; Work must post anything that needs
+   * the subsystem afterwards back through a weak pointer.
+   */
+  void LaunchBackgroundWork(TUniqueFunction<void()> &&Work);
+
+  /**
+   * Attach raw bytes to the response for RequestId. The buffer is moved, not
+   * copied or base64-encoded; it travels as binary frames after the JSON
+   * automation_response when the client supports it. Call before
+   * SendAutomationResponse.
+   *
+   * @param RequestId The request the attachment belongs to
+   * @param Data Payload bytes (moved from)
+   * @param MimeType Optional content type reported in the attachment descriptor
+   * @param ResultField Result field populated with base64 for clients without binary support
+   * @return The attachment ID referenced by the response descriptor
+   */
+  FString AttachBinaryPayload(const FString &RequestId, TArray<uint8> &&Data,
+                              const FString &MimeType = FString(),
+                              const FString &ResultField = FString());
+
+  /**
+   * Game-thread seconds left in this frame's budget for deferred work: the
+   * PendingRequestFrameBudgetMs setting, shared by the pending-request drain
+   * and by handlers that slice their work across ticks (console_batch).
+   * Work charges what it used with ChargeFrameBudget. Returns
+   * TNumericLimits<double>::Max() when the budget is disabled.
+   */
+  double GetFrameBudgetRemainingSeconds();
+  void ChargeFrameBudget(double Seconds);
+
+  /**
+   * Bounds of editor actors edited since the last "recent" navigation
+   * rebuild; null outside the editor or before Initialize.
+   */
+  FMcpNavDirtyTracker *GetNavDirtyTracker() const {
+    return NavDirtyTracker.Get();
+  }
+
   bool ExecuteEditorCommands(const TArray<FString> &Commands,
                              FString &OutErrorMessage);
 #if MCP_HAS_CONTROLRIG_FACTORY
@@ -159,31 +240,248 @@ private:
   bool bCurrentBlueprintBusyMarked = false;
   bool bCurrentBlueprintBusyScheduled = false;
 
-  // Pending automation request queue (thread-safe). Inbound socket threads
-  // will enqueue requests here; the queue is drained sequentially on the
-  // game thread to ensure deterministic processing order and avoid
-  // reentrancy issues.
+  // Pending automation request queue (thread-safe). Requests deferred by the
+  // reentrancy guard or by unsafe engine states are enqueued here and drained
+  // on the game thread within a per-frame time budget. Each lane is FIFO;
+  // higher-priority lanes are always drained first, so an interactive query
+  // overtakes queued bulk or background work.
+  enum class EPendingRequestLane : uint8 {
+    Interactive,
+    Bulk,
+    Background,
+    Count
+  };
   struct FPendingAutomationRequest {
     FString RequestId;
     FString Action;
     TSharedPtr<FJsonObject> Payload;
     TSharedPtr<FMcpBridgeWebSocket> RequestingSocket;
+    double EnqueuedSeconds = 0.0;
   };
-  TArray<FPendingAutomationRequest> PendingAutomationRequests;
+  struct FPendingRequestLane {
+    TArray<FPendingAutomationRequest> Items;
+    /** Index of the oldest undrained item; the array is compacted lazily. */
+    int32 Head = 0;
+    int32 Num() const { return Items.Num() - Head; }
+  };
+  FPendingRequestLane
+      PendingRequestLanes[static_cast<int32>(EPendingRequestLane::Count)];
   FCriticalSection PendingAutomationRequestsMutex;
   bool bPendingRequestsScheduled = false;
+  bool bDrainingPendingRequests = false;
+  /** Frame the budget below was last charged to, and how much it has used. */
+  uint64 PendingRequestBudgetFrame = 0;
+  double PendingRequestBudgetUsedSeconds = 0.0;
+  /** From settings; <= 0 drains the whole queue in one go. */
+  double PendingRequestFrameBudgetSeconds = 0.0;
+  TSet<FString> InteractiveLaneActions;
+  TSet<FString> BackgroundLaneActions;
+
+  // Requests deferred by an unsafe engine state are resumed from the engine's
+  // own "GC finished" / "package saved" / "package loaded" notifications
+  // instead of waiting for the ticker to notice the flag has cleared.
+  FDelegateHandle PostGarbageCollectHandle;
+  FDelegateHandle PackageSavedHandle;
+  FDelegateHandle EndLoadPackageHandle;
+  /** Start of the current deferral episode; 0 while nothing is waiting. */
+  double EngineStateDeferralStartSeconds = 0.0;
+  const TCHAR *EngineStateDeferralReason = nullptr;
+  int32 EngineStateDeferredRequests = 0;
+  bool bEngineStateResumeQueued = false;
+  static const TCHAR *GetUnsafeEngineStateReason();
+  void RegisterEngineStateHooks();
+  void UnregisterEngineStateHooks();
+  void NoteEngineStateDeferral(const TCHAR *Reason, int32 NewRequests);
+  void ScheduleEngineStateResume(const TCHAR *Trigger);
+  void ResumeAfterEngineState(const TCHAR *Trigger);
+  void EnqueuePendingAutomationRequest(
+      const FString &RequestId, const FString &Action,
+      const TSharedPtr<FJsonObject> &Payload,
+      TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
+  EPendingRequestLane
+  ClassifyPendingRequestLane(const FString &Action,
+                             const TSharedPtr<FJsonObject> &Payload) const;
+  int32 GetPendingAutomationRequestCount();
+  /** Removes RequestId from the scheduler lanes and answers it with CANCELLED. */
+  bool CancelQueuedAutomationRequest(const FString &RequestId);
   void ProcessPendingAutomationRequests();
 
   void RecordAutomationTelemetry(const FString &RequestId, bool bSuccess,
                                  const FString &Message,
                                  const FString &ErrorCode);
 
-  // Active Log Device
+  // Log capture: every line lands in the ring buffer from whichever thread
+  // logged it; manage_logs subscribe streams it out in batches from Tick.
   TSharedPtr<FOutputDevice> LogCaptureDevice;
+  TSharedPtr<FMcpLogRingBuffer, ESPMode::ThreadSafe> LogRingBuffer;
+  /** One per subscribed connection, each with its own filter and position. */
+  struct FLogStreamSubscription {
+    TWeakPtr<FMcpBridgeWebSocket> Socket;
+    /** False for requests that arrived without a socket; those publish on the "logs" topic. */
+    bool bBoundToSocket = false;
+    /** Sequence number of the next line to stream. */
+    uint64 Cursor = 0;
+    TSharedPtr<const FMcpLogFilter> Filter;
+  };
+  TArray<FLogStreamSubscription> LogStreamSubscriptions;
+  double LogStreamFlushIntervalSeconds = 0.25;
+  double LastLogStreamFlushSeconds = 0.0;
+  int32 LogStreamMaxBatchEntries = 512;
+  void StartLogCapture();
+  void StopLogCapture();
+  void FlushLogStream();
+  /** Sends the subscriber's next batch; false once its connection is gone. */
+  bool FlushLogSubscription(FLogStreamSubscription &Subscription);
+
+  // Viewport streams: control_editor subscribe_viewport_stream pushes encoded
+  // frames of the viewport to the subscribed connection, captured from Tick
+  // through the asynchronous readback path.
+  struct FViewportStreamSubscription {
+    TWeakPtr<FMcpBridgeWebSocket> Socket;
+    /** False for requests that arrived without a socket; those publish on the "viewport" topic. */
+    bool bBoundToSocket = false;
+    /** Identifies the subscription to its in-flight captures; new on every subscribe. */
+    int32 Id = 0;
+    int32 Width = 640;
+    int32 Height = 360;
+    bool bPng = false;
+    int32 Quality = 70;
+    double IntervalSeconds = 0.2;
+    bool bOnlyOnChange = true;
+    /** Captures allowed in flight at once; frames due beyond that are dropped. */
+    int32 MaxInFlight = 2;
+    double NextCaptureSeconds = 0.0;
+    int32 InFlight = 0;
+    uint32 LastHash = 0;
+    bool bHasLastHash = false;
+    int64 FramesSent = 0;
+    int64 FramesDropped = 0;
+    int64 FramesUnchanged = 0;
+  };
+  TArray<FViewportStreamSubscription> ViewportStreamSubscriptions;
+  int32 NextViewportStreamId = 1;
+  void TickViewportStreams();
+  /** Sends one captured frame to its subscription, if it still exists. */
+  void DeliverViewportStreamFrame(int32 SubscriptionId,
+                                  FMcpViewportCaptureResult &&Frame);
+
+  // Runtime telemetry: subscribe_runtime_telemetry samples every frame into a
+  // shared ring and pushes one aggregated runtime_telemetry event per
+  // subscriber interval, so agents stop polling get_runtime_state.
+  struct FRuntimeTelemetrySubscription {
+    TWeakPtr<FMcpBridgeWebSocket> Socket;
+    /** False for requests that arrived without a socket; those publish on the "telemetry" topic. */
+    bool bBoundToSocket = false;
+    int32 Id = 0;
+    double IntervalSeconds = 1.0;
+    double StartSeconds = 0.0;
+    double NextPushSeconds = 0.0;
+    TSharedPtr<FMcpRuntimeTelemetryReader> Reader;
+    int64 PushesSent = 0;
+    int64 PushesDropped = 0;
+  };
+  TArray<FRuntimeTelemetrySubscription> RuntimeTelemetrySubscriptions;
+  int32 NextRuntimeTelemetryId = 1;
+  /** Created with the first subscription, released with the last one. */
+  TSharedPtr<FMcpRuntimeTelemetry> RuntimeTelemetry;
+  void TickRuntimeTelemetry();
+
+  // Alive while any socket subscribes to the "actors" event topic.
+  TSharedPtr<FMcpActorChangeFeed> ActorChangeFeed;
+  void TickActorChangeFeed();
+
+  // Compiled (class, path) lookups for get/set_object_property; created on
+  // first use, game thread only.
+  TSharedPtr<FMcpPropertyAccessCache> PropertyAccessCache;
+  FMcpPropertyAccessCache &GetPropertyAccessCache();
+  UObject *ResolvePropertyRootObject(FString &ObjectPath);
 
   // Action handlers (implemented in separate translation units)
-  TMap<FString, FAutomationHandler> AutomationHandlers;
+  using FAutomationHandlerMethod = bool (UMcpAutomationBridgeSubsystem::*)(
+      const FString &, const FString &, const TSharedPtr<FJsonObject> &,
+      TSharedPtr<FMcpBridgeWebSocket>);
+  struct FAutomationHandlerEntry {
+    const TCHAR *Action;
+    FAutomationHandlerMethod Method;
+  };
+  /** Runtime registrations; consulted before the built-in table. */
+  TMap<FName, FAutomationHandler> AutomationHandlers;
+  /** Built-in action -> member handler, filled on the first dispatch. */
+  TMap<FName, FAutomationHandlerMethod> BuiltinAutomationHandlers;
+  bool bAutomationDispatchReady = false;
+  void EnsureAutomationDispatch();
   void InitializeHandlers();
+  bool HandleCheckPieState(const FString &RequestId, const FString &Action,
+                           const TSharedPtr<FJsonObject> &Payload,
+                           TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
+  bool HandleQuitEditorAction(const FString &RequestId, const FString &Action,
+                              const TSharedPtr<FJsonObject> &Payload,
+                              TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
+
+  /**
+   * Wall time of each startup phase in milliseconds, in the order they ran.
+   * The dispatch tables are built on the first request, so their phase is
+   * appended then. Logged once and reported by get_bridge_metrics.
+   */
+  TArray<TPair<const TCHAR *, double>> StartupPhaseMs;
+  double StartupTotalMs = 0.0;
+  double RecordStartupPhase(const TCHAR *Phase, double PhaseStartSeconds);
+  TSharedPtr<FJsonObject> GetStartupTimingJson() const;
+
+  /**
+   * Fallback handler for actions that are not (or not only) served by the
+   * registry. Each route declares the action names it owns and, for
+   * families of generated names, lower-case prefixes and substrings.
+   * Routes are tried in registration order.
+   */
+  struct FAutomationRoute {
+    const TCHAR *Label = nullptr;
+    FAutomationHandler Handler;
+    TArray<FName> Actions;
+    TArray<FString> Prefixes;
+    TArray<FString> Substrings;
+
+    bool MatchesPattern(const FString &NormalizedAction) const;
+  };
+  using FAutomationRouteList = TArray<int32, TInlineAllocator<4>>;
+
+  TArray<FAutomationRoute> AutomationRoutes;
+  /** Action name -> candidate routes in priority order. */
+  TMap<FName, FAutomationRouteList> AutomationRouteCandidates;
+
+  void RegisterAutomationRoute(const TCHAR *Label, FAutomationHandler Handler,
+                               std::initializer_list<const TCHAR *> Actions,
+                               std::initializer_list<const TCHAR *> Prefixes = {},
+                               std::initializer_list<const TCHAR *> Substrings = {});
+  void InitializeAutomationRoutes();
+  void BuildAutomationRouteTable();
+  void FindPatternRoutes(const FString &NormalizedAction,
+                         FAutomationRouteList &OutRoutes) const;
+
+  /**
+   * Read-only handler that may run on a task-graph worker. When
+   * SubActionField is set, only payloads whose field names one of SubActions
+   * take this lane; everything else dispatches on the game thread as usual.
+   */
+  struct FThreadSafeHandler {
+    FAutomationHandler Handler;
+    FString SubActionField;
+    TSet<FString> SubActions;
+  };
+  /** Populated during Initialize and read-only afterwards. */
+  TMap<FName, FThreadSafeHandler> ThreadSafeHandlers;
+  bool bRunThreadSafeActionsOffGameThread = true;
+  /** Worker dispatches still running; Deinitialize waits for them. */
+  TAtomic<int32> ThreadSafeRequestsInFlight{0};
+
+  void RegisterThreadSafeHandler(
+      const FString &Action, FAutomationHandler Handler,
+      const FString &SubActionField = FString(),
+      std::initializer_list<const TCHAR *> SubActions = {});
+  void InitializeThreadSafeHandlers();
+  bool TryDispatchThreadSafe(const FString &RequestId, const FString &Action,
+                             const TSharedPtr<FJsonObject> &Payload,
+                             TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
 
   /**
    * Handle lightweight, well-known editor function invocations sent from the
@@ -205,6 +503,16 @@ private:
   HandleGetObjectProperty(const FString &RequestId, const FString &Action,
                           const TSharedPtr<FJsonObject> &Payload,
                           TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
+  /** Columnar read of many properties across many objects. */
+  bool
+  HandleGetPropertiesBulk(const FString &RequestId, const FString &Action,
+                          const TSharedPtr<FJsonObject> &Payload,
+                          TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
+  /** Many property writes under one transaction, one PostEditChange each. */
+  bool
+  HandleSetPropertiesBulk(const FString &RequestId, const FString &Action,
+                          const TSharedPtr<FJsonObject> &Payload,
+                          TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
   // Array manipulation operations
   bool HandleArrayAppend(const FString &RequestId, const FString &Action,
                          const TSharedPtr<FJsonObject> &Payload,
@@ -361,6 +669,14 @@ private:
   bool HandleLightingAction(const FString &RequestId, const FString &Action,
                             const TSharedPtr<FJsonObject> &Payload,
                             TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
+  // Starts a tracked static lighting build in the editor world for
+  // build_lighting / bake_lightmap / build_level_lighting. Streams the build
+  // stage as progress and replies with the build stats when it ends, without
+  // holding the request loop; waitForCompletion=false replies at once.
+  bool StartTrackedLightingBuild(const FString &RequestId,
+                                 const TSharedPtr<FJsonObject> &Payload,
+                                 TSharedPtr<FMcpBridgeWebSocket> RequestingSocket,
+                                 const FString &DefaultQuality);
   // Performance related automation actions
   bool
   HandlePerformanceAction(const FString &RequestId, const FString &Action,
@@ -443,6 +759,10 @@ private:
                           const TSharedPtr<FJsonObject> &Payload,
                           TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
   bool
+  HandleBulkBuildMeshes(const FString &RequestId, const FString &Action,
+                        const TSharedPtr<FJsonObject> &Payload,
+                        TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
+  bool
   HandleFindByTag(const FString &RequestId, const FString &Action,
                   const TSharedPtr<FJsonObject> &Payload,
                   TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
@@ -494,6 +814,10 @@ private:
                              const TSharedPtr<FJsonObject> &Payload,
                              TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
   bool
+  HandleGetHeightmapRegion(const FString &RequestId, const FString &Action,
+                           const TSharedPtr<FJsonObject> &Payload,
+                           TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
+  bool
   HandlePaintLandscapeLayer(const FString &RequestId, const FString &Action,
                             const TSharedPtr<FJsonObject> &Payload,
                             TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
@@ -693,6 +1017,9 @@ private:
   bool HandlePruneWeights(const FString &RequestId,
                           const TSharedPtr<FJsonObject> &Payload,
                           TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
+  bool HandleUploadSkinData(const FString &RequestId,
+                            const TSharedPtr<FJsonObject> &Payload,
+                            TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
   bool HandleBindClothToSkeletalMesh(const FString &RequestId,
                                      const TSharedPtr<FJsonObject> &Payload,
                                      TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
@@ -850,12 +1177,29 @@ private:
   bool HandleLogAction(const FString &RequestId, const FString &Action,
                        const TSharedPtr<FJsonObject> &Payload,
                        TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
+  bool HandleGetRecentLogs(const FString &RequestId, const FString &Action,
+                           const TSharedPtr<FJsonObject> &Payload,
+                           TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
+  bool HandleGetRuntimeState(const FString &RequestId, const FString &Action,
+                             const TSharedPtr<FJsonObject> &Payload,
+                             TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
+  bool HandleSubscribeRuntimeTelemetry(
+      const FString &RequestId, const FString &Action,
+      const TSharedPtr<FJsonObject> &Payload,
+      TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
+  bool HandleUnsubscribeRuntimeTelemetry(
+      const FString &RequestId, const FString &Action,
+      const TSharedPtr<FJsonObject> &Payload,
+      TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
   bool HandleDebugAction(const FString &RequestId, const FString &Action,
                          const TSharedPtr<FJsonObject> &Payload,
                          TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
   bool HandleAssetQueryAction(const FString &RequestId, const FString &Action,
                               const TSharedPtr<FJsonObject> &Payload,
                               TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
+  // Result sets behind paged search_assets; created in Initialize because the
+  // query also runs on the worker lane.
+  TSharedPtr<FMcpAssetSearchCursors> AssetSearchCursors;
   bool HandleInsightsAction(const FString &RequestId, const FString &Action,
                             const TSharedPtr<FJsonObject> &Payload,
                             TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
@@ -864,6 +1208,35 @@ private:
   bool HandleDescribeCapabilities(const FString &RequestId, const FString &Action,
                                   const TSharedPtr<FJsonObject> &Payload,
                                   TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
+  bool HandleGetBridgeMetrics(const FString &RequestId, const FString &Action,
+                              const TSharedPtr<FJsonObject> &Payload,
+                              TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
+  bool HandleBridgeEcho(const FString &RequestId, const FString &Action,
+                        const TSharedPtr<FJsonObject> &Payload,
+                        TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
+  bool HandleSubscribeEvents(const FString &RequestId, const FString &Action,
+                             const TSharedPtr<FJsonObject> &Payload,
+                             TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
+
+  // Batch envelope: runs an ordered list of sub-actions in one dispatch
+  bool HandleBatchAction(const FString &RequestId, const FString &Action,
+                         const TSharedPtr<FJsonObject> &Payload,
+                         TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
+  // Blueprint edit session: N edits to one Blueprint, one compile and save
+  bool HandleBlueprintEditSession(
+      const FString &RequestId, const FString &Action,
+      const TSharedPtr<FJsonObject> &Payload,
+      TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
+  // Compiles many Blueprints in dependency order in one compilation pass
+  bool HandleCompileBlueprints(
+      const FString &RequestId, const FString &Action,
+      const TSharedPtr<FJsonObject> &Payload,
+      TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
+  // Material edit session: N expression edits to one material, one recompile
+  bool HandleMaterialEditSession(
+      const FString &RequestId, const FString &Action,
+      const TSharedPtr<FJsonObject> &Payload,
+      TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
 
   // 4. Input, UI, Hotkeys & Dialogs
   bool
@@ -877,7 +1250,7 @@ private:
 
   // Sequence helpers
   FString ResolveSequencePath(const TSharedPtr<FJsonObject> &Payload);
-  TSharedPtr<FJsonObject> EnsureSequenceEntry(const FString &SeqPath);
+  bool EnsureSequenceEntry(const FString &SeqPath);
 
   // Individual sequence action handlers
   bool HandleSequenceCreate(const FString &RequestId,
@@ -943,9 +1316,23 @@ private:
   bool HandleSequenceAddKeyframe(const FString &RequestId,
                                  const TSharedPtr<FJsonObject> &Payload,
                                  TSharedPtr<FMcpBridgeWebSocket> Socket);
+  bool HandleSequenceAddKeyframes(const FString &RequestId,
+                                  const TSharedPtr<FJsonObject> &Payload,
+                                  TSharedPtr<FMcpBridgeWebSocket> Socket);
 
   // Control handlers
   AActor *FindActorByName(const FString &Target, bool bExactMatchOnly = false);
+  // FindActorByName + FindComponentByName, memoized per "Actor.Component".
+  // OutActor receives the owner, or null when the actor itself was not found.
+  UActorComponent *FindActorComponent(const FString &ActorName,
+                                      const FString &ComponentName,
+                                      AActor **OutActor = nullptr);
+  // Label/tag index over the editor world behind FindActorByName; created on
+  // first use, game thread only.
+  TSharedPtr<FMcpActorIndex> ActorIndex;
+  FMcpActorIndex &GetActorIndex();
+  // Created in Initialize so edits made before the first rebuild count.
+  TSharedPtr<FMcpNavDirtyTracker> NavDirtyTracker;
 
   // Control Actor Subhandlers
   bool HandleControlActorSpawn(const FString &RequestId,
@@ -954,6 +1341,9 @@ private:
   bool HandleControlActorSpawnBlueprint(const FString &RequestId,
                                         const TSharedPtr<FJsonObject> &Payload,
                                         TSharedPtr<FMcpBridgeWebSocket> Socket);
+  bool HandleControlActorSpawnBulk(const FString &RequestId,
+                                   const TSharedPtr<FJsonObject> &Payload,
+                                   TSharedPtr<FMcpBridgeWebSocket> Socket);
   bool HandleControlActorDelete(const FString &RequestId,
                                 const TSharedPtr<FJsonObject> &Payload,
                                 TSharedPtr<FMcpBridgeWebSocket> Socket);
@@ -1167,6 +1557,12 @@ private:
   bool HandleControlEditorCaptureViewport(const FString &RequestId,
                                           const TSharedPtr<FJsonObject> &Payload,
                                           TSharedPtr<FMcpBridgeWebSocket> Socket);
+  bool HandleControlEditorSubscribeViewportStream(const FString &RequestId,
+                                                  const TSharedPtr<FJsonObject> &Payload,
+                                                  TSharedPtr<FMcpBridgeWebSocket> Socket);
+  bool HandleControlEditorUnsubscribeViewportStream(const FString &RequestId,
+                                                    const TSharedPtr<FJsonObject> &Payload,
+                                                    TSharedPtr<FMcpBridgeWebSocket> Socket);
 
   // Asset handlers
   bool HandleImportAsset(const FString &RequestId,
@@ -1255,4 +1651,30 @@ private:
   ProcessAutomationRequest(const FString &RequestId, const FString &Action,
                            const TSharedPtr<FJsonObject> &Payload,
                            TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
+  bool DispatchAutomationAction(const FString &RequestId, const FString &Action,
+                                const TSharedPtr<FJsonObject> &Payload,
+                                TSharedPtr<FMcpBridgeWebSocket> RequestingSocket,
+                                FString &OutHandlerLabel);
+
+  /**
+   * Response captured for one sub-action of a batch. SendAutomationResponse
+   * fills these instead of sending while the sub-request id is registered, so
+   * the batch handler can reply once with the aggregated results.
+   */
+  struct FBatchResponseCapture {
+    FString BatchRequestId;
+    bool bResponded = false;
+    bool bSuccess = false;
+    FString Message;
+    FString ErrorCode;
+    TSharedPtr<FJsonObject> Result;
+  };
+  TMap<FString, FBatchResponseCapture> BatchResponseCaptures;
+
+  /** Dispatches Action under SubRequestId and returns its captured response. */
+  FBatchResponseCapture
+  DispatchCapturedAction(const FString &OwnerRequestId,
+                         const FString &SubRequestId, const FString &Action,
+                         const TSharedPtr<FJsonObject> &Payload,
+                         TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
 };
@@ -1,12 +1,18 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/LruCache.h"
 #include "Containers/Ticker.h"
 #include "Dom/JsonObject.h"
+#include "McpLatencyHistogram.h"
+#include "McpTokenBucket.h"
 #include "Templates/SharedPointer.h"
+#include "Templates/UniquePtr.h"
 #include "Misc/ScopeLock.h"
 
 class FMcpBridgeWebSocket;
+class FMcpBridgeReactor;
+class FMcpJsonUtf8Writer;
 class UMcpAutomationBridgeSettings;
 
 /**
@@ -15,6 +21,33 @@ class UMcpAutomationBridgeSettings;
  */
 DECLARE_DELEGATE_FourParams(FMcpMessageReceivedCallback, const FString&, const FString&, const TSharedPtr<FJsonObject>&, TSharedPtr<FMcpBridgeWebSocket>);
 
+/**
+ * Delegate asked to drop a request that has not started yet.
+ * Params: RequestId. Returns true if the request was removed and already answered.
+ */
+DECLARE_DELEGATE_RetVal_OneParam(bool, FMcpCancelRequestedCallback, const FString&);
+
+/**
+ * Delegate that reports how many requests are waiting in each scheduler lane.
+ * Params: lane name -> queued request count, filled by the callee.
+ */
+DECLARE_DELEGATE_OneParam(FMcpQueueDepthCallback, TMap<FString, int32>&);
+
+/**
+ * Binary payload produced by a handler for a pending request.
+ * Delivered as binary frames right after the request's automation_response when
+ * the peer advertised "binary_attachments" in bridge_hello; otherwise inlined
+ * into the result as base64 so older clients keep working.
+ */
+struct FMcpAutomationAttachment
+{
+	FString Id;
+	FString MimeType;
+	/** Result field that receives the base64 data for peers without binary support. */
+	FString ResultField;
+	TArray<uint8> Data;
+};
+
 /**
  * Manages WebSocket connections for the MCP Automation Bridge.
  * Handles listening, connecting, reconnecting, heartbeats, and message dispatching.
@@ -33,10 +66,44 @@ public:
 	bool IsBridgeActive() const { return bBridgeAvailable; }
 	bool IsReconnectPending() const { return TimeUntilReconnect > 0.0f; }
 
-    bool SendRawMessage(const FString& Message);
+    /**
+     * Publishes Message on the "events" topic, so every socket subscribed to it (all of them by
+     * default) gets a copy. Discardable messages skip sockets under outbound backpressure.
+     */
+    bool SendRawMessage(const FString& Message, bool bDiscardable = false);
+    /** Sends pre-encoded UTF-8 text to one socket unless it is under outbound backpressure. */
+    bool SendDiscardableTo(const TSharedPtr<FMcpBridgeWebSocket>& Socket, TArray<uint8>&& Utf8Payload);
     void SendAutomationResponse(TSharedPtr<FMcpBridgeWebSocket> TargetSocket, const FString& RequestId, bool bSuccess, const FString& Message, const TSharedPtr<FJsonObject>& Result, const FString& ErrorCode);
+    /** Same envelope as above; Result is a complete object streamed by the handler and is spliced in as-is. */
+    void SendAutomationResponse(TSharedPtr<FMcpBridgeWebSocket> TargetSocket, const FString& RequestId, bool bSuccess, const FString& Message, const FMcpJsonUtf8Writer& Result, const FString& ErrorCode);
     void SendControlMessage(const TSharedPtr<FJsonObject>& Message);
 
+    /**
+     * Event topics sockets subscribe to: "events" (automation_event notifications), "logs",
+     * "telemetry" and "viewport" (pushes of subscriptions made without a socket), "progress"
+     * (progress_update of every client's requests) and "actors" (actor_changes batches). A socket
+     * that never chose gets every topic but the opt-in "progress" and "actors".
+     */
+    static const TArray<FString>& GetEventTopics();
+    static bool IsDefaultEventTopic(const FString& Topic);
+    /** Game thread. Replaces the topics Socket receives; an empty set mutes it. */
+    void SetSubscribedTopics(const TSharedPtr<FMcpBridgeWebSocket>& Socket, const TSet<FString>& Topics);
+    TSet<FString> GetSubscribedTopics(const TSharedPtr<FMcpBridgeWebSocket>& Socket) const;
+    bool HasTopicSubscribers(const FString& Topic) const;
+    /**
+     * Game thread. Queues one encoded message on every connected socket subscribed to Topic
+     * except ExcludeSocket; all their send queues share the one buffer. Discardable messages skip
+     * sockets under outbound backpressure. Returns the number of sockets it was queued on.
+     */
+    int32 Publish(const FString& Topic, TArray<uint8>&& Utf8Payload, bool bDiscardable = true,
+        const FMcpBridgeWebSocket* ExcludeSocket = nullptr);
+    int32 PublishShared(const FString& Topic, const TSharedRef<const TArray<uint8>, ESPMode::ThreadSafe>& Utf8Payload,
+        bool bDiscardable = true, const FMcpBridgeWebSocket* ExcludeSocket = nullptr);
+
+    /** Queues an attachment for the next SendAutomationResponse of RequestId and returns its ID. */
+    FString StageAttachment(const FString& RequestId, FMcpAutomationAttachment&& Attachment);
+    bool SupportsBinaryAttachments(const TSharedPtr<FMcpBridgeWebSocket>& Socket) const;
+
     /**
      * Send a progress update message to extend request timeout during long operations.
      * Used for heartbeat/keepalive to prevent timeouts while UE is actively working.
@@ -49,38 +116,159 @@ public:
     void SendProgressUpdate(const FString& RequestId, float Percent = -1.0f, const FString& Message = TEXT(""), bool bStillWorking = true);
 
 	void SetOnMessageReceived(FMcpMessageReceivedCallback InCallback);
+	void SetOnCancelRequested(FMcpCancelRequestedCallback InCallback);
+	/** Polled on the game thread whenever the metrics endpoint snapshot is rebuilt. */
+	void SetQueueDepthProvider(FMcpQueueDepthCallback InCallback);
+
+	/**
+	 * Thread-safe. True once the client sent cancel_request for RequestId and the request has
+	 * not responded yet. Long-running handlers poll this between steps.
+	 */
+	bool IsRequestCancelled(const FString& RequestId) const;
 
 	// Request tracking helpers
 	int32 GetActiveSocketCount() const;
+	/** Bytes waiting in the outbound queues of all active sockets. */
+	int64 GetQueuedOutboundBytes() const;
 	void RegisterRequestSocket(const FString& RequestId, TSharedPtr<FMcpBridgeWebSocket> Socket);
 
 	// Telemetry helpers
 	void StartRequestTelemetry(const FString& RequestId, const FString& Action);
-	void RecordAutomationTelemetry(const FString& RequestId, bool bSuccess, const FString& Message, const FString& ErrorCode);
+	/** Marks the moment a handler starts running; the time before it counts as queue wait. */
+	void MarkRequestDispatched(const FString& RequestId);
+	/**
+	 * ResponseStartSeconds and SerializationSeconds split the handler's own time from the time
+	 * spent building the response; pass 0 when the caller did not measure them.
+	 */
+	void RecordAutomationTelemetry(const FString& RequestId, bool bSuccess, const FString& Message, const FString& ErrorCode,
+		double ResponseStartSeconds = 0.0, double SerializationSeconds = 0.0);
+	/** Per-action counts and p50/p90/p99/max for queue wait, dispatch and serialization since the window began. */
+	TSharedPtr<FJsonObject> GetMetricsSnapshot(bool bResetWindow);
+	/** Records how long a deferred request waited in a scheduler lane and how many requests were still queued. */
+	void RecordQueueTelemetry(const FString& Lane, double WaitSeconds, int32 QueueDepth);
+	/** Records one episode of requests held back by GC / save / async loading and what resumed them. */
+	void RecordDeferralTelemetry(const FString& Reason, const FString& Trigger, int32 Requests, double DeferredSeconds);
+	/** Game-thread time the subsystem spent on bridge work (draining, dispatch) outside this manager's own tick. */
+	void AddGameThreadTime(double Seconds);
 
 	bool Tick(float DeltaTime);
 
+	/**
+	 * Game thread only. Dispatches messages the socket threads queued since the last call,
+	 * in arrival order, until MaxSeconds have been spent (<= 0 drains everything). Called
+	 * from the subsystem's per-frame ticker.
+	 */
+	void DrainInboundMessages(double MaxSeconds);
+
 private:
 	void AttemptConnection();
 	void ForceReconnect(const FString& Reason, float ReconnectDelayOverride = -1.0f);
+	void StopIoReactor();
 
 	void HandleConnected(TSharedPtr<FMcpBridgeWebSocket> Socket);
 	void HandleClientConnected(TSharedPtr<FMcpBridgeWebSocket> ClientSocket);
 	void HandleConnectionError(TSharedPtr<FMcpBridgeWebSocket> Socket, const FString& Error);
 	void HandleServerConnectionError(const FString& Error);
 	void HandleClosed(TSharedPtr<FMcpBridgeWebSocket> Socket, int32 StatusCode, const FString& Reason, bool bWasClean);
-	void HandleMessage(TSharedPtr<FMcpBridgeWebSocket> Socket, const FString& Message);
+	// Inbound text messages: decoded and validated on the socket thread, then
+	// posted to the game thread in dispatch-ready form.
+	struct FInboundMessage
+	{
+		enum class EKind : uint8 { AutomationRequest, BridgeHello, CancelRequest, Reject };
+		EKind Kind = EKind::Reject;
+		FString RequestId;
+		FString Action;
+		/** automation_request payload, or the whole bridge_hello object. */
+		TSharedPtr<FJsonObject> Payload;
+		/** Serialized bridge_error sent before closing a rejected socket. */
+		FString RejectPayload;
+		int32 CloseCode = 0;
+		FString CloseReason;
+	};
+	struct FQueuedInboundMessage
+	{
+		TSharedPtr<FMcpBridgeWebSocket> Socket;
+		FInboundMessage Message;
+	};
+	class FInboundQueue;
+	void HandleInboundText(const TSharedPtr<FMcpBridgeWebSocket>& Socket, const TArray<uint8>& Utf8Payload);
+	/** Socket thread. MessagePack-encoded requests from peers that negotiated "msgpack". */
+	void HandleInboundBinary(const TSharedPtr<FMcpBridgeWebSocket>& Socket, const TArray<uint8>& Payload);
+	/** Socket thread. Per-message rate limit shared by both encodings; posts the rejection itself. */
+	bool AdmitInboundMessage(const TSharedPtr<FMcpBridgeWebSocket>& Socket);
+	/** Socket thread. Validates a decoded message and posts it; LogText stands in for the raw message in warnings. */
+	void RouteInboundObject(const TSharedPtr<FMcpBridgeWebSocket>& Socket, const TSharedPtr<FJsonObject>& RootObj, const FString& LogText);
+	void PostInboundMessage(const TSharedPtr<FMcpBridgeWebSocket>& Socket, FInboundMessage&& Inbound);
+	void HandleInboundMessage(TSharedPtr<FMcpBridgeWebSocket> Socket, FInboundMessage&& Inbound);
 	void HandleHeartbeat(TSharedPtr<FMcpBridgeWebSocket> Socket);
 
 	void EmitAutomationTelemetrySummaryIfNeeded(double NowSeconds);
-	bool UpdateRateLimit(FMcpBridgeWebSocket* SocketPtr, bool bIncrementMessage, bool bIncrementAutomation, FString& OutReason);
+	/** Game thread. Rebuilds the OpenMetrics text that the socket threads hand to scrapers. */
+	void RefreshMetricsText(double NowSeconds);
+	FString BuildOpenMetricsText();
+	/** Socket thread. FMcpBridgeWebSocket::FHttpGetHandler for the listen ports. */
+	bool HandleMetricsHttpRequest(const FString& Path, const TMap<FString, FString>& Headers, int32& OutStatusCode, FString& OutContentType, FString& OutBody) const;
+	// Rate-limit classes; each is a token bucket slot on the socket.
+	enum class ERateLimitBucket : uint8 { Message, Automation, Read, Heavy, Count };
+	/** Socket thread. Takes one token from the socket's bucket for Bucket; false once it is empty. */
+	bool ConsumeRateLimit(FMcpBridgeWebSocket* SocketPtr, ERateLimitBucket Bucket, FString& OutReason);
+	/** Buckets an automation_request draws from; reads and heavy builds only when they have their own limit. */
+	ERateLimitBucket ClassifyRateLimitBucket(const FString& Action, const TSharedPtr<FJsonObject>& Payload) const;
+	/**
+	 * Shared tail of both SendAutomationResponse overloads: replay cache, logging, telemetry,
+	 * socket fallback and the response_fallback event. The callbacks only run when needed.
+	 */
+	void DeliverAutomationResponse(TSharedPtr<FMcpBridgeWebSocket> TargetSocket, const FString& RequestId, bool bSuccess,
+		const FString& Message, const FString& ErrorCode, TArray<uint8>&& Serialized, TArray<uint8>&& SerializedMessagePack,
+		const TArray<FMcpAutomationAttachment>& Attachments, TFunctionRef<void(TArray<uint8>&)> SerializeInlineAttachments,
+		double ResponseStartSeconds, double SerializationSeconds,
+		TFunctionRef<FString()> GetResultPreview, TFunctionRef<TSharedPtr<FJsonObject>()> GetFallbackPayload);
+	bool SendAttachmentFrames(const TSharedPtr<FMcpBridgeWebSocket>& Socket, const TArray<FMcpAutomationAttachment>& Attachments);
+	/**
+	 * Answers a retried requestId from the replay cache, or re-points a request that is
+	 * still running at the retrying socket. Returns false when the request must be dispatched.
+	 */
+	bool TryReplayOrJoinRequest(const TSharedPtr<FMcpBridgeWebSocket>& Socket, const FString& RequestId);
+	void RememberCompletedResponse(const FString& RequestId, const TSharedPtr<TArray<uint8>, ESPMode::ThreadSafe>& Serialized);
 
 private:
 	TArray<TSharedPtr<FMcpBridgeWebSocket>> ActiveSockets;
+	// Socket threads push decoded messages here; DrainInboundMessages pops them.
+	TUniquePtr<FInboundQueue> InboundQueue;
+	// Shared I/O threads for listeners and accepted clients (bUseSharedIoReactor).
+	TSharedPtr<FMcpBridgeReactor> IoReactor;
 	TMap<FString, TSharedPtr<FMcpBridgeWebSocket>> PendingRequestsToSockets;
 	TSet<FMcpBridgeWebSocket*> AuthenticatedSockets;
+	TSet<FMcpBridgeWebSocket*> BinaryAttachmentSockets;
+	/** Sockets that negotiated "msgpack"; their automation responses go out as MessagePack binary frames. */
+	TSet<FMcpBridgeWebSocket*> MessagePackSockets;
+	/** Topics of sockets that chose them with subscribe_events; the rest get the defaults. */
+	TMap<FMcpBridgeWebSocket*, TSet<FString>> SocketTopics;
+	bool IsSubscribedToTopic(const FMcpBridgeWebSocket* Socket, const FString& Topic) const;
+	TMap<FString, TArray<FMcpAutomationAttachment>> StagedAttachments;
+	/** Cancellation tokens, guarded by PendingRequestsMutex; set by the socket thread. */
+	TSet<FString> CancelledRequestIds;
+
+	// Replay cache (game thread only). Attachments are replayed inlined as base64.
+	struct FReplayEntry
+	{
+		TSharedPtr<TArray<uint8>, ESPMode::ThreadSafe> Response;
+		double CompletedSeconds = 0.0;
+	};
+	struct FInFlightRequest
+	{
+		double DispatchedSeconds = 0.0;
+		/** Sockets that retried the request while it was running. */
+		TArray<TSharedPtr<FMcpBridgeWebSocket>> JoinedSockets;
+	};
+	TLruCache<FString, FReplayEntry> ReplayCache;
+	/** Dispatched requestIds that have not responded yet. */
+	TMap<FString, FInFlightRequest> InFlightRequests;
+	int64 ReplayCacheBytes = 0;
 	FTSTicker::FDelegateHandle TickerHandle;
 	FMcpMessageReceivedCallback OnMessageReceived;
+	FMcpCancelRequestedCallback OnCancelRequested;
+	FMcpQueueDepthCallback OnQueryQueueDepths;
 
 	// Configuration
 	FString EnvListenHost;
@@ -92,15 +280,28 @@ private:
 	FString ActiveSessionId;
 	FString TlsCertificatePath;
 	FString TlsPrivateKeyPath;
+	FString MetricsEndpointPath = TEXT("/metrics");
 	
 	int32 ClientPort = 0;
+	int32 PerMessageDeflateThresholdBytes = 1024;
+	int32 OutboundQueueHighWatermarkBytes = 8 * 1024 * 1024;
+	int32 OutboundQueueLowWatermarkBytes = 2 * 1024 * 1024;
+	int32 IoReactorThreadCount = 2;
+	int32 ReplayCacheMaxEntries = 256;
+	int64 ReplayCacheMaxBytes = 64 * 1024 * 1024;
+	double ReplayCacheTtlSeconds = 300.0;
 	float AutoReconnectDelaySeconds = 5.0f;
 	float HeartbeatTimeoutSeconds = 0.0f;
 	
 	bool bRequireCapabilityToken = false;
 	bool bEnableTls = false;
+	bool bEnablePerMessageDeflate = false;
+	bool bPerMessageDeflateContextTakeover = true;
+	bool bAllowMessagePackEncoding = true;
+	bool bUseSharedIoReactor = false;
 	bool bEnvListenPortsSet = false;
 	bool bHeartbeatTrackingEnabled = false;
+	bool bEnableMetricsEndpoint = false;
 
 	// State
 	bool bBridgeAvailable = false;
@@ -109,12 +310,21 @@ private:
 	double LastHeartbeatTimestamp = 0.0;
 	int32 MaxMessagesPerMinute = 0;
 	int32 MaxAutomationRequestsPerMinute = 0;
+	int32 MaxReadRequestsPerMinute = 0;
+	int32 MaxHeavyRequestsPerMinute = 0;
+	float RateLimitBurstSeconds = 10.0f;
+	/** Fixed after Initialize, so the socket threads read them without a lock. */
+	FMcpRateLimitPolicy RateLimitPolicies[static_cast<int32>(ERateLimitBucket::Count)];
+	TSet<FString> ReadRateLimitActions;
+	TSet<FString> HeavyRateLimitActions;
+	TAtomic<int64> RateLimitRejections[static_cast<int32>(ERateLimitBucket::Count)];
 
 	// Telemetry
 	struct FAutomationRequestTelemetry
 	{
 		FString Action;
 		double StartTimeSeconds = 0.0;
+		double DispatchStartSeconds = 0.0;
 	};
 
 	struct FAutomationActionStats
@@ -125,21 +335,57 @@ private:
 		double TotalFailureDurationSeconds = 0.0;
 		double LastDurationSeconds = 0.0;
 		double LastUpdatedSeconds = 0.0;
+		FMcpLatencyHistogram QueueWait;
+		FMcpLatencyHistogram Dispatch;
+		FMcpLatencyHistogram Serialization;
+	};
+
+	struct FQueueLaneStats
+	{
+		int32 DequeuedCount = 0;
+		double TotalWaitSeconds = 0.0;
+		double MaxWaitSeconds = 0.0;
+		int32 MaxQueueDepth = 0;
 	};
 
-	struct FSocketRateState
+	struct FDeferralStats
 	{
-		double WindowStartSeconds = 0.0;
-		int32 MessageCount = 0;
-		int32 AutomationRequestCount = 0;
+		int32 EpisodeCount = 0;
+		int32 RequestCount = 0;
+		double TotalSeconds = 0.0;
+		double MaxSeconds = 0.0;
+		TMap<FString, int32> Triggers;
 	};
 
 	TMap<FString, FAutomationRequestTelemetry> ActiveRequestTelemetry;
 	TMap<FString, FAutomationActionStats> AutomationActionTelemetry;
-	TMap<FMcpBridgeWebSocket*, FSocketRateState> SocketRateLimits;
+	TMap<FString, FQueueLaneStats> QueueLaneTelemetry;
+	TMap<FString, FDeferralStats> DeferralTelemetry;
+
+	struct FTopicStats
+	{
+		int64 Published = 0;
+		/** Socket sends; one publish counts once per subscriber it reached. */
+		int64 Delivered = 0;
+		int64 Dropped = 0;
+	};
+	TMap<FString, FTopicStats> TopicTelemetry;
 	double TelemetrySummaryIntervalSeconds = 120.0;
 	double LastTelemetrySummaryLogSeconds = 0.0;
+	/** When AutomationActionTelemetry was last reset through get_bridge_metrics. */
+	double TelemetryWindowStartSeconds = 0.0;
+	int32 DroppedDiscardableMessages = 0;
+
+	// Metrics endpoint. Scrapers expect counters that only grow, so these are
+	// never reset by the log summary or get_bridge_metrics; they are only
+	// filled while bEnableMetricsEndpoint is set.
+	TMap<FString, FAutomationActionStats> LifetimeActionTelemetry;
+	TMap<FString, FQueueLaneStats> LifetimeQueueLaneTelemetry;
+	double GameThreadSeconds = 0.0;
+	double LastMetricsRefreshSeconds = 0.0;
+	/** Latest OpenMetrics exposition, guarded by MetricsTextMutex. */
+	FString CachedMetricsText;
+	mutable FCriticalSection MetricsTextMutex;
 
 	mutable FCriticalSection PendingRequestsMutex;
-	mutable FCriticalSection RateLimitMutex;
 };
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FJsonObject;
+
+/**
+ * Append-only JSON writer that encodes straight into a UTF-8 byte buffer. Handlers stream large
+ * results through it instead of building an FJsonObject tree, and the connection manager splices
+ * the bytes into the automation_response envelope without an intermediate UTF-16 FString. The
+ * buffer comes from a small process-wide pool and goes back with its capacity on destruction, so
+ * repeated list-style responses stop re-growing their storage. Separators are tracked per scope;
+ * callers only pair Begin/End calls and put a Key before every object member.
+ */
+class FMcpJsonUtf8Writer
+{
+public:
+    FMcpJsonUtf8Writer();
+    ~FMcpJsonUtf8Writer();
+
+    FMcpJsonUtf8Writer(FMcpJsonUtf8Writer&& Other);
+    FMcpJsonUtf8Writer& operator=(FMcpJsonUtf8Writer&& Other);
+    FMcpJsonUtf8Writer(const FMcpJsonUtf8Writer&) = delete;
+    FMcpJsonUtf8Writer& operator=(const FMcpJsonUtf8Writer&) = delete;
+
+    void BeginObject() { OpenScope('{'); }
+    void EndObject() { CloseScope('}'); }
+    void BeginArray() { OpenScope('['); }
+    void EndArray() { CloseScope(']'); }
+
+    void Key(FStringView Name);
+
+    void String(FStringView Value);
+    void Number(double Value);
+    void Int(int64 Value);
+    void Bool(bool Value);
+    void Null();
+
+    /** Emits a value that is already valid UTF-8 JSON, such as a nested writer's buffer. */
+    void RawValue(TArrayView<const uint8> Json);
+
+    /**
+     * Emits a complete JSON object with its closing brace held back, so members can be appended
+     * and the object finished with EndObject. Anything that is not an object is written as {}.
+     */
+    void ReopenObject(TArrayView<const uint8> ObjectJson);
+
+    void WriteString(FStringView Name, FStringView Value) { Key(Name); String(Value); }
+    void WriteNumber(FStringView Name, double Value) { Key(Name); Number(Value); }
+    void WriteInt(FStringView Name, int64 Value) { Key(Name); Int(Value); }
+    void WriteBool(FStringView Name, bool Value) { Key(Name); Bool(Value); }
+
+    /** True once exactly one top-level object has been written and every scope is closed. */
+    bool IsCompleteObject() const
+    {
+        return Scopes.Num() == 0 && Buffer.Num() >= 2 && Buffer[0] == '{' && Buffer.Last() == '}';
+    }
+
+    /** Parses the bytes back into a DOM for callers that need one (batch capture, fallbacks); null on failure. */
+    TSharedPtr<FJsonObject> ParseAsJsonObject() const;
+
+    const TArray<uint8>& GetBuffer() const { return Buffer; }
+    int32 Num() const { return Buffer.Num(); }
+
+private:
+    void BeforeValue();
+    void OpenScope(uint8 Bracket);
+    void CloseScope(uint8 Bracket);
+    void AppendEscaped(FStringView Value);
+    void AppendAscii(const ANSICHAR* Text, int32 Len)
+    {
+        Buffer.Append(reinterpret_cast<const uint8*>(Text), Len);
+    }
+
+    TArray<uint8> Buffer;
+    /** One entry per open object or array; true once the scope holds at least one element. */
+    TArray<bool, TInlineAllocator<16>> Scopes;
+    bool bAfterKey = false;
+};
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Log-linear latency histogram in the spirit of HdrHistogram. Values are bucketed by power of
+ * two and each power is split into 16 linear sub-buckets, so percentiles are reported within
+ * ~6% of the recorded value from 1 us up to ~19 hours with a fixed 2 KB of counters, allocated
+ * on the first sample. Not thread-safe; the owner records and reads on one thread.
+ */
+class FMcpLatencyHistogram
+{
+public:
+    void Record(double Seconds)
+    {
+        const uint64 Micros = Seconds > 0.0 ? static_cast<uint64>(Seconds * 1.0e6) : 0;
+        if (Counts.Num() == 0)
+        {
+            Counts.SetNumZeroed(NumBuckets);
+        }
+        ++Counts[BucketFor(Micros)];
+        ++TotalCount;
+        SumSeconds += FMath::Max(Seconds, 0.0);
+        MaxSeconds = FMath::Max(MaxSeconds, Seconds);
+    }
+
+    /** Upper edge of the bucket holding the given percentile (0-100), in seconds; 0 when empty. */
+    double GetPercentile(double Percentile) const
+    {
+        if (TotalCount == 0)
+        {
+            return 0.0;
+        }
+        const uint64 Rank = FMath::Max<uint64>(
+            1, static_cast<uint64>(FMath::CeilToDouble(FMath::Clamp(Percentile, 0.0, 100.0) / 100.0 * TotalCount)));
+        uint64 Seen = 0;
+        for (int32 Index = 0; Index < Counts.Num(); ++Index)
+        {
+            Seen += Counts[Index];
+            if (Seen >= Rank)
+            {
+                return FMath::Min(static_cast<double>(BucketUpperMicros(Index)) / 1.0e6, MaxSeconds);
+            }
+        }
+        return MaxSeconds;
+    }
+
+    /**
+     * Samples in buckets that lie entirely at or below Seconds. Samples sharing a bucket with the
+     * bound are left out, so the result is a lower bound that never decreases as Seconds grows.
+     */
+    uint64 GetCountAtOrBelow(double Seconds) const
+    {
+        if (Seconds <= 0.0)
+        {
+            return 0;
+        }
+        const uint64 LimitMicros = static_cast<uint64>(Seconds * 1.0e6) + 1;
+        uint64 Seen = 0;
+        for (int32 Index = 0; Index < Counts.Num() && BucketUpperMicros(Index) <= LimitMicros; ++Index)
+        {
+            Seen += Counts[Index];
+        }
+        return Seen;
+    }
+
+    uint64 GetCount() const { return TotalCount; }
+    double GetSum() const { return SumSeconds; }
+    double GetMax() const { return MaxSeconds; }
+
+    void Reset()
+    {
+        Counts.Reset();
+        TotalCount = 0;
+        SumSeconds = 0.0;
+        MaxSeconds = 0.0;
+    }
+
+private:
+    static constexpr int32 SubBucketBits = 4;
+    static constexpr int32 SubBucketCount = 1 << SubBucketBits;
+    /** Largest tracked power of two, in microseconds; slower samples land in the last bucket. */
+    static constexpr int32 MaxExponent = 36;
+    static constexpr int32 NumBuckets = (MaxExponent - SubBucketBits + 2) * SubBucketCount;
+
+    static int32 BucketFor(uint64 Micros)
+    {
+        if (Micros < SubBucketCount)
+        {
+            return static_cast<int32>(Micros);
+        }
+        Micros = FMath::Min(Micros, (uint64(1) << (MaxExponent + 1)) - 1);
+        const int32 Exponent = static_cast<int32>(FMath::FloorLog2_64(Micros));
+        const int32 Shift = Exponent - SubBucketBits;
+        const int32 SubBucket = static_cast<int32>(Micros >> Shift) - SubBucketCount;
+        return (Shift + 1) * SubBucketCount + SubBucket;
+    }
+
+    static uint64 BucketUpperMicros(int32 Index)
+    {
+        if (Index < SubBucketCount)
+        {
+            return static_cast<uint64>(Index) + 1;
+        }
+        const int32 Shift = Index / SubBucketCount - 1;
+        const uint64 SubBucket = static_cast<uint64>(Index % SubBucketCount);
+        return (SubBucketCount + SubBucket + 1) << Shift;
+    }
+
+    TArray<uint64> Counts;
+    uint64 TotalCount = 0;
+    double SumSeconds = 0.0;
+    double MaxSeconds = 0.0;
+};
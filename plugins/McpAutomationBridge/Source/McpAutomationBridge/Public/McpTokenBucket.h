@@ -0,0 +1,67 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Atomic.h"
+
+/** Sustained rate and burst allowance shared by every bucket of one class. */
+struct FMcpRateLimitPolicy
+{
+    /** Microseconds between tokens; 0 disables the limit. */
+    int64 IntervalMicros = 0;
+    /** How far ahead of the sustained rate a caller may run, i.e. burst size times interval. */
+    int64 BurstMicros = 0;
+    int32 RatePerMinute = 0;
+
+    /** Rate <= 0 disables the limit. The burst is BurstSeconds worth of tokens, at least one. */
+    static FMcpRateLimitPolicy PerMinute(int32 InRatePerMinute, float BurstSeconds)
+    {
+        FMcpRateLimitPolicy Policy;
+        if (InRatePerMinute > 0)
+        {
+            Policy.RatePerMinute = InRatePerMinute;
+            Policy.IntervalMicros = FMath::Max<int64>(1, 60000000LL / InRatePerMinute);
+            const int64 BurstTokens = FMath::Max<int64>(
+                1, static_cast<int64>(InRatePerMinute * FMath::Max(0.0f, BurstSeconds) / 60.0f));
+            Policy.BurstMicros = BurstTokens * Policy.IntervalMicros;
+        }
+        return Policy;
+    }
+
+    bool IsEnabled() const { return IntervalMicros > 0; }
+};
+
+/**
+ * Token bucket kept as a single atomic "theoretical arrival time" (GCRA). Each token pushes the
+ * time forward by one interval; a request is refused once that time would run more than the
+ * burst allowance ahead of now. Refill is continuous, so there is no window edge at which a
+ * whole quota can be spent twice. Safe from any thread without a lock.
+ */
+class FMcpTokenBucket
+{
+public:
+    bool TryConsume(const FMcpRateLimitPolicy& Policy, int64 NowMicros)
+    {
+        if (!Policy.IsEnabled())
+        {
+            return true;
+        }
+        int64 Arrival = TheoreticalArrivalMicros.Load(EMemoryOrder::Relaxed);
+        for (;;)
+        {
+            const int64 NextArrival = FMath::Max(Arrival, NowMicros) + Policy.IntervalMicros;
+            if (NextArrival - NowMicros > Policy.BurstMicros)
+            {
+                return false;
+            }
+            if (TheoreticalArrivalMicros.CompareExchange(Arrival, NextArrival))
+            {
+                return true;
+            }
+        }
+    }
+
+    void Reset() { TheoreticalArrivalMicros.Store(0); }
+
+private:
+    TAtomic<int64> TheoreticalArrivalMicros{0};
+};
@@ -0,0 +1,104 @@
+/**
+ * Unit tests for binary attachment chunk parsing and reassembly
+ */
+import { describe, it, expect } from 'vitest';
+import { AttachmentAssembler, parseAttachmentChunk, readAttachmentDescriptors } from './attachments.js';
+
+function buildChunk(id: string, offset: number, total: number, data: Buffer, version = 1): Buffer {
+    const idBytes = Buffer.from(id, 'utf8');
+    const header = Buffer.alloc(4 + 1 + 1 + idBytes.length + 8);
+    header.write('MCPA', 0, 'ascii');
+    header[4] = version;
+    header[5] = idBytes.length;
+    idBytes.copy(header, 6);
+    header.writeUInt32BE(offset, 6 + idBytes.length);
+    header.writeUInt32BE(total, 10 + idBytes.length);
+    return Buffer.concat([header, data]);
+}
+
+describe('parseAttachmentChunk', () => {
+    it('decodes a well-formed chunk', () => {
+        const chunk = parseAttachmentChunk(buildChunk('req-1/0', 2, 5, Buffer.from([7, 8, 9])));
+        expect(chunk).not.toBeNull();
+        expect(chunk?.id).toBe('req-1/0');
+        expect(chunk?.offset).toBe(2);
+        expect(chunk?.total).toBe(5);
+        expect(Array.from(chunk?.data ?? [])).toEqual([7, 8, 9]);
+    });
+
+    it('rejects frames with the wrong magic or version', () => {
+        const frame = buildChunk('a', 0, 1, Buffer.from([1]));
+        frame[0] = 0x58;
+        expect(parseAttachmentChunk(frame)).toBeNull();
+        expect(parseAttachmentChunk(buildChunk('a', 0, 1, Buffer.from([1]), 2))).toBeNull();
+    });
+
+    it('rejects chunks that overrun the declared total', () => {
+        expect(parseAttachmentChunk(buildChunk('a', 4, 5, Buffer.from([1, 2])))).toBeNull();
+    });
+
+    it('rejects truncated headers', () => {
+        expect(parseAttachmentChunk(Buffer.from('MCPA', 'ascii'))).toBeNull();
+    });
+});
+
+describe('AttachmentAssembler', () => {
+    it('reassembles out-of-order chunks', () => {
+        const assembler = new AttachmentAssembler();
+        const second = parseAttachmentChunk(buildChunk('r/0', 3, 6, Buffer.from([4, 5, 6])));
+        const first = parseAttachmentChunk(buildChunk('r/0', 0, 6, Buffer.from([1, 2, 3])));
+        expect(assembler.addChunk(second!)).toBeNull();
+        expect(assembler.has('r/0')).toBe(false);
+        expect(assembler.addChunk(first!)).toBe('r/0');
+        expect(Array.from(assembler.take('r/0') ?? [])).toEqual([1, 2, 3, 4, 5, 6]);
+        expect(assembler.has('r/0')).toBe(false);
+    });
+
+    it('completes zero-length attachments from a single chunk', () => {
+        const assembler = new AttachmentAssembler();
+        const chunk = parseAttachmentChunk(buildChunk('r/0', 0, 0, Buffer.alloc(0)));
+        expect(assembler.addChunk(chunk!)).toBe('r/0');
+        expect(assembler.take('r/0')?.length).toBe(0);
+    });
+
+    it('enforces the size limit', () => {
+        const assembler = new AttachmentAssembler(4);
+        const chunk = parseAttachmentChunk(buildChunk('r/0', 0, 8, Buffer.from([1])));
+        expect(() => assembler.addChunk(chunk!)).toThrow(/exceeds size limit/);
+    });
+
+    it('rejects chunks whose total changes mid-transfer', () => {
+        const assembler = new AttachmentAssembler();
+        assembler.addChunk(parseAttachmentChunk(buildChunk('r/0', 0, 4, Buffer.from([1])))!);
+        const bad = parseAttachmentChunk(buildChunk('r/0', 1, 5, Buffer.from([2])));
+        expect(() => assembler.addChunk(bad!)).toThrow(/changed total size/);
+    });
+
+    it('discards attachments belonging to a request', () => {
+        const assembler = new AttachmentAssembler();
+        assembler.addChunk(parseAttachmentChunk(buildChunk('r/0', 0, 1, Buffer.from([1])))!);
+        assembler.addChunk(parseAttachmentChunk(buildChunk('other/0', 0, 1, Buffer.from([1])))!);
+        assembler.discardRequest('r');
+        expect(assembler.has('r/0')).toBe(false);
+        expect(assembler.has('other/0')).toBe(true);
+    });
+});
+
+describe('readAttachmentDescriptors', () => {
+    it('keeps valid descriptors and drops malformed entries', () => {
+        const descriptors = readAttachmentDescriptors([
+            { id: 'r/0', size: 10, mimeType: 'image/png', field: 'imageBase64' },
+            { id: 42, size: 1 },
+            null,
+            { id: 'r/1', size: 3 }
+        ]);
+        expect(descriptors).toEqual([
+            { id: 'r/0', size: 10, mimeType: 'image/png', field: 'imageBase64' },
+            { id: 'r/1', size: 3, mimeType: undefined, field: undefined }
+        ]);
+    });
+
+    it('returns an empty list for non-arrays', () => {
+        expect(readAttachmentDescriptors(undefined)).toEqual([]);
+    });
+});
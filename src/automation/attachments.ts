@@ -0,0 +1,144 @@
+import { MAX_ATTACHMENT_SIZE_BYTES } from '../constants.js';
+
+/**
+ * Binary attachment chunk layout (all integers big-endian), mirrored from
+ * FMcpConnectionManager::SendAttachmentFrames in the plugin:
+ *   "MCPA" | u8 version | u8 idLength | id (UTF-8) | u32 offset | u32 total | bytes
+ */
+const ATTACHMENT_MAGIC = Buffer.from('MCPA', 'ascii');
+const ATTACHMENT_VERSION = 1;
+const ATTACHMENT_HEADER_FIXED_BYTES = 4 + 1 + 1 + 4 + 4;
+
+/** Capability advertised in bridge_hello / bridge_ack for the binary channel */
+export const BINARY_ATTACHMENTS_CAPABILITY = 'binary_attachments';
+
+/** Descriptor listed in an automation_response that carries attachments */
+export interface AttachmentDescriptor {
+    id: string;
+    size: number;
+    mimeType?: string;
+    field?: string;
+}
+
+/** Fully reassembled attachment */
+export interface AutomationAttachment extends AttachmentDescriptor {
+    data: Buffer;
+}
+
+export interface AttachmentChunk {
+    id: string;
+    offset: number;
+    total: number;
+    data: Buffer;
+}
+
+/**
+ * Decode one binary frame into an attachment chunk.
+ * Returns null when the frame is not a well-formed attachment chunk.
+ */
+export function parseAttachmentChunk(frame: Buffer): AttachmentChunk | null {
+    if (frame.length < ATTACHMENT_HEADER_FIXED_BYTES) return null;
+    if (!frame.subarray(0, 4).equals(ATTACHMENT_MAGIC)) return null;
+    if (frame[4] !== ATTACHMENT_VERSION) return null;
+
+    const idLength = frame[5];
+    const headerBytes = ATTACHMENT_HEADER_FIXED_BYTES + idLength;
+    if (idLength === 0 || frame.length < headerBytes) return null;
+
+    const id = frame.toString('utf8', 6, 6 + idLength);
+    const offset = frame.readUInt32BE(6 + idLength);
+    const total = frame.readUInt32BE(10 + idLength);
+    const data = frame.subarray(headerBytes);
+
+    if (offset + data.length > total) return null;
+    return { id, offset, total, data };
+}
+
+/** Decode a descriptor list from an automation_response, dropping malformed entries */
+export function readAttachmentDescriptors(value: unknown): AttachmentDescriptor[] {
+    if (!Array.isArray(value)) return [];
+    const descriptors: AttachmentDescriptor[] = [];
+    for (const entry of value) {
+        if (!entry || typeof entry !== 'object') continue;
+        const record = entry as Record<string, unknown>;
+        if (typeof record.id !== 'string' || typeof record.size !== 'number') continue;
+        descriptors.push({
+            id: record.id,
+            size: record.size,
+            mimeType: typeof record.mimeType === 'string' ? record.mimeType : undefined,
+            field: typeof record.field === 'string' ? record.field : undefined
+        });
+    }
+    return descriptors;
+}
+
+interface PartialAttachment {
+    buffer: Buffer;
+    received: number;
+}
+
+/**
+ * Reassembles attachment chunks by id. Completed attachments are held until
+ * the owning response claims them with take().
+ */
+export class AttachmentAssembler {
+    private partial = new Map<string, PartialAttachment>();
+    private complete = new Map<string, Buffer>();
+
+    constructor(private readonly maxAttachmentBytes: number = MAX_ATTACHMENT_SIZE_BYTES) { }
+
+    /**
+     * Add a chunk. Returns the attachment id once it is complete, otherwise null.
+     * Throws when the chunk is inconsistent with earlier ones or exceeds limits.
+     */
+    public addChunk(chunk: AttachmentChunk): string | null {
+        if (chunk.total > this.maxAttachmentBytes) {
+            this.partial.delete(chunk.id);
+            throw new Error(`Attachment ${chunk.id} exceeds size limit (${chunk.total} > ${this.maxAttachmentBytes} bytes)`);
+        }
+
+        let entry = this.partial.get(chunk.id);
+        if (!entry) {
+            entry = { buffer: Buffer.alloc(chunk.total), received: 0 };
+            this.partial.set(chunk.id, entry);
+        } else if (entry.buffer.length !== chunk.total) {
+            this.partial.delete(chunk.id);
+            throw new Error(`Attachment ${chunk.id} changed total size mid-transfer`);
+        }
+
+        chunk.data.copy(entry.buffer, chunk.offset);
+        entry.received += chunk.data.length;
+
+        if (entry.received < entry.buffer.length) return null;
+
+        this.partial.delete(chunk.id);
+        this.complete.set(chunk.id, entry.buffer);
+        return chunk.id;
+    }
+
+    public has(id: string): boolean {
+        return this.complete.has(id);
+    }
+
+    /** Remove and return a completed attachment */
+    public take(id: string): Buffer | undefined {
+        const data = this.complete.get(id);
+        this.complete.delete(id);
+        return data;
+    }
+
+    /** Drop any partial or unclaimed attachments whose id belongs to the request */
+    public discardRequest(requestId: string): void {
+        const prefix = `${requestId}/`;
+        for (const map of [this.partial, this.complete]) {
+            for (const id of map.keys()) {
+                if (id.startsWith(prefix)) map.delete(id);
+            }
+        }
+    }
+
+    public clear(): void {
+        this.partial.clear();
+        this.complete.clear();
+    }
+}
@@ -11,7 +11,8 @@ import {
     DEFAULT_MAX_QUEUED_REQUESTS,
     DEFAULT_MAX_INBOUND_MESSAGES_PER_MINUTE,
     DEFAULT_MAX_INBOUND_AUTOMATION_REQUESTS_PER_MINUTE,
-    MAX_WS_MESSAGE_SIZE_BYTES
+    MAX_WS_MESSAGE_SIZE_BYTES,
+    DEFAULT_PERMESSAGE_DEFLATE_THRESHOLD_BYTES
 } from '../constants.js';
 import { createRequire } from 'node:module';
 import {
@@ -33,6 +34,7 @@ import {
     type LaunchMode
 } from '../utils/editor-launch.js';
 import { automationMessageSchema } from './message-schema.js';
+import { decodeMsgPack, encodeMsgPack, isMsgPackMessage, WireEncoding } from './msgpack.js';
 import { config } from '../config.js';
 
 const require = createRequire(import.meta.url);
@@ -61,6 +63,10 @@ export class AutomationBridge extends EventEmitter {
     private readonly maxConcurrentConnections: number;
     private readonly maxQueuedRequests: number;
     private readonly useTls: boolean;
+    private readonly perMessageDeflate: boolean;
+    private readonly wireEncoding: WireEncoding;
+    /** Sockets whose bridge_ack confirmed MessagePack; everything else stays JSON text */
+    private readonly msgPackSockets = new WeakSet<WebSocket>();
 
     private connectionManager: ConnectionManager;
     private requestTracker: RequestTracker;
@@ -274,6 +280,13 @@ export class AutomationBridge extends EventEmitter {
         const maxConcurrentConnections = Math.max(1, options.maxConcurrentConnections ?? 10);
         this.maxQueuedRequests = Math.max(0, options.maxQueuedRequests ?? DEFAULT_MAX_QUEUED_REQUESTS);
         this.useTls = parseBoolean(options.useTls ?? process.env.MCP_AUTOMATION_USE_TLS, false);
+        this.perMessageDeflate = parseBoolean(
+            options.perMessageDeflate ?? process.env.MCP_AUTOMATION_PERMESSAGE_DEFLATE,
+            true
+        );
+        const rawWireEncoding = (options.wireEncoding ?? process.env.MCP_AUTOMATION_WIRE_ENCODING ?? 'json')
+            .toString().trim().toLowerCase();
+        this.wireEncoding = rawWireEncoding === 'msgpack' ? 'msgpack' : 'json';
         const maxInboundMessagesPerMinute = parseNonNegativeInt(
             options.maxInboundMessagesPerMinute
                 ?? process.env.MCP_AUTOMATION_MAX_MESSAGES_PER_MINUTE,
@@ -300,7 +313,7 @@ export class AutomationBridge extends EventEmitter {
             maxInboundAutomationRequestsPerMinute
         );
         this.requestTracker = new RequestTracker(maxPendingRequests);
-        this.handshakeHandler = new HandshakeHandler(this.capabilityToken);
+        this.handshakeHandler = new HandshakeHandler(this.capabilityToken, this.wireEncoding === 'msgpack');
         this.messageHandler = new MessageHandler(this.requestTracker);
 
         // Forward events from connection manager
@@ -362,7 +375,9 @@ export class AutomationBridge extends EventEmitter {
 
             const socket = new WebSocket(url, protocols, {
                 headers,
-                perMessageDeflate: false
+                perMessageDeflate: this.perMessageDeflate
+                    ? { threshold: DEFAULT_PERMESSAGE_DEFLATE_THRESHOLD_BYTES }
+                    : false
             });
 
             this.handleClientConnection(socket);
@@ -393,6 +408,11 @@ export class AutomationBridge extends EventEmitter {
                 const remoteAddr = underlying?.remoteAddress ?? undefined;
                 const remotePort = underlying?.remotePort ?? undefined;
 
+                if (metadata.encoding === 'msgpack') {
+                    this.msgPackSockets.add(socket);
+                    this.log.info('Automation bridge negotiated MessagePack encoding');
+                }
+
                 this.connectionManager.registerSocket(socket, this.clientPort, metadata, remoteAddr, remotePort);
                 this.connectionManager.startHeartbeat();
 
@@ -455,7 +475,7 @@ export class AutomationBridge extends EventEmitter {
                     return '';
                 };
 
-                        socket.on('message', (data) => {
+                        socket.on('message', (data, isBinary) => {
                     try {
                         const byteLength = getRawDataByteLength(data);
                         if (byteLength > MAX_WS_MESSAGE_SIZE_BYTES) {
@@ -465,9 +485,26 @@ export class AutomationBridge extends EventEmitter {
                             return;
                         }
 
-                        const text = rawDataToUtf8String(data, byteLength);
-                        this.log.debug(`[AutomationBridge Client] Received message: ${text.substring(0, 1000)}`);
-                        const parsed = JSON.parse(text) as AutomationBridgeMessage;
+                        let parsed: AutomationBridgeMessage;
+                        if (isBinary) {
+                            const buffer = Buffer.isBuffer(data)
+                                ? data
+                                : Array.isArray(data)
+                                    ? Buffer.concat(data, byteLength)
+                                    : Buffer.from(data);
+                            if (!this.msgPackSockets.has(socket) || !isMsgPackMessage(buffer)) {
+                                // Attachment chunks belong to an automation_response already counted by the rate limiter
+                                this.connectionManager.updateLastMessageTime();
+                                this.messageHandler.handleBinaryMessage(buffer);
+                                return;
+                            }
+                            this.log.debug(`[AutomationBridge Client] Received MessagePack message (${buffer.length} bytes)`);
+                            parsed = decodeMsgPack(buffer) as AutomationBridgeMessage;
+                        } else {
+                            const text = rawDataToUtf8String(data, byteLength);
+                            this.log.debug(`[AutomationBridge Client] Received message: ${text.substring(0, 1000)}`);
+                            parsed = JSON.parse(text) as AutomationBridgeMessage;
+                        }
                         
                         // Check rate limit BEFORE schema validation to prevent DoS via invalid messages
                         if (!this.connectionManager.recordInboundMessage(socket, false)) {
@@ -521,6 +558,7 @@ export class AutomationBridge extends EventEmitter {
 
                 if (!this.connectionManager.isConnected()) {
                     this.requestTracker.rejectAll(new Error(reason || 'Connection lost'));
+                    this.messageHandler.reset();
                 }
             }
         });
@@ -554,6 +592,7 @@ export class AutomationBridge extends EventEmitter {
         this.connectionManager.closeAll(1001, 'Server shutdown');
         this.lastHandshakeAck = undefined;
         this.requestTracker.rejectAll(new Error('Automation bridge server stopped'));
+        this.messageHandler.reset();
     }
 
     isConnected(): boolean {
@@ -937,6 +976,13 @@ export class AutomationBridge extends EventEmitter {
 
         if (this.send(message)) {
             this.requestTracker.updateLastRequestSentAt();
+            // A request we stopped waiting for (timeout, stalled progress) would
+            // otherwise keep running in the editor; ask it to drop or abort.
+            resultPromise.catch(() => {
+                if (this.isConnected()) {
+                    this.send({ type: 'cancel_request', requestId });
+                }
+            });
             return resultPromise;
         } else {
             this.requestTracker.rejectRequest(requestId, new Error('Failed to send request'));
@@ -968,7 +1014,7 @@ export class AutomationBridge extends EventEmitter {
             return false;
         }
         try {
-            primarySocket.send(JSON.stringify(payload));
+            primarySocket.send(this.encodeFor(primarySocket, payload));
             return true;
         } catch (error) {
             this.log.error('Failed to send automation message', error);
@@ -990,7 +1036,7 @@ export class AutomationBridge extends EventEmitter {
         for (const [socket] of sockets) {
             if (socket.readyState === WebSocket.OPEN) {
                 try {
-                    socket.send(JSON.stringify(payload));
+                    socket.send(this.encodeFor(socket, payload));
                     sentCount++;
                 } catch (error) {
                     this.log.error('Failed to broadcast automation message to socket', error);
@@ -1000,6 +1046,11 @@ export class AutomationBridge extends EventEmitter {
         return sentCount > 0;
     }
 
+    /** MessagePack goes out as a binary frame on sockets that negotiated it, JSON text otherwise */
+    private encodeFor(socket: WebSocket, payload: AutomationBridgeMessage): string | Buffer {
+        return this.msgPackSockets.has(socket) ? encodeMsgPack(payload) : JSON.stringify(payload);
+    }
+
     private emitAutomation<K extends keyof AutomationBridgeEvents>(
         event: K,
         ...args: Parameters<AutomationBridgeEvents[K]>
@@ -15,6 +15,8 @@ import { WebSocket } from 'ws';
 import { Logger } from '../utils/logger.js';
 import { AutomationBridgeMessage } from './types.js';
 import { bridgeAckSchema } from './message-schema.js';
+import { BINARY_ATTACHMENTS_CAPABILITY } from './attachments.js';
+import { MSGPACK_CAPABILITY } from './msgpack.js';
 import { EventEmitter } from 'node:events';
 
 /** Server version constant - update when releasing new versions */
@@ -102,7 +104,8 @@ export class HandshakeHandler extends EventEmitter {
     private readonly DEFAULT_HANDSHAKE_TIMEOUT_MS = 5000;
 
     constructor(
-        private capabilityToken?: string
+        private capabilityToken?: string,
+        private preferMsgPack = false
     ) {
         super();
     }
@@ -174,7 +177,10 @@ export class HandshakeHandler extends EventEmitter {
                 if (socket.readyState === WebSocket.OPEN) {
                     const helloPayload: AutomationBridgeMessage = {
                         type: 'bridge_hello',
-                        capabilityToken: this.capabilityToken || undefined
+                        capabilityToken: this.capabilityToken || undefined,
+                        capabilities: this.preferMsgPack
+                            ? [BINARY_ATTACHMENTS_CAPABILITY, MSGPACK_CAPABILITY]
+                            : [BINARY_ATTACHMENTS_CAPABILITY]
                     };
                     this.log.debug(`Sending bridge_hello (delayed): ${JSON.stringify(helloPayload)}`);
                     socket.send(JSON.stringify(helloPayload));
@@ -1,6 +1,13 @@
 import { Logger } from '../utils/logger.js';
 import { AutomationBridgeMessage, AutomationBridgeResponseMessage, ProgressUpdateMessage } from './types.js';
 import { RequestTracker } from './request-tracker.js';
+import {
+    AttachmentAssembler,
+    AttachmentDescriptor,
+    AutomationAttachment,
+    parseAttachmentChunk,
+    readAttachmentDescriptors
+} from './attachments.js';
 
 function FStringSafe(val: unknown): string {
     try {
@@ -31,6 +38,12 @@ interface EventMessage extends AutomationBridgeMessage {
     message?: string;
 }
 
+/** Response waiting for its binary attachments to arrive */
+interface HeldResponse {
+    response: AutomationBridgeResponseMessage;
+    descriptors: AttachmentDescriptor[];
+}
+
 /** Response with optional action field */
 interface ResponseWithAction extends AutomationBridgeResponseMessage {
     action?: string;
@@ -38,6 +51,8 @@ interface ResponseWithAction extends AutomationBridgeResponseMessage {
 
 export class MessageHandler {
     private log = new Logger('MessageHandler');
+    private attachments = new AttachmentAssembler();
+    private heldResponses = new Map<string, HeldResponse>();
 
     constructor(
         private requestTracker: RequestTracker
@@ -63,14 +78,61 @@ export class MessageHandler {
             case 'progress_update':
                 this.handleProgressUpdate(message as ProgressUpdateMessage);
                 break;
+            case 'cancel_response':
+                this.log.debug(`cancel_request for ${String(message.requestId)}: ${String(message.state)}`);
+                break;
             default:
                 this.log.debug('Received automation bridge message with no handler', message);
                 break;
         }
     }
 
-    private handleAutomationResponse(response: AutomationBridgeResponseMessage): void {
-        const requestId = response.requestId;
+    /**
+     * Handle a binary frame carrying an attachment chunk. Once every attachment
+     * listed by a held automation_response has arrived, the response is released.
+     */
+    public handleBinaryMessage(data: Buffer): void {
+        const chunk = parseAttachmentChunk(data);
+        if (!chunk) {
+            this.log.warn(`Dropped malformed binary frame (${data.length} bytes)`);
+            return;
+        }
+
+        let completedId: string | null;
+        try {
+            completedId = this.attachments.addChunk(chunk);
+        } catch (error) {
+            const err = error instanceof Error ? error : new Error(String(error));
+            this.log.warn(err.message);
+            for (const [requestId, held] of this.heldResponses) {
+                if (held.descriptors.some((d) => d.id === chunk.id)) {
+                    this.heldResponses.delete(requestId);
+                    this.attachments.discardRequest(requestId);
+                    this.requestTracker.rejectRequest(requestId, err);
+                }
+            }
+            return;
+        }
+
+        if (!completedId) return;
+
+        for (const [requestId, held] of this.heldResponses) {
+            if (!held.descriptors.some((d) => d.id === completedId)) continue;
+            if (!held.descriptors.every((d) => this.attachments.has(d.id))) return;
+            this.heldResponses.delete(requestId);
+            this.handleAutomationResponse(held.response);
+            return;
+        }
+    }
+
+    /** Drop held responses and partial attachments, e.g. when the socket closes */
+    public reset(): void {
+        this.heldResponses.clear();
+        this.attachments.clear();
+    }
+
+    private handleAutomationResponse(message: AutomationBridgeResponseMessage): void {
+        const requestId = message.requestId;
         if (!requestId) {
             this.log.warn('Received automation_response without requestId');
             return;
@@ -79,9 +141,19 @@ export class MessageHandler {
         const pending = this.requestTracker.getPendingRequest(requestId);
         if (!pending) {
             this.log.debug(`No pending automation request found for requestId=${requestId}`);
+            this.attachments.discardRequest(requestId);
             return;
         }
 
+        const descriptors = readAttachmentDescriptors(message.attachments);
+        if (descriptors.some((d) => !this.attachments.has(d.id))) {
+            this.heldResponses.set(requestId, { response: message, descriptors });
+            return;
+        }
+        const response = descriptors.length > 0
+            ? this.materializeAttachments(message, descriptors)
+            : message;
+
         // Enforce action match logic
         const enforcedResponse = this.enforceActionMatch(response, pending.action);
 
@@ -119,6 +191,32 @@ export class MessageHandler {
         }
     }
 
+    /**
+     * Claim reassembled attachments for a response: each attachment with a
+     * result field is inlined there as base64 (the same shape legacy peers
+     * receive), and the raw buffers are exposed on response.attachments.
+     */
+    private materializeAttachments(
+        response: AutomationBridgeResponseMessage,
+        descriptors: AttachmentDescriptor[]
+    ): AutomationBridgeResponseMessage {
+        const result: Record<string, unknown> = response.result && typeof response.result === 'object'
+            ? { ...(response.result as Record<string, unknown>) }
+            : {};
+        const attachments: AutomationAttachment[] = [];
+
+        for (const descriptor of descriptors) {
+            const data = this.attachments.take(descriptor.id);
+            if (!data) continue;
+            attachments.push({ ...descriptor, data });
+            if (descriptor.field) {
+                result[descriptor.field] = data.toString('base64');
+            }
+        }
+
+        return { ...response, result, attachments };
+    }
+
     private handleAutomationEvent(message: AutomationBridgeMessage): void {
         const evt = message as EventMessage;
         const reqId = typeof evt.requestId === 'string' ? evt.requestId : undefined;
@@ -126,6 +224,10 @@ export class MessageHandler {
         if (reqId) {
             const pending = this.requestTracker.getPendingRequest(reqId);
             if (pending) {
+                // e.g. attachments_failed: the held response's frames will never arrive
+                if (this.heldResponses.delete(reqId)) {
+                    this.attachments.discardRequest(reqId);
+                }
                 try {
                     const baseSuccess = (pending.initialResponse && typeof pending.initialResponse.success === 'boolean') ? pending.initialResponse.success : undefined;
                     const evtSuccess = (evt.result && typeof evt.result.success === 'boolean') ? !!evt.result.success : undefined;
@@ -148,6 +250,9 @@ export class MessageHandler {
             }
         }
 
+        // Streamed frames carry the whole image; don't dump them into the log.
+        if (evt.event === 'viewport_frame') return;
+
         this.log.debug('Received automation_event (no pending request):', message);
     }
 
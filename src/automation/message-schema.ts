@@ -31,7 +31,8 @@ export const bridgeAckSchema = z.object({
     supportedOpcodes: stringArray.optional(),
     expectedResponseOpcodes: stringArray.optional(),
     capabilities: stringArray.optional(),
-    heartbeatIntervalMs: z.number().optional()
+    heartbeatIntervalMs: z.number().optional(),
+    encoding: z.string().optional()
 }).passthrough();
 
 export const bridgeErrorSchema = z.object({
@@ -66,6 +67,15 @@ export const progressUpdateSchema = z.object({
     stillWorking: z.boolean().optional()  // True if operation is still in progress
 }).passthrough();
 
+// Reply to a cancel_request; state is dropped | signalled | completed | not_found
+export const cancelResponseSchema = z.object({
+    type: z.literal('cancel_response'),
+    requestId: z.string().min(1),
+    cancelled: z.boolean().optional(),
+    signalled: z.boolean().optional(),
+    state: z.string().optional()
+}).passthrough();
+
 export const automationMessageSchema = z.discriminatedUnion('type', [
     automationResponseSchema,
     automationEventSchema,
@@ -74,7 +84,8 @@ export const automationMessageSchema = z.discriminatedUnion('type', [
     bridgePingSchema,
     bridgePongSchema,
     bridgeGoodbyeSchema,
-    progressUpdateSchema
+    progressUpdateSchema,
+    cancelResponseSchema
 ]);
 
 export type AutomationMessageSchema = z.infer<typeof automationMessageSchema>;
@@ -0,0 +1,73 @@
+/**
+ * Unit tests for the MessagePack wire codec
+ */
+import { describe, it, expect } from 'vitest';
+import { decodeMsgPack, encodeMsgPack, isMsgPackMessage } from './msgpack.js';
+
+describe('encodeMsgPack / decodeMsgPack', () => {
+    it('round-trips a typical automation_request', () => {
+        const message = {
+            type: 'automation_request',
+            requestId: 'req-42',
+            action: 'control_actor',
+            payload: {
+                action: 'spawn',
+                count: 300,
+                negative: -70000,
+                ratio: 0.125,
+                enabled: true,
+                tags: ['a', 'b', ''],
+                nothing: null,
+                label: 'x'.repeat(40)
+            }
+        };
+        expect(decodeMsgPack(encodeMsgPack(message))).toEqual(message);
+    });
+
+    it('packs vectors, rotators and transforms as extension types', () => {
+        const location = { x: 1.5, y: -2, z: 1e9 };
+        const rotation = { pitch: 0, yaw: 90, roll: -45.25 };
+        const vector = encodeMsgPack(location);
+        expect(Array.from(vector.subarray(0, 3))).toEqual([0xc7, 24, 1]);
+        expect(vector.length).toBe(27);
+        expect(encodeMsgPack(rotation)[2]).toBe(2);
+
+        const transform = { location, rotation, scale: { x: 1, y: 1, z: 1 } };
+        const packed = encodeMsgPack({ transform });
+        expect(decodeMsgPack(packed)).toEqual({ transform });
+        expect(packed.includes(Buffer.from('pitch'))).toBe(false);
+    });
+
+    it('keeps objects that only resemble vectors as maps', () => {
+        const notVector = { x: 1, y: 2, z: 'three' };
+        const extraKey = { x: 1, y: 2, z: 3, w: 4 };
+        expect(isMsgPackMessage(encodeMsgPack(notVector))).toBe(true);
+        expect(decodeMsgPack(encodeMsgPack(extraKey))).toEqual(extraKey);
+    });
+
+    it('writes non-finite numbers as null like JSON.stringify', () => {
+        expect(decodeMsgPack(encodeMsgPack({ a: Number.NaN, b: Infinity }))).toEqual({ a: null, b: null });
+    });
+
+    it('rejects truncated and trailing input', () => {
+        const packed = encodeMsgPack({ type: 'automation_response', requestId: 'r' });
+        expect(() => decodeMsgPack(packed.subarray(0, packed.length - 1))).toThrow(/truncated/);
+        expect(() => decodeMsgPack(Buffer.concat([packed, Buffer.from([0xc0])]))).toThrow(/trailing/);
+    });
+
+    it('ignores __proto__ keys', () => {
+        // { "__proto__": 1 }
+        const frame = Buffer.from([0x81, 0xa9, ...Buffer.from('__proto__'), 0x01]);
+        const decoded = decodeMsgPack(frame) as Record<string, unknown>;
+        expect(Object.keys(decoded)).toEqual([]);
+        expect(Object.getPrototypeOf(decoded)).toBe(Object.prototype);
+    });
+});
+
+describe('isMsgPackMessage', () => {
+    it('distinguishes messages from attachment chunks', () => {
+        expect(isMsgPackMessage(encodeMsgPack({ type: 'bridge_pong' }))).toBe(true);
+        expect(isMsgPackMessage(Buffer.from('MCPA\x01', 'latin1'))).toBe(false);
+        expect(isMsgPackMessage(Buffer.alloc(0))).toBe(false);
+    });
+});
@@ -0,0 +1,361 @@
+/**
+ * MessagePack codec for automation_request / automation_response frames on a
+ * connection that negotiated the "msgpack" capability. Mirrors FMcpMessagePack
+ * in the plugin, including the extension types that carry vector-shaped
+ * objects as packed big-endian float64 components:
+ *   ext 1  { x, y, z }
+ *   ext 2  { pitch, yaw, roll }
+ *   ext 3  { location, rotation, scale }   (vector, rotator, vector)
+ * Attachment chunks share the binary opcode but start with "MCPA", which can
+ * never open a MessagePack map.
+ */
+
+/** Capability advertised in bridge_hello; the ack's encoding field confirms it */
+export const MSGPACK_CAPABILITY = 'msgpack';
+
+export type WireEncoding = 'json' | 'msgpack';
+
+const EXT_VECTOR = 1;
+const EXT_ROTATOR = 2;
+const EXT_TRANSFORM = 3;
+const MAX_DEPTH = 64;
+
+const VECTOR_KEYS = ['x', 'y', 'z'] as const;
+const ROTATOR_KEYS = ['pitch', 'yaw', 'roll'] as const;
+
+type Components = readonly [number, number, number];
+
+function readComponents(value: unknown, keys: readonly [string, string, string]): Components | null {
+    if (!value || typeof value !== 'object' || Array.isArray(value) || Buffer.isBuffer(value)) return null;
+    const record = value as Record<string, unknown>;
+    const ownKeys = Object.keys(record);
+    if (ownKeys.length !== 3) return null;
+    const a = record[keys[0]];
+    const b = record[keys[1]];
+    const c = record[keys[2]];
+    if (typeof a !== 'number' || typeof b !== 'number' || typeof c !== 'number') return null;
+    return [a, b, c];
+}
+
+function readTransform(value: unknown): number[] | null {
+    if (!value || typeof value !== 'object' || Array.isArray(value) || Buffer.isBuffer(value)) return null;
+    const record = value as Record<string, unknown>;
+    if (Object.keys(record).length !== 3) return null;
+    const location = readComponents(record.location, VECTOR_KEYS);
+    const rotation = readComponents(record.rotation, ROTATOR_KEYS);
+    const scale = readComponents(record.scale, VECTOR_KEYS);
+    if (!location || !rotation || !scale) return null;
+    return [...location, ...rotation, ...scale];
+}
+
+class Encoder {
+    private buffer = Buffer.allocUnsafe(1024);
+    private length = 0;
+
+    public finish(): Buffer {
+        return Buffer.from(this.buffer.subarray(0, this.length));
+    }
+
+    public write(value: unknown, depth = 0): void {
+        if (depth > MAX_DEPTH) throw new Error('MessagePack encode: nesting too deep');
+        if (value === null || value === undefined) {
+            this.byte(0xc0);
+        } else if (typeof value === 'boolean') {
+            this.byte(value ? 0xc3 : 0xc2);
+        } else if (typeof value === 'number') {
+            this.number(value);
+        } else if (typeof value === 'bigint') {
+            this.number(Number(value));
+        } else if (typeof value === 'string') {
+            this.string(value);
+        } else if (Buffer.isBuffer(value) || value instanceof Uint8Array) {
+            this.binary(value);
+        } else if (Array.isArray(value)) {
+            this.header(value.length, 0x90, 15, 0xdc, 0xdd);
+            for (const item of value) this.write(item, depth + 1);
+        } else if (typeof value === 'object') {
+            this.object(value as Record<string, unknown>, depth);
+        } else {
+            // Functions and symbols are dropped by JSON.stringify too
+            this.byte(0xc0);
+        }
+    }
+
+    private object(record: Record<string, unknown>, depth: number): void {
+        const vector = readComponents(record, VECTOR_KEYS);
+        if (vector) return this.extension(EXT_VECTOR, vector);
+        const rotator = readComponents(record, ROTATOR_KEYS);
+        if (rotator) return this.extension(EXT_ROTATOR, rotator);
+        const transform = readTransform(record);
+        if (transform) return this.extension(EXT_TRANSFORM, transform);
+
+        const entries = Object.entries(record).filter(([, v]) => v !== undefined);
+        this.header(entries.length, 0x80, 15, 0xde, 0xdf);
+        for (const [key, entry] of entries) {
+            this.string(key);
+            this.write(entry, depth + 1);
+        }
+    }
+
+    private extension(type: number, values: readonly number[]): void {
+        this.ensure(3 + values.length * 8);
+        this.buffer[this.length++] = 0xc7;
+        this.buffer[this.length++] = values.length * 8;
+        this.buffer[this.length++] = type;
+        for (const v of values) {
+            this.buffer.writeDoubleBE(v, this.length);
+            this.length += 8;
+        }
+    }
+
+    private number(value: number): void {
+        if (Number.isSafeInteger(value)) {
+            this.integer(value);
+            return;
+        }
+        if (!Number.isFinite(value)) {
+            // JSON.stringify turns NaN/Infinity into null
+            this.byte(0xc0);
+            return;
+        }
+        this.ensure(9);
+        this.buffer[this.length++] = 0xcb;
+        this.buffer.writeDoubleBE(value, this.length);
+        this.length += 8;
+    }
+
+    private integer(value: number): void {
+        this.ensure(9);
+        const b = this.buffer;
+        if (value >= 0) {
+            if (value <= 0x7f) {
+                b[this.length++] = value;
+            } else if (value <= 0xff) {
+                b[this.length++] = 0xcc;
+                b[this.length++] = value;
+            } else if (value <= 0xffff) {
+                b[this.length++] = 0xcd;
+                b.writeUInt16BE(value, this.length);
+                this.length += 2;
+            } else if (value <= 0xffffffff) {
+                b[this.length++] = 0xce;
+                b.writeUInt32BE(value, this.length);
+                this.length += 4;
+            } else {
+                b[this.length++] = 0xcf;
+                b.writeBigUInt64BE(BigInt(value), this.length);
+                this.length += 8;
+            }
+            return;
+        }
+        if (value >= -32) {
+            b[this.length++] = value & 0xff;
+        } else if (value >= -128) {
+            b[this.length++] = 0xd0;
+            b.writeInt8(value, this.length);
+            this.length += 1;
+        } else if (value >= -32768) {
+            b[this.length++] = 0xd1;
+            b.writeInt16BE(value, this.length);
+            this.length += 2;
+        } else if (value >= -2147483648) {
+            b[this.length++] = 0xd2;
+            b.writeInt32BE(value, this.length);
+            this.length += 4;
+        } else {
+            b[this.length++] = 0xd3;
+            b.writeBigInt64BE(BigInt(value), this.length);
+            this.length += 8;
+        }
+    }
+
+    private string(value: string): void {
+        const byteLength = Buffer.byteLength(value, 'utf8');
+        if (byteLength <= 31) {
+            this.ensure(1 + byteLength);
+            this.buffer[this.length++] = 0xa0 | byteLength;
+        } else {
+            this.header(byteLength, 0, 0, 0xda, 0xdb, 0xd9);
+            this.ensure(byteLength);
+        }
+        this.length += this.buffer.write(value, this.length, byteLength, 'utf8');
+    }
+
+    private binary(value: Uint8Array): void {
+        this.header(value.length, 0, 0, 0xc5, 0xc6, 0xc4);
+        this.ensure(value.length);
+        this.buffer.set(value, this.length);
+        this.length += value.length;
+    }
+
+    /** Fix form when length <= fixMax, else the 8 (if given) / 16 / 32-bit forms */
+    private header(length: number, fixBase: number, fixMax: number, marker16: number, marker32: number, marker8 = 0): void {
+        this.ensure(5);
+        const b = this.buffer;
+        if (fixBase !== 0 && length <= fixMax) {
+            b[this.length++] = fixBase | length;
+        } else if (marker8 !== 0 && length <= 0xff) {
+            b[this.length++] = marker8;
+            b[this.length++] = length;
+        } else if (length <= 0xffff) {
+            b[this.length++] = marker16;
+            b.writeUInt16BE(length, this.length);
+            this.length += 2;
+        } else {
+            b[this.length++] = marker32;
+            b.writeUInt32BE(length, this.length);
+            this.length += 4;
+        }
+    }
+
+    private byte(value: number): void {
+        this.ensure(1);
+        this.buffer[this.length++] = value;
+    }
+
+    private ensure(extra: number): void {
+        if (this.length + extra <= this.buffer.length) return;
+        let capacity = this.buffer.length * 2;
+        while (capacity < this.length + extra) capacity *= 2;
+        const grown = Buffer.allocUnsafe(capacity);
+        this.buffer.copy(grown, 0, 0, this.length);
+        this.buffer = grown;
+    }
+}
+
+class Decoder {
+    private offset = 0;
+
+    constructor(private readonly data: Buffer) { }
+
+    public get atEnd(): boolean {
+        return this.offset === this.data.length;
+    }
+
+    public read(depth = 0): unknown {
+        if (depth > MAX_DEPTH) this.fail('nesting too deep');
+        const marker = this.u8();
+
+        if (marker <= 0x7f) return marker;
+        if (marker >= 0xe0) return marker - 0x100;
+        if (marker >= 0xa0 && marker <= 0xbf) return this.str(marker & 0x1f);
+        if (marker >= 0x90 && marker <= 0x9f) return this.array(marker & 0x0f, depth);
+        if (marker >= 0x80 && marker <= 0x8f) return this.map(marker & 0x0f, depth);
+
+        switch (marker) {
+            case 0xc0: return null;
+            case 0xc2: return false;
+            case 0xc3: return true;
+            case 0xcc: return this.u8();
+            case 0xcd: return this.take(2).readUInt16BE(0);
+            case 0xce: return this.take(4).readUInt32BE(0);
+            case 0xcf: return Number(this.take(8).readBigUInt64BE(0));
+            case 0xd0: return this.take(1).readInt8(0);
+            case 0xd1: return this.take(2).readInt16BE(0);
+            case 0xd2: return this.take(4).readInt32BE(0);
+            case 0xd3: return Number(this.take(8).readBigInt64BE(0));
+            case 0xca: return this.take(4).readFloatBE(0);
+            case 0xcb: return this.take(8).readDoubleBE(0);
+            case 0xd9: return this.str(this.u8());
+            case 0xda: return this.str(this.take(2).readUInt16BE(0));
+            case 0xdb: return this.str(this.take(4).readUInt32BE(0));
+            case 0xc4: return Buffer.from(this.take(this.u8()));
+            case 0xc5: return Buffer.from(this.take(this.take(2).readUInt16BE(0)));
+            case 0xc6: return Buffer.from(this.take(this.take(4).readUInt32BE(0)));
+            case 0xdc: return this.array(this.take(2).readUInt16BE(0), depth);
+            case 0xdd: return this.array(this.take(4).readUInt32BE(0), depth);
+            case 0xde: return this.map(this.take(2).readUInt16BE(0), depth);
+            case 0xdf: return this.map(this.take(4).readUInt32BE(0), depth);
+            case 0xd4: return this.extension(1);
+            case 0xd5: return this.extension(2);
+            case 0xd6: return this.extension(4);
+            case 0xd7: return this.extension(8);
+            case 0xd8: return this.extension(16);
+            case 0xc7: return this.extension(this.u8());
+            case 0xc8: return this.extension(this.take(2).readUInt16BE(0));
+            case 0xc9: return this.extension(this.take(4).readUInt32BE(0));
+            default: return this.fail(`unsupported type marker 0x${marker.toString(16)}`);
+        }
+    }
+
+    private array(count: number, depth: number): unknown[] {
+        if (count > this.data.length - this.offset) this.fail('array longer than input');
+        const items = new Array<unknown>(count);
+        for (let i = 0; i < count; i++) items[i] = this.read(depth + 1);
+        return items;
+    }
+
+    private map(count: number, depth: number): Record<string, unknown> {
+        if (count * 2 > this.data.length - this.offset) this.fail('map longer than input');
+        const record: Record<string, unknown> = {};
+        for (let i = 0; i < count; i++) {
+            const key = this.read(depth + 1);
+            if (typeof key !== 'string') this.fail('map key is not a string');
+            // Plain data only; never let a payload reach Object.prototype
+            if (key === '__proto__') {
+                this.read(depth + 1);
+                continue;
+            }
+            record[key as string] = this.read(depth + 1);
+        }
+        return record;
+    }
+
+    private extension(length: number): unknown {
+        const type = this.take(1).readInt8(0);
+        const body = this.take(length);
+        const expected = type === EXT_TRANSFORM ? 72 : 24;
+        if ((type !== EXT_VECTOR && type !== EXT_ROTATOR && type !== EXT_TRANSFORM) || length !== expected) {
+            this.fail(`unknown extension type ${type}`);
+        }
+        const v = (index: number) => body.readDoubleBE(index * 8);
+        if (type === EXT_VECTOR) return { x: v(0), y: v(1), z: v(2) };
+        if (type === EXT_ROTATOR) return { pitch: v(0), yaw: v(1), roll: v(2) };
+        return {
+            location: { x: v(0), y: v(1), z: v(2) },
+            rotation: { pitch: v(3), yaw: v(4), roll: v(5) },
+            scale: { x: v(6), y: v(7), z: v(8) }
+        };
+    }
+
+    private str(length: number): string {
+        return this.take(length).toString('utf8');
+    }
+
+    private u8(): number {
+        return this.take(1)[0];
+    }
+
+    private take(length: number): Buffer {
+        if (this.offset + length > this.data.length) this.fail('truncated input');
+        const slice = this.data.subarray(this.offset, this.offset + length);
+        this.offset += length;
+        return slice;
+    }
+
+    private fail(reason: string): never {
+        throw new Error(`MessagePack decode: ${reason} at byte ${this.offset}`);
+    }
+}
+
+/** Encode a message (or any JSON-compatible value) */
+export function encodeMsgPack(value: unknown): Buffer {
+    const encoder = new Encoder();
+    encoder.write(value);
+    return encoder.finish();
+}
+
+/** Decode exactly one value; throws on malformed, truncated or trailing input */
+export function decodeMsgPack(data: Buffer): unknown {
+    const decoder = new Decoder(data);
+    const value = decoder.read();
+    if (!decoder.atEnd) throw new Error('MessagePack decode: trailing bytes after message');
+    return value;
+}
+
+/** True when the frame opens a MessagePack map, i.e. it is a message rather than an attachment chunk */
+export function isMsgPackMessage(frame: Buffer): boolean {
+    if (frame.length === 0) return false;
+    const first = frame[0];
+    return (first >= 0x80 && first <= 0x8f) || first === 0xde || first === 0xdf;
+}
@@ -0,0 +1,43 @@
+import { describe, it, expect } from 'vitest';
+import { isPackedArray, packArray, parseLayout, unpackArray } from './packed-array.js';
+
+describe('packed arrays', () => {
+    it('expands repeated and listed layouts', () => {
+        expect(parseLayout('f64x3')).toEqual(['f64', 'f64', 'f64']);
+        expect(parseLayout('f32,i32')).toEqual(['f32', 'i32']);
+        expect(() => parseLayout('f16x2')).toThrow(/Unsupported/);
+    });
+
+    it('round-trips vectors as little-endian doubles', () => {
+        const packed = packArray('f64x3', [[1, 2, 3], [-4.5, 0, 1e6]], 'Vector');
+        expect(packed).toMatchObject({ encoding: 'base64', elementType: 'Vector', count: 2 });
+        const bytes = Buffer.from(packed.data, 'base64');
+        expect(bytes.byteLength).toBe(48);
+        expect(bytes.readDoubleLE(8)).toBe(2);
+        expect(unpackArray(packed)).toEqual([[1, 2, 3], [-4.5, 0, 1e6]]);
+    });
+
+    it('keeps single-component arrays flat', () => {
+        const packed = packArray('f32', [0.5, 1.5, -2]);
+        expect(unpackArray(packed)).toEqual([0.5, 1.5, -2]);
+    });
+
+    it('packs byte components in declared order', () => {
+        const packed = packArray('u8x4', [[255, 128, 0, 1]]);
+        expect(Buffer.from(packed.data, 'base64')).toEqual(Buffer.from([255, 128, 0, 1]));
+    });
+
+    it('rejects elements with the wrong component count', () => {
+        expect(() => packArray('f64x3', [[1, 2]])).toThrow(/needs 3/);
+    });
+
+    it('rejects data that is not whole elements', () => {
+        expect(() => unpackArray({ encoding: 'base64', layout: 'f64', count: 1, data: Buffer.alloc(5).toString('base64') })).toThrow(/whole number/);
+    });
+
+    it('recognizes packed values', () => {
+        expect(isPackedArray(packArray('i32', [1]))).toBe(true);
+        expect(isPackedArray([1, 2, 3])).toBe(false);
+        expect(isPackedArray({ encoding: 'base64' })).toBe(false);
+    });
+});
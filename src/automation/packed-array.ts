@@ -0,0 +1,124 @@
+/**
+ * Packed numeric arrays as FMcpPackedArray in the plugin reads and writes
+ * them: elements back to back as little-endian components, base64-encoded.
+ *   { encoding: 'base64', elementType: 'Vector', layout: 'f64x3', count: 2, data: '...' }
+ * A layout is either one token repeated ("f64x3") or a comma list ("f32,i32").
+ * FTransform travels as f64x10: rotation x y z w, translation x y z, scale x y z.
+ */
+
+export interface PackedArray {
+    encoding: 'base64';
+    elementType?: string;
+    layout: string;
+    count: number;
+    data: string;
+}
+
+type ComponentType = 'f32' | 'f64' | 'i8' | 'i16' | 'i32' | 'i64' | 'u8' | 'u16' | 'u32' | 'u64';
+
+const COMPONENT_SIZES: Record<ComponentType, number> = {
+    f32: 4, f64: 8, i8: 1, i16: 2, i32: 4, i64: 8, u8: 1, u16: 2, u32: 4, u64: 8
+};
+
+function isComponentType(token: string): token is ComponentType {
+    return Object.prototype.hasOwnProperty.call(COMPONENT_SIZES, token);
+}
+
+/** Expands a layout string into one component type per element member. */
+export function parseLayout(layout: string): ComponentType[] {
+    const trimmed = layout.trim().toLowerCase();
+    const repeated = /^([a-z]\d+)x(\d+)$/.exec(trimmed);
+    const tokens = repeated
+        ? new Array<string>(Number(repeated[2])).fill(repeated[1])
+        : trimmed.split(',').map(token => token.trim());
+    if (tokens.length === 0 || !tokens.every(isComponentType)) {
+        throw new Error(`Unsupported packed layout '${layout}'`);
+    }
+    return tokens as ComponentType[];
+}
+
+function writeComponent(view: DataView, offset: number, type: ComponentType, value: number): void {
+    switch (type) {
+        case 'f32': view.setFloat32(offset, value, true); break;
+        case 'f64': view.setFloat64(offset, value, true); break;
+        case 'i8': view.setInt8(offset, value); break;
+        case 'i16': view.setInt16(offset, value, true); break;
+        case 'i32': view.setInt32(offset, value, true); break;
+        case 'i64': view.setBigInt64(offset, BigInt(Math.trunc(value)), true); break;
+        case 'u8': view.setUint8(offset, value); break;
+        case 'u16': view.setUint16(offset, value, true); break;
+        case 'u32': view.setUint32(offset, value, true); break;
+        case 'u64': view.setBigUint64(offset, BigInt(Math.trunc(value)), true); break;
+    }
+}
+
+function readComponent(view: DataView, offset: number, type: ComponentType): number {
+    switch (type) {
+        case 'f32': return view.getFloat32(offset, true);
+        case 'f64': return view.getFloat64(offset, true);
+        case 'i8': return view.getInt8(offset);
+        case 'i16': return view.getInt16(offset, true);
+        case 'i32': return view.getInt32(offset, true);
+        case 'i64': return Number(view.getBigInt64(offset, true));
+        case 'u8': return view.getUint8(offset);
+        case 'u16': return view.getUint16(offset, true);
+        case 'u32': return view.getUint32(offset, true);
+        case 'u64': return Number(view.getBigUint64(offset, true));
+    }
+}
+
+/**
+ * Packs elements for a set_object_property value. Each element is a tuple of
+ * components in layout order; single-component layouts also take bare numbers.
+ */
+export function packArray(layout: string, elements: ReadonlyArray<number | readonly number[]>, elementType?: string): PackedArray {
+    const types = parseLayout(layout);
+    const elementSize = types.reduce((sum, type) => sum + COMPONENT_SIZES[type], 0);
+    const bytes = Buffer.alloc(elementSize * elements.length);
+    const view = new DataView(bytes.buffer, bytes.byteOffset, bytes.byteLength);
+    let offset = 0;
+    elements.forEach((element, index) => {
+        const components = typeof element === 'number' ? [element] : element;
+        if (components.length !== types.length) {
+            throw new Error(`Element ${index} has ${components.length} components, layout '${layout}' needs ${types.length}`);
+        }
+        types.forEach((type, component) => {
+            writeComponent(view, offset, type, components[component]);
+            offset += COMPONENT_SIZES[type];
+        });
+    });
+    return {
+        encoding: 'base64',
+        ...(elementType ? { elementType } : {}),
+        layout,
+        count: elements.length,
+        data: bytes.toString('base64')
+    };
+}
+
+/** Unpacks into one tuple per element (bare numbers for single-component layouts). */
+export function unpackArray(packed: PackedArray): Array<number | number[]> {
+    const types = parseLayout(packed.layout);
+    const elementSize = types.reduce((sum, type) => sum + COMPONENT_SIZES[type], 0);
+    const bytes = Buffer.from(packed.data, 'base64');
+    if (bytes.byteLength % elementSize !== 0) {
+        throw new Error(`Packed data is ${bytes.byteLength} bytes, not a whole number of ${elementSize}-byte elements`);
+    }
+    const view = new DataView(bytes.buffer, bytes.byteOffset, bytes.byteLength);
+    const out: Array<number | number[]> = [];
+    for (let offset = 0; offset < bytes.byteLength;) {
+        const components = types.map(type => {
+            const value = readComponent(view, offset, type);
+            offset += COMPONENT_SIZES[type];
+            return value;
+        });
+        out.push(types.length === 1 ? components[0] : components);
+    }
+    return out;
+}
+
+export function isPackedArray(value: unknown): value is PackedArray {
+    if (!value || typeof value !== 'object' || Array.isArray(value)) return false;
+    const record = value as Record<string, unknown>;
+    return record.encoding === 'base64' && typeof record.layout === 'string' && typeof record.data === 'string';
+}
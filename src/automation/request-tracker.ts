@@ -72,14 +72,15 @@ export class RequestTracker {
                 }
             }, timeoutMs);
 
-            // Set up absolute timeout cap to prevent indefinite extension
+            // Set up absolute timeout cap to prevent indefinite extension; a caller that asked
+            // for longer than the cap (a tracked build, say) gets its own timeout as the cap
+            const totalMs = Math.max(ABSOLUTE_MAX_TIMEOUT_MS, timeoutMs);
             const absoluteTimeout = setTimeout(() => {
                 if (this.pendingRequests.has(requestId)) {
                     this.pendingRequests.delete(requestId);
-                    const totalMs = ABSOLUTE_MAX_TIMEOUT_MS;
                     reject(new Error(`Request ${requestId} exceeded absolute max timeout (${totalMs}ms)`));
                 }
-            }, ABSOLUTE_MAX_TIMEOUT_MS);
+            }, totalMs);
 
             this.pendingRequests.set(requestId, {
                 resolve,
@@ -97,7 +98,8 @@ export class RequestTracker {
                 lastProgressPercent: undefined,
                 staleCount: 0,
                 absoluteTimeout,
-                totalExtensionMs: 0
+                totalExtensionMs: 0,
+                longJobDeadline: timeoutMs > ABSOLUTE_MAX_TIMEOUT_MS ? Date.now() + timeoutMs : undefined
             });
         });
 
@@ -110,6 +112,9 @@ export class RequestTracker {
      * 1. Max extensions limit (MAX_PROGRESS_EXTENSIONS)
      * 2. Stale detection (percent unchanged for PROGRESS_STALE_THRESHOLD updates)
      * 3. Absolute max timeout cap (ABSOLUTE_MAX_TIMEOUT_MS)
+     *
+     * A request created with a timeout beyond the cap set its own budget, so until that runs
+     * out its updates are only recorded: they neither shorten nor count as extensions.
      * 
      * @param requestId - The request ID to extend
      * @param percent - Current progress percent (0-100)
@@ -122,6 +127,12 @@ export class RequestTracker {
             return false;
         }
 
+        if (pending.longJobDeadline !== undefined && Date.now() + PROGRESS_EXTENSION_MS < pending.longJobDeadline) {
+            pending.lastProgressPercent = percent;
+            pending.staleCount = 0;
+            return true;
+        }
+
         // Check 1: Max extensions limit
         if (pending.extensionCount !== undefined && pending.extensionCount >= MAX_PROGRESS_EXTENSIONS) {
             pending.reject(new Error(
@@ -16,6 +16,10 @@ export interface AutomationBridgeOptions {
     maxInboundMessagesPerMinute?: number;
     maxInboundAutomationRequestsPerMinute?: number;
     useTls?: boolean;
+    /** Offer permessage-deflate (RFC 7692) to the plugin. Default: true. */
+    perMessageDeflate?: boolean;
+    /** Ask the plugin for MessagePack frames instead of JSON text. Default: 'json'. */
+    wireEncoding?: 'json' | 'msgpack';
     clientMode?: boolean;
     clientHost?: string;
     clientPort?: number;
@@ -111,6 +115,8 @@ export interface PendingRequest {
     staleCount?: number;
     absoluteTimeout?: NodeJS.Timeout;
     totalExtensionMs?: number;
+    /** Epoch ms a request given a timeout above the absolute cap may run until. */
+    longJobDeadline?: number;
 }
 
 /**
@@ -32,7 +32,13 @@ export const PROGRESS_EXTENSION_MS = 30000;          // Extend by 30s on each pr
 export const MAX_PROGRESS_EXTENSIONS = 10;           // Max times timeout can be extended (prevents deadlock)
 export const PROGRESS_STALE_THRESHOLD = 3;           // Stale updates before timeout (percent unchanged)
 export const ABSOLUTE_MAX_TIMEOUT_MS = 300000;       // 5 minute hard cap (even with extensions)
+// Tracked lighting builds reply when Lightmass finishes; uncapped nightly bakes pass timeoutSeconds
+export const LIGHTING_BUILD_TIMEOUT_SECONDS = 3600;
 
 // Message size limits
 export const MAX_WS_MESSAGE_SIZE_BYTES = 5 * 1024 * 1024;
+// permessage-deflate: messages below this size are sent uncompressed
+export const DEFAULT_PERMESSAGE_DEFLATE_THRESHOLD_BYTES = 1024;
+// Binary attachments are chunked below the message cap; this bounds reassembly
+export const MAX_ATTACHMENT_SIZE_BYTES = 256 * 1024 * 1024;
 
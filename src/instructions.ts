@@ -57,16 +57,16 @@ This server controls a live Unreal Editor instance. All 40 tools use an **action
 - \`manage_character\` — \`create_character_blueprint\`, \`setup_movement\`, \`set_walk_speed\`, \`set_jump_height\`, \`configure_crouch\`, \`configure_sprint\`, \`get_character_info\`
 
 **Visual Effects & Audio**
-- \`manage_effect\` — \`create_niagara_system\`, \`create_niagara_emitter\`, \`spawn_niagara\`, \`add_niagara_module\`, \`set_niagara_parameter\`, \`activate\`, \`deactivate\`, \`get_niagara_info\`
+- \`manage_effect\` — \`create_niagara_system\`, \`create_niagara_emitter\`, \`build_niagara_system\` (whole effect from one spec, one compile), \`spawn_niagara\`, \`add_niagara_module\`, \`set_niagara_parameter\`, \`activate\`, \`deactivate\`, \`get_niagara_info\`
 - \`manage_lighting\` — \`spawn_light\`, \`create_sky_light\`, \`setup_global_illumination\`, \`configure_shadows\`, \`set_exposure\`, \`build_lighting\`, \`list_light_types\`
-- \`manage_audio\` — \`play_sound_at_location\`, \`play_sound_2d\`, \`create_sound_cue\`, \`create_ambient_sound\`, \`create_metasound\`, \`get_audio_info\`
+- \`manage_audio\` — \`play_sound_at_location\`, \`play_sound_2d\`, \`create_sound_cue\`, \`create_ambient_sound\`, \`create_metasound\`, \`build_metasound_graph\` (whole graph from one spec), \`import_sound_waves\` (bulk import job), \`get_audio_info\`
 
 **UI**
-- \`manage_widget_authoring\` — \`create_widget_blueprint\`, \`add_canvas_panel\`, \`add_text_block\`, \`add_image\`, \`add_button\`, \`add_progress_bar\`, \`set_anchor\`, \`set_position\`, \`set_size\`, \`create_hud_widget\`, \`preview_widget\`, \`get_widget_info\`
+- \`manage_widget_authoring\` — \`create_widget_blueprint\`, \`build_widget_tree\` (whole tree from one nested spec, one compile), \`add_canvas_panel\`, \`add_text_block\`, \`add_image\`, \`add_button\`, \`add_progress_bar\`, \`set_anchor\`, \`set_position\`, \`set_size\`, \`create_hud_widget\`, \`preview_widget\`, \`get_widget_info\`
 - \`manage_input\` — \`create_input_action\`, \`create_input_mapping_context\`, \`add_mapping\`, \`map_input_action\`, \`get_input_info\`
 
 **Gameplay Systems**
-- \`manage_gas\` — \`add_ability_system_component\`, \`create_attribute_set\`, \`create_gameplay_ability\`, \`create_gameplay_effect\`, \`create_gameplay_cue_notify\`, \`get_gas_info\`
+- \`manage_gas\` — \`add_ability_system_component\`, \`create_attribute_set\`, \`create_gameplay_ability\`, \`create_gameplay_effect\`, \`create_gameplay_cue_notify\`, \`get_gas_info\`, \`import_gas_table\` (bulk attributes/effects from rows or CSV)
 - \`manage_combat\` — \`create_weapon_blueprint\`, \`setup_damage_type\`, \`configure_hit_detection\`, \`apply_damage\`, \`heal\`, \`get_combat_info\`
 - \`manage_ai\` — \`create_ai_controller\`, \`create_behavior_tree\`, \`create_blackboard\`, \`setup_perception\`, \`run_behavior_tree\`, \`set_blackboard_value\`, \`get_ai_info\`
 - \`manage_behavior_tree\` — \`create\`, \`add_node\`, \`connect_nodes\`, \`remove_node\`, \`set_node_properties\`
@@ -79,7 +79,7 @@ This server controls a live Unreal Editor instance. All 40 tools use an **action
 
 **Geometry & Splines**
 - \`manage_geometry\` — \`create_box\`, \`create_sphere\`, \`create_cylinder\`, \`boolean_union\`, \`boolean_subtract\`, \`extrude\`, \`bevel\`, \`mirror\`, \`convert_to_static_mesh\`, \`get_mesh_info\`
-- \`manage_splines\` — \`create_spline_actor\`, \`add_spline_point\`, \`create_spline_mesh_component\`, \`create_road_spline\`, \`scatter_meshes_along_spline\`, \`get_splines_info\`
+- \`manage_splines\` — \`create_spline_actor\`, \`add_spline_point\`, \`set_spline_points\` (bulk/packed), \`create_spline_mesh_component\`, \`create_road_spline\`, \`scatter_meshes_along_spline\`, \`get_splines_info\`
 
 **Sequences**
 - \`manage_sequence\` — Level Sequencer tracks, keyframes, playback
@@ -88,13 +88,13 @@ This server controls a live Unreal Editor instance. All 40 tools use an **action
 - \`manage_navigation\` — \`configure_nav_mesh_settings\`, \`rebuild_navigation\`, \`create_nav_modifier_component\`, \`create_nav_link_proxy\`, \`get_navigation_info\`
 
 **Performance & Testing**
-- \`manage_performance\` — \`start_profiling\`, \`stop_profiling\`, \`run_benchmark\`, \`show_fps\`, \`generate_memory_report\`, \`set_scalability\`, \`configure_nanite\`
+- \`manage_performance\` — \`start_profiling\`, \`stop_profiling\`, \`run_benchmark\`, \`show_fps\`, \`generate_memory_report\`, \`memory_snapshot\`, \`set_scalability\`, \`configure_nanite\`
 - \`manage_tests\` — \`list_tests\`, \`run_test\`, \`run_all_tests\`, \`run_tests_by_filter\`, \`get_test_results\`
 
 **Closed-Loop Autonomy** (Sprint 7)
 - \`validate\` — \`assert_blueprint_compiles\`, \`assert_map_clean\`, \`assert_no_missing_references\`, \`assert_naming_conventions\`, \`assert_performance_budget\`, \`run_validation_suite\`, \`get_validation_report\`, \`set_acceptance_criteria\`, \`get_acceptance_criteria\`
 - \`checkpoint\` — \`create_checkpoint\`, \`list_checkpoints\`, \`diff_checkpoint\`, \`restore_checkpoint\`, \`delete_checkpoint\`, \`begin_transaction\`, \`commit_transaction\`, \`rollback_transaction\`
-- \`observe\` — \`query_logs\`, \`get_log_summary\`, \`start_playtest\`, \`capture_snapshot\`, \`stop_playtest\`, \`get_playtest_report\`, \`run_scenario\`, \`get_runtime_state\`
+- \`observe\` — \`query_logs\`, \`get_log_summary\`, \`start_playtest\`, \`capture_snapshot\`, \`stop_playtest\`, \`get_playtest_report\`, \`run_scenario\`, \`get_runtime_state\`, \`subscribe_runtime_telemetry\`, \`unsubscribe_runtime_telemetry\`
 - \`source_control\` — \`status\`, \`checkpoint\` (commit), \`revert\`, \`changed_since\`, \`lock\`, \`unlock\`, \`change_summary\`
 
 **System & Orchestration**
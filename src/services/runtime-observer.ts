@@ -6,6 +6,7 @@
  * - Viewport screenshots at intervals
  * - Scene stats / performance metrics
  * - Player state snapshots
+ * - Pushed runtime telemetry (subscribe_runtime_telemetry)
  *
  * Provides a structured timeline the agent can reason about.
  *
@@ -19,6 +20,7 @@ const logger = new Logger('RuntimeObserver');
 const MAX_LOG_BUFFER = 500;
 const MAX_EVENTS = 200;
 const MAX_SNAPSHOTS = 50;
+const MAX_TELEMETRY_PUSHES = 120;
 
 export type EventSeverity = 'fatal' | 'error' | 'warning' | 'info' | 'verbose';
 
@@ -73,6 +75,30 @@ export interface PlaytestReport {
     verdict: 'clean' | 'warnings_only' | 'errors_found' | 'fatal';
 }
 
+/**
+ * One runtime_telemetry push from the plugin, in its compact form: frame-time
+ * components are [mean, p50, p95, max] microseconds over the window, and the
+ * state sections (mem, obj, pie, player) only appear when they changed.
+ */
+export interface RuntimeTelemetryPush {
+    id: number;
+    seq: number;
+    t: number;
+    n: number;
+    miss?: number;
+    fps: number;
+    us: Record<string, number[]>;
+    hitch?: number;
+    peakMb?: number;
+    mem?: number[];
+    obj?: number[];
+    pie?: boolean[];
+    player?: Record<string, unknown> | null;
+    full?: boolean;
+}
+
+const TELEMETRY_STATE_KEYS = ['mem', 'obj', 'pie', 'player'] as const;
+
 class RuntimeObserver {
     private logBuffer: RuntimeLogEntry[] = [];
     private events: RuntimeEvent[] = [];
@@ -80,6 +106,9 @@ class RuntimeObserver {
     private activeSession: PlaytestSession | null = null;
     private pastSessions: PlaytestSession[] = [];
     private maxPastSessions = 5;
+    private telemetryPushes: RuntimeTelemetryPush[] = [];
+    private telemetryState: Record<string, unknown> = {};
+    private telemetryReceivedAt: string | null = null;
 
     // --- Log Buffer ---
 
@@ -111,7 +140,10 @@ class RuntimeObserver {
     /**
      * Ingest multiple log entries from a parsed log file.
      */
-    ingestLogs(entries: Array<{ timestamp?: string; category?: string; level?: string; message?: string }>): number {
+    ingestLogs(
+        entries: Array<{ timestamp?: string; category?: string; level?: string; message?: string }>,
+        source: 'stream' | 'disk' = 'disk'
+    ): number {
         let count = 0;
         for (const e of entries) {
             const severity = this.parseSeverity(e.level || 'Log');
@@ -120,7 +152,7 @@ class RuntimeObserver {
                 category: e.category || 'Unknown',
                 severity,
                 message: e.message || '',
-                source: 'disk',
+                source,
             });
             count++;
         }
@@ -208,6 +240,50 @@ class RuntimeObserver {
         return this.events.slice(-count);
     }
 
+    // --- Runtime Telemetry ---
+
+    /**
+     * Ingest a runtime_telemetry push. State sections carry absolute values,
+     * so merging the ones present yields the current state.
+     */
+    addTelemetry(push: RuntimeTelemetryPush): void {
+        if (push.full) this.telemetryState = {};
+        for (const key of TELEMETRY_STATE_KEYS) {
+            if (key in push) this.telemetryState[key] = push[key];
+        }
+        this.telemetryPushes.push(push);
+        if (this.telemetryPushes.length > MAX_TELEMETRY_PUSHES) {
+            this.telemetryPushes.splice(0, this.telemetryPushes.length - MAX_TELEMETRY_PUSHES);
+        }
+        this.telemetryReceivedAt = new Date().toISOString();
+    }
+
+    /**
+     * Latest pushed telemetry: the last window, the merged state and a short
+     * history of fps / p95 frame time. Null before the first push.
+     */
+    getTelemetry(historyCount = 20): Record<string, unknown> | null {
+        const latest = this.telemetryPushes[this.telemetryPushes.length - 1];
+        if (!latest) return null;
+        return {
+            receivedAt: this.telemetryReceivedAt,
+            latest,
+            state: this.telemetryState,
+            history: this.telemetryPushes.slice(-historyCount).map((p) => ({
+                t: p.t,
+                fps: p.fps,
+                frameP95Us: p.us?.frame?.[2],
+                hitch: p.hitch ?? 0,
+            })),
+        };
+    }
+
+    clearTelemetry(): void {
+        this.telemetryPushes = [];
+        this.telemetryState = {};
+        this.telemetryReceivedAt = null;
+    }
+
     // --- Playtest Sessions ---
 
     /**
@@ -388,6 +464,7 @@ class RuntimeObserver {
         this.logBuffer = [];
         this.events = [];
         this.activeSession = null;
+        this.clearTelemetry();
         logger.info('Runtime observer cleared');
     }
 
@@ -407,6 +484,7 @@ class RuntimeObserver {
                 eventCount: this.activeSession.events.length,
             } : null,
             pastSessionCount: this.pastSessions.length,
+            telemetryPushes: this.telemetryPushes.length,
         };
     }
 }
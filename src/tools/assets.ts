@@ -114,7 +114,7 @@ export class AssetTools extends BaseTool implements IAssetTools {
     }, 'manage_asset', { timeoutMs: params.timeoutMs || EXTENDED_ASSET_OP_TIMEOUT_MS });
   }
 
-  async searchAssets(params: { classNames?: string[]; packagePaths?: string[]; recursivePaths?: boolean; recursiveClasses?: boolean; limit?: number }): Promise<StandardActionResponse> {
+  async searchAssets(params: { classNames?: string[]; packagePaths?: string[]; recursivePaths?: boolean; recursiveClasses?: boolean; limit?: number; pageSize?: number; cursor?: string; fields?: string[] }): Promise<StandardActionResponse> {
     // Normalize package paths if provided
     const packagePaths = params.packagePaths
       ? params.packagePaths.map(p => this.normalizeAssetPath(p))
@@ -204,7 +204,7 @@ export class AssetTools extends BaseTool implements IAssetTools {
     }, 'manage_asset', { timeoutMs: DEFAULT_ASSET_OP_TIMEOUT_MS });
   }
 
-  async getDependencies(params: { assetPath: string; recursive?: boolean }): Promise<StandardActionResponse> {
+  async getDependencies(params: { assetPath: string; recursive?: boolean; maxDepth?: number; direction?: 'dependencies' | 'referencers'; dependencyType?: 'all' | 'hard' | 'soft'; pathPrefix?: string; offset?: number; limit?: number }): Promise<StandardActionResponse> {
     // get_dependencies is typically an asset query or managed asset action?
     // HandleAssetAction has 'get_dependencies' dispatch.
     return this.sendRequest<AssetResponse>('manage_asset', {
@@ -103,7 +103,7 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
             'list', 'import', 'duplicate', 'duplicate_asset', 'rename', 'rename_asset', 'move', 'move_asset', 'delete', 'delete_asset', 'delete_assets', 'create_folder', 'search_assets',
             'get_dependencies', 'get_source_control_state', 'analyze_graph', 'get_asset_graph', 'create_thumbnail', 'set_tags', 'get_metadata', 'set_metadata', 'validate', 'fixup_redirectors', 'find_by_tag', 'generate_report',
             'create_material', 'create_material_instance', 'create_render_target', 'generate_lods', 'add_material_parameter', 'list_instances', 'reset_instance_parameters', 'exists', 'get_material_stats',
-            'nanite_rebuild_mesh', 'bulk_rename', 'bulk_delete', 'source_control_checkout', 'source_control_submit',
+            'nanite_rebuild_mesh', 'bulk_build_meshes', 'bulk_rename', 'bulk_delete', 'source_control_checkout', 'source_control_submit',
             'add_material_node', 'connect_material_pins', 'remove_material_node', 'break_material_connections', 'get_material_node_details', 'rebuild_material',
             'dump_asset'
           ],
@@ -116,6 +116,9 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         recursivePaths: commonSchemas.booleanProp,
         recursiveClasses: commonSchemas.booleanProp,
         limit: commonSchemas.numberProp,
+        pageSize: { type: 'number', description: 'search_assets: results per page; larger result sets return a nextCursor' },
+        cursor: { type: 'string', description: 'search_assets: nextCursor from the previous page' },
+        fields: { type: 'array', items: { type: 'string' }, description: 'search_assets: fields per asset (name, path, class, packagePath, packageName, tag:<TagName>)' },
         sourcePath: commonSchemas.sourcePath,
         destinationPath: commonSchemas.destinationPath,
         assetPaths: commonSchemas.arrayOfStrings,
@@ -159,6 +162,12 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         parentNodeId: commonSchemas.nodeId,
         childNodeId: commonSchemas.nodeId,
         maxDepth: commonSchemas.numberProp,
+        // Dependency queries (get_dependencies)
+        recursive: commonSchemas.booleanProp,
+        direction: { type: 'string', enum: ['dependencies', 'referencers'], description: 'get_dependencies: follow what the asset uses, or what uses it' },
+        dependencyType: { type: 'string', enum: ['all', 'hard', 'soft'], description: 'get_dependencies: which package dependencies to follow' },
+        pathPrefix: { type: 'string', description: 'get_dependencies: only list and walk packages under this path' },
+        offset: { type: 'number', description: 'get_dependencies: index of the first result to return' },
         // Bulk operations (C++ TryGetStringField)
         prefix: commonSchemas.stringProp,
         suffix: commonSchemas.stringProp,
@@ -170,6 +179,12 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         checkoutFiles: commonSchemas.booleanProp,
         // Bulk delete
         showConfirmation: commonSchemas.booleanProp,
+        // Bulk mesh builds (bulk_build_meshes: assetPaths and/or folderPath, plus lodCount)
+        enableNanite: { type: 'boolean', description: 'bulk_build_meshes: enable or disable Nanite; omit to leave Nanite settings unchanged' },
+        preserveArea: commonSchemas.booleanProp,
+        trianglePercent: { type: 'number', description: 'bulk_build_meshes: Nanite triangles kept, 0-100' },
+        fallbackPercent: { type: 'number', description: 'bulk_build_meshes: Nanite fallback triangles, 0-100' },
+        batchSize: { type: 'number', description: 'bulk_build_meshes: meshes building at once (default 32)' },
         // Material graph operations
         pinName: commonSchemas.pinName,
         desc: commonSchemas.stringProp,
@@ -231,7 +246,7 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
             'add_component', 'set_default', 'modify_scs', 'get_scs', 'add_scs_component', 'remove_scs_component', 'reparent_scs_component', 'set_scs_transform', 'set_scs_property',
             'ensure_exists', 'probe_handle', 'add_variable', 'remove_variable', 'rename_variable', 'add_function', 'add_event', 'remove_event', 'add_construction_script', 'set_variable_metadata', 'set_metadata',
             'create_node', 'add_node', 'delete_node', 'connect_pins', 'break_pin_links', 'set_node_property', 'create_reroute_node', 'get_node_details', 'get_graph_details', 'get_pin_details',
-            'list_node_types', 'set_pin_default_value'
+            'list_node_types', 'set_pin_default_value', 'edit_session', 'compile_blueprints'
           ],
           description: 'Blueprint action'
         },
@@ -312,7 +327,18 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         fromPinName: commonSchemas.sourcePin,
         toNodeId: commonSchemas.targetNodeId,
         toPin: commonSchemas.targetPin,
-        toPinName: commonSchemas.targetPin
+        toPinName: commonSchemas.targetPin,
+        // Edit sessions
+        edits: {
+          type: 'array',
+          items: { type: 'object' },
+          description: 'edit_session: ordered edits applied with one compile and save at the end. Graph edits are { action: "create_node" | "connect_pins" | ..., ...params }; other edits are { action: "<bridge action, e.g. blueprint_add_variable>", payload: {...} }. blueprintPath is filled in when an edit omits it.'
+        },
+        stopOnError: { type: 'boolean', description: 'edit_session: stop at the first failed edit (the applied edits are still compiled).' },
+        // Multi-Blueprint compile
+        blueprintPaths: { type: 'array', items: { type: 'string' }, description: 'compile_blueprints: Blueprints to compile in one dependency-ordered pass.' },
+        folderPath: { type: 'string', description: 'compile_blueprints: also compile every Blueprint under this folder.' },
+        recursive: { type: 'boolean', description: 'compile_blueprints: include subfolders of folderPath (default true).' }
       },
       required: ['action']
     },
@@ -342,7 +368,7 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         action: {
           type: 'string',
           enum: [
-            'spawn', 'spawn_actor', 'spawn_blueprint',
+            'spawn', 'spawn_actor', 'spawn_blueprint', 'spawn_actors_bulk',
             'delete', 'destroy_actor', 'delete_by_tag', 'duplicate',
             'apply_force',
             'set_transform', 'teleport_actor', 'set_actor_location', 'set_actor_rotation', 'set_actor_scale', 'set_actor_transform',
@@ -381,7 +407,30 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         newName: commonSchemas.newName,
         tag: commonSchemas.tagName,
         variables: commonSchemas.objectProp,
-        snapshotName: commonSchemas.stringProp
+        snapshotName: commonSchemas.stringProp,
+        // Actor listing (list / find_by_class)
+        className: { type: 'string', description: 'list / find_by_class: only actors of this class or a subclass.' },
+        filter: { type: 'string', description: 'list: substring of the label, name or path.' },
+        dataLayer: { type: 'string', description: 'list / find_by_class: only actors in this data layer (UE 5.1+).' },
+        bounds: { type: 'object', description: 'list / find_by_class: only actors located inside { min: [x, y, z], max: [x, y, z] }.' },
+        fields: {
+          type: 'array',
+          items: { type: 'string', enum: ['name', 'label', 'path', 'class', 'location', 'rotation', 'scale', 'transform', 'tags', 'folder', 'level', 'dataLayers', 'hidden', 'bounds'] },
+          description: 'list / find_by_class: members written per actor.'
+        },
+        limit: { type: 'number', description: 'list / find_by_class: actors per page (list defaults to 50).' },
+        cursor: { type: 'string', description: 'list / find_by_class: nextCursor of the previous page.' },
+        // Bulk placement (spawn_actors_bulk)
+        transforms: {
+          description: 'spawn_actors_bulk: array of { location, rotation, scale }, or a packed f64x10/f32x10 block (quat xyzw, translation, scale).'
+        },
+        locations: {
+          description: 'spawn_actors_bulk: array of [x, y, z], or a packed f64x3/f32x3 block.'
+        },
+        labelPrefix: { type: 'string', description: 'spawn_actors_bulk: labels become <prefix>_<n>, continuing past existing ones.' },
+        folder: { type: 'string', description: 'spawn_actors_bulk: World Outliner folder for the new actors.' },
+        tags: commonSchemas.arrayOfStrings,
+        mobility: { type: 'string', enum: ['static', 'stationary', 'movable'], description: 'spawn_actors_bulk: root component mobility.' }
       },
       required: ['action']
     },
@@ -437,7 +486,7 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
             'show_stats', 'hide_stats',
             'set_editor_mode', 'set_immersive_mode', 'set_game_view',
             'undo', 'redo', 'save_all',
-            'capture_viewport'
+            'capture_viewport', 'subscribe_viewport_stream', 'unsubscribe_viewport_stream'
           ],
           description: 'Editor action'
         },
@@ -476,7 +525,11 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         axis: commonSchemas.stringProp,
         // capture_viewport parameters
         format: { type: 'string', enum: ['jpeg', 'png'], description: 'Image format for capture_viewport (default: jpeg)' },
-        quality: { type: 'number', minimum: 1, maximum: 100, description: 'JPEG quality for capture_viewport (1-100, default: 85)' }
+        quality: { type: 'number', minimum: 1, maximum: 100, description: 'JPEG quality for capture_viewport (1-100, default: 85)' },
+        // subscribe_viewport_stream parameters
+        fps: { type: 'number', minimum: 0.1, maximum: 30, description: 'Frame rate cap for subscribe_viewport_stream (default: 5)' },
+        onlyOnChange: { type: 'boolean', description: 'subscribe_viewport_stream: only push frames that differ from the last one sent (default: true)' },
+        maxInFlight: { type: 'integer', minimum: 1, maximum: 4, description: 'subscribe_viewport_stream: captures in flight before frames are dropped (default: 2)' }
       },
       required: ['action']
     },
@@ -505,7 +558,7 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
           type: 'string',
           enum: [
             'load', 'save', 'save_as', 'save_level_as', 'stream', 'unload', 'create_level', 'create_light', 'build_lighting',
-            'set_metadata', 'load_cells', 'set_datalayer', 'create_datalayer',
+            'set_metadata', 'load_cells', 'unload_cells', 'get_loaded_cells', 'set_datalayer', 'create_datalayer',
             'export_level', 'import_level', 'list_levels', 'get_summary', 'delete', 'delete_level', 'validate_level',
             'cleanup_invalid_datalayers', 'add_sublevel', 'rename_level', 'duplicate_level', 'get_current_level'
           ],
@@ -549,6 +602,18 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         max: commonSchemas.location,
         origin: commonSchemas.location,
         extent: commonSchemas.extent,
+        // Region loading
+        regions: {
+          type: 'array',
+          items: { type: 'object' },
+          description: 'load_cells: regions loaded in this order, like a streaming source moving through them: [{ name?, origin, extent } | { name?, min, max }]. The response arrives once all are resident, with progress per region.'
+        },
+        keepBehind: { type: 'number', description: 'load_cells: regions of this sweep kept loaded behind the current one; older ones are unloaded (0 = keep all).' },
+        maxLoadedRegions: { type: 'number', description: 'load_cells: cap on regions the bridge keeps loaded; least recently used are unloaded first.' },
+        maxMemoryMB: { type: 'number', description: 'load_cells: unload least recently used regions while used physical memory exceeds this.' },
+        regionNames: { type: 'array', items: { type: 'string' }, description: 'unload_cells: regions to unload (default all loaded by load_cells).' },
+        timeoutSeconds: { type: 'number', description: 'load_cells / build_lighting: give up after this many seconds (default no limit).' },
+        waitForCompletion: { type: 'boolean', description: 'build_lighting: reply when the build ends with its stats, streaming the stage as progress (default true).' },
         // Level creation
         template: commonSchemas.stringProp,
         useWorldPartition: commonSchemas.booleanProp,
@@ -591,7 +656,7 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
             'create_landscape', 'sculpt', 'sculpt_landscape', 'add_foliage', 'paint_foliage',
             'create_procedural_terrain', 'create_procedural_foliage', 'add_foliage_instances',
             'get_foliage_instances', 'remove_foliage', 'paint_landscape', 'paint_landscape_layer',
-            'modify_heightmap', 'set_landscape_material', 'create_landscape_grass_type',
+            'modify_heightmap', 'get_heightmap_region', 'set_landscape_material', 'create_landscape_grass_type',
             'generate_lods', 'bake_lightmap', 'export_snapshot', 'import_snapshot', 'delete',
             'create_sky_sphere', 'set_time_of_day', 'create_fog_volume'
           ],
@@ -599,7 +664,12 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         },
         name: commonSchemas.name,
         landscapeName: commonSchemas.stringProp,
-        heightData: commonSchemas.arrayOfNumbers,
+        heightData: {
+          oneOf: [commonSchemas.arrayOfNumbers, commonSchemas.objectProp],
+          description: 'Heights (0-65535) row-major over minX..maxX / minY..maxY, or a packed { encoding: "base64", layout: "u16", count, data } block.'
+        },
+        operation: { type: 'string', enum: ['set', 'raise', 'lower', 'flatten'], description: 'modify_heightmap: how heightData is applied (default set)' },
+        skipFlush: commonSchemas.booleanProp,
         minX: commonSchemas.numberProp,
         minY: commonSchemas.numberProp,
         maxX: commonSchemas.numberProp,
@@ -619,6 +689,10 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         strength: commonSchemas.numberProp,
         falloff: commonSchemas.numberProp,
         brushSize: commonSchemas.numberProp,
+        stroke: {
+          oneOf: [commonSchemas.arrayOfObjects, commonSchemas.objectProp],
+          description: 'sculpt / paint_landscape_layer: dabs applied in one edit: [{ location, radius?, strength?, falloff? }] or a packed f32x6 / f64x6 block (x y z radius strength falloff). Use spacing to interpolate dabs along the polyline.'
+        },
         layerName: commonSchemas.stringProp,
         eraseMode: commonSchemas.booleanProp,
         actorName: commonSchemas.actorName,
@@ -631,23 +705,46 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         cullDistance: commonSchemas.numberProp,
         alignToNormal: commonSchemas.booleanProp,
         randomYaw: commonSchemas.booleanProp,
-        locations: { type: 'array', items: commonSchemas.location },
-        transforms: {
-          type: 'array',
-          items: {
-            type: 'object',
-            properties: {
-              location: commonSchemas.location,
-              rotation: commonSchemas.rotation,
-              scale: commonSchemas.scale
-            }
-          }
+        locations: {
+          oneOf: [
+            { type: 'array', items: commonSchemas.location },
+            commonSchemas.objectProp
+          ],
+          description: 'Instance locations, or a packed array { encoding: "base64", layout: "f32x3" | "f64x3", count, data } for large scatters.'
         },
+        transforms: {
+          oneOf: [
+            {
+              type: 'array',
+              items: {
+                type: 'object',
+                properties: {
+                  location: commonSchemas.location,
+                  rotation: commonSchemas.rotation,
+                  scale: commonSchemas.scale
+                }
+              }
+            },
+            commonSchemas.objectProp
+          ],
+          description: 'add_foliage_instances: transforms, or a packed array with layout "f64x10" / "f32x10" (rotation quat x y z w, translation x y z, scale x y z).'
+        },
+        minDistance: { type: 'number', description: 'Drop instances closer than this to an existing or earlier instance of the same foliage type.' },
+        box: { type: 'object', description: 'get_foliage_instances: region { min, max } or { center, extent }' },
+        sphere: { type: 'object', description: 'get_foliage_instances: region { center, radius }' },
+        frustum: { type: 'object', description: 'get_foliage_instances: view region { origin, rotation, fov (deg, horizontal), aspectRatio, near, far }' },
+        countOnly: { type: 'boolean', description: 'get_foliage_instances: return totalCount and countsByType only' },
+        pageSize: { type: 'number', description: 'get_foliage_instances: instances per page (default 5000, max 100000)' },
+        cursor: { type: 'string', description: 'get_foliage_instances: nextCursor from the previous page' },
+        format: { type: 'string', enum: ['json', 'packed'], description: 'get_foliage_instances: "packed" returns transforms as an f64x10 binary attachment' },
         position: commonSchemas.location,
         bounds: commonSchemas.objectProp,
         volumeName: commonSchemas.stringProp,
         seed: commonSchemas.numberProp,
         foliageTypes: commonSchemas.arrayOfObjects,
+        mode: { type: 'string', enum: ['spawner', 'scatter'], description: 'create_procedural_foliage: "scatter" places instances directly with tiled Poisson-disc sampling (per type: density, minDistance, minScale, maxScale, maxSlope, alignToNormal, randomYaw, zOffset)' },
+        landscapeOnly: { type: 'boolean', description: 'create_procedural_foliage scatter: only place on landscapes' },
+        parallel: { type: 'boolean', description: 'create_procedural_foliage scatter: run tiles on worker threads (default true; results are identical either way)' },
         // Additional handler-used params
         quadsPerSection: commonSchemas.numberProp,
         enableWorldPartition: commonSchemas.booleanProp,
@@ -673,7 +770,9 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         heightScale: commonSchemas.numberProp,
         material: commonSchemas.materialPath,
         hour: commonSchemas.numberProp,
-        intensity: commonSchemas.numberProp
+        intensity: commonSchemas.numberProp,
+        waitForCompletion: { type: 'boolean', description: 'bake_lightmap: reply when the build ends with its stats, streaming the stage as progress (default true).' },
+        timeoutSeconds: { type: 'number', description: 'bake_lightmap: stop waiting for the build after this many seconds (default no limit; the client waits an hour).' }
       },
       required: ['action']
     },
@@ -711,7 +810,7 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
             'create_ik_rig', 'add_ik_chain', 'setup_ik',
             'create_pose_library',
             'create_animation_asset', 'create_animation_sequence',
-            'set_sequence_length', 'add_bone_track', 'set_bone_key', 'set_curve_key',
+            'set_sequence_length', 'add_bone_track', 'set_bone_key', 'set_curve_key', 'set_bone_tracks',
             'create_montage', 'add_montage_section', 'add_montage_slot',
             'set_section_timing', 'add_montage_notify', 'set_blend_in', 'set_blend_out',
             'link_sections', 'add_notify', 'play_montage', 'play_anim_montage',
@@ -742,6 +841,18 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         notifyName: commonSchemas.stringProp,
         boneName: commonSchemas.boneName,
         curveName: commonSchemas.stringProp,
+        tracks: {
+          type: 'array',
+          items: commonSchemas.objectProp,
+          description: 'set_bone_tracks: [{ boneName, positions?, rotations?, scales? }], each a flat number array (or packed f32/f64 block) with one key per frame from 0 (positions/scales x,y,z; rotations x,y,z,w or pitch,yaw,roll). A single key holds for the whole track; a missing channel keeps the reference pose.'
+        },
+        curves: {
+          type: 'array',
+          items: commonSchemas.objectProp,
+          description: 'set_bone_tracks: [{ curveName, values, frames? }] float curve keys; frames defaults to 0..N-1.'
+        },
+        rotationFormat: { type: 'string', enum: ['quat', 'euler'], description: 'Packed rotation layout for set_bone_tracks.' },
+        resizeToKeys: { type: 'boolean', description: 'set_bone_tracks: change the sequence length to match the track key count.' },
         stateName: commonSchemas.stringProp,
         machineName: commonSchemas.stringProp,
         transitionName: commonSchemas.stringProp,
@@ -841,10 +952,17 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         key: commonSchemas.stringProp,
         value: commonSchemas.stringProp,
         configName: commonSchemas.stringProp,
+        categories: { ...commonSchemas.arrayOfStrings, description: 'subscribe: stream only these log categories' },
+        excludeCategories: { ...commonSchemas.arrayOfStrings, description: 'subscribe: log categories to drop' },
+        minVerbosity: { type: 'string', description: 'subscribe: least severe log level kept (Error, Warning, Display, Log, Verbose)' },
+        contains: { type: 'string', description: 'subscribe: keep log lines containing this text' },
+        caseSensitive: { type: 'boolean', description: 'subscribe: match contains case-sensitively' },
+        regex: { type: 'string', description: 'subscribe: keep log lines matching this regular expression' },
+        cursor: { type: 'number', description: 'subscribe: replay buffered lines from this log cursor' },
         script_type: {
           type: 'string',
           enum: ['python', 'console_batch', 'editor_utility'],
-          description: 'Type of script to execute (for execute_script action). python: Execute Python script via editor Python plugin. console_batch: Execute multiple console commands separated by newlines. editor_utility: Run an Editor Utility Blueprint/Widget by asset path.'
+          description: 'Type of script to execute (for execute_script action). python: Execute Python script via editor Python plugin. console_batch: Execute multiple console commands separated by newlines, spread across editor frames, returning per-command results (output, timing, handled). editor_utility: Run an Editor Utility Blueprint/Widget by asset path.'
         },
         script_content: {
           type: 'string',
@@ -858,6 +976,10 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
           type: 'number',
           description: 'Execution timeout in seconds (default: 30, max: 300).'
         },
+        stop_on_error: {
+          type: 'boolean',
+          description: 'console_batch: stop at the first command the engine does not handle (default false).'
+        },
         dry_run: {
           type: 'boolean',
           description: 'If true, validate the script without executing it (for execute_script action).'
@@ -892,7 +1014,7 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
           enum: [
             'create', 'open', 'add_camera', 'add_actor', 'add_actors', 'remove_actors',
             'get_bindings', 'play', 'pause', 'stop', 'set_playback_speed', 'add_keyframe',
-            'get_properties', 'set_properties', 'duplicate', 'rename', 'delete', 'list', 'get_metadata', 'set_metadata',
+            'add_keyframes', 'get_properties', 'set_properties', 'duplicate', 'rename', 'delete', 'list', 'get_metadata', 'set_metadata',
             'add_spawnable_from_class', 'add_track', 'add_section', 'set_display_rate', 'set_tick_resolution',
             'set_work_range', 'set_view_range', 'set_track_muted', 'set_track_solo', 'set_track_locked',
             'list_tracks', 'remove_track', 'list_track_types'
@@ -929,7 +1051,23 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         lengthInFrames: commonSchemas.numberProp,
         playbackStart: commonSchemas.numberProp,
         playbackEnd: commonSchemas.numberProp,
-        metadata: commonSchemas.objectProp
+        metadata: commonSchemas.objectProp,
+        // Bulk keyframes
+        bindingId: { type: 'string', description: 'add_keyframes: binding GUID, instead of actorName.' },
+        type: { type: 'string', enum: ['float', 'double', 'bool', 'transform'], description: 'add_keyframes: track type (default transform for property "Transform", else float).' },
+        timeUnit: { type: 'string', enum: ['frames', 'seconds', 'ticks'], description: 'add_keyframes: unit of times (default frames at the display rate).' },
+        times: {
+          description: 'add_keyframes: key times shared by channels that omit their own; an array of numbers or a packed { encoding: "base64", layout: "f64" | "f32", count, data } block.'
+        },
+        values: {
+          description: 'add_keyframes: values of a single-channel track; an array or a packed f64 / f32 (u8 for bool) block.'
+        },
+        interpolation: { type: 'string', enum: ['cubic', 'linear', 'constant'], description: 'add_keyframes: interpolation of new keys (default cubic, auto tangents).' },
+        channels: {
+          type: 'array',
+          items: { type: 'object' },
+          description: 'add_keyframes: [{ channel: "location.x" | "rotation.yaw" | "scale.z" | 0-8 (transform only), times?, values, interpolation?, interpolations?: string[] }]. Keys at an existing time replace it.'
+        }
       },
       required: ['action']
     },
@@ -1074,7 +1212,9 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
             'add_cue_node', 'connect_cue_nodes', 'set_cue_attenuation', 'set_cue_concurrency',
             // MetaSound authoring
             'create_metasound', 'add_metasound_node', 'connect_metasound_nodes',
-            'add_metasound_input', 'add_metasound_output', 'set_metasound_default',
+            'add_metasound_input', 'add_metasound_output', 'set_metasound_default', 'build_metasound_graph',
+            // Bulk import
+            'import_sound_waves',
             // Sound class/mix authoring
             'set_class_properties', 'set_class_parent', 'add_mix_modifier', 'configure_mix_eq',
             // Attenuation authoring
@@ -1148,7 +1288,37 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         defaultValue: commonSchemas.value,
         metasoundNodeType: commonSchemas.stringProp,
         soundClassPath: commonSchemas.soundClassPath,
-        parentClassPath: commonSchemas.parentClassPath
+        parentClassPath: commonSchemas.parentClassPath,
+        inputs: {
+          type: 'array',
+          items: { type: 'object' },
+          description: 'build_metasound_graph: graph inputs [{ name, type? (default Float), default? }]; inputs the graph already has are kept.'
+        },
+        outputs: {
+          type: 'array',
+          items: { type: 'object' },
+          description: 'build_metasound_graph: graph outputs [{ name, type? (default Audio) }].'
+        },
+        nodes: {
+          type: 'array',
+          items: { type: 'object' },
+          description: 'build_metasound_graph: nodes [{ id, className | nodeType, majorVersion?, defaults?: { inputPin: value } }].'
+        },
+        connections: {
+          type: 'array',
+          items: { type: 'object' },
+          description: 'build_metasound_graph: edges [{ from: "node.pin", to: "node.pin" }] (or fromNode/fromPin/toNode/toPin); a node is a spec node id or a graph input/output name, whose pin may be omitted.'
+        },
+        files: {
+          type: 'array',
+          description: 'import_sound_waves: source files as paths or { sourcePath, destinationPath?, name? }.'
+        },
+        sourceDirectory: { type: 'string', description: 'import_sound_waves: import every .wav/.ogg/.flac/.aif(f) file under this folder, mirroring subfolders.' },
+        recursive: { type: 'boolean', description: 'import_sound_waves: include subfolders of sourceDirectory (default: true).' },
+        destinationPath: { type: 'string', description: 'import_sound_waves: content folder for the new sound waves (default: /Game/Audio/Imported).' },
+        replaceExisting: { type: 'boolean', description: 'import_sound_waves: reimport over existing assets instead of skipping them (default: false).' },
+        compress: { type: 'boolean', description: 'import_sound_waves: start building compressed audio for the running platform on worker threads (default: true).' },
+        batchSize: { type: 'number', description: 'import_sound_waves: assets created per editor tick (default: 100).' }
       },
       required: ['action']
     },
@@ -1157,7 +1327,16 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
       properties: {
         ...commonSchemas.outputBase,
         assetPath: commonSchemas.assetPath,
-        nodeId: commonSchemas.nodeId
+        nodeId: commonSchemas.nodeId,
+        nodes: { type: 'object', description: 'build_metasound_graph: spec node id to created node GUID.' },
+        edgesCreated: commonSchemas.numberProp,
+        warnings: { type: 'array', items: { type: 'string' } },
+        imported: { type: 'number', description: 'import_sound_waves: sound waves created.' },
+        files: {
+          type: 'array',
+          items: { type: 'object' },
+          description: 'import_sound_waves: per file { sourcePath, status (imported, exists, failed), assetPath?, error?, numChannels?, sampleRate?, duration? }.'
+        }
       }
     }
   },
@@ -1263,6 +1442,8 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         fogHeight: commonSchemas.numberProp,
         buildOnlySelected: commonSchemas.booleanProp,
         buildReflectionCaptures: commonSchemas.booleanProp,
+        waitForCompletion: { type: 'boolean', description: 'build_lighting: reply when the build ends with its stats, streaming the stage as progress (default true).' },
+        timeoutSeconds: { type: 'number', description: 'build_lighting: stop waiting for the build after this many seconds (default no limit; the client waits an hour).' },
         levelName: commonSchemas.stringProp,
         copyActors: commonSchemas.booleanProp,
         useTemplate: commonSchemas.booleanProp,
@@ -1295,7 +1476,7 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         action: {
           type: 'string',
           enum: [
-            'start_profiling', 'stop_profiling', 'run_benchmark', 'show_fps', 'show_stats', 'generate_memory_report',
+            'start_profiling', 'stop_profiling', 'run_benchmark', 'show_fps', 'show_stats', 'generate_memory_report', 'memory_snapshot',
             'set_scalability', 'set_resolution_scale', 'set_vsync', 'set_frame_rate_limit', 'enable_gpu_timing',
             'configure_texture_streaming', 'configure_lod', 'apply_baseline_settings', 'optimize_draw_calls', 'merge_actors',
             'configure_occlusion_culling', 'optimize_shaders', 'configure_nanite', 'configure_world_partition'
@@ -1330,7 +1511,31 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         maxPixelsPerEdge: commonSchemas.numberProp,
         streamingPoolSize: commonSchemas.numberProp,
         streamingDistance: commonSchemas.numberProp,
-        cellSize: commonSchemas.numberProp
+        cellSize: commonSchemas.numberProp,
+        // run_benchmark harness (PIE when a session is running, else the level viewport)
+        warmup: { type: 'number', description: 'run_benchmark: seconds played before sampling (default 3); duration is the sampled seconds (default 60).' },
+        cameraPath: {
+          type: 'array',
+          items: { type: 'object', properties: { location: commonSchemas.location, rotation: commonSchemas.rotation } },
+          description: 'run_benchmark: camera keys spread evenly over pathSeconds and interpolated each frame.'
+        },
+        pathSeconds: { type: 'number', description: 'run_benchmark: seconds to traverse cameraPath (default duration).' },
+        loopPath: { type: 'boolean', description: 'run_benchmark: loop cameraPath when it ends (default true).' },
+        sequencePath: { type: 'string', description: 'run_benchmark: Level Sequence played (looping) for its camera cuts; needs a PIE session.' },
+        hitchThresholdMs: { type: 'number', description: 'run_benchmark: frames at least this long count as hitches (default 50).' },
+        histogramMs: { type: 'array', items: { type: 'number' }, description: 'run_benchmark: frame-time histogram bucket edges (default 8.33, 11.11, 16.67, 33.33, 50, 100).' },
+        csvProfile: { type: 'boolean', description: 'run_benchmark: also record a CSV profile of the sampled frames.' },
+        saveBaseline: { type: ['string', 'boolean'], description: 'run_benchmark: store this run as the named baseline for the map (true = "default").' },
+        baseline: { type: 'string', description: 'run_benchmark: compare against this stored baseline of the map.' },
+        regressionThresholdPct: { type: 'number', description: 'run_benchmark: percentile slowdown that counts as a regression (default 10).' },
+        minDeltaMs: { type: 'number', description: 'run_benchmark: ignore slowdowns smaller than this many ms (default 0.5).' },
+        failOnRegression: { type: 'boolean', description: 'run_benchmark: reply with PERF_REGRESSION instead of success when regressed.' },
+        // memory_snapshot: structured per-class memory, returns an id to diff later snapshots against
+        topN: { type: 'number', description: 'memory_snapshot: classes listed in top and diff.classes (default 50).' },
+        sortBy: { type: 'string', enum: ['bytes', 'count'], description: 'memory_snapshot: order classes by resource bytes or object count (default bytes).' },
+        budgetMs: { type: 'number', description: 'memory_snapshot: game-thread ms spent walking objects per frame (default 4).' },
+        resourceSizeMode: { type: 'string', enum: ['exclusive', 'estimatedTotal'], description: 'memory_snapshot: GetResourceSizeEx mode (default exclusive).' },
+        diffWith: { type: 'string', description: 'memory_snapshot: id of an earlier snapshot (e.g. "mem-1") to diff against.' }
       },
       required: ['action']
     },
@@ -1371,7 +1576,7 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
             'bend', 'twist', 'taper', 'noise_deform', 'smooth', 'relax',
             'stretch', 'spherify', 'cylindrify',
             'triangulate', 'poke',
-            'mirror', 'array_linear', 'array_radial',
+            'mirror', 'array_linear', 'array_radial', 'bake_instances',
             'simplify_mesh', 'subdivide', 'remesh_uniform', 'merge_vertices', 'remesh_voxel',
             'weld_vertices', 'fill_holes', 'remove_degenerates',
             'auto_uv', 'project_uv', 'transform_uvs', 'unwrap_uv', 'pack_uv_islands',
@@ -1379,7 +1584,8 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
             'generate_collision', 'generate_complex_collision', 'simplify_collision',
             'generate_lods', 'set_lod_settings', 'set_lod_screen_sizes', 'convert_to_nanite',
             'convert_to_static_mesh',
-            'get_mesh_info'
+            'get_mesh_info', 'get_mesh_buffers', 'set_mesh_buffers',
+            'pipeline'
           ],
           description: 'Geometry action to perform'
         },
@@ -1446,7 +1652,31 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         createAsset: { type: 'boolean', description: 'Create as persistent asset.' },
         overwrite: commonSchemas.overwrite,
         save: commonSchemas.save,
-        enableNanite: { type: 'boolean', description: 'Enable Nanite for the output mesh.' }
+        enableNanite: { type: 'boolean', description: 'Enable Nanite for the output mesh.' },
+        operations: {
+          type: 'array',
+          items: commonSchemas.objectProp,
+          description: 'pipeline: ordered steps such as { op: "extrude", distance: 10 }, applied to actorName\'s mesh and committed once. Supported ops: extrude, inset, outset, bevel, recalculate_normals, flip_normals, simplify_mesh, subdivide, auto_uv, smooth, weld_vertices, fill_holes, remove_degenerates, remesh_uniform, boolean_union, boolean_subtract, boolean_intersection (with toolActor).'
+        },
+        buffers: {
+          type: 'array',
+          items: { type: 'string', enum: ['positions', 'normals', 'uvs', 'colors', 'triangles'] },
+          description: 'get_mesh_buffers: buffers to read, returned as packed little-endian arrays (binary attachments when supported). Default: positions.'
+        },
+        bufferData: {
+          type: 'object',
+          description: 'set_mesh_buffers: map of buffer name (positions, normals, uvs, colors) to a packed array { encoding: "base64", layout, count, data } of f32x3/f32x3/f32x2/f32x4 values.'
+        },
+        start: { type: 'number', description: 'get/set_mesh_buffers: first vertex ID of the range (default 0).' },
+        count: { type: 'number', description: 'Copies for array_linear, array_radial and duplicate_along_spline; vertex IDs to read for get_mesh_buffers (default: to maxVertexId).' },
+        outputMode: {
+          type: 'string',
+          enum: ['merge', 'instances'],
+          description: 'array_linear, array_radial, duplicate_along_spline: "merge" bakes copies into the mesh (default); "instances" adds an instanced static mesh component with one transform per copy (up to 10000). Use bake_instances to merge them later.'
+        },
+        instanceMesh: { type: 'string', description: 'outputMode "instances": StaticMesh asset to instance. Default: a snapshot of actorName\'s mesh under /Game/GeneratedMeshes.' },
+        hierarchical: { type: 'boolean', description: 'outputMode "instances": use a hierarchical (HISM) component (default true).' },
+        componentName: { type: 'string', description: 'bake_instances: instance component to bake. Default: every component added by outputMode "instances".' }
       },
       required: ['action']
     },
@@ -1494,7 +1724,7 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
             'create_virtual_bone',
             'create_socket', 'configure_socket',
             'auto_skin_weights', 'set_vertex_weights',
-            'normalize_weights', 'prune_weights',
+            'normalize_weights', 'prune_weights', 'upload_skin_data',
             'copy_weights', 'mirror_weights',
             'create_physics_asset',
             'add_physics_body', 'configure_physics_body',
@@ -1529,6 +1759,18 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         vertexIndices: { type: 'array', items: commonSchemas.numberProp, description: 'Array of vertex indices.' },
         weights: { type: 'array', items: commonSchemas.objectProp, description: 'Array of {boneIndex, weight} pairs.' },
         threshold: { type: 'number', description: 'Weight threshold for pruning (0-1).' },
+        skinWeights: {
+          type: 'object',
+          description: 'upload_skin_data weights: { vertexIndices, boneIndices, boneWeights, influencesPerVertex } with influencesPerVertex bone/weight pairs per vertex; each buffer a number array or packed block (i32/u16 indices, f32 weights).'
+        },
+        morphTargets: {
+          type: 'array',
+          items: commonSchemas.objectProp,
+          description: 'upload_skin_data morphs: [{ morphTargetName, vertexIndices, positionDeltas, tangentDeltas? }], deltas as x,y,z per vertex (number array or packed f32x3). Missing morph targets are created.'
+        },
+        normalize: { type: 'boolean', description: 'upload_skin_data: normalize each vertex\'s weights to 1 (default true).' },
+        pruneThreshold: { type: 'number', description: 'upload_skin_data: drop influences at or below this weight (default 0).' },
+        lodIndex: { type: 'number', description: 'LOD to edit (default 0).' },
         mirrorAxis: { type: 'string', enum: ['X', 'Y', 'Z'], description: 'Axis for weight mirroring.' },
         mirrorTable: { type: 'object', description: 'Bone name mapping for mirroring.' },
         bodyType: { type: 'string', enum: ['Capsule', 'Sphere', 'Box', 'Convex', 'Sphyl'], description: 'Physics body shape type.' },
@@ -1612,7 +1854,7 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
             'create_landscape_material', 'create_decal_material', 'create_post_process_material',
             'add_landscape_layer', 'configure_layer_blend',
             'compile_material', 'get_material_info',
-            'create_complete_material'
+            'create_complete_material', 'edit_session', 'bulk_set_instance_parameters'
           ],
           description: 'Material authoring action to perform. Use create_complete_material to create a full material with expressions and connections in a single call.'
         },
@@ -1685,6 +1927,22 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         layerName: commonSchemas.layerName,
         blendType: { type: 'string', enum: ['LB_WeightBlend', 'LB_AlphaBlend', 'LB_HeightBlend'], description: 'Landscape layer blend type.' },
         layers: { type: 'array', items: commonSchemas.objectProp, description: 'Array of layer configurations for layer blend.' },
+        // Edit sessions and shader compile tracking
+        edits: {
+          type: 'array',
+          items: { type: 'object' },
+          description: 'edit_session: ordered expression edits applied with one recompile and save at the end, e.g. { action: "add_math_node", operation: "Multiply" }. Fields use the bridge names (subAction payload fields); assetPath is filled in when an edit omits it.'
+        },
+        stopOnError: { type: 'boolean', description: 'edit_session: stop at the first failed edit (the applied edits are still recompiled).' },
+        instances: {
+          type: 'array',
+          items: { type: 'object' },
+          description: 'bulk_set_instance_parameters: rows { assetPath, parameters: [{ name, type?: "scalar"|"vector"|"texture", value }] }; type is inferred from value (number, {r,g,b,a} or [r,g,b,a], texture path).'
+        },
+        assetPaths: { type: 'array', items: { type: 'string' }, description: 'bulk_set_instance_parameters: instances that all receive `parameters`.' },
+        parameters: { type: 'array', items: { type: 'object' }, description: 'bulk_set_instance_parameters: { name, type?, value } entries applied to every instance (an instance row overrides the same name).' },
+        waitForShaders: { type: 'boolean', description: 'compile_material/edit_session: reply once the shaders finish compiling, with progress updates meanwhile (default false: reply once the compile is submitted).' },
+        timeoutSeconds: { type: 'number', description: 'compile_material/edit_session: longest wait for shaders with waitForShaders (default 300).' },
         save: commonSchemas.save
       },
       required: ['action']
@@ -1731,6 +1989,7 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
             'create_normal_from_height', 'create_ao_from_mesh',
             'resize_texture', 'adjust_levels', 'adjust_curves', 'blur', 'sharpen',
             'invert', 'desaturate', 'channel_pack', 'channel_extract', 'combine_textures',
+            'texture_pipeline',
             'set_compression_settings', 'set_texture_group', 'set_lod_bias',
             'configure_virtual_texture', 'set_streaming_priority',
             'get_texture_info'
@@ -1789,6 +2048,12 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         sharpenType: { type: 'string', enum: ['UnsharpMask', 'Laplacian'], description: 'Type of sharpening.' },
         channel: { type: 'string', enum: ['All', 'Red', 'Green', 'Blue', 'Alpha'], description: 'Target channel.' },
         invertAlpha: { type: 'boolean', description: 'Whether to invert alpha channel.' },
+        ops: {
+          type: 'array',
+          items: commonSchemas.objectProp,
+          description: 'texture_pipeline: ops run in order on one locked mip, e.g. [{op:"blur",radius:4,blurType:"Gaussian"},{op:"adjust_levels",gamma:1.2},{op:"swizzle",mapping:"BGRA"}]. Ops: blur, sharpen, adjust_levels, adjust_curves, desaturate, invert, swizzle (mapping lists the source of output R,G,B,A from R,G,B,A,0,1).'
+        },
+        inPlace: { type: 'boolean', description: 'texture_pipeline: modify the texture itself (default true) or write name/path.' },
         amount: { type: 'number', description: 'Effect amount (0-1 for desaturate).' },
         method: { type: 'string', enum: ['Luminance', 'Average', 'Lightness'], description: 'Desaturation method.' },
         outputAsGrayscale: { type: 'boolean', description: 'Output extracted channel as grayscale.' },
@@ -1823,6 +2088,8 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         neverStream: { type: 'boolean', description: 'Disable texture streaming.' },
         streamingPriority: { type: 'number', description: 'Streaming priority (-1 to 1, lower = higher priority).' },
         hdr: { type: 'boolean', description: 'Create HDR texture (16-bit float).' },
+        format: { type: 'string', enum: ['BGRA8', 'G8', 'G16', 'RGBA16F'], description: 'Pixel format of generated noise, gradient and pattern textures (default BGRA8; overrides hdr).' },
+        generateMips: { type: 'boolean', description: 'Generate a box-filtered mip chain for generated textures.' },
         save: commonSchemas.save
       },
       required: ['action']
@@ -1878,7 +2145,7 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
             'advance_simulation', 'add_niagara_module', 'connect_niagara_pins',
             'remove_niagara_node', 'set_niagara_parameter', 'clear_debug_shapes', 'cleanup',
             'list_debug_shapes', 'add_emitter_to_system', 'set_emitter_properties',
-            'add_spawn_rate_module', 'add_spawn_burst_module', 'add_spawn_per_unit_module',
+            'build_niagara_system', 'add_spawn_rate_module', 'add_spawn_burst_module', 'add_spawn_per_unit_module',
             'add_initialize_particle_module', 'add_particle_state_module', 'add_force_module',
             'add_velocity_module', 'add_acceleration_module', 'add_size_module', 'add_color_module',
             'add_sprite_renderer_module', 'add_mesh_renderer_module', 'add_ribbon_renderer_module',
@@ -2009,6 +2276,25 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         // Simulation stage
         stageName: commonSchemas.stringProp,
         stageType: commonSchemas.stringProp,
+        // System build spec (build_niagara_system)
+        emitters: {
+          type: 'array',
+          items: { type: 'object' },
+          description: 'build_niagara_system: [{ name, emitterPath?, enabled?, modules?: [{ script | preset, stage?, name? }], renderers?: [{ type: sprite|mesh|ribbon|light, materialPath?, meshPath?, properties? }] }]. stage is emitterSpawn, emitterUpdate, particleSpawn or particleUpdate.'
+        },
+        userParameters: {
+          type: 'array',
+          items: { type: 'object' },
+          description: 'build_niagara_system: [{ name, type: Float|Int|Bool|Vector|LinearColor, value? }].'
+        },
+        dataInterfaces: {
+          type: 'array',
+          items: { type: 'object' },
+          description: 'build_niagara_system: [{ name, type (e.g. Spline, StaticMesh, CurlNoise), properties? }], exposed as user parameters.'
+        },
+        compile: { type: 'boolean', description: 'build_niagara_system: compile once after all edits and wait for it (default true).' },
+        compileTimeoutSeconds: commonSchemas.numberProp,
+        save: commonSchemas.booleanProp,
         // Timeout
         timeoutMs: commonSchemas.numberProp
       },
@@ -2020,6 +2306,8 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         ...commonSchemas.outputBase,
         systemPath: commonSchemas.assetPath,
         emitterName: commonSchemas.stringProp,
+        build: commonSchemas.objectProp,
+        compile: commonSchemas.objectProp,
         shapes: commonSchemas.arrayOfObjects,
         niagaraInfo: commonSchemas.objectProp,
         validationResult: commonSchemas.objectProp
@@ -2069,7 +2357,8 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
             'configure_cue_trigger',
             'set_cue_effects',
             'add_tag_to_asset',
-            'get_gas_info'
+            'get_gas_info',
+            'import_gas_table'
           ],
           description: 'GAS action to perform.'
         },
@@ -2247,6 +2536,12 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         cameraShakePath: commonSchemas.cameraShakePath,
         decalPath: commonSchemas.decalPath,
         tagName: commonSchemas.tagName,
+        rows: {
+          type: 'array',
+          items: commonSchemas.objectProp,
+          description: 'import_gas_table rows. Attribute rows: kind "attribute", attributeSet, attribute, baseValue?, category?. Effect rows: kind "effect", effect, durationType?, duration?, period?, stackingType?, stackLimit?, grantedTags?, cueTags?, modifierAttribute ("Set.Attribute"), modifierOp?, magnitude?; one row per modifier. Sets and effects are names under path or /Game/... paths.'
+        },
+        csv: { type: 'string', description: 'import_gas_table rows as CSV with a header row of the same column names; list cells separate tags with ";".' },
       },
       required: ['action']
     },
@@ -2258,6 +2553,8 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         componentName: commonSchemas.componentName,
         attributeName: commonSchemas.stringProp,
         modifierIndex: commonSchemas.numberProp,
+        assets: commonSchemas.arrayOfObjects,
+        rows: commonSchemas.arrayOfObjects,
         gasInfo: {
           type: 'object',
           properties: {
@@ -3389,6 +3686,7 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
           enum: [
             'create_widget_blueprint',
             'set_widget_parent_class',
+            'build_widget_tree',
             'add_canvas_panel',
             'add_horizontal_box',
             'add_vertical_box',
@@ -3756,7 +4054,14 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
           description: 'Preview resolution preset.'
         },
         customWidth: { type: 'number', description: 'Custom preview width.' },
-        customHeight: { type: 'number', description: 'Custom preview height.' }
+        customHeight: { type: 'number', description: 'Custom preview height.' },
+        root: {
+          type: 'object',
+          description: 'build_widget_tree spec: { name, type, properties?, slot?, bindings?: [{ property, function }], children?: [...] }, nested. Widgets are matched to the existing tree by name.'
+        },
+        prune: { type: 'boolean', description: 'build_widget_tree: remove widgets the spec does not name (default true).' },
+        compile: commonSchemas.compile,
+        save: commonSchemas.save
       },
       required: ['action']
     },
@@ -4654,6 +4959,14 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
           description: 'Failsafe extent for nav modifier when actor has no collision.'
         },
         bIncludeAgentHeight: { type: 'boolean', description: 'Expand lower bounds by agent height.' },
+        bounds: {
+          description: 'rebuild_navigation: dirty area(s) to rebuild instead of the whole navmesh, as { min, max } or { center, extent }, or an array of them.'
+        },
+        actorNames: { type: 'array', items: { type: 'string' }, description: 'rebuild_navigation: rebuild only around these actors.' },
+        recent: { type: 'boolean', description: 'rebuild_navigation: rebuild around actors edited since the last recent rebuild (old and new positions).' },
+        padding: { type: 'number', description: 'rebuild_navigation: grow actor bounds by this many units (default 200).' },
+        waitForCompletion: { type: 'boolean', description: 'rebuild_navigation: for a full rebuild, reply once it finishes (dirty-area rebuilds always do).' },
+        timeoutSeconds: { type: 'number', description: 'rebuild_navigation: stop waiting after this many seconds (default 300).' },
         areaCost: { type: 'number', description: 'Pathfinding cost multiplier for area (1.0 = normal).' },
         fixedAreaEnteringCost: { type: 'number', description: 'Fixed cost added when entering the area.' },
         linkName: commonSchemas.linkName,
@@ -4767,7 +5080,7 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         action: {
           type: 'string',
           enum: [
-            'create_spline_actor', 'add_spline_point', 'remove_spline_point',
+            'create_spline_actor', 'add_spline_point', 'set_spline_points', 'remove_spline_point',
             'set_spline_point_position', 'set_spline_point_tangents',
             'set_spline_point_rotation', 'set_spline_point_scale', 'set_spline_type',
             'create_spline_mesh_component', 'set_spline_mesh_asset',
@@ -4853,6 +5166,20 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
           enum: ['Local', 'World'],
           description: 'Coordinate space for position/tangent values (default: Local).'
         },
+        positions: {
+          description: 'set_spline_points: point positions as a flat [x,y,z,...] array, [{x,y,z}] objects, or a packed f64x3/f32x3 block { encoding: "base64", layout, count, data }.'
+        },
+        arriveTangents: { description: 'set_spline_points: per-point arrive tangents, same formats as positions. Makes the points CurveCustomTangent.' },
+        leaveTangents: { description: 'set_spline_points: per-point leave tangents, same formats as positions.' },
+        tangents: { description: 'set_spline_points: per-point tangents used for both arrive and leave.' },
+        rotations: { description: 'set_spline_points: per-point rotations as [pitch,yaw,roll,...], [{pitch,yaw,roll}] or packed.' },
+        scales: { description: 'set_spline_points: per-point scales, same formats as positions.' },
+        pointType: {
+          type: 'string',
+          enum: ['Linear', 'Curve', 'Constant', 'CurveClamped', 'CurveCustomTangent'],
+          description: 'Point type for added points (default: Curve).'
+        },
+        append: { type: 'boolean', description: 'set_spline_points: append to the existing points instead of replacing them (default: false).' },
         splineType: {
           type: 'string',
           enum: ['Linear', 'Curve', 'Constant', 'CurveClamped', 'CurveCustomTangent'],
@@ -4924,6 +5251,12 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         scaleMin: { type: 'number', description: 'Minimum random scale multiplier.' },
         scaleMax: { type: 'number', description: 'Maximum random scale multiplier.' },
         randomSeed: { type: 'number', description: 'Seed for randomization (for reproducible results).' },
+        meshPaths: {
+          type: 'array',
+          items: { type: 'string' },
+          description: 'scatter_meshes_along_spline: meshes cycled per instance, one instanced component each (overrides meshPath).'
+        },
+        clearExisting: { type: 'boolean', description: 'scatter_meshes_along_spline: replace instances from a previous scatter of the same mesh (default: true).' },
         templateType: {
           type: 'string',
           enum: ['road', 'river', 'fence', 'wall', 'cable', 'pipe'],
@@ -5021,6 +5354,8 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
           description: 'List of spline mesh components.'
         },
         scatteredMeshes: { type: 'number', description: 'Number of meshes scattered along spline.' },
+        instancesCreated: { type: 'number', description: 'Instances scatter_meshes_along_spline added to the instanced components.' },
+        pointsSet: { type: 'number', description: 'Points written by set_spline_points.' },
         error: commonSchemas.stringProp
       }
     }
@@ -5345,7 +5680,7 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
   // OBSERVE — Runtime observability and playtest feedback
   {
     name: 'observe',
-    description: 'Runtime observability and playtest feedback. Start PIE playtests, capture snapshots at intervals, query logs, correlate events, and generate structured reports. Actions: query_logs, get_log_summary, start_playtest, capture_snapshot, stop_playtest, get_playtest_report, run_scenario, get_runtime_state.',
+    description: 'Runtime observability and playtest feedback. Start PIE playtests, capture snapshots at intervals, query logs, correlate events, and generate structured reports. Actions: query_logs, get_log_summary, start_playtest, capture_snapshot, stop_playtest, get_playtest_report, run_scenario, get_runtime_state, subscribe_runtime_telemetry, unsubscribe_runtime_telemetry.',
     category: 'core',
     annotations: {
       title: 'Observe & Playtest',
@@ -5362,9 +5697,10 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
           enum: [
             'query_logs', 'get_log_summary',
             'start_playtest', 'capture_snapshot', 'stop_playtest',
-            'get_playtest_report', 'run_scenario', 'get_runtime_state'
+            'get_playtest_report', 'run_scenario', 'get_runtime_state',
+            'subscribe_runtime_telemetry', 'unsubscribe_runtime_telemetry'
           ],
-          description: 'run_scenario automates: start PIE → capture snapshots at intervals → stop → report. query_logs reads from disk log and internal buffer.'
+          description: 'run_scenario automates: start PIE → capture snapshots at intervals → stop → report. query_logs reads from disk log and internal buffer. subscribe_runtime_telemetry makes the editor push aggregated FPS, frame-time, memory, object and player telemetry; get_runtime_state then includes the latest window instead of needing repeated polls.'
         },
         // query_logs params
         count: { type: 'number', description: 'Number of log entries to return (default: 50)' },
@@ -5377,7 +5713,10 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         duration: { type: 'number', description: 'Scenario duration in seconds (default: 10)' },
         interval: { type: 'number', description: 'Snapshot capture interval in seconds (default: 3)' },
         // stop_playtest params
-        status: { type: 'string', enum: ['completed', 'failed', 'aborted'], description: 'Final status when stopping playtest' }
+        status: { type: 'string', enum: ['completed', 'failed', 'aborted'], description: 'Final status when stopping playtest' },
+        // subscribe_runtime_telemetry params
+        intervalMs: { type: 'number', minimum: 100, maximum: 60000, description: 'subscribe_runtime_telemetry: push interval in ms (default: 1000)' },
+        hitchThresholdMs: { type: 'number', description: 'subscribe_runtime_telemetry: frames at least this long count as hitches (default: 50)' }
       },
       required: ['action']
     }
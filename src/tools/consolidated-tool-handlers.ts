@@ -234,7 +234,7 @@ function registerDefaultHandlers() {
 
   // 6. ANIMATION & PHYSICS (merged with manage_animation_authoring - Phase 53)
   const ANIMATION_AUTHORING_ACTIONS = new Set([
-    'create_animation_sequence', 'set_sequence_length', 'add_bone_track', 'set_bone_key', 'set_curve_key',
+    'create_animation_sequence', 'set_sequence_length', 'add_bone_track', 'set_bone_key', 'set_curve_key', 'set_bone_tracks',
     'add_notify_state', 'add_sync_marker', 'set_root_motion_settings', 'set_additive_settings',
     'create_montage', 'add_montage_section', 'add_montage_slot', 'set_section_timing',
     'add_montage_notify', 'set_blend_in', 'set_blend_out', 'link_sections',
@@ -264,7 +264,7 @@ function registerDefaultHandlers() {
 
   // 7. EFFECTS MANAGER (merged with manage_niagara_authoring - Phase 53)
   const NIAGARA_AUTHORING_ACTIONS = new Set([
-    'add_emitter_to_system', 'set_emitter_properties',
+    'add_emitter_to_system', 'set_emitter_properties', 'build_niagara_system',
     'add_spawn_rate_module', 'add_spawn_burst_module', 'add_spawn_per_unit_module',
     'add_initialize_particle_module', 'add_particle_state_module',
     'add_force_module', 'add_velocity_module', 'add_acceleration_module',
@@ -327,7 +327,8 @@ function registerDefaultHandlers() {
   const AUDIO_AUTHORING_ACTIONS = new Set([
     'add_cue_node', 'connect_cue_nodes', 'set_cue_attenuation', 'set_cue_concurrency',
     'create_metasound', 'add_metasound_node', 'connect_metasound_nodes',
-    'add_metasound_input', 'add_metasound_output', 'set_metasound_default',
+    'add_metasound_input', 'add_metasound_output', 'set_metasound_default', 'build_metasound_graph',
+    'import_sound_waves',
     'set_class_properties', 'set_class_parent', 'add_mix_modifier', 'configure_mix_eq',
     'create_attenuation_settings', 'configure_distance_attenuation',
     'configure_spatialization', 'configure_occlusion', 'configure_reverb_send',
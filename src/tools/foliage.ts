@@ -185,14 +185,28 @@ export class FoliageTools implements IFoliageTools {
   }
 
   // Query foliage instances (plugin-native)
-  async getFoliageInstances(params: { foliageType?: string }): Promise<StandardActionResponse> {
+  async getFoliageInstances(params: {
+    foliageType?: string;
+    box?: Record<string, unknown>;
+    sphere?: Record<string, unknown>;
+    frustum?: Record<string, unknown>;
+    countOnly?: boolean;
+    pageSize?: number;
+    cursor?: string;
+  }): Promise<StandardActionResponse> {
     if (!this.automationBridge) {
       throw new Error('Automation Bridge not available. Foliage operations require plugin support.');
     }
     try {
       const typePath = params.foliageType ? (params.foliageType.includes('/') ? params.foliageType : `/Game/Foliage/${params.foliageType}.${params.foliageType}`) : undefined;
       const response = await this.automationBridge.sendAutomationRequest('get_foliage_instances', {
-        foliageTypePath: typePath
+        foliageTypePath: typePath,
+        box: params.box,
+        sphere: params.sphere,
+        frustum: params.frustum,
+        countOnly: params.countOnly,
+        pageSize: params.pageSize,
+        cursor: params.cursor
       }, { timeoutMs: 60000 });
       if (response.success === false) {
         return { success: false, error: response.error || response.message || 'Get foliage instances failed' };
@@ -201,6 +215,8 @@ export class FoliageTools implements IFoliageTools {
       return {
         success: true,
         count: coerceNumber(payload.count) ?? 0,
+        totalCount: coerceNumber(payload.totalCount) ?? coerceNumber(payload.count) ?? 0,
+        nextCursor: payload.nextCursor as string | undefined,
         instances: (payload.instances as Array<Record<string, unknown>>) ?? [],
         message: 'Foliage instances retrieved'
       } as StandardActionResponse;
@@ -327,7 +343,14 @@ export class FoliageTools implements IFoliageTools {
       maxScale?: number;
       alignToNormal?: boolean;
       randomYaw?: boolean;
+      foliageTypePath?: string;
+      minDistance?: number;
+      maxSlope?: number;
+      zOffset?: number;
     }>;
+    mode?: 'spawner' | 'scatter';
+    landscapeOnly?: boolean;
+    parallel?: boolean;
     // Legacy params compatibility
     volumeName?: string;
     position?: [number, number, number];
@@ -359,7 +382,10 @@ export class FoliageTools implements IFoliageTools {
       },
       foliageTypes,
       seed: params.seed ?? 42,
-      tileSize: params.tileSize ?? 1000
+      tileSize: params.tileSize ?? 1000,
+      mode: params.mode,
+      landscapeOnly: params.landscapeOnly,
+      parallel: params.parallel
     };
 
     const response = await this.automationBridge.sendAutomationRequest('create_procedural_foliage', payload);
@@ -372,6 +398,15 @@ export class FoliageTools implements IFoliageTools {
     }
 
     const result = (response.result ?? {}) as Record<string, unknown>;
+    if (params.mode === 'scatter') {
+      return {
+        success: true,
+        message: `Scattered ${result.instancesAdded ?? 0} foliage instances for ${volName}`,
+        details: response,
+        instancesAdded: result.instancesAdded,
+        foliageTypes: result.foliageTypes
+      } as StandardActionResponse;
+    }
     return {
       success: true,
       message: `Procedural foliage volume ${volName} created`,
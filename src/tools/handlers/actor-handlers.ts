@@ -61,6 +61,20 @@ function normalizeActorAction(action: string): string {
     return ACTOR_ACTION_ALIASES[action] ?? action;
 }
 
+/** Filters, projection and paging shared by list and find_by_class; only keys the caller set. */
+function pickListingArgs(args: HandlerArgs): Record<string, unknown> {
+    const picked: Record<string, unknown> = {};
+    for (const key of ['className', 'filter', 'tag', 'dataLayer', 'bounds', 'fields', 'cursor']) {
+        if (args[key] !== undefined) {
+            picked[key] = args[key];
+        }
+    }
+    if (typeof args.limit === 'number') {
+        picked.limit = args.limit;
+    }
+    return picked;
+}
+
 const handlers: Record<string, ActorActionHandler> = {
     spawn: async (args, tools) => {
         const params = normalizeArgs(args, [
@@ -323,12 +337,34 @@ const handlers: Record<string, ActorActionHandler> = {
         }
         return result;
     },
+    spawn_actors_bulk: async (args, tools) => {
+        if (args.transforms === undefined && args.locations === undefined) {
+            throw new Error('spawn_actors_bulk requires transforms or locations');
+        }
+        const count = Array.isArray(args.transforms) ? args.transforms.length
+            : Array.isArray(args.locations) ? args.locations.length : 0;
+        // Roughly 1s per 2000 actors on a mid-range editor, never under the default.
+        const timeoutMs = Math.max(60000, Math.ceil(count / 2000) * 1000 + 30000);
+        return await executeAutomationRequest(tools, TOOL_ACTIONS.CONTROL_ACTOR, {
+            action: 'spawn_actors_bulk',
+            classPath: args.classPath,
+            blueprintPath: args.blueprintPath,
+            meshPath: args.meshPath,
+            transforms: args.transforms,
+            locations: args.locations,
+            labelPrefix: args.labelPrefix,
+            folder: args.folder,
+            tags: args.tags,
+            mobility: args.mobility
+        }, undefined, { timeoutMs }) as Record<string, unknown>;
+    },
     list: async (args, tools) => {
         const limit = typeof args.limit === 'number' ? args.limit : 50;
-        // Pass limit to C++ handler - C++ may return totalCount for accurate remaining calculation
+        // Pass limit to C++ handler - C++ returns totalCount and, when more remain, nextCursor
         const result = await executeAutomationRequest(tools, TOOL_ACTIONS.CONTROL_ACTOR, {
             action: 'list',
-            limit
+            limit,
+            ...pickListingArgs(args)
         }) as ListActorsResult & { totalCount?: number };
         if (result && result.actors && Array.isArray(result.actors)) {
             const returnedCount = result.actors.length;
@@ -447,7 +483,8 @@ const handlers: Record<string, ActorActionHandler> = {
         const className = extractString(params, 'className');
         return await executeAutomationRequest(tools, TOOL_ACTIONS.CONTROL_ACTOR, {
             action: 'find_by_class',
-            className
+            className,
+            ...pickListingArgs(args)
         }) as Record<string, unknown>;
     },
     get_bounding_box: async (args, tools) => {
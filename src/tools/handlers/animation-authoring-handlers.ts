@@ -187,6 +187,41 @@ export async function handleAnimationAuthoringTools(
         return ResponseFactory.success(res, res.message ?? `Curve key set at frame ${frame}`);
       }
 
+      case 'set_bone_tracks': {
+        const params = normalizeArgs(args, [
+          { key: 'assetPath', required: true },
+          { key: 'tracks' },  // [{ boneName, positions?, rotations?, scales? }] packed number arrays
+          { key: 'curves' },  // [{ curveName, values, frames? }]
+          { key: 'rotationFormat', default: 'quat' },
+          { key: 'resizeToKeys', default: false },
+          { key: 'createIfMissing', default: true },
+          { key: 'save', default: true },
+        ]);
+
+        const assetPath = extractString(params, 'assetPath');
+        const tracks = Array.isArray(params.tracks) ? params.tracks : undefined;
+        const curves = Array.isArray(params.curves) ? params.curves : undefined;
+        if (!tracks?.length && !curves?.length) {
+          return ResponseFactory.error('tracks or curves is required', 'MISSING_TRACKS');
+        }
+
+        const res = (await executeAutomationRequest(tools, 'manage_animation_authoring', {
+          subAction: 'set_bone_tracks',
+          assetPath,
+          tracks,
+          curves,
+          rotationFormat: extractOptionalString(params, 'rotationFormat') ?? 'quat',
+          resizeToKeys: extractOptionalBoolean(params, 'resizeToKeys') ?? false,
+          createIfMissing: extractOptionalBoolean(params, 'createIfMissing') ?? true,
+          save: extractOptionalBoolean(params, 'save') ?? true,
+        })) as AutomationResponse;
+
+        if (res.success === false) {
+          return ResponseFactory.error(res.error ?? 'Failed to set bone tracks', res.errorCode);
+        }
+        return ResponseFactory.success(res, res.message ?? 'Bone tracks set');
+      }
+
       case 'add_notify': {
         const params = normalizeArgs(args, [
           { key: 'assetPath', required: true },
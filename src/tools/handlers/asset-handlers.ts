@@ -21,7 +21,7 @@ const VALID_ASSET_ACTIONS = new Set([
   // Material operations
   'create_material', 'create_material_instance', 'create_render_target',
   'generate_lods', 'add_material_parameter', 'list_instances',
-  'reset_instance_parameters', 'get_material_stats', 'nanite_rebuild_mesh',
+  'reset_instance_parameters', 'get_material_stats', 'nanite_rebuild_mesh', 'bulk_build_meshes',
   // Material graph operations
   'add_material_node', 'remove_material_node', 'rebuild_material',
   'connect_material_pins', 'break_material_connections', 'get_material_node_details',
@@ -517,19 +517,28 @@ export async function handleAssetTools(action: string, args: HandlerArgs, tools:
           { key: 'packagePaths' },
           { key: 'recursivePaths' },
           { key: 'recursiveClasses' },
-          { key: 'limit' }
+          { key: 'limit' },
+          { key: 'pageSize' },
+          { key: 'cursor' },
+          { key: 'fields' }
         ]);
         const classNames = extractOptionalArray<string>(params, 'classNames');
         const packagePaths = extractOptionalArray<string>(params, 'packagePaths');
         const recursivePaths = extractOptionalBoolean(params, 'recursivePaths');
         const recursiveClasses = extractOptionalBoolean(params, 'recursiveClasses');
         const limit = extractOptionalNumber(params, 'limit');
+        const pageSize = extractOptionalNumber(params, 'pageSize');
+        const cursor = extractOptionalString(params, 'cursor');
+        const fields = extractOptionalArray<string>(params, 'fields');
         const res = await executeAutomationRequest(tools, 'asset_query', {
           classNames,
           packagePaths,
           recursivePaths,
           recursiveClasses,
           limit,
+          pageSize,
+          cursor,
+          fields,
           subAction: 'search_assets'
         }) as AssetOperationResponse;
         return ResponseFactory.success(res, 'Assets found');
@@ -551,13 +560,31 @@ export async function handleAssetTools(action: string, args: HandlerArgs, tools:
       case 'get_dependencies': {
         const params = normalizeArgs(args, [
           { key: 'assetPath', required: true },
-          { key: 'recursive' }
+          { key: 'recursive' },
+          { key: 'maxDepth' },
+          { key: 'direction' },
+          { key: 'dependencyType' },
+          { key: 'pathPrefix' },
+          { key: 'offset' },
+          { key: 'limit' }
         ]);
         const assetPath = extractString(params, 'assetPath');
         const recursive = extractOptionalBoolean(params, 'recursive');
+        const maxDepth = extractOptionalNumber(params, 'maxDepth');
+        const direction = extractOptionalString(params, 'direction');
+        const dependencyType = extractOptionalString(params, 'dependencyType');
+        const pathPrefix = extractOptionalString(params, 'pathPrefix');
+        const offset = extractOptionalNumber(params, 'offset');
+        const limit = extractOptionalNumber(params, 'limit');
         const res = await executeAutomationRequest(tools, 'manage_asset', {
           assetPath,
           recursive,
+          maxDepth,
+          direction,
+          dependencyType,
+          pathPrefix,
+          offset,
+          limit,
           subAction: 'get_dependencies'
         }) as AssetOperationResponse;
         return ResponseFactory.success(res, 'Dependencies retrieved');
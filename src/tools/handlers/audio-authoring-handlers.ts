@@ -80,7 +80,7 @@ export async function handleAudioAuthoringTools(
     }
 
     // =========================================================================
-    // 11.2 MetaSounds (6 actions)
+    // 11.2 MetaSounds (7 actions)
     // =========================================================================
 
     case 'create_metasound': {
@@ -123,6 +123,20 @@ export async function handleAudioAuthoringTools(
       return sendRequest('set_metasound_default');
     }
 
+    case 'build_metasound_graph': {
+      if (typeof argsRecord.assetPath !== 'string' || argsRecord.assetPath.length === 0) {
+        requireNonEmptyString(argsRecord.name, 'name', 'Missing required parameter: assetPath (or name to create one)');
+      }
+      return sendRequest('build_metasound_graph');
+    }
+
+    case 'import_sound_waves': {
+      if (!Array.isArray(argsRecord.files)) {
+        requireNonEmptyString(argsRecord.sourceDirectory, 'sourceDirectory', 'Missing required parameter: files or sourceDirectory');
+      }
+      return sendRequest('import_sound_waves');
+    }
+
     // =========================================================================
     // 11.3 Sound Classes & Mixes (6 actions)
     // =========================================================================
@@ -19,6 +19,12 @@ function normalizeBlueprintPath(path: string | undefined): string | undefined {
   return normalized;
 }
 
+// manage_blueprint actions that edit_session forwards as graph edits
+const GRAPH_EDIT_ACTIONS = new Set([
+  'create_node', 'add_node', 'delete_node', 'connect_pins', 'break_pin_links',
+  'set_node_property', 'create_reroute_node', 'set_pin_default_value'
+]);
+
 function hasBlueprintPathTraversal(path: string | undefined): boolean {
   if (!path) return false;
   return path.split('/').some((segment) => segment === '..');
@@ -421,6 +427,57 @@ export async function handleBlueprintTools(action: string, args: HandlerArgs, to
       await tools.progressReporter.report(3, 3, 'Blueprint compilation complete');
       return cleanObject(res);
     }
+    case 'edit_session': {
+      const bpPath = argsTyped.blueprintPath || argsTyped.name || (argsRecord.path as string) || '';
+      const rawEdits = Array.isArray(argsRecord.edits) ? argsRecord.edits as Record<string, unknown>[] : [];
+      // Graph edits use the manage_blueprint action names; the bridge expects
+      // them as manage_blueprint_graph subActions.
+      const edits = rawEdits.map((edit) => {
+        const editAction = typeof edit.action === 'string' ? edit.action : '';
+        if (GRAPH_EDIT_ACTIONS.has(editAction)) {
+          const rest: Record<string, unknown> = { ...edit };
+          delete rest.action;
+          return { ...rest, subAction: editAction === 'add_node' ? 'create_node' : editAction };
+        }
+        return edit;
+      });
+      await tools.progressReporter.report(1, 2, `Applying ${edits.length} edit(s) to '${bpPath}'...`);
+
+      const res = await executeAutomationRequest(tools, 'blueprint_edit_session', {
+        blueprintPath: bpPath,
+        edits,
+        save: argsRecord.save as boolean | undefined,
+        stopOnError: argsRecord.stopOnError as boolean | undefined,
+        timeoutMs: argsRecord.timeoutMs as number | undefined
+      }) as Record<string, unknown>;
+
+      await tools.progressReporter.report(2, 2, 'Edit session committed');
+      return cleanObject(res);
+    }
+    case 'compile_blueprints': {
+      const blueprintPaths = Array.isArray(argsRecord.blueprintPaths)
+        ? (argsRecord.blueprintPaths as unknown[]).filter((p): p is string => typeof p === 'string').map((p) => normalizeBlueprintPath(p) as string)
+        : undefined;
+      if (blueprintPaths?.some((p) => hasBlueprintPathTraversal(p)) || isUnsafePath(argsRecord.folderPath)) {
+        return cleanObject({
+          success: false,
+          error: 'INVALID_BLUEPRINT_PATH',
+          message: 'Blueprint path blocked for security: traversal segments detected'
+        }) as Record<string, unknown>;
+      }
+      await tools.progressReporter.report(1, 2, 'Compiling blueprints...');
+
+      const res = await executeAutomationRequest(tools, 'compile_blueprints', {
+        blueprintPaths,
+        folderPath: argsRecord.folderPath as string | undefined,
+        recursive: argsRecord.recursive as boolean | undefined,
+        save: (argsRecord.save ?? argsRecord.saveAfterCompile) as boolean | undefined,
+        timeoutMs: argsRecord.timeoutMs as number | undefined
+      }) as Record<string, unknown>;
+
+      await tools.progressReporter.report(2, 2, 'Blueprint compilation complete');
+      return cleanObject(res);
+    }
     case 'probe_handle': {
       const res = await executeAutomationRequest(tools, 'blueprint_probe_subobject_handle', {
         componentClass: (argsRecord.componentClass as string) ?? ''
@@ -123,6 +123,17 @@ export async function executeAutomationRequest(
   return await automationBridge.sendAutomationRequest(toolName, cleanedArgs, timeoutMs ? { timeoutMs } : {});
 }
 
+/**
+ * Client timeout for a request the plugin answers when its editor job ends (tracked builds):
+ * the job's own timeoutSeconds, or defaultSeconds, plus slack for the reply. Undefined when the
+ * caller passed waitForCompletion: false and the plugin replies at once.
+ */
+export function trackedJobTimeoutMs(args: Record<string, unknown>, defaultSeconds: number): number | undefined {
+  if (args.waitForCompletion === false) return undefined;
+  const seconds = typeof args.timeoutSeconds === 'number' && args.timeoutSeconds > 0 ? args.timeoutSeconds : defaultSeconds;
+  return seconds * 1000 + 30000;
+}
+
 /**
  * Normalize location to [x, y, z] array format
  * Accepts both {x,y,z} object and [x,y,z] array formats
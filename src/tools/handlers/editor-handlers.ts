@@ -110,6 +110,8 @@ const ACTION_ALLOWED_PARAMS: Record<string, string[]> = {
   'set_viewport_realtime': ['enabled', 'realtime'],
   'simulate_input': ['key', 'action', 'inputAction', 'axis', 'value'],
   'capture_viewport': ['width', 'height', 'format', 'quality'],
+  'subscribe_viewport_stream': ['fps', 'width', 'height', 'format', 'quality', 'onlyOnChange', 'maxInFlight'],
+  'unsubscribe_viewport_stream': [],
 };
 
 /**
@@ -1,7 +1,9 @@
 import { cleanObject } from '../../utils/safe-json.js';
 import { ITools } from '../../types/tool-interfaces.js';
 import type { HandlerArgs, EnvironmentArgs, Vector3 } from '../../types/handler-types.js';
-import { executeAutomationRequest } from './common-handlers.js';
+import { executeAutomationRequest, trackedJobTimeoutMs } from './common-handlers.js';
+import { LIGHTING_BUILD_TIMEOUT_SECONDS } from '../../constants.js';
+import { isPackedArray, packArray } from '../../automation/packed-array.js';
 
 /** Location item in foliage locations array */
 interface LocationItem {
@@ -16,6 +18,14 @@ function vec3ToArray(v: Vector3 | undefined): [number, number, number] | undefin
   return [v.x ?? 0, v.y ?? 0, v.z ?? 0];
 }
 
+/** Heights travel as packed u16 (two bytes a sample) rather than a JSON number per vertex. */
+function packHeightData(heightData: unknown): unknown {
+  if (isPackedArray(heightData) || !Array.isArray(heightData) || heightData.length === 0) {
+    return heightData;
+  }
+  return packArray('u16', heightData.map((h) => Math.min(65535, Math.max(0, Math.round(Number(h) || 0)))));
+}
+
 export async function handleEnvironmentTools(action: string, args: HandlerArgs, tools: ITools): Promise<Record<string, unknown>> {
   const argsTyped = args as EnvironmentArgs;
   const argsRecord = args as Record<string, unknown>;
@@ -35,19 +45,30 @@ export async function handleEnvironmentTools(action: string, args: HandlerArgs,
         enableWorldPartition: argsRecord.enableWorldPartition as boolean | undefined,
         runtimeGrid: argsRecord.runtimeGrid as string | undefined,
         isSpatiallyLoaded: argsRecord.isSpatiallyLoaded as boolean | undefined,
-        dataLayers: argsRecord.dataLayers as string[] | undefined
+        dataLayers: argsRecord.dataLayers as string[] | undefined,
+        heightData: packHeightData(argsRecord.heightData)
       }) as Record<string, unknown>);
     case 'modify_heightmap':
       return cleanObject(await executeAutomationRequest(tools, 'modify_heightmap', {
         landscapeName: argsTyped.landscapeName || argsTyped.name || '',
-        heightData: argsTyped.heightData ?? [],
-        minX: (argsRecord.minX as number) ?? 0,
-        minY: (argsRecord.minY as number) ?? 0,
-        maxX: (argsRecord.maxX as number) ?? 0,
-        maxY: (argsRecord.maxY as number) ?? 0,
+        operation: argsRecord.operation as string | undefined,
+        heightData: packHeightData(argsRecord.heightData),
+        minX: argsRecord.minX as number | undefined,
+        minY: argsRecord.minY as number | undefined,
+        maxX: argsRecord.maxX as number | undefined,
+        maxY: argsRecord.maxY as number | undefined,
         updateNormals: argsRecord.updateNormals as boolean | undefined,
+        skipFlush: argsRecord.skipFlush as boolean | undefined,
         timeoutMs: argsRecord.timeoutMs as number | undefined
       }) as Record<string, unknown>);
+    case 'get_heightmap_region':
+      return cleanObject(await executeAutomationRequest(tools, 'get_heightmap_region', {
+        landscapeName: argsTyped.landscapeName || argsTyped.name || '',
+        minX: argsRecord.minX as number | undefined,
+        minY: argsRecord.minY as number | undefined,
+        maxX: argsRecord.maxX as number | undefined,
+        maxY: argsRecord.maxY as number | undefined
+      }) as Record<string, unknown>);
     case 'sculpt':
     case 'sculpt_landscape': {
       // Default to 'Raise' tool if not specified
@@ -57,7 +78,9 @@ export async function handleEnvironmentTools(action: string, args: HandlerArgs,
         tool,
         location: vec3ToArray(argsTyped.location),
         radius: argsTyped.radius || 500,
-        strength: (argsRecord.strength as number) || 0.5
+        strength: (argsRecord.strength as number) || 0.5,
+        stroke: argsRecord.stroke,
+        spacing: argsRecord.spacing as number | undefined
       }) as Record<string, unknown>);
     }
     case 'add_foliage': {
@@ -81,6 +104,15 @@ export async function handleEnvironmentTools(action: string, args: HandlerArgs,
           });
         }
 
+        // Packed locations (f32x3/f64x3, or f32x10/f64x10 transforms) go to the plugin as-is
+        if (isPackedArray(argsRecord.locations)) {
+          return cleanObject(await executeAutomationRequest(tools, 'paint_foliage', {
+            foliageType,
+            locations: argsRecord.locations,
+            minDistance: argsRecord.minDistance as number | undefined
+          }) as Record<string, unknown>);
+        }
+
         // Support location+radius to generate locations if explicit array not provided
         let locations = argsTyped.locations as Vector3[] | undefined;
         if (!locations && argsTyped.location && argsTyped.radius) {
@@ -113,18 +145,31 @@ export async function handleEnvironmentTools(action: string, args: HandlerArgs,
 
         return cleanObject(await executeAutomationRequest(tools, 'paint_foliage', {
           foliageType,
-          locations
+          locations,
+          minDistance: argsRecord.minDistance as number | undefined
         }) as Record<string, unknown>);
       }
     }
 
     case 'add_foliage_instances': {
+      const foliageTypeArg = argsTyped.foliageType || argsTyped.foliageTypePath || argsTyped.meshPath || '';
+      const minDistance = argsRecord.minDistance as number | undefined;
+      const packed = isPackedArray(argsRecord.transforms) ? argsRecord.transforms
+        : (isPackedArray(argsRecord.locations) ? argsRecord.locations : undefined);
+      if (packed) {
+        return cleanObject(await executeAutomationRequest(tools, 'add_foliage_instances', {
+          foliageType: foliageTypeArg,
+          transforms: packed,
+          minDistance
+        }) as Record<string, unknown>);
+      }
       const locationsRaw = argsTyped.locations as LocationItem[] | undefined;
       const transformsRaw = argsTyped.transforms || 
         (locationsRaw ? locationsRaw.map((l: LocationItem) => ({ location: [l.x ?? 0, l.y ?? 0, l.z ?? 0] as [number, number, number] })) : []);
       return cleanObject(await executeAutomationRequest(tools, 'add_foliage_instances', {
-        foliageType: argsTyped.foliageType || argsTyped.foliageTypePath || argsTyped.meshPath || '',
-        transforms: transformsRaw as { location: [number, number, number]; rotation?: [number, number, number]; scale?: [number, number, number] }[]
+        foliageType: foliageTypeArg,
+        transforms: transformsRaw as { location: [number, number, number]; rotation?: [number, number, number]; scale?: [number, number, number] }[],
+        minDistance
       }) as Record<string, unknown>);
     }
     case 'paint_foliage':
@@ -149,15 +194,23 @@ export async function handleEnvironmentTools(action: string, args: HandlerArgs,
         volumeName: argsRecord.volumeName as string | undefined,
         bounds: argsTyped.bounds ? { location: argsTyped.bounds.min, size: argsTyped.bounds.max } : undefined,
         seed: argsTyped.seed,
-        tileSize: argsRecord.tileSize as number | undefined
+        tileSize: argsRecord.tileSize as number | undefined,
+        mode: argsRecord.mode as string | undefined,
+        landscapeOnly: argsRecord.landscapeOnly as boolean | undefined,
+        parallel: argsRecord.parallel as boolean | undefined
       }) as Record<string, unknown>);
 
-    case 'bake_lightmap':
-      return cleanObject(await executeAutomationRequest(tools, 'bake_lightmap', {
+    case 'bake_lightmap': {
+      const payload = {
         quality: (argsRecord.quality as string) || 'Preview',
         buildOnlySelected: false,
-        buildReflectionCaptures: false
-      }) as Record<string, unknown>);
+        buildReflectionCaptures: false,
+        waitForCompletion: typeof argsRecord.waitForCompletion === 'boolean' ? argsRecord.waitForCompletion : undefined,
+        timeoutSeconds: typeof argsRecord.timeoutSeconds === 'number' ? argsRecord.timeoutSeconds : undefined
+      };
+      return cleanObject(await executeAutomationRequest(tools, 'bake_lightmap', payload, undefined,
+        { timeoutMs: trackedJobTimeoutMs(payload, LIGHTING_BUILD_TIMEOUT_SECONDS) }) as Record<string, unknown>);
+    }
     case 'create_landscape_grass_type':
       return cleanObject(await executeAutomationRequest(tools, 'create_landscape_grass_type', {
         name: argsTyped.name || '',
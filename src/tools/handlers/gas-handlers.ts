@@ -227,6 +227,21 @@ export async function handleGASTools(
       return sendRequest('get_gas_info');
     }
 
+    // =========================================================================
+    // 13.8 Bulk Import (1 action)
+    // =========================================================================
+
+    case 'import_gas_table': {
+      if (!Array.isArray(argsRecord.rows) && typeof argsRecord.csv !== 'string') {
+        return cleanObject({
+          success: false,
+          error: 'INVALID_ARGUMENT',
+          message: 'import_gas_table requires rows (array) or csv (string)'
+        });
+      }
+      return sendRequest('import_gas_table');
+    }
+
     // =========================================================================
     // Default / Unknown Action
     // =========================================================================
@@ -43,11 +43,13 @@ const GEOMETRY_ACTIONS = [
   // LOD operations
   'generate_lods', 'set_lod_settings', 'set_lod_screen_sizes', 'convert_to_nanite',
   // Transform operations
-  'mirror', 'array_linear', 'array_radial',
+  'mirror', 'array_linear', 'array_radial', 'bake_instances',
   // Export/conversion
   'convert_to_static_mesh',
   // Utils
-  'get_mesh_info'
+  'get_mesh_info', 'get_mesh_buffers', 'set_mesh_buffers',
+  // Multi-step recipes applied to one working mesh and committed once
+  'pipeline'
 ] as const;
 
 type GeometryAction = (typeof GEOMETRY_ACTIONS)[number];
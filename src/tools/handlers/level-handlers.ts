@@ -1,7 +1,8 @@
 import { cleanObject } from '../../utils/safe-json.js';
 import { ITools } from '../../types/tool-interfaces.js';
 import type { HandlerArgs, LevelArgs, AutomationResponse } from '../../types/handler-types.js';
-import { executeAutomationRequest, requireNonEmptyString, validateSecurityPatterns } from './common-handlers.js';
+import { executeAutomationRequest, requireNonEmptyString, trackedJobTimeoutMs, validateSecurityPatterns } from './common-handlers.js';
+import { LIGHTING_BUILD_TIMEOUT_SECONDS } from '../../constants.js';
 
 // AutomationResponse now imported from types/handler-types.js
 
@@ -236,12 +237,16 @@ export async function handleLevelTools(action: string, args: HandlerArgs, tools:
     case 'build_lighting': {
       // Pass user-provided values, default to false if not specified
       const argsRecord = args as Record<string, unknown>;
-      const res = await executeAutomationRequest(tools, 'manage_lighting', {
+      const payload = {
         action: 'build_lighting',
         quality: (argsTyped.quality as string) || 'Preview',
         buildOnlySelected: typeof argsRecord.buildOnlySelected === 'boolean' ? argsRecord.buildOnlySelected : false,
-        buildReflectionCaptures: typeof argsRecord.buildReflectionCaptures === 'boolean' ? argsRecord.buildReflectionCaptures : false
-      }) as Record<string, unknown>;
+        buildReflectionCaptures: typeof argsRecord.buildReflectionCaptures === 'boolean' ? argsRecord.buildReflectionCaptures : false,
+        waitForCompletion: typeof argsRecord.waitForCompletion === 'boolean' ? argsRecord.waitForCompletion : undefined,
+        timeoutSeconds: typeof argsRecord.timeoutSeconds === 'number' ? argsRecord.timeoutSeconds : undefined
+      };
+      const res = await executeAutomationRequest(tools, 'manage_lighting', payload, undefined,
+        { timeoutMs: trackedJobTimeoutMs(payload, LIGHTING_BUILD_TIMEOUT_SECONDS) }) as Record<string, unknown>;
       return cleanObject(res);
     }
     case 'export_level': {
@@ -380,11 +385,12 @@ export async function handleLevelTools(action: string, args: HandlerArgs, tools:
       const hasExtent = Array.isArray(argsTyped.extent) && argsTyped.extent.length >= 2;
       const hasMin = Array.isArray(argsTyped.min) && argsTyped.min.length >= 2;
       const hasMax = Array.isArray(argsTyped.max) && argsTyped.max.length >= 2;
-      if (!hasCells && !(hasOrigin && hasExtent) && !(hasMin && hasMax)) {
+      const hasRegions = Array.isArray(argsTyped.regions) && argsTyped.regions.length > 0;
+      if (!hasCells && !hasRegions && !(hasOrigin && hasExtent) && !(hasMin && hasMax)) {
         return cleanObject({
           success: false,
           error: 'INVALID_ARGUMENT',
-          message: 'Missing required parameters: must provide either cells array, or origin+extent, or min+max',
+          message: 'Missing required parameters: must provide either regions, cells array, or origin+extent, or min+max',
           action,
           levelPath: argsTyped.levelPath
         });
@@ -410,7 +416,28 @@ export async function handleLevelTools(action: string, args: HandlerArgs, tools:
         extent: extent,
         ...args // Allow other args to override if explicit
       };
-      const res = await executeAutomationRequest(tools, 'manage_world_partition', payload);
+      // The bridge answers once every region is resident, sending progress
+      // per region, so a sweep can outlast the default request timeout.
+      const timeoutSeconds = typeof argsTyped.timeoutSeconds === 'number' ? argsTyped.timeoutSeconds : undefined;
+      const res = await executeAutomationRequest(tools, 'manage_world_partition', payload, undefined,
+        { timeoutMs: timeoutSeconds ? (timeoutSeconds + 30) * 1000 : 600000 });
+      return cleanObject(res) as Record<string, unknown>;
+    }
+    case 'unload_cells':
+    case 'get_loaded_cells': {
+      if (!argsTyped.levelPath || typeof argsTyped.levelPath !== 'string' || argsTyped.levelPath.trim() === '') {
+        return cleanObject({
+          success: false,
+          error: 'INVALID_ARGUMENT',
+          message: 'Missing required parameter: levelPath (World Partition level path required)',
+          action
+        });
+      }
+      const res = await executeAutomationRequest(tools, 'manage_world_partition', {
+        ...args,
+        subAction: action,
+        levelPath: argsTyped.levelPath
+      });
       return cleanObject(res) as Record<string, unknown>;
     }
     case 'set_datalayer': {
@@ -5,10 +5,11 @@
 import { cleanObject } from '../../utils/safe-json.js';
 import { ITools } from '../../types/tool-interfaces.js';
 import type { LightingArgs } from '../../types/handler-types.js';
-import { executeAutomationRequest, normalizeLocation } from './common-handlers.js';
+import { executeAutomationRequest, normalizeLocation, trackedJobTimeoutMs } from './common-handlers.js';
 import { toNumber, toBoolean, toString, toColor3, toLocationObj, toRotationObj, normalizeName } from '../../utils/type-coercion.js';
 import { ResponseFactory } from '../../utils/response-factory.js';
 import { TOOL_ACTIONS } from '../../utils/action-constants.js';
+import { LIGHTING_BUILD_TIMEOUT_SECONDS } from '../../constants.js';
 
 
 // Valid light types supported by UE - accepts multiple formats
@@ -474,10 +475,14 @@ async function buildLighting(
     quality: toString(args.quality) || 'High',
     buildOnlySelected: toBoolean(args.buildOnlySelected) || false,
     buildReflectionCaptures: toBoolean(args.buildReflectionCaptures) !== false,
-    levelPath: toString(args.levelPath)
+    levelPath: toString(args.levelPath),
+    waitForCompletion: toBoolean(args.waitForCompletion),
+    timeoutSeconds: toNumber(args.timeoutSeconds)
   };
 
-  return (await executeAutomationRequest(tools, TOOL_ACTIONS.BAKE_LIGHTMAP, payload, 'Automation bridge not available for lighting build')) as Record<string, unknown>;
+  // The plugin answers when the build ends, streaming its stage as progress meanwhile
+  return (await executeAutomationRequest(tools, TOOL_ACTIONS.BAKE_LIGHTMAP, payload, 'Automation bridge not available for lighting build',
+    { timeoutMs: trackedJobTimeoutMs(payload, LIGHTING_BUILD_TIMEOUT_SECONDS) })) as Record<string, unknown>;
 }
 
 /**
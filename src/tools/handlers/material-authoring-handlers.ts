@@ -825,16 +825,24 @@ export async function handleMaterialAuthoringTools(
         const params = normalizeArgs(args, [
           { key: 'assetPath', aliases: ['materialPath'], required: true },
           { key: 'save', default: true },
+          { key: 'waitForShaders' },
+          { key: 'timeoutSeconds' },
         ]);
 
         const assetPath = extractString(params, 'assetPath');
         const save = extractOptionalBoolean(params, 'save') ?? true;
+        const waitForShaders = extractOptionalBoolean(params, 'waitForShaders') ?? false;
+        const timeoutSeconds = extractOptionalNumber(params, 'timeoutSeconds');
 
+        // Waiting on shaders can outlast the default request timeout; the
+        // bridge sends progress while it waits.
         const res = (await executeAutomationRequest(tools, TOOL_ACTIONS.MANAGE_MATERIAL_AUTHORING, {
           subAction: 'compile_material',
           assetPath,
           save,
-        })) as AutomationResponse;
+          waitForShaders,
+          timeoutSeconds,
+        }, undefined, waitForShaders ? { timeoutMs: ((timeoutSeconds ?? 300) + 30) * 1000 } : {})) as AutomationResponse;
 
         if (res.success === false) {
           return ResponseFactory.error(res.error ?? 'Failed to compile material', res.errorCode);
@@ -842,6 +850,66 @@ export async function handleMaterialAuthoringTools(
         return ResponseFactory.success(res, res.message ?? 'Material compiled');
       }
 
+      case 'bulk_set_instance_parameters': {
+        const rawArgs = args as Record<string, unknown>;
+        const instances = Array.isArray(rawArgs.instances) ? rawArgs.instances : undefined;
+        const assetPaths = Array.isArray(rawArgs.assetPaths) ? rawArgs.assetPaths : undefined;
+        if (!instances && !assetPaths) {
+          return ResponseFactory.error('Missing required argument: instances or assetPaths', 'INVALID_ARGUMENT');
+        }
+
+        const res = (await executeAutomationRequest(tools, TOOL_ACTIONS.MANAGE_MATERIAL_AUTHORING, {
+          subAction: 'bulk_set_instance_parameters',
+          instances,
+          assetPaths,
+          parameters: Array.isArray(rawArgs.parameters) ? rawArgs.parameters : undefined,
+          save: extractOptionalBoolean(rawArgs, 'save') ?? true,
+        })) as AutomationResponse;
+
+        if (res.success === false) {
+          return ResponseFactory.error(res.error ?? 'Failed to set instance parameters', res.errorCode);
+        }
+        return ResponseFactory.success(res, res.message ?? 'Instance parameters set');
+      }
+
+      case 'edit_session': {
+        const rawArgs = args as Record<string, unknown>;
+        const assetPath = extractOptionalString(rawArgs, 'assetPath') ??
+                         extractOptionalString(rawArgs, 'materialPath') ?? '';
+        if (!assetPath) {
+          return ResponseFactory.error('Missing required argument: assetPath or materialPath', 'MISSING_ASSET_PATH');
+        }
+        const rawEdits = Array.isArray(rawArgs.edits) ? rawArgs.edits as Record<string, unknown>[] : [];
+        // Edits use the authoring action names; the bridge expects them as
+        // manage_material_authoring subActions. Edits naming a bridge action
+        // (e.g. manage_material_graph) with a payload pass through.
+        const edits = rawEdits.map((edit) => {
+          const editAction = typeof edit.action === 'string' ? edit.action : '';
+          if (editAction && editAction !== 'manage_material_authoring' && editAction !== 'manage_material_graph') {
+            const rest: Record<string, unknown> = { ...edit };
+            delete rest.action;
+            return { ...rest, subAction: editAction };
+          }
+          return edit;
+        });
+        const waitForShaders = extractOptionalBoolean(rawArgs, 'waitForShaders') ?? false;
+        const timeoutSeconds = extractOptionalNumber(rawArgs, 'timeoutSeconds');
+
+        const res = (await executeAutomationRequest(tools, 'material_edit_session', {
+          assetPath,
+          edits,
+          save: extractOptionalBoolean(rawArgs, 'save'),
+          stopOnError: extractOptionalBoolean(rawArgs, 'stopOnError'),
+          waitForShaders,
+          timeoutSeconds,
+        }, undefined, waitForShaders ? { timeoutMs: ((timeoutSeconds ?? 300) + 30) * 1000 } : {})) as AutomationResponse;
+
+        if (res.success === false) {
+          return ResponseFactory.error(res.error ?? 'Material edit session failed', res.errorCode);
+        }
+        return ResponseFactory.success(res, res.message ?? 'Material edit session committed');
+      }
+
       case 'get_material_info': {
         const params = normalizeArgs(args, [
           { key: 'assetPath', aliases: ['materialPath'], required: true },
@@ -1209,7 +1277,7 @@ export async function handleMaterialAuthoringTools(
 
       default:
         return ResponseFactory.error(
-          `Unknown material authoring action: ${action}. Available actions: create_material, create_complete_material, set_blend_mode, set_shading_model, add_texture_sample, add_scalar_parameter, add_vector_parameter, add_math_node, connect_nodes, create_material_instance, set_scalar_parameter_value, set_vector_parameter_value, set_texture_parameter_value, compile_material, get_material_info`,
+          `Unknown material authoring action: ${action}. Available actions: create_material, create_complete_material, set_blend_mode, set_shading_model, add_texture_sample, add_scalar_parameter, add_vector_parameter, add_math_node, connect_nodes, create_material_instance, set_scalar_parameter_value, set_vector_parameter_value, set_texture_parameter_value, compile_material, edit_session, bulk_set_instance_parameters, get_material_info`,
           'UNKNOWN_ACTION'
         );
     }
@@ -65,14 +65,14 @@ export async function handleNavigationTools(
   const timeoutMs = getTimeoutMs();
 
   // All actions are dispatched to C++ via automation bridge
-  const sendRequest = async (subAction: string): Promise<Record<string, unknown>> => {
+  const sendRequest = async (subAction: string, requestTimeoutMs = timeoutMs): Promise<Record<string, unknown>> => {
     const payload = { ...argsRecord, subAction };
     const result = await executeAutomationRequest(
       tools,
       'manage_navigation',
       payload as HandlerArgs,
       `Automation bridge not available for navigation action: ${subAction}`,
-      { timeoutMs }
+      { timeoutMs: requestTimeoutMs }
     );
     return cleanObject(result) as Record<string, unknown>;
   };
@@ -87,8 +87,14 @@ export async function handleNavigationTools(
     case 'set_nav_agent_properties':
       return sendRequest('set_nav_agent_properties');
 
-    case 'rebuild_navigation':
-      return sendRequest('rebuild_navigation');
+    case 'rebuild_navigation': {
+      // Dirty-area rebuilds (and full ones with waitForCompletion) answer when the tiles are built
+      const waits = argsRecord.bounds !== undefined || argsRecord.actorNames !== undefined
+        || argsRecord.recent === true || argsRecord.waitForCompletion === true;
+      const waitSeconds = typeof argsRecord.timeoutSeconds === 'number' ? argsRecord.timeoutSeconds : 300;
+      return sendRequest('rebuild_navigation',
+        waits ? Math.max(timeoutMs, waitSeconds * 1000 + 15000) : timeoutMs);
+    }
 
     // ========================================================================
     // Nav Modifiers (3 actions)
@@ -47,7 +47,7 @@ export async function handleNiagaraAuthoringTools(
 
   switch (action) {
     // =========================================================================
-    // 12.1 Systems & Emitters (4 actions)
+    // 12.1 Systems & Emitters (5 actions)
     // =========================================================================
 
     case 'create_niagara_system': {
@@ -72,6 +72,13 @@ export async function handleNiagaraAuthoringTools(
       return sendRequest('set_emitter_properties');
     }
 
+    case 'build_niagara_system': {
+      // All edits land before the single system compile; progress updates keep the request
+      // alive while the plugin waits for that compile.
+      requireNonEmptyString(argsRecord.systemPath, 'systemPath', 'Missing required parameter: systemPath');
+      return sendRequest('build_niagara_system');
+    }
+
     // =========================================================================
     // 12.2 Module Library (15 actions)
     // =========================================================================
@@ -10,15 +10,65 @@
  *   get_playtest_report  — get the last playtest report
  *   run_scenario         — automated scenario: start PIE, capture snapshots at intervals, stop, report
  *   get_runtime_state    — current PIE state (is it running, player info, FPS)
+ *   subscribe_runtime_telemetry   — have the plugin push aggregated per-frame telemetry
+ *   unsubscribe_runtime_telemetry — stop those pushes
  */
 
 import { ITools } from '../../types/tool-interfaces.js';
 import { executeAutomationRequest } from './common-handlers.js';
-import { runtimeObserver } from '../../services/runtime-observer.js';
+import { runtimeObserver, RuntimeTelemetryPush } from '../../services/runtime-observer.js';
+import type { AutomationBridge } from '../../automation/index.js';
 import { Logger } from '../../utils/logger.js';
 
 const logger = new Logger('ObserveHandlers');
 
+/** Cursor into the plugin's log ring buffer, so each pull only returns lines not seen yet */
+let bridgeLogCursor: number | undefined;
+
+/**
+ * Pull new lines from the plugin's in-memory log ring (get_recent_logs).
+ * Returns null when the bridge cannot serve them, so callers fall back to disk.
+ */
+async function ingestBridgeLogs(tools: ITools): Promise<number | null> {
+    try {
+        const result = await executeAutomationRequest(
+            tools, 'get_recent_logs',
+            bridgeLogCursor === undefined ? { limit: 500 } : { cursor: bridgeLogCursor, limit: 1000 },
+            'Bridge unavailable'
+        ) as Record<string, unknown>;
+        if (result.success === false) return null;
+
+        const inner = (result.result ?? result) as Record<string, unknown>;
+        if (!Array.isArray(inner.logs)) return null;
+        if (typeof inner.cursor === 'number') bridgeLogCursor = inner.cursor;
+        return runtimeObserver.ingestLogs(inner.logs as Array<{
+            timestamp?: string; category?: string; level?: string; message?: string;
+        }>, 'stream');
+    } catch {
+        return null;
+    }
+}
+
+/** Bridge whose runtime_telemetry events feed the observer */
+let telemetryBridge: AutomationBridge | undefined;
+
+/**
+ * Route runtime_telemetry automation_events into the observer. Attached once
+ * per bridge; pushes stop arriving when the plugin drops the subscription.
+ */
+function listenForTelemetry(tools: ITools): void {
+    const bridge = tools.automationBridge;
+    if (!bridge || bridge === telemetryBridge) return;
+    telemetryBridge = bridge;
+    bridge.on('message', (message) => {
+        const evt = message as { type?: string; event?: string; payload?: unknown };
+        if (evt.type === 'automation_event' && evt.event === 'runtime_telemetry' &&
+            evt.payload && typeof evt.payload === 'object') {
+            runtimeObserver.addTelemetry(evt.payload as RuntimeTelemetryPush);
+        }
+    });
+}
+
 /**
  * Read and ingest recent logs from disk.
  */
@@ -41,6 +91,14 @@ async function ingestDiskLogs(tools: ITools): Promise<number> {
     }
 }
 
+/**
+ * Ingest new lines from the bridge's ring buffer, or from disk when it is unavailable.
+ */
+async function ingestFreshLogs(tools: ITools): Promise<number> {
+    const streamed = await ingestBridgeLogs(tools);
+    return streamed ?? ingestDiskLogs(tools);
+}
+
 /**
  * Capture a viewport screenshot and return base64 data.
  */
@@ -113,8 +171,8 @@ export async function handleObserveTools(
 ): Promise<Record<string, unknown>> {
     switch (action) {
         case 'query_logs': {
-            // Ingest fresh logs from disk first
-            await ingestDiskLogs(tools);
+            // Ingest fresh logs first
+            await ingestFreshLogs(tools);
 
             const logs = runtimeObserver.getRecentLogs({
                 count: (args.count as number) || 50,
@@ -137,7 +195,7 @@ export async function handleObserveTools(
         }
 
         case 'get_log_summary': {
-            await ingestDiskLogs(tools);
+            await ingestFreshLogs(tools);
             const summary = runtimeObserver.getLogSummary();
             return { success: true, ...summary };
         }
@@ -166,7 +224,7 @@ export async function handleObserveTools(
             const session = runtimeObserver.startSession(scenarioLabel);
 
             // Capture initial snapshot
-            await ingestDiskLogs(tools);
+            await ingestFreshLogs(tools);
             const screenshot = await captureScreenshot(tools);
             const stats = await getSceneStats(tools);
 
@@ -196,7 +254,7 @@ export async function handleObserveTools(
             const frameIndex = session.snapshots.length;
 
             // Ingest fresh logs
-            await ingestDiskLogs(tools);
+            await ingestFreshLogs(tools);
 
             // Capture viewport
             const screenshot = await captureScreenshot(tools);
@@ -237,7 +295,7 @@ export async function handleObserveTools(
             await sleep(500);
 
             // Final log ingest
-            await ingestDiskLogs(tools);
+            await ingestFreshLogs(tools);
 
             // End session
             const report = runtimeObserver.endSession(
@@ -327,6 +385,7 @@ export async function handleObserveTools(
             const stats = await getSceneStats(tools);
             const logSummary = runtimeObserver.getLogSummary();
             const observerStatus = runtimeObserver.getStatus();
+            const telemetry = runtimeObserver.getTelemetry();
 
             return {
                 success: true,
@@ -334,9 +393,28 @@ export async function handleObserveTools(
                 sceneStats: stats,
                 logSummary,
                 observer: observerStatus,
+                ...(telemetry ? { telemetry } : {}),
             };
         }
 
+        case 'subscribe_runtime_telemetry': {
+            listenForTelemetry(tools);
+            const payload: Record<string, unknown> = {};
+            if (typeof args.intervalMs === 'number') payload.intervalMs = args.intervalMs;
+            if (typeof args.hitchThresholdMs === 'number') payload.hitchThresholdMs = args.hitchThresholdMs;
+            const result = await executeAutomationRequest(
+                tools, 'subscribe_runtime_telemetry', payload, 'Bridge unavailable'
+            ) as Record<string, unknown>;
+            if (result.success !== false) runtimeObserver.clearTelemetry();
+            return result;
+        }
+
+        case 'unsubscribe_runtime_telemetry': {
+            return await executeAutomationRequest(
+                tools, 'unsubscribe_runtime_telemetry', {}, 'Bridge unavailable'
+            ) as Record<string, unknown>;
+        }
+
         default:
             return {
                 success: false,
@@ -345,6 +423,7 @@ export async function handleObserveTools(
                     'query_logs', 'get_log_summary',
                     'start_playtest', 'capture_snapshot', 'stop_playtest',
                     'get_playtest_report', 'run_scenario', 'get_runtime_state',
+                    'subscribe_runtime_telemetry', 'unsubscribe_runtime_telemetry',
                 ],
             };
     }
@@ -54,25 +54,32 @@ export async function handlePerformanceTools(action: string, args: HandlerArgs,
       return cleanObject(res);
     }
     case 'run_benchmark': {
-      // Run benchmark using console commands with timing
+      // The plugin plays the camera path, samples every frame and replies with the stats
       const duration = typeof argsTyped.duration === 'number' ? argsTyped.duration : 60;
-
-      // Start recording
-      await executeAutomationRequest(tools, TOOL_ACTIONS.CONSOLE_COMMAND, { command: 'stat startfile' });
-      await executeAutomationRequest(tools, TOOL_ACTIONS.CONSOLE_COMMAND, { command: 'profilegpu' });
-
-      // Wait for duration
-      await new Promise(resolve => setTimeout(resolve, duration * 1000));
-
-      // Stop recording
-      await executeAutomationRequest(tools, TOOL_ACTIONS.CONSOLE_COMMAND, { command: 'stat stopfile' });
-      await executeAutomationRequest(tools, TOOL_ACTIONS.CONSOLE_COMMAND, { command: 'stat none' });
-
-      const benchmarkResult: Record<string, unknown> = {
-        success: true,
-        message: `Benchmark completed for ${duration} seconds`,
-        durationSeconds: duration
-      };
+      const warmup = typeof argsTyped.warmup === 'number' ? argsTyped.warmup : 3;
+      const res = await executeAutomationRequest(tools, TOOL_ACTIONS.RUN_BENCHMARK, {
+        duration,
+        warmup,
+        type: argsTyped.type,
+        cameraPath: argsTyped.cameraPath,
+        pathSeconds: argsTyped.pathSeconds,
+        loopPath: argsTyped.loopPath,
+        sequencePath: argsTyped.sequencePath,
+        hitchThresholdMs: argsTyped.hitchThresholdMs,
+        histogramMs: argsTyped.histogramMs,
+        csvProfile: argsTyped.csvProfile,
+        saveBaseline: argsTyped.saveBaseline,
+        baseline: argsTyped.baseline,
+        regressionThresholdPct: argsTyped.regressionThresholdPct,
+        minDeltaMs: argsTyped.minDeltaMs,
+        failOnRegression: argsTyped.failOnRegression
+      }, 'Automation bridge not available for benchmark', {
+        timeoutMs: (duration + warmup) * 1000 + 30000
+      }) as Record<string, unknown>;
+      const benchmarkResult = cleanObject(res) as Record<string, unknown>;
+      if (benchmarkResult.success === false) {
+        return benchmarkResult;
+      }
 
       // If MCP Sampling is available, ask the AI to generate recommendations
       // based on the benchmark parameters.  This is entirely optional and will
@@ -153,6 +160,19 @@ export async function handlePerformanceTools(action: string, args: HandlerArgs,
       }) as Record<string, unknown>;
       return cleanObject(res);
     }
+    case 'memory_snapshot': {
+      // Walked a slice per frame in the plugin; progress updates keep the request alive
+      const res = await executeAutomationRequest(tools, TOOL_ACTIONS.MEMORY_SNAPSHOT, {
+        topN: argsTyped.topN,
+        sortBy: argsTyped.sortBy,
+        budgetMs: argsTyped.budgetMs,
+        resourceSizeMode: argsTyped.resourceSizeMode,
+        diffWith: argsTyped.diffWith
+      }, 'Automation bridge not available for memory snapshot', {
+        timeoutMs: 120000
+      }) as Record<string, unknown>;
+      return cleanObject(res);
+    }
     case 'configure_texture_streaming': {
       const res = await executeAutomationRequest(tools, TOOL_ACTIONS.CONFIGURE_TEXTURE_STREAMING, {
         enabled: argsTyped.enabled !== false,
@@ -20,13 +20,24 @@ import { PythonTools } from '../python.js';
 export interface PythonArgs extends HandlerArgs {
     /** Path to Python script file (for execute_script action) */
     scriptPath?: string;
-    /** Inline Python code to execute (for execute_code action) */
+    /** Inline Python code to execute (for execute_code and register_script actions) */
     code?: string;
+    /** Registered script name (register_script, invoke_script, unregister_script) */
+    handle?: string;
+    /** Persistent context the code runs in */
+    context?: string;
+    /** Arguments bound to the script global `args` */
+    args?: Record<string, unknown>;
+    /** Milliseconds a cooperative script runs per editor tick */
+    budgetMs?: number;
+    /** Seconds after which a cooperative script is stopped */
+    timeoutSeconds?: number;
 }
 
 /**
  * Handle Python tool actions
- * @param action - The specific action to perform (execute_script, execute_code, get_python_info)
+ * @param action - The specific action to perform (execute_script, execute_code, get_python_info,
+ *                 register_script, invoke_script, unregister_script, reset_context, list_contexts)
  * @param args - Arguments for the action
  * @param tools - ITools interface providing access to tool instances
  * @returns Result of the Python operation
@@ -54,11 +65,38 @@ export async function handlePythonTools(
             if (!argsTyped.code) {
                 return ResponseFactory.error('code is required for execute_code action');
             }
-            return cleanObject(await pythonTools.executeCode(argsTyped.code)) as Record<string, unknown>;
+            return cleanObject(await pythonTools.executeCode(argsTyped.code, argsTyped)) as Record<string, unknown>;
 
         case 'get_python_info':
             return cleanObject(await pythonTools.getPythonInfo()) as Record<string, unknown>;
 
+        case 'register_script':
+            if (!argsTyped.handle) {
+                return ResponseFactory.error('handle is required for register_script action');
+            }
+            if (!argsTyped.code && !argsTyped.scriptPath) {
+                return ResponseFactory.error('code or scriptPath is required for register_script action');
+            }
+            return cleanObject(await pythonTools.registerScript(argsTyped.handle, argsTyped)) as Record<string, unknown>;
+
+        case 'invoke_script':
+            if (!argsTyped.handle) {
+                return ResponseFactory.error('handle is required for invoke_script action');
+            }
+            return cleanObject(await pythonTools.invokeScript(argsTyped.handle, argsTyped)) as Record<string, unknown>;
+
+        case 'unregister_script':
+            if (!argsTyped.handle) {
+                return ResponseFactory.error('handle is required for unregister_script action');
+            }
+            return cleanObject(await pythonTools.unregisterScript(argsTyped.handle)) as Record<string, unknown>;
+
+        case 'reset_context':
+            return cleanObject(await pythonTools.resetContext(argsTyped.context)) as Record<string, unknown>;
+
+        case 'list_contexts':
+            return cleanObject(await pythonTools.listContexts()) as Record<string, unknown>;
+
         default:
             return ResponseFactory.error(`Unknown Python action: ${action}`);
     }
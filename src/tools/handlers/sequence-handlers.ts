@@ -275,6 +275,16 @@ export async function handleSequenceTools(action: string, args: Record<string, u
 
       return cleanObject(res);
     }
+    case 'add_keyframes': {
+      // Bulk ingestion: whole channels of keys in one transaction.
+      const path = requireNonEmptyString(args.path, 'path', 'Missing required parameter: path');
+      const res = await executeAutomationRequest(tools, 'manage_sequence', {
+        ...args,
+        path,
+        subAction: 'add_keyframes'
+      });
+      return cleanObject(res);
+    }
     case 'add_spawnable_from_class': {
       const className = requireNonEmptyString(args.className, 'className', 'Missing required parameter: className');
       const path = typeof args.path === 'string' ? args.path.trim() : undefined;
@@ -21,7 +21,7 @@ const SKELETON_ACTIONS = [
   'add_socket', 'remove_socket', 'modify_socket',
   // 7.2 Skin Weights
   'auto_skin_weights', 'set_vertex_weights',
-  'normalize_weights', 'prune_weights',
+  'normalize_weights', 'prune_weights', 'upload_skin_data',
   'copy_weights', 'mirror_weights',
   // 7.3 Physics Asset
   'create_physics_asset',
@@ -2,7 +2,7 @@
  * Spline Handlers (Phase 26)
  *
  * Complete spline-based content creation system including:
- * - Spline Creation: create_spline_actor, add_spline_point, remove_spline_point, set_spline_point_position
+ * - Spline Creation: create_spline_actor, add_spline_point, set_spline_points, remove_spline_point, set_spline_point_position
  * - Spline Configuration: set_spline_point_tangents, set_spline_point_rotation, set_spline_point_scale, set_spline_type
  * - Spline Mesh: create_spline_mesh_component, create_spline_mesh_actor, set_spline_mesh_asset, configure_spline_mesh_axis, set_spline_mesh_material
  * - Spline Mesh Array: scatter_meshes_along_spline, configure_mesh_spacing, configure_mesh_randomization
@@ -79,7 +79,7 @@ export async function handleSplineTools(
 
   switch (action) {
     // ========================================================================
-    // Spline Creation (8 actions)
+    // Spline Creation (9 actions)
     // ========================================================================
     case 'create_spline_actor':
       return sendRequest('create_spline_actor');
@@ -87,6 +87,9 @@ export async function handleSplineTools(
     case 'add_spline_point':
       return sendRequest('add_spline_point');
 
+    case 'set_spline_points':
+      return sendRequest('set_spline_points');
+
     case 'remove_spline_point':
       return sendRequest('remove_spline_point');
 
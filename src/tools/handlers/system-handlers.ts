@@ -795,9 +795,12 @@ export async function handleSystemTools(action: string, args: HandlerArgs, tools
             script_type: scriptType,
             script_content: scriptContent,
             script_name: scriptName || `script_${Date.now()}`,
-            timeout_seconds: timeoutSeconds
+            timeout_seconds: timeoutSeconds,
+            stop_on_error: argsTyped.stop_on_error === true ? true : undefined
           },
-          'Automation bridge not available for script execution'
+          'Automation bridge not available for script execution',
+          // console_batch replies once its last command has run
+          { timeoutMs: timeoutSeconds * 1000 + 15000 }
         ) as OperationResponse;
 
         const durationMs = Date.now() - startTime;
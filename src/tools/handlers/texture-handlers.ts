@@ -95,6 +95,8 @@ export async function handleTextureTools(
         const seed = extractOptionalNumber(args, 'seed') ?? 0;
         const seamless = extractOptionalBoolean(args, 'seamless') ?? false;
         const hdr = extractOptionalBoolean(args, 'hdr') ?? false;
+        const format = extractOptionalString(args, 'format');
+        const generateMips = extractOptionalBoolean(args, 'generateMips') ?? false;
         const save = extractOptionalBoolean(args, 'save') ?? true;
 
         const res = (await executeAutomationRequest(tools, TOOL_ACTIONS.MANAGE_TEXTURE, {
@@ -111,6 +113,8 @@ export async function handleTextureTools(
           seed,
           seamless,
           hdr,
+          format,
+          generateMips,
           save,
         })) as AutomationResponse;
 
@@ -135,6 +139,8 @@ export async function handleTextureTools(
           { key: 'radius', default: 0.5 }, // For radial gradient
           { key: 'colorStops' }, // Optional array of {position, color} for multi-color gradients
           { key: 'hdr', default: false },
+          { key: 'format' }, // BGRA8, G8, G16 or RGBA16F; overrides hdr
+          { key: 'generateMips', default: false },
           { key: 'save', default: true },
         ]);
 
@@ -151,6 +157,8 @@ export async function handleTextureTools(
         const radius = extractOptionalNumber(params, 'radius') ?? 0.5;
         const colorStops = extractOptionalArray(params, 'colorStops');
         const hdr = extractOptionalBoolean(params, 'hdr') ?? false;
+        const format = extractOptionalString(params, 'format');
+        const generateMips = extractOptionalBoolean(params, 'generateMips') ?? false;
         const save = extractOptionalBoolean(params, 'save') ?? true;
 
         const res = (await executeAutomationRequest(tools, TOOL_ACTIONS.MANAGE_TEXTURE, {
@@ -168,6 +176,8 @@ export async function handleTextureTools(
           radius,
           colorStops,
           hdr,
+          format,
+          generateMips,
           save,
         })) as AutomationResponse;
 
@@ -191,6 +201,9 @@ export async function handleTextureTools(
           { key: 'lineWidth', default: 0.02 }, // For grid/stripes
           { key: 'brickRatio', default: 2.0 }, // Width/height ratio for bricks
           { key: 'offset', default: 0.5 }, // Brick offset
+          { key: 'hdr', default: false },
+          { key: 'format' }, // BGRA8, G8, G16 or RGBA16F; overrides hdr
+          { key: 'generateMips', default: false },
           { key: 'save', default: true },
         ]);
 
@@ -206,6 +219,9 @@ export async function handleTextureTools(
         const lineWidth = extractOptionalNumber(params, 'lineWidth') ?? 0.02;
         const brickRatio = extractOptionalNumber(params, 'brickRatio') ?? 2.0;
         const offset = extractOptionalNumber(params, 'offset') ?? 0.5;
+        const hdr = extractOptionalBoolean(params, 'hdr') ?? false;
+        const format = extractOptionalString(params, 'format');
+        const generateMips = extractOptionalBoolean(params, 'generateMips') ?? false;
         const save = extractOptionalBoolean(params, 'save') ?? true;
 
         const res = (await executeAutomationRequest(tools, TOOL_ACTIONS.MANAGE_TEXTURE, {
@@ -222,6 +238,9 @@ export async function handleTextureTools(
           lineWidth,
           brickRatio,
           offset,
+          hdr,
+          format,
+          generateMips,
           save,
         })) as AutomationResponse;
 
@@ -500,6 +519,39 @@ export async function handleTextureTools(
         return ResponseFactory.success(res, res.message ?? 'Texture inverted');
       }
 
+      case 'texture_pipeline': {
+        const params = normalizeArgs(args, [
+          { key: 'assetPath', aliases: ['texturePath'], required: true },
+          { key: 'ops', required: true }, // [{ op: 'blur' | 'sharpen' | 'adjust_levels' | 'adjust_curves' | 'desaturate' | 'invert' | 'swizzle', ... }]
+          { key: 'inPlace', default: true },
+          { key: 'name' },
+          { key: 'path' },
+          { key: 'save', default: true },
+        ]);
+
+        const assetPath = extractString(params, 'assetPath');
+        const ops = extractOptionalArray(params, 'ops') ?? [];
+        const inPlace = extractOptionalBoolean(params, 'inPlace') ?? true;
+        const name = extractOptionalString(params, 'name');
+        const path = extractOptionalString(params, 'path');
+        const save = extractOptionalBoolean(params, 'save') ?? true;
+
+        const res = (await executeAutomationRequest(tools, TOOL_ACTIONS.MANAGE_TEXTURE, {
+          subAction: 'texture_pipeline',
+          assetPath,
+          ops,
+          inPlace,
+          name,
+          path,
+          save,
+        })) as AutomationResponse;
+
+        if (res.success === false) {
+          return ResponseFactory.error(res.error ?? 'Failed to run texture pipeline', res.errorCode);
+        }
+        return ResponseFactory.success(res, res.message ?? 'Texture pipeline applied');
+      }
+
       case 'desaturate': {
         const params = normalizeArgs(args, [
           { key: 'assetPath', aliases: ['texturePath'], required: true },
@@ -50,7 +50,7 @@ export async function handleWidgetAuthoringTools(
 
   switch (action) {
     // =========================================================================
-    // 19.1 Widget Creation (2 actions)
+    // 19.1 Widget Creation (3 actions)
     // =========================================================================
 
     case 'create_widget_blueprint': {
@@ -67,6 +67,21 @@ export async function handleWidgetAuthoringTools(
       return sendRequest('set_widget_parent_class');
     }
 
+    case 'build_widget_tree': {
+      requireNonEmptyString(argsRecord.widgetPath, 'widgetPath', 'Missing required parameter: widgetPath');
+      if (!argsRecord.root || typeof argsRecord.root !== 'object') {
+        return cleanObject({
+          success: false,
+          error: 'MISSING_PARAMETER',
+          message: 'Missing required parameter: root (the widget spec)'
+        });
+      }
+      // Builds the whole tree from one nested spec, diffed against the
+      // existing tree by widget name, with a single compile
+      // Optional: prune (default true), compile (default true), save
+      return sendRequest('build_widget_tree');
+    }
+
     // =========================================================================
     // 19.2 Layout Panels (11 actions)
     // =========================================================================
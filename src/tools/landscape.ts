@@ -1,6 +1,7 @@
 // Landscape tools for Unreal Engine with UE 5.6 World Partition support
 import { UnrealBridge } from '../unreal-bridge.js';
 import { AutomationBridge } from '../automation/index.js';
+import { packArray } from '../automation/packed-array.js';
 import { ensureVector3 } from '../utils/validation.js';
 import { ILandscapeTools, StandardActionResponse } from '../types/tool-interfaces.js';
 
@@ -121,6 +122,8 @@ export class LandscapeTools implements ILandscapeTools {
     strength?: number;
     location?: [number, number, number];
     radius?: number;
+    stroke?: unknown;
+    spacing?: number;
   }): Promise<StandardActionResponse> {
     const [x, y, z] = ensureVector3(params.location ?? [0, 0, 0], 'sculpt location');
 
@@ -146,7 +149,10 @@ export class LandscapeTools implements ILandscapeTools {
       brushRadius: params.brushSize ?? params.radius ?? 1000,
       brushFalloff: params.brushFalloff ?? 0.5,
       strength: params.strength ?? 0.1,
-      location: { x, y, z }
+      location: { x, y, z },
+      // A stroke replaces location: all dabs are applied and committed in one edit
+      stroke: params.stroke,
+      spacing: params.spacing
     };
 
     const response = await this.automationBridge.sendAutomationRequest('sculpt_landscape', payload);
@@ -175,6 +181,9 @@ export class LandscapeTools implements ILandscapeTools {
     targetValue?: number;
     radius?: number;
     density?: number;
+    stroke?: unknown;
+    spacing?: number;
+    brushFalloff?: number;
   }): Promise<StandardActionResponse> {
     if (!this.automationBridge) {
       throw new Error('Automation Bridge not available.');
@@ -189,12 +198,22 @@ export class LandscapeTools implements ILandscapeTools {
     const minY = Math.floor(y - radius);
     const maxY = Math.floor(y + radius);
 
-    const payload = {
-      landscapeName: params.landscapeName?.trim(),
-      layerName: params.layerName?.trim(),
-      region: { minX, minY, maxX, maxY },
-      strength: params.strength ?? 1.0
-    };
+    const payload = params.stroke !== undefined
+      ? {
+        landscapeName: params.landscapeName?.trim(),
+        layerName: params.layerName?.trim(),
+        stroke: params.stroke,
+        spacing: params.spacing,
+        brushRadius: radius,
+        brushFalloff: params.brushFalloff ?? 0.5,
+        strength: params.strength ?? 1.0
+      }
+      : {
+        landscapeName: params.landscapeName?.trim(),
+        layerName: params.layerName?.trim(),
+        region: { minX, minY, maxX, maxY },
+        strength: params.strength ?? 1.0
+      };
 
     const response = await this.automationBridge.sendAutomationRequest('paint_landscape_layer', payload);
 
@@ -620,9 +639,10 @@ export class LandscapeTools implements ILandscapeTools {
     const timeoutMs = params.timeoutMs ?? 90000;
 
     try {
+      // Two bytes a sample on the wire instead of a JSON number per vertex
       const response = await this.automationBridge.sendAutomationRequest('modify_heightmap', {
         landscapeName,
-        heightData,
+        heightData: packArray('u16', heightData.map((h) => Math.min(65535, Math.max(0, Math.round(h))))),
         minX,
         minY,
         maxX,
@@ -3,6 +3,7 @@ import { UnrealBridge } from '../unreal-bridge.js';
 import { AutomationBridge } from '../automation/index.js';
 import { ensureVector3 } from '../utils/validation.js';
 import { Logger } from '../utils/logger.js';
+import { LIGHTING_BUILD_TIMEOUT_SECONDS } from '../constants.js';
 
 const log = new Logger('LightingTools');
 
@@ -836,6 +837,8 @@ export class LightingTools {
     buildOnlySelected?: boolean;
     buildReflectionCaptures?: boolean;
     levelPath?: string;
+    waitForCompletion?: boolean;
+    timeoutSeconds?: number;
   }) {
     if (!this.automationBridge) {
       throw new Error('Automation Bridge required for lighting build');
@@ -846,9 +849,14 @@ export class LightingTools {
         quality: params.quality || 'High',
         buildOnlySelected: params.buildOnlySelected || false,
         buildReflectionCaptures: params.buildReflectionCaptures !== false,
-        levelPath: params.levelPath
+        levelPath: params.levelPath,
+        waitForCompletion: params.waitForCompletion,
+        timeoutSeconds: params.timeoutSeconds
       }, {
-        timeoutMs: 300000 // 5 minutes for lighting builds
+        // The plugin replies when the build ends; waitForCompletion: false keeps the old 5 minutes
+        timeoutMs: params.waitForCompletion === false
+          ? 300000
+          : (params.timeoutSeconds ?? LIGHTING_BUILD_TIMEOUT_SECONDS) * 1000 + 30000
       });
 
       if (response.success === false) {
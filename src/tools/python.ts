@@ -21,6 +21,30 @@ interface ToolDefinition {
     outputSchema: object;
 }
 
+/** Options for code run in a persistent context (execute_code with context, invoke_script). */
+export interface PersistentRunOptions {
+    context?: string;
+    args?: Record<string, unknown>;
+    /** Milliseconds a cooperative script runs per editor tick. */
+    budgetMs?: number;
+    /** Seconds after which a cooperative script is closed; none by default. */
+    timeoutSeconds?: number;
+}
+
+function runPayload(options: PersistentRunOptions): Record<string, unknown> {
+    return {
+        context: options.context,
+        args: options.args,
+        budgetMs: options.budgetMs,
+        timeoutSeconds: options.timeoutSeconds
+    };
+}
+
+// Cooperative runs reply when they finish; give the request their timeout plus slack.
+function runTimeout(options: PersistentRunOptions): { timeoutMs?: number } {
+    return options.timeoutSeconds ? { timeoutMs: options.timeoutSeconds * 1000 + 30000 } : {};
+}
+
 export class PythonTools {
     private automationBridge: AutomationBridge | null = null;
 
@@ -55,7 +79,7 @@ export class PythonTools {
      * @param code - Python code to execute
      * @returns Result of the code execution
      */
-    async executeCode(code: string) {
+    async executeCode(code: string, options: PersistentRunOptions = {}) {
         if (!this.automationBridge) throw new Error('Automation bridge not set');
 
         if (!code || typeof code !== 'string' || code.trim().length === 0) {
@@ -66,7 +90,70 @@ export class PythonTools {
 
         return this.automationBridge.sendAutomationRequest('execute_python', {
             action: 'execute_code',
-            code: code
+            code: code,
+            ...runPayload(options)
+        }, runTimeout(options));
+    }
+
+    /**
+     * Compile a script once under a handle so later calls run it without re-parsing.
+     * @param handle - Name to invoke the script by
+     * @param source - Inline code, or a path to a .py file
+     */
+    async registerScript(handle: string, source: { code?: string; scriptPath?: string }) {
+        if (!this.automationBridge) throw new Error('Automation bridge not set');
+
+        log.info(`Registering Python script: ${handle}`);
+
+        return this.automationBridge.sendAutomationRequest('execute_python', {
+            action: 'register_script',
+            handle,
+            code: source.code,
+            scriptPath: source.scriptPath
+        });
+    }
+
+    /**
+     * Run a registered script in a persistent context. A script that sets `result` to a
+     * generator runs cooperatively and reports progress until it returns.
+     * @param handle - Handle given to registerScript
+     */
+    async invokeScript(handle: string, options: PersistentRunOptions = {}) {
+        if (!this.automationBridge) throw new Error('Automation bridge not set');
+
+        return this.automationBridge.sendAutomationRequest('execute_python', {
+            action: 'invoke_script',
+            handle,
+            ...runPayload(options)
+        }, runTimeout(options));
+    }
+
+    async unregisterScript(handle: string) {
+        if (!this.automationBridge) throw new Error('Automation bridge not set');
+
+        return this.automationBridge.sendAutomationRequest('execute_python', {
+            action: 'unregister_script',
+            handle
+        });
+    }
+
+    /**
+     * Drop a persistent context's globals, or every context when none is named.
+     */
+    async resetContext(context?: string) {
+        if (!this.automationBridge) throw new Error('Automation bridge not set');
+
+        return this.automationBridge.sendAutomationRequest('execute_python', {
+            action: 'reset_context',
+            context
+        });
+    }
+
+    async listContexts() {
+        if (!this.automationBridge) throw new Error('Automation bridge not set');
+
+        return this.automationBridge.sendAutomationRequest('execute_python', {
+            action: 'list_contexts'
         });
     }
 
@@ -97,8 +184,17 @@ Use this tool when you need to:
 
 Supported actions:
 - execute_script: Execute a Python script file from disk
-- execute_code: Execute inline Python code directly
+- execute_code: Execute inline Python code directly (pass context to keep globals between calls)
 - get_python_info: Get Python environment information
+- register_script: Compile code or a script file once under a handle
+- invoke_script: Run a registered script by handle with args, in a persistent context
+- unregister_script / reset_context / list_contexts: Manage registered scripts and contexts
+
+Persistent contexts keep globals and imports across calls. Scripts read their
+arguments from \`args\` and return a value by assigning \`result\`. Setting
+\`result\` to a generator runs it cooperatively: it is resumed for budgetMs per
+editor tick, each yielded value (a 0-1 fraction, a message or
+{ progress, message }) is reported as progress, and its return value is the result.
 
 Example - Execute a script file:
   action: "execute_script"
@@ -115,7 +211,7 @@ The Python environment has access to the 'unreal' module for editor operations.`
         properties: {
             action: {
                 type: 'string',
-                enum: ['execute_script', 'execute_code', 'get_python_info'],
+                enum: ['execute_script', 'execute_code', 'get_python_info', 'register_script', 'invoke_script', 'unregister_script', 'reset_context', 'list_contexts'],
                 description: 'Action to perform'
             },
             scriptPath: {
@@ -124,7 +220,27 @@ The Python environment has access to the 'unreal' module for editor operations.`
             },
             code: {
                 type: 'string',
-                description: 'Python code to execute inline (for execute_code action)'
+                description: 'Python code to execute inline (for execute_code and register_script actions)'
+            },
+            handle: {
+                type: 'string',
+                description: 'Registered script name (register_script, invoke_script, unregister_script)'
+            },
+            context: {
+                type: 'string',
+                description: 'Persistent context whose globals the code runs in (execute_code, invoke_script; defaults to "default" for invoke_script)'
+            },
+            args: {
+                type: 'object',
+                description: 'Arguments bound to the script global `args` (execute_code with context, invoke_script)'
+            },
+            budgetMs: {
+                type: 'number',
+                description: 'Milliseconds a cooperative script runs per editor tick (default 8)'
+            },
+            timeoutSeconds: {
+                type: 'number',
+                description: 'Seconds after which a cooperative script is stopped (default: none)'
             }
         },
         required: ['action']
@@ -145,6 +261,9 @@ The Python environment has access to the 'unreal' module for editor operations.`
             returnValue: {
                 description: 'Return value from the Python execution (if any)'
             },
+            result: {
+                description: 'Value the script assigned to `result` (persistent contexts)'
+            },
             pythonVersion: {
                 type: 'string',
                 description: 'Python version (for get_python_info action)'
@@ -100,7 +100,7 @@ export const coreToolDefinitions: ToolDefinition[] = [
             'list', 'import', 'duplicate', 'duplicate_asset', 'rename', 'rename_asset', 'move', 'move_asset', 'delete', 'delete_asset', 'delete_assets', 'create_folder', 'search_assets',
             'get_dependencies', 'get_source_control_state', 'analyze_graph', 'get_asset_graph', 'create_thumbnail', 'set_tags', 'get_metadata', 'set_metadata', 'validate', 'fixup_redirectors', 'find_by_tag', 'generate_report',
             'create_material', 'create_material_instance', 'create_render_target', 'generate_lods', 'add_material_parameter', 'list_instances', 'reset_instance_parameters', 'exists', 'get_material_stats',
-            'nanite_rebuild_mesh', 'bulk_rename', 'bulk_delete', 'source_control_checkout', 'source_control_submit',
+            'nanite_rebuild_mesh', 'bulk_build_meshes', 'bulk_rename', 'bulk_delete', 'source_control_checkout', 'source_control_submit',
             'add_material_node', 'connect_material_pins', 'remove_material_node', 'break_material_connections', 'get_material_node_details', 'rebuild_material'
           ],
           description: 'Action to perform'
@@ -112,6 +112,9 @@ export const coreToolDefinitions: ToolDefinition[] = [
         recursivePaths: commonSchemas.booleanProp,
         recursiveClasses: commonSchemas.booleanProp,
         limit: commonSchemas.numberProp,
+        pageSize: { type: 'number', description: 'search_assets: results per page; larger result sets return a nextCursor' },
+        cursor: { type: 'string', description: 'search_assets: nextCursor from the previous page' },
+        fields: { type: 'array', items: { type: 'string' }, description: 'search_assets: fields per asset (name, path, class, packagePath, packageName, tag:<TagName>)' },
         sourcePath: commonSchemas.sourcePath,
         destinationPath: commonSchemas.destinationPath,
         assetPaths: commonSchemas.arrayOfStrings,
@@ -155,6 +158,12 @@ export const coreToolDefinitions: ToolDefinition[] = [
         parentNodeId: commonSchemas.nodeId,
         childNodeId: commonSchemas.nodeId,
         maxDepth: commonSchemas.numberProp,
+        // Dependency queries (get_dependencies)
+        recursive: commonSchemas.booleanProp,
+        direction: { type: 'string', enum: ['dependencies', 'referencers'], description: 'get_dependencies: follow what the asset uses, or what uses it' },
+        dependencyType: { type: 'string', enum: ['all', 'hard', 'soft'], description: 'get_dependencies: which package dependencies to follow' },
+        pathPrefix: { type: 'string', description: 'get_dependencies: only list and walk packages under this path' },
+        offset: { type: 'number', description: 'get_dependencies: index of the first result to return' },
         // Bulk operations (C++ TryGetStringField)
         prefix: commonSchemas.stringProp,
         suffix: commonSchemas.stringProp,
@@ -166,6 +175,12 @@ export const coreToolDefinitions: ToolDefinition[] = [
         checkoutFiles: commonSchemas.booleanProp,
         // Bulk delete
         showConfirmation: commonSchemas.booleanProp,
+        // Bulk mesh builds (bulk_build_meshes: assetPaths and/or folderPath, plus lodCount)
+        enableNanite: { type: 'boolean', description: 'bulk_build_meshes: enable or disable Nanite; omit to leave Nanite settings unchanged' },
+        preserveArea: commonSchemas.booleanProp,
+        trianglePercent: { type: 'number', description: 'bulk_build_meshes: Nanite triangles kept, 0-100' },
+        fallbackPercent: { type: 'number', description: 'bulk_build_meshes: Nanite fallback triangles, 0-100' },
+        batchSize: { type: 'number', description: 'bulk_build_meshes: meshes building at once (default 32)' },
         // Material graph operations
         pinName: commonSchemas.pinName,
         desc: commonSchemas.stringProp,
@@ -457,7 +472,14 @@ export const coreToolDefinitions: ToolDefinition[] = [
         section: commonSchemas.stringProp,
         key: commonSchemas.stringProp,
         value: commonSchemas.stringProp,
-        configName: commonSchemas.stringProp
+        configName: commonSchemas.stringProp,
+        categories: { ...commonSchemas.arrayOfStrings, description: 'subscribe: stream only these log categories' },
+        excludeCategories: { ...commonSchemas.arrayOfStrings, description: 'subscribe: log categories to drop' },
+        minVerbosity: { type: 'string', description: 'subscribe: least severe log level kept (Error, Warning, Display, Log, Verbose)' },
+        contains: { type: 'string', description: 'subscribe: keep log lines containing this text' },
+        caseSensitive: { type: 'boolean', description: 'subscribe: match contains case-sensitively' },
+        regex: { type: 'string', description: 'subscribe: keep log lines matching this regular expression' },
+        cursor: { type: 'number', description: 'subscribe: replay buffered lines from this log cursor' }
       },
       required: ['action']
     },
@@ -3,6 +3,8 @@
  * Used across all *-handlers.ts files to replace 'any' types.
  */
 
+import type { PackedArray } from '../automation/packed-array.js';
+
 // ============================================================================
 // Common Geometry Types
 // ============================================================================
@@ -83,6 +85,12 @@ export interface ActorArgs extends HandlerArgs {
     componentName?: string;
     componentType?: string;
     properties?: Record<string, unknown>;
+    // spawn_actors_bulk: JSON rows or a packed block
+    transforms?: unknown;
+    locations?: unknown;
+    labelPrefix?: string;
+    folder?: string;
+    mobility?: 'static' | 'stationary' | 'movable';
 }
 
 // ============================================================================
@@ -290,6 +298,12 @@ export interface LevelArgs extends HandlerArgs {
     max?: number[];
     origin?: number[];
     extent?: number[];
+    regions?: Array<Record<string, unknown>>;
+    keepBehind?: number;
+    maxLoadedRegions?: number;
+    maxMemoryMB?: number;
+    regionNames?: string[];
+    timeoutSeconds?: number;
     metadata?: Record<string, unknown>;
     timeoutMs?: number;
     useWorldPartition?: boolean;
@@ -520,6 +534,8 @@ export interface LightingArgs extends HandlerArgs {
     indirectLightingIntensity?: number;
     buildOnlySelected?: boolean;
     buildReflectionCaptures?: boolean;
+    waitForCompletion?: boolean;
+    timeoutSeconds?: number;
 }
 
 // ============================================================================
@@ -537,6 +553,24 @@ export interface PerformanceArgs extends HandlerArgs {
     maxFPS?: number;
     verbose?: boolean;
     detailed?: boolean;
+    warmup?: number;
+    cameraPath?: Array<{ location?: Vector3; rotation?: Rotator }>;
+    pathSeconds?: number;
+    loopPath?: boolean;
+    sequencePath?: string;
+    hitchThresholdMs?: number;
+    histogramMs?: number[];
+    csvProfile?: boolean;
+    saveBaseline?: string | boolean;
+    baseline?: string;
+    regressionThresholdPct?: number;
+    minDeltaMs?: number;
+    failOnRegression?: boolean;
+    topN?: number;
+    sortBy?: 'bytes' | 'count';
+    budgetMs?: number;
+    resourceSizeMode?: 'exclusive' | 'estimatedTotal';
+    diffWith?: string;
 }
 
 // ============================================================================
@@ -624,6 +658,8 @@ export interface SystemArgs extends HandlerArgs {
     script_content?: string;
     script_name?: string;
     timeout_seconds?: number;
+    /** console_batch: stop at the first unhandled command */
+    stop_on_error?: boolean;
     dry_run?: boolean;
 }
 
@@ -1159,7 +1195,7 @@ export type SplineCoordinateSpace = 'Local' | 'World';
  * Arguments for manage_splines tool (Phase 26)
  * 
  * Covers:
- * - Spline Creation: create_spline_actor, add_spline_point, remove_spline_point, set_spline_point_position
+ * - Spline Creation: create_spline_actor, add_spline_point, set_spline_points, remove_spline_point, set_spline_point_position
  * - Spline Configuration: set_spline_point_tangents, set_spline_point_rotation, set_spline_point_scale, set_spline_type
  * - Spline Mesh: create_spline_mesh_component, set_spline_mesh_asset, configure_spline_mesh_axis, set_spline_mesh_material
  * - Spline Mesh Array: scatter_meshes_along_spline, configure_mesh_spacing, configure_mesh_randomization
@@ -1188,6 +1224,16 @@ export interface SplinesArgs extends HandlerArgs {
     pointRotation?: Rotator;
     pointScale?: Vector3;
     coordinateSpace?: SplineCoordinateSpace;
+
+    // Bulk point upload (set_spline_points): flat [x,y,z,...] arrays or packed f64x3/f32x3 blocks
+    positions?: number[] | Vector3[] | PackedArray;
+    arriveTangents?: number[] | Vector3[] | PackedArray;
+    leaveTangents?: number[] | Vector3[] | PackedArray;
+    tangents?: number[] | Vector3[] | PackedArray;
+    rotations?: number[] | Rotator[] | PackedArray;
+    scales?: number[] | Vector3[] | PackedArray;
+    pointType?: SplinePointType;
+    append?: boolean;
     
     // Spline type configuration
     splineType?: SplinePointType;
@@ -1219,6 +1265,8 @@ export interface SplinesArgs extends HandlerArgs {
     scaleMin?: number;
     scaleMax?: number;
     randomSeed?: number;
+    meshPaths?: string[];
+    clearExisting?: boolean;
     
     // Template-specific options
     templateType?: 'road' | 'river' | 'fence' | 'wall' | 'cable' | 'pipe';
@@ -1387,7 +1435,15 @@ export interface VolumesArgs extends HandlerArgs {
 export interface PythonArgs extends HandlerArgs {
     /** Absolute or project-relative path to Python script file (for execute_script action) */
     scriptPath?: string;
-    /** Inline Python code to execute (for execute_code action) */
+    /** Inline Python code to execute (for execute_code and register_script actions) */
     code?: string;
+    /** Registered script name (register_script, invoke_script, unregister_script) */
+    handle?: string;
+    /** Persistent context the code runs in */
+    context?: string;
+    /** Arguments bound to the script global `args` */
+    args?: Record<string, unknown>;
+    budgetMs?: number;
+    timeoutSeconds?: number;
 }
 
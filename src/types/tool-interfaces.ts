@@ -63,10 +63,10 @@ export interface IAssetTools {
     renameAsset(params: { sourcePath: string; destinationPath: string }): Promise<StandardActionResponse>;
     moveAsset(params: { sourcePath: string; destinationPath: string }): Promise<StandardActionResponse>;
     deleteAssets(params: { paths: string[]; fixupRedirectors?: boolean; timeoutMs?: number }): Promise<StandardActionResponse>;
-    searchAssets(params: { classNames?: string[]; packagePaths?: string[]; recursivePaths?: boolean; recursiveClasses?: boolean; limit?: number }): Promise<StandardActionResponse>;
+    searchAssets(params: { classNames?: string[]; packagePaths?: string[]; recursivePaths?: boolean; recursiveClasses?: boolean; limit?: number; pageSize?: number; cursor?: string; fields?: string[] }): Promise<StandardActionResponse>;
     saveAsset(assetPath: string): Promise<StandardActionResponse>;
     findByTag(params: { tag: string; value?: string }): Promise<StandardActionResponse>;
-    getDependencies(params: { assetPath: string; recursive?: boolean }): Promise<StandardActionResponse>;
+    getDependencies(params: { assetPath: string; recursive?: boolean; maxDepth?: number; direction?: 'dependencies' | 'referencers'; dependencyType?: 'all' | 'hard' | 'soft'; pathPrefix?: string; offset?: number; limit?: number }): Promise<StandardActionResponse>;
     getMetadata(params: { assetPath: string }): Promise<StandardActionResponse>;
     getSourceControlState(params: { assetPath: string }): Promise<SourceControlState | StandardActionResponse>;
     analyzeGraph(params: { assetPath: string; maxDepth?: number }): Promise<StandardActionResponse>;
@@ -193,8 +193,8 @@ export interface IEnvironmentTools {
 
 export interface ILandscapeTools {
     createLandscape(params: { name: string; location?: [number, number, number]; sizeX?: number; sizeY?: number; quadsPerSection?: number; sectionsPerComponent?: number; componentCount?: number; materialPath?: string; enableWorldPartition?: boolean; runtimeGrid?: string; isSpatiallyLoaded?: boolean; dataLayers?: string[] }): Promise<StandardActionResponse>;
-    sculptLandscape(params: { landscapeName: string; tool: string; brushSize?: number; brushFalloff?: number; strength?: number; location?: [number, number, number]; radius?: number }): Promise<StandardActionResponse>;
-    paintLandscape(params: { landscapeName: string; layerName: string; position: [number, number, number]; brushSize?: number; strength?: number; targetValue?: number; radius?: number; density?: number }): Promise<StandardActionResponse>;
+    sculptLandscape(params: { landscapeName: string; tool: string; brushSize?: number; brushFalloff?: number; strength?: number; location?: [number, number, number]; radius?: number; stroke?: unknown; spacing?: number }): Promise<StandardActionResponse>;
+    paintLandscape(params: { landscapeName: string; layerName: string; position: [number, number, number]; brushSize?: number; strength?: number; targetValue?: number; radius?: number; density?: number; stroke?: unknown; spacing?: number; brushFalloff?: number }): Promise<StandardActionResponse>;
     createProceduralTerrain(params: { name: string; location?: [number, number, number]; subdivisions?: number; heightFunction?: string; material?: string; settings?: Record<string, unknown> }): Promise<StandardActionResponse>;
     createLandscapeGrassType(params: { name: string; meshPath: string; density?: number; minScale?: number; maxScale?: number; path?: string; staticMesh?: string }): Promise<StandardActionResponse>;
     setLandscapeMaterial(params: { landscapeName: string; materialPath: string }): Promise<StandardActionResponse>;
@@ -205,7 +205,7 @@ export interface IFoliageTools {
     addFoliageType(params: { name: string; meshPath: string; density?: number; radius?: number; minScale?: number; maxScale?: number; alignToNormal?: boolean; randomYaw?: boolean; groundSlope?: number }): Promise<StandardActionResponse>;
     addFoliage(params: { foliageType: string; locations: Array<{ x: number; y: number; z: number }> }): Promise<StandardActionResponse>;
     paintFoliage(params: { foliageType: string; position: [number, number, number]; brushSize?: number; paintDensity?: number; eraseMode?: boolean }): Promise<StandardActionResponse>;
-    createProceduralFoliage(params: { name: string; bounds?: { location: { x: number; y: number; z: number }; size: { x: number; y: number; z: number } }; foliageTypes?: Array<{ meshPath: string; density: number; minScale?: number; maxScale?: number; alignToNormal?: boolean; randomYaw?: boolean }>; volumeName?: string; position?: [number, number, number]; size?: [number, number, number]; seed?: number; tileSize?: number }): Promise<StandardActionResponse>;
+    createProceduralFoliage(params: { name: string; bounds?: { location: { x: number; y: number; z: number }; size: { x: number; y: number; z: number } }; foliageTypes?: Array<{ meshPath: string; density: number; minScale?: number; maxScale?: number; alignToNormal?: boolean; randomYaw?: boolean; foliageTypePath?: string; minDistance?: number; maxSlope?: number; zOffset?: number }>; mode?: 'spawner' | 'scatter'; landscapeOnly?: boolean; parallel?: boolean; volumeName?: string; position?: [number, number, number]; size?: [number, number, number]; seed?: number; tileSize?: number }): Promise<StandardActionResponse>;
     addFoliageInstances(params: { foliageType: string; transforms: Array<{ location: [number, number, number]; rotation?: [number, number, number]; scale?: [number, number, number] }> }): Promise<StandardActionResponse>;
     getFoliageInstances(params: { foliageType?: string }): Promise<StandardActionResponse>;
     removeFoliage(params: { foliageType?: string; removeAll?: boolean }): Promise<StandardActionResponse>;
@@ -110,6 +110,7 @@ export const TOOL_ACTIONS = {
   // ==================== PERFORMANCE ACTIONS ====================
   START_PROFILING: 'start_profiling',
   STOP_PROFILING: 'stop_profiling',
+  RUN_BENCHMARK: 'run_benchmark',
   SHOW_FPS: 'show_fps',
   SHOW_STATS: 'show_stats',
   SET_SCALABILITY: 'set_scalability',
@@ -117,6 +118,7 @@ export const TOOL_ACTIONS = {
   SET_VSYNC: 'set_vsync',
   SET_FRAME_RATE_LIMIT: 'set_frame_rate_limit',
   GENERATE_MEMORY_REPORT: 'generate_memory_report',
+  MEMORY_SNAPSHOT: 'memory_snapshot',
   CONFIGURE_TEXTURE_STREAMING: 'configure_texture_streaming',
   CONFIGURE_LOD: 'configure_lod',
   MERGE_ACTORS: 'merge_actors',
@@ -0,0 +1,339 @@
+#!/usr/bin/env node
+/**
+ * Automation Bridge Round-Trip Benchmark
+ *
+ * Measures the bridge's own overhead, separately from handler cost, by
+ * driving the no-op `bridge_echo` action straight over the plugin's
+ * WebSocket (no MCP server in between). For every connection count and
+ * payload size it reports round-trip latency percentiles and throughput,
+ * plus the plugin's queue-wait / dispatch / serialization split from
+ * `get_bridge_metrics`.
+ *
+ * Each connection runs closed-loop (one request in flight), so throughput at
+ * N connections is the rate the bridge sustains with N concurrent callers.
+ * Requests above the plugin's 5 MB inbound message limit are sent small and
+ * ask for a `responseBytes` reply, which measures the outbound path alone
+ * (direction "down" in the report).
+ *
+ * Prerequisites:
+ * - UE Editor running with the McpAutomationBridge plugin loaded
+ *
+ * Usage:
+ *   node tests/bridge-benchmark.mjs
+ *   node tests/bridge-benchmark.mjs --connections 1,8 --sizes 100,1k,1m --requests 100
+ *   node tests/bridge-benchmark.mjs --lane worker --json tests/reports/bridge-benchmark.json
+ *
+ * Options:
+ *   --connections <list>  Concurrent connections per run (default 1,8,64)
+ *   --sizes <list>        Payload sizes, with k/m suffixes (default 100,1k,10k,100k,1m,10m)
+ *   --requests <n>        Requests per connection per run (default scales down with size)
+ *   --warmup <n>          Unmeasured requests per connection first (default 3)
+ *   --lane <game|worker>  Dispatch on the game thread (default) or the thread-safe worker lane
+ *   --binary              Return the payload as a binary attachment instead of a JSON string
+ *   --json <path>         Also write the results as JSON
+ *
+ * Environment: MCP_AUTOMATION_WS_HOST, MCP_AUTOMATION_WS_PORTS,
+ * MCP_AUTOMATION_CAPABILITY_TOKEN (same as the server).
+ */
+
+import WebSocket from 'ws';
+import fs from 'node:fs/promises';
+import path from 'node:path';
+
+const INBOUND_LIMIT_BYTES = 5 * 1024 * 1024;
+const ENVELOPE_ALLOWANCE_BYTES = 4096;
+const BYTES_PER_RUN_BUDGET = 256 * 1024 * 1024;
+const ATTACHMENT_MAGIC = Buffer.from('MCPA', 'ascii');
+
+function parseSize(text) {
+  const match = /^(\d+(?:\.\d+)?)([kmKM]?)[bB]?$/.exec(text.trim());
+  if (!match) throw new Error(`Invalid size: ${text}`);
+  const scale = { '': 1, k: 1024, m: 1024 * 1024 }[match[2].toLowerCase()];
+  return Math.round(Number(match[1]) * scale);
+}
+
+function formatBytes(bytes) {
+  if (bytes >= 1024 * 1024) return `${(bytes / (1024 * 1024)).toFixed(bytes % (1024 * 1024) ? 1 : 0)}MB`;
+  if (bytes >= 1024) return `${(bytes / 1024).toFixed(bytes % 1024 ? 1 : 0)}KB`;
+  return `${bytes}B`;
+}
+
+function parseArgs(argv) {
+  const options = {
+    connections: [1, 8, 64],
+    sizes: ['100', '1k', '10k', '100k', '1m', '10m'].map(parseSize),
+    requests: 0,
+    warmup: 3,
+    lane: 'game',
+    binary: false,
+    json: ''
+  };
+  for (let i = 0; i < argv.length; i++) {
+    const arg = argv[i];
+    const next = () => {
+      if (i + 1 >= argv.length) throw new Error(`${arg} needs a value`);
+      return argv[++i];
+    };
+    if (arg === '--connections') options.connections = next().split(',').map((v) => parseInt(v, 10)).filter((v) => v > 0);
+    else if (arg === '--sizes') options.sizes = next().split(',').map(parseSize);
+    else if (arg === '--requests') options.requests = Math.max(1, parseInt(next(), 10) || 1);
+    else if (arg === '--warmup') options.warmup = Math.max(0, parseInt(next(), 10) || 0);
+    else if (arg === '--lane') options.lane = next() === 'worker' ? 'worker' : 'game';
+    else if (arg === '--binary') options.binary = true;
+    else if (arg === '--json') options.json = next();
+    else throw new Error(`Unknown option: ${arg}`);
+  }
+  if (options.binary && options.lane === 'worker') {
+    throw new Error('--binary needs the game lane; attachments are staged on the game thread');
+  }
+  return options;
+}
+
+function percentile(sorted, p) {
+  if (sorted.length === 0) return 0;
+  const index = Math.min(sorted.length - 1, Math.max(0, Math.ceil((p / 100) * sorted.length) - 1));
+  return sorted[index];
+}
+
+/**
+ * One handshaken bridge connection that correlates automation_response
+ * messages (and their attachment frames) with requests by requestId.
+ */
+class BridgeConnection {
+  constructor(url, token, binary) {
+    this.url = url;
+    this.token = token;
+    this.binary = binary;
+    this.pending = new Map();
+    this.attachmentBytes = new Map();
+    this.nextId = 0;
+    this.tag = Math.random().toString(36).slice(2, 8);
+  }
+
+  open() {
+    return new Promise((resolve, reject) => {
+      const headers = this.token ? { 'X-MCP-Capability-Token': this.token } : undefined;
+      this.socket = new WebSocket(this.url, 'mcp-automation', { headers, perMessageDeflate: false });
+      const timer = setTimeout(() => reject(new Error('Handshake timeout')), 5000);
+      this.socket.once('error', (err) => { clearTimeout(timer); reject(err); });
+      this.socket.once('open', () => {
+        this.socket.once('message', (data) => {
+          clearTimeout(timer);
+          const ack = JSON.parse(data.toString('utf8'));
+          if (ack.type !== 'bridge_ack') {
+            reject(new Error(`Expected bridge_ack, got ${ack.type}`));
+            return;
+          }
+          this.socket.on('message', (frame, isBinary) => this.onMessage(frame, isBinary));
+          this.socket.on('close', () => this.failAll(new Error('Socket closed')));
+          resolve(ack);
+        });
+        this.socket.send(JSON.stringify({
+          type: 'bridge_hello',
+          capabilityToken: this.token || undefined,
+          capabilities: this.binary ? ['binary_attachments'] : []
+        }));
+      });
+    });
+  }
+
+  request(action, payload) {
+    const requestId = `bench-${this.tag}-${this.nextId++}`;
+    return new Promise((resolve, reject) => {
+      this.pending.set(requestId, { resolve, reject, response: null, descriptors: [] });
+      this.socket.send(JSON.stringify({ type: 'automation_request', requestId, action, payload }), (err) => {
+        if (err) {
+          this.pending.delete(requestId);
+          reject(err);
+        }
+      });
+    });
+  }
+
+  onMessage(frame, isBinary) {
+    if (isBinary) {
+      if (frame.length < 14 || !frame.subarray(0, 4).equals(ATTACHMENT_MAGIC)) return;
+      const idLength = frame[5];
+      const id = frame.toString('utf8', 6, 6 + idLength);
+      const received = (this.attachmentBytes.get(id) ?? 0) + frame.length - (14 + idLength);
+      this.attachmentBytes.set(id, received);
+      for (const [requestId, entry] of this.pending) {
+        if (entry.descriptors.some((d) => d.id === id)) this.tryComplete(requestId, entry);
+      }
+      return;
+    }
+    const message = JSON.parse(frame.toString('utf8'));
+    if (message.type !== 'automation_response') return;
+    const entry = this.pending.get(message.requestId);
+    if (!entry) return;
+    entry.response = message;
+    entry.descriptors = Array.isArray(message.attachments) ? message.attachments : [];
+    this.tryComplete(message.requestId, entry);
+  }
+
+  tryComplete(requestId, entry) {
+    if (!entry.response) return;
+    if (!entry.descriptors.every((d) => (this.attachmentBytes.get(d.id) ?? 0) >= d.size)) return;
+    for (const d of entry.descriptors) this.attachmentBytes.delete(d.id);
+    this.pending.delete(requestId);
+    if (entry.response.success === false) {
+      entry.reject(new Error(`${entry.response.error || 'ERROR'}: ${entry.response.message ?? ''}`));
+    } else {
+      entry.resolve(entry.response);
+    }
+  }
+
+  failAll(error) {
+    for (const entry of this.pending.values()) entry.reject(error);
+    this.pending.clear();
+  }
+
+  close() {
+    this.socket?.close();
+  }
+}
+
+async function findBridgeUrl() {
+  const host = process.env.MCP_AUTOMATION_WS_HOST ?? '127.0.0.1';
+  const ports = process.env.MCP_AUTOMATION_WS_PORTS
+    ? process.env.MCP_AUTOMATION_WS_PORTS.split(',').map((p) => parseInt(p.trim(), 10)).filter(Boolean)
+    : [8090, 8091];
+  const token = process.env.MCP_AUTOMATION_CAPABILITY_TOKEN ?? '';
+  for (const port of ports) {
+    const url = `ws://${host}:${port}`;
+    const probe = new BridgeConnection(url, token, false);
+    try {
+      await probe.open();
+      probe.close();
+      return { url, token };
+    } catch {
+      probe.close();
+    }
+  }
+  throw new Error(`No automation bridge answered on ${host}:${ports.join(',')}`);
+}
+
+function echoPayload(size, options) {
+  const payload = {};
+  if (options.lane === 'worker') payload.thread = 'worker';
+  if (options.binary) payload.binary = true;
+  if (size + ENVELOPE_ALLOWANCE_BYTES <= INBOUND_LIMIT_BYTES) {
+    payload.data = 'x'.repeat(size);
+    return { payload, direction: 'both' };
+  }
+  payload.responseBytes = size;
+  return { payload, direction: 'down' };
+}
+
+async function runPoint(target, connectionCount, size, options, control) {
+  const perConnection = options.requests
+    || Math.max(5, Math.min(200, Math.floor(BYTES_PER_RUN_BUDGET / (size * connectionCount))));
+  const { payload, direction } = echoPayload(size, options);
+  const connections = Array.from({ length: connectionCount },
+    () => new BridgeConnection(target.url, target.token, options.binary));
+  await Promise.all(connections.map((c) => c.open()));
+
+  try {
+    for (let i = 0; i < options.warmup; i++) {
+      await Promise.all(connections.map((c) => c.request('bridge_echo', payload)));
+    }
+    await control.request('get_bridge_metrics', { reset: true });
+
+    const latencies = [];
+    let errors = 0;
+    const started = process.hrtime.bigint();
+    await Promise.all(connections.map(async (connection) => {
+      for (let i = 0; i < perConnection; i++) {
+        const sent = process.hrtime.bigint();
+        try {
+          await connection.request('bridge_echo', payload);
+          latencies.push(Number(process.hrtime.bigint() - sent) / 1e6);
+        } catch {
+          errors++;
+        }
+      }
+    }));
+    const elapsedSeconds = Number(process.hrtime.bigint() - started) / 1e9;
+
+    const metrics = await control.request('get_bridge_metrics', {});
+    latencies.sort((a, b) => a - b);
+    const bytesPerRequest = direction === 'both' ? size * 2 : size;
+    return {
+      connections: connectionCount,
+      sizeBytes: size,
+      direction,
+      requests: latencies.length,
+      errors,
+      seconds: Number(elapsedSeconds.toFixed(3)),
+      throughputRps: Number((latencies.length / elapsedSeconds).toFixed(1)),
+      throughputMBps: Number(((latencies.length * bytesPerRequest) / elapsedSeconds / (1024 * 1024)).toFixed(2)),
+      latencyMs: {
+        p50: Number(percentile(latencies, 50).toFixed(3)),
+        p90: Number(percentile(latencies, 90).toFixed(3)),
+        p99: Number(percentile(latencies, 99).toFixed(3)),
+        max: Number((latencies[latencies.length - 1] ?? 0).toFixed(3))
+      },
+      bridge: metrics.result?.actions?.bridge_echo ?? null
+    };
+  } finally {
+    connections.forEach((c) => c.close());
+  }
+}
+
+async function main() {
+  const options = parseArgs(process.argv.slice(2));
+  const target = await findBridgeUrl();
+  const control = new BridgeConnection(target.url, target.token, false);
+  await control.open();
+
+  console.log('='.repeat(60));
+  console.log('Automation Bridge Round-Trip Benchmark');
+  console.log('='.repeat(60));
+  console.log(`Bridge: ${target.url}  lane: ${options.lane}  encoding: ${options.binary ? 'binary attachment' : 'json'}`);
+  console.log('');
+  console.log('conns  size     dir   reqs    req/s     MB/s     p50ms    p90ms    p99ms    maxms  errors');
+
+  const results = [];
+  try {
+    for (const connectionCount of options.connections) {
+      for (const size of options.sizes) {
+        const r = await runPoint(target, connectionCount, size, options, control);
+        results.push(r);
+        console.log([
+          String(r.connections).padStart(5),
+          formatBytes(r.sizeBytes).padEnd(8),
+          r.direction.padEnd(5),
+          String(r.requests).padStart(5),
+          r.throughputRps.toFixed(1).padStart(8),
+          r.throughputMBps.toFixed(2).padStart(8),
+          r.latencyMs.p50.toFixed(2).padStart(9),
+          r.latencyMs.p90.toFixed(2).padStart(8),
+          r.latencyMs.p99.toFixed(2).padStart(8),
+          r.latencyMs.max.toFixed(2).padStart(8),
+          String(r.errors).padStart(7)
+        ].join('  '));
+      }
+    }
+  } finally {
+    control.close();
+  }
+
+  if (options.json) {
+    await fs.mkdir(path.dirname(path.resolve(options.json)), { recursive: true });
+    await fs.writeFile(options.json, JSON.stringify({
+      bridge: target.url,
+      lane: options.lane,
+      binary: options.binary,
+      capturedAt: new Date().toISOString(),
+      results
+    }, null, 2));
+    console.log(`\nResults written to ${options.json}`);
+  }
+
+  if (results.some((r) => r.errors > 0)) process.exitCode = 1;
+}
+
+main().catch((err) => {
+  console.error(`Bridge benchmark failed: ${err.message}`);
+  process.exit(1);
+});